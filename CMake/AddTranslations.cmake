@@ -0,0 +1,43 @@
+include(GetRelativePath)
+
+# Compile the gettext .po files into .hitc translation catalogs.
+#
+# The catalogs are written to the same relative path in the binary directory
+# as the .po file has in the source directory; for example "resources/locale/nl.po"
+# is compiled to "${CMAKE_CURRENT_BINARY_DIR}/resources/locale/nl.hitc".
+#
+# load_translations() prefers a .hitc file over a .po file with the same name.
+function(add_translation_catalogs RET)
+    if(NOT TARGET hikogui_po_compiler)
+        message(FATAL_ERROR "add_translation_catalogs() depends on the hikogui_po_compiler target.\n")
+    endif()
+
+    message(STATUS "[ADD_TRANSLATION_CATALOGS] Adding translation catalogs to target \"${RET}\"")
+
+    foreach(SOURCE_FILE IN LISTS ARGN)
+        message(STATUS "add_translation_catalogs: ${SOURCE_FILE}")
+        get_filename_component(INPUT_PATH "${SOURCE_FILE}" ABSOLUTE)
+        get_filename_component(INPUT_NAME "${SOURCE_FILE}" NAME_WLE)
+        get_relative_path(INPUT_RELPATH "${INPUT_PATH}")
+
+        get_filename_component(OUTPUT_RELDIR "${INPUT_RELPATH}" DIRECTORY)
+        set(OUTPUT_RELPATH "${OUTPUT_RELDIR}/${INPUT_NAME}.hitc")
+        get_filename_component(OUTPUT_PATH "${OUTPUT_RELPATH}" ABSOLUTE BASE_DIR "${CMAKE_CURRENT_BINARY_DIR}")
+
+        # Create the output directory.
+        get_filename_component(OUTPUT_DIR "${OUTPUT_PATH}" DIRECTORY)
+        file(MAKE_DIRECTORY "${OUTPUT_DIR}")
+
+        # Add a custom command to compile the .po file to a catalog.
+        add_custom_command(
+            OUTPUT "${OUTPUT_PATH}"
+            COMMAND hikogui_po_compiler "${INPUT_PATH}" "${OUTPUT_PATH}"
+            DEPENDS "${INPUT_PATH}" hikogui_po_compiler
+            VERBATIM)
+
+        list(APPEND OUTPUT_PATHS "${OUTPUT_PATH}")
+    endforeach()
+
+    add_custom_target("${RET}_translations" DEPENDS ${OUTPUT_PATHS})
+    add_dependencies(${RET} "${RET}_translations")
+endfunction()
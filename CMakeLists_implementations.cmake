@@ -8,10 +8,15 @@ target_sources(hikogui PRIVATE
     ${HIKOGUI_SOURCE_DIR}/font/true_type_font_impl.cpp
     ${HIKOGUI_SOURCE_DIR}/GFX/draw_context_impl.cpp
     ${HIKOGUI_SOURCE_DIR}/GFX/gfx_device_impl.cpp
+    ${HIKOGUI_SOURCE_DIR}/GFX/gfx_device_software_impl.cpp
     ${HIKOGUI_SOURCE_DIR}/GFX/gfx_device_vulkan_impl.cpp
+    ${HIKOGUI_SOURCE_DIR}/GFX/gfx_rasterizer_impl.cpp
     ${HIKOGUI_SOURCE_DIR}/GFX/gfx_surface_impl.cpp
+    ${HIKOGUI_SOURCE_DIR}/GFX/gfx_surface_software_impl.cpp
+    $<$<PLATFORM_ID:Windows>:${HIKOGUI_SOURCE_DIR}/GFX/gfx_surface_software_win32_impl.cpp>
     ${HIKOGUI_SOURCE_DIR}/GFX/gfx_surface_vulkan_impl.cpp
     ${HIKOGUI_SOURCE_DIR}/GFX/gfx_system_impl.cpp
+    ${HIKOGUI_SOURCE_DIR}/GFX/gfx_system_software_impl.cpp
     ${HIKOGUI_SOURCE_DIR}/GFX/gfx_system_vulkan_impl.cpp
     $<$<PLATFORM_ID:Windows>:${HIKOGUI_SOURCE_DIR}/GFX/gfx_system_vulkan_win32_impl.cpp>
     ${HIKOGUI_SOURCE_DIR}/GFX/paged_image_impl.cpp
@@ -45,3 +50,17 @@ target_sources(hikogui PRIVATE
     ${HIKOGUI_SOURCE_DIR}/text/text_shaper_line_impl.cpp
     ${HIKOGUI_SOURCE_DIR}/text/text_style_impl.cpp
 ) 
+
+# The cpu_dispatch kernels are compiled once for each CPU level; the best variant
+# is selected at run-time. These files are compiled with the same options as the
+# rest of the library, the kernels select their CPU level with target attributes.
+if (${CMAKE_SYSTEM_PROCESSOR} MATCHES "AMD64|x86_64")
+    target_sources(hikogui PRIVATE
+        ${HIKOGUI_SOURCE_DIR}/SIMD/cpu_dispatch_x64v1_impl.cpp
+        ${HIKOGUI_SOURCE_DIR}/SIMD/cpu_dispatch_x64v2_impl.cpp
+        ${HIKOGUI_SOURCE_DIR}/SIMD/cpu_dispatch_x64v3_impl.cpp
+        ${HIKOGUI_SOURCE_DIR}/SIMD/cpu_dispatch_x64v4_impl.cpp
+    )
+else()
+    target_sources(hikogui PRIVATE ${HIKOGUI_SOURCE_DIR}/SIMD/cpu_dispatch_generic_impl.cpp)
+endif()
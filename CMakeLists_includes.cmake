@@ -12,7 +12,13 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/audio/audio_device_state.hpp
     $<$<PLATFORM_ID:Windows>:${HIKOGUI_SOURCE_DIR}/audio/audio_device_win32.hpp>
     ${HIKOGUI_SOURCE_DIR}/audio/audio_direction.hpp
+    ${HIKOGUI_SOURCE_DIR}/audio/audio_fake_device_clock.hpp
     ${HIKOGUI_SOURCE_DIR}/audio/audio_format_range.hpp
+    ${HIKOGUI_SOURCE_DIR}/audio/audio_graph.hpp
+    ${HIKOGUI_SOURCE_DIR}/audio/audio_graph_processor.hpp
+    ${HIKOGUI_SOURCE_DIR}/audio/audio_node.hpp
+    ${HIKOGUI_SOURCE_DIR}/audio/audio_sample_convert.hpp
+    ${HIKOGUI_SOURCE_DIR}/audio/audio_sample_convert_kernels.hpp
     ${HIKOGUI_SOURCE_DIR}/audio/audio_sample_format.hpp
     ${HIKOGUI_SOURCE_DIR}/audio/audio_sample_packer.hpp
     ${HIKOGUI_SOURCE_DIR}/audio/audio_sample_unpacker.hpp
@@ -47,6 +53,9 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/char_maps/utf_16.hpp
     ${HIKOGUI_SOURCE_DIR}/char_maps/utf_32.hpp
     ${HIKOGUI_SOURCE_DIR}/char_maps/utf_8.hpp
+    ${HIKOGUI_SOURCE_DIR}/char_maps/utf_transcode.hpp
+    ${HIKOGUI_SOURCE_DIR}/char_maps/utf_transcode_kernels.hpp
+    ${HIKOGUI_SOURCE_DIR}/codec/base64_kernels.hpp
     ${HIKOGUI_SOURCE_DIR}/codec/base_n.hpp
     ${HIKOGUI_SOURCE_DIR}/codec/BON8.hpp
     ${HIKOGUI_SOURCE_DIR}/codec/datum.hpp
@@ -59,6 +68,8 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/codec/codec.hpp
     ${HIKOGUI_SOURCE_DIR}/codec/pickle.hpp
     ${HIKOGUI_SOURCE_DIR}/codec/png.hpp
+    ${HIKOGUI_SOURCE_DIR}/codec/png_unfilter.hpp
+    ${HIKOGUI_SOURCE_DIR}/codec/png_unfilter_kernels.hpp
     ${HIKOGUI_SOURCE_DIR}/codec/SHA2.hpp
     ${HIKOGUI_SOURCE_DIR}/codec/zlib.hpp
     ${HIKOGUI_SOURCE_DIR}/color/color.hpp
@@ -78,6 +89,7 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/concurrency/subsystem.hpp
     ${HIKOGUI_SOURCE_DIR}/concurrency/thread.hpp
     ${HIKOGUI_SOURCE_DIR}/concurrency/thread_intf.hpp
+    ${HIKOGUI_SOURCE_DIR}/concurrency/thread_pool.hpp
     $<$<PLATFORM_ID:Windows>:${HIKOGUI_SOURCE_DIR}/concurrency/thread_win32_impl.hpp>
     ${HIKOGUI_SOURCE_DIR}/concurrency/unfair_mutex.hpp
     ${HIKOGUI_SOURCE_DIR}/concurrency/unfair_mutex_intf.hpp
@@ -98,6 +110,7 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/container/gap_buffer.hpp
     ${HIKOGUI_SOURCE_DIR}/container/hash_map.hpp
     ${HIKOGUI_SOURCE_DIR}/container/lean_vector.hpp
+    ${HIKOGUI_SOURCE_DIR}/container/lru_cache.hpp
     ${HIKOGUI_SOURCE_DIR}/container/module.hpp
     ${HIKOGUI_SOURCE_DIR}/container/packed_int_array.hpp
     ${HIKOGUI_SOURCE_DIR}/container/polymorphic_optional.hpp
@@ -123,6 +136,14 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/crt/crt_utils_intf.hpp
     $<$<PLATFORM_ID:Windows>:${HIKOGUI_SOURCE_DIR}/crt/crt_utils_win32_impl.hpp>
     ${HIKOGUI_SOURCE_DIR}/crt/terminate.hpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_biquad.hpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_fir.hpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_fir_kernels.hpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_float.hpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_float_kernels.hpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_resampler.hpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_resampler_kernels.hpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/module.hpp
     ${HIKOGUI_SOURCE_DIR}/file/access_mode.hpp
     ${HIKOGUI_SOURCE_DIR}/file/file_file_intf.hpp
     $<$<PLATFORM_ID:Linux>:${HIKOGUI_SOURCE_DIR}/file/file_file_posix_impl.hpp>
@@ -216,17 +237,23 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/formula/formula_unary_operator_node.hpp
     ${HIKOGUI_SOURCE_DIR}/formula/formula_vector_literal_node.hpp
     ${HIKOGUI_SOURCE_DIR}/formula/formula.hpp
+    ${HIKOGUI_SOURCE_DIR}/GFX/damage_region.hpp
     ${HIKOGUI_SOURCE_DIR}/GFX/draw_context.hpp
+    ${HIKOGUI_SOURCE_DIR}/GFX/draw_list.hpp
     ${HIKOGUI_SOURCE_DIR}/GFX/gfx_device.hpp
+    ${HIKOGUI_SOURCE_DIR}/GFX/gfx_device_software.hpp
     ${HIKOGUI_SOURCE_DIR}/GFX/gfx_device_vulkan.hpp
     ${HIKOGUI_SOURCE_DIR}/GFX/gfx_queue_vulkan.hpp
+    ${HIKOGUI_SOURCE_DIR}/GFX/gfx_rasterizer.hpp
     ${HIKOGUI_SOURCE_DIR}/GFX/gfx_surface.hpp
     ${HIKOGUI_SOURCE_DIR}/GFX/gfx_surface_delegate.hpp
     ${HIKOGUI_SOURCE_DIR}/GFX/gfx_surface_delegate_vulkan.hpp
+    ${HIKOGUI_SOURCE_DIR}/GFX/gfx_surface_software.hpp
     ${HIKOGUI_SOURCE_DIR}/GFX/gfx_surface_state.hpp
     ${HIKOGUI_SOURCE_DIR}/GFX/gfx_surface_vulkan.hpp
     ${HIKOGUI_SOURCE_DIR}/GFX/gfx_system.hpp
     ${HIKOGUI_SOURCE_DIR}/GFX/gfx_system_globals.hpp
+    ${HIKOGUI_SOURCE_DIR}/GFX/gfx_system_software.hpp
     ${HIKOGUI_SOURCE_DIR}/GFX/gfx_system_vulkan.hpp
     ${HIKOGUI_SOURCE_DIR}/GFX/module.hpp
     ${HIKOGUI_SOURCE_DIR}/GFX/paged_image.hpp
@@ -255,6 +282,8 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/GFX/pipeline_tone_mapper_push_constants.hpp
     ${HIKOGUI_SOURCE_DIR}/GFX/pipeline_vulkan.hpp
     ${HIKOGUI_SOURCE_DIR}/GFX/RenderDoc.hpp
+    ${HIKOGUI_SOURCE_DIR}/GUI/frame_pipeline.hpp
+    ${HIKOGUI_SOURCE_DIR}/GUI/frame_scheduler.hpp
     ${HIKOGUI_SOURCE_DIR}/GUI/gui_event.hpp
     ${HIKOGUI_SOURCE_DIR}/GUI/gui_event_type.hpp
     ${HIKOGUI_SOURCE_DIR}/GUI/gui_event_variant.hpp
@@ -265,6 +294,7 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/GUI/gui_window_size.hpp
     $<$<PLATFORM_ID:Windows>:${HIKOGUI_SOURCE_DIR}/GUI/gui_window_win32.hpp>
     ${HIKOGUI_SOURCE_DIR}/GUI/hitbox.hpp
+    ${HIKOGUI_SOURCE_DIR}/GUI/hitbox_index.hpp
     ${HIKOGUI_SOURCE_DIR}/GUI/keyboard_bindings.hpp
     ${HIKOGUI_SOURCE_DIR}/GUI/keyboard_focus_direction.hpp
     ${HIKOGUI_SOURCE_DIR}/GUI/keyboard_focus_group.hpp
@@ -328,11 +358,16 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/i18n/module.hpp
     ${HIKOGUI_SOURCE_DIR}/image/module.hpp
     ${HIKOGUI_SOURCE_DIR}/image/pixmap.hpp
+    ${HIKOGUI_SOURCE_DIR}/image/pixmap_resample.hpp
+    ${HIKOGUI_SOURCE_DIR}/image/pixmap_resample_row.hpp
+    ${HIKOGUI_SOURCE_DIR}/image/pixmap_resample_row_kernels.hpp
     ${HIKOGUI_SOURCE_DIR}/image/pixmap_span.hpp
     ${HIKOGUI_SOURCE_DIR}/image/sdf_r8.hpp
     ${HIKOGUI_SOURCE_DIR}/image/sfloat_rg32.hpp
     ${HIKOGUI_SOURCE_DIR}/image/sfloat_rgb32.hpp
     ${HIKOGUI_SOURCE_DIR}/image/sfloat_rgba16.hpp
+    ${HIKOGUI_SOURCE_DIR}/image/sfloat_rgba16_row.hpp
+    ${HIKOGUI_SOURCE_DIR}/image/sfloat_rgba16_row_kernels.hpp
     ${HIKOGUI_SOURCE_DIR}/image/sfloat_rgba32.hpp
     ${HIKOGUI_SOURCE_DIR}/image/sfloat_rgba32x4.hpp
     ${HIKOGUI_SOURCE_DIR}/image/sint_abgr8_pack.hpp
@@ -345,6 +380,7 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/l10n/po_parser.hpp
     ${HIKOGUI_SOURCE_DIR}/l10n/txt.hpp
     ${HIKOGUI_SOURCE_DIR}/l10n/translation.hpp
+    ${HIKOGUI_SOURCE_DIR}/l10n/translation_catalog.hpp
     ${HIKOGUI_SOURCE_DIR}/dispatch/awaitable_timer.hpp
     ${HIKOGUI_SOURCE_DIR}/dispatch/awaitable_timer_intf.hpp
     ${HIKOGUI_SOURCE_DIR}/dispatch/awaitable_timer_impl.hpp
@@ -358,6 +394,7 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     $<$<PLATFORM_ID:Windows>:${HIKOGUI_SOURCE_DIR}/dispatch/socket_event_win32_impl.hpp>
     ${HIKOGUI_SOURCE_DIR}/layout/box_constraints.hpp
     ${HIKOGUI_SOURCE_DIR}/layout/box_shape.hpp
+    ${HIKOGUI_SOURCE_DIR}/layout/estimated_extents.hpp
     ${HIKOGUI_SOURCE_DIR}/layout/grid_layout.hpp
     ${HIKOGUI_SOURCE_DIR}/layout/module.hpp
     ${HIKOGUI_SOURCE_DIR}/layout/row_column_layout.hpp
@@ -389,6 +426,7 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/observer/group_ptr.hpp
     ${HIKOGUI_SOURCE_DIR}/observer/module.hpp
     ${HIKOGUI_SOURCE_DIR}/observer/observable.hpp
+    ${HIKOGUI_SOURCE_DIR}/observer/observable_path.hpp
     ${HIKOGUI_SOURCE_DIR}/observer/observable_value.hpp
     ${HIKOGUI_SOURCE_DIR}/observer/observer.hpp
     ${HIKOGUI_SOURCE_DIR}/observer/shared_state.hpp
@@ -412,25 +450,34 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/random/seed_intf.hpp
     $<$<PLATFORM_ID:Windows>:${HIKOGUI_SOURCE_DIR}/random/seed_win32_impl.hpp>
     ${HIKOGUI_SOURCE_DIR}/random/xorshift128p.hpp
+    ${HIKOGUI_SOURCE_DIR}/SIMD/cpu_dispatch.hpp
+    ${HIKOGUI_SOURCE_DIR}/SIMD/cpu_dispatch_kernels.hpp
     ${HIKOGUI_SOURCE_DIR}/SIMD/float16_sse4_1.hpp
     ${HIKOGUI_SOURCE_DIR}/SIMD/module.hpp
     ${HIKOGUI_SOURCE_DIR}/SIMD/native_f16x8_sse2.hpp
     ${HIKOGUI_SOURCE_DIR}/SIMD/native_f32x4_sse.hpp
+    ${HIKOGUI_SOURCE_DIR}/SIMD/native_f32x8_avx.hpp
+    ${HIKOGUI_SOURCE_DIR}/SIMD/native_f32x16_avx512f.hpp
     ${HIKOGUI_SOURCE_DIR}/SIMD/native_f64x4_avx.hpp
     ${HIKOGUI_SOURCE_DIR}/SIMD/native_i16x8_sse2.hpp
+    ${HIKOGUI_SOURCE_DIR}/SIMD/native_i16x16_avx2.hpp
     ${HIKOGUI_SOURCE_DIR}/SIMD/native_i32x4_sse2.hpp
+    ${HIKOGUI_SOURCE_DIR}/SIMD/native_i32x8_avx2.hpp
+    ${HIKOGUI_SOURCE_DIR}/SIMD/native_i32x16_avx512f.hpp
     ${HIKOGUI_SOURCE_DIR}/SIMD/native_i64x4_avx2.hpp
     ${HIKOGUI_SOURCE_DIR}/SIMD/native_i8x16_sse2.hpp
     ${HIKOGUI_SOURCE_DIR}/SIMD/native_simd_conversions_x86.hpp
     ${HIKOGUI_SOURCE_DIR}/SIMD/native_simd_utility.hpp
     ${HIKOGUI_SOURCE_DIR}/SIMD/native_u32x4_sse2.hpp
+    ${HIKOGUI_SOURCE_DIR}/SIMD/native_u32x8_avx2.hpp
+    ${HIKOGUI_SOURCE_DIR}/SIMD/native_u8x32_avx2.hpp
     ${HIKOGUI_SOURCE_DIR}/SIMD/simd.hpp
     ${HIKOGUI_SOURCE_DIR}/SIMD/simd_test_utility.hpp
     ${HIKOGUI_SOURCE_DIR}/security/module.hpp
     ${HIKOGUI_SOURCE_DIR}/security/security.hpp
     $<$<PLATFORM_ID:Windows>:${HIKOGUI_SOURCE_DIR}/security/security_win32.hpp>
     ${HIKOGUI_SOURCE_DIR}/security/sip_hash.hpp
-    #${HIKOGUI_SOURCE_DIR}/settings/cpu_id.hpp
+    ${HIKOGUI_SOURCE_DIR}/settings/cpu_id.hpp
     ${HIKOGUI_SOURCE_DIR}/settings/settings.hpp
     ${HIKOGUI_SOURCE_DIR}/settings/os_settings.hpp
     ${HIKOGUI_SOURCE_DIR}/settings/os_settings_intf.hpp
@@ -459,6 +506,7 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/skeleton/skeleton_while_node.hpp
     ${HIKOGUI_SOURCE_DIR}/telemetry/counters.hpp
     ${HIKOGUI_SOURCE_DIR}/telemetry/delayed_format.hpp
+    ${HIKOGUI_SOURCE_DIR}/telemetry/duration_histogram.hpp
     ${HIKOGUI_SOURCE_DIR}/telemetry/format_check.hpp
     ${HIKOGUI_SOURCE_DIR}/telemetry/log.hpp
     ${HIKOGUI_SOURCE_DIR}/telemetry/module.hpp
@@ -471,6 +519,7 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/text/text_shaper.hpp
     ${HIKOGUI_SOURCE_DIR}/text/text_shaper_char.hpp
     ${HIKOGUI_SOURCE_DIR}/text/text_shaper_line.hpp
+    ${HIKOGUI_SOURCE_DIR}/text/text_shaper_run_cache.hpp
     ${HIKOGUI_SOURCE_DIR}/text/text_style.hpp
     ${HIKOGUI_SOURCE_DIR}/time/chrono.hpp
     ${HIKOGUI_SOURCE_DIR}/time/module.hpp
@@ -491,10 +540,12 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/unicode/ucd_grapheme_cluster_breaks.hpp
     ${HIKOGUI_SOURCE_DIR}/unicode/ucd_lexical_classes.hpp
     ${HIKOGUI_SOURCE_DIR}/unicode/ucd_line_break_classes.hpp
+    ${HIKOGUI_SOURCE_DIR}/unicode/ucd_properties.hpp
     ${HIKOGUI_SOURCE_DIR}/unicode/ucd_scripts.hpp
     ${HIKOGUI_SOURCE_DIR}/unicode/ucd_sentence_break_properties.hpp
     ${HIKOGUI_SOURCE_DIR}/unicode/ucd_word_break_properties.hpp
     ${HIKOGUI_SOURCE_DIR}/unicode/unicode_bidi.hpp
+    ${HIKOGUI_SOURCE_DIR}/unicode/unicode_break_latin1.hpp
     ${HIKOGUI_SOURCE_DIR}/unicode/unicode_break_opportunity.hpp
     ${HIKOGUI_SOURCE_DIR}/unicode/unicode_description.hpp
     ${HIKOGUI_SOURCE_DIR}/unicode/unicode_grapheme_cluster_break.hpp
@@ -522,6 +573,7 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/utility/fixed_string.hpp
     ${HIKOGUI_SOURCE_DIR}/utility/float16.hpp
     ${HIKOGUI_SOURCE_DIR}/utility/forward_value.hpp
+    ${HIKOGUI_SOURCE_DIR}/utility/function_ref.hpp
     ${HIKOGUI_SOURCE_DIR}/utility/hash.hpp
     ${HIKOGUI_SOURCE_DIR}/utility/math.hpp
     ${HIKOGUI_SOURCE_DIR}/utility/memory.hpp
@@ -565,6 +617,8 @@ target_sources(hikogui PUBLIC FILE_SET hikogui_include_files TYPE HEADERS BASE_D
     ${HIKOGUI_SOURCE_DIR}/widgets/toolbar_button_widget.hpp
     ${HIKOGUI_SOURCE_DIR}/widgets/toolbar_tab_button_widget.hpp
     ${HIKOGUI_SOURCE_DIR}/widgets/toolbar_widget.hpp
+    ${HIKOGUI_SOURCE_DIR}/widgets/virtual_grid_delegate.hpp
+    ${HIKOGUI_SOURCE_DIR}/widgets/virtual_grid_widget.hpp
     ${HIKOGUI_SOURCE_DIR}/widgets/widget.hpp
     ${HIKOGUI_SOURCE_DIR}/widgets/widget_mode.hpp
     ${HIKOGUI_SOURCE_DIR}/widgets/window_controls_macos_widget.hpp
@@ -15,7 +15,9 @@ target_sources(hikogui_tests PRIVATE
     ${HIKOGUI_SOURCE_DIR}/algorithm/algorithm_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/algorithm/ranges_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/algorithm/strings_tests.cpp
-    #${HIKOGUI_SOURCE_DIR}/audio/audio_sample_packer_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/audio/audio_graph_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/audio/audio_sample_convert_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/audio/audio_sample_packer_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/audio/audio_sample_unpacker_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/char_maps/ascii_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/char_maps/char_converter_tests.cpp
@@ -24,6 +26,7 @@ target_sources(hikogui_tests PRIVATE
     ${HIKOGUI_SOURCE_DIR}/char_maps/utf_16_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/char_maps/utf_32_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/char_maps/utf_8_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/char_maps/utf_transcode_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/codec/base_n_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/codec/BON8_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/codec/datum_tests.cpp
@@ -35,16 +38,25 @@ target_sources(hikogui_tests PRIVATE
     ${HIKOGUI_SOURCE_DIR}/concurrency/unfair_mutex_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/concurrency/notifier_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/concurrency/rcu_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/concurrency/thread_pool_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/container/gap_buffer_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/container/lean_vector_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/container/lru_cache_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/container/packed_int_array_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/container/polymorphic_optional_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/container/small_map_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/container/tree_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/coroutine/generator_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_biquad_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_fir_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_float_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/DSP/dsp_resampler_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/file/file_view_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/font/font_char_map_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/formula/formula_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/GFX/damage_region_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/GFX/draw_list_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/GFX/gfx_rasterizer_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/geometry/matrix3_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/geometry/point2_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/geometry/point3_tests.cpp
@@ -57,12 +69,18 @@ target_sources(hikogui_tests PRIVATE
     ${HIKOGUI_SOURCE_DIR}/geometry/vector3_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/graphic_path/bezier_curve_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/graphic_path/graphic_path_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/GUI/frame_scheduler_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/i18n/iso_15924_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/i18n/iso_3166_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/i18n/iso_639_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/i18n/language_tag_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/image/pixmap_span_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/image/pixmap_resample_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/image/pixmap_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/image/sfloat_rgba16_row_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/l10n/translation_catalog_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/l10n/txt_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/layout/estimated_extents_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/layout/spreadsheet_address_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/numeric/bigint_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/numeric/bound_integer_tests.cpp
@@ -74,6 +92,7 @@ target_sources(hikogui_tests PRIVATE
     ${HIKOGUI_SOURCE_DIR}/numeric/polynomial_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/numeric/safe_int_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/observer/group_ptr_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/observer/observable_path_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/observer/shared_state_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/parser/lexer_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/parser/lookahead_iterator_tests.cpp
@@ -85,10 +104,15 @@ target_sources(hikogui_tests PRIVATE
     ${HIKOGUI_SOURCE_DIR}/random/xorshift128p_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/security/sip_hash_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/settings/user_settings_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/SIMD/cpu_dispatch_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/SIMD/simd_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/skeleton/skeleton_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/telemetry/counters_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/telemetry/duration_histogram_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/telemetry/format_check_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/text/text_shaper_run_cache_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/text/text_shaper_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/unicode/ucd_properties_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/unicode/ucd_scripts_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/unicode/unicode_bidi_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/unicode/unicode_break_tests.cpp
@@ -100,11 +124,14 @@ target_sources(hikogui_tests PRIVATE
     ${HIKOGUI_SOURCE_DIR}/utility/fixed_string_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/utility/float16_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/utility/forward_value_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/utility/function_ref_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/utility/math_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/utility/reflection_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/utility/type_traits_tests.cpp
     ${HIKOGUI_SOURCE_DIR}/utility/units_tests.cpp
     #${HIKOGUI_SOURCE_DIR}/widgets/text_widget_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/widgets/virtual_grid_widget_tests.cpp
+    ${HIKOGUI_SOURCE_DIR}/widgets/widget_tests.cpp
 )
 
 install(DIRECTORY tests/data/ DESTINATION tests COMPONENT tests EXCLUDE_FROM_ALL)
@@ -135,8 +162,17 @@ if (${CMAKE_SYSTEM_PROCESSOR} MATCHES "AMD64|x86_64")
 
         target_sources(hikogui_x64v1_tests PRIVATE
             ${HIKOGUI_SOURCE_DIR}/SIMD/native_f32x4_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_f32x8_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_f32x16_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_f64x4_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_i16x16_tests.cpp
             ${HIKOGUI_SOURCE_DIR}/SIMD/native_i32x4_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_i32x8_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_i32x16_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_i64x4_tests.cpp
             ${HIKOGUI_SOURCE_DIR}/SIMD/native_u32x4_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_u32x8_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_u8x32_tests.cpp
         )
     endif()
 
@@ -162,8 +198,17 @@ if (${CMAKE_SYSTEM_PROCESSOR} MATCHES "AMD64|x86_64")
 
         target_sources(hikogui_x64v2_tests PRIVATE
             ${HIKOGUI_SOURCE_DIR}/SIMD/native_f32x4_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_f32x8_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_f32x16_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_f64x4_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_i16x16_tests.cpp
             ${HIKOGUI_SOURCE_DIR}/SIMD/native_i32x4_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_i32x8_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_i32x16_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_i64x4_tests.cpp
             ${HIKOGUI_SOURCE_DIR}/SIMD/native_u32x4_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_u32x8_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_u8x32_tests.cpp
         )
     endif()
 
@@ -189,10 +234,17 @@ if (${CMAKE_SYSTEM_PROCESSOR} MATCHES "AMD64|x86_64")
 
         target_sources(hikogui_x64v3_tests PRIVATE
             ${HIKOGUI_SOURCE_DIR}/SIMD/native_f32x4_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_f32x8_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_f32x16_tests.cpp
             ${HIKOGUI_SOURCE_DIR}/SIMD/native_f64x4_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_i16x16_tests.cpp
             ${HIKOGUI_SOURCE_DIR}/SIMD/native_i32x4_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_i32x8_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_i32x16_tests.cpp
             ${HIKOGUI_SOURCE_DIR}/SIMD/native_i64x4_tests.cpp
             ${HIKOGUI_SOURCE_DIR}/SIMD/native_u32x4_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_u32x8_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_u8x32_tests.cpp
         )
     endif()
 
@@ -218,10 +270,17 @@ if (${CMAKE_SYSTEM_PROCESSOR} MATCHES "AMD64|x86_64")
 
         target_sources(hikogui_x64v4_tests PRIVATE
             ${HIKOGUI_SOURCE_DIR}/SIMD/native_f32x4_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_f32x8_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_f32x16_tests.cpp
             ${HIKOGUI_SOURCE_DIR}/SIMD/native_f64x4_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_i16x16_tests.cpp
             ${HIKOGUI_SOURCE_DIR}/SIMD/native_i32x4_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_i32x8_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_i32x16_tests.cpp
             ${HIKOGUI_SOURCE_DIR}/SIMD/native_i64x4_tests.cpp
             ${HIKOGUI_SOURCE_DIR}/SIMD/native_u32x4_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_u32x8_tests.cpp
+            ${HIKOGUI_SOURCE_DIR}/SIMD/native_u8x32_tests.cpp
         )
     endif()
 
@@ -26,8 +26,10 @@ public:
         // trigger the calculations in `set_layout()` as well.
         _layout = {};
 
-        // We need to recursively set the constraints of any child widget here as well
-        _label_constraints = _label_widget->update_constraints();
+        // We need to recursively get the constraints of any child widget here as well.
+        // Use `reconstrain()` instead of `update_constraints()`, it returns the cached
+        // constraints of the child unless the child, or one of its descendants, requested a reconstrain.
+        _label_constraints = _label_widget->reconstrain();
 
         // We add the ability to resize the widget beyond the size of the label.
         auto r = hi::box_constraints{};
@@ -58,9 +60,10 @@ public:
             _label_shape = hi::box_shape{_label_constraints, label_rectangle, theme().baseline_adjustment()};
         }
 
-        // The layout of any child widget must always be set, even if the layout didn't actually change.
-        // This is because child widgets may need to re-layout for other reasons.
-        _label_widget->set_layout(context.transform(_label_shape));
+        // The layout of any child widget must always be passed on, even if the layout didn't actually change.
+        // Use `relayout()` instead of `set_layout()`, it only calls the child's `set_layout()` when the
+        // layout has changed or when the child requested a relayout.
+        _label_widget->relayout(context.transform(_label_shape));
     }
 
     // The `draw()` function is called when all or part of the window requires redrawing.
@@ -98,15 +101,22 @@ protected:
     //
     // The order of the children returned is used for determining the next widget for
     // keyboard navigation.
-    //
-    // The allocator argument should not be used by the function, it is used by the caller
-    // to allocate the co-routine's frame on the stack.
     [[nodiscard]] hi::generator<widget_intf &> children(bool include_invisible) noexcept override
     {
-        // This function is often written as a co-routine that yields a pointer to each of its children.
+        // This function is often written as a co-routine that yields a reference to each of its children.
         co_yield *_label_widget;
     }
 
+    // This function SHOULD be overridden when a widget has children.
+    //
+    // It must visit the same children as `children()`. It is used by `reconstrain()`, `relayout()`
+    // and the other passes over the widget tree, which would otherwise allocate a co-routine frame
+    // for each widget by calling `children()`.
+    void for_each_child(bool include_invisible, hi::function_ref<void(widget_intf&)> func) noexcept override
+    {
+        func(*_label_widget);
+    }
+
 private:
     // Child widgets are owned by their parent.
     std::unique_ptr<hi::label_widget> _label_widget;
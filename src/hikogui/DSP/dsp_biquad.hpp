@@ -0,0 +1,239 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file DSP/dsp_biquad.hpp Second order IIR filter sections.
+ * @ingroup DSP
+ */
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <concepts>
+#include <numbers>
+#include <algorithm>
+#include <complex>
+#include <cmath>
+
+hi_export_module(hikogui.DSP.dsp_biquad);
+
+namespace hi { inline namespace v1 {
+
+/** A second order IIR filter section.
+ *
+ * The filter is implemented in the transposed direct form II, which keeps
+ * two state variables per section. The coefficients of the factory
+ * functions are from Robert Bristow-Johnson's "Audio EQ Cookbook", normalized
+ * so that `a0` is 1.
+ *
+ * The filter is recursive; each output sample depends on the previous output
+ * sample, so the samples of a channel are processed one at a time.
+ */
+hi_export template<std::floating_point T>
+struct dsp_biquad {
+    using value_type = T;
+
+    value_type b0 = value_type{1};
+    value_type b1 = value_type{0};
+    value_type b2 = value_type{0};
+    value_type a1 = value_type{0};
+    value_type a2 = value_type{0};
+
+    value_type z1 = value_type{0};
+    value_type z2 = value_type{0};
+
+    constexpr dsp_biquad() noexcept = default;
+    constexpr dsp_biquad(dsp_biquad const&) noexcept = default;
+    constexpr dsp_biquad(dsp_biquad&&) noexcept = default;
+    constexpr dsp_biquad& operator=(dsp_biquad const&) noexcept = default;
+    constexpr dsp_biquad& operator=(dsp_biquad&&) noexcept = default;
+
+    constexpr dsp_biquad(value_type b0, value_type b1, value_type b2, value_type a1, value_type a2) noexcept :
+        b0(b0), b1(b1), b2(b2), a1(a1), a2(a2)
+    {
+    }
+
+    /** Clear the state of the filter.
+     */
+    constexpr void reset() noexcept
+    {
+        z1 = value_type{0};
+        z2 = value_type{0};
+    }
+
+    /** Filter a single sample.
+     */
+    [[nodiscard]] constexpr value_type operator()(value_type x) noexcept
+    {
+        hilet y = b0 * x + z1;
+        z1 = b1 * x - a1 * y + z2;
+        z2 = b2 * x - a2 * y;
+        return y;
+    }
+
+    /** The magnitude of the frequency response.
+     *
+     * @param sample_rate The sample rate in Hz.
+     * @param frequency The frequency in Hz.
+     * @return The gain of the filter at @a frequency.
+     */
+    [[nodiscard]] value_type magnitude(value_type sample_rate, value_type frequency) const noexcept
+    {
+        hilet w = value_type{2} * std::numbers::pi_v<value_type> * frequency / sample_rate;
+        hilet z = std::polar(value_type{1}, -w);
+        hilet z2_ = z * z;
+        hilet num = b0 + b1 * z + b2 * z2_;
+        hilet den = value_type{1} + a1 * z + a2 * z2_;
+        return std::abs(num / den);
+    }
+
+    [[nodiscard]] static dsp_biquad lowpass(value_type sample_rate, value_type frequency, value_type q) noexcept
+    {
+        hilet [cos_w, alpha] = prepare(sample_rate, frequency, q);
+        return normalize(
+            (value_type{1} - cos_w) / value_type{2},
+            value_type{1} - cos_w,
+            (value_type{1} - cos_w) / value_type{2},
+            value_type{1} + alpha,
+            value_type{-2} * cos_w,
+            value_type{1} - alpha);
+    }
+
+    [[nodiscard]] static dsp_biquad highpass(value_type sample_rate, value_type frequency, value_type q) noexcept
+    {
+        hilet [cos_w, alpha] = prepare(sample_rate, frequency, q);
+        return normalize(
+            (value_type{1} + cos_w) / value_type{2},
+            -(value_type{1} + cos_w),
+            (value_type{1} + cos_w) / value_type{2},
+            value_type{1} + alpha,
+            value_type{-2} * cos_w,
+            value_type{1} - alpha);
+    }
+
+    /** A band-pass filter with a peak gain of 1.
+     */
+    [[nodiscard]] static dsp_biquad bandpass(value_type sample_rate, value_type frequency, value_type q) noexcept
+    {
+        hilet [cos_w, alpha] = prepare(sample_rate, frequency, q);
+        return normalize(
+            alpha, value_type{0}, -alpha, value_type{1} + alpha, value_type{-2} * cos_w, value_type{1} - alpha);
+    }
+
+    /** A peaking equalizer.
+     *
+     * @param gain_db The gain at @a frequency in dB.
+     */
+    [[nodiscard]] static dsp_biquad
+    peaking(value_type sample_rate, value_type frequency, value_type q, value_type gain_db) noexcept
+    {
+        hilet [cos_w, alpha] = prepare(sample_rate, frequency, q);
+        hilet A = std::pow(value_type{10}, gain_db / value_type{40});
+        return normalize(
+            value_type{1} + alpha * A,
+            value_type{-2} * cos_w,
+            value_type{1} - alpha * A,
+            value_type{1} + alpha / A,
+            value_type{-2} * cos_w,
+            value_type{1} - alpha / A);
+    }
+
+    /** A low shelf filter.
+     *
+     * @param gain_db The gain below @a frequency in dB.
+     */
+    [[nodiscard]] static dsp_biquad
+    low_shelf(value_type sample_rate, value_type frequency, value_type q, value_type gain_db) noexcept
+    {
+        hilet [cos_w, alpha] = prepare(sample_rate, frequency, q);
+        hilet A = std::pow(value_type{10}, gain_db / value_type{40});
+        hilet beta = value_type{2} * std::sqrt(A) * alpha;
+        return normalize(
+            A * ((A + value_type{1}) - (A - value_type{1}) * cos_w + beta),
+            value_type{2} * A * ((A - value_type{1}) - (A + value_type{1}) * cos_w),
+            A * ((A + value_type{1}) - (A - value_type{1}) * cos_w - beta),
+            (A + value_type{1}) + (A - value_type{1}) * cos_w + beta,
+            value_type{-2} * ((A - value_type{1}) + (A + value_type{1}) * cos_w),
+            (A + value_type{1}) + (A - value_type{1}) * cos_w - beta);
+    }
+
+    /** A high shelf filter.
+     *
+     * @param gain_db The gain above @a frequency in dB.
+     */
+    [[nodiscard]] static dsp_biquad
+    high_shelf(value_type sample_rate, value_type frequency, value_type q, value_type gain_db) noexcept
+    {
+        hilet [cos_w, alpha] = prepare(sample_rate, frequency, q);
+        hilet A = std::pow(value_type{10}, gain_db / value_type{40});
+        hilet beta = value_type{2} * std::sqrt(A) * alpha;
+        return normalize(
+            A * ((A + value_type{1}) + (A - value_type{1}) * cos_w + beta),
+            value_type{-2} * A * ((A - value_type{1}) + (A + value_type{1}) * cos_w),
+            A * ((A + value_type{1}) + (A - value_type{1}) * cos_w - beta),
+            (A + value_type{1}) - (A - value_type{1}) * cos_w + beta,
+            value_type{2} * ((A - value_type{1}) - (A + value_type{1}) * cos_w),
+            (A + value_type{1}) - (A - value_type{1}) * cos_w - beta);
+    }
+
+private:
+    struct prepared_type {
+        value_type cos_w;
+        value_type alpha;
+    };
+
+    [[nodiscard]] static prepared_type prepare(value_type sample_rate, value_type frequency, value_type q) noexcept
+    {
+        hi_axiom(sample_rate > value_type{0});
+        hi_axiom(frequency > value_type{0} and frequency < sample_rate / value_type{2});
+        hi_axiom(q > value_type{0});
+
+        hilet w = value_type{2} * std::numbers::pi_v<value_type> * frequency / sample_rate;
+        return {std::cos(w), std::sin(w) / (value_type{2} * q)};
+    }
+
+    [[nodiscard]] static dsp_biquad
+    normalize(value_type b0, value_type b1, value_type b2, value_type a0, value_type a1, value_type a2) noexcept
+    {
+        return {b0 / a0, b1 / a0, b2 / a0, a1 / a0, a2 / a0};
+    }
+};
+
+/** Filter samples through a cascade of biquad sections.
+ *
+ * The buffer is filtered by each section in turn, which keeps the state of
+ * a section in registers for the whole buffer.
+ *
+ * @param r The result, may be the same buffer as @a a.
+ * @param a The samples.
+ * @param sections The filter sections, their state is updated.
+ */
+hi_export template<std::floating_point T>
+void dsp_biquad_cascade(
+    std::span<T> r,
+    std::type_identity_t<std::span<T const>> a,
+    std::type_identity_t<std::span<dsp_biquad<T>>> sections) noexcept
+{
+    hi_axiom(r.size() == a.size());
+
+    auto const *src = a.data();
+    for (auto& section : sections) {
+        auto tmp = section;
+        for (auto i = 0_uz; i != r.size(); ++i) {
+            r[i] = tmp(src[i]);
+        }
+        section.z1 = tmp.z1;
+        section.z2 = tmp.z2;
+
+        // The following sections filter the result in-place.
+        src = r.data();
+    }
+
+    if (sections.empty() and r.data() != a.data()) {
+        std::copy(a.begin(), a.end(), r.begin());
+    }
+}
+
+}} // namespace hi::v1
@@ -0,0 +1,120 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "dsp_biquad.hpp"
+#include "dsp_float.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+#include <array>
+#include <cmath>
+#include <numbers>
+
+using namespace hi;
+
+namespace {
+
+/** Measure the gain of a filter cascade by filtering a sine wave.
+ */
+[[nodiscard]] float measure_gain(std::span<dsp_biquad<float>> sections, float sample_rate, float frequency)
+{
+    auto samples = std::vector<float>(48000);
+    for (auto i = 0_uz; i != samples.size(); ++i) {
+        samples[i] = static_cast<float>(
+            std::sin(2.0 * std::numbers::pi * static_cast<double>(frequency) * static_cast<double>(i) / sample_rate));
+    }
+
+    dsp_biquad_cascade(std::span{samples}, std::span<float const>{samples}, sections);
+
+    // Skip the first half to let the filter settle.
+    hilet settled = std::span{samples}.subspan(samples.size() / 2);
+    return dsp_rms(settled) / std::sqrt(0.5f);
+}
+
+} // namespace
+
+TEST(dsp_biquad, identity)
+{
+    auto section = dsp_biquad<float>{};
+    for (auto i = 0; i != 10; ++i) {
+        ASSERT_EQ(section(static_cast<float>(i)), static_cast<float>(i));
+    }
+}
+
+TEST(dsp_biquad, lowpass)
+{
+    auto sections = std::array{dsp_biquad<float>::lowpass(48000.0f, 1000.0f, std::numbers::sqrt2_v<float> / 2.0f)};
+
+    ASSERT_NEAR(sections[0].magnitude(48000.0f, 1.0f), 1.0f, 1e-3f);
+    ASSERT_NEAR(sections[0].magnitude(48000.0f, 1000.0f), std::sqrt(0.5f), 1e-3f);
+    ASSERT_LT(sections[0].magnitude(48000.0f, 10000.0f), 0.02f);
+
+    ASSERT_NEAR(measure_gain(sections, 48000.0f, 100.0f), sections[0].magnitude(48000.0f, 100.0f), 1e-2f);
+    sections[0].reset();
+    ASSERT_NEAR(measure_gain(sections, 48000.0f, 5000.0f), sections[0].magnitude(48000.0f, 5000.0f), 1e-2f);
+}
+
+TEST(dsp_biquad, highpass)
+{
+    hilet section = dsp_biquad<float>::highpass(48000.0f, 1000.0f, std::numbers::sqrt2_v<float> / 2.0f);
+
+    ASSERT_LT(section.magnitude(48000.0f, 10.0f), 1e-3f);
+    ASSERT_NEAR(section.magnitude(48000.0f, 1000.0f), std::sqrt(0.5f), 1e-3f);
+    ASSERT_NEAR(section.magnitude(48000.0f, 20000.0f), 1.0f, 1e-3f);
+}
+
+TEST(dsp_biquad, bandpass)
+{
+    hilet section = dsp_biquad<float>::bandpass(48000.0f, 1000.0f, 2.0f);
+
+    ASSERT_NEAR(section.magnitude(48000.0f, 1000.0f), 1.0f, 1e-3f);
+    ASSERT_LT(section.magnitude(48000.0f, 100.0f), 0.1f);
+    ASSERT_LT(section.magnitude(48000.0f, 10000.0f), 0.1f);
+}
+
+TEST(dsp_biquad, peaking_and_shelves)
+{
+    hilet db = [](float gain) {
+        return 20.0f * std::log10(gain);
+    };
+
+    hilet peaking = dsp_biquad<float>::peaking(48000.0f, 1000.0f, 1.0f, 6.0f);
+    ASSERT_NEAR(db(peaking.magnitude(48000.0f, 1000.0f)), 6.0f, 1e-2f);
+    ASSERT_NEAR(db(peaking.magnitude(48000.0f, 10.0f)), 0.0f, 1e-2f);
+
+    hilet low_shelf = dsp_biquad<float>::low_shelf(48000.0f, 1000.0f, std::numbers::sqrt2_v<float> / 2.0f, -12.0f);
+    ASSERT_NEAR(db(low_shelf.magnitude(48000.0f, 10.0f)), -12.0f, 1e-2f);
+    ASSERT_NEAR(db(low_shelf.magnitude(48000.0f, 20000.0f)), 0.0f, 1e-1f);
+
+    hilet high_shelf = dsp_biquad<float>::high_shelf(48000.0f, 1000.0f, std::numbers::sqrt2_v<float> / 2.0f, 3.0f);
+    ASSERT_NEAR(db(high_shelf.magnitude(48000.0f, 10.0f)), 0.0f, 1e-2f);
+    ASSERT_NEAR(db(high_shelf.magnitude(48000.0f, 20000.0f)), 3.0f, 1e-1f);
+}
+
+TEST(dsp_biquad, cascade_in_blocks)
+{
+    // Filtering in blocks gives the same result as filtering all samples at once.
+    auto samples = std::vector<float>(1000);
+    for (auto i = 0_uz; i != samples.size(); ++i) {
+        samples[i] = static_cast<float>(static_cast<int>(i * 7919 % 2001) - 1000) / 1000.0f;
+    }
+
+    auto sections = std::array{
+        dsp_biquad<float>::lowpass(48000.0f, 5000.0f, 0.7f),
+        dsp_biquad<float>::peaking(48000.0f, 2000.0f, 2.0f, 6.0f),
+        dsp_biquad<float>::highpass(48000.0f, 50.0f, 0.7f)};
+    auto block_sections = sections;
+
+    auto expected = std::vector<float>(samples.size());
+    dsp_biquad_cascade(std::span{expected}, std::span<float const>{samples}, std::span{sections});
+
+    auto result = std::vector<float>(samples.size());
+    for (auto offset = 0_uz; offset < samples.size(); offset += 97) {
+        hilet size = std::min(97_uz, samples.size() - offset);
+        dsp_biquad_cascade(
+            std::span{result}.subspan(offset, size), std::span<float const>{samples}.subspan(offset, size), std::span{block_sections});
+    }
+
+    ASSERT_EQ(result, expected);
+}
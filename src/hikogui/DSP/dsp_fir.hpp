@@ -0,0 +1,134 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file DSP/dsp_fir.hpp Finite impulse response filter.
+ * @ingroup DSP
+ */
+
+#pragma once
+
+#include "dsp_float.hpp"
+#include "../SIMD/cpu_dispatch.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <concepts>
+#include <algorithm>
+
+hi_export_module(hikogui.DSP.dsp_fir);
+
+namespace hi { inline namespace v1 {
+
+/** The signature of the dsp_fir kernel.
+ *
+ * Calculates `r[n] = sum(taps[k] * x[n + num_taps - 1 - k])`, for each output
+ * sample for which all input samples are available in @a x.
+ *
+ * @param r The output samples.
+ * @param x The input samples, `size + num_taps - 1` samples.
+ * @param size The number of output samples.
+ * @param taps The impulse response.
+ * @param num_taps The number of taps.
+ */
+template<typename T>
+using dsp_fir_type = void(T *r, T const *x, size_t size, T const *taps, size_t num_taps);
+
+#if HI_PROCESSOR == HI_CPU_X64
+namespace cpu_x64v1 {
+dsp_fir_type<float> dsp_fir_f32;
+dsp_fir_type<double> dsp_fir_f64;
+} // namespace cpu_x64v1
+namespace cpu_x64v2 {
+dsp_fir_type<float> dsp_fir_f32;
+dsp_fir_type<double> dsp_fir_f64;
+} // namespace cpu_x64v2
+namespace cpu_x64v3 {
+dsp_fir_type<float> dsp_fir_f32;
+dsp_fir_type<double> dsp_fir_f64;
+} // namespace cpu_x64v3
+namespace cpu_x64v4 {
+dsp_fir_type<float> dsp_fir_f32;
+dsp_fir_type<double> dsp_fir_f64;
+} // namespace cpu_x64v4
+
+hi_export inline cpu_dispatch<dsp_fir_type<float>> dsp_fir_f32 = {
+    cpu_x64v1::dsp_fir_f32,
+    cpu_x64v2::dsp_fir_f32,
+    cpu_x64v3::dsp_fir_f32,
+    cpu_x64v4::dsp_fir_f32};
+hi_export inline cpu_dispatch<dsp_fir_type<double>> dsp_fir_f64 = {
+    cpu_x64v1::dsp_fir_f64,
+    cpu_x64v2::dsp_fir_f64,
+    cpu_x64v3::dsp_fir_f64,
+    cpu_x64v4::dsp_fir_f64};
+#else
+namespace cpu_generic {
+dsp_fir_type<float> dsp_fir_f32;
+dsp_fir_type<double> dsp_fir_f64;
+} // namespace cpu_generic
+
+hi_export inline cpu_dispatch<dsp_fir_type<float>> dsp_fir_f32{cpu_generic::dsp_fir_f32};
+hi_export inline cpu_dispatch<dsp_fir_type<double>> dsp_fir_f64{cpu_generic::dsp_fir_f64};
+#endif
+
+/** Filter samples with a finite impulse response.
+ *
+ * Calculates `r[n] = sum(taps[k] * x[n - k])`, where the samples before the
+ * start of @a a are taken from @a history. After the call @a history contains
+ * the last samples of @a a, ready for the next buffer.
+ *
+ * The output samples that only depend on @a a are calculated by the
+ * `dsp_fir_f32` or `dsp_fir_f64` kernel, which calculates a register of
+ * output samples at once by multiplying the taps with unaligned loads of the
+ * input.
+ *
+ * @param r The result, must not overlap with @a a.
+ * @param a The samples.
+ * @param taps The impulse response, `taps[0]` is applied to the newest sample.
+ * @param history The `taps.size() - 1` samples before @a a, oldest first.
+ */
+hi_export template<std::floating_point T>
+void dsp_fir(
+    std::span<T> r,
+    std::type_identity_t<std::span<T const>> a,
+    std::type_identity_t<std::span<T const>> taps,
+    std::type_identity_t<std::span<T>> history) noexcept
+{
+    hi_axiom(r.size() == a.size());
+    hi_axiom(not taps.empty());
+    hi_axiom(history.size() == taps.size() - 1);
+
+    hilet num_taps = taps.size();
+    hilet num_history = history.size();
+    hilet size = r.size();
+
+    auto *r_ = r.data();
+    auto const *a_ = a.data();
+    auto const *taps_ = taps.data();
+
+    // The first outputs need samples from the history.
+    hilet head_end = std::min(size, num_history);
+    for (auto n = 0_uz; n != head_end; ++n) {
+        auto sum = T{0};
+        for (auto k = 0_uz; k != num_taps; ++k) {
+            sum += taps_[k] * (k <= n ? a_[n - k] : history[num_history - (k - n)]);
+        }
+        r_[n] = sum;
+    }
+
+    // The rest of the outputs only need samples from the input; here `head_end == num_history`.
+    if (size > head_end) {
+        detail::dsp_kernel<T>(dsp_fir_f32, dsp_fir_f64)(r_ + head_end, a_, size - head_end, taps_, num_taps);
+    }
+
+    // Keep the last samples for the next call.
+    if (size >= num_history) {
+        std::copy(a.end() - num_history, a.end(), history.begin());
+    } else {
+        std::copy(history.begin() + size, history.end(), history.begin());
+        std::copy(a.begin(), a.end(), history.end() - size);
+    }
+}
+
+}} // namespace hi::v1
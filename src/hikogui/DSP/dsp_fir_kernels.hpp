@@ -0,0 +1,65 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file DSP/dsp_fir_kernels.hpp The FIR filter kernels, compiled once for each CPU level.
+ *
+ * Only include this file from `SIMD/cpu_dispatch_kernels.hpp`.
+ */
+
+#pragma once
+
+#include "dsp_fir.hpp"
+#include "dsp_float_kernels.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <cstddef>
+
+#ifndef HI_CPU_DISPATCH_NAMESPACE
+#error "dsp_fir_kernels.hpp must be included through cpu_dispatch_kernels.hpp"
+#endif
+
+hi_cpu_dispatch_target_push()
+
+namespace hi { inline namespace v1 { namespace HI_CPU_DISPATCH_NAMESPACE {
+
+template<typename T>
+void dsp_fir(T *r, T const *x, size_t size, T const *taps, size_t num_taps) noexcept
+{
+    using W = dsp_wide<T>;
+
+    // The newest sample of output `n` is at `x[n + last]`.
+    hilet last = num_taps - 1;
+
+    dsp_for_each<W>(
+        r,
+        size,
+        [&](size_t n) {
+            auto sum = W::broadcast(T{0});
+            for (auto k = 0_uz; k != num_taps; ++k) {
+                sum = W::add(sum, W::mul(W::broadcast(taps[k]), W::load(x + n + last - k)));
+            }
+            W::store(r + n, sum);
+        },
+        [&](size_t n) {
+            auto sum = T{0};
+            for (auto k = 0_uz; k != num_taps; ++k) {
+                sum += taps[k] * x[n + last - k];
+            }
+            r[n] = sum;
+        });
+}
+
+void dsp_fir_f32(float *r, float const *x, size_t size, float const *taps, size_t num_taps)
+{
+    return dsp_fir(r, x, size, taps, num_taps);
+}
+
+void dsp_fir_f64(double *r, double const *x, size_t size, double const *taps, size_t num_taps)
+{
+    return dsp_fir(r, x, size, taps, num_taps);
+}
+
+}}} // namespace hi::v1::HI_CPU_DISPATCH_NAMESPACE
+
+hi_cpu_dispatch_target_pop()
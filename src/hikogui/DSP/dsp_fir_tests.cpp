@@ -0,0 +1,101 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "dsp_fir.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+#include <array>
+
+using namespace hi;
+
+namespace {
+
+[[nodiscard]] std::vector<float> make_samples(size_t size)
+{
+    auto r = std::vector<float>(size);
+    for (auto i = 0_uz; i != size; ++i) {
+        r[i] = static_cast<float>(static_cast<int>(i * 7919 % 2001) - 1000) / 1000.0f;
+    }
+    return r;
+}
+
+[[nodiscard]] std::vector<float> make_taps(size_t size)
+{
+    auto r = std::vector<float>(size);
+    for (auto i = 0_uz; i != size; ++i) {
+        r[i] = static_cast<float>(static_cast<int>(i * 31 % 17) - 8) / 16.0f;
+    }
+    return r;
+}
+
+} // namespace
+
+TEST(dsp_fir, impulse_response)
+{
+    hilet taps = make_taps(5);
+    auto history = std::vector<float>(taps.size() - 1);
+
+    auto impulse = std::vector<float>(20);
+    impulse[0] = 1.0f;
+    auto result = std::vector<float>(impulse.size());
+    dsp_fir(std::span{result}, std::span<float const>{impulse}, std::span<float const>{taps}, std::span{history});
+
+    for (auto i = 0_uz; i != result.size(); ++i) {
+        ASSERT_EQ(result[i], i < taps.size() ? taps[i] : 0.0f);
+    }
+}
+
+TEST(dsp_fir, in_blocks)
+{
+    // Compare against a direct convolution, while filtering in blocks of different sizes.
+    for (hilet num_taps : std::array{1_uz, 2_uz, 7_uz, 16_uz, 33_uz}) {
+        for (hilet block_size : std::array{1_uz, 5_uz, 16_uz, 31_uz, 100_uz}) {
+            hilet samples = make_samples(500);
+            hilet taps = make_taps(num_taps);
+            auto history = std::vector<float>(num_taps - 1);
+
+            // Offset the result by one to make it unaligned.
+            auto result_buffer = std::vector<float>(samples.size() + 1);
+            hilet result = std::span{result_buffer}.subspan(1);
+            for (auto offset = 0_uz; offset < samples.size(); offset += block_size) {
+                hilet size = std::min(block_size, samples.size() - offset);
+                dsp_fir(
+                    result.subspan(offset, size),
+                    std::span<float const>{samples}.subspan(offset, size),
+                    std::span<float const>{taps},
+                    std::span{history});
+            }
+
+            for (auto n = 0_uz; n != samples.size(); ++n) {
+                auto expected = 0.0f;
+                for (auto k = 0_uz; k != num_taps and k <= n; ++k) {
+                    expected += taps[k] * samples[n - k];
+                }
+                ASSERT_NEAR(result[n], expected, 1e-5f) << "num_taps=" << num_taps << " block_size=" << block_size << " n=" << n;
+            }
+        }
+    }
+}
+
+TEST(dsp_fir, cpu_levels)
+{
+    // Each variant of the kernel gives the same result as the generic variant.
+    for (hilet num_taps : std::array{1_uz, 7_uz, 33_uz}) {
+        hilet samples = make_samples(200 + num_taps);
+        hilet taps = make_taps(num_taps);
+        hilet size = samples.size() - num_taps + 1;
+
+        auto expected = std::vector<float>(size);
+        dsp_fir_f32.get(0)(expected.data(), samples.data(), size, taps.data(), num_taps);
+
+        for (auto level = 1; level <= hi::cpu_dispatch_level(); ++level) {
+            auto result = std::vector<float>(size);
+            dsp_fir_f32.get(level)(result.data(), samples.data(), size, taps.data(), num_taps);
+            for (auto n = 0_uz; n != size; ++n) {
+                ASSERT_NEAR(result[n], expected[n], 1e-5f) << "level=" << level << " num_taps=" << num_taps << " n=" << n;
+            }
+        }
+    }
+}
@@ -1,123 +1,498 @@
-
-#include "../macros.hpp"
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file DSP/dsp_float.hpp Element-wise DSP functions on buffers of floating point samples.
+ * @ingroup DSP
+ *
+ * The functions in this file are allocation-free and may be called from a
+ * real-time audio thread. Except for `dsp_visit()` and the interleave
+ * functions they are kernels for `float` and `double` samples that are
+ * selected at run-time through `cpu_dispatch`, see `DSP/dsp_float_kernels.hpp`.
+ */
 
 #pragma once
 
-namespace hi {
-inline namespace v1 {
-
-template<typename Context>
-concept dsp_argument =
-    std::same_as<Context, float> or
-    std::same_as<Context. double> or
-    std::same_as<Context. std::span<float>> or
-    std::same_as<Context. std::span<double>> or
-    std::same_as<Context. std::span<float const>> or
-    std::same_as<Context. std::span<double const>>;
+#include "../SIMD/simd.hpp"
+#include "../SIMD/cpu_dispatch.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <concepts>
+#include <type_traits>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+
+hi_export_module(hikogui.DSP.dsp_float);
+
+namespace hi { inline namespace v1 {
+
+hi_export template<typename Context>
+concept dsp_argument = std::same_as<Context, float> or std::same_as<Context, double> or
+    std::same_as<Context, std::span<float>> or std::same_as<Context, std::span<double>> or
+    std::same_as<Context, std::span<float const>> or std::same_as<Context, std::span<double const>>;
+
+/** The operators of the dsp_binary kernels.
+ */
+hi_export enum class dsp_operator : uint8_t { add, sub, mul };
+
+/** The signature of the dsp_binary kernel: `r[i] = a[i] op b[i]`.
+ */
+template<typename T>
+using dsp_binary_type = void(T *r, T const *a, T const *b, size_t size, dsp_operator op);
+
+/** The signature of the dsp_binary_scalar kernel: `r[i] = a[i] op b`.
+ */
+template<typename T>
+using dsp_binary_scalar_type = void(T *r, T const *a, T b, size_t size, dsp_operator op);
+
+/** The signature of the dsp_gain_ramp kernel: `r[i] = a[i] * (start_gain + step * i)`.
+ */
+template<typename T>
+using dsp_gain_ramp_type = void(T *r, T const *a, size_t size, T start_gain, T step);
+
+/** The signature of the dsp_accumulate kernel: `r[i] += a[i] * gain`.
+ */
+template<typename T>
+using dsp_accumulate_type = void(T *r, T const *a, size_t size, T gain);
+
+/** The signature of the dsp_mix kernel: `r[i] = sum(inputs[k][i] * gains[k])`.
+ */
+template<typename T>
+using dsp_mix_type = void(T *r, T const *const *inputs, T const *gains, size_t num_inputs, size_t size);
+
+/** The signature of the dsp_peak kernel: `max(abs(a[i]))`.
+ */
+template<typename T>
+using dsp_peak_type = T(T const *a, size_t size);
+
+/** The signature of the dsp_sum_of_squares kernel: `sum(a[i] * a[i])`.
+ */
+template<typename T>
+using dsp_sum_of_squares_type = T(T const *a, size_t size);
+
+#define HI_X_declare(name) \
+    name##_type<float> name##_f32; \
+    name##_type<double> name##_f64;
+
+#define HI_X_declare_all \
+    HI_X_declare(dsp_binary) \
+    HI_X_declare(dsp_binary_scalar) \
+    HI_X_declare(dsp_gain_ramp) \
+    HI_X_declare(dsp_accumulate) \
+    HI_X_declare(dsp_mix) \
+    HI_X_declare(dsp_peak) \
+    HI_X_declare(dsp_sum_of_squares)
+
+#if HI_PROCESSOR == HI_CPU_X64
+namespace cpu_x64v1 {
+HI_X_declare_all
+} // namespace cpu_x64v1
+namespace cpu_x64v2 {
+HI_X_declare_all
+} // namespace cpu_x64v2
+namespace cpu_x64v3 {
+HI_X_declare_all
+} // namespace cpu_x64v3
+namespace cpu_x64v4 {
+HI_X_declare_all
+} // namespace cpu_x64v4
+
+#define HI_X_cpu_dispatch(name) \
+    hi_export inline cpu_dispatch<name##_type<float>> name##_f32 = { \
+        cpu_x64v1::name##_f32, cpu_x64v2::name##_f32, cpu_x64v3::name##_f32, cpu_x64v4::name##_f32}; \
+    hi_export inline cpu_dispatch<name##_type<double>> name##_f64 = { \
+        cpu_x64v1::name##_f64, cpu_x64v2::name##_f64, cpu_x64v3::name##_f64, cpu_x64v4::name##_f64};
+#else
+namespace cpu_generic {
+HI_X_declare_all
+} // namespace cpu_generic
+
+#define HI_X_cpu_dispatch(name) \
+    hi_export inline cpu_dispatch<name##_type<float>> name##_f32{cpu_generic::name##_f32}; \
+    hi_export inline cpu_dispatch<name##_type<double>> name##_f64{cpu_generic::name##_f64};
+#endif
+
+HI_X_cpu_dispatch(dsp_binary)
+HI_X_cpu_dispatch(dsp_binary_scalar)
+HI_X_cpu_dispatch(dsp_gain_ramp)
+HI_X_cpu_dispatch(dsp_accumulate)
+HI_X_cpu_dispatch(dsp_mix)
+HI_X_cpu_dispatch(dsp_peak)
+HI_X_cpu_dispatch(dsp_sum_of_squares)
+#undef HI_X_cpu_dispatch
+#undef HI_X_declare_all
+#undef HI_X_declare
+
+namespace detail {
+
+/** Select the kernel for the sample type.
+ *
+ * @param f32 The kernel for `float` samples.
+ * @param f64 The kernel for `double` samples.
+ */
+template<typename T>
+[[nodiscard]] constexpr auto& dsp_kernel(auto& f32, auto& f64) noexcept
+{
+    static_assert(std::same_as<T, float> or std::same_as<T, double>, "The DSP kernels only handle float and double samples.");
+    if constexpr (std::same_as<T, float>) {
+        return f32;
+    } else {
+        return f64;
+    }
+}
 
-template<typename T, typename Op>
-void dsp_visit(std::span<T> r, std::span<T const> a, std::span<T const> b, Op op) noexcept
+/** The number of elements to process one at a time before @a ptr is aligned to @a S.
+ */
+template<typename S>
+[[nodiscard]] hi_force_inline size_t dsp_head_size(typename S::value_type const *ptr, size_t size) noexcept
 {
-    hi_axiom(r.size() == a.size());
-    hi_axiom(r.size() == b.size());
+    constexpr auto alignment = sizeof(S);
 
-    using S = fast_simd<T>;
+    hilet misalignment = reinterpret_cast<uintptr_t>(ptr) % alignment;
+    if (misalignment == 0 or misalignment % sizeof(typename S::value_type) != 0) {
+        return 0;
+    }
+    return std::min(size, (alignment - misalignment) / sizeof(typename S::value_type));
+}
+
+/** Call `wide_op(i)` for each simd sized block and `op(i)` for the other elements.
+ *
+ * @param ptr The pointer to the output; the blocks start where it is aligned.
+ * @param size The number of elements.
+ */
+template<typename S, typename WideOp, typename Op>
+hi_force_inline void dsp_for_each(typename S::value_type const *ptr, size_t size, WideOp const& wide_op, Op const& op) noexcept
+{
     constexpr auto stride = S::size;
 
-    auto size = r.size();
-    auto wide_size = (size / stride) * stride;
+    hilet head_end = dsp_head_size<S>(ptr, size);
+    hilet wide_end = head_end + ((size - head_end) / stride) * stride;
 
-    auto r_ = r.data();
-    auto a_ = a.data();
-    auto b_ = b.data();
+    auto i = 0_uz;
+    for (; i != head_end; ++i) {
+        op(i);
+    }
+    for (; i != wide_end; i += stride) {
+        wide_op(i);
+    }
+    for (; i != size; ++i) {
+        op(i);
+    }
+}
 
-    hilet a_wide_end = a.data() + wide_size;
-    while (a_ != a_wide_end) {
-        op(S{a_}, S{b_}).store(r_);
+template<typename S>
+[[nodiscard]] hi_force_inline S dsp_load(typename S::value_type const *ptr) noexcept
+{
+    return S::load(ptr);
+}
 
-        a_ += stride;
-        b_ += stride;
-        r_ += stride;
-    }
+template<typename S>
+hi_force_inline void dsp_store(S const& value, typename S::value_type *ptr) noexcept
+{
+    value.store(reinterpret_cast<std::byte *>(ptr));
+}
 
-    hilet a_end = a_ptr + size;
-    while (a_ != size) {
-        *r_++ = op(*a_++, *b_++);
-    }
+template<std::floating_point T>
+void dsp_binary(
+    std::span<T> r,
+    std::type_identity_t<std::span<T const>> a,
+    std::type_identity_t<std::span<T const>> b,
+    dsp_operator op) noexcept
+{
+    hi_axiom(r.size() == a.size());
+    hi_axiom(r.size() == b.size());
+    dsp_kernel<T>(dsp_binary_f32, dsp_binary_f64)(r.data(), a.data(), b.data(), r.size(), op);
 }
 
-template<typename T, typename Op>
-void dsp_visit(std::span<T> r, std::span<T const> a, T b, Op op) noexcept
+template<std::floating_point T>
+void dsp_binary(std::span<T> r, std::type_identity_t<std::span<T const>> a, std::type_identity_t<T> b, dsp_operator op) noexcept
 {
     hi_axiom(r.size() == a.size());
+    dsp_kernel<T>(dsp_binary_scalar_f32, dsp_binary_scalar_f64)(r.data(), a.data(), b, r.size(), op);
+}
 
+template<std::floating_point T>
+void dsp_binary(std::span<T> r, std::type_identity_t<T> a, dsp_operator op) noexcept
+{
+    dsp_kernel<T>(dsp_binary_scalar_f32, dsp_binary_scalar_f64)(r.data(), r.data(), a, r.size(), op);
+}
+
+} // namespace detail
+
+/** Calculate `r[i] = op(a[i], b[i])`.
+ *
+ * Unlike the other functions in this file @a op is compiled with the options
+ * of the library, so it does not use the instructions of newer CPUs. Use
+ * `dsp_add()`, `dsp_sub()` or `dsp_mul()` for the common operators.
+ *
+ * @param r The result, may be the same buffer as @a a or @a b.
+ * @param a The first operand.
+ * @param b The second operand.
+ * @param op The operation, called both with `fast_simd<T>` and `T` arguments.
+ */
+hi_export template<std::floating_point T, typename Op>
+void dsp_visit(std::span<T> r, std::type_identity_t<std::span<T const>> a, std::type_identity_t<std::span<T const>> b, Op op) noexcept
+{
     using S = fast_simd<T>;
-    constexpr auto stride = S::size;
 
-    auto size = r.size();
-    auto wide_size = (size / stride) * stride;
+    hi_axiom(r.size() == a.size());
+    hi_axiom(r.size() == b.size());
 
-    auto r_ = r.data();
-    auto a_ = a.data();
+    auto *r_ = r.data();
+    auto const *a_ = a.data();
+    auto const *b_ = b.data();
+
+    detail::dsp_for_each<S>(
+        r_,
+        r.size(),
+        [&](size_t i) {
+            detail::dsp_store(op(detail::dsp_load<S>(a_ + i), detail::dsp_load<S>(b_ + i)), r_ + i);
+        },
+        [&](size_t i) {
+            r_[i] = op(a_[i], b_[i]);
+        });
+}
 
-    hilet b_wide = S::broadcast(b);
-    hilet a_wide_end = a.data() + wide_size;
-    while (a_ != a_wide_end) {
-        op(S{a_}, b_wide).store(r_);
+/** Calculate `r[i] = op(a[i], b)`.
+ *
+ * @param r The result, may be the same buffer as @a a.
+ * @param a The first operand.
+ * @param b The second operand.
+ * @param op The operation, called both with `fast_simd<T>` and `T` arguments.
+ */
+hi_export template<std::floating_point T, typename Op>
+void dsp_visit(std::span<T> r, std::type_identity_t<std::span<T const>> a, std::type_identity_t<T> b, Op op) noexcept
+{
+    using S = fast_simd<T>;
 
-        a_ += stride;
-        r_ += stride;
-    }
+    hi_axiom(r.size() == a.size());
 
-    hilet a_end = a_ptr + size;
-    while (a_ != size) {
-        *r_++ = op(*a_++, b);
-    }
+    auto *r_ = r.data();
+    auto const *a_ = a.data();
+    hilet b_wide = S::broadcast(b);
+
+    detail::dsp_for_each<S>(
+        r_,
+        r.size(),
+        [&](size_t i) {
+            detail::dsp_store(op(detail::dsp_load<S>(a_ + i), b_wide), r_ + i);
+        },
+        [&](size_t i) {
+            r_[i] = op(a_[i], b);
+        });
 }
 
-template<typename T, typename Op>
-void dsp_visit(std::span<float> r, float a, Op op) noexcept
+/** Calculate `r[i] = op(r[i], a)`.
+ *
+ * @param r The first operand and the result.
+ * @param a The second operand.
+ * @param op The operation, called both with `fast_simd<T>` and `T` arguments.
+ */
+hi_export template<std::floating_point T, typename Op>
+void dsp_visit(std::span<T> r, std::type_identity_t<T> a, Op op) noexcept
 {
-    using S = fast_simd<float>;
-    constexpr auto stride = S::size;
+    using S = fast_simd<T>;
 
-    hilet size = r.size();
-    hilet wide_size = (size / stride) * stride;
+    auto *r_ = r.data();
+    hilet a_wide = S::broadcast(a);
+
+    detail::dsp_for_each<S>(
+        r_,
+        r.size(),
+        [&](size_t i) {
+            detail::dsp_store(op(detail::dsp_load<S>(r_ + i), a_wide), r_ + i);
+        },
+        [&](size_t i) {
+            r_[i] = op(r_[i], a);
+        });
+}
 
-    auto r_ = a.data();
-    hilet a_ = S::broadcast(b);
+hi_export void dsp_add(dsp_argument auto... args) noexcept
+{
+    return detail::dsp_binary(args..., dsp_operator::add);
+}
 
-    hilet r_wide_end = r.data() + wide_size;
-    while (r_ != r_wide_end) {
-        op(S{r_} + a_wide).store(r_);
+hi_export void dsp_sub(dsp_argument auto... args) noexcept
+{
+    return detail::dsp_binary(args..., dsp_operator::sub);
+}
 
-        a_ += stride;
-    }
+hi_export void dsp_mul(dsp_argument auto... args) noexcept
+{
+    return detail::dsp_binary(args..., dsp_operator::mul);
+}
 
-    hilet r_end = r_ + size;
-    while (r_ != size) {
-        *r_++ += a;
+/** Multiply samples with a gain that changes linearly over the buffer.
+ *
+ * The gain of sample `i` is `start_gain + (end_gain - start_gain) * i / r.size()`,
+ * so that the ramp of the next buffer can start at @a end_gain without a discontinuity.
+ *
+ * @param r The result, may be the same buffer as @a a.
+ * @param a The samples.
+ * @param start_gain The gain of the first sample.
+ * @param end_gain The gain of the sample after the last sample.
+ */
+hi_export template<std::floating_point T>
+void dsp_gain_ramp(
+    std::span<T> r,
+    std::type_identity_t<std::span<T const>> a,
+    std::type_identity_t<T> start_gain,
+    std::type_identity_t<T> end_gain) noexcept
+{
+    hi_axiom(r.size() == a.size());
+    if (r.empty()) {
+        return;
     }
+
+    hilet step = (end_gain - start_gain) / static_cast<T>(r.size());
+    detail::dsp_kernel<T>(dsp_gain_ramp_f32, dsp_gain_ramp_f64)(r.data(), a.data(), r.size(), start_gain, step);
 }
 
-void dsp_add(dsp_argument auto... args) noexcept
+/** Add samples multiplied by a gain to the result.
+ *
+ * @param r The samples to add to.
+ * @param a The samples to add.
+ * @param gain The gain of the added samples.
+ */
+hi_export template<std::floating_point T>
+void dsp_accumulate(std::span<T> r, std::type_identity_t<std::span<T const>> a, std::type_identity_t<T> gain) noexcept
 {
-    return dsp_operator(args..., [](auto a, auto b) { return a + b; });
+    hi_axiom(r.size() == a.size());
+    detail::dsp_kernel<T>(dsp_accumulate_f32, dsp_accumulate_f64)(r.data(), a.data(), r.size(), gain);
 }
 
-void dsp_sub(dsp-argument auto... args) noexcept
+/** Mix multiple buffers.
+ *
+ * Calculates `r[i] = sum(inputs[k][i] * gains[k])` in a single pass over the result.
+ *
+ * @param r The result, must not be one of the inputs.
+ * @param inputs Pointers to the input buffers, each of `r.size()` samples.
+ * @param gains The gain for each input.
+ */
+hi_export template<std::floating_point T>
+void dsp_mix(
+    std::span<T> r,
+    std::type_identity_t<std::span<T const *const>> inputs,
+    std::type_identity_t<std::span<T const>> gains) noexcept
 {
-    return dsp_operator(args..., [](auto a, auto b) { return a - b; });
+    hi_axiom(inputs.size() == gains.size());
+    detail::dsp_kernel<T>(dsp_mix_f32, dsp_mix_f64)(r.data(), inputs.data(), gains.data(), inputs.size(), r.size());
 }
 
-void dsp_mul(dsp-argument auto... args) noexcept
+/** The largest absolute sample value.
+ *
+ * @param a The samples.
+ * @return The peak value, or zero when there are no samples.
+ */
+hi_export template<typename T>
+[[nodiscard]] std::remove_const_t<T> dsp_peak(std::span<T> a) noexcept
+    requires std::floating_point<std::remove_const_t<T>>
 {
-    return dsp_operator(args..., [](auto a, auto b) { return a * b; });
+    using value_type = std::remove_const_t<T>;
+
+    return detail::dsp_kernel<value_type>(dsp_peak_f32, dsp_peak_f64)(a.data(), a.size());
 }
 
+/** The sum of the squares of the samples.
+ *
+ * Use this to calculate a running RMS over multiple buffers.
+ *
+ * @param a The samples.
+ * @return The sum of squares.
+ */
+hi_export template<typename T>
+[[nodiscard]] std::remove_const_t<T> dsp_sum_of_squares(std::span<T> a) noexcept
+    requires std::floating_point<std::remove_const_t<T>>
+{
+    using value_type = std::remove_const_t<T>;
+
+    return detail::dsp_kernel<value_type>(dsp_sum_of_squares_f32, dsp_sum_of_squares_f64)(a.data(), a.size());
+}
+
+/** The root-mean-square of the samples.
+ *
+ * @param a The samples.
+ * @return The RMS value, or zero when there are no samples.
+ */
+hi_export template<typename T>
+[[nodiscard]] std::remove_const_t<T> dsp_rms(std::span<T> a) noexcept
+    requires std::floating_point<std::remove_const_t<T>>
+{
+    using value_type = std::remove_const_t<T>;
+
+    if (a.empty()) {
+        return value_type{0};
+    }
+    return std::sqrt(dsp_sum_of_squares(a) / static_cast<value_type>(a.size()));
+}
 
+/** Interleave the samples of multiple channels.
+ *
+ * @param r The interleaved samples, `channels.size()` samples for each frame.
+ * @param channels Pointers to the samples of each channel, each of `r.size() / channels.size()` samples.
+ */
+hi_export template<std::floating_point T>
+void dsp_interleave(std::span<T> r, std::type_identity_t<std::span<T const *const>> channels) noexcept
+{
+    hilet num_channels = channels.size();
+    hi_axiom(num_channels != 0);
+    hi_axiom(r.size() % num_channels == 0);
+
+    hilet num_frames = r.size() / num_channels;
+    auto *hi_restrict r_ = r.data();
+
+    if (num_channels == 2) {
+        // Stereo is common enough to handle both channels in the same loop, which the compiler vectorizes.
+        auto const *hi_restrict left = channels[0];
+        auto const *hi_restrict right = channels[1];
+        for (auto i = 0_uz; i != num_frames; ++i) {
+            r_[i * 2] = left[i];
+            r_[i * 2 + 1] = right[i];
+        }
+        return;
+    }
 
+    for (auto c = 0_uz; c != num_channels; ++c) {
+        auto const *hi_restrict channel = channels[c];
+        for (auto i = 0_uz; i != num_frames; ++i) {
+            r_[i * num_channels + c] = channel[i];
+        }
+    }
+}
 
+/** Deinterleave samples into multiple channels.
+ *
+ * @param channels Pointers to the samples of each channel, each of `a.size() / channels.size()` samples.
+ * @param a The interleaved samples, `channels.size()` samples for each frame.
+ */
+hi_export template<std::floating_point T>
+void dsp_deinterleave(std::span<T *const> channels, std::type_identity_t<std::span<T const>> a) noexcept
+{
+    hilet num_channels = channels.size();
+    hi_axiom(num_channels != 0);
+    hi_axiom(a.size() % num_channels == 0);
+
+    hilet num_frames = a.size() / num_channels;
+    auto const *hi_restrict a_ = a.data();
+
+    if (num_channels == 2) {
+        auto *hi_restrict left = channels[0];
+        auto *hi_restrict right = channels[1];
+        for (auto i = 0_uz; i != num_frames; ++i) {
+            left[i] = a_[i * 2];
+            right[i] = a_[i * 2 + 1];
+        }
+        return;
+    }
 
-}}
+    for (auto c = 0_uz; c != num_channels; ++c) {
+        auto *hi_restrict channel = channels[c];
+        for (auto i = 0_uz; i != num_frames; ++i) {
+            channel[i] = a_[i * num_channels + c];
+        }
+    }
+}
 
+}} // namespace hi::v1
@@ -0,0 +1,530 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file DSP/dsp_float_kernels.hpp The element-wise DSP kernels, compiled once for each CPU level.
+ *
+ * Only include this file from `SIMD/cpu_dispatch_kernels.hpp`.
+ *
+ * The kernels process the samples in the widest registers of the level: SSE2
+ * on x86-64-v1 and v2, AVX on x86-64-v3 and AVX-512 on x86-64-v4. The blocks
+ * start where the output is aligned to the size of the register; the samples
+ * before and after the blocks are processed one at a time.
+ *
+ * `dsp_wide` and `dsp_for_each` are also used by the kernels of the FIR filter
+ * and the resampler.
+ */
+
+#pragma once
+
+#include "dsp_float.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <array>
+#include <concepts>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <cstddef>
+#if HI_CPU_DISPATCH_LEVEL >= 1
+#include <immintrin.h>
+#endif
+
+#ifndef HI_CPU_DISPATCH_NAMESPACE
+#error "dsp_float_kernels.hpp must be included through cpu_dispatch_kernels.hpp"
+#endif
+
+hi_cpu_dispatch_target_push()
+
+namespace hi { inline namespace v1 { namespace HI_CPU_DISPATCH_NAMESPACE {
+
+/** The widest register of samples of this CPU level.
+ *
+ * @tparam T The sample type, float or double.
+ */
+template<typename T>
+struct dsp_wide;
+
+#if HI_CPU_DISPATCH_LEVEL >= 4
+template<>
+struct dsp_wide<float> {
+    using value_type = float;
+    using type = __m512;
+    constexpr static size_t size = 16;
+
+    [[nodiscard]] static type load(float const *p) noexcept { return _mm512_loadu_ps(p); }
+    static void store(float *p, type x) noexcept { _mm512_storeu_ps(p, x); }
+    [[nodiscard]] static type broadcast(float x) noexcept { return _mm512_set1_ps(x); }
+    [[nodiscard]] static type add(type a, type b) noexcept { return _mm512_add_ps(a, b); }
+    [[nodiscard]] static type sub(type a, type b) noexcept { return _mm512_sub_ps(a, b); }
+    [[nodiscard]] static type mul(type a, type b) noexcept { return _mm512_mul_ps(a, b); }
+    [[nodiscard]] static type max(type a, type b) noexcept { return _mm512_max_ps(a, b); }
+    [[nodiscard]] static type abs(type x) noexcept { return _mm512_abs_ps(x); }
+    [[nodiscard]] static float sum(type x) noexcept { return _mm512_reduce_add_ps(x); }
+    [[nodiscard]] static float reduce_max(type x) noexcept { return _mm512_reduce_max_ps(x); }
+};
+
+template<>
+struct dsp_wide<double> {
+    using value_type = double;
+    using type = __m512d;
+    constexpr static size_t size = 8;
+
+    [[nodiscard]] static type load(double const *p) noexcept { return _mm512_loadu_pd(p); }
+    static void store(double *p, type x) noexcept { _mm512_storeu_pd(p, x); }
+    [[nodiscard]] static type broadcast(double x) noexcept { return _mm512_set1_pd(x); }
+    [[nodiscard]] static type add(type a, type b) noexcept { return _mm512_add_pd(a, b); }
+    [[nodiscard]] static type sub(type a, type b) noexcept { return _mm512_sub_pd(a, b); }
+    [[nodiscard]] static type mul(type a, type b) noexcept { return _mm512_mul_pd(a, b); }
+    [[nodiscard]] static type max(type a, type b) noexcept { return _mm512_max_pd(a, b); }
+    [[nodiscard]] static type abs(type x) noexcept { return _mm512_abs_pd(x); }
+    [[nodiscard]] static double sum(type x) noexcept { return _mm512_reduce_add_pd(x); }
+    [[nodiscard]] static double reduce_max(type x) noexcept { return _mm512_reduce_max_pd(x); }
+};
+
+#elif HI_CPU_DISPATCH_LEVEL >= 3
+template<>
+struct dsp_wide<float> {
+    using value_type = float;
+    using type = __m256;
+    constexpr static size_t size = 8;
+
+    [[nodiscard]] static type load(float const *p) noexcept { return _mm256_loadu_ps(p); }
+    static void store(float *p, type x) noexcept { _mm256_storeu_ps(p, x); }
+    [[nodiscard]] static type broadcast(float x) noexcept { return _mm256_set1_ps(x); }
+    [[nodiscard]] static type add(type a, type b) noexcept { return _mm256_add_ps(a, b); }
+    [[nodiscard]] static type sub(type a, type b) noexcept { return _mm256_sub_ps(a, b); }
+    [[nodiscard]] static type mul(type a, type b) noexcept { return _mm256_mul_ps(a, b); }
+    [[nodiscard]] static type max(type a, type b) noexcept { return _mm256_max_ps(a, b); }
+    [[nodiscard]] static type abs(type x) noexcept { return _mm256_andnot_ps(_mm256_set1_ps(-0.0f), x); }
+
+    [[nodiscard]] static float sum(type x) noexcept
+    {
+        auto r = _mm_add_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1));
+        r = _mm_add_ps(r, _mm_movehl_ps(r, r));
+        r = _mm_add_ss(r, _mm_shuffle_ps(r, r, 0b01));
+        return _mm_cvtss_f32(r);
+    }
+
+    [[nodiscard]] static float reduce_max(type x) noexcept
+    {
+        auto r = _mm_max_ps(_mm256_castps256_ps128(x), _mm256_extractf128_ps(x, 1));
+        r = _mm_max_ps(r, _mm_movehl_ps(r, r));
+        r = _mm_max_ss(r, _mm_shuffle_ps(r, r, 0b01));
+        return _mm_cvtss_f32(r);
+    }
+};
+
+template<>
+struct dsp_wide<double> {
+    using value_type = double;
+    using type = __m256d;
+    constexpr static size_t size = 4;
+
+    [[nodiscard]] static type load(double const *p) noexcept { return _mm256_loadu_pd(p); }
+    static void store(double *p, type x) noexcept { _mm256_storeu_pd(p, x); }
+    [[nodiscard]] static type broadcast(double x) noexcept { return _mm256_set1_pd(x); }
+    [[nodiscard]] static type add(type a, type b) noexcept { return _mm256_add_pd(a, b); }
+    [[nodiscard]] static type sub(type a, type b) noexcept { return _mm256_sub_pd(a, b); }
+    [[nodiscard]] static type mul(type a, type b) noexcept { return _mm256_mul_pd(a, b); }
+    [[nodiscard]] static type max(type a, type b) noexcept { return _mm256_max_pd(a, b); }
+    [[nodiscard]] static type abs(type x) noexcept { return _mm256_andnot_pd(_mm256_set1_pd(-0.0), x); }
+
+    [[nodiscard]] static double sum(type x) noexcept
+    {
+        auto r = _mm_add_pd(_mm256_castpd256_pd128(x), _mm256_extractf128_pd(x, 1));
+        r = _mm_add_sd(r, _mm_unpackhi_pd(r, r));
+        return _mm_cvtsd_f64(r);
+    }
+
+    [[nodiscard]] static double reduce_max(type x) noexcept
+    {
+        auto r = _mm_max_pd(_mm256_castpd256_pd128(x), _mm256_extractf128_pd(x, 1));
+        r = _mm_max_sd(r, _mm_unpackhi_pd(r, r));
+        return _mm_cvtsd_f64(r);
+    }
+};
+
+#elif HI_CPU_DISPATCH_LEVEL >= 1
+template<>
+struct dsp_wide<float> {
+    using value_type = float;
+    using type = __m128;
+    constexpr static size_t size = 4;
+
+    [[nodiscard]] static type load(float const *p) noexcept { return _mm_loadu_ps(p); }
+    static void store(float *p, type x) noexcept { _mm_storeu_ps(p, x); }
+    [[nodiscard]] static type broadcast(float x) noexcept { return _mm_set1_ps(x); }
+    [[nodiscard]] static type add(type a, type b) noexcept { return _mm_add_ps(a, b); }
+    [[nodiscard]] static type sub(type a, type b) noexcept { return _mm_sub_ps(a, b); }
+    [[nodiscard]] static type mul(type a, type b) noexcept { return _mm_mul_ps(a, b); }
+    [[nodiscard]] static type max(type a, type b) noexcept { return _mm_max_ps(a, b); }
+    [[nodiscard]] static type abs(type x) noexcept { return _mm_andnot_ps(_mm_set1_ps(-0.0f), x); }
+
+    [[nodiscard]] static float sum(type x) noexcept
+    {
+        auto r = _mm_add_ps(x, _mm_movehl_ps(x, x));
+        r = _mm_add_ss(r, _mm_shuffle_ps(r, r, 0b01));
+        return _mm_cvtss_f32(r);
+    }
+
+    [[nodiscard]] static float reduce_max(type x) noexcept
+    {
+        auto r = _mm_max_ps(x, _mm_movehl_ps(x, x));
+        r = _mm_max_ss(r, _mm_shuffle_ps(r, r, 0b01));
+        return _mm_cvtss_f32(r);
+    }
+};
+
+template<>
+struct dsp_wide<double> {
+    using value_type = double;
+    using type = __m128d;
+    constexpr static size_t size = 2;
+
+    [[nodiscard]] static type load(double const *p) noexcept { return _mm_loadu_pd(p); }
+    static void store(double *p, type x) noexcept { _mm_storeu_pd(p, x); }
+    [[nodiscard]] static type broadcast(double x) noexcept { return _mm_set1_pd(x); }
+    [[nodiscard]] static type add(type a, type b) noexcept { return _mm_add_pd(a, b); }
+    [[nodiscard]] static type sub(type a, type b) noexcept { return _mm_sub_pd(a, b); }
+    [[nodiscard]] static type mul(type a, type b) noexcept { return _mm_mul_pd(a, b); }
+    [[nodiscard]] static type max(type a, type b) noexcept { return _mm_max_pd(a, b); }
+    [[nodiscard]] static type abs(type x) noexcept { return _mm_andnot_pd(_mm_set1_pd(-0.0), x); }
+
+    [[nodiscard]] static double sum(type x) noexcept
+    {
+        return _mm_cvtsd_f64(_mm_add_sd(x, _mm_unpackhi_pd(x, x)));
+    }
+
+    [[nodiscard]] static double reduce_max(type x) noexcept
+    {
+        return _mm_cvtsd_f64(_mm_max_sd(x, _mm_unpackhi_pd(x, x)));
+    }
+};
+
+#else
+template<typename T>
+struct dsp_wide {
+    using value_type = T;
+    using type = T;
+    constexpr static size_t size = 1;
+
+    [[nodiscard]] static type load(T const *p) noexcept { return *p; }
+    static void store(T *p, type x) noexcept { *p = x; }
+    [[nodiscard]] static type broadcast(T x) noexcept { return x; }
+    [[nodiscard]] static type add(type a, type b) noexcept { return a + b; }
+    [[nodiscard]] static type sub(type a, type b) noexcept { return a - b; }
+    [[nodiscard]] static type mul(type a, type b) noexcept { return a * b; }
+    [[nodiscard]] static type max(type a, type b) noexcept { return std::max(a, b); }
+    [[nodiscard]] static type abs(type x) noexcept { return std::abs(x); }
+    [[nodiscard]] static T sum(type x) noexcept { return x; }
+    [[nodiscard]] static T reduce_max(type x) noexcept { return x; }
+};
+#endif
+
+/** A register with the elements set to 0, 1, 2, ...
+ */
+template<typename W>
+[[nodiscard]] hi_force_inline typename W::type dsp_wide_iota() noexcept
+{
+    using value_type = typename W::value_type;
+
+    auto tmp = std::array<value_type, W::size>{};
+    for (auto i = 0_uz; i != W::size; ++i) {
+        tmp[i] = static_cast<value_type>(i);
+    }
+    return W::load(tmp.data());
+}
+
+/** Apply an operator to two registers, or to two samples.
+ */
+template<dsp_operator Op, typename W, typename T>
+[[nodiscard]] hi_force_inline T dsp_apply(T a, T b) noexcept
+{
+    if constexpr (std::floating_point<T>) {
+        if constexpr (Op == dsp_operator::add) {
+            return a + b;
+        } else if constexpr (Op == dsp_operator::sub) {
+            return a - b;
+        } else {
+            return a * b;
+        }
+    } else {
+        if constexpr (Op == dsp_operator::add) {
+            return W::add(a, b);
+        } else if constexpr (Op == dsp_operator::sub) {
+            return W::sub(a, b);
+        } else {
+            return W::mul(a, b);
+        }
+    }
+}
+
+/** Call `wide_op(i)` for each register sized block and `op(i)` for the other samples.
+ *
+ * @param ptr The pointer to the output; the blocks start where it is aligned.
+ * @param size The number of samples.
+ */
+template<typename W, typename WideOp, typename Op>
+hi_force_inline void dsp_for_each(typename W::value_type const *ptr, size_t size, WideOp const& wide_op, Op const& op) noexcept
+{
+    using value_type = typename W::value_type;
+    constexpr auto alignment = sizeof(typename W::type);
+
+    auto head_end = 0_uz;
+    if (hilet misalignment = reinterpret_cast<uintptr_t>(ptr) % alignment; misalignment % sizeof(value_type) == 0) {
+        head_end = std::min(size, ((alignment - misalignment) % alignment) / sizeof(value_type));
+    }
+    hilet wide_end = head_end + ((size - head_end) / W::size) * W::size;
+
+    auto i = 0_uz;
+    for (; i != head_end; ++i) {
+        op(i);
+    }
+    for (; i != wide_end; i += W::size) {
+        wide_op(i);
+    }
+    for (; i != size; ++i) {
+        op(i);
+    }
+}
+
+template<dsp_operator Op, typename T>
+void dsp_binary(T *r, T const *a, T const *b, size_t size) noexcept
+{
+    using W = dsp_wide<T>;
+
+    dsp_for_each<W>(
+        r,
+        size,
+        [&](size_t i) {
+            W::store(r + i, dsp_apply<Op, W>(W::load(a + i), W::load(b + i)));
+        },
+        [&](size_t i) {
+            r[i] = dsp_apply<Op, W>(a[i], b[i]);
+        });
+}
+
+template<dsp_operator Op, typename T>
+void dsp_binary_scalar(T *r, T const *a, T b, size_t size) noexcept
+{
+    using W = dsp_wide<T>;
+
+    hilet b_wide = W::broadcast(b);
+    dsp_for_each<W>(
+        r,
+        size,
+        [&](size_t i) {
+            W::store(r + i, dsp_apply<Op, W>(W::load(a + i), b_wide));
+        },
+        [&](size_t i) {
+            r[i] = dsp_apply<Op, W>(a[i], b);
+        });
+}
+
+template<typename T>
+void dsp_binary(T *r, T const *a, T const *b, size_t size, dsp_operator op) noexcept
+{
+    switch (op) {
+    case dsp_operator::add:
+        return dsp_binary<dsp_operator::add>(r, a, b, size);
+    case dsp_operator::sub:
+        return dsp_binary<dsp_operator::sub>(r, a, b, size);
+    case dsp_operator::mul:
+        return dsp_binary<dsp_operator::mul>(r, a, b, size);
+    }
+    hi_no_default();
+}
+
+template<typename T>
+void dsp_binary_scalar(T *r, T const *a, T b, size_t size, dsp_operator op) noexcept
+{
+    switch (op) {
+    case dsp_operator::add:
+        return dsp_binary_scalar<dsp_operator::add>(r, a, b, size);
+    case dsp_operator::sub:
+        return dsp_binary_scalar<dsp_operator::sub>(r, a, b, size);
+    case dsp_operator::mul:
+        return dsp_binary_scalar<dsp_operator::mul>(r, a, b, size);
+    }
+    hi_no_default();
+}
+
+template<typename T>
+void dsp_gain_ramp(T *r, T const *a, size_t size, T start_gain, T step) noexcept
+{
+    using W = dsp_wide<T>;
+
+    hilet start_wide = W::broadcast(start_gain);
+    hilet step_wide = W::broadcast(step);
+    hilet iota = dsp_wide_iota<W>();
+
+    // The gain is calculated from the index, instead of accumulated, so that rounding errors do not add up.
+    dsp_for_each<W>(
+        r,
+        size,
+        [&](size_t i) {
+            hilet index = W::add(W::broadcast(static_cast<T>(i)), iota);
+            hilet gain = W::add(start_wide, W::mul(step_wide, index));
+            W::store(r + i, W::mul(W::load(a + i), gain));
+        },
+        [&](size_t i) {
+            r[i] = a[i] * (start_gain + step * static_cast<T>(i));
+        });
+}
+
+template<typename T>
+void dsp_accumulate(T *r, T const *a, size_t size, T gain) noexcept
+{
+    using W = dsp_wide<T>;
+
+    hilet gain_wide = W::broadcast(gain);
+    dsp_for_each<W>(
+        r,
+        size,
+        [&](size_t i) {
+            W::store(r + i, W::add(W::load(r + i), W::mul(W::load(a + i), gain_wide)));
+        },
+        [&](size_t i) {
+            r[i] += a[i] * gain;
+        });
+}
+
+template<typename T>
+void dsp_mix(T *r, T const *const *inputs, T const *gains, size_t num_inputs, size_t size) noexcept
+{
+    using W = dsp_wide<T>;
+
+    dsp_for_each<W>(
+        r,
+        size,
+        [&](size_t i) {
+            auto sum = W::broadcast(T{0});
+            for (auto k = 0_uz; k != num_inputs; ++k) {
+                sum = W::add(sum, W::mul(W::load(inputs[k] + i), W::broadcast(gains[k])));
+            }
+            W::store(r + i, sum);
+        },
+        [&](size_t i) {
+            auto sum = T{0};
+            for (auto k = 0_uz; k != num_inputs; ++k) {
+                sum += inputs[k][i] * gains[k];
+            }
+            r[i] = sum;
+        });
+}
+
+template<typename T>
+[[nodiscard]] T dsp_peak(T const *a, size_t size) noexcept
+{
+    using W = dsp_wide<T>;
+
+    auto peak = T{0};
+    auto peak_wide = W::broadcast(T{0});
+    dsp_for_each<W>(
+        a,
+        size,
+        [&](size_t i) {
+            peak_wide = W::max(peak_wide, W::abs(W::load(a + i)));
+        },
+        [&](size_t i) {
+            peak = std::max(peak, std::abs(a[i]));
+        });
+
+    return std::max(peak, W::reduce_max(peak_wide));
+}
+
+template<typename T>
+[[nodiscard]] T dsp_sum_of_squares(T const *a, size_t size) noexcept
+{
+    using W = dsp_wide<T>;
+
+    auto sum = T{0};
+    auto sum_wide = W::broadcast(T{0});
+    dsp_for_each<W>(
+        a,
+        size,
+        [&](size_t i) {
+            hilet tmp = W::load(a + i);
+            sum_wide = W::add(sum_wide, W::mul(tmp, tmp));
+        },
+        [&](size_t i) {
+            sum += a[i] * a[i];
+        });
+
+    return sum + W::sum(sum_wide);
+}
+
+void dsp_binary_f32(float *r, float const *a, float const *b, size_t size, dsp_operator op)
+{
+    return dsp_binary(r, a, b, size, op);
+}
+
+void dsp_binary_scalar_f32(float *r, float const *a, float b, size_t size, dsp_operator op)
+{
+    return dsp_binary_scalar(r, a, b, size, op);
+}
+
+void dsp_gain_ramp_f32(float *r, float const *a, size_t size, float start_gain, float step)
+{
+    return dsp_gain_ramp(r, a, size, start_gain, step);
+}
+
+void dsp_accumulate_f32(float *r, float const *a, size_t size, float gain)
+{
+    return dsp_accumulate(r, a, size, gain);
+}
+
+void dsp_mix_f32(float *r, float const *const *inputs, float const *gains, size_t num_inputs, size_t size)
+{
+    return dsp_mix(r, inputs, gains, num_inputs, size);
+}
+
+float dsp_peak_f32(float const *a, size_t size)
+{
+    return dsp_peak(a, size);
+}
+
+float dsp_sum_of_squares_f32(float const *a, size_t size)
+{
+    return dsp_sum_of_squares(a, size);
+}
+
+void dsp_binary_f64(double *r, double const *a, double const *b, size_t size, dsp_operator op)
+{
+    return dsp_binary(r, a, b, size, op);
+}
+
+void dsp_binary_scalar_f64(double *r, double const *a, double b, size_t size, dsp_operator op)
+{
+    return dsp_binary_scalar(r, a, b, size, op);
+}
+
+void dsp_gain_ramp_f64(double *r, double const *a, size_t size, double start_gain, double step)
+{
+    return dsp_gain_ramp(r, a, size, start_gain, step);
+}
+
+void dsp_accumulate_f64(double *r, double const *a, size_t size, double gain)
+{
+    return dsp_accumulate(r, a, size, gain);
+}
+
+void dsp_mix_f64(double *r, double const *const *inputs, double const *gains, size_t num_inputs, size_t size)
+{
+    return dsp_mix(r, inputs, gains, num_inputs, size);
+}
+
+double dsp_peak_f64(double const *a, size_t size)
+{
+    return dsp_peak(a, size);
+}
+
+double dsp_sum_of_squares_f64(double const *a, size_t size)
+{
+    return dsp_sum_of_squares(a, size);
+}
+
+}}} // namespace hi::v1::HI_CPU_DISPATCH_NAMESPACE
+
+hi_cpu_dispatch_target_pop()
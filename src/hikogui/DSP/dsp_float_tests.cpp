@@ -0,0 +1,236 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "dsp_float.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+#include <array>
+#include <cmath>
+#include <algorithm>
+
+using namespace hi;
+
+namespace {
+
+constexpr auto all_sizes = std::array{0_uz, 1_uz, 3_uz, 7_uz, 8_uz, 16_uz, 17_uz, 33_uz, 100_uz};
+
+/** Make a buffer with the samples starting at an unaligned address.
+ */
+[[nodiscard]] std::vector<float> make_buffer(size_t size)
+{
+    return std::vector<float>(size + 1);
+}
+
+[[nodiscard]] std::span<float> make_span(std::vector<float>& buffer)
+{
+    return std::span{buffer}.subspan(1);
+}
+
+void fill(std::span<float> r, size_t seed)
+{
+    for (auto i = 0_uz; i != r.size(); ++i) {
+        r[i] = static_cast<float>(static_cast<int>((i + seed) * 7919 % 2001) - 1000) / 1000.0f;
+    }
+}
+
+} // namespace
+
+TEST(dsp_float, add_sub_mul)
+{
+    for (hilet size : all_sizes) {
+        auto a_buffer = make_buffer(size);
+        auto b_buffer = make_buffer(size);
+        auto r_buffer = make_buffer(size);
+        hilet a = make_span(a_buffer);
+        hilet b = make_span(b_buffer);
+        hilet r = make_span(r_buffer);
+        fill(a, 1);
+        fill(b, 2);
+
+        dsp_add(r, std::span<float const>{a}, std::span<float const>{b});
+        for (auto i = 0_uz; i != size; ++i) {
+            ASSERT_EQ(r[i], a[i] + b[i]) << "size=" << size << " index=" << i;
+        }
+
+        dsp_sub(r, std::span<float const>{a}, 0.5f);
+        for (auto i = 0_uz; i != size; ++i) {
+            ASSERT_EQ(r[i], a[i] - 0.5f) << "size=" << size << " index=" << i;
+        }
+
+        dsp_mul(r, 2.0f);
+        for (auto i = 0_uz; i != size; ++i) {
+            ASSERT_EQ(r[i], (a[i] - 0.5f) * 2.0f) << "size=" << size << " index=" << i;
+        }
+    }
+}
+
+TEST(dsp_float, gain_ramp)
+{
+    for (hilet size : all_sizes) {
+        auto a_buffer = make_buffer(size);
+        auto r_buffer = make_buffer(size);
+        hilet a = make_span(a_buffer);
+        hilet r = make_span(r_buffer);
+        fill(a, 3);
+
+        dsp_gain_ramp(r, a, 0.25f, 0.75f);
+        for (auto i = 0_uz; i != size; ++i) {
+            hilet gain = 0.25f + 0.5f * static_cast<float>(i) / static_cast<float>(size);
+            ASSERT_NEAR(r[i], a[i] * gain, 1e-6f) << "size=" << size << " index=" << i;
+        }
+    }
+}
+
+TEST(dsp_float, accumulate_and_mix)
+{
+    for (hilet size : all_sizes) {
+        auto buffers = std::array{make_buffer(size), make_buffer(size), make_buffer(size)};
+        auto r_buffer = make_buffer(size);
+        auto s_buffer = make_buffer(size);
+        hilet r = make_span(r_buffer);
+        hilet s = make_span(s_buffer);
+
+        auto inputs = std::array<float const *, 3>{};
+        for (auto k = 0_uz; k != buffers.size(); ++k) {
+            fill(make_span(buffers[k]), k * 13);
+            inputs[k] = make_span(buffers[k]).data();
+        }
+        hilet gains = std::array{0.5f, -0.25f, 2.0f};
+
+        dsp_mix(r, std::span<float const *const>{inputs}, std::span<float const>{gains});
+
+        std::fill(s.begin(), s.end(), 0.0f);
+        for (auto k = 0_uz; k != buffers.size(); ++k) {
+            dsp_accumulate(s, std::span<float const>{inputs[k], size}, gains[k]);
+        }
+
+        for (auto i = 0_uz; i != size; ++i) {
+            auto expected = 0.0f;
+            for (auto k = 0_uz; k != buffers.size(); ++k) {
+                expected += inputs[k][i] * gains[k];
+            }
+            ASSERT_NEAR(r[i], expected, 1e-6f) << "size=" << size << " index=" << i;
+            ASSERT_NEAR(s[i], expected, 1e-6f) << "size=" << size << " index=" << i;
+        }
+    }
+}
+
+TEST(dsp_float, peak_and_rms)
+{
+    for (hilet size : all_sizes) {
+        auto a_buffer = make_buffer(size);
+        hilet a = make_span(a_buffer);
+        fill(a, 5);
+
+        auto expected_peak = 0.0f;
+        auto expected_sum = 0.0;
+        for (hilet x : a) {
+            expected_peak = std::max(expected_peak, std::abs(x));
+            expected_sum += static_cast<double>(x) * static_cast<double>(x);
+        }
+
+        ASSERT_EQ(dsp_peak(a), expected_peak) << "size=" << size;
+        ASSERT_NEAR(dsp_sum_of_squares(std::span<float const>{a}), expected_sum, 1e-4) << "size=" << size;
+        if (size == 0) {
+            ASSERT_EQ(dsp_rms(a), 0.0f);
+        } else {
+            ASSERT_NEAR(dsp_rms(a), std::sqrt(expected_sum / static_cast<double>(size)), 1e-6) << "size=" << size;
+        }
+    }
+
+    // A full scale sine wave has an RMS of 1/sqrt(2).
+    auto sine = std::vector<float>(4800);
+    for (auto i = 0_uz; i != sine.size(); ++i) {
+        sine[i] = static_cast<float>(std::sin(2.0 * std::numbers::pi * static_cast<double>(i) / 48.0));
+    }
+    ASSERT_NEAR(dsp_peak(std::span{sine}), 1.0f, 1e-6f);
+    ASSERT_NEAR(dsp_rms(std::span{sine}), std::sqrt(0.5f), 1e-5f);
+}
+
+TEST(dsp_float, interleave)
+{
+    for (hilet num_channels : std::array{1_uz, 2_uz, 3_uz, 8_uz}) {
+        for (hilet num_frames : all_sizes) {
+            auto channels = std::vector<std::vector<float>>{};
+            auto inputs = std::vector<float const *>{};
+            for (auto c = 0_uz; c != num_channels; ++c) {
+                channels.push_back(std::vector<float>(num_frames));
+                fill(channels.back(), c * 31);
+                inputs.push_back(channels.back().data());
+            }
+
+            auto interleaved = std::vector<float>(num_frames * num_channels);
+            dsp_interleave(std::span{interleaved}, std::span<float const *const>{inputs});
+            for (auto i = 0_uz; i != num_frames; ++i) {
+                for (auto c = 0_uz; c != num_channels; ++c) {
+                    ASSERT_EQ(interleaved[i * num_channels + c], channels[c][i]);
+                }
+            }
+
+            auto outputs_storage = std::vector<std::vector<float>>(num_channels, std::vector<float>(num_frames));
+            auto outputs = std::vector<float *>{};
+            for (auto& output : outputs_storage) {
+                outputs.push_back(output.data());
+            }
+
+            dsp_deinterleave(std::span<float *const>{outputs}, std::span<float const>{interleaved});
+            ASSERT_EQ(outputs_storage, channels);
+        }
+    }
+}
+
+TEST(dsp_float, cpu_levels)
+{
+    // Each variant of the kernels gives the same result as the generic variant.
+    for (hilet size : all_sizes) {
+        auto a_buffer = make_buffer(size);
+        auto b_buffer = make_buffer(size);
+        hilet a = make_span(a_buffer);
+        hilet b = make_span(b_buffer);
+        fill(a, 7);
+        fill(b, 11);
+        hilet inputs = std::array<float const *, 2>{a.data(), b.data()};
+        hilet gains = std::array{0.5f, -0.25f};
+
+        auto expected_buffer = make_buffer(size);
+        auto result_buffer = make_buffer(size);
+        hilet expected = make_span(expected_buffer);
+        hilet result = make_span(result_buffer);
+
+        for (auto level = 1; level <= hi::cpu_dispatch_level(); ++level) {
+            for (hilet op : {dsp_operator::add, dsp_operator::sub, dsp_operator::mul}) {
+                dsp_binary_f32.get(0)(expected.data(), a.data(), b.data(), size, op);
+                dsp_binary_f32.get(level)(result.data(), a.data(), b.data(), size, op);
+                ASSERT_TRUE(std::equal(result.begin(), result.end(), expected.begin())) << "level=" << level << " size=" << size;
+
+                dsp_binary_scalar_f32.get(0)(expected.data(), a.data(), 0.75f, size, op);
+                dsp_binary_scalar_f32.get(level)(result.data(), a.data(), 0.75f, size, op);
+                ASSERT_TRUE(std::equal(result.begin(), result.end(), expected.begin())) << "level=" << level << " size=" << size;
+            }
+
+            dsp_gain_ramp_f32.get(0)(expected.data(), a.data(), size, 0.25f, 0.01f);
+            dsp_gain_ramp_f32.get(level)(result.data(), a.data(), size, 0.25f, 0.01f);
+            for (auto i = 0_uz; i != size; ++i) {
+                ASSERT_NEAR(result[i], expected[i], 1e-6f) << "level=" << level << " size=" << size << " index=" << i;
+            }
+
+            dsp_mix_f32.get(0)(expected.data(), inputs.data(), gains.data(), inputs.size(), size);
+            dsp_mix_f32.get(level)(result.data(), inputs.data(), gains.data(), inputs.size(), size);
+            for (auto i = 0_uz; i != size; ++i) {
+                ASSERT_NEAR(result[i], expected[i], 1e-6f) << "level=" << level << " size=" << size << " index=" << i;
+            }
+
+            ASSERT_EQ(dsp_peak_f32.get(level)(a.data(), size), dsp_peak_f32.get(0)(a.data(), size)) << "level=" << level;
+            ASSERT_NEAR(
+                dsp_sum_of_squares_f32.get(level)(a.data(), size), dsp_sum_of_squares_f32.get(0)(a.data(), size), 1e-4f)
+                << "level=" << level;
+
+            auto a64 = std::vector<double>(a.begin(), a.end());
+            ASSERT_NEAR(
+                dsp_sum_of_squares_f64.get(level)(a64.data(), size), dsp_sum_of_squares_f64.get(0)(a64.data(), size), 1e-12)
+                << "level=" << level;
+        }
+    }
+}
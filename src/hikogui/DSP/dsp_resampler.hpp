@@ -0,0 +1,278 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file DSP/dsp_resampler.hpp Sample rate conversion with a polyphase filter.
+ * @ingroup DSP
+ */
+
+#pragma once
+
+#include "dsp_float.hpp"
+#include "../SIMD/cpu_dispatch.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <vector>
+#include <concepts>
+#include <numbers>
+#include <algorithm>
+#include <numeric>
+#include <cmath>
+
+hi_export_module(hikogui.DSP.dsp_resampler);
+
+namespace hi { inline namespace v1 {
+
+/** The signature of the dsp_resample kernel.
+ *
+ * Calculates the output samples of a `dsp_resampler` for which all input
+ * samples are available in @a a.
+ *
+ * @param r The output samples.
+ * @param a The input samples.
+ * @param size The number of input samples.
+ * @param coefficients The coefficients of each phase, @a num_taps for each phase, in reverse.
+ * @param num_taps The number of input samples used for each output sample.
+ * @param up The interpolation factor.
+ * @param down The decimation factor.
+ * @param[in,out] index The index in @a a of the newest sample of the next output,
+ *                at least `num_taps - 1`.
+ * @param[in,out] phase The filter phase of the next output.
+ * @return The number of output samples written to @a r.
+ */
+template<typename T>
+using dsp_resample_type = size_t(
+    T *r,
+    T const *a,
+    size_t size,
+    T const *coefficients,
+    size_t num_taps,
+    size_t up,
+    size_t down,
+    size_t *index,
+    size_t *phase);
+
+#if HI_PROCESSOR == HI_CPU_X64
+namespace cpu_x64v1 {
+dsp_resample_type<float> dsp_resample_f32;
+dsp_resample_type<double> dsp_resample_f64;
+} // namespace cpu_x64v1
+namespace cpu_x64v2 {
+dsp_resample_type<float> dsp_resample_f32;
+dsp_resample_type<double> dsp_resample_f64;
+} // namespace cpu_x64v2
+namespace cpu_x64v3 {
+dsp_resample_type<float> dsp_resample_f32;
+dsp_resample_type<double> dsp_resample_f64;
+} // namespace cpu_x64v3
+namespace cpu_x64v4 {
+dsp_resample_type<float> dsp_resample_f32;
+dsp_resample_type<double> dsp_resample_f64;
+} // namespace cpu_x64v4
+
+hi_export inline cpu_dispatch<dsp_resample_type<float>> dsp_resample_f32 = {
+    cpu_x64v1::dsp_resample_f32,
+    cpu_x64v2::dsp_resample_f32,
+    cpu_x64v3::dsp_resample_f32,
+    cpu_x64v4::dsp_resample_f32};
+hi_export inline cpu_dispatch<dsp_resample_type<double>> dsp_resample_f64 = {
+    cpu_x64v1::dsp_resample_f64,
+    cpu_x64v2::dsp_resample_f64,
+    cpu_x64v3::dsp_resample_f64,
+    cpu_x64v4::dsp_resample_f64};
+#else
+namespace cpu_generic {
+dsp_resample_type<float> dsp_resample_f32;
+dsp_resample_type<double> dsp_resample_f64;
+} // namespace cpu_generic
+
+hi_export inline cpu_dispatch<dsp_resample_type<float>> dsp_resample_f32{cpu_generic::dsp_resample_f32};
+hi_export inline cpu_dispatch<dsp_resample_type<double>> dsp_resample_f64{cpu_generic::dsp_resample_f64};
+#endif
+
+/** Convert the sample rate by a rational factor.
+ *
+ * The samples are conceptually up-sampled by @a up, low-pass filtered and
+ * then down-sampled by @a down. Only the filter phase that is needed for each
+ * output sample is calculated.
+ *
+ * The low-pass filter is a Blackman windowed sinc with its cutoff at the
+ * lowest of the two Nyquist frequencies. Each phase of the filter is
+ * normalized to a gain of 1, so that a constant signal passes unchanged.
+ *
+ * The filter coefficients are allocated by the constructor; processing
+ * samples does not allocate and may be done on a real-time audio thread.
+ *
+ * @tparam T The sample type.
+ */
+hi_export template<std::floating_point T>
+class dsp_resampler {
+public:
+    using value_type = T;
+
+    /** Create a resampler.
+     *
+     * To convert 44100 Hz to 48000 Hz use `dsp_resampler(160, 147)`.
+     *
+     * @param up The interpolation factor.
+     * @param down The decimation factor.
+     * @param num_taps The number of input samples used for each output sample.
+     */
+    dsp_resampler(size_t up, size_t down, size_t num_taps = 32) :
+        _up(up / std::gcd(up, down)),
+        _down(down / std::gcd(up, down)),
+        _num_taps(num_taps),
+        _coefficients(_up * num_taps),
+        _history(num_taps - 1)
+    {
+        hi_assert(up != 0);
+        hi_assert(down != 0);
+        hi_assert(num_taps != 0);
+
+        hilet filter_size = _up * _num_taps;
+        hilet window_size = static_cast<double>(std::max(filter_size - 1, 1_uz));
+        hilet center = static_cast<double>(filter_size - 1) / 2.0;
+        hilet cutoff = 0.5 / static_cast<double>(std::max(_up, _down));
+
+        for (auto phase = 0_uz; phase != _up; ++phase) {
+            auto *coefficients = _coefficients.data() + phase * _num_taps;
+
+            auto sum = 0.0;
+            for (auto k = 0_uz; k != _num_taps; ++k) {
+                hilet j = phase + k * _up;
+                hilet x = static_cast<double>(j) - center;
+                hilet sinc = x == 0.0 ? 1.0 : std::sin(2.0 * std::numbers::pi * cutoff * x) / (std::numbers::pi * x);
+                hilet w = 2.0 * std::numbers::pi * static_cast<double>(j) / window_size;
+                hilet window = 0.42 - 0.5 * std::cos(w) + 0.08 * std::cos(2.0 * w);
+
+                // Stored in reverse, so that the coefficients line up with the samples in memory.
+                hilet h = sinc * window;
+                coefficients[_num_taps - 1 - k] = static_cast<value_type>(h);
+                sum += h;
+            }
+
+            for (auto k = 0_uz; k != _num_taps; ++k) {
+                coefficients[k] = static_cast<value_type>(coefficients[k] / sum);
+            }
+        }
+    }
+
+    dsp_resampler(dsp_resampler const&) = default;
+    dsp_resampler(dsp_resampler&&) noexcept = default;
+    dsp_resampler& operator=(dsp_resampler const&) = default;
+    dsp_resampler& operator=(dsp_resampler&&) noexcept = default;
+
+    /** The interpolation factor, after reduction.
+     */
+    [[nodiscard]] size_t up() const noexcept
+    {
+        return _up;
+    }
+
+    /** The decimation factor, after reduction.
+     */
+    [[nodiscard]] size_t down() const noexcept
+    {
+        return _down;
+    }
+
+    /** The delay of the filter in input samples.
+     */
+    [[nodiscard]] double delay() const noexcept
+    {
+        return static_cast<double>(_up * _num_taps - 1) / static_cast<double>(2 * _up);
+    }
+
+    /** The maximum number of output samples for a buffer of input samples.
+     */
+    [[nodiscard]] size_t max_output_size(size_t input_size) const noexcept
+    {
+        return (input_size * _up + _down - 1) / _down;
+    }
+
+    /** Clear the history of the filter.
+     */
+    void reset() noexcept
+    {
+        std::fill(_history.begin(), _history.end(), value_type{0});
+        _index = 0;
+        _phase = 0;
+    }
+
+    /** Convert a buffer of samples.
+     *
+     * @param r The output samples, at least `max_output_size(a.size())` samples.
+     * @param a The input samples.
+     * @return The number of output samples written to @a r.
+     */
+    size_t operator()(std::span<value_type> r, std::span<value_type const> a) noexcept
+    {
+        hi_axiom(r.size() >= max_output_size(a.size()));
+
+        hilet num_history = _history.size();
+        auto const *a_ = a.data();
+        auto *r_ = r.data();
+
+        auto n = _index;
+        auto phase = _phase;
+        auto count = 0_uz;
+
+        // The outputs where the oldest samples are in the history.
+        while (n < a.size() and n < num_history) {
+            auto const *coefficients = _coefficients.data() + phase * _num_taps;
+
+            auto sum = value_type{0};
+            for (auto k = 0_uz; k != _num_taps; ++k) {
+                // Index of the sample relative to the start of the input buffer, plus num_history.
+                hilet i = n + k;
+                sum += coefficients[k] * (i < num_history ? _history[i] : a_[i - num_history]);
+            }
+            r_[count++] = sum;
+
+            phase += _down;
+            n += phase / _up;
+            phase %= _up;
+        }
+
+        // The outputs where all samples are in the input buffer.
+        if (n < a.size()) {
+            count += detail::dsp_kernel<value_type>(dsp_resample_f32, dsp_resample_f64)(
+                r_ + count, a_, a.size(), _coefficients.data(), _num_taps, _up, _down, &n, &phase);
+        }
+
+        _index = n - a.size();
+        _phase = phase;
+
+        if (a.size() >= num_history) {
+            std::copy(a.end() - num_history, a.end(), _history.begin());
+        } else {
+            std::copy(_history.begin() + a.size(), _history.end(), _history.begin());
+            std::copy(a.begin(), a.end(), _history.end() - a.size());
+        }
+        return count;
+    }
+
+private:
+    size_t _up;
+    size_t _down;
+    size_t _num_taps;
+
+    /** The coefficients for each phase, `_num_taps` for each phase, in reverse.
+     */
+    std::vector<value_type> _coefficients;
+
+    /** The last `_num_taps - 1` input samples, oldest first.
+     */
+    std::vector<value_type> _history;
+
+    /** The index in the next input buffer of the newest sample of the next output.
+     */
+    size_t _index = 0;
+
+    /** The filter phase of the next output.
+     */
+    size_t _phase = 0;
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,98 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file DSP/dsp_resampler_kernels.hpp The polyphase resampler kernels, compiled once for each CPU level.
+ *
+ * Only include this file from `SIMD/cpu_dispatch_kernels.hpp`.
+ */
+
+#pragma once
+
+#include "dsp_resampler.hpp"
+#include "dsp_float_kernels.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <cstddef>
+
+#ifndef HI_CPU_DISPATCH_NAMESPACE
+#error "dsp_resampler_kernels.hpp must be included through cpu_dispatch_kernels.hpp"
+#endif
+
+hi_cpu_dispatch_target_push()
+
+namespace hi { inline namespace v1 { namespace HI_CPU_DISPATCH_NAMESPACE {
+
+template<typename T>
+[[nodiscard]] size_t dsp_resample(
+    T *r,
+    T const *a,
+    size_t size,
+    T const *coefficients,
+    size_t num_taps,
+    size_t up,
+    size_t down,
+    size_t *index,
+    size_t *phase) noexcept
+{
+    using W = dsp_wide<T>;
+
+    auto n = *index;
+    auto p = *phase;
+    auto count = 0_uz;
+    while (n < size) {
+        auto const *c = coefficients + p * num_taps;
+        auto const *x = a + n - (num_taps - 1);
+
+        auto k = 0_uz;
+        auto sum_wide = W::broadcast(T{0});
+        for (; k + W::size <= num_taps; k += W::size) {
+            sum_wide = W::add(sum_wide, W::mul(W::load(c + k), W::load(x + k)));
+        }
+        auto sum = W::sum(sum_wide);
+        for (; k != num_taps; ++k) {
+            sum += c[k] * x[k];
+        }
+        r[count++] = sum;
+
+        p += down;
+        n += p / up;
+        p %= up;
+    }
+
+    *index = n;
+    *phase = p;
+    return count;
+}
+
+size_t dsp_resample_f32(
+    float *r,
+    float const *a,
+    size_t size,
+    float const *coefficients,
+    size_t num_taps,
+    size_t up,
+    size_t down,
+    size_t *index,
+    size_t *phase)
+{
+    return dsp_resample(r, a, size, coefficients, num_taps, up, down, index, phase);
+}
+
+size_t dsp_resample_f64(
+    double *r,
+    double const *a,
+    size_t size,
+    double const *coefficients,
+    size_t num_taps,
+    size_t up,
+    size_t down,
+    size_t *index,
+    size_t *phase)
+{
+    return dsp_resample(r, a, size, coefficients, num_taps, up, down, index, phase);
+}
+
+}}} // namespace hi::v1::HI_CPU_DISPATCH_NAMESPACE
+
+hi_cpu_dispatch_target_pop()
@@ -0,0 +1,157 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "dsp_resampler.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+#include <array>
+#include <cmath>
+#include <numbers>
+
+using namespace hi;
+
+namespace {
+
+[[nodiscard]] std::vector<float> make_sine(size_t size, double frequency, double sample_rate)
+{
+    auto r = std::vector<float>(size);
+    for (auto i = 0_uz; i != size; ++i) {
+        r[i] = static_cast<float>(std::sin(2.0 * std::numbers::pi * frequency * static_cast<double>(i) / sample_rate));
+    }
+    return r;
+}
+
+[[nodiscard]] std::vector<float> resample(dsp_resampler<float>& resampler, std::vector<float> const& samples, size_t block_size)
+{
+    auto r = std::vector<float>{};
+    auto block = std::vector<float>(resampler.max_output_size(block_size));
+    for (auto offset = 0_uz; offset < samples.size(); offset += block_size) {
+        hilet size = std::min(block_size, samples.size() - offset);
+        hilet count = resampler(std::span{block}, std::span<float const>{samples}.subspan(offset, size));
+        r.insert(r.end(), block.begin(), block.begin() + count);
+    }
+    return r;
+}
+
+} // namespace
+
+TEST(dsp_resampler, constant)
+{
+    auto resampler = dsp_resampler<float>(160, 147);
+    ASSERT_EQ(resampler.up(), 160);
+    ASSERT_EQ(resampler.down(), 147);
+
+    hilet samples = std::vector<float>(1000, 0.5f);
+    hilet result = resample(resampler, samples, 64);
+
+    ASSERT_EQ(result.size(), (samples.size() * 160 + 146) / 147);
+    // Skip the outputs that still use the zeros in the initial history.
+    for (auto i = 40_uz; i != result.size(); ++i) {
+        ASSERT_NEAR(result[i], 0.5f, 1e-5f) << "index=" << i;
+    }
+}
+
+TEST(dsp_resampler, sine)
+{
+    struct test_case {
+        size_t up;
+        size_t down;
+        double input_rate;
+    };
+
+    for (hilet [up, down, input_rate] : std::array{
+             test_case{160, 147, 44100.0}, test_case{147, 160, 48000.0}, test_case{2, 1, 48000.0}, test_case{1, 2, 96000.0}}) {
+        auto resampler = dsp_resampler<float>(up, down, 64);
+        hilet output_rate = input_rate * static_cast<double>(up) / static_cast<double>(down);
+
+        hilet samples = make_sine(4800, 1000.0, input_rate);
+        hilet result = resample(resampler, samples, 37);
+
+        // Compare with the analytical sine wave, taking the delay of the filter into account.
+        hilet delay = resampler.delay() / input_rate;
+        for (auto i = result.size() / 4; i != result.size(); ++i) {
+            hilet t = static_cast<double>(i) / output_rate - delay;
+            hilet expected = std::sin(2.0 * std::numbers::pi * 1000.0 * t);
+            ASSERT_NEAR(result[i], expected, 1e-3) << "up=" << up << " down=" << down << " index=" << i;
+        }
+    }
+}
+
+TEST(dsp_resampler, anti_alias)
+{
+    // A tone above the Nyquist frequency of the output is removed when down-sampling.
+    auto resampler = dsp_resampler<float>(1, 2, 64);
+
+    hilet samples = make_sine(4800, 30000.0, 96000.0);
+    hilet result = resample(resampler, samples, 100);
+
+    auto peak = 0.0f;
+    for (auto i = result.size() / 4; i != result.size(); ++i) {
+        peak = std::max(peak, std::abs(result[i]));
+    }
+    ASSERT_LT(peak, 0.01f);
+}
+
+TEST(dsp_resampler, block_size)
+{
+    // The result does not depend on the size of the blocks.
+    hilet samples = make_sine(1000, 1234.0, 44100.0);
+
+    auto resampler = dsp_resampler<float>(160, 147, 16);
+    hilet expected = resample(resampler, samples, samples.size());
+
+    for (hilet block_size : std::array{1_uz, 7_uz, 15_uz, 16_uz, 100_uz}) {
+        resampler.reset();
+        hilet result = resample(resampler, samples, block_size);
+        ASSERT_EQ(result.size(), expected.size());
+        for (auto i = 0_uz; i != result.size(); ++i) {
+            ASSERT_NEAR(result[i], expected[i], 1e-6f) << "block_size=" << block_size << " index=" << i;
+        }
+    }
+}
+
+TEST(dsp_resampler, cpu_levels)
+{
+    // Each variant of the kernel gives the same result as the generic variant.
+    constexpr auto up = 3_uz;
+    constexpr auto down = 2_uz;
+
+    hilet samples = make_sine(500, 1234.0, 44100.0);
+    for (hilet num_taps : std::array{5_uz, 16_uz, 33_uz}) {
+        auto coefficients = std::vector<float>(up * num_taps);
+        for (auto i = 0_uz; i != coefficients.size(); ++i) {
+            coefficients[i] = static_cast<float>(static_cast<int>(i * 31 % 17) - 8) / 64.0f;
+        }
+
+        auto expected = std::vector<float>(samples.size() * up / down + 1);
+        auto expected_index = num_taps - 1;
+        auto expected_phase = 0_uz;
+        expected.resize(dsp_resample_f32.get(0)(
+            expected.data(),
+            samples.data(),
+            samples.size(),
+            coefficients.data(),
+            num_taps,
+            up,
+            down,
+            &expected_index,
+            &expected_phase));
+
+        for (auto level = 1; level <= hi::cpu_dispatch_level(); ++level) {
+            auto result = std::vector<float>(samples.size() * up / down + 1);
+            auto index = num_taps - 1;
+            auto phase = 0_uz;
+            result.resize(dsp_resample_f32.get(level)(
+                result.data(), samples.data(), samples.size(), coefficients.data(), num_taps, up, down, &index, &phase));
+
+            ASSERT_EQ(index, expected_index) << "level=" << level;
+            ASSERT_EQ(phase, expected_phase) << "level=" << level;
+            ASSERT_EQ(result.size(), expected.size()) << "level=" << level;
+            for (auto i = 0_uz; i != result.size(); ++i) {
+                ASSERT_NEAR(result[i], expected[i], 1e-5f) << "level=" << level << " num_taps=" << num_taps << " index=" << i;
+            }
+        }
+    }
+}
@@ -1,4 +1,10 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #pragma once
 
+#include "dsp_biquad.hpp"
+#include "dsp_fir.hpp"
 #include "dsp_float.hpp"
+#include "dsp_resampler.hpp"
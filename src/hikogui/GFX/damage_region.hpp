@@ -0,0 +1,251 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../geometry/module.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <array>
+#include <cstddef>
+#include <limits>
+
+namespace hi::inline v1 {
+
+/** The part of a window that needs to be redrawn.
+ *
+ * The region is a small set of disjoint rectangles. Redraw requests from
+ * widgets in different parts of the window, such as a blinking text-cursor in
+ * one corner and a progress bar in the opposite corner, remain separate
+ * rectangles instead of being combined into a single bounding rectangle that
+ * covers most of the window.
+ *
+ * When a rectangle is added it is merged with the rectangles it overlaps with,
+ * and with rectangles that are close by; so that the region does not contain
+ * many small rectangles which each require a separate render pass.
+ */
+class damage_region {
+public:
+    using value_type = aarectangle;
+    using const_iterator = aarectangle const *;
+
+    /** The maximum number of rectangles in the region.
+     * When more rectangles are added, the rectangles that waste the least
+     * amount of area are merged.
+     */
+    constexpr static std::size_t max_size = 8;
+
+    /** Rectangles are merged when the area of their bounding rectangle is at
+     * most this factor larger than the area of the two rectangles.
+     */
+    constexpr static float merge_factor = 1.5f;
+
+    constexpr damage_region() noexcept = default;
+    constexpr damage_region(damage_region const&) noexcept = default;
+    constexpr damage_region(damage_region&&) noexcept = default;
+    constexpr damage_region& operator=(damage_region const&) noexcept = default;
+    constexpr damage_region& operator=(damage_region&&) noexcept = default;
+
+    constexpr damage_region(aarectangle const& rectangle) noexcept
+    {
+        *this |= rectangle;
+    }
+
+    [[nodiscard]] constexpr std::size_t size() const noexcept
+    {
+        return _size;
+    }
+
+    [[nodiscard]] constexpr bool empty() const noexcept
+    {
+        return _size == 0;
+    }
+
+    /** True when the region needs to be redrawn.
+     */
+    [[nodiscard]] constexpr explicit operator bool() const noexcept
+    {
+        return not empty();
+    }
+
+    [[nodiscard]] constexpr const_iterator begin() const noexcept
+    {
+        return _rectangles.data();
+    }
+
+    [[nodiscard]] constexpr const_iterator end() const noexcept
+    {
+        return _rectangles.data() + _size;
+    }
+
+    [[nodiscard]] constexpr aarectangle const& operator[](std::size_t index) const noexcept
+    {
+        hi_axiom(index < _size);
+        return _rectangles[index];
+    }
+
+    constexpr void clear() noexcept
+    {
+        _size = 0;
+    }
+
+    /** The number of pixels in the region.
+     */
+    [[nodiscard]] constexpr float area() const noexcept
+    {
+        auto r = 0.0f;
+        for (hilet& rectangle : *this) {
+            r += area(rectangle);
+        }
+        return r;
+    }
+
+    [[nodiscard]] friend constexpr aarectangle bounding_rectangle(damage_region const& rhs) noexcept
+    {
+        auto r = aarectangle{};
+        for (hilet& rectangle : rhs) {
+            r = r | rectangle;
+        }
+        return r;
+    }
+
+    /** Add a rectangle to the region.
+     *
+     * @param rhs The rectangle to add, an empty rectangle is ignored.
+     */
+    constexpr damage_region& operator|=(aarectangle rhs) noexcept
+    {
+        if (rhs.empty()) {
+            return *this;
+        }
+
+        while (true) {
+            // Absorb each rectangle that should be merged; as the new rectangle
+            // grows it may need to absorb rectangles that were checked before.
+            for (auto i = 0_uz; i != _size;) {
+                if (should_merge(_rectangles[i], rhs)) {
+                    rhs = rhs | _rectangles[i];
+                    erase(i);
+                    i = 0;
+                } else {
+                    ++i;
+                }
+            }
+
+            if (_size < max_size) {
+                _rectangles[_size++] = rhs;
+                return *this;
+            }
+
+            // The region is full, merge with the rectangle that wastes the least area.
+            auto best_index = 0_uz;
+            auto best_waste = std::numeric_limits<float>::max();
+            for (auto i = 0_uz; i != _size; ++i) {
+                hilet waste = area(rhs | _rectangles[i]) - area(rhs) - area(_rectangles[i]);
+                if (waste < best_waste) {
+                    best_index = i;
+                    best_waste = waste;
+                }
+            }
+
+            rhs = rhs | _rectangles[best_index];
+            erase(best_index);
+        }
+    }
+
+    constexpr damage_region& operator|=(damage_region const& rhs) noexcept
+    {
+        for (hilet& rectangle : rhs) {
+            *this |= rectangle;
+        }
+        return *this;
+    }
+
+    [[nodiscard]] friend constexpr damage_region operator|(damage_region lhs, aarectangle const& rhs) noexcept
+    {
+        return lhs |= rhs;
+    }
+
+    [[nodiscard]] friend constexpr damage_region operator|(damage_region lhs, damage_region const& rhs) noexcept
+    {
+        return lhs |= rhs;
+    }
+
+    /** Check if a rectangle overlaps with any of the rectangles of the region.
+     */
+    [[nodiscard]] friend constexpr bool overlaps(damage_region const& lhs, aarectangle const& rhs) noexcept
+    {
+        for (hilet& rectangle : lhs) {
+            if (overlaps(rectangle, rhs)) {
+                return true;
+            }
+        }
+        return false;
+    }
+
+    /** Clip the region to a rectangle.
+     */
+    [[nodiscard]] friend constexpr damage_region intersect(damage_region const& lhs, aarectangle const& rhs) noexcept
+    {
+        auto r = damage_region{};
+        for (hilet& rectangle : lhs) {
+            r |= intersect(rectangle, rhs);
+        }
+        return r;
+    }
+
+    /** Expand each rectangle of the region to a certain granularity.
+     *
+     * Rectangles that overlap after expanding are merged.
+     */
+    [[nodiscard]] friend constexpr damage_region ceil(damage_region const& lhs, extent2 const& rhs) noexcept
+    {
+        auto r = damage_region{};
+        for (hilet& rectangle : lhs) {
+            r |= ceil(rectangle, rhs);
+        }
+        return r;
+    }
+
+    [[nodiscard]] friend constexpr bool operator==(damage_region const& lhs, damage_region const& rhs) noexcept
+    {
+        if (lhs._size != rhs._size) {
+            return false;
+        }
+        for (auto i = 0_uz; i != lhs._size; ++i) {
+            if (lhs._rectangles[i] != rhs._rectangles[i]) {
+                return false;
+            }
+        }
+        return true;
+    }
+
+private:
+    std::array<aarectangle, max_size> _rectangles = {};
+    std::size_t _size = 0;
+
+    [[nodiscard]] constexpr static float area(aarectangle const& rhs) noexcept
+    {
+        return rhs.width() * rhs.height();
+    }
+
+    [[nodiscard]] constexpr static bool should_merge(aarectangle const& lhs, aarectangle const& rhs) noexcept
+    {
+        if (not intersect(lhs, rhs).empty()) {
+            // The rectangles in the region must be disjoint.
+            return true;
+        }
+        return area(lhs | rhs) <= merge_factor * (area(lhs) + area(rhs));
+    }
+
+    /** Remove a rectangle, the order of the rectangles is not maintained.
+     */
+    constexpr void erase(std::size_t index) noexcept
+    {
+        hi_axiom(index < _size);
+        _rectangles[index] = _rectangles[--_size];
+    }
+};
+
+} // namespace hi::inline v1
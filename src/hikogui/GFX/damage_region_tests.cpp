@@ -0,0 +1,128 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "damage_region.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <random>
+#include <vector>
+
+using namespace hi;
+
+TEST(damage_region, empty)
+{
+    auto region = damage_region{};
+    ASSERT_TRUE(region.empty());
+    ASSERT_FALSE(static_cast<bool>(region));
+
+    region |= aarectangle{};
+    ASSERT_TRUE(region.empty());
+    ASSERT_FALSE(overlaps(region, aarectangle{0.0f, 0.0f, 100.0f, 100.0f}));
+}
+
+TEST(damage_region, opposite_corners)
+{
+    // A text-cursor in the bottom-left corner and a progress bar in the top-right corner.
+    hilet cursor = aarectangle{10.0f, 10.0f, 2.0f, 20.0f};
+    hilet progress = aarectangle{1500.0f, 1000.0f, 300.0f, 20.0f};
+
+    auto region = damage_region{cursor};
+    region |= progress;
+    ASSERT_EQ(region.size(), 2U);
+    ASSERT_EQ(region.area(), 40.0f + 6000.0f);
+    ASSERT_EQ(bounding_rectangle(region), (cursor | progress));
+
+    ASSERT_TRUE(overlaps(region, aarectangle{0.0f, 0.0f, 20.0f, 20.0f}));
+    ASSERT_TRUE(overlaps(region, aarectangle{1600.0f, 1010.0f, 10.0f, 10.0f}));
+    ASSERT_FALSE(overlaps(region, aarectangle{500.0f, 500.0f, 100.0f, 100.0f}));
+}
+
+TEST(damage_region, merge)
+{
+    // Overlapping rectangles are merged.
+    auto region = damage_region{aarectangle{0.0f, 0.0f, 100.0f, 100.0f}};
+    region |= aarectangle{50.0f, 50.0f, 100.0f, 100.0f};
+    ASSERT_EQ(region.size(), 1U);
+    ASSERT_EQ(region[0], (aarectangle{0.0f, 0.0f, 150.0f, 150.0f}));
+
+    // A contained rectangle does not change the region.
+    region |= aarectangle{10.0f, 10.0f, 10.0f, 10.0f};
+    ASSERT_EQ(region.size(), 1U);
+    ASSERT_EQ(region[0], (aarectangle{0.0f, 0.0f, 150.0f, 150.0f}));
+
+    // Adjacent rectangles are merged.
+    region |= aarectangle{150.0f, 0.0f, 50.0f, 150.0f};
+    ASSERT_EQ(region.size(), 1U);
+    ASSERT_EQ(region[0], (aarectangle{0.0f, 0.0f, 200.0f, 150.0f}));
+
+    // A rectangle that covers the whole region replaces it.
+    region |= aarectangle{-10.0f, -10.0f, 300.0f, 300.0f};
+    ASSERT_EQ(region.size(), 1U);
+    ASSERT_EQ(region[0], (aarectangle{-10.0f, -10.0f, 300.0f, 300.0f}));
+}
+
+TEST(damage_region, merge_chain)
+{
+    // Two separate rectangles which become connected by a third.
+    auto region = damage_region{aarectangle{0.0f, 0.0f, 10.0f, 10.0f}};
+    region |= aarectangle{100.0f, 0.0f, 10.0f, 10.0f};
+    ASSERT_EQ(region.size(), 2U);
+
+    region |= aarectangle{5.0f, 0.0f, 100.0f, 10.0f};
+    ASSERT_EQ(region.size(), 1U);
+    ASSERT_EQ(region[0], (aarectangle{0.0f, 0.0f, 110.0f, 10.0f}));
+}
+
+TEST(damage_region, ceil)
+{
+    auto region = damage_region{aarectangle{1.0f, 1.0f, 2.0f, 2.0f}};
+    region |= aarectangle{100.0f, 100.0f, 2.0f, 2.0f};
+    ASSERT_EQ(region.size(), 2U);
+
+    hilet r = ceil(region, extent2{64.0f, 64.0f});
+    ASSERT_EQ(r.size(), 2U);
+    ASSERT_EQ(r.area(), 64.0f * 64.0f * 2.0f);
+    ASSERT_TRUE(overlaps(r, aarectangle{60.0f, 60.0f, 1.0f, 1.0f}));
+}
+
+TEST(damage_region, random)
+{
+    auto engine = std::mt19937{42};
+    auto position_dist = std::uniform_real_distribution<float>{0.0f, 2000.0f};
+    auto size_dist = std::uniform_real_distribution<float>{1.0f, 100.0f};
+
+    for (auto i = 0; i != 100; ++i) {
+        auto region = damage_region{};
+        auto bounds = aarectangle{};
+        auto rectangles = std::vector<aarectangle>{};
+
+        for (auto j = 0; j != 20; ++j) {
+            hilet rectangle = aarectangle{position_dist(engine), position_dist(engine), size_dist(engine), size_dist(engine)};
+            rectangles.push_back(rectangle);
+            bounds = bounds | rectangle;
+            region |= rectangle;
+            ASSERT_LE(region.size(), damage_region::max_size);
+        }
+
+        // All rectangles must be covered by the region.
+        for (hilet& rectangle : rectangles) {
+            auto covered = 0.0f;
+            for (hilet& damage : region) {
+                hilet overlap = intersect(rectangle, damage);
+                covered += overlap.width() * overlap.height();
+            }
+            ASSERT_NEAR(covered, rectangle.width() * rectangle.height(), 0.1f);
+        }
+
+        // The rectangles in the region must be disjoint.
+        for (auto a = 0_uz; a != region.size(); ++a) {
+            for (auto b = a + 1; b != region.size(); ++b) {
+                ASSERT_TRUE(intersect(region[a], region[b]).empty());
+            }
+        }
+
+        ASSERT_EQ(bounding_rectangle(region), bounds);
+        ASSERT_LE(region.area(), bounds.width() * bounds.height());
+    }
+}
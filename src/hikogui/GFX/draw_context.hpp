@@ -8,12 +8,14 @@
 #include "pipeline_image_vertex.hpp"
 #include "pipeline_SDF_vertex.hpp"
 #include "pipeline_alpha_vertex.hpp"
+#include "damage_region.hpp"
 #include "../settings/settings.hpp"
 #include "../geometry/module.hpp"
 #include "../unicode/module.hpp"
 #include "../text/module.hpp"
 #include "../color/module.hpp"
 #include "../container/module.hpp"
+#include "../telemetry/module.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
 
@@ -21,9 +23,9 @@
 
 namespace hi { inline namespace v1 {
 class gfx_device;
-class gfx_device_vulkan;
 class glyph_ids;
 class widget_layout;
+class draw_list;
 struct paged_image;
 
 /** The side where the border is drawn.
@@ -211,15 +213,15 @@ concept draw_quad_shape = std::same_as<Context, quad> or std::same_as<Context, r
  */
 class draw_context {
 public:
-    gfx_device_vulkan& device;
+    gfx_device& device;
 
     /** The frame buffer index of the image we are currently rendering.
      */
     std::size_t frame_buffer_index;
 
-    /** This is the rectangle of the window that is being redrawn.
+    /** This is the part of the window that is being redrawn.
      */
-    aarectangle scissor_rectangle;
+    damage_region redraw_region;
 
     /** The subpixel orientation for rendering glyphs.
      */
@@ -244,7 +246,7 @@ public:
     ~draw_context() = default;
 
     draw_context(
-        gfx_device_vulkan& device,
+        gfx_device& device,
         vector_span<pipeline_box::vertex>& box_vertices,
         vector_span<pipeline_image::vertex>& image_vertices,
         vector_span<pipeline_SDF::vertex>& sdf_vertices,
@@ -267,7 +269,7 @@ public:
     void draw_box(WidgetLayout const& layout, quad const& box, draw_attributes const& attributes) const noexcept
     {
         return _draw_box(
-            layout.clipping_rectangle_on_window(attributes.clipping_rectangle), layout.to_window3() * box, attributes);
+            _clipping_rectangle(layout, attributes.clipping_rectangle), _to_window3(layout) * box, attributes);
     }
 
     /** Draw a box.
@@ -351,7 +353,7 @@ public:
     [[nodiscard]] bool
     draw_image(WidgetLayout const& layout, quad const& box, paged_image& image, draw_attributes const& attributes) const noexcept
     {
-        return _draw_image(layout.clipping_rectangle_on_window(attributes.clipping_rectangle), layout.to_window3() * box, image);
+        return _draw_image(_clipping_rectangle(layout, attributes.clipping_rectangle), _to_window3(layout) * box, image);
     }
 
     /** Draw an image
@@ -383,7 +385,7 @@ public:
         const noexcept
     {
         return _draw_glyph(
-            layout.clipping_rectangle_on_window(attributes.clipping_rectangle), layout.to_window3() * box, glyph, attributes);
+            _clipping_rectangle(layout, attributes.clipping_rectangle), _to_window3(layout) * box, glyph, attributes);
     }
 
     /** Draw a glyph.
@@ -413,8 +415,8 @@ public:
         const noexcept
     {
         return _draw_text(
-            layout.clipping_rectangle_on_window(attributes.clipping_rectangle),
-            layout.to_window3() * transform,
+            _clipping_rectangle(layout, attributes.clipping_rectangle),
+            _to_window3(layout) * transform,
             text,
             attributes);
     }
@@ -460,7 +462,7 @@ public:
         draw_attributes const& attributes) const noexcept
     {
         return _draw_text_selection(
-            layout.clipping_rectangle_on_window(attributes.clipping_rectangle), layout.to_window3(), text, selection, attributes);
+            _clipping_rectangle(layout, attributes.clipping_rectangle), _to_window3(layout), text, selection, attributes);
     }
 
     /** Draw text-selection of shaped text.
@@ -499,8 +501,8 @@ public:
         draw_attributes const& attributes) const noexcept
     {
         return _draw_text_cursors(
-            layout.clipping_rectangle_on_window(attributes.clipping_rectangle),
-            layout.to_window3(),
+            _clipping_rectangle(layout, attributes.clipping_rectangle),
+            _to_window3(layout),
             text,
             cursor,
             overwrite_mode,
@@ -542,7 +544,7 @@ public:
     void draw_hole(WidgetLayout const& layout, quad const& box, draw_attributes const& attributes) const noexcept
     {
         return _override_alpha(
-            layout.clipping_rectangle_on_window(attributes.clipping_rectangle), layout.to_window3() * box, attributes);
+            _clipping_rectangle(layout, attributes.clipping_rectangle), _to_window3(layout) * box, attributes);
     }
 
     /** Make a hole in the user interface.
@@ -560,9 +562,40 @@ public:
         return draw_hole(layout, make_quad(box), draw_attributes{attributes...});
     }
 
+    /** Record the draw commands into a draw-list.
+     *
+     * The returned draw context does not draw into the vertex buffers. Instead
+     * the commands are added to the draw-list in the local coordinate system
+     * of the widget, so that the draw-list can be replayed using `draw()`.
+     *
+     * While recording the redraw region covers the whole window, so that
+     * the recorded commands do not depend on which part of the window is
+     * being redrawn.
+     *
+     * @param list The draw-list to record into, it is cleared first.
+     * @return A draw context which records into @a list.
+     */
+    [[nodiscard]] draw_context record(draw_list& list) const noexcept;
+
+    /** Replay the draw commands of a draw-list.
+     *
+     * @param layout The layout to use, specifically the to_window transformation matrix and the clipping rectangle.
+     * @param list The draw-list that was recorded by a widget with the same shape.
+     * @return True when all the images of the draw-list were drawn, false if an image is not ready yet.
+     */
+    template<std::same_as<widget_layout> WidgetLayout>
+    bool draw(WidgetLayout const& layout, draw_list const& list) const noexcept
+    {
+        hi_axiom(_recording == nullptr);
+        return _replay(layout.clipping_rectangle, layout.to_window3(), list);
+    }
+
     /** Checks if a widget's layout overlaps with the part of the window that is being drawn.
      *
-     * @param context The draw context which contains the scissor rectangle.
+     * Widgets that do not overlap with any of the rectangles of the redraw region
+     * should skip drawing altogether.
+     *
+     * @param context The draw context which contains the redraw region.
      * @param layout The layout of a widget which contains the rectangle where the widget is located
      *               on the window
      * @return True if the widget needs to draw into the context.
@@ -570,7 +603,12 @@ public:
     template<std::same_as<widget_layout> WidgetLayout>
     [[nodiscard]] friend bool overlaps(draw_context const& context, WidgetLayout const& layout) noexcept
     {
-        return overlaps(context.scissor_rectangle, layout.clipping_rectangle_on_window());
+        if (overlaps(context.redraw_region, layout.clipping_rectangle_on_window())) {
+            ++global_counter<"draw_context:widget">;
+            return true;
+        } else {
+            return false;
+        }
     }
 
 private:
@@ -579,6 +617,31 @@ private:
     vector_span<pipeline_SDF::vertex> *_sdf_vertices;
     vector_span<pipeline_alpha::vertex> *_alpha_vertices;
 
+    /** When not null, the draw commands are recorded into this list instead.
+     */
+    draw_list *_recording = nullptr;
+
+    /** Get the clipping rectangle for a draw command.
+     *
+     * While recording the clipping rectangle remains in local coordinates, it is
+     * intersected with the clipping rectangle of the layout during replay.
+     */
+    template<std::same_as<widget_layout> WidgetLayout>
+    [[nodiscard]] aarectangle _clipping_rectangle(WidgetLayout const& layout, aarectangle const& clipping_rectangle) const noexcept
+    {
+        return _recording ? clipping_rectangle : layout.clipping_rectangle_on_window(clipping_rectangle);
+    }
+
+    /** Get the transformation for a draw command.
+     *
+     * While recording the commands remain in local coordinates.
+     */
+    template<std::same_as<widget_layout> WidgetLayout>
+    [[nodiscard]] translate3 _to_window3(WidgetLayout const& layout) const noexcept
+    {
+        return _recording ? translate3{} : layout.to_window3();
+    }
+
     template<draw_quad_shape Shape>
     [[nodiscard]] constexpr static quad make_quad(Shape const& shape) noexcept
     {
@@ -694,6 +757,8 @@ private:
 
     [[nodiscard]] bool
     _draw_image(aarectangle const& clipping_rectangle, quad const& box, paged_image const& image) const noexcept;
+
+    bool _replay(aarectangle const& clipping_rectangle, translate3 const& to_window3, draw_list const& list) const noexcept;
 };
 
 }} // namespace hi::v1
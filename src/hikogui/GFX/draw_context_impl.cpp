@@ -3,26 +3,25 @@
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "draw_context.hpp"
+#include "draw_list.hpp"
 #include "pipeline_box_device_shared.hpp"
-#include "pipeline_image_device_shared.hpp"
-#include "pipeline_SDF_device_shared.hpp"
 #include "pipeline_alpha_device_shared.hpp"
 #include "paged_image.hpp"
-#include "gfx_device_vulkan.hpp"
+#include "gfx_device.hpp"
 #include "../text/module.hpp"
 #include "../macros.hpp"
 
 namespace hi::inline v1 {
 
 draw_context::draw_context(
-    gfx_device_vulkan& device,
+    gfx_device& device,
     vector_span<pipeline_box::vertex>& box_vertices,
     vector_span<pipeline_image::vertex>& image_vertices,
     vector_span<pipeline_SDF::vertex>& sdf_vertices,
     vector_span<pipeline_alpha::vertex>& alpha_vertices) noexcept :
     device(device),
     frame_buffer_index(std::numeric_limits<size_t>::max()),
-    scissor_rectangle(),
+    redraw_region(),
     _box_vertices(&box_vertices),
     _image_vertices(&image_vertices),
     _sdf_vertices(&sdf_vertices),
@@ -34,9 +33,56 @@ draw_context::draw_context(
     _alpha_vertices->clear();
 }
 
+[[nodiscard]] draw_context draw_context::record(draw_list& list) const noexcept
+{
+    list.clear();
+
+    auto r = *this;
+    r.redraw_region = aarectangle::large();
+    r._recording = &list;
+    return r;
+}
+
+bool draw_context::_replay(aarectangle const& clipping_rectangle, translate3 const& to_window3, draw_list const& list)
+    const noexcept
+{
+    hilet to_window = static_cast<translate2>(to_window3);
+
+    auto r = true;
+    for (hilet& command : list) {
+        std::visit(
+            [&]<typename Command>(Command const& c) {
+                hilet window_clipping_rectangle = to_window * intersect(clipping_rectangle, c.clipping_rectangle);
+                hilet window_box = to_window3 * c.box;
+
+                if constexpr (std::is_same_v<Command, draw_list::box_command>) {
+                    _draw_box(window_clipping_rectangle, window_box, c.attributes);
+                } else if constexpr (std::is_same_v<Command, draw_list::glyph_command>) {
+                    _draw_glyph(window_clipping_rectangle, window_box, c.glyph, draw_attributes{c.color});
+                } else if constexpr (std::is_same_v<Command, draw_list::image_command>) {
+                    r &= _draw_image(window_clipping_rectangle, window_box, *c.image);
+                } else if constexpr (std::is_same_v<Command, draw_list::hole_command>) {
+                    auto attributes = draw_attributes{};
+                    attributes.fill_color = quad_color{color{0.0f, 0.0f, 0.0f, c.alpha}};
+                    _override_alpha(window_clipping_rectangle, window_box, attributes);
+                } else {
+                    hi_static_no_default();
+                }
+            },
+            command);
+    }
+
+    global_counter<"draw_context:replay"> += list.size();
+    return r;
+}
+
 void draw_context::_override_alpha(aarectangle const& clipping_rectangle, quad box, draw_attributes const& attributes)
     const noexcept
 {
+    if (_recording != nullptr) {
+        return _recording->add_hole(clipping_rectangle, box, attributes.fill_color.p0.a());
+    }
+
     if (_alpha_vertices->full()) {
         // Too many boxes where added, just don't draw them anymore.
         ++global_counter<"override_alpha::overflow">;
@@ -48,6 +94,11 @@ void draw_context::_override_alpha(aarectangle const& clipping_rectangle, quad b
 
 void draw_context::_draw_box(aarectangle const& clipping_rectangle, quad box, draw_attributes const& attributes) const noexcept
 {
+    if (_recording != nullptr) {
+        // The border-side is applied during replay.
+        return _recording->add_box(clipping_rectangle, box, attributes);
+    }
+
     // clang-format off
     hilet border_radius = attributes.line_width * 0.5f;
     hilet box_ =
@@ -80,14 +131,18 @@ void draw_context::_draw_box(aarectangle const& clipping_rectangle, quad box, dr
 [[nodiscard]] bool
 draw_context::_draw_image(aarectangle const& clipping_rectangle, quad const& box, paged_image const& image) const noexcept
 {
+    if (_recording != nullptr) {
+        _recording->add_image(clipping_rectangle, box, image);
+        return image.state == paged_image::state_type::uploaded;
+    }
+
     hi_assert_not_null(_image_vertices);
 
     if (image.state != paged_image::state_type::uploaded) {
         return false;
     }
 
-    auto& pipeline = *down_cast<gfx_device_vulkan&>(device).image_pipeline;
-    pipeline.place_vertices(*_image_vertices, clipping_rectangle, box, image);
+    device.place_image_vertices(*_image_vertices, clipping_rectangle, box, image);
     return true;
 }
 
@@ -97,8 +152,11 @@ void draw_context::_draw_glyph(
     glyph_ids const& glyph,
     draw_attributes const& attributes) const noexcept
 {
+    if (_recording != nullptr) {
+        return _recording->add_glyph(clipping_rectangle, box, glyph, attributes.fill_color);
+    }
+
     hi_assert_not_null(_sdf_vertices);
-    auto& pipeline = *down_cast<gfx_device_vulkan&>(device).SDF_pipeline;
 
     if (_sdf_vertices->full()) {
         auto box_attributes = attributes;
@@ -108,10 +166,10 @@ void draw_context::_draw_glyph(
         return;
     }
 
-    hilet atlas_was_updated = pipeline.place_vertices(*_sdf_vertices, clipping_rectangle, box, glyph, attributes.fill_color);
+    hilet atlas_was_updated = device.place_glyph_vertices(*_sdf_vertices, clipping_rectangle, box, glyph, attributes.fill_color);
 
     if (atlas_was_updated) {
-        pipeline.prepare_atlas_for_rendering();
+        device.prepare_glyph_atlas_for_rendering();
     }
 }
 
@@ -121,8 +179,18 @@ void draw_context::_draw_text(
     text_shaper const& text,
     draw_attributes const& attributes) const noexcept
 {
+    if (_recording != nullptr) {
+        for (hilet& c : text) {
+            if (is_visible(c.general_category)) {
+                hilet box = translate2{c.position} * c.metrics.bounding_rectangle;
+                hilet color = attributes.num_colors > 0 ? attributes.fill_color : quad_color{c.style->color};
+                _recording->add_glyph(clipping_rectangle, transform * box, c.glyph, color);
+            }
+        }
+        return;
+    }
+
     hi_assert_not_null(_sdf_vertices);
-    auto& pipeline = *down_cast<gfx_device_vulkan&>(device).SDF_pipeline;
 
     auto atlas_was_updated = false;
     for (hilet& c : text) {
@@ -140,11 +208,11 @@ void draw_context::_draw_text(
             break;
         }
 
-        atlas_was_updated |= pipeline.place_vertices(*_sdf_vertices, clipping_rectangle, transform * box, c.glyph, color);
+        atlas_was_updated |= device.place_glyph_vertices(*_sdf_vertices, clipping_rectangle, transform * box, c.glyph, color);
     }
 
     if (atlas_was_updated) {
-        pipeline.prepare_atlas_for_rendering();
+        device.prepare_glyph_atlas_for_rendering();
     }
 }
 
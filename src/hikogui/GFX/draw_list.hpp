@@ -0,0 +1,148 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file GFX/draw_list.hpp Defines draw_list.
+ */
+
+#pragma once
+
+#include "draw_context.hpp"
+#include "../font/module.hpp"
+#include "../geometry/module.hpp"
+#include "../color/module.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <variant>
+#include <vector>
+#include <cstddef>
+
+namespace hi::inline v1 {
+struct paged_image;
+
+/** A list of draw commands recorded from a widget.
+ *
+ * The commands are stored in the local coordinate system of the widget,
+ * including the clipping rectangle of each command. When the list is replayed
+ * with `draw_context::draw()` the commands are transformed to window coordinates
+ * and clipped using the current layout of the widget.
+ *
+ * This allows a widget that has not changed, but was moved, scrolled or
+ * partially covered, to be redrawn without executing its `draw()` function.
+ */
+class draw_list {
+public:
+    struct box_command {
+        aarectangle clipping_rectangle;
+        quad box;
+        draw_attributes attributes;
+    };
+
+    struct glyph_command {
+        aarectangle clipping_rectangle;
+        quad box;
+        glyph_ids glyph;
+        quad_color color;
+    };
+
+    struct image_command {
+        aarectangle clipping_rectangle;
+        quad box;
+        paged_image const *image;
+    };
+
+    struct hole_command {
+        aarectangle clipping_rectangle;
+        quad box;
+        float alpha;
+    };
+
+    using value_type = std::variant<box_command, glyph_command, image_command, hole_command>;
+    using const_iterator = std::vector<value_type>::const_iterator;
+
+    constexpr draw_list() noexcept = default;
+    draw_list(draw_list const&) = default;
+    draw_list(draw_list&&) noexcept = default;
+    draw_list& operator=(draw_list const&) = default;
+    draw_list& operator=(draw_list&&) noexcept = default;
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _commands.empty();
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _commands.size();
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+        return _commands.begin();
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+        return _commands.end();
+    }
+
+    /** Remove all commands.
+     *
+     * The memory of the commands is retained, so that recording the same
+     * widget again does not need to allocate.
+     */
+    void clear() noexcept
+    {
+        _commands.clear();
+    }
+
+    /** Add a box.
+     *
+     * @param clipping_rectangle The clipping rectangle in local coordinates.
+     * @param box The box in local coordinates.
+     * @param attributes The attributes of the box, before the border-side is applied.
+     */
+    void add_box(aarectangle const& clipping_rectangle, quad const& box, draw_attributes const& attributes) noexcept
+    {
+        _commands.emplace_back(box_command{clipping_rectangle, box, attributes});
+    }
+
+    /** Add a glyph.
+     *
+     * @param clipping_rectangle The clipping rectangle in local coordinates.
+     * @param box The bounding box of the glyph in local coordinates.
+     * @param glyph The glyphs to draw.
+     * @param color The color of the glyph.
+     */
+    void add_glyph(aarectangle const& clipping_rectangle, quad const& box, glyph_ids const& glyph, quad_color const& color) noexcept
+    {
+        _commands.emplace_back(glyph_command{clipping_rectangle, box, glyph, color});
+    }
+
+    /** Add an image.
+     *
+     * @param clipping_rectangle The clipping rectangle in local coordinates.
+     * @param box The box in local coordinates.
+     * @param image The image, which must outlive the recorded list.
+     */
+    void add_image(aarectangle const& clipping_rectangle, quad const& box, paged_image const& image) noexcept
+    {
+        _commands.emplace_back(image_command{clipping_rectangle, box, std::addressof(image)});
+    }
+
+    /** Add a hole in the user interface.
+     *
+     * @param clipping_rectangle The clipping rectangle in local coordinates.
+     * @param box The box in local coordinates.
+     * @param alpha The alpha value to override.
+     */
+    void add_hole(aarectangle const& clipping_rectangle, quad const& box, float alpha) noexcept
+    {
+        _commands.emplace_back(hole_command{clipping_rectangle, box, alpha});
+    }
+
+private:
+    std::vector<value_type> _commands;
+};
+
+} // namespace hi::inline v1
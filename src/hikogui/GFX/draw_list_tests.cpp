@@ -0,0 +1,64 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "draw_list.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <variant>
+#include <vector>
+
+using namespace hi;
+
+TEST(draw_list, record)
+{
+    auto list = draw_list{};
+    ASSERT_TRUE(list.empty());
+
+    list.add_box(aarectangle::large(), aarectangle{0.0f, 0.0f, 10.0f, 5.0f}, draw_attributes{color::white(), 1.0f});
+    list.add_glyph(aarectangle{0.0f, 0.0f, 5.0f, 5.0f}, aarectangle{1.0f, 1.0f, 3.0f, 3.0f}, glyph_ids{}, color::black());
+    list.add_hole(aarectangle::large(), aarectangle{2.0f, 2.0f, 1.0f, 1.0f}, 0.5f);
+    ASSERT_EQ(list.size(), 3U);
+
+    auto it = list.begin();
+    ASSERT_TRUE(std::holds_alternative<draw_list::box_command>(*it));
+    hilet& box = std::get<draw_list::box_command>(*it);
+    ASSERT_EQ(box.attributes.line_width, 1.0f);
+    ASSERT_EQ(box.clipping_rectangle, aarectangle::large());
+
+    ++it;
+    ASSERT_TRUE(std::holds_alternative<draw_list::glyph_command>(*it));
+    hilet& glyph = std::get<draw_list::glyph_command>(*it);
+    ASSERT_EQ(glyph.clipping_rectangle, (aarectangle{0.0f, 0.0f, 5.0f, 5.0f}));
+    ASSERT_EQ(glyph.color.p0, color::black());
+
+    ++it;
+    ASSERT_TRUE(std::holds_alternative<draw_list::hole_command>(*it));
+    ASSERT_EQ(std::get<draw_list::hole_command>(*it).alpha, 0.5f);
+
+    ++it;
+    ASSERT_EQ(it, list.end());
+
+    list.clear();
+    ASSERT_TRUE(list.empty());
+}
+
+TEST(draw_list, record_2000_widgets)
+{
+    // The commands of a static window with 2000 widgets; each widget records
+    // its commands once, in its own local coordinate system.
+    auto lists = std::vector<draw_list>(2000);
+    for (auto& list : lists) {
+        list.add_box(aarectangle::large(), aarectangle{0.0f, 0.0f, 100.0f, 20.0f}, draw_attributes{color::white()});
+        for (auto i = 0; i != 10; ++i) {
+            hilet x = narrow_cast<float>(i) * 8.0f;
+            list.add_glyph(aarectangle::large(), aarectangle{x, 4.0f, 8.0f, 12.0f}, glyph_ids{}, color::black());
+        }
+    }
+
+    auto num_commands = 0_uz;
+    for (hilet& list : lists) {
+        num_commands += list.size();
+    }
+    ASSERT_EQ(num_commands, 2000U * 11U);
+}
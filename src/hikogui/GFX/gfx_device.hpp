@@ -6,19 +6,31 @@
 
 #include "gfx_system_globals.hpp"
 #include "gfx_surface.hpp"
+#include "pipeline_image_vertex.hpp"
+#include "pipeline_SDF_vertex.hpp"
+#include "../image/module.hpp"
+#include "../geometry/module.hpp"
+#include "../color/module.hpp"
+#include "../container/module.hpp"
 #include "../utility/utility.hpp"
 #include "../numeric/module.hpp"
 #include "../macros.hpp"
 #include <unordered_set>
 #include <mutex>
 #include <tuple>
+#include <vector>
 
 
 
 namespace hi::inline v1 {
 class gfx_system;
+class glyph_ids;
+struct paged_image;
 
 /*! A gfx_device that handles a set of windows.
+ *
+ * The device owns the glyph atlas and the image atlas that are shared by
+ * all the surfaces that are rendered by this device.
  */
 class gfx_device {
 public:
@@ -49,6 +61,65 @@ public:
     virtual int score(gfx_surface const &surface) const = 0;
 
     virtual void log_memory_usage() const noexcept {}
+
+    /** Allocate pages from the image atlas.
+     *
+     * @param num_pages The number of pages to allocate.
+     * @return The index of each allocated page.
+     */
+    [[nodiscard]] virtual std::vector<std::size_t> allocate_image_pages(std::size_t num_pages) noexcept = 0;
+
+    /** Deallocate pages back to the image atlas.
+     */
+    virtual void free_image_pages(std::vector<std::size_t> const& pages) noexcept = 0;
+
+    /** Get the staging pixel map of the image atlas to draw an image in.
+     *
+     * @param width The width of the image.
+     * @param height The height of the image.
+     * @return The pixel map to draw the image in, before calling `upload_image_staging_pixmap()`.
+     */
+    [[nodiscard]] virtual pixmap_span<sfloat_rgba16> get_image_staging_pixmap(std::size_t width, std::size_t height) noexcept = 0;
+
+    /** Copy the image from the staging pixel map into the pages of the image atlas.
+     */
+    virtual void upload_image_staging_pixmap(paged_image const& image) noexcept = 0;
+
+    /** Place vertices for a single image.
+     *
+     * @pre The image is uploaded.
+     * @param vertices The list of vertices to add to.
+     * @param clipping_rectangle The rectangle to clip the image.
+     * @param box The rectangle of the image in window coordinates.
+     * @param image The image to render.
+     */
+    virtual void place_image_vertices(
+        vector_span<pipeline_image::vertex>& vertices,
+        aarectangle const& clipping_rectangle,
+        quad const& box,
+        paged_image const& image) noexcept = 0;
+
+    /** Place vertices for a single glyph.
+     *
+     * The glyph is added to the glyph atlas when needed.
+     *
+     * @param vertices The list of vertices to add to.
+     * @param clipping_rectangle The rectangle to clip the glyph.
+     * @param box The rectangle of the glyph in window coordinates.
+     * @param glyphs The font-id, composed-glyphs to render
+     * @param colors The color of each corner of the glyph.
+     * @return True if the glyph atlas was updated.
+     */
+    virtual bool place_glyph_vertices(
+        vector_span<pipeline_SDF::vertex>& vertices,
+        aarectangle const& clipping_rectangle,
+        quad const& box,
+        glyph_ids const& glyphs,
+        quad_color colors) noexcept = 0;
+
+    /** Prepare the glyph atlas for rendering, after it was updated.
+     */
+    virtual void prepare_glyph_atlas_for_rendering() noexcept {}
 };
 
 } // namespace hi::inline v1
@@ -0,0 +1,97 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "gfx_device.hpp"
+#include "gfx_system_globals.hpp"
+#include "paged_image.hpp"
+#include "pipeline_image_device_shared.hpp"
+#include "pipeline_SDF_device_shared.hpp"
+#include "../font/module.hpp"
+#include "../image/module.hpp"
+#include "../macros.hpp"
+#include <vector>
+
+namespace hi::inline v1 {
+
+/** A gfx_device that renders on the CPU.
+ *
+ * The glyph atlas and image atlas are kept in main memory, in the same layout
+ * as the atlases of the Vulkan SDF and image pipelines, so that the vertices
+ * placed by `draw_context` can be rendered by a `gfx_rasterizer`.
+ *
+ * @note The location of a glyph in the atlas is stored with the glyph itself,
+ *       therefor the devices of a `gfx_system` must all be of the same type.
+ */
+class gfx_device_software final : public gfx_device {
+public:
+    gfx_device_software(gfx_system& system) noexcept;
+    ~gfx_device_software();
+
+    gfx_device_software(const gfx_device_software&) = delete;
+    gfx_device_software& operator=(const gfx_device_software&) = delete;
+    gfx_device_software(gfx_device_software&&) = delete;
+    gfx_device_software& operator=(gfx_device_software&&) = delete;
+
+    /** The images of the glyph atlas, to pass to `gfx_rasterizer::sdf_atlas`.
+     */
+    [[nodiscard]] std::vector<pixmap_span<sdf_r8 const>> glyph_atlas() const noexcept;
+
+    /** The images of the image atlas, to pass to `gfx_rasterizer::image_atlas`.
+     */
+    [[nodiscard]] std::vector<pixmap_span<sfloat_rgba16 const>> image_atlas() const noexcept;
+
+    int score(gfx_surface const& surface) const override;
+
+    void log_memory_usage() const noexcept override;
+
+    [[nodiscard]] std::vector<std::size_t> allocate_image_pages(std::size_t num_pages) noexcept override;
+    void free_image_pages(std::vector<std::size_t> const& pages) noexcept override;
+    [[nodiscard]] pixmap_span<sfloat_rgba16> get_image_staging_pixmap(std::size_t width, std::size_t height) noexcept override;
+    void upload_image_staging_pixmap(paged_image const& image) noexcept override;
+    void place_image_vertices(
+        vector_span<pipeline_image::vertex>& vertices,
+        aarectangle const& clipping_rectangle,
+        quad const& box,
+        paged_image const& image) noexcept override;
+    bool place_glyph_vertices(
+        vector_span<pipeline_SDF::vertex>& vertices,
+        aarectangle const& clipping_rectangle,
+        quad const& box,
+        glyph_ids const& glyphs,
+        quad_color colors) noexcept override;
+
+private:
+    std::vector<pixmap<sdf_r8>> _glyph_atlas;
+
+    /** The position in the glyph atlas where the next glyph is allocated.
+     */
+    point3 _glyph_allocation_position = {};
+
+    /** The height of the tallest glyph on the current row of the glyph atlas.
+     */
+    int _glyph_allocation_max_height = 0;
+
+    std::vector<pixmap<sfloat_rgba16>> _image_atlas;
+    std::vector<std::size_t> _image_atlas_free_pages;
+
+    /** The image is drawn in the staging pixmap with a 1 pixel border, before
+     * the pages are copied into the image atlas.
+     */
+    pixmap<sfloat_rgba16> _image_staging;
+
+    void add_glyph_atlas_image() noexcept;
+    void add_image_atlas_image() noexcept;
+
+    /** Allocate a rectangle in the glyph atlas.
+     */
+    [[nodiscard]] glyph_atlas_info allocate_glyph_rect(extent2 draw_extent, scale2 draw_scale) noexcept;
+
+    /** Draw the signed-distance-field of a glyph into the glyph atlas.
+     */
+    void add_glyph_to_atlas(glyph_ids const& glyph, glyph_atlas_info& info) noexcept;
+};
+
+} // namespace hi::inline v1
@@ -0,0 +1,281 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gfx_device_software.hpp"
+#include "gfx_surface_software.hpp"
+#include "../graphic_path/graphic_path.hpp"
+#include "../telemetry/module.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <algorithm>
+
+namespace hi::inline v1 {
+
+gfx_device_software::gfx_device_software(gfx_system& system) noexcept :
+    gfx_device(system),
+    _image_staging(
+        pipeline_image::device_shared::staging_image_width,
+        pipeline_image::device_shared::staging_image_height)
+{
+    deviceName = "software rasterizer";
+
+    // There needs to be at least one atlas image, like on the Vulkan device.
+    add_glyph_atlas_image();
+    add_image_atlas_image();
+}
+
+gfx_device_software::~gfx_device_software() {}
+
+[[nodiscard]] std::vector<pixmap_span<sdf_r8 const>> gfx_device_software::glyph_atlas() const noexcept
+{
+    auto r = std::vector<pixmap_span<sdf_r8 const>>{};
+    r.reserve(_glyph_atlas.size());
+    for (hilet& image : _glyph_atlas) {
+        r.emplace_back(image);
+    }
+    return r;
+}
+
+[[nodiscard]] std::vector<pixmap_span<sfloat_rgba16 const>> gfx_device_software::image_atlas() const noexcept
+{
+    auto r = std::vector<pixmap_span<sfloat_rgba16 const>>{};
+    r.reserve(_image_atlas.size());
+    for (hilet& image : _image_atlas) {
+        r.emplace_back(image);
+    }
+    return r;
+}
+
+int gfx_device_software::score(gfx_surface const& surface) const
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+    // Any software surface can be rendered, with the lowest score of a presentable device.
+    return dynamic_cast<gfx_surface_software const *>(&surface) != nullptr ? 1 : -1;
+}
+
+void gfx_device_software::log_memory_usage() const noexcept
+{
+    hi_log_info("Memory usage for gfx device {}:", string());
+    hi_log_info(
+        " * glyph atlas: {} images of {} bytes",
+        _glyph_atlas.size(),
+        pipeline_SDF::device_shared::atlasImageWidth * pipeline_SDF::device_shared::atlasImageHeight * sizeof(sdf_r8));
+    hi_log_info(
+        " * image atlas: {} images of {} bytes",
+        _image_atlas.size(),
+        pipeline_image::device_shared::atlas_image_axis_size * pipeline_image::device_shared::atlas_image_axis_size *
+            sizeof(sfloat_rgba16));
+}
+
+void gfx_device_software::add_glyph_atlas_image() noexcept
+{
+    auto image = pixmap<sdf_r8>{
+        narrow_cast<std::size_t>(pipeline_SDF::device_shared::atlasImageWidth),
+        narrow_cast<std::size_t>(pipeline_SDF::device_shared::atlasImageHeight)};
+
+    // Same as the clear value of the Vulkan atlas; the maximum distance outside of a glyph.
+    fill(image, sdf_r8{-sdf_r8::max_distance});
+    _glyph_atlas.push_back(std::move(image));
+}
+
+[[nodiscard]] glyph_atlas_info gfx_device_software::allocate_glyph_rect(extent2 draw_extent, scale2 draw_scale) noexcept
+{
+    using pipeline_SDF::device_shared;
+
+    auto image_width = ceil_cast<int>(draw_extent.width());
+    auto image_height = ceil_cast<int>(draw_extent.height());
+
+    // Check if the glyph still fits in the same line of glyphs.
+    // Otherwise go to the next line.
+    if (_glyph_allocation_position.x() + image_width > device_shared::atlasImageWidth) {
+        _glyph_allocation_position.x() = 0;
+        _glyph_allocation_position.y() = _glyph_allocation_position.y() + _glyph_allocation_max_height;
+        _glyph_allocation_max_height = 0;
+    }
+
+    // Check if the glyph still fits in the image.
+    // Otherwise allocate a new image.
+    if (_glyph_allocation_position.y() + image_height > device_shared::atlasImageHeight) {
+        _glyph_allocation_position.x() = 0;
+        _glyph_allocation_position.y() = 0;
+        _glyph_allocation_position.z() = _glyph_allocation_position.z() + 1;
+        _glyph_allocation_max_height = 0;
+
+        if (_glyph_allocation_position.z() >= device_shared::atlasMaximumNrImages) {
+            hi_log_fatal("gfx_device_software glyph atlas overflow, too many glyphs in use.");
+        }
+
+        if (_glyph_allocation_position.z() >= _glyph_atlas.size()) {
+            add_glyph_atlas_image();
+        }
+    }
+
+    auto r = glyph_atlas_info{
+        _glyph_allocation_position, draw_extent, draw_scale, scale2{device_shared::atlasTextureCoordinateMultiplier}};
+    _glyph_allocation_position.x() = _glyph_allocation_position.x() + image_width;
+    _glyph_allocation_max_height = std::max(_glyph_allocation_max_height, image_height);
+    return r;
+}
+
+void gfx_device_software::add_glyph_to_atlas(glyph_ids const& glyph, glyph_atlas_info& info) noexcept
+{
+    using pipeline_SDF::device_shared;
+
+    hilet[glyph_path, glyph_bounding_box] = glyph.get_path_and_bounding_box();
+
+    hilet draw_scale = scale2{device_shared::drawfontSize, device_shared::drawfontSize};
+    hilet draw_bounding_box = draw_scale * glyph_bounding_box;
+
+    // Like the Vulkan SDF pipeline, the glyph is drawn at a fixed size with a border
+    // for bi-linear interpolation on the edges.
+    hilet draw_offset = point2{device_shared::drawBorder, device_shared::drawBorder} - get<0>(draw_bounding_box);
+    hilet draw_extent = draw_bounding_box.size() + 2.0f * device_shared::drawBorder;
+    hilet image_size = ceil(draw_extent);
+
+    hilet draw_path = (translate2{draw_offset} * draw_scale) * glyph_path;
+
+    // The glyph is drawn directly in the atlas, there is no need for a staging pixmap.
+    hilet lock = std::scoped_lock(gfx_system_mutex);
+    info = allocate_glyph_rect(image_size, image_size / draw_bounding_box.size());
+
+    auto atlas = pixmap_span<sdf_r8>{_glyph_atlas.at(floor_cast<std::size_t>(info.position.z()))};
+    auto pixmap = atlas.subimage(
+        floor_cast<std::size_t>(info.position.x()),
+        floor_cast<std::size_t>(info.position.y()),
+        ceil_cast<std::size_t>(info.size.width()),
+        ceil_cast<std::size_t>(info.size.height()));
+    fill(pixmap, draw_path);
+}
+
+bool gfx_device_software::place_glyph_vertices(
+    vector_span<pipeline_SDF::vertex>& vertices,
+    aarectangle const& clipping_rectangle,
+    quad const& box,
+    glyph_ids const& glyphs,
+    quad_color colors) noexcept
+{
+    auto& atlas_rect = glyphs.atlas_info();
+    auto glyph_was_added = false;
+    if (not atlas_rect) {
+        add_glyph_to_atlas(glyphs, atlas_rect);
+        glyph_was_added = true;
+    }
+
+    hilet box_with_border = scale_from_center(box, atlas_rect.border_scale);
+
+    auto image_index = atlas_rect.position.z();
+    auto t0 = point3(get<0>(atlas_rect.texture_coordinates), image_index);
+    auto t1 = point3(get<1>(atlas_rect.texture_coordinates), image_index);
+    auto t2 = point3(get<2>(atlas_rect.texture_coordinates), image_index);
+    auto t3 = point3(get<3>(atlas_rect.texture_coordinates), image_index);
+
+    vertices.emplace_back(box_with_border.p0, clipping_rectangle, t0, colors.p0);
+    vertices.emplace_back(box_with_border.p1, clipping_rectangle, t1, colors.p1);
+    vertices.emplace_back(box_with_border.p2, clipping_rectangle, t2, colors.p2);
+    vertices.emplace_back(box_with_border.p3, clipping_rectangle, t3, colors.p3);
+    return glyph_was_added;
+}
+
+void gfx_device_software::add_image_atlas_image() noexcept
+{
+    using pipeline_image::device_shared;
+
+    hilet current_image_index = _image_atlas.size();
+    if (current_image_index >= device_shared::atlas_maximum_num_images) {
+        hi_log_fatal("gfx_device_software image atlas overflow, too many images in use.");
+    }
+
+    // A new image is transparent-black.
+    _image_atlas.emplace_back(device_shared::atlas_image_axis_size, device_shared::atlas_image_axis_size);
+
+    // Add pages for this image to free list.
+    hilet page_offset = current_image_index * device_shared::atlas_num_pages_per_image;
+    for (auto i = 0_uz; i != device_shared::atlas_num_pages_per_image; ++i) {
+        _image_atlas_free_pages.push_back(page_offset + i);
+    }
+}
+
+std::vector<std::size_t> gfx_device_software::allocate_image_pages(std::size_t num_pages) noexcept
+{
+    while (num_pages > _image_atlas_free_pages.size()) {
+        add_image_atlas_image();
+    }
+
+    auto r = std::vector<std::size_t>();
+    for (auto i = 0_uz; i != num_pages; ++i) {
+        r.push_back(_image_atlas_free_pages.back());
+        _image_atlas_free_pages.pop_back();
+    }
+    return r;
+}
+
+void gfx_device_software::free_image_pages(std::vector<std::size_t> const& pages) noexcept
+{
+    _image_atlas_free_pages.insert(_image_atlas_free_pages.end(), pages.begin(), pages.end());
+}
+
+pixmap_span<sfloat_rgba16> gfx_device_software::get_image_staging_pixmap(std::size_t width, std::size_t height) noexcept
+{
+    // The image is drawn inside the 1 pixel border.
+    return pixmap_span<sfloat_rgba16>{_image_staging}.subimage(1, 1, width, height);
+}
+
+void gfx_device_software::upload_image_staging_pixmap(paged_image const& image) noexcept
+{
+    constexpr auto page_stride = paged_image::page_size + 2;
+
+    hilet border_right = image.width + 2;
+    hilet border_top = image.height + 2;
+    hilet upload_right = ceil(image.width, paged_image::page_size) + 2;
+    hilet upload_top = ceil(image.height, paged_image::page_size) + 2;
+    hi_assert(upload_right <= _image_staging.width());
+    hi_assert(upload_top <= _image_staging.height());
+
+    // Copy the color of the edge of the image into the border, with the alpha channel set to zero.
+    // This makes the bi-linear interpolation at the edge of the image the same as the GPU.
+    for (auto x = 1_uz; x != border_right - 1; ++x) {
+        _image_staging(x, 0) = make_transparent(_image_staging(x, 1));
+        _image_staging(x, border_top - 1) = make_transparent(_image_staging(x, border_top - 2));
+    }
+    for (auto y = 0_uz; y != border_top; ++y) {
+        _image_staging(0, y) = make_transparent(_image_staging(1, y));
+        _image_staging(border_right - 1, y) = make_transparent(_image_staging(border_right - 2, y));
+    }
+
+    // Clear the staging pixmap between the border and the edges of the pages.
+    for (auto y = 0_uz; y != upload_top; ++y) {
+        for (auto x = y < border_top ? border_right : 0_uz; x != upload_right; ++x) {
+            _image_staging(x, y) = {};
+        }
+    }
+
+    // Copy each page including its 1 pixel border into the atlas.
+    hilet staging = pixmap_span<sfloat_rgba16 const>{_image_staging};
+    hilet width_in_pages = (image.width + paged_image::page_size - 1) / paged_image::page_size;
+    for (auto index = 0_uz; index != image.pages.size(); ++index) {
+        hilet src_x = (index % width_in_pages) * paged_image::page_size;
+        hilet src_y = (index / width_in_pages) * paged_image::page_size;
+
+        hilet dst_position = pipeline_image::device_shared::get_atlas_position(image.pages[index]);
+        hilet dst_x = floor_cast<std::size_t>(dst_position.x() - 1.0f);
+        hilet dst_y = floor_cast<std::size_t>(dst_position.y() - 1.0f);
+        auto& atlas = _image_atlas.at(floor_cast<std::size_t>(dst_position.z()));
+
+        copy(
+            staging.subimage(src_x, src_y, page_stride, page_stride),
+            pixmap_span<sfloat_rgba16>{atlas}.subimage(dst_x, dst_y, page_stride, page_stride));
+    }
+}
+
+void gfx_device_software::place_image_vertices(
+    vector_span<pipeline_image::vertex>& vertices,
+    aarectangle const& clipping_rectangle,
+    quad const& box,
+    paged_image const& image) noexcept
+{
+    pipeline_image::device_shared::place_vertices(vertices, clipping_rectangle, box, image);
+}
+
+} // namespace hi::inline v1
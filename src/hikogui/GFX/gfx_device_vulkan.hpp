@@ -110,6 +110,23 @@ public:
 
     int score(gfx_surface const &surface) const override;
 
+    [[nodiscard]] std::vector<std::size_t> allocate_image_pages(std::size_t num_pages) noexcept override;
+    void free_image_pages(std::vector<std::size_t> const& pages) noexcept override;
+    [[nodiscard]] pixmap_span<sfloat_rgba16> get_image_staging_pixmap(std::size_t width, std::size_t height) noexcept override;
+    void upload_image_staging_pixmap(paged_image const& image) noexcept override;
+    void place_image_vertices(
+        vector_span<pipeline_image::vertex>& vertices,
+        aarectangle const& clipping_rectangle,
+        quad const& box,
+        paged_image const& image) noexcept override;
+    bool place_glyph_vertices(
+        vector_span<pipeline_SDF::vertex>& vertices,
+        aarectangle const& clipping_rectangle,
+        quad const& box,
+        glyph_ids const& glyphs,
+        quad_color colors) noexcept override;
+    void prepare_glyph_atlas_for_rendering() noexcept override;
+
     /*! Find the minimum number of queue families to instantiate for a window.
      * This will give priority for having the Graphics and Present in the same
      * queue family.
@@ -7,6 +7,8 @@
 #include "gfx_surface_vulkan.hpp"
 #include "pipeline_image.hpp"
 #include "pipeline_image_device_shared.hpp"
+#include "pipeline_SDF_device_shared.hpp"
+#include "paged_image.hpp"
 #include "../file/file.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
@@ -499,6 +501,50 @@ int gfx_device_vulkan::score(gfx_surface const& surface) const
     return total_score;
 }
 
+std::vector<std::size_t> gfx_device_vulkan::allocate_image_pages(std::size_t num_pages) noexcept
+{
+    return image_pipeline->allocate_pages(num_pages);
+}
+
+void gfx_device_vulkan::free_image_pages(std::vector<std::size_t> const& pages) noexcept
+{
+    image_pipeline->free_pages(pages);
+}
+
+pixmap_span<sfloat_rgba16> gfx_device_vulkan::get_image_staging_pixmap(std::size_t width, std::size_t height) noexcept
+{
+    return image_pipeline->get_staging_pixmap(width, height);
+}
+
+void gfx_device_vulkan::upload_image_staging_pixmap(paged_image const& image) noexcept
+{
+    image_pipeline->update_atlas_with_staging_pixmap(image);
+}
+
+void gfx_device_vulkan::place_image_vertices(
+    vector_span<pipeline_image::vertex>& vertices,
+    aarectangle const& clipping_rectangle,
+    quad const& box,
+    paged_image const& image) noexcept
+{
+    pipeline_image::device_shared::place_vertices(vertices, clipping_rectangle, box, image);
+}
+
+bool gfx_device_vulkan::place_glyph_vertices(
+    vector_span<pipeline_SDF::vertex>& vertices,
+    aarectangle const& clipping_rectangle,
+    quad const& box,
+    glyph_ids const& glyphs,
+    quad_color colors) noexcept
+{
+    return SDF_pipeline->place_vertices(vertices, clipping_rectangle, box, glyphs, colors);
+}
+
+void gfx_device_vulkan::prepare_glyph_atlas_for_rendering() noexcept
+{
+    SDF_pipeline->prepare_atlas_for_rendering();
+}
+
 std::vector<vk::DeviceQueueCreateInfo> gfx_device_vulkan::make_device_queue_create_infos() const noexcept
 {
     hilet default_queue_priority = std::array{1.0f};
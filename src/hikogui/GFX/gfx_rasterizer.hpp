@@ -0,0 +1,205 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "pipeline_box_vertex.hpp"
+#include "pipeline_image_vertex.hpp"
+#include "pipeline_SDF_vertex.hpp"
+#include "pipeline_alpha_vertex.hpp"
+#include "../image/module.hpp"
+#include "../SIMD/module.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <vector>
+#include <array>
+#include <thread>
+#include <cstdint>
+
+namespace hi { inline namespace v1 {
+namespace detail {
+
+/** The setup of a quad for rasterization.
+ *
+ * A quad is drawn as the two triangles (0, 1, 2) and (2, 1, 3), the same as
+ * the quad index buffer used by the Vulkan pipelines.
+ */
+struct gfx_rasterizer_quad {
+    /** The barycentric weights of the vertices of each triangle are calculated
+     * as `a * x + b * y + c`. The fourth element is always 1.
+     */
+    std::array<f32x4, 2> a;
+    std::array<f32x4, 2> b;
+    std::array<f32x4, 2> c;
+
+    /** Which edges include pixels exactly on the edge, bit 3 is always set.
+     *
+     * This makes sure that a pixel on an edge shared between two triangles
+     * is drawn exactly once.
+     */
+    std::array<std::size_t, 2> tie_mask;
+
+    /** The pixels that may be covered by this quad, after clipping.
+     */
+    int32_t left;
+    int32_t bottom;
+    int32_t right;
+    int32_t top;
+
+    /** Setup a quad.
+     *
+     * @param p0 The position of the first vertex in window coordinates.
+     * @param p1 The position of the second vertex in window coordinates.
+     * @param p2 The position of the third vertex in window coordinates.
+     * @param p3 The position of the fourth vertex in window coordinates.
+     * @param clipping_rectangle The clipping rectangle (left, bottom, right, top) in window coordinates.
+     * @param width The width of the image.
+     * @param height The height of the image.
+     */
+    gfx_rasterizer_quad(
+        f32x4 p0,
+        f32x4 p1,
+        f32x4 p2,
+        f32x4 p3,
+        f32x4 clipping_rectangle,
+        std::size_t width,
+        std::size_t height) noexcept;
+
+    /** Check if the quad covers any pixels.
+     */
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return left >= right or bottom >= top;
+    }
+
+    /** Get the barycentric weights of the pixel.
+     *
+     * @param x The x coordinate of the center of the pixel.
+     * @param y The y coordinate of the center of the pixel.
+     * @return The triangle index 0 or 1, and the weights of the vertices of the triangle;
+     *         or -1 when the pixel is outside the quad.
+     */
+    [[nodiscard]] std::pair<int, f32x4> weights(float x, float y) const noexcept
+    {
+        for (auto i = 0; i != 2; ++i) {
+            hilet w = a[i] * x + b[i] * y + c[i];
+            if (((w > 0.0f).mask() | ((w >= 0.0f).mask() & tie_mask[i])) == 0b1111) {
+                return {i, w};
+            }
+        }
+        return {-1, f32x4{}};
+    }
+};
+
+/** Convert coverage to a perceptional uniform alpha.
+ *
+ * This is the same function as `coverage_to_alpha()` in the shaders.
+ */
+[[nodiscard]] inline f32x4 gfx_rasterizer_coverage_to_alpha(f32x4 coverage, f32x4 sqrt_foreground) noexcept
+{
+    hilet coverage_sq = coverage * coverage;
+    hilet coverage_2 = coverage + coverage;
+    return coverage_2 - coverage_sq + (coverage_sq - (coverage_2 - coverage_sq)) * sqrt_foreground;
+}
+
+/** Convert RGB to Y.
+ */
+[[nodiscard]] inline float gfx_rasterizer_rgb_to_y(f32x4 color) noexcept
+{
+    return color.x() * 0.2126f + color.y() * 0.7152f + color.z() * 0.0722f;
+}
+
+/** Multiply the alpha with the color.
+ */
+[[nodiscard]] inline f32x4 gfx_rasterizer_multiply_alpha(f32x4 color) noexcept
+{
+    return f32x4{color.x() * color.w(), color.y() * color.w(), color.z() * color.w(), color.w()};
+}
+
+} // namespace detail
+
+/** A software rasterizer for the vertices of a draw_context.
+ *
+ * The rasterizer renders the same vertices as the Vulkan box, image, SDF and
+ * alpha pipelines, in the order of the sub-passes of the Vulkan render pass,
+ * followed by the tone mapper. It is a reference implementation of the
+ * pipelines, for testing the shader math and for rendering vertices that
+ * were recorded from a draw_context into an image.
+ *
+ * Windows are rendered with it by `gfx_surface_software`, which passes the
+ * glyph and image atlases of `gfx_device_software` in `sdf_atlas` and `image_atlas`.
+ *
+ * The image is split into tiles of `tile_size` x `tile_size` pixels, the quads
+ * are binned per tile and the tiles are rendered in parallel on the threads of
+ * `thread_pool::global()`. The colors of each pixel are calculated with SIMD
+ * over the color channels.
+ *
+ * Like the window coordinates, row zero of the image is the bottom row.
+ */
+class gfx_rasterizer {
+public:
+    constexpr static std::size_t tile_size = 64;
+
+    /** The images of the glyph atlas used by the SDF pipeline.
+     */
+    std::vector<pixmap_span<sdf_r8 const>> sdf_atlas;
+
+    /** The images of the atlas used by the image pipeline.
+     */
+    std::vector<pixmap_span<sfloat_rgba16 const>> image_atlas;
+
+    /** The saturation of the user interface, used when the window is inactive.
+     */
+    float saturation = 1.0f;
+
+    /** Create a rasterizer.
+     *
+     * @param num_threads The maximum number of threads used for rendering, including the calling thread.
+     *                    The threads are taken from `thread_pool::global()`.
+     */
+    explicit gfx_rasterizer(std::size_t num_threads = std::thread::hardware_concurrency()) noexcept :
+        _num_threads(std::max(num_threads, 1_uz))
+    {
+    }
+
+    /** Render the vertices into an image.
+     *
+     * The rendering duration is recorded in the "gfx_rasterizer::render" counter.
+     *
+     * @param image The image to render into.
+     * @param clear_color The color to clear the image with, before rendering.
+     * @param box_vertices The vertices for the box pipeline, 4 vertices per quad.
+     * @param image_vertices The vertices for the image pipeline, 4 vertices per quad.
+     * @param sdf_vertices The vertices for the SDF pipeline, 4 vertices per quad.
+     * @param alpha_vertices The vertices for the alpha pipeline, 4 vertices per quad.
+     */
+    void render(
+        pixmap_span<sfloat_rgba16> image,
+        f32x4 clear_color,
+        std::span<pipeline_box::vertex const> box_vertices,
+        std::span<pipeline_image::vertex const> image_vertices,
+        std::span<pipeline_SDF::vertex const> sdf_vertices,
+        std::span<pipeline_alpha::vertex const> alpha_vertices) noexcept;
+
+private:
+    /** The quads that overlap a tile.
+     */
+    struct tile_bin {
+        std::vector<uint32_t> box;
+        std::vector<uint32_t> image;
+        std::vector<uint32_t> sdf;
+        std::vector<uint32_t> alpha;
+    };
+
+    std::size_t _num_threads;
+
+    std::vector<detail::gfx_rasterizer_quad> _box_quads;
+    std::vector<detail::gfx_rasterizer_quad> _image_quads;
+    std::vector<detail::gfx_rasterizer_quad> _sdf_quads;
+    std::vector<detail::gfx_rasterizer_quad> _alpha_quads;
+    std::vector<tile_bin> _bins;
+};
+
+}} // namespace hi::v1
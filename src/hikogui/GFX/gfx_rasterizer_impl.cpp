@@ -0,0 +1,545 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gfx_rasterizer.hpp"
+#include "../telemetry/module.hpp"
+#include "../concurrency/concurrency.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <atomic>
+#include <algorithm>
+#include <cmath>
+#include <optional>
+
+namespace hi { inline namespace v1 {
+namespace detail {
+
+gfx_rasterizer_quad::gfx_rasterizer_quad(
+    f32x4 p0,
+    f32x4 p1,
+    f32x4 p2,
+    f32x4 p3,
+    f32x4 clipping_rectangle,
+    std::size_t width,
+    std::size_t height) noexcept
+{
+    hilet positions = std::array{p0, p1, p2, p3};
+    constexpr auto triangles = std::array{std::array{0, 1, 2}, std::array{2, 1, 3}};
+
+    for (auto t = 0_uz; t != 2; ++t) {
+        hilet& v0 = positions[triangles[t][0]];
+        hilet& v1 = positions[triangles[t][1]];
+        hilet& v2 = positions[triangles[t][2]];
+        hilet vertices = std::array{v0, v1, v2};
+
+        a[t] = f32x4{};
+        b[t] = f32x4{};
+        c[t] = f32x4{0.0f, 0.0f, 0.0f, 1.0f};
+        tie_mask[t] = 0b1000;
+
+        // Twice the signed area of the triangle.
+        hilet area = (v1.x() - v0.x()) * (v2.y() - v0.y()) - (v2.x() - v0.x()) * (v1.y() - v0.y());
+        if (area == 0.0f) {
+            // A degenerate triangle does not cover any pixels.
+            c[t].w() = -1.0f;
+            continue;
+        }
+
+        hilet inv_area = 1.0f / area;
+        for (auto i = 0_uz; i != 3; ++i) {
+            // The weight of a vertex is the distance from the opposite edge.
+            hilet& vj = vertices[(i + 1) % 3];
+            hilet& vk = vertices[(i + 2) % 3];
+
+            hilet edge_a = vj.y() - vk.y();
+            hilet edge_b = vk.x() - vj.x();
+            hilet edge_c = -(edge_a * vj.x() + edge_b * vj.y());
+
+            a[t][i] = edge_a * inv_area;
+            b[t][i] = edge_b * inv_area;
+            c[t][i] = edge_c * inv_area;
+
+            // Of two triangles sharing an edge only one will include the pixels on that edge.
+            if (a[t][i] > 0.0f or (a[t][i] == 0.0f and b[t][i] > 0.0f)) {
+                tie_mask[t] |= 1_uz << i;
+            }
+        }
+    }
+
+    hilet min_p = min(min(p0, p1), min(p2, p3));
+    hilet max_p = max(max(p0, p1), max(p2, p3));
+
+    hilet width_ = narrow_cast<float>(width);
+    hilet height_ = narrow_cast<float>(height);
+
+    // A pixel is covered when its center is inside the quad and inside the clipping rectangle:
+    //  - left <= x + 0.5 < right
+    //  - bottom <= y + 0.5 < top
+    hilet left_ = std::max(std::ceil(min_p.x() - 0.5f), std::ceil(clipping_rectangle.x() - 0.5f));
+    hilet bottom_ = std::max(std::ceil(min_p.y() - 0.5f), std::ceil(clipping_rectangle.y() - 0.5f));
+    hilet right_ = std::min(std::floor(max_p.x() - 0.5f) + 1.0f, std::ceil(clipping_rectangle.z() - 0.5f));
+    hilet top_ = std::min(std::floor(max_p.y() - 0.5f) + 1.0f, std::ceil(clipping_rectangle.w() - 0.5f));
+
+    left = narrow_cast<int32_t>(std::clamp(left_, 0.0f, width_));
+    bottom = narrow_cast<int32_t>(std::clamp(bottom_, 0.0f, height_));
+    right = narrow_cast<int32_t>(std::clamp(right_, 0.0f, width_));
+    top = narrow_cast<int32_t>(std::clamp(top_, 0.0f, height_));
+}
+
+} // namespace detail
+
+namespace {
+
+/** The vertices of the two triangles of a quad.
+ */
+constexpr auto gfx_rasterizer_triangles = std::array{std::array{0_uz, 1_uz, 2_uz}, std::array{2_uz, 1_uz, 3_uz}};
+
+/** Interpolate an attribute of the vertices of a triangle.
+ *
+ * @param vertices The 4 vertices of a quad.
+ * @param triangle The triangle of the quad.
+ * @param w The barycentric weights of the vertices of the triangle.
+ * @param get_attribute A function that returns the attribute of a vertex.
+ */
+template<typename Vertex, typename GetAttribute>
+[[nodiscard]] hi_force_inline f32x4
+interpolate(Vertex const *vertices, int triangle, f32x4 w, GetAttribute const& get_attribute) noexcept
+{
+    hilet& indices = gfx_rasterizer_triangles[triangle];
+    return get_attribute(vertices[indices[0]]) * w.x() + get_attribute(vertices[indices[1]]) * w.y() +
+        get_attribute(vertices[indices[2]]) * w.z();
+}
+
+/** Get the provoking vertex of a triangle, used for flat attributes.
+ */
+template<typename Vertex>
+[[nodiscard]] hi_force_inline Vertex const& provoking_vertex(Vertex const *vertices, int triangle) noexcept
+{
+    return vertices[gfx_rasterizer_triangles[triangle][0]];
+}
+
+[[nodiscard]] hi_force_inline f32x4 to_f32x4(sfloat_rgba16 const& rhs) noexcept
+{
+    return f32x4{static_cast<f16x4>(rhs)};
+}
+
+/** Sample a signed distance field with bilinear filtering.
+ *
+ * @param image The signed distance field.
+ * @param x The horizontal coordinate in texels, where 0.0 is the center of the first column.
+ * @param y The vertical coordinate in texels, where 0.0 is the center of the first row.
+ */
+[[nodiscard]] float sample_bilinear(pixmap_span<sdf_r8 const> image, float x, float y) noexcept
+{
+    x = std::clamp(x, 0.0f, narrow_cast<float>(image.width() - 1));
+    y = std::clamp(y, 0.0f, narrow_cast<float>(image.height() - 1));
+
+    hilet x0 = narrow_cast<std::size_t>(x);
+    hilet y0 = narrow_cast<std::size_t>(y);
+    hilet x1 = std::min(x0 + 1, image.width() - 1);
+    hilet y1 = std::min(y0 + 1, image.height() - 1);
+    hilet fx = x - narrow_cast<float>(x0);
+    hilet fy = y - narrow_cast<float>(y0);
+
+    hilet row0 = image[y0];
+    hilet row1 = image[y1];
+    hilet bottom = std::lerp(static_cast<float>(row0[x0]), static_cast<float>(row0[x1]), fx);
+    hilet top = std::lerp(static_cast<float>(row1[x0]), static_cast<float>(row1[x1]), fx);
+    return std::lerp(bottom, top, fy);
+}
+
+/** Sample an image with bilinear filtering.
+ *
+ * @param image The image with pre-multiplied alpha.
+ * @param x The horizontal coordinate in texels, where 0.0 is the center of the first column.
+ * @param y The vertical coordinate in texels, where 0.0 is the center of the first row.
+ */
+[[nodiscard]] f32x4 sample_bilinear(pixmap_span<sfloat_rgba16 const> image, float x, float y) noexcept
+{
+    x = std::clamp(x, 0.0f, narrow_cast<float>(image.width() - 1));
+    y = std::clamp(y, 0.0f, narrow_cast<float>(image.height() - 1));
+
+    hilet x0 = narrow_cast<std::size_t>(x);
+    hilet y0 = narrow_cast<std::size_t>(y);
+    hilet x1 = std::min(x0 + 1, image.width() - 1);
+    hilet y1 = std::min(y0 + 1, image.height() - 1);
+    hilet fx = f32x4::broadcast(x - narrow_cast<float>(x0));
+    hilet fy = f32x4::broadcast(y - narrow_cast<float>(y0));
+
+    hilet row0 = image[y0];
+    hilet row1 = image[y1];
+    hilet p00 = to_f32x4(row0[x0]);
+    hilet p01 = to_f32x4(row0[x1]);
+    hilet p10 = to_f32x4(row1[x0]);
+    hilet p11 = to_f32x4(row1[x1]);
+    hilet bottom = p00 + (p01 - p00) * fx;
+    hilet top = p10 + (p11 - p10) * fx;
+    return bottom + (top - bottom) * fy;
+}
+
+/** The distance of a fragment from the outline of a box.
+ *
+ * This is the same function as `distance_from_box_outline()` in the box fragment shader.
+ *
+ * @param d The distance from the left, bottom, right and top edges.
+ * @param r The radius of the bottom-left, bottom-right, top-left and top-right corners.
+ */
+[[nodiscard]] float distance_from_box_outline(f32x4 d, f32x4 r) noexcept
+{
+    hilet corner_distance = [](float x, float y, float radius) {
+        return radius - std::hypot(radius - x, radius - y);
+    };
+
+    if (d.x() < r.x() and d.y() < r.x()) {
+        return corner_distance(d.x(), d.y(), r.x());
+    } else if (d.z() < r.y() and d.y() < r.y()) {
+        return corner_distance(d.z(), d.y(), r.y());
+    } else if (d.x() < r.z() and d.w() < r.z()) {
+        return corner_distance(d.x(), d.w(), r.z());
+    } else if (d.z() < r.w() and d.w() < r.w()) {
+        return corner_distance(d.z(), d.w(), r.w());
+    } else {
+        return std::min(std::min(d.x(), d.y()), std::min(d.z(), d.w()));
+    }
+}
+
+/** The tone mapper, the same as the tone mapper fragment shader.
+ *
+ * @param color The color from the user-interface.
+ * @param saturation The saturation of the user-interface.
+ * @return The color to display, or empty when the pixel should be left alone.
+ */
+[[nodiscard]] std::optional<f32x4> tone_map(f32x4 color, float saturation) noexcept
+{
+    if (color.w() < 0.0f or color.w() > 1.0f) {
+        // Alpha values below 0.0 and above 1.0 are reserved.
+        return std::nullopt;
+
+    } else if (color.w() < 1.0f) {
+        // Punch a hole in the user interface, the alpha was set by the alpha pipeline.
+        return clamp(detail::gfx_rasterizer_multiply_alpha(color), f32x4{}, f32x4::broadcast(1.0f));
+
+    } else {
+        if (saturation < 1.0f) {
+            // Desaturate the color of the user-interface, used when the window becomes inactive.
+            hilet y = detail::gfx_rasterizer_rgb_to_y(color);
+            hilet greyscale_color = f32x4{y, y, y, color.w()};
+            color = greyscale_color + (color - greyscale_color) * saturation;
+        }
+        return clamp(color, f32x4{}, f32x4::broadcast(1.0f));
+    }
+}
+
+template<typename Vertex, typename GetClippingRectangle>
+void setup_quads(
+    std::vector<detail::gfx_rasterizer_quad>& quads,
+    std::span<Vertex const> vertices,
+    std::size_t width,
+    std::size_t height,
+    GetClippingRectangle const& get_clipping_rectangle) noexcept
+{
+    hi_axiom(vertices.size() % 4 == 0);
+
+    quads.clear();
+    quads.reserve(vertices.size() / 4);
+    for (auto i = 0_uz; i + 3 < vertices.size(); i += 4) {
+        quads.emplace_back(
+            static_cast<f32x4>(vertices[i].position),
+            static_cast<f32x4>(vertices[i + 1].position),
+            static_cast<f32x4>(vertices[i + 2].position),
+            static_cast<f32x4>(vertices[i + 3].position),
+            get_clipping_rectangle(vertices[i]),
+            width,
+            height);
+    }
+}
+
+} // namespace
+
+void gfx_rasterizer::render(
+    pixmap_span<sfloat_rgba16> image,
+    f32x4 clear_color,
+    std::span<pipeline_box::vertex const> box_vertices,
+    std::span<pipeline_image::vertex const> image_vertices,
+    std::span<pipeline_SDF::vertex const> sdf_vertices,
+    std::span<pipeline_alpha::vertex const> alpha_vertices) noexcept
+{
+    auto t = trace<"gfx_rasterizer::render">{};
+
+    hilet width = image.width();
+    hilet height = image.height();
+    if (width == 0 or height == 0) {
+        return;
+    }
+
+    hilet num_tiles_x = (width + tile_size - 1) / tile_size;
+    hilet num_tiles_y = (height + tile_size - 1) / tile_size;
+    hilet num_tiles = num_tiles_x * num_tiles_y;
+
+    _bins.resize(num_tiles);
+    for (auto& bin : _bins) {
+        bin.box.clear();
+        bin.image.clear();
+        bin.sdf.clear();
+        bin.alpha.clear();
+    }
+
+    setup_quads(_box_quads, box_vertices, width, height, [](hilet& v) {
+        return static_cast<f32x4>(v.clipping_rectangle);
+    });
+    setup_quads(_image_quads, image_vertices, width, height, [](hilet& v) {
+        return static_cast<f32x4>(v.clipping_rectangle);
+    });
+    setup_quads(_sdf_quads, sdf_vertices, width, height, [](hilet& v) {
+        return static_cast<f32x4>(v.clippingRectangle);
+    });
+    setup_quads(_alpha_quads, alpha_vertices, width, height, [](hilet& v) {
+        return static_cast<f32x4>(v.clipping_rectangle);
+    });
+
+    // Add the index of each quad to the bin of each tile it overlaps.
+    hilet bin_quads = [&](std::vector<detail::gfx_rasterizer_quad> const& quads, std::vector<uint32_t> tile_bin::*member) {
+        for (auto i = 0_uz; i != quads.size(); ++i) {
+            hilet& quad = quads[i];
+            if (quad.empty()) {
+                continue;
+            }
+
+            hilet first_tile_x = narrow_cast<std::size_t>(quad.left) / tile_size;
+            hilet first_tile_y = narrow_cast<std::size_t>(quad.bottom) / tile_size;
+            hilet last_tile_x = narrow_cast<std::size_t>(quad.right - 1) / tile_size;
+            hilet last_tile_y = narrow_cast<std::size_t>(quad.top - 1) / tile_size;
+            for (auto tile_y = first_tile_y; tile_y <= last_tile_y; ++tile_y) {
+                for (auto tile_x = first_tile_x; tile_x <= last_tile_x; ++tile_x) {
+                    (_bins[tile_y * num_tiles_x + tile_x].*member).push_back(narrow_cast<uint32_t>(i));
+                }
+            }
+        }
+    };
+
+    bin_quads(_box_quads, &tile_bin::box);
+    bin_quads(_image_quads, &tile_bin::image);
+    bin_quads(_sdf_quads, &tile_bin::sdf);
+    bin_quads(_alpha_quads, &tile_bin::alpha);
+
+    hilet render_tile = [&](std::size_t tile_index, std::vector<f32x4>& colors, std::vector<float>& depths) {
+        hilet tile_left = narrow_cast<int32_t>((tile_index % num_tiles_x) * tile_size);
+        hilet tile_bottom = narrow_cast<int32_t>((tile_index / num_tiles_x) * tile_size);
+        hilet tile_right = std::min(tile_left + narrow_cast<int32_t>(tile_size), narrow_cast<int32_t>(width));
+        hilet tile_top = std::min(tile_bottom + narrow_cast<int32_t>(tile_size), narrow_cast<int32_t>(height));
+        hilet& bin = _bins[tile_index];
+
+        // Reverse-z: the depth buffer is cleared to the far plane, a fragment with
+        // a larger z is in front.
+        std::fill(colors.begin(), colors.end(), clear_color);
+        std::fill(depths.begin(), depths.end(), 0.0f);
+
+        hilet for_each_fragment = [&](detail::gfx_rasterizer_quad const& quad, auto const& func) {
+            hilet left = std::max(quad.left, tile_left);
+            hilet bottom = std::max(quad.bottom, tile_bottom);
+            hilet right = std::min(quad.right, tile_right);
+            hilet top = std::min(quad.top, tile_top);
+
+            for (auto y = bottom; y < top; ++y) {
+                hilet offset = narrow_cast<std::size_t>(y - tile_bottom) * tile_size;
+                for (auto x = left; x < right; ++x) {
+                    hilet [triangle, w] = quad.weights(narrow_cast<float>(x) + 0.5f, narrow_cast<float>(y) + 0.5f);
+                    if (triangle >= 0) {
+                        hilet i = offset + narrow_cast<std::size_t>(x - tile_left);
+                        func(triangle, w, colors[i], depths[i]);
+                    }
+                }
+            }
+        };
+
+        for (hilet quad_index : bin.box) {
+            hilet vertices = box_vertices.data() + quad_index * 4_uz;
+            for_each_fragment(_box_quads[quad_index], [&](int triangle, f32x4 w, f32x4& color, float& depth) {
+                hilet z = interpolate(vertices, triangle, w, [](hilet& v) {
+                              return static_cast<f32x4>(v.position);
+                          }).z();
+                if (z < depth) {
+                    return;
+                }
+
+                hilet& flat = provoking_vertex(vertices, triangle);
+                hilet border_start = 1.0f;
+                hilet border_middle = border_start + flat.line_width * 0.5f;
+                hilet border_end = border_start + flat.line_width;
+                hilet corner_radii = static_cast<f32x4>(flat.corner_radii) + border_middle;
+
+                hilet edge_distances = interpolate(vertices, triangle, w, [](hilet& v) {
+                    return static_cast<f32x4>(v.corner_coordinate);
+                });
+                hilet distance = distance_from_box_outline(edge_distances, corner_radii);
+
+                hilet border_coverage = std::clamp(distance - border_start + 0.5f, 0.0f, 1.0f);
+                if (border_coverage == 0.0f) {
+                    // Don't update depth beyond the border.
+                    return;
+                }
+                hilet fill_coverage = std::clamp(border_end - distance + 0.5f, 0.0f, 1.0f);
+
+                hilet fill_color = interpolate(vertices, triangle, w, [](hilet& v) {
+                    return detail::gfx_rasterizer_multiply_alpha(to_f32x4(v.fill_color));
+                });
+                hilet border_color = interpolate(vertices, triangle, w, [](hilet& v) {
+                    return detail::gfx_rasterizer_multiply_alpha(to_f32x4(v.line_color));
+                });
+                hilet border_sqrt_y = interpolate(vertices, triangle, w, [](hilet& v) {
+                    hilet y = detail::gfx_rasterizer_rgb_to_y(detail::gfx_rasterizer_multiply_alpha(to_f32x4(v.line_color)));
+                    return f32x4::broadcast(std::sqrt(std::clamp(y, 0.0f, 1.0f)));
+                });
+
+                hilet alpha = detail::gfx_rasterizer_coverage_to_alpha(
+                    f32x4{border_coverage, fill_coverage, 0.0f, 0.0f}, border_sqrt_y);
+                hilet border_alpha = alpha.x();
+                hilet fill_alpha = alpha.y();
+
+                // Combine the border on top of the fill.
+                hilet border_color_ = border_color * fill_alpha;
+                hilet combined_color = fill_color * (1.0f - border_color_.w()) + border_color_;
+                hilet fragment_color = combined_color * border_alpha;
+
+                // Pre-multiplied alpha blending.
+                color = fragment_color + color * (1.0f - fragment_color.w());
+                depth = z;
+            });
+        }
+
+        for (hilet quad_index : bin.image) {
+            hilet vertices = image_vertices.data() + quad_index * 4_uz;
+            hilet atlas_index = narrow_cast<std::size_t>(static_cast<f32x4>(vertices[0].atlas_position).z());
+            if (atlas_index >= image_atlas.size()) {
+                continue;
+            }
+            hilet& atlas = image_atlas[atlas_index];
+
+            for_each_fragment(_image_quads[quad_index], [&](int triangle, f32x4 w, f32x4& color, float& depth) {
+                hilet z = interpolate(vertices, triangle, w, [](hilet& v) {
+                              return static_cast<f32x4>(v.position);
+                          }).z();
+                if (z < depth) {
+                    return;
+                }
+
+                hilet atlas_position = interpolate(vertices, triangle, w, [](hilet& v) {
+                    return static_cast<f32x4>(v.atlas_position);
+                });
+
+                // The atlas is in pre-multiplied alpha.
+                hilet fragment_color = sample_bilinear(atlas, atlas_position.x() - 0.5f, atlas_position.y() - 0.5f);
+                color = fragment_color + color * (1.0f - fragment_color.w());
+                depth = z;
+            });
+        }
+
+        for (hilet quad_index : bin.sdf) {
+            hilet vertices = sdf_vertices.data() + quad_index * 4_uz;
+            hilet atlas_index = narrow_cast<std::size_t>(static_cast<f32x4>(vertices[0].textureCoord).z());
+            if (atlas_index >= sdf_atlas.size()) {
+                continue;
+            }
+            hilet& atlas = sdf_atlas[atlas_index];
+            hilet atlas_width = narrow_cast<float>(atlas.width());
+            hilet atlas_height = narrow_cast<float>(atlas.height());
+            hilet& quad = _sdf_quads[quad_index];
+
+            // The distance in the texture when stepping one pixel to the right, this is
+            // constant for each triangle.
+            auto distance_multiplier = std::array<float, 2>{};
+            for (auto i = 0_uz; i != 2; ++i) {
+                hilet texture_stride = interpolate(vertices, narrow_cast<int>(i), quad.a[i], [](hilet& v) {
+                    return static_cast<f32x4>(v.textureCoord);
+                });
+                hilet pixel_distance = std::hypot(texture_stride.x(), texture_stride.y());
+                distance_multiplier[i] = pixel_distance == 0.0f ? 0.0f : 1.0f / (pixel_distance * atlas_width);
+            }
+
+            for_each_fragment(quad, [&](int triangle, f32x4 w, f32x4& color, float& depth) {
+                hilet z = interpolate(vertices, triangle, w, [](hilet& v) {
+                              return static_cast<f32x4>(v.position);
+                          }).z();
+                if (z < depth) {
+                    return;
+                }
+
+                hilet texture_coord = interpolate(vertices, triangle, w, [](hilet& v) {
+                    return static_cast<f32x4>(v.textureCoord);
+                });
+                hilet distance =
+                    sample_bilinear(atlas, texture_coord.x() * atlas_width - 0.5f, texture_coord.y() * atlas_height - 0.5f) *
+                    distance_multiplier[triangle];
+
+                hilet coverage = std::clamp(distance + 0.5f, 0.0f, 1.0f);
+                if (coverage == 0.0f) {
+                    return;
+                }
+
+                hilet glyph_color = interpolate(vertices, triangle, w, [](hilet& v) {
+                    return detail::gfx_rasterizer_multiply_alpha(to_f32x4(v.color));
+                });
+                hilet glyph_color_sqrt_rgby = interpolate(vertices, triangle, w, [](hilet& v) {
+                    auto rgby = detail::gfx_rasterizer_multiply_alpha(to_f32x4(v.color));
+                    rgby.w() = detail::gfx_rasterizer_rgb_to_y(rgby);
+                    return sqrt(clamp(rgby, f32x4{}, f32x4::broadcast(1.0f)));
+                });
+
+                hilet alpha = detail::gfx_rasterizer_coverage_to_alpha(f32x4::broadcast(coverage), glyph_color_sqrt_rgby);
+
+                // Dual-source blending, the same as on GPUs that support it.
+                hilet fragment_color = glyph_color * alpha;
+                hilet blend_factor = glyph_color.w() * alpha;
+                color = fragment_color + color * (1.0f - blend_factor);
+                depth = z;
+            });
+        }
+
+        for (hilet quad_index : bin.alpha) {
+            hilet vertices = alpha_vertices.data() + quad_index * 4_uz;
+            for_each_fragment(_alpha_quads[quad_index], [&](int triangle, f32x4 w, f32x4& color, float& depth) {
+                hilet z = interpolate(vertices, triangle, w, [](hilet& v) {
+                              return static_cast<f32x4>(v.position);
+                          }).z();
+                if (z < depth) {
+                    return;
+                }
+
+                // Only the alpha channel is written, without blending.
+                color.w() = interpolate(vertices, triangle, w, [](hilet& v) {
+                                return f32x4::broadcast(v.alpha);
+                            }).x();
+                depth = z;
+            });
+        }
+
+        for (auto y = tile_bottom; y != tile_top; ++y) {
+            hilet offset = narrow_cast<std::size_t>(y - tile_bottom) * tile_size;
+            auto row = image[narrow_cast<std::size_t>(y)];
+            for (auto x = tile_left; x != tile_right; ++x) {
+                if (hilet tone_mapped = tone_map(colors[offset + narrow_cast<std::size_t>(x - tile_left)], saturation)) {
+                    row[narrow_cast<std::size_t>(x)] = *tone_mapped;
+                }
+            }
+        }
+    };
+
+    auto next_tile = std::atomic<std::size_t>{0};
+    hilet worker = [&] {
+        auto colors = std::vector<f32x4>(tile_size * tile_size);
+        auto depths = std::vector<float>(tile_size * tile_size);
+
+        for (auto i = next_tile.fetch_add(1, std::memory_order::relaxed); i < num_tiles;
+             i = next_tile.fetch_add(1, std::memory_order::relaxed)) {
+            render_tile(i, colors, depths);
+        }
+    };
+
+    // The calling thread is one of the workers, the others are persistent threads from the pool.
+    thread_pool::global().run(std::min(_num_threads, num_tiles), [&](std::size_t) {
+        worker();
+    });
+}
+
+}} // namespace hi::v1
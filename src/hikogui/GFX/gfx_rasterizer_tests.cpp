@@ -0,0 +1,207 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gfx_rasterizer.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <random>
+
+using namespace hi;
+
+namespace {
+
+/** Add a box with square corners and without a border.
+ *
+ * Like draw_context, the quad is one pixel larger than the box on each side,
+ * so that the anti-aliased edge fits inside the quad.
+ */
+void add_box(
+    std::vector<pipeline_box::vertex>& vertices,
+    f32x4 rectangle,
+    float z,
+    f32x4 color,
+    f32x4 clipping_rectangle = f32x4{0.0f, 0.0f, 1000.0f, 1000.0f})
+{
+    hilet left = rectangle.x() - 1.0f;
+    hilet bottom = rectangle.y() - 1.0f;
+    hilet right = rectangle.z() + 1.0f;
+    hilet top = rectangle.w() + 1.0f;
+    hilet width = right - left;
+    hilet height = top - bottom;
+
+    hilet add_vertex = [&](float x, float y, f32x4 corner_coordinate) {
+        vertices.emplace_back(
+            f32x4{x, y, z, 1.0f}, clipping_rectangle, corner_coordinate, f32x4{}, color, color, 0.0f);
+    };
+
+    add_vertex(left, bottom, f32x4{0.0f, 0.0f, width, height});
+    add_vertex(right, bottom, f32x4{width, 0.0f, 0.0f, height});
+    add_vertex(left, top, f32x4{0.0f, height, width, 0.0f});
+    add_vertex(right, top, f32x4{width, height, 0.0f, 0.0f});
+}
+
+void add_image(std::vector<pipeline_image::vertex>& vertices, f32x4 rectangle, float z)
+{
+    hilet clipping_rectangle = f32x4{0.0f, 0.0f, 1000.0f, 1000.0f};
+    hilet atlas_position = f32x4{0.5f, 0.5f, 0.0f, 0.0f};
+
+    vertices.emplace_back(f32x4{rectangle.x(), rectangle.y(), z, 1.0f}, clipping_rectangle, atlas_position);
+    vertices.emplace_back(f32x4{rectangle.z(), rectangle.y(), z, 1.0f}, clipping_rectangle, atlas_position);
+    vertices.emplace_back(f32x4{rectangle.x(), rectangle.w(), z, 1.0f}, clipping_rectangle, atlas_position);
+    vertices.emplace_back(f32x4{rectangle.z(), rectangle.w(), z, 1.0f}, clipping_rectangle, atlas_position);
+}
+
+void add_alpha(std::vector<pipeline_alpha::vertex>& vertices, f32x4 rectangle, float z, float alpha)
+{
+    hilet clipping_rectangle = f32x4{0.0f, 0.0f, 1000.0f, 1000.0f};
+
+    vertices.emplace_back(f32x4{rectangle.x(), rectangle.y(), z, 1.0f}, clipping_rectangle, alpha);
+    vertices.emplace_back(f32x4{rectangle.z(), rectangle.y(), z, 1.0f}, clipping_rectangle, alpha);
+    vertices.emplace_back(f32x4{rectangle.x(), rectangle.w(), z, 1.0f}, clipping_rectangle, alpha);
+    vertices.emplace_back(f32x4{rectangle.z(), rectangle.w(), z, 1.0f}, clipping_rectangle, alpha);
+}
+
+[[nodiscard]] f32x4 get_pixel(pixmap<sfloat_rgba16> const& image, std::size_t x, std::size_t y)
+{
+    return f32x4{static_cast<f16x4>(image[y][x])};
+}
+
+[[nodiscard]] pixmap_span<sfloat_rgba16> make_span(pixmap<sfloat_rgba16>& image)
+{
+    return pixmap_span<sfloat_rgba16>{image.data(), image.width(), image.height()};
+}
+
+} // namespace
+
+TEST(gfx_rasterizer, box)
+{
+    auto image = pixmap<sfloat_rgba16>{8, 8};
+    auto box_vertices = std::vector<pipeline_box::vertex>{};
+    add_box(box_vertices, f32x4{2.0f, 1.0f, 6.0f, 5.0f}, 1.0f, f32x4{1.0f, 1.0f, 1.0f, 1.0f});
+
+    auto rasterizer = gfx_rasterizer{1};
+    rasterizer.render(make_span(image), f32x4{}, box_vertices, {}, {}, {});
+
+    for (auto y = 0_uz; y != 8; ++y) {
+        for (auto x = 0_uz; x != 8; ++x) {
+            hilet inside = x >= 2 and x < 6 and y >= 1 and y < 5;
+            hilet expected = inside ? f32x4{1.0f, 1.0f, 1.0f, 1.0f} : f32x4{};
+            ASSERT_EQ(get_pixel(image, x, y), expected) << "x=" << x << " y=" << y;
+        }
+    }
+}
+
+TEST(gfx_rasterizer, box_clipping)
+{
+    auto image = pixmap<sfloat_rgba16>{8, 8};
+    auto box_vertices = std::vector<pipeline_box::vertex>{};
+    add_box(
+        box_vertices,
+        f32x4{2.0f, 1.0f, 6.0f, 5.0f},
+        1.0f,
+        f32x4{1.0f, 1.0f, 1.0f, 1.0f},
+        f32x4{3.0f, 0.0f, 5.0f, 3.0f});
+
+    auto rasterizer = gfx_rasterizer{1};
+    rasterizer.render(make_span(image), f32x4{}, box_vertices, {}, {}, {});
+
+    for (auto y = 0_uz; y != 8; ++y) {
+        for (auto x = 0_uz; x != 8; ++x) {
+            hilet inside = x >= 3 and x < 5 and y >= 1 and y < 3;
+            hilet expected = inside ? f32x4{1.0f, 1.0f, 1.0f, 1.0f} : f32x4{};
+            ASSERT_EQ(get_pixel(image, x, y), expected) << "x=" << x << " y=" << y;
+        }
+    }
+}
+
+TEST(gfx_rasterizer, depth)
+{
+    auto image = pixmap<sfloat_rgba16>{8, 8};
+    auto box_vertices = std::vector<pipeline_box::vertex>{};
+    // The red box is in front, even though the blue box is drawn later.
+    add_box(box_vertices, f32x4{0.0f, 0.0f, 4.0f, 8.0f}, 2.0f, f32x4{1.0f, 0.0f, 0.0f, 1.0f});
+    add_box(box_vertices, f32x4{2.0f, 0.0f, 8.0f, 8.0f}, 1.0f, f32x4{0.0f, 0.0f, 1.0f, 1.0f});
+
+    auto rasterizer = gfx_rasterizer{1};
+    rasterizer.render(make_span(image), f32x4{}, box_vertices, {}, {}, {});
+
+    for (auto x = 0_uz; x != 8; ++x) {
+        hilet expected = x < 4 ? f32x4{1.0f, 0.0f, 0.0f, 1.0f} : f32x4{0.0f, 0.0f, 1.0f, 1.0f};
+        ASSERT_EQ(get_pixel(image, x, 4), expected) << "x=" << x;
+    }
+}
+
+TEST(gfx_rasterizer, alpha)
+{
+    auto image = pixmap<sfloat_rgba16>{8, 8};
+    auto box_vertices = std::vector<pipeline_box::vertex>{};
+    auto alpha_vertices = std::vector<pipeline_alpha::vertex>{};
+    add_box(box_vertices, f32x4{0.0f, 0.0f, 8.0f, 8.0f}, 1.0f, f32x4{1.0f, 0.0f, 0.0f, 1.0f});
+    add_alpha(alpha_vertices, f32x4{0.0f, 0.0f, 4.0f, 8.0f}, 2.0f, 0.5f);
+
+    auto rasterizer = gfx_rasterizer{1};
+    rasterizer.render(make_span(image), f32x4{}, box_vertices, {}, {}, alpha_vertices);
+
+    for (auto x = 0_uz; x != 8; ++x) {
+        // The tone mapper pre-multiplies the color with the alpha punched by the alpha pipeline.
+        hilet expected = x < 4 ? f32x4{0.5f, 0.0f, 0.0f, 0.5f} : f32x4{1.0f, 0.0f, 0.0f, 1.0f};
+        ASSERT_EQ(get_pixel(image, x, 4), expected) << "x=" << x;
+    }
+}
+
+TEST(gfx_rasterizer, shared_edges_drawn_once)
+{
+    auto atlas = pixmap<sfloat_rgba16>{1, 1};
+    atlas[0][0] = f32x4{0.25f, 0.0f, 0.0f, 0.5f};
+
+    auto image = pixmap<sfloat_rgba16>{8, 8};
+    auto image_vertices = std::vector<pipeline_image::vertex>{};
+    // The centers of the pixels in column 4 are on the shared edge of both quads,
+    // and the centers of the pixels on the diagonals are on the shared edge of the
+    // triangles of each quad.
+    add_image(image_vertices, f32x4{0.0f, 0.0f, 4.5f, 8.0f}, 1.0f);
+    add_image(image_vertices, f32x4{4.5f, 0.0f, 8.0f, 8.0f}, 1.0f);
+
+    auto rasterizer = gfx_rasterizer{1};
+    rasterizer.image_atlas.push_back(atlas);
+    rasterizer.render(make_span(image), f32x4{}, {}, image_vertices, {}, {});
+
+    for (auto y = 0_uz; y != 8; ++y) {
+        for (auto x = 0_uz; x != 8; ++x) {
+            ASSERT_EQ(get_pixel(image, x, y), (f32x4{0.125f, 0.0f, 0.0f, 0.5f})) << "x=" << x << " y=" << y;
+        }
+    }
+}
+
+TEST(gfx_rasterizer, multi_threaded)
+{
+    auto box_vertices = std::vector<pipeline_box::vertex>{};
+
+    auto engine = std::mt19937{42};
+    auto position_dist = std::uniform_real_distribution<float>{-20.0f, 300.0f};
+    auto color_dist = std::uniform_real_distribution<float>{0.0f, 1.0f};
+    for (auto i = 0; i != 200; ++i) {
+        hilet x = position_dist(engine);
+        hilet y = position_dist(engine);
+        add_box(
+            box_vertices,
+            f32x4{x, y, x + position_dist(engine) * 0.25f + 1.0f, y + position_dist(engine) * 0.25f + 1.0f},
+            narrow_cast<float>(i % 7),
+            f32x4{color_dist(engine), color_dist(engine), color_dist(engine), color_dist(engine)});
+    }
+
+    auto single_image = pixmap<sfloat_rgba16>{300, 200};
+    auto single_rasterizer = gfx_rasterizer{1};
+    single_rasterizer.render(make_span(single_image), f32x4{0.0f, 0.0f, 0.0f, 1.0f}, box_vertices, {}, {}, {});
+
+    auto multi_image = pixmap<sfloat_rgba16>{300, 200};
+    auto multi_rasterizer = gfx_rasterizer{4};
+    multi_rasterizer.render(make_span(multi_image), f32x4{0.0f, 0.0f, 0.0f, 1.0f}, box_vertices, {}, {}, {});
+
+    for (auto y = 0_uz; y != 200; ++y) {
+        for (auto x = 0_uz; x != 300; ++x) {
+            ASSERT_EQ(get_pixel(single_image, x, y), get_pixel(multi_image, x, y)) << "x=" << x << " y=" << y;
+        }
+    }
+}
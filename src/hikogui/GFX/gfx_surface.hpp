@@ -56,7 +56,7 @@ public:
      */
     virtual void update(extent2 new_size) noexcept = 0;
 
-    [[nodiscard]] virtual draw_context render_start(aarectangle redraw_rectangle) = 0;
+    [[nodiscard]] virtual draw_context render_start(damage_region const& redraw_region) = 0;
     virtual void render_finish(draw_context const &context) = 0;
 
     /** Add a delegate to handle extra rendering.
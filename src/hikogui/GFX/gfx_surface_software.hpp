@@ -0,0 +1,121 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "gfx_surface.hpp"
+#include "gfx_rasterizer.hpp"
+#include "pipeline_box_vertex.hpp"
+#include "pipeline_image_vertex.hpp"
+#include "pipeline_SDF_vertex.hpp"
+#include "pipeline_alpha_vertex.hpp"
+#include "../image/module.hpp"
+#include "../container/module.hpp"
+#include "../macros.hpp"
+#include <memory>
+#include <span>
+
+namespace hi::inline v1 {
+class gfx_device_software;
+
+/** A gfx_surface that is rendered on the CPU by a `gfx_rasterizer`.
+ *
+ * The vertices are placed by `draw_context` in buffers in main memory, then
+ * rendered into an image by the rasterizer. When the surface belongs to a
+ * window, the image is presented to the window after rendering.
+ *
+ * The rasterizer clears the image before rendering, so each frame the
+ * whole surface is redrawn.
+ *
+ * Delegates can not be added to a software surface, since they render with Vulkan.
+ */
+class gfx_surface_software final : public gfx_surface {
+public:
+    using super = gfx_surface;
+
+    /** The number of vertices in each vertex buffer, the same as a Vulkan vertex buffer.
+     */
+    constexpr static std::size_t num_vertices = 65536;
+
+    /** Create a software surface.
+     *
+     * @param system The graphics system.
+     * @param os_window The window to present the image to, or nullptr to only render the image.
+     */
+    gfx_surface_software(gfx_system& system, void *os_window) noexcept;
+    ~gfx_surface_software();
+
+    gfx_surface_software(const gfx_surface_software&) = delete;
+    gfx_surface_software& operator=(const gfx_surface_software&) = delete;
+    gfx_surface_software(gfx_surface_software&&) = delete;
+    gfx_surface_software& operator=(gfx_surface_software&&) = delete;
+
+    [[nodiscard]] extent2 size() const noexcept override;
+
+    void update(extent2 new_size) noexcept override;
+
+    [[nodiscard]] draw_context render_start(damage_region const& redraw_region) override;
+    void render_finish(draw_context const& context) override;
+
+    void add_delegate(gfx_surface_delegate *delegate) noexcept override;
+    void remove_delegate(gfx_surface_delegate *delegate) noexcept override;
+
+    /** The image that was rendered by the last call to `render_finish()`.
+     *
+     * Row zero of the image is the bottom row.
+     */
+    [[nodiscard]] pixmap_span<sfloat_rgba16 const> image() const noexcept
+    {
+        return _image;
+    }
+
+protected:
+    void teardown() noexcept override;
+
+private:
+    /** Uninitialized memory for the vertices of a pipeline.
+     */
+    template<typename T>
+    struct vertex_buffer {
+        T *data = std::allocator<T>{}.allocate(num_vertices);
+        vector_span<T> vertices = {data, narrow_cast<ssize_t>(num_vertices)};
+
+        vertex_buffer() noexcept = default;
+        vertex_buffer(vertex_buffer const&) = delete;
+        vertex_buffer& operator=(vertex_buffer const&) = delete;
+
+        ~vertex_buffer()
+        {
+            vertices.clear();
+            std::allocator<T>{}.deallocate(data, num_vertices);
+        }
+
+        [[nodiscard]] std::span<T const> span() const noexcept
+        {
+            return {data, vertices.size()};
+        }
+    };
+
+    void *_os_window;
+
+    vertex_buffer<pipeline_box::vertex> _box_vertices;
+    vertex_buffer<pipeline_image::vertex> _image_vertices;
+    vertex_buffer<pipeline_SDF::vertex> _sdf_vertices;
+    vertex_buffer<pipeline_alpha::vertex> _alpha_vertices;
+
+    gfx_rasterizer _rasterizer;
+    pixmap<sfloat_rgba16> _image;
+
+    [[nodiscard]] gfx_device_software& software_device() const noexcept;
+
+    void build(extent2 new_size) noexcept;
+
+    /** Copy the image to the window.
+     *
+     * This is implemented for each operating system.
+     */
+    void present() noexcept;
+};
+
+} // namespace hi::inline v1
@@ -0,0 +1,156 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gfx_surface_software.hpp"
+#include "gfx_device_software.hpp"
+#include "gfx_system.hpp"
+#include "../telemetry/module.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+
+namespace hi::inline v1 {
+
+gfx_surface_software::gfx_surface_software(gfx_system& system, void *os_window) noexcept :
+    gfx_surface(system), _os_window(os_window)
+{
+}
+
+gfx_surface_software::~gfx_surface_software()
+{
+    if (state != gfx_surface_state::no_window) {
+        hilet lock = std::scoped_lock(gfx_system_mutex);
+        loss = gfx_surface_loss::window_lost;
+        teardown();
+        hi_assert(state == gfx_surface_state::no_window);
+    }
+}
+
+gfx_device_software& gfx_surface_software::software_device() const noexcept
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+    hi_assert_not_null(_device);
+    return down_cast<gfx_device_software&>(*_device);
+}
+
+[[nodiscard]] extent2 gfx_surface_software::size() const noexcept
+{
+    return {narrow_cast<float>(_image.width()), narrow_cast<float>(_image.height())};
+}
+
+void gfx_surface_software::add_delegate(gfx_surface_delegate *delegate) noexcept
+{
+    hi_assert_not_null(delegate);
+    hi_log_error("A gfx_surface_delegate renders with Vulkan, it can not be added to a software surface.");
+}
+
+void gfx_surface_software::remove_delegate(gfx_surface_delegate *delegate) noexcept
+{
+    hi_assert_not_null(delegate);
+}
+
+void gfx_surface_software::build(extent2 new_size) noexcept
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+    hi_assert(loss == gfx_surface_loss::none);
+
+    if (state == gfx_surface_state::has_window and _device) {
+        if (software_device().score(*this) <= 0) {
+            loss = gfx_surface_loss::device_lost;
+            return;
+        }
+        state = gfx_surface_state::has_device;
+    }
+
+    if (state == gfx_surface_state::has_device) {
+        hilet width = floor_cast<std::size_t>(new_size.width());
+        hilet height = floor_cast<std::size_t>(new_size.height());
+        if (width == 0 or height == 0) {
+            // The window is minimized, keep state has_device until it has a size again.
+            return;
+        }
+
+        _image = pixmap<sfloat_rgba16>{width, height};
+        state = gfx_surface_state::has_swapchain;
+    }
+}
+
+void gfx_surface_software::teardown() noexcept
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+    if (state == gfx_surface_state::has_swapchain and loss >= gfx_surface_loss::swapchain_lost) {
+        _image = {};
+        state = gfx_surface_state::has_device;
+    }
+
+    if (state == gfx_surface_state::has_device and loss >= gfx_surface_loss::device_lost) {
+        state = gfx_surface_state::has_window;
+    }
+
+    if (state == gfx_surface_state::has_window and loss >= gfx_surface_loss::window_lost) {
+        _os_window = nullptr;
+        state = gfx_surface_state::no_window;
+    }
+    loss = gfx_surface_loss::none;
+}
+
+void gfx_surface_software::update(extent2 new_size) noexcept
+{
+    hilet lock = std::scoped_lock(gfx_system_mutex);
+
+    if (size() != new_size and state == gfx_surface_state::has_swapchain) {
+        // On resize lose the image, which will be cleaned up at teardown().
+        loss = gfx_surface_loss::swapchain_lost;
+    }
+
+    teardown();
+    build(new_size);
+}
+
+draw_context gfx_surface_software::render_start(damage_region const& redraw_region)
+{
+    hilet lock = std::scoped_lock(gfx_system_mutex);
+
+    auto r = draw_context{
+        software_device(), _box_vertices.vertices, _image_vertices.vertices, _sdf_vertices.vertices, _alpha_vertices.vertices};
+
+    // Bail out when the window is not yet ready to be rendered, or if there is nothing to render.
+    if (state != gfx_surface_state::has_swapchain or not redraw_region) {
+        return r;
+    }
+
+    // Setting the frame buffer index, also enabled the draw_context.
+    // There is a single image which is completely rendered by the rasterizer.
+    r.frame_buffer_index = 0;
+    r.redraw_region = aarectangle{size()};
+    return r;
+}
+
+void gfx_surface_software::render_finish(draw_context const& context)
+{
+    hilet lock = std::scoped_lock(gfx_system_mutex);
+
+    hi_assert(context.frame_buffer_index == 0);
+    auto& device = software_device();
+
+    _rasterizer.sdf_atlas = device.glyph_atlas();
+    _rasterizer.image_atlas = device.image_atlas();
+    _rasterizer.saturation = context.saturation;
+
+    // The same clear color as the Vulkan surface.
+    _rasterizer.render(
+        _image,
+        f32x4{1.0f, 0.0f, 0.0f, 1.0f},
+        _box_vertices.span(),
+        _image_vertices.span(),
+        _sdf_vertices.span(),
+        _alpha_vertices.span());
+    global_counter<"gfx_surface:pixel"> += _image.width() * _image.height();
+
+    if (_os_window != nullptr) {
+        present();
+    }
+}
+
+} // namespace hi::inline v1
@@ -0,0 +1,66 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "../win32_headers.hpp"
+
+#include "gfx_surface_software.hpp"
+#include "../image/module.hpp"
+#include "../telemetry/module.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+
+namespace hi::inline v1 {
+
+void gfx_surface_software::present() noexcept
+{
+    hi_axiom(gfx_system_mutex.recurse_lock_count());
+
+    hilet width = _image.width();
+    hilet height = _image.height();
+
+    auto pixels = pixmap<srgb_abgr8_pack>{width, height};
+    fill(pixmap_span<srgb_abgr8_pack>{pixels}, pixmap_span<sfloat_rgba16 const>{_image});
+
+    // A 32 bit device independent bitmap is in BGRA order.
+    for (auto& pixel : pixels) {
+        hilet v = static_cast<uint32_t>(pixel);
+        pixel = (v & 0xff00ff00) | ((v >> 16) & 0x000000ff) | ((v << 16) & 0x00ff0000);
+    }
+
+    auto info = BITMAPINFO{};
+    info.bmiHeader.biSize = sizeof(BITMAPINFOHEADER);
+    info.bmiHeader.biWidth = narrow_cast<LONG>(width);
+    // A positive height is a bottom-up bitmap, like the image.
+    info.bmiHeader.biHeight = narrow_cast<LONG>(height);
+    info.bmiHeader.biPlanes = 1;
+    info.bmiHeader.biBitCount = 32;
+    info.bmiHeader.biCompression = BI_RGB;
+
+    hilet window = reinterpret_cast<HWND>(_os_window);
+    hilet device_context = GetDC(window);
+    if (device_context == nullptr) {
+        hi_log_error("Could not get the device context of the window.");
+        return;
+    }
+
+    if (SetDIBitsToDevice(
+            device_context,
+            0,
+            0,
+            narrow_cast<DWORD>(width),
+            narrow_cast<DWORD>(height),
+            0,
+            0,
+            0,
+            narrow_cast<UINT>(height),
+            pixels.data(),
+            &info,
+            DIB_RGB_COLORS) == 0) {
+        hi_log_error("Could not copy the image to the window.");
+    }
+
+    ReleaseDC(window, device_context);
+}
+
+} // namespace hi::inline v1
@@ -10,6 +10,7 @@
 #include <vulkan/vulkan.hpp>
 #include <vma/vk_mem_alloc.h>
 #include <optional>
+#include <vector>
 
 namespace hi::inline v1 {
 class gfx_surface_delegate_vulkan;
@@ -34,7 +35,7 @@ struct swapchain_image_info {
     vk::Image image;
     vk::ImageView image_view;
     vk::Framebuffer frame_buffer;
-    aarectangle redraw_rectangle;
+    damage_region redraw_region;
     bool layout_is_present = false;
 };
 
@@ -96,7 +97,7 @@ public:
 
     void update(extent2 new_size) noexcept override;
 
-    [[nodiscard]] draw_context render_start(aarectangle redraw_rectangle) override;
+    [[nodiscard]] draw_context render_start(damage_region const& redraw_region) override;
     void render_finish(draw_context const& context) override;
 
     void add_delegate(gfx_surface_delegate *delegate) noexcept override;
@@ -132,7 +133,10 @@ private:
      * @param current_image Information about the swapchain-image to be rendered.
      * @param context The drawing context.
      */
-    void fill_command_buffer(swapchain_image_info const& current_image, draw_context const& context, vk::Rect2D render_area);
+    void fill_command_buffer(
+        swapchain_image_info const& current_image,
+        draw_context const& context,
+        std::vector<vk::Rect2D> const& render_areas);
 
     /** Submit the command buffer updated with fill command buffer.
      *
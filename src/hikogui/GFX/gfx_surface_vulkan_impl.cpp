@@ -419,10 +419,10 @@ void gfx_surface_vulkan::update(extent2 new_size) noexcept
     build(new_size);
 }
 
-draw_context gfx_surface_vulkan::render_start(aarectangle redraw_rectangle)
+draw_context gfx_surface_vulkan::render_start(damage_region const& redraw_region)
 {
-    // Extent the redraw_rectangle to the render-area-granularity to improve performance on tile based GPUs.
-    redraw_rectangle = ceil(redraw_rectangle, _render_area_granularity);
+    // Extent the redraw_region to the render-area-granularity to improve performance on tile based GPUs.
+    hilet ceiled_redraw_region = ceil(redraw_region, _render_area_granularity);
 
     hilet lock = std::scoped_lock(gfx_system_mutex);
 
@@ -434,7 +434,7 @@ draw_context gfx_surface_vulkan::render_start(aarectangle redraw_rectangle)
         alpha_pipeline->vertexBufferData};
 
     // Bail out when the window is not yet ready to be rendered, or if there is nothing to render.
-    if (state != gfx_surface_state::has_swapchain or not redraw_rectangle) {
+    if (state != gfx_surface_state::has_swapchain or not ceiled_redraw_region) {
         return r;
     }
 
@@ -450,13 +450,13 @@ draw_context gfx_surface_vulkan::render_start(aarectangle redraw_rectangle)
 
     // Record which part of the image will be redrawn on the current swapchain image.
     auto& current_image = swapchain_image_infos.at(r.frame_buffer_index);
-    current_image.redraw_rectangle = redraw_rectangle;
+    current_image.redraw_region = ceiled_redraw_region;
 
-    // Calculate the scissor rectangle, from the combined redraws of the complete swapchain.
+    // Calculate the redraw region, from the combined redraws of the complete swapchain.
     // We need to do this so that old redraws are also executed in the current swapchain image.
-    r.scissor_rectangle = std::accumulate(
-        swapchain_image_infos.cbegin(), swapchain_image_infos.cend(), aarectangle{}, [](hilet& sum, hilet& item) {
-            return sum | item.redraw_rectangle;
+    r.redraw_region = std::accumulate(
+        swapchain_image_infos.cbegin(), swapchain_image_infos.cend(), damage_region{}, [](hilet& sum, hilet& item) {
+            return sum | item.redraw_region;
         });
 
     // Wait until previous rendering has finished, before the next rendering.
@@ -484,18 +484,30 @@ void gfx_surface_vulkan::render_finish(draw_context const& context)
         current_image.layout_is_present = true;
     }
 
-    // Clamp the scissor rectangle to the size of the window.
-    hilet clamped_scissor_rectangle = intersect(
-        context.scissor_rectangle,
+    // Clamp the redraw region to the size of the window.
+    hilet clamped_redraw_region = intersect(
+        context.redraw_region,
         aarectangle{0, 0, narrow_cast<float>(swapchainImageExtent.width), narrow_cast<float>(swapchainImageExtent.height)});
 
-    hilet render_area = vk::Rect2D{
-        vk::Offset2D(
-            round_cast<uint32_t>(clamped_scissor_rectangle.left()),
-            round_cast<uint32_t>(
-                swapchainImageExtent.height - clamped_scissor_rectangle.bottom() - clamped_scissor_rectangle.height())),
-        vk::Extent2D(
-            round_cast<uint32_t>(clamped_scissor_rectangle.width()), round_cast<uint32_t>(clamped_scissor_rectangle.height()))};
+    hilet to_render_area = [&](aarectangle const& rectangle) {
+        return vk::Rect2D{
+            vk::Offset2D(
+                round_cast<uint32_t>(rectangle.left()),
+                round_cast<uint32_t>(swapchainImageExtent.height - rectangle.bottom() - rectangle.height())),
+            vk::Extent2D(round_cast<uint32_t>(rectangle.width()), round_cast<uint32_t>(rectangle.height()))};
+    };
+
+    // Each rectangle of the redraw region is rendered in a separate render pass, so that
+    // the pixels between the rectangles are not cleared.
+    auto render_areas = std::vector<vk::Rect2D>{};
+    render_areas.reserve(clamped_redraw_region.size());
+    for (hilet& rectangle : clamped_redraw_region) {
+        render_areas.push_back(to_render_area(rectangle));
+    }
+    global_counter<"gfx_surface:pixel"> += round_cast<uint64_t>(clamped_redraw_region.area());
+
+    // The delegates draw into the bounding rectangle of the redraw region.
+    hilet render_area = to_render_area(bounding_rectangle(clamped_redraw_region));
 
     // Start the first delegate when the swapchain-image becomes available.
     auto start_semaphore = imageAvailableSemaphore;
@@ -507,7 +519,7 @@ void gfx_surface_vulkan::render_finish(draw_context const& context)
     }
 
     // Wait for the semaphore of the last delegate before it will write into the swapchain-image.
-    fill_command_buffer(current_image, context, render_area);
+    fill_command_buffer(current_image, context, render_areas);
     submit_command_buffer(start_semaphore);
 
     // Signal the fence when all rendering has finished on the graphics queue.
@@ -523,7 +535,7 @@ void gfx_surface_vulkan::render_finish(draw_context const& context)
 void gfx_surface_vulkan::fill_command_buffer(
     swapchain_image_info const& current_image,
     draw_context const& context,
-    vk::Rect2D render_area)
+    std::vector<vk::Rect2D> const& render_areas)
 {
     hi_axiom(gfx_system_mutex.recurse_lock_count());
 
@@ -544,25 +556,27 @@ void gfx_surface_vulkan::fill_command_buffer(
         vk::ClearValue{sdfClearValue},
         vk::ClearValue{colorClearValue}};
 
-    // The scissor and render area makes sure that the frame buffer is not modified where we are not drawing the widgets.
-    hilet scissors = std::array{render_area};
-    commandBuffer.setScissor(0, scissors);
-
-    commandBuffer.beginRenderPass(
-        {renderPass, current_image.frame_buffer, render_area, narrow_cast<uint32_t>(clearValues.size()), clearValues.data()},
-        vk::SubpassContents::eInline);
-
-    box_pipeline->draw_in_command_buffer(commandBuffer, context);
-    commandBuffer.nextSubpass(vk::SubpassContents::eInline);
-    image_pipeline->draw_in_command_buffer(commandBuffer, context);
-    commandBuffer.nextSubpass(vk::SubpassContents::eInline);
-    SDF_pipeline->draw_in_command_buffer(commandBuffer, context);
-    commandBuffer.nextSubpass(vk::SubpassContents::eInline);
-    alpha_pipeline->draw_in_command_buffer(commandBuffer, context);
-    commandBuffer.nextSubpass(vk::SubpassContents::eInline);
-    tone_mapper_pipeline->draw_in_command_buffer(commandBuffer, context);
-
-    commandBuffer.endRenderPass();
+    for (hilet& render_area : render_areas) {
+        // The scissor and render area makes sure that the frame buffer is not modified where we are not drawing the widgets.
+        hilet scissors = std::array{render_area};
+        commandBuffer.setScissor(0, scissors);
+
+        commandBuffer.beginRenderPass(
+            {renderPass, current_image.frame_buffer, render_area, narrow_cast<uint32_t>(clearValues.size()), clearValues.data()},
+            vk::SubpassContents::eInline);
+
+        box_pipeline->draw_in_command_buffer(commandBuffer, context);
+        commandBuffer.nextSubpass(vk::SubpassContents::eInline);
+        image_pipeline->draw_in_command_buffer(commandBuffer, context);
+        commandBuffer.nextSubpass(vk::SubpassContents::eInline);
+        SDF_pipeline->draw_in_command_buffer(commandBuffer, context);
+        commandBuffer.nextSubpass(vk::SubpassContents::eInline);
+        alpha_pipeline->draw_in_command_buffer(commandBuffer, context);
+        commandBuffer.nextSubpass(vk::SubpassContents::eInline);
+        tone_mapper_pipeline->draw_in_command_buffer(commandBuffer, context);
+
+        commandBuffer.endRenderPass();
+    }
     commandBuffer.end();
 }
 
@@ -0,0 +1,33 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "gfx_system.hpp"
+#include "../macros.hpp"
+
+namespace hi::inline v1 {
+
+/** Graphics system that renders on the CPU.
+ *
+ * The system has a single `gfx_device_software`, the windows are rendered
+ * by a `gfx_rasterizer` into a `gfx_surface_software`.
+ * This is used when Vulkan is not available.
+ */
+class gfx_system_software final : public gfx_system {
+public:
+    gfx_system_software() noexcept;
+    ~gfx_system_software();
+
+    gfx_system_software(const gfx_system_software&) = delete;
+    gfx_system_software& operator=(const gfx_system_software&) = delete;
+    gfx_system_software(gfx_system_software&&) = delete;
+    gfx_system_software& operator=(gfx_system_software&&) = delete;
+
+    void init() noexcept override;
+
+    [[nodiscard]] std::unique_ptr<gfx_surface> make_surface(os_handle instance, void *os_window) const noexcept override;
+};
+
+} // namespace hi::inline v1
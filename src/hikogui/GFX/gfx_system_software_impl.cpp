@@ -0,0 +1,31 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "gfx_system_software.hpp"
+#include "gfx_device_software.hpp"
+#include "gfx_surface_software.hpp"
+#include "../macros.hpp"
+
+namespace hi::inline v1 {
+
+gfx_system_software::gfx_system_software() noexcept : gfx_system() {}
+
+gfx_system_software::~gfx_system_software() {}
+
+void gfx_system_software::init() noexcept
+{
+    hilet lock = std::scoped_lock(gfx_system_mutex);
+
+    devices.push_back(std::make_shared<gfx_device_software>(*this));
+}
+
+[[nodiscard]] std::unique_ptr<gfx_surface> gfx_system_software::make_surface([[maybe_unused]] os_handle instance, void *os_window) const noexcept
+{
+    hilet lock = std::scoped_lock(gfx_system_mutex);
+
+    // The surface presents by copying the rendered image to the window, it does not need the instance handle.
+    return std::make_unique<gfx_surface_software>(*const_cast<gfx_system_software *>(this), os_window);
+}
+
+} // namespace hi::inline v1
@@ -1,17 +1,23 @@
 
 #pragma once
 
+#include "damage_region.hpp"
 #include "draw_context.hpp"
+#include "draw_list.hpp"
 #include "gfx_device.hpp"
+#include "gfx_device_software.hpp"
 #include "gfx_device_vulkan.hpp"
 #include "gfx_queue_vulkan.hpp"
+#include "gfx_rasterizer.hpp"
 #include "gfx_surface.hpp"
 #include "gfx_surface_delegate.hpp"
 #include "gfx_surface_delegate_vulkan.hpp"
+#include "gfx_surface_software.hpp"
 #include "gfx_surface_state.hpp"
 #include "gfx_surface_vulkan.hpp"
 #include "gfx_system.hpp"
 #include "gfx_system_globals.hpp"
+#include "gfx_system_software.hpp"
 #include "gfx_system_vulkan.hpp"
 #include "paged_image.hpp"
 #include "pipeline.hpp"
@@ -78,7 +78,17 @@ struct device_shared {
      */
     void prepare_atlas_for_rendering();
 
+    /** Get the coordinate in the atlas from a page index.
+     *
+     * @param page number in the atlas
+     * @return x, y pixel coordinate in an atlasTexture and z the atlasTextureIndex. Inside the border.
+     */
+    [[nodiscard]] static point3 get_atlas_position(std::size_t page) noexcept;
+
     /** Place vertices for a single image.
+     *
+     * This function only depends on the layout of the atlas, it is also used
+     * by `gfx_device_software`.
      *
      * @pre The image is uploaded.
      * @param vertices The list of vertices to add to.
@@ -86,7 +96,7 @@ struct device_shared {
      * @param box The rectangle of the image in window coordinates.
      * @param image The image to render.
      */
-    void place_vertices(
+    static void place_vertices(
         vector_span<vertex> &vertices,
         aarectangle const &clipping_rectangle,
         quad const &box,
@@ -137,7 +147,7 @@ private:
     void build_atlas();
     void teardown_atlas(gfx_device_vulkan const *vulkan_device);
 
-    friend paged_image;
+    friend gfx_device_vulkan;
 };
 
 } // namespace pipeline_image
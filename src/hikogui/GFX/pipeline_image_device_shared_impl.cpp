@@ -58,12 +58,7 @@ hi::pixmap_span<sfloat_rgba16> device_shared::get_staging_pixmap()
     return staging_texture.pixmap.subimage(1, 1, staging_image_width - 2, staging_image_height - 2);
 }
 
-/** Get the coordinate in the atlas from a page index.
- *
- * @param page number in the atlas
- * @return x, y pixel coordinate in an atlasTexture and z the atlasTextureIndex. Inside the border.
- */
-[[nodiscard]] static point3 get_atlas_position(std::size_t page) noexcept
+[[nodiscard]] point3 device_shared::get_atlas_position(std::size_t page) noexcept
 {
     // The amount of pixels per page, that is the page plus two borders.
     constexpr auto page_stride = paged_image::page_size + 2;
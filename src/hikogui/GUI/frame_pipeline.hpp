@@ -0,0 +1,296 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file GUI/frame_pipeline.hpp Defines frame_pipeline.
+ * @ingroup GUI
+ */
+
+#pragma once
+
+#include "../telemetry/module.hpp"
+#include "../telemetry/duration_histogram.hpp"
+#include "../concurrency/concurrency.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <array>
+#include <chrono>
+#include <functional>
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <stop_token>
+#include <string_view>
+
+namespace hi::inline v1 {
+
+/** The phases of rendering a frame.
+ */
+enum class frame_phase {
+    /** Handling the events since the previous frame.
+     */
+    events,
+
+    /** Updating the constraints of the widgets.
+     */
+    constrain,
+
+    /** Updating the layout of the widgets.
+     */
+    layout,
+
+    /** Recording the draw commands of the widgets.
+     */
+    draw,
+
+    /** Submitting the draw commands to the GPU and presenting the frame.
+     */
+    submit,
+};
+
+constexpr auto frame_phase_metadata = enum_metadata{
+    frame_phase::events, "events",
+    frame_phase::constrain, "constrain",
+    frame_phase::layout, "layout",
+    frame_phase::draw, "draw",
+    frame_phase::submit, "submit",
+};
+
+/** The pipeline of rendering frames of a window.
+ * @ingroup GUI
+ *
+ * The pipeline collects the timings of each phase of a frame into histograms.
+ *
+ * In pipelined mode the submit-phase is executed on a separate thread. This
+ * allows the events, constrain and layout phases of the next frame to overlap
+ * with the submit-phase of the current frame. The draw-phase writes into the
+ * vertex buffers used by the submit-phase, therefore `wait_for_submit()` must
+ * be called before the draw-phase of the next frame.
+ */
+class frame_pipeline {
+public:
+    using duration = duration_histogram::duration;
+
+    /** Measures the duration of a phase.
+     */
+    class phase_timer {
+    public:
+        phase_timer(phase_timer const&) = delete;
+        phase_timer(phase_timer&&) = delete;
+        phase_timer& operator=(phase_timer const&) = delete;
+        phase_timer& operator=(phase_timer&&) = delete;
+
+        phase_timer(frame_pipeline& pipeline, frame_phase phase) noexcept :
+            _pipeline(pipeline), _phase(phase), _start(std::chrono::steady_clock::now())
+        {
+        }
+
+        ~phase_timer()
+        {
+            _pipeline.add_duration(_phase, std::chrono::steady_clock::now() - _start);
+        }
+
+    private:
+        frame_pipeline& _pipeline;
+        frame_phase _phase;
+        std::chrono::steady_clock::time_point _start;
+    };
+
+    ~frame_pipeline()
+    {
+        if (_submit_thread.joinable()) {
+            _submit_thread.request_stop();
+            _submit_thread.join();
+        }
+    }
+
+    frame_pipeline(frame_pipeline const&) = delete;
+    frame_pipeline(frame_pipeline&&) = delete;
+    frame_pipeline& operator=(frame_pipeline const&) = delete;
+    frame_pipeline& operator=(frame_pipeline&&) = delete;
+
+    /** Create a frame pipeline.
+     *
+     * @param pipelined Execute the submit-phase on a separate thread.
+     */
+    explicit frame_pipeline(bool pipelined = false) noexcept
+    {
+        set_pipelined(pipelined);
+    }
+
+    [[nodiscard]] bool pipelined() const noexcept
+    {
+        return _submit_thread.joinable();
+    }
+
+    /** Enable or disable pipelined mode.
+     *
+     * @param pipelined Execute the submit-phase on a separate thread.
+     */
+    void set_pipelined(bool pipelined) noexcept
+    {
+        if (pipelined and not _submit_thread.joinable()) {
+            _submit_thread = std::jthread{[this](std::stop_token stop_token) {
+                set_thread_name("submit");
+                submit_thread_proc(std::move(stop_token));
+            }};
+
+        } else if (not pipelined and _submit_thread.joinable()) {
+            wait_for_submit();
+            _submit_thread.request_stop();
+            _submit_thread.join();
+            _submit_thread = {};
+        }
+    }
+
+    /** Measure the duration of a phase.
+     *
+     * @param phase The phase to measure.
+     * @return A RAII object which adds the duration of the phase when it is destroyed.
+     */
+    [[nodiscard]] phase_timer measure(frame_phase phase) noexcept
+    {
+        return phase_timer{*this, phase};
+    }
+
+    /** Add the duration of a phase.
+     *
+     * The events phase is accumulated until the start of the next frame,
+     * the other phases are added to their histogram directly.
+     *
+     * @note This function is thread-safe.
+     */
+    void add_duration(frame_phase phase, duration value) noexcept
+    {
+        if (phase == frame_phase::events) {
+            _events_duration.fetch_add(value.count(), std::memory_order::relaxed);
+        } else {
+            _histograms[std::to_underlying(phase)].add(value);
+        }
+    }
+
+    /** Start a new frame.
+     *
+     * @param frame_time The time since the start of the previous frame.
+     */
+    void begin_frame(duration frame_time = {}) noexcept
+    {
+        if (hilet events_duration = _events_duration.exchange(0, std::memory_order::relaxed)) {
+            _histograms[std::to_underlying(frame_phase::events)].add(duration{events_duration});
+        }
+        if (frame_time > duration{}) {
+            _frame_time_histogram.add(frame_time);
+        }
+    }
+
+    /** Wait until the previous submit-phase has finished.
+     */
+    void wait_for_submit() noexcept
+    {
+        auto lock = std::unique_lock(_mutex);
+        _cv.wait(lock, [&] {
+            return not _submit_function;
+        });
+    }
+
+    /** Execute the submit-phase of a frame.
+     *
+     * In pipelined mode the function is executed on the submit thread,
+     * otherwise the function is executed directly.
+     *
+     * @param func The function which submits the frame.
+     */
+    void submit(std::function<void()> func) noexcept
+    {
+        hi_axiom(static_cast<bool>(func));
+
+        wait_for_submit();
+
+        if (pipelined()) {
+            {
+                hilet lock = std::scoped_lock(_mutex);
+                _submit_function = std::move(func);
+            }
+            _cv.notify_all();
+
+        } else {
+            hilet t = measure(frame_phase::submit);
+            func();
+        }
+    }
+
+    /** The histogram of the durations of a phase.
+     */
+    [[nodiscard]] duration_histogram const& operator[](frame_phase phase) const noexcept
+    {
+        return _histograms[std::to_underlying(phase)];
+    }
+
+    /** The histogram of the time between the start of frames.
+     */
+    [[nodiscard]] duration_histogram const& frame_time() const noexcept
+    {
+        return _frame_time_histogram;
+    }
+
+    /** Log the percentiles of the phases.
+     *
+     * @param name The name of the window.
+     */
+    void log(std::string_view name) const noexcept
+    {
+        for (auto i = 0_uz; i != _histograms.size(); ++i) {
+            hilet& histogram = _histograms[i];
+            if (not histogram.empty()) {
+                hi_log_statistics(
+                    "{} {}: n={} p50={} p99={} max={}",
+                    name,
+                    frame_phase_metadata[static_cast<frame_phase>(i)],
+                    histogram.count(),
+                    histogram.percentile(0.5),
+                    histogram.percentile(0.99),
+                    histogram.max());
+            }
+        }
+    }
+
+private:
+    std::array<duration_histogram, frame_phase_metadata.size()> _histograms;
+    duration_histogram _frame_time_histogram;
+    std::atomic<duration::rep> _events_duration = 0;
+
+    std::mutex _mutex;
+    std::condition_variable_any _cv;
+
+    /** The function of the frame being submitted.
+     * The function is reset after it has completed.
+     */
+    std::function<void()> _submit_function;
+
+    std::jthread _submit_thread;
+
+    void submit_thread_proc(std::stop_token stop_token) noexcept
+    {
+        auto lock = std::unique_lock(_mutex);
+        while (true) {
+            if (not _cv.wait(lock, stop_token, [&] {
+                    return static_cast<bool>(_submit_function);
+                })) {
+                // Stop was requested.
+                return;
+            }
+
+            lock.unlock();
+            {
+                hilet t = measure(frame_phase::submit);
+                _submit_function();
+            }
+            lock.lock();
+
+            _submit_function = nullptr;
+            _cv.notify_all();
+        }
+    }
+};
+
+} // namespace hi::inline v1
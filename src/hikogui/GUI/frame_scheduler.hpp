@@ -0,0 +1,189 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file GUI/frame_scheduler.hpp Defines frame_scheduler and vsync sources.
+ * @ingroup GUI
+ */
+
+#pragma once
+
+#include "frame_pipeline.hpp"
+#include "../time/module.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <chrono>
+#include <functional>
+#include <cstdint>
+
+namespace hi::inline v1 {
+
+/** A source of vertical-sync events.
+ * @ingroup GUI
+ */
+class vsync_source {
+public:
+    virtual ~vsync_source() = default;
+
+    /** The current time, according to the clock of the vsync source.
+     */
+    [[nodiscard]] virtual utc_nanoseconds now() const noexcept = 0;
+
+    /** The time between two vertical-syncs.
+     */
+    [[nodiscard]] virtual std::chrono::nanoseconds period() const noexcept = 0;
+
+    /** Block until the next vertical-sync.
+     *
+     * @return The time of the vertical-sync.
+     */
+    [[nodiscard]] virtual utc_nanoseconds wait_for_vsync() noexcept = 0;
+};
+
+/** A vsync source with a simulated clock.
+ * @ingroup GUI
+ *
+ * The clock only moves forward by calling `advance()`, which is used to
+ * simulate work; and by `wait_for_vsync()` which moves the clock to the
+ * next vertical-sync without sleeping. This allows the scheduling of frames
+ * to be tested deterministically, on any operating system.
+ */
+class fake_vsync_source final : public vsync_source {
+public:
+    /** Create a fake vsync source.
+     *
+     * @param period The time between two vertical-syncs.
+     * @param start The time of the first vertical-sync.
+     */
+    fake_vsync_source(std::chrono::nanoseconds period, utc_nanoseconds start = {}) noexcept :
+        _period(period), _start(start), _now(start)
+    {
+        hi_axiom(period > std::chrono::nanoseconds{0});
+    }
+
+    [[nodiscard]] utc_nanoseconds now() const noexcept override
+    {
+        return _now;
+    }
+
+    [[nodiscard]] std::chrono::nanoseconds period() const noexcept override
+    {
+        return _period;
+    }
+
+    [[nodiscard]] utc_nanoseconds wait_for_vsync() noexcept override
+    {
+        hilet num_periods = (_now - _start) / _period + 1;
+        _now = _start + num_periods * _period;
+        return _now;
+    }
+
+    /** Move the clock forward.
+     *
+     * @param duration The amount of time to simulate.
+     */
+    void advance(std::chrono::nanoseconds duration) noexcept
+    {
+        _now += duration;
+    }
+
+private:
+    std::chrono::nanoseconds _period;
+    utc_nanoseconds _start;
+    utc_nanoseconds _now;
+};
+
+/** Schedules the rendering of frames on vertical-sync.
+ * @ingroup GUI
+ *
+ * Each frame starts on a vertical-sync and is displayed on the following
+ * vertical-sync. When the rendering of a frame takes longer than the period
+ * of the vertical-sync, the following vertical-syncs are missed.
+ *
+ * A window's frames are started by the main loop calling `frame()` on each
+ * vertical-sync. `run_once()` and `run()` instead block on a `vsync_source`.
+ */
+class frame_scheduler {
+public:
+    using render_function = std::function<void(utc_nanoseconds display_time_point)>;
+
+    /** Create a frame scheduler.
+     *
+     * @param pipeline The pipeline which collects the timings of the frames.
+     * @param render The function which renders a frame.
+     */
+    frame_scheduler(frame_pipeline& pipeline, render_function render) noexcept :
+        _pipeline(pipeline), _render(std::move(render))
+    {
+        hi_axiom(static_cast<bool>(_render));
+    }
+
+    /** Render a frame.
+     *
+     * @param vsync_time The time of the vertical-sync on which this frame starts.
+     * @param period The time between two vertical-syncs.
+     */
+    void frame(utc_nanoseconds vsync_time, std::chrono::nanoseconds period) noexcept
+    {
+        hi_axiom(period > std::chrono::nanoseconds{0});
+
+        if (_num_frames != 0) {
+            hilet frame_time = vsync_time - _previous_vsync_time;
+            // A frame that took more than a single period has caused vertical-syncs to be missed.
+            // The vsync time of a real display jitters, therefore the number of periods is rounded.
+            hilet num_periods = (frame_time + period / 2) / period;
+            if (num_periods > 1) {
+                _num_missed_vsyncs += narrow_cast<std::size_t>(num_periods - 1);
+            }
+            _pipeline.begin_frame(frame_time);
+        } else {
+            _pipeline.begin_frame();
+        }
+        _previous_vsync_time = vsync_time;
+        ++_num_frames;
+
+        // The frame will be displayed at the next vertical-sync.
+        _render(vsync_time + period);
+    }
+
+    /** Wait for the next vertical-sync and render a frame.
+     */
+    void run_once(vsync_source& vsync) noexcept
+    {
+        hilet vsync_time = vsync.wait_for_vsync();
+        frame(vsync_time, vsync.period());
+    }
+
+    /** Render a number of frames.
+     */
+    void run(vsync_source& vsync, std::size_t num_frames) noexcept
+    {
+        for (auto i = 0_uz; i != num_frames; ++i) {
+            run_once(vsync);
+        }
+    }
+
+    /** The number of frames that were rendered.
+     */
+    [[nodiscard]] std::size_t num_frames() const noexcept
+    {
+        return _num_frames;
+    }
+
+    /** The number of vertical-syncs on which no frame was started, because a previous frame was late.
+     */
+    [[nodiscard]] std::size_t num_missed_vsyncs() const noexcept
+    {
+        return _num_missed_vsyncs;
+    }
+
+private:
+    frame_pipeline& _pipeline;
+    render_function _render;
+
+    utc_nanoseconds _previous_vsync_time = {};
+    std::size_t _num_frames = 0;
+    std::size_t _num_missed_vsyncs = 0;
+};
+
+} // namespace hi::inline v1
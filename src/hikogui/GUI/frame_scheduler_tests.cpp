@@ -0,0 +1,141 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "frame_scheduler.hpp"
+#include "frame_pipeline.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <chrono>
+#include <vector>
+
+using namespace hi;
+using namespace std::chrono_literals;
+
+TEST(frame_scheduler, on_time)
+{
+    auto vsync = fake_vsync_source{16ms};
+    auto pipeline = frame_pipeline{};
+
+    auto display_time_points = std::vector<utc_nanoseconds>{};
+    auto scheduler = frame_scheduler{pipeline, [&](utc_nanoseconds display_time_point) {
+                                         display_time_points.push_back(display_time_point);
+                                         vsync.advance(5ms);
+                                     }};
+
+    scheduler.run(vsync, 10);
+    ASSERT_EQ(scheduler.num_frames(), 10U);
+    ASSERT_EQ(scheduler.num_missed_vsyncs(), 0U);
+
+    ASSERT_EQ(display_time_points.size(), 10U);
+    for (auto i = 1_uz; i != display_time_points.size(); ++i) {
+        ASSERT_EQ(display_time_points[i] - display_time_points[i - 1], 16ms);
+    }
+
+    ASSERT_EQ(pipeline.frame_time().count(), 9U);
+    ASSERT_EQ(pipeline.frame_time().max(), 16ms);
+}
+
+TEST(frame_scheduler, late_frames)
+{
+    auto vsync = fake_vsync_source{16ms};
+    auto pipeline = frame_pipeline{};
+
+    auto frame = 0;
+    auto scheduler = frame_scheduler{pipeline, [&](utc_nanoseconds) {
+                                         // Every 10th frame takes 40ms, which misses two vertical-syncs.
+                                         vsync.advance(++frame % 10 == 0 ? 40ms : 5ms);
+                                     }};
+
+    scheduler.run(vsync, 30);
+    ASSERT_EQ(scheduler.num_frames(), 30U);
+    // The 30th frame is late, but no frame was started after it.
+    ASSERT_EQ(scheduler.num_missed_vsyncs(), 4U);
+    ASSERT_EQ(pipeline.frame_time().max(), 48ms);
+    ASSERT_GE(pipeline.frame_time().percentile(0.5), 16ms);
+    ASSERT_LE(pipeline.frame_time().percentile(0.5), 18ms);
+}
+
+TEST(frame_scheduler, driven_by_loop)
+{
+    auto pipeline = frame_pipeline{};
+
+    auto display_time_points = std::vector<utc_nanoseconds>{};
+    auto scheduler = frame_scheduler{pipeline, [&](utc_nanoseconds display_time_point) {
+                                         display_time_points.push_back(display_time_point);
+                                     }};
+
+    // The vertical-syncs reported by the main loop jitter.
+    scheduler.frame(utc_nanoseconds{0ms}, 16ms);
+    scheduler.frame(utc_nanoseconds{17ms}, 16ms);
+    scheduler.frame(utc_nanoseconds{31ms}, 16ms);
+    ASSERT_EQ(scheduler.num_missed_vsyncs(), 0U);
+
+    // A frame that is started two periods later has missed a vertical-sync.
+    scheduler.frame(utc_nanoseconds{64ms}, 16ms);
+    ASSERT_EQ(scheduler.num_frames(), 4U);
+    ASSERT_EQ(scheduler.num_missed_vsyncs(), 1U);
+
+    ASSERT_EQ(display_time_points.back(), utc_nanoseconds{80ms});
+    ASSERT_EQ(pipeline.frame_time().count(), 3U);
+}
+
+TEST(frame_pipeline, phases)
+{
+    auto pipeline = frame_pipeline{};
+
+    for (auto i = 0; i != 5; ++i) {
+        pipeline.add_duration(frame_phase::events, 1ms);
+        pipeline.add_duration(frame_phase::events, 2ms);
+        pipeline.begin_frame();
+
+        {
+            hilet t = pipeline.measure(frame_phase::layout);
+        }
+        pipeline.add_duration(frame_phase::draw, 4ms);
+        pipeline.submit([] {});
+    }
+
+    // The events between two frames are accumulated.
+    ASSERT_EQ(pipeline[frame_phase::events].count(), 5U);
+    ASSERT_EQ(pipeline[frame_phase::events].max(), 3ms);
+    ASSERT_EQ(pipeline[frame_phase::constrain].count(), 0U);
+    ASSERT_EQ(pipeline[frame_phase::layout].count(), 5U);
+    ASSERT_EQ(pipeline[frame_phase::draw].count(), 5U);
+    ASSERT_EQ(pipeline[frame_phase::draw].mean(), 4ms);
+    ASSERT_EQ(pipeline[frame_phase::submit].count(), 5U);
+}
+
+TEST(frame_pipeline, pipelined)
+{
+    auto pipeline = frame_pipeline{true};
+    ASSERT_TRUE(pipeline.pipelined());
+
+    auto submitted = std::atomic<int>{0};
+    auto drawn = 0;
+
+    for (auto i = 0; i != 100; ++i) {
+        pipeline.begin_frame();
+
+        // The draw-phase may only start when the previous frame was submitted.
+        pipeline.wait_for_submit();
+        ASSERT_EQ(submitted.load(), drawn);
+        ++drawn;
+
+        pipeline.submit([&] {
+            ++submitted;
+        });
+    }
+
+    pipeline.wait_for_submit();
+    ASSERT_EQ(submitted.load(), 100);
+    ASSERT_EQ(pipeline[frame_phase::submit].count(), 100U);
+
+    pipeline.set_pipelined(false);
+    ASSERT_FALSE(pipeline.pipelined());
+    pipeline.submit([&] {
+        ++submitted;
+    });
+    ASSERT_EQ(submitted.load(), 101);
+}
@@ -32,7 +32,13 @@ namespace hi::inline v1 {
     auto theme_directories = make_vector(get_paths(path_location::theme_dirs));
     auto theme_book = std::make_unique<hi::theme_book>(font_book, std::move(theme_directories));
 
-    auto gfx_system = std::make_unique<hi::gfx_system_vulkan>();
+    auto gfx_system = std::unique_ptr<hi::gfx_system>{};
+    try {
+        gfx_system = std::make_unique<hi::gfx_system_vulkan>();
+    } catch (std::exception const &e) {
+        hi_log_error("Could not start Vulkan, falling back to software rendering. \"{}\"", e.what());
+        gfx_system = std::make_unique<hi::gfx_system_software>();
+    }
 
     auto keyboard_bindings = std::make_unique<hi::keyboard_bindings>();
     try {
@@ -7,10 +7,13 @@
 #include "gui_window_size.hpp"
 #include "mouse_cursor.hpp"
 #include "hitbox.hpp"
+#include "hitbox_index.hpp"
 #include "gui_event.hpp"
 #include "keyboard_focus_direction.hpp"
 #include "keyboard_focus_group.hpp"
 #include "theme.hpp"
+#include "frame_pipeline.hpp"
+#include "frame_scheduler.hpp"
 #include "widget_intf.hpp"
 #include "../unicode/module.hpp"
 #include "../GFX/module.hpp"
@@ -92,7 +95,10 @@ public:
      */
     notifier<void()> closing;
 
-    gui_window(gui_system& gui, std::unique_ptr<widget_intf> widget) noexcept : gui(gui), _widget(std::move(widget)) {}
+    gui_window(gui_system& gui, std::unique_ptr<widget_intf> widget) noexcept : gui(gui), _widget(std::move(widget))
+    {
+        _widget->set_hitbox_index(&_hitbox_index);
+    }
 
     virtual ~gui_window();
 
@@ -112,6 +118,23 @@ public:
      */
     virtual void render(utc_nanoseconds displayTimePoint);
 
+    /** Execute the submit-phase of rendering on a separate thread.
+     *
+     * Pipelining is disabled by default. When enabled, the handling of events, constrain and layout of the next frame
+     * overlap with the submission of the current frame to the GPU.
+     */
+    void set_frame_pipelining(bool enable) noexcept
+    {
+        _frame_pipeline.set_pipelined(enable);
+    }
+
+    /** The timing statistics of the phases of rendering frames.
+     */
+    [[nodiscard]] frame_pipeline const& frame_statistics() const noexcept
+    {
+        return _frame_pipeline;
+    }
+
     template<typename Widget>
     [[nodiscard]] Widget& widget() const noexcept
     {
@@ -237,14 +260,33 @@ protected:
      */
     label _title;
 
+    /** The spatial index of the widgets, used to find the widget under the mouse cursor.
+     *
+     * This is declared before `_widget`, so that the widgets can remove themselves
+     * from the index during their destruction.
+     */
+    hitbox_index _hitbox_index;
+
     /** The widget covering the complete window.
      */
     std::unique_ptr<widget_intf> _widget;
 
     box_constraints _widget_constraints = {};
 
-    std::atomic<aarectangle> _redraw_rectangle = aarectangle{};
+    /** The part of the window that needs to be redrawn.
+     */
+    damage_region _redraw_region = {};
+
+    /** A window-wide relayout was requested.
+     *
+     * Widgets request a relayout of their own subtree with `widget_intf::request_relayout()`.
+     */
     std::atomic<bool> _relayout = false;
+
+    /** A window-wide reconstrain was requested, for example on a change of theme.
+     *
+     * Widgets request a reconstrain of their own subtree with `widget_intf::request_reconstrain()`.
+     */
     std::atomic<bool> _reconstrain = false;
     std::atomic<bool> _resize = false;
 
@@ -265,6 +307,22 @@ protected:
      */
     utc_nanoseconds last_forced_redraw = {};
 
+    /** The pipeline for rendering frames, which also collects the timing of each phase.
+     */
+    frame_pipeline _frame_pipeline;
+
+    /** Starts a frame on each vertical-sync from the main loop, and renders it.
+     */
+    frame_scheduler _frame_scheduler{_frame_pipeline, [this](utc_nanoseconds display_time_point) {
+                                         this->render(display_time_point);
+                                     }};
+
+    /** The number of calls to `process_event()` that are currently executing.
+     *
+     * Events that are sent while handling an event are not measured separately.
+     */
+    std::size_t _event_depth = 0;
+
     /** The animated version of the `active` flag.
      */
     animator<float> _animated_active = _animation_duration;
@@ -10,6 +10,7 @@
 #include "../GFX/module.hpp"
 #include "../telemetry/module.hpp"
 #include "../macros.hpp"
+#include <optional>
 
 namespace hi::inline v1 {
 
@@ -19,6 +20,8 @@ gui_window::~gui_window()
     _widget = {};
 
     try {
+        // The submit thread may still be using the surface.
+        _frame_pipeline.wait_for_submit();
         surface.reset();
         hi_log_info("Window '{}' has been properly destructed.", _title);
 
@@ -30,6 +33,7 @@ gui_window::~gui_window()
 void gui_window::set_device(gfx_device *device) noexcept
 {
     hi_assert_not_null(surface);
+    _frame_pipeline.wait_for_submit();
     surface->set_device(device);
 }
 
@@ -46,8 +50,9 @@ void gui_window::render(utc_nanoseconds display_time_point)
     hi_assert_not_null(surface);
     hi_assert_not_null(_widget);
 
-    // When a widget requests it or a window-wide event like language change
-    // has happened all the widgets will be set_constraints().
+    // When a window-wide event like language change has happened all the widgets
+    // will be reconstrained. When a widget requests it, only that widget's subtree
+    // is reconstrained.
     auto need_reconstrain = _reconstrain.exchange(false, std::memory_order_relaxed);
 
 #if 0
@@ -56,11 +61,14 @@ void gui_window::render(utc_nanoseconds display_time_point)
 #endif
 
     if (need_reconstrain) {
-        hilet t2 = trace<"window::constrain">();
-
         theme = gui.theme_book->find(*gui.selected_theme, os_settings::theme_mode()).transform(dpi);
+        _widget->request_reconstrain_recursive();
+    }
 
-        _widget_constraints = _widget->update_constraints();
+    if (_widget->needs_reconstrain()) {
+        hilet t2 = trace<"window::constrain">();
+        hilet t3 = _frame_pipeline.measure(frame_phase::constrain);
+        _widget_constraints = _widget->reconstrain();
     }
 
     // Check if the window size matches the preferred size of the window_widget.
@@ -98,38 +106,46 @@ void gui_window::render(utc_nanoseconds display_time_point)
         return;
     }
 
-    // Update the graphics' surface to the current size of the window.
-    surface->update(rectangle.size());
-
     // Make sure the widget's layout is updated before draw, but after window resize.
-    auto need_relayout = _relayout.exchange(false, std::memory_order_relaxed);
+    if (_relayout.exchange(false, std::memory_order_relaxed)) {
+        _widget->request_relayout();
+    }
 
 #if 0
     // For performance checks force relayout.
-    need_relayout = true;
+    _widget->request_relayout();
 #endif
 
-    if (need_reconstrain or need_relayout or widget_size != rectangle.size()) {
+    if (_widget->needs_relayout() or widget_size != rectangle.size()) {
         hilet t2 = trace<"window::layout">();
+        hilet t3 = _frame_pipeline.measure(frame_phase::layout);
         widget_size = rectangle.size();
 
         // Guarantee that the layout size is always at least the minimum size.
         // We do this because it simplifies calculations if no minimum checks are necessary inside widget.
+        // Only the widgets whose layout changed, or that requested a relayout, will have set_layout() called.
         hilet widget_layout_size = max(_widget_constraints.minimum, widget_size);
-        _widget->set_layout(widget_layout{widget_layout_size, _size_state, subpixel_orientation(), display_time_point});
+        _widget->relayout(widget_layout{widget_layout_size, _size_state, subpixel_orientation(), display_time_point});
 
         // After layout do a complete redraw.
-        _redraw_rectangle = aarectangle{widget_size};
+        _redraw_region = aarectangle{widget_size};
     }
 
 #if 0
     // For performance checks force redraw.
-    _redraw_rectangle = aarectangle{widget_size};
+    _redraw_region = aarectangle{widget_size};
 #endif
 
-    // Draw widgets if the _redraw_rectangle was set.
-    if (auto draw_context = surface->render_start(_redraw_rectangle)) {
-        _redraw_rectangle = aarectangle{};
+    // The layout of this frame may overlap with the submit of the previous frame,
+    // but the surface and its vertex buffers are in use until the submit has finished.
+    _frame_pipeline.wait_for_submit();
+
+    // Update the graphics' surface to the current size of the window.
+    surface->update(rectangle.size());
+
+    // Draw widgets if the _redraw_region was set.
+    if (auto draw_context = surface->render_start(_redraw_region)) {
+        _redraw_region.clear();
         draw_context.display_time_point = display_time_point;
         draw_context.subpixel_orientation = subpixel_orientation();
         draw_context.active = active;
@@ -141,12 +157,14 @@ void gui_window::render(utc_nanoseconds display_time_point)
 
         {
             hilet t2 = trace<"window::draw">();
+            hilet t3 = _frame_pipeline.measure(frame_phase::draw);
             _widget->draw(draw_context);
         }
-        {
+
+        _frame_pipeline.submit([this, draw_context] {
             hilet t2 = trace<"window::submit">();
             surface->render_finish(draw_context);
-        }
+        });
     }
 }
 
@@ -243,11 +261,21 @@ bool gui_window::process_event(gui_event const& event) noexcept
 
     hi_axiom(loop::main().on_thread());
 
+    // Only top-level events are measured, the events they cause are part of their duration.
+    auto t1 = std::optional<frame_pipeline::phase_timer>{};
+    if (_event_depth == 0) {
+        t1.emplace(_frame_pipeline, frame_phase::events);
+    }
+    ++_event_depth;
+    hilet d = defer([&] {
+        --_event_depth;
+    });
+
     auto events = std::vector<gui_event>{event};
 
     switch (event.type()) {
     case window_redraw:
-        _redraw_rectangle.fetch_or(event.rectangle());
+        _redraw_region |= event.rectangle();
         return true;
 
     case window_relayout:
@@ -306,7 +334,7 @@ bool gui_window::process_event(gui_event const& event) noexcept
     case mouse_down:
     case mouse_move:
         {
-            hilet hitbox = _widget->hitbox_test(event.mouse().position);
+            hilet hitbox = _widget->indexed_hitbox_test(event.mouse().position);
             update_mouse_target(hitbox.widget_id, event.mouse().position);
 
             if (event == mouse_down) {
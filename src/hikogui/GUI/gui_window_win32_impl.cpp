@@ -186,7 +186,7 @@ gui_window_win32::gui_window_win32(gui_system& gui, std::unique_ptr<widget_intf>
     // Execute a constraint check to determine initial window size.
     theme = gui.theme_book->find(*gui.selected_theme, os_settings::theme_mode()).transform(dpi);
 
-    _widget_constraints = _widget->update_constraints();
+    _widget_constraints = _widget->reconstrain();
     hilet new_size = _widget_constraints.preferred;
 
     // Reset the keyboard target to not focus anything.
@@ -209,8 +209,8 @@ gui_window_win32::gui_window_win32(gui_system& gui, std::unique_ptr<widget_intf>
         },
         callback_flags::main);
 
-    _render_cbt = loop::main().subscribe_render([this](utc_nanoseconds display_time) {
-        this->render(display_time);
+    _render_cbt = loop::main().subscribe_render([this](utc_nanoseconds vsync_time, std::chrono::nanoseconds period) {
+        _frame_scheduler.frame(vsync_time, period);
     });
 
     // Delegate has been called, layout of widgets has been calculated for the
@@ -927,7 +927,7 @@ int gui_window_win32::windowProc(unsigned int uMsg, uint64_t wParam, int64_t lPa
             // Convert to y-axis up coordinate system.
             hilet inv_y = os_settings::primary_monitor_rectangle().height() - y;
 
-            hilet hitbox_type = _widget->hitbox_test(screen_to_window() * point2{x, inv_y}).type;
+            hilet hitbox_type = _widget->indexed_hitbox_test(screen_to_window() * point2{x, inv_y}).type;
 
             switch (hitbox_type) {
             case hitbox_type::bottom_resize_border:
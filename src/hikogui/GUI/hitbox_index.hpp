@@ -0,0 +1,293 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../geometry/module.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <vector>
+#include <unordered_map>
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <cmath>
+
+namespace hi::inline v1 {
+class widget_intf;
+
+/** A spatial index of the rectangles of the widgets in a window.
+ *
+ * The index is a uniform grid of cells over the window, each cell holds the
+ * widgets whose rectangle overlaps with the cell. Finding the widgets at a
+ * position only checks the rectangles in a single cell.
+ *
+ * The index is updated incrementally by `widget_intf::relayout()` when a widget is
+ * laid out, and by the destructor of a widget. It is used by
+ * `widget_intf::indexed_hitbox_test()` to only test the widgets below the mouse cursor.
+ */
+class hitbox_index {
+public:
+    /** The width and height of a cell in the grid.
+     */
+    constexpr static float cell_size = 64.0f;
+
+    /** The maximum number of columns and rows of the grid.
+     *
+     * Rectangles outside of the grid are clamped to the cells on the edge of the grid.
+     */
+    constexpr static std::size_t max_cells = 256;
+
+    ~hitbox_index() = default;
+    hitbox_index(hitbox_index const&) = delete;
+    hitbox_index(hitbox_index&&) = delete;
+    hitbox_index& operator=(hitbox_index const&) = delete;
+    hitbox_index& operator=(hitbox_index&&) = delete;
+    hitbox_index() noexcept = default;
+
+    /** The number of widgets in the index.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _slots.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _slots.empty();
+    }
+
+    /** Insert a widget, or update the rectangle of a widget.
+     *
+     * @param widget The widget to add to the index.
+     * @param rectangle The rectangle of the widget in window coordinates.
+     */
+    void insert(widget_intf const *widget, aarectangle rectangle) noexcept
+    {
+        hi_axiom_not_null(widget);
+
+        if (rectangle.empty()) {
+            return erase(widget);
+        }
+
+        auto slot = 0_uz;
+        if (hilet it = _slots.find(widget); it != _slots.end()) {
+            slot = it->second;
+            if (_entries[slot].rectangle == rectangle) {
+                return;
+            }
+            remove_from_cells(slot);
+
+        } else if (not _free_slots.empty()) {
+            slot = _free_slots.back();
+            _free_slots.pop_back();
+            _slots[widget] = slot;
+
+        } else {
+            slot = _entries.size();
+            _entries.emplace_back();
+            _slots[widget] = slot;
+        }
+
+        _entries[slot] = entry_type{widget, rectangle};
+        if (not grow(rectangle)) {
+            add_to_cells(slot);
+        }
+    }
+
+    /** Remove a widget from the index.
+     *
+     * @param widget The widget to remove, this widget does not need to be in the index.
+     */
+    void erase(widget_intf const *widget) noexcept
+    {
+        if (hilet it = _slots.find(widget); it != _slots.end()) {
+            hilet slot = it->second;
+            _slots.erase(it);
+
+            remove_from_cells(slot);
+            _entries[slot] = entry_type{};
+            _free_slots.push_back(slot);
+        }
+    }
+
+    /** Remove all widgets from the index.
+     */
+    void clear() noexcept
+    {
+        _entries.clear();
+        _free_slots.clear();
+        _slots.clear();
+        for (auto& cell : _cells) {
+            cell.clear();
+        }
+    }
+
+    /** Call a function for each widget whose rectangle contains the position.
+     *
+     * @param position The position in window coordinates.
+     * @param func The function to call with a reference to each widget.
+     */
+    template<typename Func>
+    void find(point2 position, Func&& func) const noexcept
+    {
+        if (_cells.empty()) {
+            return;
+        }
+
+        hilet column = cell_column(position.x());
+        hilet row = cell_row(position.y());
+        for (hilet slot : _cells[row * _num_columns + column]) {
+            hilet& entry = _entries[slot];
+            if (entry.rectangle.contains(position)) {
+                func(*entry.widget);
+            }
+        }
+    }
+
+    /** Start a query on the index.
+     *
+     * @return A new generation number, used by widgets to mark themselves
+     *         as part of this query.
+     */
+    [[nodiscard]] std::size_t begin_query() noexcept
+    {
+        _query_generation = ++_generation;
+        return _query_generation;
+    }
+
+    /** Finish the query started with `begin_query()`.
+     */
+    void end_query() noexcept
+    {
+        _query_generation = 0;
+    }
+
+    /** The generation of the current query.
+     *
+     * @retval 0 When there is no query in progress.
+     */
+    [[nodiscard]] std::size_t query_generation() const noexcept
+    {
+        return _query_generation;
+    }
+
+private:
+    struct entry_type {
+        widget_intf const *widget = nullptr;
+        aarectangle rectangle = {};
+    };
+
+    /** The widgets and their rectangles.
+     * The slots of removed widgets are reused, see `_free_slots`.
+     */
+    std::vector<entry_type> _entries;
+
+    /** The slots in `_entries` that are not in use.
+     */
+    std::vector<std::size_t> _free_slots;
+
+    /** The slot in `_entries` of each widget.
+     */
+    std::unordered_map<widget_intf const *, std::size_t> _slots;
+
+    /** The cells of the grid, row-major.
+     * Each cell holds the slots of the entries that overlap with the cell.
+     */
+    std::vector<std::vector<std::size_t>> _cells;
+    std::size_t _num_columns = 0;
+    std::size_t _num_rows = 0;
+
+    std::size_t _generation = 0;
+    std::size_t _query_generation = 0;
+
+    [[nodiscard]] static std::size_t cell_index(float coordinate, std::size_t num_cells) noexcept
+    {
+        hilet index = std::floor(coordinate / cell_size);
+        if (not(index > 0.0f)) {
+            // Also handles NaN.
+            return 0;
+        } else if (index >= narrow_cast<float>(num_cells - 1)) {
+            return num_cells - 1;
+        } else {
+            return static_cast<std::size_t>(index);
+        }
+    }
+
+    [[nodiscard]] std::size_t cell_column(float x) const noexcept
+    {
+        return cell_index(x, _num_columns);
+    }
+
+    [[nodiscard]] std::size_t cell_row(float y) const noexcept
+    {
+        return cell_index(y, _num_rows);
+    }
+
+    /** Call a function for each cell that overlaps with the rectangle.
+     */
+    template<typename Func>
+    void for_each_cell(aarectangle const& rectangle, Func&& func) noexcept
+    {
+        hilet first_column = cell_column(rectangle.left());
+        hilet last_column = cell_column(rectangle.right());
+        hilet first_row = cell_row(rectangle.bottom());
+        hilet last_row = cell_row(rectangle.top());
+
+        for (auto row = first_row; row <= last_row; ++row) {
+            for (auto column = first_column; column <= last_column; ++column) {
+                func(_cells[row * _num_columns + column]);
+            }
+        }
+    }
+
+    void add_to_cells(std::size_t slot) noexcept
+    {
+        for_each_cell(_entries[slot].rectangle, [slot](auto& cell) {
+            cell.push_back(slot);
+        });
+    }
+
+    void remove_from_cells(std::size_t slot) noexcept
+    {
+        for_each_cell(_entries[slot].rectangle, [slot](auto& cell) {
+            if (hilet it = std::find(cell.begin(), cell.end(), slot); it != cell.end()) {
+                *it = cell.back();
+                cell.pop_back();
+            }
+        });
+    }
+
+    /** Grow the grid so that it covers the rectangle.
+     *
+     * When the grid grows, all the entries are redistributed over the new cells.
+     *
+     * @return True if the grid has grown and all entries were added to the cells.
+     */
+    bool grow(aarectangle const& rectangle) noexcept
+    {
+        hilet num_cells = [](float coordinate) {
+            return std::clamp(static_cast<std::size_t>(std::max(0.0f, std::ceil(coordinate / cell_size))), 1_uz, max_cells);
+        };
+
+        hilet new_num_columns = std::max(_num_columns, num_cells(rectangle.right()));
+        hilet new_num_rows = std::max(_num_rows, num_cells(rectangle.top()));
+        if (new_num_columns == _num_columns and new_num_rows == _num_rows) {
+            return false;
+        }
+
+        _num_columns = new_num_columns;
+        _num_rows = new_num_rows;
+        _cells.clear();
+        _cells.resize(_num_columns * _num_rows);
+        for (auto slot = 0_uz; slot != _entries.size(); ++slot) {
+            if (_entries[slot].widget != nullptr) {
+                add_to_cells(slot);
+            }
+        }
+        return true;
+    }
+};
+
+} // namespace hi::inline v1
@@ -1,6 +1,8 @@
 
 #pragma once
 
+#include "frame_pipeline.hpp"
+#include "frame_scheduler.hpp"
 #include "gui_event.hpp"
 #include "gui_event_type.hpp"
 #include "gui_event_variant.hpp"
@@ -11,6 +13,7 @@
 #include "gui_window_size.hpp"
 #include "gui_window_win32.hpp"
 #include "hitbox.hpp"
+#include "hitbox_index.hpp"
 #include "keyboard_bindings.hpp"
 #include "keyboard_focus_direction.hpp"
 #include "keyboard_focus_group.hpp"
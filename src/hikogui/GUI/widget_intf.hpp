@@ -3,6 +3,8 @@
 #pragma once
 
 #include "hitbox.hpp"
+#include "hitbox_index.hpp"
+#include "gui_event.hpp"
 #include "widget_layout.hpp"
 #include "widget_id.hpp"
 #include "keyboard_focus_group.hpp"
@@ -27,7 +29,12 @@ public:
      */
     widget_intf *parent = nullptr;
 
-    virtual ~widget_intf() = default;
+    virtual ~widget_intf()
+    {
+        if (_hitbox_index != nullptr) {
+            _hitbox_index->erase(this);
+        }
+    }
 
     widget_intf(widget_intf *parent) noexcept : id(narrow_cast<uint32_t>(++global_counter<"widget::id">)), parent(parent) {}
 
@@ -58,6 +65,29 @@ public:
         }
     }
 
+    /** Call a function for each child widget.
+     *
+     * The recursive passes over the widget tree use this function instead of
+     * `children()`, because it does not allocate a coroutine frame for each widget.
+     * An override must visit the same children as `children()`.
+     *
+     * @param include_invisible Also visit the children that are invisible.
+     * @param func The function to call with a reference to each child.
+     */
+    virtual void for_each_child(bool include_invisible, function_ref<void(widget_intf&)> func) noexcept = 0;
+
+    /** Call a function for each child widget.
+     *
+     * @param include_invisible Also visit the children that are invisible.
+     * @param func The function to call with a reference to each child.
+     */
+    void for_each_child(bool include_invisible, function_ref<void(widget_intf const&)> func) const noexcept
+    {
+        const_cast<widget_intf *>(this)->for_each_child(include_invisible, [&](widget_intf& child) {
+            func(child);
+        });
+    }
+
     /** Update the constraints of the widget.
      *
      * Typically the implementation of this function starts with recursively calling update_constraints()
@@ -88,6 +118,145 @@ public:
      */
     virtual widget_layout const& layout() const noexcept = 0;
 
+    /** Update the constraints of the widget, when needed.
+     *
+     * A parent calls this function on its children instead of `update_constraints()`.
+     * Only the widgets that requested a reconstrain, and the widgets with a
+     * descendant that requested a reconstrain, are visited. A parent only
+     * re-runs its own `update_constraints()` when the constraints of one of its
+     * children changed; the propagation stops at a widget whose constraints
+     * did not change.
+     *
+     * The number of widgets visited is counted in the "widget:reconstrain" counter.
+     *
+     * @return The constraints of this widget.
+     */
+    box_constraints const& reconstrain() noexcept
+    {
+        if (_reconstrain) {
+            _reconstrain = false;
+            _reconstrain_descendant = false;
+            ++global_counter<"widget:reconstrain">;
+
+            _constraints = update_constraints();
+            // update_constraints() resets the layout of the widget.
+            _relayout = true;
+            _draw_list_valid = false;
+
+        } else if (_reconstrain_descendant) {
+            _reconstrain_descendant = false;
+            ++global_counter<"widget:reconstrain">;
+
+            auto children_changed = false;
+            for_each_child(true, [&](widget_intf& child) {
+                hilet old_constraints = child._constraints;
+                children_changed |= child.reconstrain() != old_constraints;
+            });
+
+            if (children_changed) {
+                // The children return their cached constraints.
+                _constraints = update_constraints();
+                _relayout = true;
+                _draw_list_valid = false;
+            }
+        }
+
+        return _constraints;
+    }
+
+    /** Update the layout of the widget, when needed.
+     *
+     * A parent calls this function on its children instead of `set_layout()`.
+     * `set_layout()` is only called when the layout has changed, ignoring the
+     * display time point, or when the widget was reconstrained or requested a
+     * relayout. Otherwise the layout is only passed to the descendants that
+     * need it.
+     *
+     * The number of widgets laid out is counted in the "widget:relayout" counter.
+     *
+     * @param context The layout for this widget.
+     */
+    void relayout(widget_layout const& context) noexcept
+    {
+        if (_relayout or not equal_except_time(_layout_context, context)) {
+            if (_relayout) {
+                // A relayout was requested because the state of the widget changed; while
+                // a change in position only, for example when scrolling, keeps the draw-list.
+                _draw_list_valid = false;
+            }
+            _relayout = false;
+            _relayout_descendant = false;
+            _layout_context = context;
+            ++global_counter<"widget:relayout">;
+
+            if (parent != nullptr) {
+                _hitbox_index = parent->_hitbox_index;
+            }
+
+            set_layout(context);
+            update_hitbox_index();
+
+        } else if (_relayout_descendant) {
+            _relayout_descendant = false;
+
+            for_each_child(false, [](widget_intf& child) {
+                child.relayout(child._layout_context);
+            });
+        }
+    }
+
+    /** Check if this widget, or one of its descendants, needs to be reconstrained.
+     */
+    [[nodiscard]] bool needs_reconstrain() const noexcept
+    {
+        return _reconstrain or _reconstrain_descendant;
+    }
+
+    /** Check if this widget, or one of its descendants, needs to be laid out.
+     */
+    [[nodiscard]] bool needs_relayout() const noexcept
+    {
+        return _relayout or _relayout_descendant;
+    }
+
+    /** Request this widget to be reconstrained and laid out on the next frame.
+     *
+     * The ancestors of this widget are marked so that `reconstrain()` and
+     * `relayout()` will find this widget, without visiting the rest of the tree.
+     */
+    void request_reconstrain() const noexcept
+    {
+        _reconstrain = true;
+        _relayout = true;
+        for (auto w = parent; w != nullptr and not (w->_reconstrain_descendant and w->_relayout_descendant); w = w->parent) {
+            w->_reconstrain_descendant = true;
+            w->_relayout_descendant = true;
+        }
+    }
+
+    /** Request this widget to be laid out on the next frame.
+     */
+    void request_relayout() const noexcept
+    {
+        _relayout = true;
+        for (auto w = parent; w != nullptr and not w->_relayout_descendant; w = w->parent) {
+            w->_relayout_descendant = true;
+        }
+    }
+
+    /** Request this widget and all its descendants to be reconstrained.
+     *
+     * This is used for window-wide changes, such as a change of theme or language.
+     */
+    void request_reconstrain_recursive() noexcept
+    {
+        _reconstrain = true;
+        _relayout = true;
+        for_each_child(true, [](widget_intf& child) {
+            child.request_reconstrain_recursive();
+        });
+    }
+
     /** Draw the widget.
      *
      * This function is called by the window (optionally) on every frame.
@@ -113,6 +282,69 @@ public:
      */
     [[nodiscard]] virtual hitbox hitbox_test(point2 position) const noexcept = 0;
 
+    /** Set the hitbox index of the window.
+     *
+     * This is called by the window on the top-level widget. The descendants
+     * use the same index, which is updated when a widget is laid out.
+     *
+     * @param index The hitbox index of the window, or nullptr to stop indexing.
+     */
+    void set_hitbox_index(hitbox_index *index) noexcept
+    {
+        _hitbox_index = index;
+        request_relayout();
+    }
+
+    /** Find the widget that is under the mouse cursor, using the hitbox index.
+     *
+     * This returns the same hitbox as `hitbox_test()`. The hitbox index is used to
+     * find the widgets whose rectangle contains the position; only these widgets
+     * and their ancestors are tested, the `hitbox_test_from_parent()` of other
+     * widgets returns immediately.
+     *
+     * This relies on a widget only returning a hitbox when the position is inside
+     * its clipped rectangle, or inside the clipped rectangle of one of its descendants.
+     * The top-level widget is always tested, it may return a hitbox outside its rectangle.
+     *
+     * @param position The coordinate of the mouse local to the widget.
+     * @return A hit_box object with the cursor-type and a reference to the widget.
+     */
+    [[nodiscard]] hitbox indexed_hitbox_test(point2 position) const noexcept
+    {
+        if (_hitbox_index == nullptr) {
+            return hitbox_test(position);
+        }
+
+        hilet generation = _hitbox_index->begin_query();
+        _hitbox_generation = generation;
+
+        // The position is local to this widget, while the index is in window coordinates.
+        _hitbox_index->find(layout().to_window * position, [generation](widget_intf const& widget) {
+            for (auto w = &widget; w != nullptr and w->_hitbox_generation != generation; w = w->parent) {
+                w->_hitbox_generation = generation;
+            }
+        });
+
+        hilet r = hitbox_test(position);
+        _hitbox_index->end_query();
+        return r;
+    }
+
+    /** Check if the hitbox test of this widget can be skipped.
+     *
+     * @return True during `indexed_hitbox_test()` when neither this widget nor
+     *         any of its descendants is at the mouse cursor.
+     */
+    [[nodiscard]] bool hitbox_test_is_skipped() const noexcept
+    {
+        if (_hitbox_index == nullptr) {
+            return false;
+        }
+
+        hilet generation = _hitbox_index->query_generation();
+        return generation != 0 and generation != _hitbox_generation;
+    }
+
     /** Check if the widget will accept keyboard focus.
      *
      */
@@ -122,6 +354,15 @@ public:
      */
     virtual void request_redraw() const noexcept = 0;
 
+    /** Discard the draw commands that were recorded by `draw_retained()`.
+     *
+     * This is called by `request_redraw()` and when the widget is reconstrained.
+     */
+    void invalidate_draw_list() const noexcept
+    {
+        _draw_list_valid = false;
+    }
+
     /** Send a event to the window.
      */
     virtual bool process_event(gui_event const& event) const noexcept = 0;
@@ -197,6 +438,133 @@ public:
     {
         scroll_to_show(layout().rectangle());
     }
+
+protected:
+    /** Draw the widget using a retained draw-list.
+     *
+     * The commands drawn by @a draw_function are recorded in the local coordinate
+     * system of the widget. On following frames the draw-list is replayed with the
+     * current layout, without calling @a draw_function, until the widget requests a
+     * redraw, is reconstrained or changes shape. Moving, scrolling or clipping the
+     * widget does not require the draw-list to be recorded again.
+     *
+     * This should only be used by a widget that does not draw its children, and
+     * that calls `request_redraw()` whenever the state it draws changes.
+     *
+     * The number of recordings is counted in the "widget:draw:record" counter.
+     *
+     * @param context The context to where the widget will draw.
+     * @param draw_function The function that draws the widget into the given context.
+     */
+    template<std::invocable<draw_context const&> DrawFunction>
+    void draw_retained(draw_context const& context, DrawFunction&& draw_function) noexcept
+    {
+        hilet& layout_ = layout();
+        if (not overlaps(context, layout_)) {
+            return;
+        }
+
+        if (not _draw_list_valid or _draw_list_shape != layout_.shape) {
+            ++global_counter<"widget:draw:record">;
+            // Validate before drawing, so that a redraw requested while drawing invalidates the draw-list.
+            _draw_list_valid = true;
+            _draw_list_shape = layout_.shape;
+            std::forward<DrawFunction>(draw_function)(context.record(_draw_list));
+        }
+
+        if (not context.draw(layout_, _draw_list)) {
+            // Continue redrawing until the images are loaded.
+            request_redraw();
+        }
+    }
+
+    /** Handle a reconstrain or relayout request send by this widget.
+     *
+     * This is called by `process_event()` before the event is forwarded to the
+     * parent. Instead of forwarding, the request marks the widget and its
+     * ancestors, so that only this subtree is updated on the next frame.
+     *
+     * @param event The event passed to `process_event()`.
+     * @return True if the event was a reconstrain or relayout request.
+     */
+    bool process_update_request(gui_event const& event) const noexcept
+    {
+        switch (event.type()) {
+        case gui_event_type::window_reconstrain:
+            request_reconstrain();
+            return true;
+
+        case gui_event_type::window_relayout:
+            request_relayout();
+            return true;
+
+        default:
+            return false;
+        }
+    }
+
+private:
+    /** This widget needs to be reconstrained.
+     */
+    mutable bool _reconstrain = true;
+
+    /** A descendant of this widget needs to be reconstrained.
+     */
+    mutable bool _reconstrain_descendant = false;
+
+    /** This widget needs to be laid out.
+     */
+    mutable bool _relayout = true;
+
+    /** A descendant of this widget needs to be laid out.
+     */
+    mutable bool _relayout_descendant = false;
+
+    /** The constraints returned by the last call to `update_constraints()`.
+     */
+    box_constraints _constraints = {};
+
+    /** The layout passed to the last call to `set_layout()`.
+     */
+    widget_layout _layout_context = {};
+
+    /** The hitbox index of the window, shared by all widgets in the window.
+     */
+    hitbox_index *_hitbox_index = nullptr;
+
+    /** The generation of the last `indexed_hitbox_test()` that included this widget.
+     */
+    mutable std::size_t _hitbox_generation = 0;
+
+    /** The draw commands recorded by `draw_retained()`.
+     */
+    draw_list _draw_list;
+
+    /** The shape of the widget when `_draw_list` was recorded.
+     */
+    box_shape _draw_list_shape = {};
+
+    /** The draw-list may be replayed.
+     */
+    mutable bool _draw_list_valid = false;
+
+    /** Update the rectangle of this widget in the hitbox index.
+     *
+     * The rectangle is expanded by one pixel, so that rounding differences between
+     * window and local coordinates never exclude a widget.
+     */
+    void update_hitbox_index() noexcept
+    {
+        if (_hitbox_index != nullptr) {
+            hilet& layout_ = layout();
+            hilet rectangle = intersect(layout_.rectangle(), layout_.clipping_rectangle);
+            if (rectangle.empty()) {
+                _hitbox_index->erase(this);
+            } else {
+                _hitbox_index->insert(this, layout_.to_window * rectangle + 1.0f);
+            }
+        }
+    }
 };
 
 inline widget_intf *get_if(widget_intf *start, widget_id id, bool include_invisible) noexcept
@@ -206,12 +574,14 @@ inline widget_intf *get_if(widget_intf *start, widget_id id, bool include_invisi
     if (start->id == id) {
         return start;
     }
-    for (auto& child : start->children(include_invisible)) {
-        if (hilet r = get_if(&child, id, include_invisible); r != nullptr) {
-            return r;
+
+    widget_intf *r = nullptr;
+    start->for_each_child(include_invisible, [&](widget_intf& child) {
+        if (r == nullptr) {
+            r = get_if(&child, id, include_invisible);
         }
-    }
-    return nullptr;
+    });
+    return r;
 }
 
 inline widget_intf& get(widget_intf& start, widget_id id, bool include_invisible)
@@ -105,6 +105,17 @@ public:
     constexpr widget_layout() noexcept = default;
     [[nodiscard]] constexpr friend bool operator==(widget_layout const&, widget_layout const&) noexcept = default;
 
+    /** Check if two layouts are equal, ignoring the display time point.
+     *
+     * The display time point changes on every frame, this function is used to
+     * check if the geometry of a widget has changed.
+     */
+    [[nodiscard]] constexpr friend bool equal_except_time(widget_layout const& lhs, widget_layout rhs) noexcept
+    {
+        rhs.display_time_point = lhs.display_time_point;
+        return lhs == rhs;
+    }
+
     /** Construct a widget_layout from inside the window.
      */
     constexpr widget_layout(
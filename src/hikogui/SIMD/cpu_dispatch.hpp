@@ -0,0 +1,196 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file SIMD/cpu_dispatch.hpp Select a kernel compiled for the CPU at run-time.
+ *
+ * The SIMD types are selected at compile time through `HI_X86_64_LEVEL`. To
+ * ship a single binary that is both fast on new CPUs and still runs on old
+ * CPUs, hot kernels are compiled multiple times, once for each x86-64 level,
+ * in the `cpu_dispatch_*_impl.cpp` translation units. Each of these defines
+ * `HI_CPU_DISPATCH_NAMESPACE` and `HI_CPU_DISPATCH_LEVEL` before including
+ * `cpu_dispatch_kernels.hpp`, so that each copy of a kernel lives in its own
+ * namespace:
+ *  - `cpu_generic` (level 0) on processors other than x86-64,
+ *  - `cpu_x64v1`, `cpu_x64v2`, `cpu_x64v3` and `cpu_x64v4` (level 1 to 4) on x86-64.
+ *
+ * A `cpu_dispatch` object holds the function pointers of each copy and binds
+ * to the best copy for the current CPU on first use.
+ *
+ * The `cpu_dispatch_*_impl.cpp` files are compiled with the same compiler options
+ * as the rest of the library. Only the functions between `hi_cpu_dispatch_target_push()`
+ * and `hi_cpu_dispatch_target_pop()` are compiled for the level of the file. Any
+ * inline function or template that is defined outside of this region, including
+ * the `simd` types, is therefore compiled the same in every translation unit, and
+ * the linker may pick any of its copies.
+ *
+ * Kernel rules:
+ *  - A kernel's interface only uses scalar types, pointers and spans.
+ *  - Include every header before `hi_cpu_dispatch_target_push()`.
+ *  - Use the instructions of a level through intrinsics, guarded by
+ *    `#if HI_CPU_DISPATCH_LEVEL >= level`; not through the `HI_HAS_*` macros or
+ *    the `native_simd` types, which follow the compiler options.
+ *  - Helper functions are defined inside the `HI_CPU_DISPATCH_NAMESPACE` namespace.
+ *
+ * The level can be capped by setting the `HI_CPU_DISPATCH_MAX_LEVEL` environment
+ * variable to 1, 2, 3 or 4, for testing and benchmarking the lower variants.
+ */
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#if HI_PROCESSOR == HI_CPU_X64
+#include "../settings/cpu_id.hpp"
+#endif
+#include <array>
+#include <atomic>
+#include <algorithm>
+#include <cstdlib>
+#include <string_view>
+
+hi_export_module(hikogui.SIMD.cpu_dispatch);
+
+#if not defined(HI_CPU_DISPATCH_LEVEL) or HI_CPU_DISPATCH_LEVEL <= 1
+// Baseline x86-64 and other processors are compiled with the options of the library.
+#elif HI_CPU_DISPATCH_LEVEL == 2
+#define HI_CPU_DISPATCH_TARGET "sse3,ssse3,sse4.1,sse4.2,popcnt,cx16,sahf"
+#elif HI_CPU_DISPATCH_LEVEL == 3
+#define HI_CPU_DISPATCH_TARGET \
+    "sse3,ssse3,sse4.1,sse4.2,popcnt,cx16,sahf,avx,avx2,bmi,bmi2,f16c,fma,lzcnt,movbe,xsave"
+#elif HI_CPU_DISPATCH_LEVEL == 4
+#define HI_CPU_DISPATCH_TARGET \
+    "sse3,ssse3,sse4.1,sse4.2,popcnt,cx16,sahf,avx,avx2,bmi,bmi2,f16c,fma,lzcnt,movbe,xsave," \
+    "avx512f,avx512bw,avx512cd,avx512dq,avx512vl"
+#else
+#error "HI_CPU_DISPATCH_LEVEL must be 0 to 4"
+#endif
+
+/** Compile the functions that follow for the CPU level of the cpu_dispatch translation unit.
+ *
+ * MSVC allows the intrinsics of every level in any function, and does not
+ * generate instructions beyond the compiler options for other code.
+ */
+#if defined(HI_CPU_DISPATCH_TARGET) and HI_COMPILER == HI_CC_CLANG
+#define hi_cpu_dispatch_target_push() \
+    _Pragma(hi_stringify(clang attribute push(__attribute__((target(HI_CPU_DISPATCH_TARGET))), apply_to = function)))
+#define hi_cpu_dispatch_target_pop() _Pragma("clang attribute pop")
+#elif defined(HI_CPU_DISPATCH_TARGET) and HI_COMPILER == HI_CC_GCC
+#define hi_cpu_dispatch_target_push() _Pragma("GCC push_options") _Pragma(hi_stringify(GCC target(HI_CPU_DISPATCH_TARGET)))
+#define hi_cpu_dispatch_target_pop() _Pragma("GCC pop_options")
+#else
+#define hi_cpu_dispatch_target_push()
+#define hi_cpu_dispatch_target_pop()
+#endif
+
+namespace hi { inline namespace v1 {
+
+/** The level of the CPU, capped by the `HI_CPU_DISPATCH_MAX_LEVEL` environment variable.
+ *
+ * @return The x86-64 level 1 to 4, or 0 on other processors.
+ */
+hi_export [[nodiscard]] inline int cpu_dispatch_level() noexcept
+{
+    static hilet r = [] {
+#if HI_PROCESSOR == HI_CPU_X64
+        auto level = cpu_id{}.x86_64_level();
+#else
+        auto level = 0;
+#endif
+
+        if (hilet env = std::getenv("HI_CPU_DISPATCH_MAX_LEVEL")) {
+            hilet str = std::string_view{env};
+            if (str.size() == 1 and str[0] >= '1' and str[0] <= '4') {
+                level = std::min(level, str[0] - '0');
+            }
+        }
+        return level;
+    }();
+    return r;
+}
+
+hi_export template<typename Signature>
+class cpu_dispatch;
+
+/** A function that forwards to the variant compiled for the current CPU.
+ *
+ * @tparam Result The return type of the kernel.
+ * @tparam Args The argument types of the kernel.
+ */
+hi_export template<typename Result, typename... Args>
+class cpu_dispatch<Result(Args...)> {
+public:
+    using function_type = Result (*)(Args...);
+
+    /** The number of variants, indexed by level.
+     *
+     * Index 0 is the generic variant for non-x86-64 processors, index 1 to 4
+     * are the x86-64 levels.
+     */
+    constexpr static size_t num_levels = 5;
+
+    constexpr cpu_dispatch(cpu_dispatch const&) noexcept = delete;
+    constexpr cpu_dispatch(cpu_dispatch&&) noexcept = delete;
+    constexpr cpu_dispatch& operator=(cpu_dispatch const&) noexcept = delete;
+    constexpr cpu_dispatch& operator=(cpu_dispatch&&) noexcept = delete;
+
+    /** Dispatch to a single generic variant.
+     */
+    constexpr explicit cpu_dispatch(function_type generic) noexcept : _variants{generic} {}
+
+    /** Dispatch between the variants for each x86-64 level.
+     *
+     * @param v1 The variant for x86-64-v1, which every x86-64 CPU can run.
+     * @param v2 The variant for x86-64-v2 or nullptr to use a lower variant.
+     * @param v3 The variant for x86-64-v3 or nullptr to use a lower variant.
+     * @param v4 The variant for x86-64-v4 or nullptr to use a lower variant.
+     */
+    constexpr cpu_dispatch(function_type v1, function_type v2, function_type v3, function_type v4) noexcept :
+        _variants{v1, v1, v2, v3, v4}
+    {
+    }
+
+    /** Get the variant for a level.
+     *
+     * @param level The maximum level of the variant.
+     * @return The variant for the highest level at or below @a level.
+     */
+    [[nodiscard]] constexpr function_type get(int level) const noexcept
+    {
+        hi_axiom(level >= 0 and level < narrow_cast<int>(num_levels));
+
+        for (auto i = narrow_cast<size_t>(level) + 1; i != 0; --i) {
+            if (hilet f = _variants[i - 1]) {
+                return f;
+            }
+        }
+        hi_no_default();
+    }
+
+    /** Get the variant for the current CPU.
+     *
+     * The variant is selected once, on the first call.
+     */
+    [[nodiscard]] function_type get() const noexcept
+    {
+        if (auto f = _bound.load(std::memory_order::relaxed)) [[likely]] {
+            return f;
+        }
+
+        // Racing threads will select and store the same function.
+        hilet f = get(cpu_dispatch_level());
+        _bound.store(f, std::memory_order::relaxed);
+        return f;
+    }
+
+    Result operator()(Args... args) const
+    {
+        return get()(std::forward<Args>(args)...);
+    }
+
+private:
+    std::array<function_type, num_levels> _variants = {};
+    mutable std::atomic<function_type> _bound = nullptr;
+};
+
+}} // namespace hi::v1
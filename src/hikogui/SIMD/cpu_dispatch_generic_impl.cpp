@@ -0,0 +1,8 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// This file is compiled on processors other than x86-64.
+#define HI_CPU_DISPATCH_NAMESPACE cpu_generic
+#define HI_CPU_DISPATCH_LEVEL 0
+#include "cpu_dispatch_kernels.hpp"
@@ -0,0 +1,23 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file SIMD/cpu_dispatch_kernels.hpp All kernels that are compiled for each CPU level.
+ *
+ * This file is included by each of the `cpu_dispatch_*_impl.cpp` files after they
+ * define `HI_CPU_DISPATCH_NAMESPACE` and `HI_CPU_DISPATCH_LEVEL`. Each kernel file
+ * compiles its functions for this level with `hi_cpu_dispatch_target_push()`.
+ */
+
+#pragma once
+
+#include "cpu_dispatch.hpp"
+#include "../audio/audio_sample_convert_kernels.hpp"
+#include "../codec/base64_kernels.hpp"
+#include "../codec/png_unfilter_kernels.hpp"
+#include "../DSP/dsp_float_kernels.hpp"
+#include "../DSP/dsp_fir_kernels.hpp"
+#include "../DSP/dsp_resampler_kernels.hpp"
+#include "../image/sfloat_rgba16_row_kernels.hpp"
+#include "../image/pixmap_resample_row_kernels.hpp"
+#include "../char_maps/utf_transcode_kernels.hpp"
@@ -0,0 +1,129 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "cpu_dispatch.hpp"
+#include "../codec/png_unfilter.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+#include <cstdlib>
+
+namespace {
+
+[[nodiscard]] int return_1() noexcept
+{
+    return 1;
+}
+
+[[nodiscard]] int return_2() noexcept
+{
+    return 2;
+}
+
+[[nodiscard]] int return_4() noexcept
+{
+    return 4;
+}
+
+void reference_unfilter_line(uint8_t filter, std::vector<uint8_t>& line, std::vector<uint8_t> const& prev_line, size_t bytes_per_pixel)
+{
+    for (size_t i = 0; i != line.size(); ++i) {
+        hilet left = i >= bytes_per_pixel ? int{line[i - bytes_per_pixel]} : 0;
+        hilet up = int{prev_line[i]};
+        hilet left_up = i >= bytes_per_pixel ? int{prev_line[i - bytes_per_pixel]} : 0;
+
+        hilet p = left + up - left_up;
+        hilet pa = std::abs(p - left);
+        hilet pb = std::abs(p - up);
+        hilet pc = std::abs(p - left_up);
+        hilet paeth = pa <= pb and pa <= pc ? left : pb <= pc ? up : left_up;
+
+        switch (filter) {
+        case 0:
+            break;
+        case 1:
+            line[i] = static_cast<uint8_t>(line[i] + left);
+            break;
+        case 2:
+            line[i] = static_cast<uint8_t>(line[i] + up);
+            break;
+        case 3:
+            line[i] = static_cast<uint8_t>(line[i] + (left + up) / 2);
+            break;
+        case 4:
+            line[i] = static_cast<uint8_t>(line[i] + paeth);
+            break;
+        default:
+            std::terminate();
+        }
+    }
+}
+
+} // namespace
+
+TEST(cpu_dispatch, select)
+{
+    auto const dispatch = hi::cpu_dispatch<int()>{return_1, return_2, nullptr, return_4};
+
+    ASSERT_EQ(dispatch.get(1)(), 1);
+    ASSERT_EQ(dispatch.get(2)(), 2);
+    // Level 3 has no variant of its own, so it uses the level 2 variant.
+    ASSERT_EQ(dispatch.get(3)(), 2);
+    ASSERT_EQ(dispatch.get(4)(), 4);
+
+    auto const generic = hi::cpu_dispatch<int()>{return_1};
+    ASSERT_EQ(generic.get(0)(), 1);
+    ASSERT_EQ(generic.get(4)(), 1);
+}
+
+TEST(cpu_dispatch, bind)
+{
+    auto const dispatch = hi::cpu_dispatch<int()>{return_1, return_2, nullptr, return_4};
+
+    ASSERT_EQ(dispatch(), dispatch.get(hi::cpu_dispatch_level())());
+    // The second call uses the function that was bound during the first call.
+    ASSERT_EQ(dispatch(), dispatch.get(hi::cpu_dispatch_level())());
+}
+
+TEST(cpu_dispatch, level)
+{
+    hilet level = hi::cpu_dispatch_level();
+    ASSERT_GE(level, 0);
+    ASSERT_LE(level, 4);
+
+#if HI_PROCESSOR == HI_CPU_X64
+    ASSERT_GE(level, 1);
+#endif
+}
+
+TEST(cpu_dispatch, png_unfilter_line)
+{
+    // Every variant that can run on this CPU must give the same result as the reference.
+    for (auto level = 0; level <= hi::cpu_dispatch_level(); ++level) {
+        hilet kernel = hi::png_unfilter_line.get(level);
+
+        for (uint8_t filter = 0; filter != 5; ++filter) {
+            for (hilet bytes_per_pixel : {size_t{1}, size_t{2}, size_t{3}, size_t{4}, size_t{6}, size_t{8}}) {
+                for (hilet size : {size_t{1}, size_t{8}, size_t{31}, size_t{32}, size_t{33}, size_t{200}}) {
+                    if (size < bytes_per_pixel) {
+                        continue;
+                    }
+
+                    auto prev_line = std::vector<uint8_t>(size);
+                    auto line = std::vector<uint8_t>(size);
+                    for (size_t i = 0; i != size; ++i) {
+                        prev_line[i] = static_cast<uint8_t>(i * 37 + 11);
+                        line[i] = static_cast<uint8_t>(i * 101 + filter * 7 + bytes_per_pixel);
+                    }
+
+                    auto expected = line;
+                    reference_unfilter_line(filter, expected, prev_line, bytes_per_pixel);
+                    kernel(filter, line, prev_line, bytes_per_pixel);
+                    ASSERT_EQ(line, expected) << "level=" << level << " filter=" << int{filter}
+                                              << " bytes_per_pixel=" << bytes_per_pixel << " size=" << size;
+                }
+            }
+        }
+    }
+}
@@ -0,0 +1,8 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+// The kernels in this file are compiled for x86-64-v1.
+#define HI_CPU_DISPATCH_NAMESPACE cpu_x64v1
+#define HI_CPU_DISPATCH_LEVEL 1
+#include "cpu_dispatch_kernels.hpp"
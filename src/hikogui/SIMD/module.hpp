@@ -5,14 +5,22 @@
 #pragma once
 
 #include "simd.hpp"
+#include "cpu_dispatch.hpp"
 #include "float16_sse4_1.hpp"
 #include "native_f16x8_sse2.hpp"
 #include "native_f32x4_sse.hpp"
+#include "native_f32x8_avx.hpp"
+#include "native_f32x16_avx512f.hpp"
 #include "native_f64x4_avx.hpp"
 #include "native_i16x8_sse2.hpp"
+#include "native_i16x16_avx2.hpp"
 #include "native_i32x4_sse2.hpp"
+#include "native_i32x8_avx2.hpp"
+#include "native_i32x16_avx512f.hpp"
 #include "native_i64x4_avx2.hpp"
 #include "native_i8x16_sse2.hpp"
 #include "native_simd_conversions_x86.hpp"
 #include "native_simd_utility.hpp"
 #include "native_u32x4_sse2.hpp"
+#include "native_u32x8_avx2.hpp"
+#include "native_u8x32_avx2.hpp"
@@ -0,0 +1,142 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "native_f32x16_avx512f.hpp"
+#include "native_i32x16_avx512f.hpp"
+#include "native_simd_conversions_x86.hpp"
+#include "simd_test_utility.hpp"
+#include "../macros.hpp"
+
+#ifdef HI_HAS_AVX512F
+
+hi_warning_push();
+// C26474: Don't cast between pointer types when the conversion could be implicit (type.1).
+// For the test we need to do this explicit.
+hi_warning_ignore_msvc(26474);
+
+using S = hi::native_simd<float, 16>;
+using I = hi::native_simd<int32_t, 16>;
+using A = S::array_type;
+
+TEST(native_f32x16, construct)
+{
+    ASSERT_EQ(static_cast<A>(S{}), A{});
+
+    {
+        auto expected = A{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f};
+        ASSERT_EQ(
+            static_cast<A>(S{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f}),
+            expected);
+        ASSERT_EQ(static_cast<A>(S{expected}), expected);
+        ASSERT_EQ(static_cast<A>(S{expected.data()}), expected);
+    }
+
+    HI_ASSERT_SIMD_EQ(S::broadcast(S(3.0f, 4.0f)), S::broadcast(3.0f));
+}
+
+TEST(native_f32x16, conversion)
+{
+    HI_ASSERT_SIMD_EQ(S(I(1, -2, 3, -4, 5, -6, 7, -8, 9, -10, 11, -12, 13, -14, 15, -16)),
+        S(1.0f, -2.0f, 3.0f, -4.0f, 5.0f, -6.0f, 7.0f, -8.0f, 9.0f, -10.0f, 11.0f, -12.0f, 13.0f, -14.0f, 15.0f, -16.0f));
+    HI_ASSERT_SIMD_EQ(I(S(1.0f, -2.4f, 3.6f, -4.0f)), I(1, -2, 4, -4));
+}
+
+TEST(native_f32x16, tail)
+{
+    auto from = std::array<float, 17>{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f, 17.0f};
+
+    HI_ASSERT_SIMD_EQ(S(from.data(), 0), S());
+    HI_ASSERT_SIMD_EQ(S(from.data(), 3), S(1.0f, 2.0f, 3.0f));
+
+    auto to = std::array<float, 17>{};
+    S::broadcast(1.0f).store(to.data(), 15);
+    ASSERT_EQ(to[14], 1.0f);
+    ASSERT_EQ(to[15], 0.0f);
+}
+
+TEST(native_f32x16, gather)
+{
+    auto from = std::array<float, 4>{10.0f, 11.0f, 12.0f, 13.0f};
+    HI_ASSERT_SIMD_EQ(S::gather(from.data(), I(3, 2, 1, 0)), S(13.0f, 12.0f, 11.0f, 10.0f, 10.0f, 10.0f, 10.0f, 10.0f, 10.0f, 10.0f, 10.0f, 10.0f, 10.0f, 10.0f, 10.0f, 10.0f));
+}
+
+TEST(native_f32x16, compare)
+{
+    auto a = S(1.0f, 2.0f, 3.0f, 4.0f, -1.0f, -2.0f, -3.0f, -4.0f, 1.0f, 2.0f, 3.0f, 4.0f, -1.0f, -2.0f, -3.0f, -4.0f);
+    auto b = S::broadcast(2.0f);
+
+    ASSERT_EQ((a == b).mask(), 0b0000'0010'0000'0010);
+    ASSERT_EQ((a != b).mask(), 0b1111'1101'1111'1101);
+    ASSERT_EQ((a < b).mask(), 0b1111'0001'1111'0001);
+    ASSERT_EQ((a <= b).mask(), 0b1111'0011'1111'0011);
+    ASSERT_EQ((a > b).mask(), 0b0000'1100'0000'1100);
+    ASSERT_EQ((a >= b).mask(), 0b0000'1110'0000'1110);
+}
+
+TEST(native_f32x16, math)
+{
+    auto a = S(0.0f, 2.0f, 3.0f, 42.0f, 1.0f, -1.0f, 8.0f, -8.0f);
+    auto b = S(1.0f, 4.0f, -3.0f, 2.0f, 2.0f, 2.0f, -4.0f, 4.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f);
+
+    HI_ASSERT_SIMD_EQ(-a, S(0.0f, -2.0f, -3.0f, -42.0f, -1.0f, 1.0f, -8.0f, 8.0f));
+    HI_ASSERT_SIMD_EQ(a + b, S(1.0f, 6.0f, 0.0f, 44.0f, 3.0f, 1.0f, 4.0f, -4.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f, 1.0f));
+    HI_ASSERT_SIMD_EQ(a * b, S(0.0f, 8.0f, -9.0f, 84.0f, 2.0f, -2.0f, -32.0f, -32.0f));
+    HI_ASSERT_SIMD_EQ(a / b, S(0.0f, 0.5f, -1.0f, 21.0f, 0.5f, -0.5f, -2.0f, -2.0f));
+    HI_ASSERT_SIMD_EQ(abs(a), S(0.0f, 2.0f, 3.0f, 42.0f, 1.0f, 1.0f, 8.0f, 8.0f));
+    HI_ASSERT_SIMD_EQ(floor(S(1.5f, -1.5f)), S(1.0f, -2.0f));
+    HI_ASSERT_SIMD_EQ(ceil(S(1.5f, -1.5f)), S(2.0f, -1.0f));
+    HI_ASSERT_SIMD_EQ(round(S(1.4f, -1.6f)), S(1.0f, -2.0f));
+    HI_ASSERT_SIMD_EQ(sqrt(S::broadcast(16.0f)), S::broadcast(4.0f));
+    HI_ASSERT_SIMD_EQ(interleaved_sub_add(S::broadcast(2.0f), S::broadcast(1.0f)), S(1.0f, 3.0f, 1.0f, 3.0f, 1.0f, 3.0f, 1.0f, 3.0f, 1.0f, 3.0f, 1.0f, 3.0f, 1.0f, 3.0f, 1.0f, 3.0f));
+}
+
+TEST(native_f32x16, bit_wise)
+{
+    HI_ASSERT_SIMD_EQ(~S::from_mask(0b0101'1010'0000'1111), S::from_mask(0b1010'0101'1111'0000));
+    HI_ASSERT_SIMD_EQ(S::from_mask(0b0110) ^ S::from_mask(0b1010), S::from_mask(0b1100));
+    HI_ASSERT_SIMD_EQ(not_and(S::from_mask(0b1111'1111'1111'1110), S::broadcast(3.0f)), S(3.0f));
+
+    for (size_t i = 0; i != 0x10000; ++i) {
+        ASSERT_EQ(S::from_mask(i).mask(), i);
+    }
+}
+
+TEST(native_f32x16, access)
+{
+    auto tmp = S(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f);
+
+    ASSERT_EQ(get<0>(tmp), 1.0f);
+    ASSERT_EQ(get<9>(tmp), 10.0f);
+    ASSERT_EQ(get<15>(tmp), 16.0f);
+    ASSERT_EQ(get<13>(insert<13>(tmp, 42.0f)), 42.0f);
+    HI_ASSERT_SIMD_EQ(set_zero<0b1111'1111'1111'1110>(tmp), S(1.0f));
+}
+
+TEST(native_f32x16, blend_permute)
+{
+    auto a = S(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f);
+    auto b = S::broadcast(42.0f);
+
+    ASSERT_EQ((blend<0b1000'0000'0000'0001>(a, b) == b).mask(), 0b1000'0000'0000'0001);
+    ASSERT_EQ((blend(a, b, a > S::broadcast(14.0f)) == b).mask(), 0b1100'0000'0000'0000);
+
+    HI_ASSERT_SIMD_EQ(permute<"ponmlkjihgfedcba">(a),
+        S(16.0f, 15.0f, 14.0f, 13.0f, 12.0f, 11.0f, 10.0f, 9.0f, 8.0f, 7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f));
+    HI_ASSERT_SIMD_EQ(swizzle<"000000000000001p">(a), S(0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f, 16.0f));
+}
+
+TEST(native_f32x16, horizontal)
+{
+    auto a = S(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f);
+    auto b = S::broadcast(1.0f);
+
+    HI_ASSERT_SIMD_EQ(horizontal_add(a, b), S(3.0f, 7.0f, 11.0f, 15.0f, 19.0f, 23.0f, 27.0f, 31.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f, 2.0f));
+    HI_ASSERT_SIMD_EQ(horizontal_sub(a, b), S(-1.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f, -1.0f));
+    HI_ASSERT_SIMD_EQ(horizontal_sum(a), S::broadcast(136.0f));
+    HI_ASSERT_SIMD_EQ(dot_product<0b1000'0000'0000'0011>(a, b), S::broadcast(19.0f));
+}
+
+hi_warning_pop();
+
+#endif
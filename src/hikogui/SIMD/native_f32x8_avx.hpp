@@ -0,0 +1,734 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "native_simd_utility.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <array>
+#include <ostream>
+
+
+
+namespace hi { inline namespace v1 {
+
+#ifdef HI_HAS_AVX
+
+/** A float x 8 (__m256) AVX register.
+ *
+ *
+ * When loading and storing from memory this is the order of the element in the register
+ *
+ * ```
+ *   lo   hi lo   hi lo   hi lo   hi lo   hi lo   hi lo   hi lo   hi
+ *  +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *  | el 0  | el 1  | el 2  | el 3  | el 4  | el 5  | el 6  | el 7  |
+ *  +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *   0     3 4     7 8    11 12   15 16   19 20   23 24   27 28   31   memory address.
+ * ```
+ *
+ * In the function below a `mask` values least-significant-bit corresponds to element 0.
+ *
+ */
+template<>
+struct native_simd<float, 8> {
+    using value_type = float;
+    constexpr static size_t size = 8;
+    using array_type = std::array<value_type, size>;
+    using register_type = __m256;
+
+    register_type v;
+
+    native_simd(native_simd const&) noexcept = default;
+    native_simd(native_simd&&) noexcept = default;
+    native_simd& operator=(native_simd const&) noexcept = default;
+    native_simd& operator=(native_simd&&) noexcept = default;
+
+    /** Initialize all elements to zero.
+     */
+    native_simd() noexcept : v(_mm256_setzero_ps()) {}
+
+    [[nodiscard]] explicit native_simd(register_type other) noexcept : v(other) {}
+
+    [[nodiscard]] explicit operator register_type() const noexcept
+    {
+        return v;
+    }
+
+    /** Initialize the element to the values in the arguments.
+     *
+     * @param a The value for element 0.
+     * @param b The value for element 1.
+     * @param c The value for element 2.
+     * @param d The value for element 3.
+     * @param e The value for element 4.
+     * @param f The value for element 5.
+     * @param g The value for element 6.
+     * @param h The value for element 7.
+     */
+    [[nodiscard]] native_simd(
+        value_type a,
+        value_type b = value_type{0},
+        value_type c = value_type{0},
+        value_type d = value_type{0},
+        value_type e = value_type{0},
+        value_type f = value_type{0},
+        value_type g = value_type{0},
+        value_type h = value_type{0}) noexcept :
+        v(_mm256_set_ps(h, g, f, e, d, c, b, a))
+    {
+    }
+
+    [[nodiscard]] explicit native_simd(value_type const *other) noexcept : v(_mm256_loadu_ps(other)) {}
+
+    void store(value_type *out) const noexcept
+    {
+        hi_axiom_not_null(out);
+        _mm256_storeu_ps(out, v);
+    }
+
+    /** Load the first elements from memory, the other elements are set to zero.
+     *
+     * This is used to load the tail of an array, memory beyond the
+     * @a count elements is not accessed.
+     *
+     * @param other A pointer to the elements to load.
+     * @param count The number of elements to load.
+     */
+    [[nodiscard]] native_simd(value_type const *other, size_t count) noexcept
+    {
+        hi_axiom(count <= size);
+        v = _mm256_maskload_ps(other, _mm256_castps_si256(tail_mask(count)));
+    }
+
+    /** Store the first elements to memory.
+     *
+     * This is used to store the tail of an array, memory beyond the
+     * @a count elements is not accessed.
+     *
+     * @param out A pointer to where the elements are stored.
+     * @param count The number of elements to store.
+     */
+    void store(value_type *out, size_t count) const noexcept
+    {
+        hi_axiom(count <= size);
+        _mm256_maskstore_ps(out, _mm256_castps_si256(tail_mask(count)), v);
+    }
+
+    [[nodiscard]] explicit native_simd(void const *other) noexcept : v(_mm256_loadu_ps(static_cast<value_type const *>(other))) {}
+
+    void store(void *out) const noexcept
+    {
+        hi_axiom_not_null(out);
+        _mm256_storeu_ps(static_cast<value_type *>(out), v);
+    }
+
+    [[nodiscard]] explicit native_simd(std::span<value_type const> other) noexcept
+    {
+        hi_axiom(other.size() >= size);
+        v = _mm256_loadu_ps(other.data());
+    }
+
+    void store(std::span<value_type> out) const noexcept
+    {
+        hi_axiom(out.size() >= size);
+        _mm256_storeu_ps(out.data(), v);
+    }
+
+    [[nodiscard]] explicit native_simd(array_type other) noexcept : v(_mm256_loadu_ps(other.data())) {}
+
+    [[nodiscard]] explicit operator array_type() const noexcept
+    {
+        auto r = array_type{};
+        _mm256_storeu_ps(r.data(), v);
+        return r;
+    }
+
+#ifdef HI_HAS_AVX2
+    [[nodiscard]] explicit native_simd(native_simd<int32_t, 8> const& a) noexcept;
+
+    /** Load elements from memory using indices.
+     *
+     * ```
+     * r[i] = ptr[indices[i]]
+     * ```
+     *
+     * @param ptr A pointer to the first element.
+     * @param indices The indices of the elements to load.
+     */
+    [[nodiscard]] static native_simd gather(value_type const *ptr, native_simd<int32_t, 8> const& indices) noexcept;
+#endif
+
+    /** Broadcast a single value to all the elements.
+     *
+     * ```
+     * r[0] = a
+     * r[1] = a
+     * r[2] = a
+     * r[3] = a
+     * r[4] = a
+     * r[5] = a
+     * r[6] = a
+     * r[7] = a
+     * ```
+     */
+    [[nodiscard]] static native_simd broadcast(value_type a) noexcept
+    {
+        return native_simd{_mm256_set1_ps(a)};
+    }
+
+    /** Broadcast the first element to all the elements.
+     *
+     * ```
+     * r[0] = a[0]
+     * r[1] = a[0]
+     * r[2] = a[0]
+     * r[3] = a[0]
+     * r[4] = a[0]
+     * r[5] = a[0]
+     * r[6] = a[0]
+     * r[7] = a[0]
+     * ```
+     */
+    [[nodiscard]] static native_simd broadcast(native_simd a) noexcept
+    {
+#ifdef HI_HAS_AVX2
+        return native_simd{_mm256_broadcastss_ps(_mm256_castps256_ps128(a.v))};
+#else
+        hilet tmp = _mm256_permute_ps(a.v, 0b00'00'00'00);
+        return native_simd{_mm256_permute2f128_ps(tmp, tmp, 0b0000'0000)};
+#endif
+    }
+
+    /** Create a vector with all the bits set.
+     */
+    [[nodiscard]] static native_simd ones() noexcept
+    {
+#ifdef HI_HAS_AVX2
+        auto ones = _mm256_undefined_si256();
+        ones = _mm256_cmpeq_epi32(ones, ones);
+        return native_simd{_mm256_castsi256_ps(ones)};
+#else
+        auto ones = _mm256_setzero_ps();
+        ones = _mm256_cmp_ps(ones, ones, _CMP_TRUE_UQ);
+        return native_simd{ones};
+#endif
+    }
+
+    /** For each bit in mask set corresponding element to all-ones or all-zeros.
+     */
+    [[nodiscard]] static native_simd from_mask(size_t a) noexcept
+    {
+        hi_axiom(a <= 0b1111'1111);
+
+#ifdef HI_HAS_AVX2
+        hilet bits = _mm256_set_epi32(0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01);
+        hilet tmp = _mm256_and_si256(_mm256_set1_epi32(truncate<int32_t>(a)), bits);
+        return native_simd{_mm256_castsi256_ps(_mm256_cmpeq_epi32(tmp, bits))};
+#else
+        hilet tmp = _mm256_set_ps(
+            to_bool(a & 0x80) ? -1.0f : 0.0f,
+            to_bool(a & 0x40) ? -1.0f : 0.0f,
+            to_bool(a & 0x20) ? -1.0f : 0.0f,
+            to_bool(a & 0x10) ? -1.0f : 0.0f,
+            to_bool(a & 0x08) ? -1.0f : 0.0f,
+            to_bool(a & 0x04) ? -1.0f : 0.0f,
+            to_bool(a & 0x02) ? -1.0f : 0.0f,
+            to_bool(a & 0x01) ? -1.0f : 0.0f);
+        return native_simd{_mm256_cmp_ps(tmp, _mm256_setzero_ps(), _CMP_LT_OQ)};
+#endif
+    }
+
+    /** Concatenate the top bit of each element.
+     */
+    [[nodiscard]] size_t mask() const noexcept
+    {
+        return narrow_cast<size_t>(_mm256_movemask_ps(v));
+    }
+
+    /** Compare if all elements in both vectors are equal.
+     *
+     * This operator does a bit-wise compare. It does not handle NaN in the same
+     * way as IEEE-754. This is because when you comparing two vectors
+     * having a NaN in one of the elements does not invalidate the complete vector.
+     */
+    [[nodiscard]] friend bool equal(native_simd a, native_simd b) noexcept
+    {
+        hilet tmp = _mm256_castps_si256(_mm256_xor_ps(a.v, b.v));
+        return _mm256_testz_si256(tmp, tmp) == 1;
+    }
+
+    [[nodiscard]] friend native_simd
+    almost_eq(native_simd a, native_simd b, value_type epsilon = std::numeric_limits<value_type>::epsilon()) noexcept
+    {
+        hilet abs_diff = abs(a - b);
+        return abs_diff < broadcast(epsilon);
+    }
+
+    [[nodiscard]] friend bool
+    almost_equal(native_simd a, native_simd b, value_type epsilon = std::numeric_limits<value_type>::epsilon())
+    {
+        return almost_eq(a, b, epsilon).mask() == 0b1111'1111;
+    }
+
+    [[nodiscard]] friend native_simd operator==(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_cmp_ps(a.v, b.v, _CMP_EQ_OQ)};
+    }
+
+    [[nodiscard]] friend native_simd operator!=(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_cmp_ps(a.v, b.v, _CMP_NEQ_UQ)};
+    }
+
+    [[nodiscard]] friend native_simd operator<(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_cmp_ps(a.v, b.v, _CMP_LT_OQ)};
+    }
+
+    [[nodiscard]] friend native_simd operator>(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_cmp_ps(a.v, b.v, _CMP_GT_OQ)};
+    }
+
+    [[nodiscard]] friend native_simd operator<=(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_cmp_ps(a.v, b.v, _CMP_LE_OQ)};
+    }
+
+    [[nodiscard]] friend native_simd operator>=(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_cmp_ps(a.v, b.v, _CMP_GE_OQ)};
+    }
+
+    [[nodiscard]] friend native_simd operator+(native_simd a) noexcept
+    {
+        return a;
+    }
+
+    [[nodiscard]] friend native_simd operator+(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_add_ps(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator-(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_sub_ps(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator-(native_simd a) noexcept
+    {
+        return native_simd{} - a;
+    }
+
+    [[nodiscard]] friend native_simd operator*(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_mul_ps(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator/(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_div_ps(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator&(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_and_ps(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator|(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_or_ps(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator^(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_xor_ps(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator~(native_simd a) noexcept
+    {
+        return not_and(a, ones());
+    }
+
+    [[nodiscard]] friend native_simd min(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_min_ps(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd max(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_max_ps(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd abs(native_simd a) noexcept
+    {
+        return not_and(broadcast(-0.0f), a);
+    }
+
+    [[nodiscard]] friend native_simd floor(native_simd a) noexcept
+    {
+        return native_simd{_mm256_floor_ps(a.v)};
+    }
+
+    [[nodiscard]] friend native_simd ceil(native_simd a) noexcept
+    {
+        return native_simd{_mm256_ceil_ps(a.v)};
+    }
+
+    template<native_rounding_mode Rounding = native_rounding_mode::current>
+    [[nodiscard]] friend native_simd round(native_simd a) noexcept
+    {
+        return native_simd{_mm256_round_ps(a.v, std::to_underlying(Rounding))};
+    }
+
+    /** Reciprocal.
+     */
+    [[nodiscard]] friend native_simd rcp(native_simd a) noexcept
+    {
+        return native_simd{_mm256_rcp_ps(a.v)};
+    }
+
+    /** Square root.
+     */
+    [[nodiscard]] friend native_simd sqrt(native_simd a) noexcept
+    {
+        return native_simd{_mm256_sqrt_ps(a.v)};
+    }
+
+    /** Reciprocal of the square root.
+     *
+     * This is often implemented in hardware using a much faster algorithm than
+     * either the reciprocal and square root separately. But has slightly less
+     * accuracy, see https://en.wikipedia.org/wiki/Fast_inverse_square_root
+     */
+    [[nodiscard]] friend native_simd rsqrt(native_simd a) noexcept
+    {
+        return native_simd{_mm256_rsqrt_ps(a.v)};
+    }
+
+    /** Set elements to zero.
+     *
+     * @tparam Mask A bit mask corresponding to each element.
+     * @param a The value to modify.
+     * @return argument @a with elements set to zero where the corresponding @a Mask bit was '1'.
+     */
+    template<size_t Mask>
+    [[nodiscard]] friend native_simd set_zero(native_simd a) noexcept
+    {
+        static_assert(Mask <= 0b1111'1111);
+        return blend<Mask>(a, native_simd{});
+    }
+
+    /** Insert a value into an element of a vector.
+     *
+     * @tparam Index the index of the element where insert the value.
+     * @param a The vector to insert the value into.
+     * @param b The value to insert.
+     * @return The vector with the inserted value.
+     */
+    template<size_t Index>
+    [[nodiscard]] friend native_simd insert(native_simd a, value_type b) noexcept
+    {
+        static_assert(Index < size);
+        return blend<1_uz << Index>(a, broadcast(b));
+    }
+
+    /** Extract an element from a vector.
+     *
+     * @tparam Index the index of the element.
+     * @param a The vector to select the element from.
+     * @return The value of the selected element.
+     */
+    template<size_t Index>
+    [[nodiscard]] friend value_type get(native_simd a) noexcept
+    {
+        static_assert(Index < size);
+
+        constexpr auto hi_index = Index / (size / 2);
+        constexpr auto lo_index = Index % (size / 2);
+
+        hilet hi = _mm256_extractf128_ps(a.v, hi_index);
+        hilet lo = _mm_shuffle_ps(hi, hi, lo_index);
+        return _mm_cvtss_f32(lo);
+    }
+
+    /** Select elements from two vectors.
+     *
+     * @tparam Mask A mask to select bits from @a a when '0'; or @a b when '1'. The
+     *         lsb corresponds with element zero.
+     * @param a A vector for which element are selected when the bit in @a Mask is '0'.
+     * @param b A vector for which element are selected when the bit in @a Mask is '1'.
+     * @return A vector with element selected from @a a and @a b
+     */
+    template<size_t Mask>
+    [[nodiscard]] friend native_simd blend(native_simd a, native_simd b) noexcept
+    {
+        static_assert(Mask <= 0b1111'1111);
+
+        if constexpr (Mask == 0b0000'0000) {
+            return a;
+        } else if constexpr (Mask == 0b1111'1111) {
+            return b;
+        } else {
+            return native_simd{_mm256_blend_ps(a.v, b.v, Mask)};
+        }
+    }
+
+    /** Select elements from two vectors.
+     *
+     * @param a A vector for which element are selected when the element in @a mask is all-zeros.
+     * @param b A vector for which element are selected when the element in @a mask is all-ones.
+     * @param mask A vector with elements set to all-ones or all-zeros, as returned by the compare operators.
+     * @return A vector with element selected from @a a and @a b
+     */
+    [[nodiscard]] friend native_simd blend(native_simd a, native_simd b, native_simd mask) noexcept
+    {
+        return native_simd{_mm256_blendv_ps(a.v, b.v, mask.v)};
+    }
+
+    /** Permute elements, ignoring numeric elements.
+     *
+     * The characters in @a SourceElements mean the following:
+     * - 'a' - 'p': The indices to elements 0 and 15 of @a a.
+     * - 'x', 'y', 'z', 'w'': The indices to elements 0, 1, 2, 3 of @a a.
+     * - Any other character is treated as if the original element was selected.
+     *
+     * @tparam SourceElements A string representing the order of elements. First character
+     *         matches the first element.
+     * @param a The vector to swizzle the elements
+     * @returns A vector with the elements swizzled.
+     */
+    template<fixed_string SourceElements>
+    [[nodiscard]] friend native_simd permute(native_simd a) noexcept
+    {
+        static_assert(SourceElements.size() == size);
+        constexpr auto order = detail::native_swizzle_to_packed_indices<SourceElements, size>();
+
+        // The index of each element, and whether each element is selected from the other 128-bit lane.
+        // clang-format off
+        constexpr auto i0 = (order >> 0) & 7; constexpr auto i1 = (order >> 3) & 7;
+        constexpr auto i2 = (order >> 6) & 7; constexpr auto i3 = (order >> 9) & 7;
+        constexpr auto i4 = (order >> 12) & 7; constexpr auto i5 = (order >> 15) & 7;
+        constexpr auto i6 = (order >> 18) & 7; constexpr auto i7 = (order >> 21) & 7;
+        constexpr auto lo_order = (i0 & 3) | ((i1 & 3) << 2) | ((i2 & 3) << 4) | ((i3 & 3) << 6);
+        constexpr auto hi_order = (i4 & 3) | ((i5 & 3) << 2) | ((i6 & 3) << 4) | ((i7 & 3) << 6);
+        constexpr auto cross_mask =
+            (i0 >> 2) | ((i1 >> 2) << 1) | ((i2 >> 2) << 2) | ((i3 >> 2) << 3) |
+            ((~i4 & 4) << 2) | ((~i5 & 4) << 3) | ((~i6 & 4) << 4) | ((~i7 & 4) << 5);
+        // clang-format on
+
+        if constexpr (order == 076543210) {
+            return a;
+        } else if constexpr (order == 0) {
+            return broadcast(a);
+        } else if constexpr (cross_mask == 0 and lo_order == hi_order) {
+            return native_simd{_mm256_permute_ps(a.v, lo_order)};
+        } else {
+#ifdef HI_HAS_AVX2
+            hilet indices = _mm256_set_epi32(i7, i6, i5, i4, i3, i2, i1, i0);
+            return native_simd{_mm256_permutevar8x32_ps(a.v, indices)};
+#else
+            hilet indices = _mm256_set_epi32(i7 & 3, i6 & 3, i5 & 3, i4 & 3, i3 & 3, i2 & 3, i1 & 3, i0 & 3);
+            hilet same_lane = _mm256_permutevar_ps(a.v, indices);
+            hilet other_lane = _mm256_permutevar_ps(_mm256_permute2f128_ps(a.v, a.v, 0b0000'0001), indices);
+            return native_simd{_mm256_blend_ps(same_lane, other_lane, cross_mask)};
+#endif
+        }
+    }
+
+    /** Swizzle elements.
+     *
+     * The elements are swizzled in the order specified in @a SourceElements.
+     * Each character in @a SourceElements is a index to an element in @a a or
+     * a numeric value.
+     *
+     * The characters in @a SourceElements mean the following:
+     * - 'a' - 'p': The indices to elements 0 and 15 of @a a.
+     * - 'x', 'y', 'z', 'w'': The indices to elements 0, 1, 2, 3 of @a a.
+     * - '0', '1': The values 0 and 1.
+     *
+     * @tparam SourceElements A string representing the order of elements. First character
+     *         matches the first element.
+     * @param a The vector to swizzle the elements
+     * @returns A vector with the elements swizzled.
+     */
+    template<fixed_string SourceElements>
+    [[nodiscard]] friend native_simd swizzle(native_simd a) noexcept
+    {
+        static_assert(SourceElements.size() == size);
+        constexpr auto one_mask = detail::native_swizzle_to_mask<SourceElements, size, '1'>();
+        constexpr auto zero_mask = detail::native_swizzle_to_mask<SourceElements, size, '0'>();
+        constexpr auto number_mask = one_mask | zero_mask;
+
+        if constexpr (number_mask == 0b1111'1111) {
+            // Swizzle was /[01]{8}/.
+            return swizzle_numbers<SourceElements>();
+
+        } else if constexpr (number_mask == 0b0000'0000) {
+            // Swizzle was /[^01]{8}/.
+            return permute<SourceElements>(a);
+
+        } else if constexpr (number_mask == zero_mask) {
+            // Swizzle was /[^1]{8}/.
+            hilet ordered = permute<SourceElements>(a);
+            return set_zero<zero_mask>(ordered);
+
+        } else {
+            hilet ordered = permute<SourceElements>(a);
+            hilet numbers = swizzle_numbers<SourceElements>();
+            return blend<number_mask>(ordered, numbers);
+        }
+    }
+
+#ifdef HI_HAS_AVX2
+    /** Horizontal add.
+     *
+     * Add elements pair-wise in both vectors, then merge the results:
+     * ```
+     * r[0] = a[0] + a[1]
+     * r[1] = a[2] + a[3]
+     * r[2] = a[4] + a[5]
+     * r[3] = a[6] + a[7]
+     * r[4] = b[0] + b[1]
+     * r[5] = b[2] + b[3]
+     * r[6] = b[4] + b[5]
+     * r[7] = b[6] + b[7]
+     * ```
+     */
+    [[nodiscard]] friend native_simd horizontal_add(native_simd a, native_simd b) noexcept
+    {
+        // _mm256_hadd_ps() works on each 128-bit lane, reorder the 64-bit pairs afterwards.
+        hilet tmp = _mm256_castps_pd(_mm256_hadd_ps(a.v, b.v));
+        return native_simd{_mm256_castpd_ps(_mm256_permute4x64_pd(tmp, 0b11'01'10'00))};
+    }
+#endif
+
+#ifdef HI_HAS_AVX2
+    /** Horizontal subtract.
+     *
+     * Subtract elements pair-wise in both vectors, then merge the results:
+     * ```
+     * r[0] = a[0] - a[1]
+     * r[1] = a[2] - a[3]
+     * r[2] = a[4] - a[5]
+     * r[3] = a[6] - a[7]
+     * r[4] = b[0] - b[1]
+     * r[5] = b[2] - b[3]
+     * r[6] = b[4] - b[5]
+     * r[7] = b[6] - b[7]
+     * ```
+     */
+    [[nodiscard]] friend native_simd horizontal_sub(native_simd a, native_simd b) noexcept
+    {
+        hilet tmp = _mm256_castps_pd(_mm256_hsub_ps(a.v, b.v));
+        return native_simd{_mm256_castpd_ps(_mm256_permute4x64_pd(tmp, 0b11'01'10'00))};
+    }
+#endif
+
+    /** Sum all elements of a vector.
+     *
+     * ```
+     * r = broadcast(a[0] + a[1] + a[2] + a[3] + a[4] + a[5] + a[6] + a[7])
+     * ```
+     */
+    [[nodiscard]] friend native_simd horizontal_sum(native_simd a) noexcept
+    {
+        auto tmp = a + native_simd{_mm256_permute2f128_ps(a.v, a.v, 0b0000'0001)};
+        tmp = tmp + native_simd{_mm256_permute_ps(tmp.v, 0b10'11'00'01)};
+        return tmp + native_simd{_mm256_permute_ps(tmp.v, 0b01'00'11'10)};
+    }
+
+    /** Dot product.
+     *
+     * ```
+     * tmp[i] = SourceMask[i] ? a[i] * b[i] : 0
+     * r = broadcast(tmp[0] + tmp[1] + tmp[2] + tmp[3] + tmp[4] + tmp[5] + tmp[6] + tmp[7])
+     * ```
+     */
+    template<size_t SourceMask>
+    [[nodiscard]] friend native_simd dot_product(native_simd a, native_simd b) noexcept
+    {
+        static_assert(SourceMask <= 0b1111'1111);
+        return horizontal_sum(set_zero<~SourceMask & 0b1111'1111>(a * b));
+    }
+
+    /** Interleaved subtract and add elements.
+     *
+     * The following operations are done:
+     * ```
+     * r[0] = a[0] - b[0];
+     * r[1] = a[1] + b[1];
+     * r[2] = a[2] - b[2];
+     * r[3] = a[3] + b[3];
+     * r[4] = a[4] - b[4];
+     * r[5] = a[5] + b[5];
+     * r[6] = a[6] - b[6];
+     * r[7] = a[7] + b[7];
+     * ```
+     *
+     */
+    [[nodiscard]] friend native_simd interleaved_sub_add(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_addsub_ps(a.v, b.v)};
+    }
+
+    /** not followed by and.
+     *
+     * r = ~a & b
+     *
+     */
+    [[nodiscard]] friend native_simd not_and(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_andnot_ps(a.v, b.v)};
+    }
+
+    friend std::ostream& operator<<(std::ostream& a, native_simd b) noexcept
+    {
+        return a << "(" << get<0>(b) << ", " << get<1>(b) << ", " << get<2>(b) << ", " << get<3>(b) << ", " << get<4>(b)
+                 << ", " << get<5>(b) << ", " << get<6>(b) << ", " << get<7>(b) << ")";
+    }
+
+    template<fixed_string SourceElements>
+    [[nodiscard]] static native_simd swizzle_numbers() noexcept
+    {
+        constexpr auto one_mask = detail::native_swizzle_to_mask<SourceElements, size, '1'>();
+        constexpr auto zero_mask = detail::native_swizzle_to_mask<SourceElements, size, '0'>();
+        constexpr auto number_mask = one_mask | zero_mask;
+        constexpr auto alpha_mask = ~number_mask & 0b1111'1111;
+
+        if constexpr ((zero_mask | alpha_mask) == 0b1111'1111) {
+            return {};
+
+        } else if constexpr ((one_mask | alpha_mask) == 0b1111'1111) {
+            return broadcast(1.0f);
+
+        } else {
+            return native_simd{
+                to_bool(one_mask & 0b0000'0001) ? 1.0f : 0.0f,
+                to_bool(one_mask & 0b0000'0010) ? 1.0f : 0.0f,
+                to_bool(one_mask & 0b0000'0100) ? 1.0f : 0.0f,
+                to_bool(one_mask & 0b0000'1000) ? 1.0f : 0.0f,
+                to_bool(one_mask & 0b0001'0000) ? 1.0f : 0.0f,
+                to_bool(one_mask & 0b0010'0000) ? 1.0f : 0.0f,
+                to_bool(one_mask & 0b0100'0000) ? 1.0f : 0.0f,
+                to_bool(one_mask & 0b1000'0000) ? 1.0f : 0.0f};
+        }
+    }
+
+private:
+    /** A mask with the first @a count elements set to all-ones.
+     */
+    [[nodiscard]] static register_type tail_mask(size_t count) noexcept
+    {
+        hilet indices = _mm256_set_ps(7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f, 1.0f, 0.0f);
+        return _mm256_cmp_ps(indices, _mm256_set1_ps(narrow_cast<float>(count)), _CMP_LT_OQ);
+    }
+};
+
+#endif
+
+}} // namespace hi::v1
@@ -0,0 +1,275 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "native_f32x8_avx.hpp"
+#include "native_simd_conversions_x86.hpp"
+#include "simd_test_utility.hpp"
+#include "../macros.hpp"
+
+#ifdef HI_HAS_AVX
+
+hi_warning_push();
+// C26474: Don't cast between pointer types when the conversion could be implicit (type.1).
+// For the test we need to do this explicit.
+hi_warning_ignore_msvc(26474);
+
+using S = hi::native_simd<float, 8>;
+using A = S::array_type;
+
+TEST(native_f32x8, construct)
+{
+    {
+        auto expected = A{0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+        ASSERT_EQ(static_cast<A>(S{}), expected);
+    }
+
+    {
+        auto expected = A{1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f};
+        ASSERT_EQ(static_cast<A>(S{1.0f}), expected);
+    }
+
+    {
+        auto expected = A{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+        ASSERT_EQ(static_cast<A>(S{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f}), expected);
+    }
+
+    {
+        auto expected = A{4.0f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f, 4.0f};
+        ASSERT_EQ(static_cast<A>(S::broadcast(4.0f)), expected);
+    }
+
+    {
+        auto expected = A{3.0f, 3.0f, 3.0f, 3.0f, 3.0f, 3.0f, 3.0f, 3.0f};
+        ASSERT_EQ(static_cast<A>(S::broadcast(S{3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f, 10.0f})), expected);
+    }
+
+    {
+        auto from = A{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+        auto expected = A{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+        ASSERT_EQ(static_cast<A>(S{from}), expected);
+    }
+
+    {
+        auto from = A{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+        auto expected = A{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+        ASSERT_EQ(static_cast<A>(S{from.data()}), expected);
+    }
+
+    {
+        auto from = A{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+        auto expected = A{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+        ASSERT_EQ(static_cast<A>(S{static_cast<void *>(from.data())}), expected);
+    }
+
+    {
+        auto a = A{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+        auto from = std::span(a.data(), a.size());
+        auto expected = A{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+        ASSERT_EQ(static_cast<A>(S{from}), expected);
+    }
+}
+
+TEST(native_f32x8, conversion)
+{
+    auto a = S{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+    auto expected = A{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f};
+
+    {
+        auto result = A{};
+        a.store(result);
+        ASSERT_EQ(result, expected);
+    }
+
+    {
+        auto result = A{};
+        auto result_span = std::span(result.data(), result.size());
+        a.store(result_span);
+        ASSERT_EQ(result, expected);
+    }
+
+    {
+        auto result = A{};
+        a.store(result.data());
+        ASSERT_EQ(result, expected);
+    }
+
+    {
+        auto result = A{};
+        a.store(static_cast<void *>(result.data()));
+        ASSERT_EQ(result, expected);
+    }
+
+#ifdef HI_HAS_AVX2
+    HI_ASSERT_SIMD_EQ(S(hi::native_simd<int32_t, 8>(1, -2, 3, -4, 5, -6, 7, -8)), S(1.0f, -2.0f, 3.0f, -4.0f, 5.0f, -6.0f, 7.0f, -8.0f));
+#endif
+}
+
+TEST(native_f32x8, tail)
+{
+    auto from = std::array<float, 9>{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f};
+
+    HI_ASSERT_SIMD_EQ(S(from.data(), 0), S());
+    HI_ASSERT_SIMD_EQ(S(from.data(), 3), S(1.0f, 2.0f, 3.0f));
+    HI_ASSERT_SIMD_EQ(S(from.data(), 8), S(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f));
+
+    auto to = std::array<float, 9>{};
+    S(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f).store(to.data(), 5);
+    ASSERT_EQ(to, (std::array<float, 9>{1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 0.0f, 0.0f, 0.0f, 0.0f}));
+}
+
+#ifdef HI_HAS_AVX2
+TEST(native_f32x8, gather)
+{
+    auto from = std::array<float, 10>{10.0f, 11.0f, 12.0f, 13.0f, 14.0f, 15.0f, 16.0f, 17.0f, 18.0f, 19.0f};
+    auto indices = hi::native_simd<int32_t, 8>{9, 0, 8, 1, 7, 2, 6, 3};
+    HI_ASSERT_SIMD_EQ(S::gather(from.data(), indices), S(19.0f, 10.0f, 18.0f, 11.0f, 17.0f, 12.0f, 16.0f, 13.0f));
+}
+#endif
+
+TEST(native_f32x8, compare)
+{
+    constexpr auto nan = std::numeric_limits<float>::quiet_NaN();
+
+    HI_ASSERT_SIMD_EQ(S(1.0f, 2.0f, nan, -4.0f, 5.0f, 6.0f, 7.0f, 8.0f), S(1.0f, 2.0f, nan, -4.0f, 5.0f, 6.0f, 7.0f, 8.0f));
+    HI_ASSERT_SIMD_NE(S(1.0f, 2.0f, nan, -4.0f, 5.0f, 6.0f, 7.0f, 8.1f), S(1.0f, 2.0f, nan, -4.0f, 5.0f, 6.0f, 7.0f, 8.0f));
+
+    ASSERT_TRUE(almost_equal(S(1.00001f, 2.0f, 0.499999f, -4.0f), S(1.0f, 2.00001f, 0.5f, -3.99999f), 0.00002f));
+
+    ASSERT_EQ((S(1.0f, 2.0f, nan, -4.0f, 5.0f, 6.0f, 7.0f, 8.0f) == S(1.0f, 2.0f, nan, -4.0f, 5.0f, 0.0f, 7.0f, 0.0f)).mask(), 0b0101'1011);
+    ASSERT_EQ((S(1.0f, 2.0f, nan, -4.0f, 5.0f, 6.0f, 7.0f, 8.0f) != S(1.0f, 2.0f, nan, -4.0f, 5.0f, 0.0f, 7.0f, 0.0f)).mask(), 0b1010'0100);
+
+    auto a = S(1.0f, 2.0f, nan, 4.0f, 1.0f, 2.0f, 3.0f, 4.0f);
+    auto b = S::broadcast(2.0f);
+    ASSERT_EQ((a < b).mask(), 0b0001'0001);
+    ASSERT_EQ((a <= b).mask(), 0b0011'0011);
+    ASSERT_EQ((a > b).mask(), 0b1100'1000);
+    ASSERT_EQ((a >= b).mask(), 0b1110'1010);
+}
+
+TEST(native_f32x8, math)
+{
+    auto a = S(0.0f, 2.0f, 3.0f, 42.0f, 1.0f, -1.0f, 8.0f, -8.0f);
+    auto b = S(1.0f, 4.0f, -3.0f, 2.0f, 2.0f, 2.0f, -4.0f, 4.0f);
+
+    HI_ASSERT_SIMD_EQ(-a, S(0.0f, -2.0f, -3.0f, -42.0f, -1.0f, 1.0f, -8.0f, 8.0f));
+    HI_ASSERT_SIMD_EQ(+a, a);
+    HI_ASSERT_SIMD_EQ(a + b, S(1.0f, 6.0f, 0.0f, 44.0f, 3.0f, 1.0f, 4.0f, -4.0f));
+    HI_ASSERT_SIMD_EQ(a - b, S(-1.0f, -2.0f, 6.0f, 40.0f, -1.0f, -3.0f, 12.0f, -12.0f));
+    HI_ASSERT_SIMD_EQ(a * b, S(0.0f, 8.0f, -9.0f, 84.0f, 2.0f, -2.0f, -32.0f, -32.0f));
+    HI_ASSERT_SIMD_EQ(a / b, S(0.0f, 0.5f, -1.0f, 21.0f, 0.5f, -0.5f, -2.0f, -2.0f));
+    HI_ASSERT_SIMD_EQ(min(a, b), S(0.0f, 2.0f, -3.0f, 2.0f, 1.0f, -1.0f, -4.0f, -8.0f));
+    HI_ASSERT_SIMD_EQ(max(a, b), S(1.0f, 4.0f, 3.0f, 42.0f, 2.0f, 2.0f, 8.0f, 4.0f));
+    HI_ASSERT_SIMD_EQ(abs(S(0.0f, 2.2f, -3.2f, -3.6f, 1.0f, -1.0f, 0.5f, -0.5f)), S(0.0f, 2.2f, 3.2f, 3.6f, 1.0f, 1.0f, 0.5f, 0.5f));
+    // _mm256_rcp_ps(): The maximum relative error for this approximation is less than 1.5*2^-12 = 0.0003662109375.
+    ASSERT_TRUE(almost_equal(rcp(S(1.0f, 2.0f, 0.5f, -4.0f, 1.0f, 1.0f, 1.0f, 1.0f)), S(1.0f, 0.5f, 2.0f, -0.25f, 1.0f, 1.0f, 1.0f, 1.0f), 0.0005f));
+    HI_ASSERT_SIMD_EQ(sqrt(S(1.0f, 1.5625, 4.0f, 9.0f, 16.0f, 25.0f, 36.0f, 49.0f)), S(1.0f, 1.25f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f));
+    // _mm256_rsqrt_ps(): The maximum relative error for this approximation is less than 1.5*2^-12 = 0.0003662109375.
+    ASSERT_TRUE(almost_equal(rsqrt(S(1.0f, 1.5625, 4.0f, 9.0f, 1.0f, 1.0f, 1.0f, 1.0f)), S(1.0f, 0.8f, 0.5f, 0.3333333333333f, 1.0f, 1.0f, 1.0f, 1.0f), 0.0005f));
+
+    HI_ASSERT_SIMD_EQ(interleaved_sub_add(a, b), S(-1.0f, 6.0f, 6.0f, 44.0f, -1.0f, 1.0f, 12.0f, -4.0f));
+
+    auto c = S(0.0f, 2.2f, -3.2f, -3.6f, 2.5f, -2.5f, 3.5f, -3.5f);
+    HI_ASSERT_SIMD_EQ(floor(c), S(0.0f, 2.0f, -4.0f, -4.0f, 2.0f, -3.0f, 3.0f, -4.0f));
+    HI_ASSERT_SIMD_EQ(ceil(c), S(0.0f, 3.0f, -3.0f, -3.0f, 3.0f, -2.0f, 4.0f, -3.0f));
+    HI_ASSERT_SIMD_EQ(round<>(c), S(0.0f, 2.0f, -3.0f, -4.0f, 2.0f, -2.0f, 4.0f, -4.0f));
+}
+
+TEST(native_f32x8, bit_wise)
+{
+    HI_ASSERT_SIMD_EQ(S(0.0f, 2.0f, 0.0f, 42.0f, 0.0f, 0.0f, 0.0f, 0.0f) | S(1.0f, 0.0f, -3.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f), S(1.0f, 2.0f, -3.0f, 42.0f, 0.0f, 0.0f, 0.0f, 1.0f));
+    HI_ASSERT_SIMD_EQ(S(1.0f, 2.0f, 3.0f, 42.0f, 5.0f, 6.0f, 7.0f, 8.0f) & S::from_mask(0b1000'1010), S(0.0f, 2.0f, 0.0f, 42.0f, 0.0f, 0.0f, 0.0f, 8.0f));
+    HI_ASSERT_SIMD_EQ(S::from_mask(0b0110'0011) ^ S::from_mask(0b1010'1010), S::from_mask(0b1100'1001));
+    HI_ASSERT_SIMD_EQ(~S::from_mask(0b0101'1010), S::from_mask(0b1010'0101));
+
+    HI_ASSERT_SIMD_EQ(not_and(S::from_mask(0b1000'1010), S(1.0f, 2.0f, 3.0f, 42.0f, 5.0f, 6.0f, 7.0f, 8.0f)), S(1.0f, 0.0f, 3.0f, 0.0f, 5.0f, 6.0f, 7.0f, 0.0f));
+
+    for (size_t i = 0; i != 256; ++i) {
+        ASSERT_EQ(S::from_mask(i).mask(), i);
+    }
+}
+
+TEST(native_f32x8, access)
+{
+    auto tmp = S(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f);
+
+    ASSERT_EQ(get<0>(tmp), 1.0f);
+    ASSERT_EQ(get<1>(tmp), 2.0f);
+    ASSERT_EQ(get<2>(tmp), 3.0f);
+    ASSERT_EQ(get<3>(tmp), 4.0f);
+    ASSERT_EQ(get<4>(tmp), 5.0f);
+    ASSERT_EQ(get<5>(tmp), 6.0f);
+    ASSERT_EQ(get<6>(tmp), 7.0f);
+    ASSERT_EQ(get<7>(tmp), 8.0f);
+
+    HI_ASSERT_SIMD_EQ(insert<0>(tmp, 42.0f), S(42.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f));
+    HI_ASSERT_SIMD_EQ(insert<5>(tmp, 42.0f), S(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 42.0f, 7.0f, 8.0f));
+    HI_ASSERT_SIMD_EQ(insert<7>(tmp, 42.0f), S(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 42.0f));
+
+    HI_ASSERT_SIMD_EQ(set_zero<0b0000'0000>(tmp), S(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f));
+    HI_ASSERT_SIMD_EQ(set_zero<0b1001'0001>(tmp), S(0.0f, 2.0f, 3.0f, 4.0f, 0.0f, 6.0f, 7.0f, 0.0f));
+    HI_ASSERT_SIMD_EQ(set_zero<0b1111'1111>(tmp), S());
+}
+
+TEST(native_f32x8, blend)
+{
+    auto a = S(1.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f);
+    auto b = S(42.0f, 43.0f, 44.0f, 45.0f, 46.0f, 47.0f, 48.0f, 49.0f);
+
+    HI_ASSERT_SIMD_EQ(blend<0b0000'0000>(a, b), a);
+    HI_ASSERT_SIMD_EQ(blend<0b0000'0001>(a, b), S(42.0f, 2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f));
+    HI_ASSERT_SIMD_EQ(blend<0b1001'0010>(a, b), S(1.0f, 43.0f, 3.0f, 4.0f, 46.0f, 6.0f, 7.0f, 49.0f));
+    HI_ASSERT_SIMD_EQ(blend<0b1111'1111>(a, b), b);
+
+    HI_ASSERT_SIMD_EQ(blend(a, b, S::from_mask(0b0110'0100)), S(1.0f, 2.0f, 44.0f, 4.0f, 5.0f, 47.0f, 48.0f, 8.0f));
+}
+
+TEST(native_f32x8, permute)
+{
+    auto tmp = S(2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f);
+
+    HI_ASSERT_SIMD_EQ(permute<"abcdefgh">(tmp), tmp);
+    HI_ASSERT_SIMD_EQ(permute<"00000000">(tmp), tmp);
+    HI_ASSERT_SIMD_EQ(permute<"hgfedcba">(tmp), S(9.0f, 8.0f, 7.0f, 6.0f, 5.0f, 4.0f, 3.0f, 2.0f));
+    HI_ASSERT_SIMD_EQ(permute<"aaaaaaaa">(tmp), S::broadcast(2.0f));
+    HI_ASSERT_SIMD_EQ(permute<"hhhhhhhh">(tmp), S::broadcast(9.0f));
+    // In-lane permute.
+    HI_ASSERT_SIMD_EQ(permute<"badcfehg">(tmp), S(3.0f, 2.0f, 5.0f, 4.0f, 7.0f, 6.0f, 9.0f, 8.0f));
+    // Cross-lane permute.
+    HI_ASSERT_SIMD_EQ(permute<"efghabcd">(tmp), S(6.0f, 7.0f, 8.0f, 9.0f, 2.0f, 3.0f, 4.0f, 5.0f));
+    HI_ASSERT_SIMD_EQ(permute<"ahbgcfde">(tmp), S(2.0f, 9.0f, 3.0f, 8.0f, 4.0f, 7.0f, 5.0f, 6.0f));
+}
+
+TEST(native_f32x8, swizzle)
+{
+    auto tmp = S(2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f);
+
+    HI_ASSERT_SIMD_EQ(swizzle<"abcdefgh">(tmp), tmp);
+    HI_ASSERT_SIMD_EQ(swizzle<"00000000">(tmp), S());
+    HI_ASSERT_SIMD_EQ(swizzle<"11111111">(tmp), S::broadcast(1.0f));
+    HI_ASSERT_SIMD_EQ(swizzle<"10000001">(tmp), S(1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f));
+    HI_ASSERT_SIMD_EQ(swizzle<"h000000a">(tmp), S(9.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 2.0f));
+    HI_ASSERT_SIMD_EQ(swizzle<"1h0g1f0e">(tmp), S(1.0f, 9.0f, 0.0f, 8.0f, 1.0f, 7.0f, 0.0f, 6.0f));
+}
+
+TEST(native_f32x8, horizontal)
+{
+    auto a = S(2.0f, 3.0f, 4.0f, 5.0f, 6.0f, 7.0f, 8.0f, 9.0f);
+    auto b = S(12.0f, 13.0f, 14.0f, 15.0f, 16.0f, 17.0f, 18.0f, 19.0f);
+
+#ifdef HI_HAS_AVX2
+    HI_ASSERT_SIMD_EQ(horizontal_add(a, b), S(5.0f, 9.0f, 13.0f, 17.0f, 25.0f, 29.0f, 33.0f, 37.0f));
+    HI_ASSERT_SIMD_EQ(horizontal_sub(a, b), S::broadcast(-1.0f));
+#endif
+
+    HI_ASSERT_SIMD_EQ(horizontal_sum(a), S::broadcast(44.0f));
+
+    HI_ASSERT_SIMD_EQ(dot_product<0b0000'0000>(a, b), S::broadcast(0.0f));
+    HI_ASSERT_SIMD_EQ(dot_product<0b0000'0001>(a, b), S::broadcast(24.0f));
+    HI_ASSERT_SIMD_EQ(dot_product<0b1000'0001>(a, b), S::broadcast(195.0f));
+    HI_ASSERT_SIMD_EQ(dot_product<0b1111'1111>(a, b), S::broadcast(724.0f));
+}
+
+hi_warning_pop();
+
+#endif
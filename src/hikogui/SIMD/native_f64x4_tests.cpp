@@ -6,6 +6,8 @@
 #include "simd_test_utility.hpp"
 #include "../macros.hpp"
 
+#ifdef HI_HAS_AVX
+
 hi_warning_push();
 // C26474: Don't cast between pointer types when the conversion could be implicit (type.1).
 // For the test we need to do this explicit.
@@ -280,3 +282,5 @@ TEST(native_f64x4, horizontal)
 }
 
 hi_warning_pop();
+
+#endif
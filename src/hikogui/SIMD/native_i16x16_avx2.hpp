@@ -0,0 +1,638 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "native_simd_utility.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <array>
+#include <ostream>
+#include <cstring>
+
+
+
+hi_warning_push();
+// Ignore "C26490: Don't use reinterpret_cast", needed for intrinsic loads and stores.
+hi_warning_ignore_msvc(26490);
+
+namespace hi { inline namespace v1 {
+
+#ifdef HI_HAS_AVX2
+
+/** A int16_t x 16 (__m256i) AVX2 register.
+ *
+ *
+ * When loading and storing from memory this is the order of the element in the register
+ *
+ * ```
+ *   lo hi lo hi lo hi lo hi       lo hi lo hi
+ *  +-+-+-+-+-+-+-+-+-+-+-+-   -+-+-+-+-+-+-+
+ *  |el 0|el 1|el 2|el 3| ... |el 14|el 15|
+ *  +-+-+-+-+-+-+-+-+-+-+-+-   -+-+-+-+-+-+-+
+ *   0  1 2  3 4  5 6  7       28 29 30 31   memory address.
+ * ```
+ *
+ * In the function below a `mask` values least-significant-bit corresponds to element 0.
+ *
+ */
+template<>
+struct native_simd<int16_t, 16> {
+    using value_type = int16_t;
+    constexpr static size_t size = 16;
+    using register_type = __m256i;
+    using array_type = std::array<value_type, size>;
+
+    register_type v;
+
+    native_simd(native_simd const&) noexcept = default;
+    native_simd(native_simd&&) noexcept = default;
+    native_simd& operator=(native_simd const&) noexcept = default;
+    native_simd& operator=(native_simd&&) noexcept = default;
+
+    /** Initialize all elements to zero.
+     */
+    native_simd() noexcept : v(_mm256_setzero_si256()) {}
+
+    [[nodiscard]] explicit native_simd(register_type other) noexcept : v(other) {}
+
+    [[nodiscard]] explicit operator register_type() const noexcept
+    {
+        return v;
+    }
+
+    /** Initialize the element to the values in the arguments.
+     *
+     * @param a The value for element 0.
+     * @param b The value for element 1.
+     * @param c The value for element 2.
+     * @param d The value for element 3.
+     * @param e The value for element 4.
+     * @param f The value for element 5.
+     * @param g The value for element 6.
+     * @param h The value for element 7.
+     * @param i The value for element 8.
+     * @param j The value for element 9.
+     * @param k The value for element 10.
+     * @param l The value for element 11.
+     * @param m The value for element 12.
+     * @param n The value for element 13.
+     * @param o The value for element 14.
+     * @param p The value for element 15.
+     */
+    [[nodiscard]] native_simd(
+        value_type a,
+        value_type b = value_type{0},
+        value_type c = value_type{0},
+        value_type d = value_type{0},
+        value_type e = value_type{0},
+        value_type f = value_type{0},
+        value_type g = value_type{0},
+        value_type h = value_type{0},
+        value_type i = value_type{0},
+        value_type j = value_type{0},
+        value_type k = value_type{0},
+        value_type l = value_type{0},
+        value_type m = value_type{0},
+        value_type n = value_type{0},
+        value_type o = value_type{0},
+        value_type p = value_type{0}) noexcept :
+        v(_mm256_set_epi16(p, o, n, m, l, k, j, i, h, g, f, e, d, c, b, a))
+    {
+    }
+
+    [[nodiscard]] explicit native_simd(value_type const *other) noexcept :
+        v(_mm256_loadu_si256(reinterpret_cast<register_type const *>(other)))
+    {
+    }
+
+    void store(value_type *out) const noexcept
+    {
+        hi_axiom_not_null(out);
+        _mm256_storeu_si256(reinterpret_cast<register_type *>(out), v);
+    }
+
+    /** Load the first elements from memory, the other elements are set to zero.
+     *
+     * This is used to load the tail of an array, memory beyond the
+     * @a count elements is not accessed.
+     *
+     * AVX2 has no 16-bit masked load, the elements are copied through the stack.
+     *
+     * @param other A pointer to the elements to load.
+     * @param count The number of elements to load.
+     */
+    [[nodiscard]] native_simd(value_type const *other, size_t count) noexcept
+    {
+        hi_axiom(count <= size);
+        auto tmp = array_type{};
+        std::memcpy(tmp.data(), other, count * sizeof(value_type));
+        v = _mm256_loadu_si256(reinterpret_cast<register_type const *>(tmp.data()));
+    }
+
+    /** Store the first elements to memory.
+     *
+     * This is used to store the tail of an array, memory beyond the
+     * @a count elements is not accessed.
+     *
+     * @param out A pointer to where the elements are stored.
+     * @param count The number of elements to store.
+     */
+    void store(value_type *out, size_t count) const noexcept
+    {
+        hi_axiom(count <= size);
+        hilet tmp = static_cast<array_type>(*this);
+        std::memcpy(out, tmp.data(), count * sizeof(value_type));
+    }
+
+    [[nodiscard]] explicit native_simd(void const *other) noexcept : v(_mm256_loadu_si256(static_cast<register_type const *>(other)))
+    {
+    }
+
+    void store(void *out) const noexcept
+    {
+        hi_axiom_not_null(out);
+        _mm256_storeu_si256(static_cast<register_type *>(out), v);
+    }
+
+    [[nodiscard]] explicit native_simd(std::span<value_type const> other) noexcept
+    {
+        hi_axiom(other.size() >= size);
+        v = _mm256_loadu_si256(reinterpret_cast<register_type const *>(other.data()));
+    }
+
+    void store(std::span<value_type> out) const noexcept
+    {
+        hi_axiom(out.size() >= size);
+        _mm256_storeu_si256(reinterpret_cast<register_type *>(out.data()), v);
+    }
+
+    [[nodiscard]] explicit native_simd(array_type other) noexcept :
+        v(_mm256_loadu_si256(reinterpret_cast<register_type const *>(other.data())))
+    {
+    }
+
+    [[nodiscard]] explicit operator array_type() const noexcept
+    {
+        auto r = array_type{};
+        _mm256_storeu_si256(reinterpret_cast<register_type *>(r.data()), v);
+        return r;
+    }
+
+    /** Broadcast a single value to all the elements.
+     *
+     * ```
+     * r[i] = a
+     * ```
+     */
+    [[nodiscard]] static native_simd broadcast(value_type a) noexcept
+    {
+        return native_simd{_mm256_set1_epi16(a)};
+    }
+
+    /** Broadcast the first element to all the elements.
+     *
+     * ```
+     * r[i] = a[0]
+     * ```
+     */
+    [[nodiscard]] static native_simd broadcast(native_simd a) noexcept
+    {
+        return native_simd{_mm256_broadcastw_epi16(_mm256_castsi256_si128(a.v))};
+    }
+
+    [[nodiscard]] static native_simd ones() noexcept
+    {
+        hilet tmp = _mm256_undefined_si256();
+        return native_simd{_mm256_cmpeq_epi16(tmp, tmp)};
+    }
+
+    /** For each bit in mask set corresponding element to all-ones or all-zeros.
+     */
+    [[nodiscard]] static native_simd from_mask(size_t a) noexcept
+    {
+        hi_axiom(a <= 0xffff);
+
+        hilet bits = _mm256_set_epi16(
+            truncate<int16_t>(0x8000),
+            0x4000,
+            0x2000,
+            0x1000,
+            0x0800,
+            0x0400,
+            0x0200,
+            0x0100,
+            0x0080,
+            0x0040,
+            0x0020,
+            0x0010,
+            0x0008,
+            0x0004,
+            0x0002,
+            0x0001);
+        hilet tmp = _mm256_and_si256(_mm256_set1_epi16(truncate<int16_t>(a)), bits);
+        return native_simd{_mm256_cmpeq_epi16(tmp, bits)};
+    }
+
+    /** Concatenate the top bit of each element.
+     */
+    [[nodiscard]] size_t mask() const noexcept
+    {
+        // Saturating-pack the elements to bytes, which keeps the sign, then undo
+        // the lane interleave of the pack.
+        hilet packed = _mm256_permute4x64_epi64(_mm256_packs_epi16(v, v), 0b11'01'10'00);
+        return narrow_cast<size_t>(truncate<uint32_t>(_mm256_movemask_epi8(packed)) & 0xffff);
+    }
+
+    [[nodiscard]] friend bool equal(native_simd a, native_simd b) noexcept
+    {
+        hilet tmp = _mm256_xor_si256(a.v, b.v);
+        return _mm256_testz_si256(tmp, tmp) == 1;
+    }
+
+    [[nodiscard]] friend native_simd operator==(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_cmpeq_epi16(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator!=(native_simd a, native_simd b) noexcept
+    {
+        return ~(a == b);
+    }
+
+    [[nodiscard]] friend native_simd operator<(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_cmpgt_epi16(b.v, a.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator>(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_cmpgt_epi16(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator<=(native_simd a, native_simd b) noexcept
+    {
+        return ~(a > b);
+    }
+
+    [[nodiscard]] friend native_simd operator>=(native_simd a, native_simd b) noexcept
+    {
+        return ~(a < b);
+    }
+
+    [[nodiscard]] friend native_simd operator+(native_simd a) noexcept
+    {
+        return a;
+    }
+
+    [[nodiscard]] friend native_simd operator-(native_simd a) noexcept
+    {
+        return native_simd{} - a;
+    }
+
+    [[nodiscard]] friend native_simd operator+(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_add_epi16(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator-(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_sub_epi16(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator*(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_mullo_epi16(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator&(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_and_si256(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator|(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_or_si256(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator^(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_xor_si256(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator~(native_simd a) noexcept
+    {
+        return not_and(a, ones());
+    }
+
+    [[nodiscard]] friend native_simd operator<<(native_simd a, unsigned int b) noexcept
+    {
+        hi_axiom_bounds(b, sizeof(value_type) * CHAR_BIT);
+        return native_simd{_mm256_sll_epi16(a.v, _mm_cvtsi32_si128(truncate<int>(b)))};
+    }
+
+    [[nodiscard]] friend native_simd operator>>(native_simd a, unsigned int b) noexcept
+    {
+        hi_axiom_bounds(b, sizeof(value_type) * CHAR_BIT);
+        return native_simd{_mm256_sra_epi16(a.v, _mm_cvtsi32_si128(truncate<int>(b)))};
+    }
+
+    [[nodiscard]] friend native_simd min(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_min_epi16(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd max(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_max_epi16(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd abs(native_simd a) noexcept
+    {
+        return native_simd{_mm256_abs_epi16(a.v)};
+    }
+
+    /** Set elements to zero.
+     *
+     * @tparam Mask A bit mask corresponding to each element.
+     * @param a The value to modify.
+     * @return argument @a with elements set to zero where the corresponding @a Mask bit was '1'.
+     */
+    template<size_t Mask>
+    [[nodiscard]] friend native_simd set_zero(native_simd a) noexcept
+    {
+        static_assert(Mask <= 0xffff);
+        return blend<Mask>(a, native_simd{});
+    }
+
+    /** Insert a value into an element of a vector.
+     *
+     * @tparam Index the index of the element where insert the value.
+     * @param a The vector to insert the value into.
+     * @param b The value to insert.
+     * @return The vector with the inserted value.
+     */
+    template<size_t Index>
+    [[nodiscard]] friend native_simd insert(native_simd a, value_type b) noexcept
+    {
+        static_assert(Index < size);
+        return native_simd{_mm256_insert_epi16(a.v, b, Index)};
+    }
+
+    /** Extract an element from a vector.
+     *
+     * @tparam Index the index of the element.
+     * @param a The vector to select the element from.
+     * @return The value of the selected element.
+     */
+    template<size_t Index>
+    [[nodiscard]] friend value_type get(native_simd a) noexcept
+    {
+        static_assert(Index < size);
+        return truncate<value_type>(_mm256_extract_epi16(a.v, Index));
+    }
+
+    /** Select elements from two vectors.
+     *
+     * @tparam Mask A mask to select bits from @a a when '0'; or @a b when '1'. The
+     *         lsb corresponds with element zero.
+     * @param a A vector for which element are selected when the bit in @a Mask is '0'.
+     * @param b A vector for which element are selected when the bit in @a Mask is '1'.
+     * @return A vector with element selected from @a a and @a b
+     */
+    template<size_t Mask>
+    [[nodiscard]] friend native_simd blend(native_simd a, native_simd b) noexcept
+    {
+        static_assert(Mask <= 0xffff);
+
+        if constexpr (Mask == 0) {
+            return a;
+        } else if constexpr (Mask == 0xffff) {
+            return b;
+        } else if constexpr ((Mask & 0xff) == (Mask >> 8)) {
+            // _mm256_blend_epi16() uses the same 8-bit mask for both 128-bit lanes.
+            return native_simd{_mm256_blend_epi16(a.v, b.v, Mask & 0xff)};
+        } else {
+            return blend(a, b, from_mask(Mask));
+        }
+    }
+
+    /** Select elements from two vectors.
+     *
+     * @param a A vector for which element are selected when the element in @a mask is all-zeros.
+     * @param b A vector for which element are selected when the element in @a mask is all-ones.
+     * @param mask A vector with elements set to all-ones or all-zeros, as returned by the compare operators.
+     * @return A vector with element selected from @a a and @a b
+     */
+    [[nodiscard]] friend native_simd blend(native_simd a, native_simd b, native_simd mask) noexcept
+    {
+        return native_simd{_mm256_blendv_epi8(a.v, b.v, mask.v)};
+    }
+
+    /** Permute elements, ignoring numeric elements.
+     *
+     * The characters in @a SourceElements mean the following:
+     * - 'a' - 'p': The indices to elements 0 and 15 of @a a.
+     * - 'x', 'y', 'z', 'w'': The indices to elements 0, 1, 2, 3 of @a a.
+     * - Any other character is treated as if the original element was selected.
+     *
+     * @tparam SourceElements A string representing the order of elements. First character
+     *         matches the first element.
+     * @param a The vector to swizzle the elements
+     * @returns A vector with the elements swizzled.
+     */
+    template<fixed_string SourceElements>
+    [[nodiscard]] friend native_simd permute(native_simd a) noexcept
+    {
+        static_assert(SourceElements.size() == size);
+        constexpr auto order = detail::native_swizzle_to_packed_indices<SourceElements, size>();
+
+        if constexpr (order == 0xfedc'ba98'7654'3210) {
+            return a;
+        } else if constexpr (order == 0) {
+            return broadcast(a);
+        } else {
+            // _mm256_shuffle_epi8() only shuffles within a 128-bit lane; shuffle both the
+            // original and the lane-swapped register and combine the results.
+            constexpr auto same_lane = permute_byte_indices<order, false>();
+            constexpr auto other_lane = permute_byte_indices<order, true>();
+
+            hilet swapped = _mm256_permute2x128_si256(a.v, a.v, 0b0000'0001);
+            hilet lo = _mm256_shuffle_epi8(a.v, _mm256_loadu_si256(reinterpret_cast<register_type const *>(same_lane.data())));
+            hilet hi = _mm256_shuffle_epi8(swapped, _mm256_loadu_si256(reinterpret_cast<register_type const *>(other_lane.data())));
+            return native_simd{_mm256_or_si256(lo, hi)};
+        }
+    }
+
+    /** Swizzle elements.
+     *
+     * The elements are swizzled in the order specified in @a SourceElements.
+     * Each character in @a SourceElements is a index to an element in @a a or
+     * a numeric value.
+     *
+     * The characters in @a SourceElements mean the following:
+     * - 'a' - 'p': The indices to elements 0 and 15 of @a a.
+     * - 'x', 'y', 'z', 'w'': The indices to elements 0, 1, 2, 3 of @a a.
+     * - '0', '1': The values 0 and 1.
+     *
+     * @tparam SourceElements A string representing the order of elements. First character
+     *         matches the first element.
+     * @param a The vector to swizzle the elements
+     * @returns A vector with the elements swizzled.
+     */
+    template<fixed_string SourceElements>
+    [[nodiscard]] friend native_simd swizzle(native_simd a) noexcept
+    {
+        static_assert(SourceElements.size() == size);
+        constexpr auto one_mask = detail::native_swizzle_to_mask<SourceElements, size, '1'>();
+        constexpr auto zero_mask = detail::native_swizzle_to_mask<SourceElements, size, '0'>();
+        constexpr auto number_mask = one_mask | zero_mask;
+
+        if constexpr (number_mask == 0xffff) {
+            // Swizzle was /[01]{16}/.
+            return swizzle_numbers<SourceElements>();
+
+        } else if constexpr (number_mask == 0) {
+            // Swizzle was /[^01]{16}/.
+            return permute<SourceElements>(a);
+
+        } else if constexpr (number_mask == zero_mask) {
+            // Swizzle was /[^1]{16}/.
+            hilet ordered = permute<SourceElements>(a);
+            return set_zero<zero_mask>(ordered);
+
+        } else {
+            hilet ordered = permute<SourceElements>(a);
+            hilet numbers = swizzle_numbers<SourceElements>();
+            return blend<number_mask>(ordered, numbers);
+        }
+    }
+
+    /** Horizontal add.
+     *
+     * Add elements pair-wise in both vectors, then merge the results:
+     * ```
+     * r[0] = a[0] + a[1]
+     * r[1] = a[2] + a[3]
+     * ...
+     * r[7] = a[14] + a[15]
+     * r[8] = b[0] + b[1]
+     * ...
+     * r[15] = b[14] + b[15]
+     * ```
+     */
+    [[nodiscard]] friend native_simd horizontal_add(native_simd a, native_simd b) noexcept
+    {
+        // _mm256_hadd_epi16() works on each 128-bit lane, reorder the 64-bit quarters afterwards.
+        return native_simd{_mm256_permute4x64_epi64(_mm256_hadd_epi16(a.v, b.v), 0b11'01'10'00)};
+    }
+
+    /** Horizontal subtract.
+     *
+     * Subtract elements pair-wise in both vectors, then merge the results:
+     * ```
+     * r[0] = a[0] - a[1]
+     * r[1] = a[2] - a[3]
+     * ...
+     * r[7] = a[14] - a[15]
+     * r[8] = b[0] - b[1]
+     * ...
+     * r[15] = b[14] - b[15]
+     * ```
+     */
+    [[nodiscard]] friend native_simd horizontal_sub(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_permute4x64_epi64(_mm256_hsub_epi16(a.v, b.v), 0b11'01'10'00)};
+    }
+
+    /** Sum all elements of a vector.
+     *
+     * ```
+     * r = broadcast(a[0] + a[1] + ... + a[15])
+     * ```
+     */
+    [[nodiscard]] friend native_simd horizontal_sum(native_simd a) noexcept
+    {
+        auto tmp = a + native_simd{_mm256_permute2x128_si256(a.v, a.v, 0b0000'0001)};
+        tmp = tmp + native_simd{_mm256_shuffle_epi32(tmp.v, 0b01'00'11'10)};
+        tmp = tmp + native_simd{_mm256_shuffle_epi32(tmp.v, 0b10'11'00'01)};
+        return tmp + native_simd{_mm256_or_si256(_mm256_srli_epi32(tmp.v, 16), _mm256_slli_epi32(tmp.v, 16))};
+    }
+
+    /** not followed by and.
+     *
+     * r = ~a & b
+     *
+     */
+    [[nodiscard]] friend native_simd not_and(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_andnot_si256(a.v, b.v)};
+    }
+
+    friend std::ostream& operator<<(std::ostream& a, native_simd b) noexcept
+    {
+        hilet tmp = static_cast<array_type>(b);
+
+        a << "(";
+        for (auto i = 0_uz; i != size; ++i) {
+            if (i != 0) {
+                a << ", ";
+            }
+            a << tmp[i];
+        }
+        return a << ")";
+    }
+
+    template<fixed_string SourceElements>
+    [[nodiscard]] static native_simd swizzle_numbers() noexcept
+    {
+        constexpr auto one_mask = detail::native_swizzle_to_mask<SourceElements, size, '1'>();
+        constexpr auto zero_mask = detail::native_swizzle_to_mask<SourceElements, size, '0'>();
+        constexpr auto number_mask = one_mask | zero_mask;
+        constexpr auto alpha_mask = ~number_mask & 0xffff;
+
+        if constexpr ((zero_mask | alpha_mask) == 0xffff) {
+            return {};
+
+        } else if constexpr ((one_mask | alpha_mask) == 0xffff) {
+            return broadcast(1);
+
+        } else {
+            return native_simd{_mm256_and_si256(from_mask(one_mask).v, _mm256_set1_epi16(1))};
+        }
+    }
+
+private:
+    /** The byte indices for _mm256_shuffle_epi8() of a permute.
+     *
+     * @tparam Order The packed 4-bit element indices.
+     * @tparam OtherLane Select the bytes which come from the other 128-bit lane,
+     *         when false select the bytes which come from the same lane.
+     * @return Byte indices; 0x80 for bytes that are taken from the other shuffle.
+     */
+    template<size_t Order, bool OtherLane>
+    [[nodiscard]] constexpr static std::array<int8_t, 32> permute_byte_indices() noexcept
+    {
+        auto r = std::array<int8_t, 32>{};
+        for (auto i = 0_uz; i != size; ++i) {
+            hilet src = (Order >> (i * 4)) & 15;
+            hilet is_other_lane = (src / 8) != (i / 8);
+            if (is_other_lane == OtherLane) {
+                r[i * 2] = narrow_cast<int8_t>((src % 8) * 2);
+                r[i * 2 + 1] = narrow_cast<int8_t>((src % 8) * 2 + 1);
+            } else {
+                r[i * 2] = int8_t{-128};
+                r[i * 2 + 1] = int8_t{-128};
+            }
+        }
+        return r;
+    }
+};
+
+#endif
+
+}} // namespace hi::v1
+
+hi_warning_pop();
@@ -0,0 +1,146 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "native_i16x16_avx2.hpp"
+#include "simd_test_utility.hpp"
+#include "../macros.hpp"
+
+#ifdef HI_HAS_AVX2
+
+hi_warning_push();
+// C26474: Don't cast between pointer types when the conversion could be implicit (type.1).
+// For the test we need to do this explicit.
+hi_warning_ignore_msvc(26474);
+
+using S = hi::native_simd<int16_t, 16>;
+using A = S::array_type;
+
+TEST(native_i16x16, construct)
+{
+    {
+        auto expected = A{};
+        ASSERT_EQ(static_cast<A>(S{}), expected);
+    }
+
+    {
+        auto expected = A{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+        ASSERT_EQ(static_cast<A>(S{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}), expected);
+        ASSERT_EQ(static_cast<A>(S{expected.data()}), expected);
+        ASSERT_EQ(static_cast<A>(S{expected}), expected);
+    }
+
+    {
+        auto expected = A{-3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3, -3};
+        ASSERT_EQ(static_cast<A>(S::broadcast(-3)), expected);
+        ASSERT_EQ(static_cast<A>(S::broadcast(S{-3, 4, 5})), expected);
+    }
+}
+
+TEST(native_i16x16, tail)
+{
+    auto from = std::array<int16_t, 17>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
+
+    HI_ASSERT_SIMD_EQ(S(from.data(), 0), S());
+    HI_ASSERT_SIMD_EQ(S(from.data(), 11), S(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11));
+
+    auto to = std::array<int16_t, 17>{};
+    S(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16).store(to.data(), 9);
+    ASSERT_EQ(to, (std::array<int16_t, 17>{1, 2, 3, 4, 5, 6, 7, 8, 9, 0, 0, 0, 0, 0, 0, 0, 0}));
+}
+
+TEST(native_i16x16, compare)
+{
+    auto a = S(1, 2, 3, 4, -1, -2, -3, -4, 1, 2, 3, 4, -1, -2, -3, -4);
+    auto b = S::broadcast(2);
+
+    ASSERT_EQ((a == b).mask(), 0b0000'0010'0000'0010);
+    ASSERT_EQ((a != b).mask(), 0b1111'1101'1111'1101);
+    ASSERT_EQ((a < b).mask(), 0b1111'0001'1111'0001);
+    ASSERT_EQ((a <= b).mask(), 0b1111'0011'1111'0011);
+    ASSERT_EQ((a > b).mask(), 0b0000'1100'0000'1100);
+    ASSERT_EQ((a >= b).mask(), 0b0000'1110'0000'1110);
+}
+
+TEST(native_i16x16, math)
+{
+    auto a = S(0, 2, 3, 42, 1, -1, 8, -8, 100, -100, 7, 6, 5, 4, 3, 2);
+    auto b = S(1, 4, -3, 2, 2, 2, -4, 4, 3, 3, 1, 1, 1, 1, 1, 1);
+
+    HI_ASSERT_SIMD_EQ(-a, S(0, -2, -3, -42, -1, 1, -8, 8, -100, 100, -7, -6, -5, -4, -3, -2));
+    HI_ASSERT_SIMD_EQ(a + b, S(1, 6, 0, 44, 3, 1, 4, -4, 103, -97, 8, 7, 6, 5, 4, 3));
+    HI_ASSERT_SIMD_EQ(a - b, S(-1, -2, 6, 40, -1, -3, 12, -12, 97, -103, 6, 5, 4, 3, 2, 1));
+    HI_ASSERT_SIMD_EQ(a * b, S(0, 8, -9, 84, 2, -2, -32, -32, 300, -300, 7, 6, 5, 4, 3, 2));
+    HI_ASSERT_SIMD_EQ(min(a, b), S(0, 2, -3, 2, 1, -1, -4, -8, 3, -100, 1, 1, 1, 1, 1, 1));
+    HI_ASSERT_SIMD_EQ(max(a, b), S(1, 4, 3, 42, 2, 2, 8, 4, 100, 3, 7, 6, 5, 4, 3, 2));
+    HI_ASSERT_SIMD_EQ(abs(a), S(0, 2, 3, 42, 1, 1, 8, 8, 100, 100, 7, 6, 5, 4, 3, 2));
+}
+
+TEST(native_i16x16, bit_wise)
+{
+    auto a = S(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+
+    HI_ASSERT_SIMD_EQ(a & S::from_mask(0b1000'0000'1000'1010), S(0, 2, 0, 4, 0, 0, 0, 8, 0, 0, 0, 0, 0, 0, 0, 16));
+    HI_ASSERT_SIMD_EQ(~S::from_mask(0b0101'1010'0000'1111), S::from_mask(0b1010'0101'1111'0000));
+    HI_ASSERT_SIMD_EQ(
+        not_and(S::from_mask(0b1111'1111'1111'1110), a), S(1, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0));
+
+    HI_ASSERT_SIMD_EQ(S::broadcast(-4) << 2, S::broadcast(-16));
+    HI_ASSERT_SIMD_EQ(S::broadcast(-16) >> 2, S::broadcast(-4));
+
+    for (size_t i = 0; i != 0x10000; ++i) {
+        ASSERT_EQ(S::from_mask(i).mask(), i);
+    }
+}
+
+TEST(native_i16x16, access)
+{
+    auto tmp = S(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+
+    ASSERT_EQ(get<0>(tmp), 1);
+    ASSERT_EQ(get<7>(tmp), 8);
+    ASSERT_EQ(get<8>(tmp), 9);
+    ASSERT_EQ(get<15>(tmp), 16);
+
+    HI_ASSERT_SIMD_EQ(insert<9>(tmp, 42), S(1, 2, 3, 4, 5, 6, 7, 8, 9, 42, 11, 12, 13, 14, 15, 16));
+    HI_ASSERT_SIMD_EQ(set_zero<0b1111'1111'1111'1110>(tmp), S(1));
+}
+
+TEST(native_i16x16, blend)
+{
+    auto a = S(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+    auto b = S::broadcast(42);
+
+    // Same mask in both 128-bit lanes.
+    HI_ASSERT_SIMD_EQ(blend<0b1000'0001'1000'0001>(a, b), S(42, 2, 3, 4, 5, 6, 7, 42, 42, 10, 11, 12, 13, 14, 15, 42));
+    // Different mask in each 128-bit lane.
+    HI_ASSERT_SIMD_EQ(blend<0b0000'0000'0000'0010>(a, b), S(1, 42, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16));
+    HI_ASSERT_SIMD_EQ(blend(a, b, a > S::broadcast(14)), S(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 42, 42));
+}
+
+TEST(native_i16x16, permute)
+{
+    auto tmp = S(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+
+    HI_ASSERT_SIMD_EQ(permute<"abcdefghijklmnop">(tmp), tmp);
+    HI_ASSERT_SIMD_EQ(permute<"ponmlkjihgfedcba">(tmp), S(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1));
+    HI_ASSERT_SIMD_EQ(permute<"ijklmnopabcdefgh">(tmp), S(9, 10, 11, 12, 13, 14, 15, 16, 1, 2, 3, 4, 5, 6, 7, 8));
+    HI_ASSERT_SIMD_EQ(permute<"apbocndmelfkgjhi">(tmp), S(1, 16, 2, 15, 3, 14, 4, 13, 5, 12, 6, 11, 7, 10, 8, 9));
+
+    HI_ASSERT_SIMD_EQ(swizzle<"000000000000000p">(tmp), S(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 16));
+    HI_ASSERT_SIMD_EQ(swizzle<"1111111111111111">(tmp), S::broadcast(1));
+}
+
+TEST(native_i16x16, horizontal)
+{
+    auto a = S(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+    auto b = S::broadcast(1);
+
+    HI_ASSERT_SIMD_EQ(horizontal_add(a, b), S(3, 7, 11, 15, 19, 23, 27, 31, 2, 2, 2, 2, 2, 2, 2, 2));
+    HI_ASSERT_SIMD_EQ(horizontal_sub(a, b), S(-1, -1, -1, -1, -1, -1, -1, -1, 0, 0, 0, 0, 0, 0, 0, 0));
+    HI_ASSERT_SIMD_EQ(horizontal_sum(a), S::broadcast(136));
+}
+
+hi_warning_pop();
+
+#endif
@@ -0,0 +1,660 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "native_simd_utility.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <array>
+#include <ostream>
+
+
+
+hi_warning_push();
+// Ignore "C26490: Don't use reinterpret_cast", needed for intrinsic loads and stores.
+hi_warning_ignore_msvc(26490);
+
+namespace hi { inline namespace v1 {
+
+#ifdef HI_HAS_AVX512F
+
+/** A int32_t x 16 (__m512i) AVX-512 register.
+ *
+ *
+ * When loading and storing from memory this is the order of the element in the register
+ *
+ * ```
+ *   lo   hi lo   hi lo   hi       lo   hi lo   hi
+ *  +-+-+-+-+-+-+-+-+-+-+-+-+-   -+-+-+-+-+-+-+-+-+
+ *  | el 0  | el 1  | el 2  | ... | el 14 | el 15 |
+ *  +-+-+-+-+-+-+-+-+-+-+-+-+-   -+-+-+-+-+-+-+-+-+
+ *   0     3 4     7 8    11       56   59 60   63   memory address.
+ * ```
+ *
+ * In the function below a `mask` values least-significant-bit corresponds to element 0.
+ *
+ */
+template<>
+struct native_simd<int32_t, 16> {
+    using value_type = int32_t;
+    constexpr static size_t size = 16;
+    using register_type = __m512i;
+    using array_type = std::array<value_type, size>;
+
+    register_type v;
+
+    native_simd(native_simd const&) noexcept = default;
+    native_simd(native_simd&&) noexcept = default;
+    native_simd& operator=(native_simd const&) noexcept = default;
+    native_simd& operator=(native_simd&&) noexcept = default;
+
+    /** Initialize all elements to zero.
+     */
+    native_simd() noexcept : v(_mm512_setzero_si512()) {}
+
+    [[nodiscard]] explicit native_simd(register_type other) noexcept : v(other) {}
+
+    [[nodiscard]] explicit operator register_type() const noexcept
+    {
+        return v;
+    }
+
+    /** Initialize the element to the values in the arguments.
+     *
+     * @param a The value for element 0.
+     * @param b The value for element 1.
+     * @param c The value for element 2.
+     * @param d The value for element 3.
+     * @param e The value for element 4.
+     * @param f The value for element 5.
+     * @param g The value for element 6.
+     * @param h The value for element 7.
+     * @param i The value for element 8.
+     * @param j The value for element 9.
+     * @param k The value for element 10.
+     * @param l The value for element 11.
+     * @param m The value for element 12.
+     * @param n The value for element 13.
+     * @param o The value for element 14.
+     * @param p The value for element 15.
+     */
+    [[nodiscard]] native_simd(
+        value_type a,
+        value_type b = value_type{0},
+        value_type c = value_type{0},
+        value_type d = value_type{0},
+        value_type e = value_type{0},
+        value_type f = value_type{0},
+        value_type g = value_type{0},
+        value_type h = value_type{0},
+        value_type i = value_type{0},
+        value_type j = value_type{0},
+        value_type k = value_type{0},
+        value_type l = value_type{0},
+        value_type m = value_type{0},
+        value_type n = value_type{0},
+        value_type o = value_type{0},
+        value_type p = value_type{0}) noexcept :
+        v(_mm512_set_epi32(p, o, n, m, l, k, j, i, h, g, f, e, d, c, b, a))
+    {
+    }
+
+    [[nodiscard]] explicit native_simd(value_type const *other) noexcept : v(_mm512_loadu_si512(other)) {}
+
+    void store(value_type *out) const noexcept
+    {
+        hi_axiom_not_null(out);
+        _mm512_storeu_si512(out, v);
+    }
+
+    /** Load the first elements from memory, the other elements are set to zero.
+     *
+     * This is used to load the tail of an array, memory beyond the
+     * @a count elements is not accessed.
+     *
+     * @param other A pointer to the elements to load.
+     * @param count The number of elements to load.
+     */
+    [[nodiscard]] native_simd(value_type const *other, size_t count) noexcept
+    {
+        hi_axiom(count <= size);
+        v = _mm512_maskz_loadu_epi32(tail_mask(count), other);
+    }
+
+    /** Store the first elements to memory.
+     *
+     * This is used to store the tail of an array, memory beyond the
+     * @a count elements is not accessed.
+     *
+     * @param out A pointer to where the elements are stored.
+     * @param count The number of elements to store.
+     */
+    void store(value_type *out, size_t count) const noexcept
+    {
+        hi_axiom(count <= size);
+        _mm512_mask_storeu_epi32(out, tail_mask(count), v);
+    }
+
+    [[nodiscard]] explicit native_simd(void const *other) noexcept : v(_mm512_loadu_si512(other)) {}
+
+    void store(void *out) const noexcept
+    {
+        hi_axiom_not_null(out);
+        _mm512_storeu_si512(out, v);
+    }
+
+    [[nodiscard]] explicit native_simd(std::span<value_type const> other) noexcept
+    {
+        hi_axiom(other.size() >= size);
+        v = _mm512_loadu_si512(other.data());
+    }
+
+    void store(std::span<value_type> out) const noexcept
+    {
+        hi_axiom(out.size() >= size);
+        _mm512_storeu_si512(out.data(), v);
+    }
+
+    [[nodiscard]] explicit native_simd(array_type other) noexcept : v(_mm512_loadu_si512(other.data())) {}
+
+    [[nodiscard]] explicit operator array_type() const noexcept
+    {
+        auto r = array_type{};
+        _mm512_storeu_si512(r.data(), v);
+        return r;
+    }
+
+    [[nodiscard]] explicit native_simd(native_simd<float, 16> const& a) noexcept;
+
+    /** Load elements from memory using indices.
+     *
+     * ```
+     * r[i] = ptr[indices[i]]
+     * ```
+     *
+     * @param ptr A pointer to the first element.
+     * @param indices The indices of the elements to load.
+     */
+    [[nodiscard]] static native_simd gather(value_type const *ptr, native_simd indices) noexcept
+    {
+        return native_simd{_mm512_i32gather_epi32(indices.v, ptr, sizeof(value_type))};
+    }
+
+    /** Broadcast a single value to all the elements.
+     *
+     * ```
+     * r[i] = a
+     * ```
+     */
+    [[nodiscard]] static native_simd broadcast(value_type a) noexcept
+    {
+        return native_simd{_mm512_set1_epi32(a)};
+    }
+
+    /** Broadcast the first element to all the elements.
+     *
+     * ```
+     * r[i] = a[0]
+     * ```
+     */
+    [[nodiscard]] static native_simd broadcast(native_simd a) noexcept
+    {
+        return native_simd{_mm512_broadcastd_epi32(_mm512_castsi512_si128(a.v))};
+    }
+
+    [[nodiscard]] static native_simd ones() noexcept
+    {
+        return native_simd{_mm512_set1_epi32(-1)};
+    }
+
+    /** For each bit in mask set corresponding element to all-ones or all-zeros.
+     */
+    [[nodiscard]] static native_simd from_mask(size_t a) noexcept
+    {
+        hi_axiom(a <= 0xffff);
+        return from_mask_register(truncate<__mmask16>(a));
+    }
+
+    /** Concatenate the top bit of each element.
+     */
+    [[nodiscard]] size_t mask() const noexcept
+    {
+        return _mm512_cmplt_epi32_mask(v, _mm512_setzero_si512());
+    }
+
+    [[nodiscard]] friend bool equal(native_simd a, native_simd b) noexcept
+    {
+        return _mm512_cmpneq_epi32_mask(a.v, b.v) == 0;
+    }
+
+    [[nodiscard]] friend native_simd operator==(native_simd a, native_simd b) noexcept
+    {
+        return from_mask_register(_mm512_cmpeq_epi32_mask(a.v, b.v));
+    }
+
+    [[nodiscard]] friend native_simd operator!=(native_simd a, native_simd b) noexcept
+    {
+        return from_mask_register(_mm512_cmpneq_epi32_mask(a.v, b.v));
+    }
+
+    [[nodiscard]] friend native_simd operator<(native_simd a, native_simd b) noexcept
+    {
+        return from_mask_register(_mm512_cmplt_epi32_mask(a.v, b.v));
+    }
+
+    [[nodiscard]] friend native_simd operator>(native_simd a, native_simd b) noexcept
+    {
+        return from_mask_register(_mm512_cmpgt_epi32_mask(a.v, b.v));
+    }
+
+    [[nodiscard]] friend native_simd operator<=(native_simd a, native_simd b) noexcept
+    {
+        return from_mask_register(_mm512_cmple_epi32_mask(a.v, b.v));
+    }
+
+    [[nodiscard]] friend native_simd operator>=(native_simd a, native_simd b) noexcept
+    {
+        return from_mask_register(_mm512_cmpge_epi32_mask(a.v, b.v));
+    }
+
+    [[nodiscard]] friend native_simd operator+(native_simd a) noexcept
+    {
+        return a;
+    }
+
+    [[nodiscard]] friend native_simd operator-(native_simd a) noexcept
+    {
+        return native_simd{} - a;
+    }
+
+    [[nodiscard]] friend native_simd operator+(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm512_add_epi32(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator-(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm512_sub_epi32(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator*(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm512_mullo_epi32(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator&(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm512_and_si512(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator|(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm512_or_si512(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator^(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm512_xor_si512(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator~(native_simd a) noexcept
+    {
+        return not_and(a, ones());
+    }
+
+    [[nodiscard]] friend native_simd operator<<(native_simd a, unsigned int b) noexcept
+    {
+        hi_axiom_bounds(b, sizeof(value_type) * CHAR_BIT);
+        return native_simd{_mm512_sll_epi32(a.v, _mm_cvtsi32_si128(truncate<int>(b)))};
+    }
+
+    [[nodiscard]] friend native_simd operator>>(native_simd a, unsigned int b) noexcept
+    {
+        hi_axiom_bounds(b, sizeof(value_type) * CHAR_BIT);
+        return native_simd{_mm512_sra_epi32(a.v, _mm_cvtsi32_si128(truncate<int>(b)))};
+    }
+
+    [[nodiscard]] friend native_simd min(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm512_min_epi32(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd max(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm512_max_epi32(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd abs(native_simd a) noexcept
+    {
+        return native_simd{_mm512_abs_epi32(a.v)};
+    }
+
+    /** Set elements to zero.
+     *
+     * @tparam Mask A bit mask corresponding to each element.
+     * @param a The value to modify.
+     * @return argument @a with elements set to zero where the corresponding @a Mask bit was '1'.
+     */
+    template<size_t Mask>
+    [[nodiscard]] friend native_simd set_zero(native_simd a) noexcept
+    {
+        static_assert(Mask <= 0xffff);
+        return native_simd{_mm512_maskz_mov_epi32(truncate<__mmask16>(~Mask & 0xffff), a.v)};
+    }
+
+    /** Insert a value into an element of a vector.
+     *
+     * @tparam Index the index of the element where insert the value.
+     * @param a The vector to insert the value into.
+     * @param b The value to insert.
+     * @return The vector with the inserted value.
+     */
+    template<size_t Index>
+    [[nodiscard]] friend native_simd insert(native_simd a, value_type b) noexcept
+    {
+        static_assert(Index < size);
+        return native_simd{_mm512_mask_set1_epi32(a.v, truncate<__mmask16>(1_uz << Index), b)};
+    }
+
+    /** Extract an element from a vector.
+     *
+     * @tparam Index the index of the element.
+     * @param a The vector to select the element from.
+     * @return The value of the selected element.
+     */
+    template<size_t Index>
+    [[nodiscard]] friend value_type get(native_simd a) noexcept
+    {
+        static_assert(Index < size);
+        return _mm_extract_epi32(_mm512_extracti32x4_epi32(a.v, Index / 4), Index % 4);
+    }
+
+    /** Select elements from two vectors.
+     *
+     * @tparam Mask A mask to select bits from @a a when '0'; or @a b when '1'. The
+     *         lsb corresponds with element zero.
+     * @param a A vector for which element are selected when the bit in @a Mask is '0'.
+     * @param b A vector for which element are selected when the bit in @a Mask is '1'.
+     * @return A vector with element selected from @a a and @a b
+     */
+    template<size_t Mask>
+    [[nodiscard]] friend native_simd blend(native_simd a, native_simd b) noexcept
+    {
+        static_assert(Mask <= 0xffff);
+
+        if constexpr (Mask == 0) {
+            return a;
+        } else if constexpr (Mask == 0xffff) {
+            return b;
+        } else {
+            return native_simd{_mm512_mask_blend_epi32(truncate<__mmask16>(Mask), a.v, b.v)};
+        }
+    }
+
+    /** Select elements from two vectors.
+     *
+     * @param a A vector for which element are selected when the element in @a mask is all-zeros.
+     * @param b A vector for which element are selected when the element in @a mask is all-ones.
+     * @param mask A vector with elements set to all-ones or all-zeros, as returned by the compare operators.
+     * @return A vector with element selected from @a a and @a b
+     */
+    [[nodiscard]] friend native_simd blend(native_simd a, native_simd b, native_simd mask) noexcept
+    {
+        return native_simd{_mm512_mask_blend_epi32(truncate<__mmask16>(mask.mask()), a.v, b.v)};
+    }
+
+    /** Permute elements, ignoring numeric elements.
+     *
+     * The characters in @a SourceElements mean the following:
+     * - 'a' - 'p': The indices to elements 0 and 15 of @a a.
+     * - 'x', 'y', 'z', 'w'': The indices to elements 0, 1, 2, 3 of @a a.
+     * - Any other character is treated as if the original element was selected.
+     *
+     * @tparam SourceElements A string representing the order of elements. First character
+     *         matches the first element.
+     * @param a The vector to swizzle the elements
+     * @returns A vector with the elements swizzled.
+     */
+    template<fixed_string SourceElements>
+    [[nodiscard]] friend native_simd permute(native_simd a) noexcept
+    {
+        static_assert(SourceElements.size() == size);
+        constexpr auto order = detail::native_swizzle_to_packed_indices<SourceElements, size>();
+
+        if constexpr (order == 0xfedc'ba98'7654'3210) {
+            return a;
+        } else if constexpr (order == 0) {
+            return broadcast(a);
+        } else {
+            return native_simd{_mm512_permutexvar_epi32(permute_indices<order>(), a.v)};
+        }
+    }
+
+    /** Permute elements using indices.
+     *
+     * ```
+     * r[i] = a[indices[i] & 15]
+     * ```
+     */
+    [[nodiscard]] friend native_simd permute(native_simd a, native_simd indices) noexcept
+    {
+        return native_simd{_mm512_permutexvar_epi32(indices.v, a.v)};
+    }
+
+    /** Swizzle elements.
+     *
+     * The elements are swizzled in the order specified in @a SourceElements.
+     * Each character in @a SourceElements is a index to an element in @a a or
+     * a numeric value.
+     *
+     * The characters in @a SourceElements mean the following:
+     * - 'a' - 'p': The indices to elements 0 and 15 of @a a.
+     * - 'x', 'y', 'z', 'w'': The indices to elements 0, 1, 2, 3 of @a a.
+     * - '0', '1': The values 0 and 1.
+     *
+     * @tparam SourceElements A string representing the order of elements. First character
+     *         matches the first element.
+     * @param a The vector to swizzle the elements
+     * @returns A vector with the elements swizzled.
+     */
+    template<fixed_string SourceElements>
+    [[nodiscard]] friend native_simd swizzle(native_simd a) noexcept
+    {
+        static_assert(SourceElements.size() == size);
+        constexpr auto one_mask = detail::native_swizzle_to_mask<SourceElements, size, '1'>();
+        constexpr auto zero_mask = detail::native_swizzle_to_mask<SourceElements, size, '0'>();
+        constexpr auto number_mask = one_mask | zero_mask;
+
+        if constexpr (number_mask == 0xffff) {
+            // Swizzle was /[01]{16}/.
+            return swizzle_numbers<SourceElements>();
+
+        } else if constexpr (number_mask == 0) {
+            // Swizzle was /[^01]{16}/.
+            return permute<SourceElements>(a);
+
+        } else if constexpr (number_mask == zero_mask) {
+            // Swizzle was /[^1]{16}/.
+            hilet ordered = permute<SourceElements>(a);
+            return set_zero<zero_mask>(ordered);
+
+        } else {
+            hilet ordered = permute<SourceElements>(a);
+            hilet numbers = swizzle_numbers<SourceElements>();
+            return blend<number_mask>(ordered, numbers);
+        }
+    }
+
+    /** Horizontal add.
+     *
+     * Add elements pair-wise in both vectors, then merge the results:
+     * ```
+     * r[0] = a[0] + a[1]
+     * r[1] = a[2] + a[3]
+     * ...
+     * r[7] = a[14] + a[15]
+     * r[8] = b[0] + b[1]
+     * ...
+     * r[15] = b[14] + b[15]
+     * ```
+     */
+    [[nodiscard]] friend native_simd horizontal_add(native_simd a, native_simd b) noexcept
+    {
+        hilet even = _mm512_permutex2var_epi32(a.v, even_indices(), b.v);
+        hilet odd = _mm512_permutex2var_epi32(a.v, odd_indices(), b.v);
+        return native_simd{_mm512_add_epi32(even, odd)};
+    }
+
+    /** Horizontal subtract.
+     *
+     * Subtract elements pair-wise in both vectors, then merge the results:
+     * ```
+     * r[0] = a[0] - a[1]
+     * r[1] = a[2] - a[3]
+     * ...
+     * r[7] = a[14] - a[15]
+     * r[8] = b[0] - b[1]
+     * ...
+     * r[15] = b[14] - b[15]
+     * ```
+     */
+    [[nodiscard]] friend native_simd horizontal_sub(native_simd a, native_simd b) noexcept
+    {
+        hilet even = _mm512_permutex2var_epi32(a.v, even_indices(), b.v);
+        hilet odd = _mm512_permutex2var_epi32(a.v, odd_indices(), b.v);
+        return native_simd{_mm512_sub_epi32(even, odd)};
+    }
+
+    /** Sum all elements of a vector.
+     *
+     * ```
+     * r = broadcast(a[0] + a[1] + ... + a[15])
+     * ```
+     */
+    [[nodiscard]] friend native_simd horizontal_sum(native_simd a) noexcept
+    {
+        auto tmp = a + native_simd{_mm512_shuffle_i32x4(a.v, a.v, 0b01'00'11'10)};
+        tmp = tmp + native_simd{_mm512_shuffle_i32x4(tmp.v, tmp.v, 0b10'11'00'01)};
+        tmp = tmp + native_simd{_mm512_shuffle_epi32(tmp.v, _MM_PERM_CDAB)};
+        return tmp + native_simd{_mm512_shuffle_epi32(tmp.v, _MM_PERM_BADC)};
+    }
+
+    /** Dot product.
+     *
+     * ```
+     * tmp[i] = SourceMask[i] ? a[i] * b[i] : 0
+     * r = broadcast(tmp[0] + tmp[1] + ... + tmp[15])
+     * ```
+     */
+    template<size_t SourceMask>
+    [[nodiscard]] friend native_simd dot_product(native_simd a, native_simd b) noexcept
+    {
+        static_assert(SourceMask <= 0xffff);
+        return horizontal_sum(set_zero<~SourceMask & 0xffff>(a * b));
+    }
+
+    /** not followed by and.
+     *
+     * r = ~a & b
+     *
+     */
+    [[nodiscard]] friend native_simd not_and(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm512_andnot_si512(a.v, b.v)};
+    }
+
+    friend std::ostream& operator<<(std::ostream& a, native_simd b) noexcept
+    {
+        hilet tmp = static_cast<array_type>(b);
+
+        a << "(";
+        for (auto i = 0_uz; i != size; ++i) {
+            if (i != 0) {
+                a << ", ";
+            }
+            a << tmp[i];
+        }
+        return a << ")";
+    }
+
+    template<fixed_string SourceElements>
+    [[nodiscard]] static native_simd swizzle_numbers() noexcept
+    {
+        constexpr auto one_mask = detail::native_swizzle_to_mask<SourceElements, size, '1'>();
+        constexpr auto zero_mask = detail::native_swizzle_to_mask<SourceElements, size, '0'>();
+        constexpr auto number_mask = one_mask | zero_mask;
+        constexpr auto alpha_mask = ~number_mask & 0xffff;
+
+        if constexpr ((zero_mask | alpha_mask) == 0xffff) {
+            return {};
+
+        } else if constexpr ((one_mask | alpha_mask) == 0xffff) {
+            return broadcast(1);
+
+        } else {
+            return native_simd{_mm512_maskz_set1_epi32(truncate<__mmask16>(one_mask), 1)};
+        }
+    }
+
+private:
+    /** Convert a mask-register to a vector with all-ones or all-zero elements.
+     */
+    [[nodiscard]] static native_simd from_mask_register(__mmask16 a) noexcept
+    {
+        return native_simd{_mm512_maskz_set1_epi32(a, -1)};
+    }
+
+    /** A mask with the first @a count elements set.
+     */
+    [[nodiscard]] static __mmask16 tail_mask(size_t count) noexcept
+    {
+        return truncate<__mmask16>((1_uz << count) - 1);
+    }
+
+    /** The packed 4-bit indices of a permute, as a vector of indices.
+     */
+    template<size_t Order>
+    [[nodiscard]] static register_type permute_indices() noexcept
+    {
+        return _mm512_set_epi32(
+            (Order >> 60) & 15,
+            (Order >> 56) & 15,
+            (Order >> 52) & 15,
+            (Order >> 48) & 15,
+            (Order >> 44) & 15,
+            (Order >> 40) & 15,
+            (Order >> 36) & 15,
+            (Order >> 32) & 15,
+            (Order >> 28) & 15,
+            (Order >> 24) & 15,
+            (Order >> 20) & 15,
+            (Order >> 16) & 15,
+            (Order >> 12) & 15,
+            (Order >> 8) & 15,
+            (Order >> 4) & 15,
+            Order & 15);
+    }
+
+    /** Indices of the even elements of a and b, for _mm512_permutex2var_epi32().
+     */
+    [[nodiscard]] static register_type even_indices() noexcept
+    {
+        return _mm512_set_epi32(30, 28, 26, 24, 22, 20, 18, 16, 14, 12, 10, 8, 6, 4, 2, 0);
+    }
+
+    /** Indices of the odd elements of a and b, for _mm512_permutex2var_epi32().
+     */
+    [[nodiscard]] static register_type odd_indices() noexcept
+    {
+        return _mm512_set_epi32(31, 29, 27, 25, 23, 21, 19, 17, 15, 13, 11, 9, 7, 5, 3, 1);
+    }
+};
+
+#endif
+
+}} // namespace hi::v1
+
+hi_warning_pop();
@@ -0,0 +1,131 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "native_i32x16_avx512f.hpp"
+#include "simd_test_utility.hpp"
+#include "../macros.hpp"
+
+#ifdef HI_HAS_AVX512F
+
+hi_warning_push();
+// C26474: Don't cast between pointer types when the conversion could be implicit (type.1).
+// For the test we need to do this explicit.
+hi_warning_ignore_msvc(26474);
+
+using S = hi::native_simd<int32_t, 16>;
+using A = S::array_type;
+
+TEST(native_i32x16, construct)
+{
+    ASSERT_EQ(static_cast<A>(S{}), A{});
+
+    {
+        auto expected = A{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16};
+        ASSERT_EQ(static_cast<A>(S{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16}), expected);
+        ASSERT_EQ(static_cast<A>(S{expected}), expected);
+        ASSERT_EQ(static_cast<A>(S{expected.data()}), expected);
+    }
+
+    HI_ASSERT_SIMD_EQ(S::broadcast(S(-3, 4)), S::broadcast(-3));
+}
+
+TEST(native_i32x16, tail)
+{
+    auto from = std::array<int32_t, 17>{1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16, 17};
+
+    HI_ASSERT_SIMD_EQ(S(from.data(), 0), S());
+    HI_ASSERT_SIMD_EQ(S(from.data(), 10), S(1, 2, 3, 4, 5, 6, 7, 8, 9, 10));
+
+    auto to = std::array<int32_t, 17>{};
+    S::broadcast(1).store(to.data(), 9);
+    ASSERT_EQ(to[8], 1);
+    ASSERT_EQ(to[9], 0);
+}
+
+TEST(native_i32x16, gather)
+{
+    auto from = std::array<int32_t, 4>{10, 11, 12, 13};
+    HI_ASSERT_SIMD_EQ(S::gather(from.data(), S(3, 2, 1)), S(13, 12, 11, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10, 10));
+}
+
+TEST(native_i32x16, compare)
+{
+    auto a = S(1, 2, 3, 4, -1, -2, -3, -4, 1, 2, 3, 4, -1, -2, -3, -4);
+    auto b = S::broadcast(2);
+
+    ASSERT_EQ((a == b).mask(), 0b0000'0010'0000'0010);
+    ASSERT_EQ((a != b).mask(), 0b1111'1101'1111'1101);
+    ASSERT_EQ((a < b).mask(), 0b1111'0001'1111'0001);
+    ASSERT_EQ((a <= b).mask(), 0b1111'0011'1111'0011);
+    ASSERT_EQ((a > b).mask(), 0b0000'1100'0000'1100);
+    ASSERT_EQ((a >= b).mask(), 0b0000'1110'0000'1110);
+}
+
+TEST(native_i32x16, math)
+{
+    auto a = S(0, 2, 3, 42, 1, -1, 8, -8);
+    auto b = S(1, 4, -3, 2, 2, 2, -4, 4);
+
+    HI_ASSERT_SIMD_EQ(-a, S(0, -2, -3, -42, -1, 1, -8, 8));
+    HI_ASSERT_SIMD_EQ(a + b, S(1, 6, 0, 44, 3, 1, 4, -4));
+    HI_ASSERT_SIMD_EQ(a - b, S(-1, -2, 6, 40, -1, -3, 12, -12));
+    HI_ASSERT_SIMD_EQ(a * b, S(0, 8, -9, 84, 2, -2, -32, -32));
+    HI_ASSERT_SIMD_EQ(min(a, b), S(0, 2, -3, 2, 1, -1, -4, -8));
+    HI_ASSERT_SIMD_EQ(max(a, b), S(1, 4, 3, 42, 2, 2, 8, 4));
+    HI_ASSERT_SIMD_EQ(abs(a), S(0, 2, 3, 42, 1, 1, 8, 8));
+}
+
+TEST(native_i32x16, bit_wise)
+{
+    HI_ASSERT_SIMD_EQ(~S::from_mask(0b0101'1010'0000'1111), S::from_mask(0b1010'0101'1111'0000));
+    HI_ASSERT_SIMD_EQ(S(1, 2, 3) & S::from_mask(0b0101), S(1, 0, 3));
+    HI_ASSERT_SIMD_EQ(S(1, 2) | S(4, 8), S(5, 10));
+    HI_ASSERT_SIMD_EQ(not_and(S::from_mask(0b1111'1111'1111'1110), S::broadcast(3)), S(3));
+    HI_ASSERT_SIMD_EQ(S::broadcast(-4) << 2, S::broadcast(-16));
+    HI_ASSERT_SIMD_EQ(S::broadcast(-16) >> 2, S::broadcast(-4));
+
+    for (size_t i = 0; i != 0x10000; ++i) {
+        ASSERT_EQ(S::from_mask(i).mask(), i);
+    }
+}
+
+TEST(native_i32x16, access)
+{
+    auto tmp = S(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+
+    ASSERT_EQ(get<0>(tmp), 1);
+    ASSERT_EQ(get<9>(tmp), 10);
+    ASSERT_EQ(get<15>(tmp), 16);
+    ASSERT_EQ(get<13>(insert<13>(tmp, 42)), 42);
+    HI_ASSERT_SIMD_EQ(set_zero<0b1111'1111'1111'1110>(tmp), S(1));
+}
+
+TEST(native_i32x16, blend_permute)
+{
+    auto a = S(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+    auto b = S::broadcast(42);
+
+    ASSERT_EQ((blend<0b1000'0000'0000'0001>(a, b) == b).mask(), 0b1000'0000'0000'0001);
+    ASSERT_EQ((blend(a, b, a > S::broadcast(14)) == b).mask(), 0b1100'0000'0000'0000);
+
+    auto reversed = S(16, 15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1);
+    HI_ASSERT_SIMD_EQ(permute<"ponmlkjihgfedcba">(a), reversed);
+    HI_ASSERT_SIMD_EQ(permute(a, S(15, 14, 13, 12, 11, 10, 9, 8, 7, 6, 5, 4, 3, 2, 1, 0)), reversed);
+    HI_ASSERT_SIMD_EQ(swizzle<"000000000000001p">(a), S(0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 0, 1, 16));
+}
+
+TEST(native_i32x16, horizontal)
+{
+    auto a = S(1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15, 16);
+    auto b = S::broadcast(1);
+
+    HI_ASSERT_SIMD_EQ(horizontal_add(a, b), S(3, 7, 11, 15, 19, 23, 27, 31, 2, 2, 2, 2, 2, 2, 2, 2));
+    HI_ASSERT_SIMD_EQ(horizontal_sub(a, b), S(-1, -1, -1, -1, -1, -1, -1, -1));
+    HI_ASSERT_SIMD_EQ(horizontal_sum(a), S::broadcast(136));
+    HI_ASSERT_SIMD_EQ(dot_product<0b1000'0000'0000'0011>(a, b), S::broadcast(19));
+}
+
+hi_warning_pop();
+
+#endif
@@ -0,0 +1,642 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "native_simd_utility.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <array>
+#include <ostream>
+
+
+
+hi_warning_push();
+// Ignore "C26490: Don't use reinterpret_cast", needed for intrinsic loads and stores.
+hi_warning_ignore_msvc(26490);
+
+namespace hi { inline namespace v1 {
+
+#ifdef HI_HAS_AVX2
+
+/** A int32_t x 8 (__m256i) AVX2 register.
+ *
+ *
+ * When loading and storing from memory this is the order of the element in the register
+ *
+ * ```
+ *   lo   hi lo   hi lo   hi lo   hi lo   hi lo   hi lo   hi lo   hi
+ *  +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *  | el 0  | el 1  | el 2  | el 3  | el 4  | el 5  | el 6  | el 7  |
+ *  +-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+-+
+ *   0     3 4     7 8    11 12   15 16   19 20   23 24   27 28   31   memory address.
+ * ```
+ *
+ * In the function below a `mask` values least-significant-bit corresponds to element 0.
+ *
+ */
+template<>
+struct native_simd<int32_t, 8> {
+    using value_type = int32_t;
+    constexpr static size_t size = 8;
+    using register_type = __m256i;
+    using array_type = std::array<value_type, size>;
+
+    register_type v;
+
+    native_simd(native_simd const&) noexcept = default;
+    native_simd(native_simd&&) noexcept = default;
+    native_simd& operator=(native_simd const&) noexcept = default;
+    native_simd& operator=(native_simd&&) noexcept = default;
+
+    /** Initialize all elements to zero.
+     */
+    native_simd() noexcept : v(_mm256_setzero_si256()) {}
+
+    [[nodiscard]] explicit native_simd(register_type other) noexcept : v(other) {}
+
+    [[nodiscard]] explicit operator register_type() const noexcept
+    {
+        return v;
+    }
+
+    /** Initialize the element to the values in the arguments.
+     *
+     * @param a The value for element 0.
+     * @param b The value for element 1.
+     * @param c The value for element 2.
+     * @param d The value for element 3.
+     * @param e The value for element 4.
+     * @param f The value for element 5.
+     * @param g The value for element 6.
+     * @param h The value for element 7.
+     */
+    [[nodiscard]] native_simd(
+        value_type a,
+        value_type b = value_type{0},
+        value_type c = value_type{0},
+        value_type d = value_type{0},
+        value_type e = value_type{0},
+        value_type f = value_type{0},
+        value_type g = value_type{0},
+        value_type h = value_type{0}) noexcept :
+        v(_mm256_set_epi32(h, g, f, e, d, c, b, a))
+    {
+    }
+
+    [[nodiscard]] explicit native_simd(value_type const *other) noexcept :
+        v(_mm256_loadu_si256(reinterpret_cast<register_type const *>(other)))
+    {
+    }
+
+    void store(value_type *out) const noexcept
+    {
+        hi_axiom_not_null(out);
+        _mm256_storeu_si256(reinterpret_cast<register_type *>(out), v);
+    }
+
+    /** Load the first elements from memory, the other elements are set to zero.
+     *
+     * This is used to load the tail of an array, memory beyond the
+     * @a count elements is not accessed.
+     *
+     * @param other A pointer to the elements to load.
+     * @param count The number of elements to load.
+     */
+    [[nodiscard]] native_simd(value_type const *other, size_t count) noexcept
+    {
+        hi_axiom(count <= size);
+        v = _mm256_maskload_epi32(reinterpret_cast<int const *>(other), tail_mask(count));
+    }
+
+    /** Store the first elements to memory.
+     *
+     * This is used to store the tail of an array, memory beyond the
+     * @a count elements is not accessed.
+     *
+     * @param out A pointer to where the elements are stored.
+     * @param count The number of elements to store.
+     */
+    void store(value_type *out, size_t count) const noexcept
+    {
+        hi_axiom(count <= size);
+        _mm256_maskstore_epi32(reinterpret_cast<int *>(out), tail_mask(count), v);
+    }
+
+    [[nodiscard]] explicit native_simd(void const *other) noexcept : v(_mm256_loadu_si256(static_cast<register_type const *>(other)))
+    {
+    }
+
+    void store(void *out) const noexcept
+    {
+        hi_axiom_not_null(out);
+        _mm256_storeu_si256(static_cast<register_type *>(out), v);
+    }
+
+    [[nodiscard]] explicit native_simd(std::span<value_type const> other) noexcept
+    {
+        hi_axiom(other.size() >= size);
+        v = _mm256_loadu_si256(reinterpret_cast<register_type const *>(other.data()));
+    }
+
+    void store(std::span<value_type> out) const noexcept
+    {
+        hi_axiom(out.size() >= size);
+        _mm256_storeu_si256(reinterpret_cast<register_type *>(out.data()), v);
+    }
+
+    [[nodiscard]] explicit native_simd(array_type other) noexcept :
+        v(_mm256_loadu_si256(reinterpret_cast<register_type const *>(other.data())))
+    {
+    }
+
+    [[nodiscard]] explicit operator array_type() const noexcept
+    {
+        auto r = array_type{};
+        _mm256_storeu_si256(reinterpret_cast<register_type *>(r.data()), v);
+        return r;
+    }
+
+    [[nodiscard]] explicit native_simd(native_simd<float, 8> const& a) noexcept;
+    [[nodiscard]] explicit native_simd(native_simd<uint32_t, 8> const& a) noexcept;
+
+    /** Load elements from memory using indices.
+     *
+     * ```
+     * r[i] = ptr[indices[i]]
+     * ```
+     *
+     * @param ptr A pointer to the first element.
+     * @param indices The indices of the elements to load.
+     */
+    [[nodiscard]] static native_simd gather(value_type const *ptr, native_simd indices) noexcept
+    {
+        return native_simd{_mm256_i32gather_epi32(reinterpret_cast<int const *>(ptr), indices.v, sizeof(value_type))};
+    }
+
+    /** Broadcast a single value to all the elements.
+     *
+     * ```
+     * r[0] = a
+     * r[1] = a
+     * r[2] = a
+     * r[3] = a
+     * r[4] = a
+     * r[5] = a
+     * r[6] = a
+     * r[7] = a
+     * ```
+     */
+    [[nodiscard]] static native_simd broadcast(value_type a) noexcept
+    {
+        return native_simd{_mm256_set1_epi32(a)};
+    }
+
+    /** Broadcast the first element to all the elements.
+     *
+     * ```
+     * r[0] = a[0]
+     * r[1] = a[0]
+     * r[2] = a[0]
+     * r[3] = a[0]
+     * r[4] = a[0]
+     * r[5] = a[0]
+     * r[6] = a[0]
+     * r[7] = a[0]
+     * ```
+     */
+    [[nodiscard]] static native_simd broadcast(native_simd a) noexcept
+    {
+        return native_simd{_mm256_broadcastd_epi32(_mm256_castsi256_si128(a.v))};
+    }
+
+    [[nodiscard]] static native_simd ones() noexcept
+    {
+        hilet tmp = _mm256_undefined_si256();
+        return native_simd{_mm256_cmpeq_epi32(tmp, tmp)};
+    }
+
+    /** For each bit in mask set corresponding element to all-ones or all-zeros.
+     */
+    [[nodiscard]] static native_simd from_mask(size_t a) noexcept
+    {
+        hi_axiom(a <= 0b1111'1111);
+
+        hilet bits = _mm256_set_epi32(0x80, 0x40, 0x20, 0x10, 0x08, 0x04, 0x02, 0x01);
+        hilet tmp = _mm256_and_si256(_mm256_set1_epi32(truncate<int32_t>(a)), bits);
+        return native_simd{_mm256_cmpeq_epi32(tmp, bits)};
+    }
+
+    /** Concatenate the top bit of each element.
+     */
+    [[nodiscard]] size_t mask() const noexcept
+    {
+        return narrow_cast<size_t>(_mm256_movemask_ps(_mm256_castsi256_ps(v)));
+    }
+
+    [[nodiscard]] friend bool equal(native_simd a, native_simd b) noexcept
+    {
+        hilet tmp = _mm256_xor_si256(a.v, b.v);
+        return _mm256_testz_si256(tmp, tmp) == 1;
+    }
+
+    [[nodiscard]] friend native_simd operator==(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_cmpeq_epi32(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator!=(native_simd a, native_simd b) noexcept
+    {
+        return ~(a == b);
+    }
+
+    [[nodiscard]] friend native_simd operator<(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_cmpgt_epi32(b.v, a.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator>(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_cmpgt_epi32(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator<=(native_simd a, native_simd b) noexcept
+    {
+        return ~(a > b);
+    }
+
+    [[nodiscard]] friend native_simd operator>=(native_simd a, native_simd b) noexcept
+    {
+        return ~(a < b);
+    }
+
+    [[nodiscard]] friend native_simd operator+(native_simd a) noexcept
+    {
+        return a;
+    }
+
+    [[nodiscard]] friend native_simd operator-(native_simd a) noexcept
+    {
+        return native_simd{} - a;
+    }
+
+    [[nodiscard]] friend native_simd operator+(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_add_epi32(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator-(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_sub_epi32(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator*(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_mullo_epi32(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator&(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_and_si256(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator|(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_or_si256(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator^(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_xor_si256(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator~(native_simd a) noexcept
+    {
+        return not_and(a, ones());
+    }
+
+    [[nodiscard]] friend native_simd operator<<(native_simd a, unsigned int b) noexcept
+    {
+        hi_axiom_bounds(b, sizeof(value_type) * CHAR_BIT);
+        return native_simd{_mm256_slli_epi32(a.v, b)};
+    }
+
+    [[nodiscard]] friend native_simd operator>>(native_simd a, unsigned int b) noexcept
+    {
+        hi_axiom_bounds(b, sizeof(value_type) * CHAR_BIT);
+        return native_simd{_mm256_srai_epi32(a.v, b)};
+    }
+
+    [[nodiscard]] friend native_simd min(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_min_epi32(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd max(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_max_epi32(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd abs(native_simd a) noexcept
+    {
+        return native_simd{_mm256_abs_epi32(a.v)};
+    }
+
+    /** Set elements to zero.
+     *
+     * @tparam Mask A bit mask corresponding to each element.
+     * @param a The value to modify.
+     * @return argument @a with elements set to zero where the corresponding @a Mask bit was '1'.
+     */
+    template<size_t Mask>
+    [[nodiscard]] friend native_simd set_zero(native_simd a) noexcept
+    {
+        static_assert(Mask <= 0b1111'1111);
+        return blend<Mask>(a, native_simd{});
+    }
+
+    /** Insert a value into an element of a vector.
+     *
+     * @tparam Index the index of the element where insert the value.
+     * @param a The vector to insert the value into.
+     * @param b The value to insert.
+     * @return The vector with the inserted value.
+     */
+    template<size_t Index>
+    [[nodiscard]] friend native_simd insert(native_simd a, value_type b) noexcept
+    {
+        static_assert(Index < size);
+        return native_simd{_mm256_insert_epi32(a.v, b, Index)};
+    }
+
+    /** Extract an element from a vector.
+     *
+     * @tparam Index the index of the element.
+     * @param a The vector to select the element from.
+     * @return The value of the selected element.
+     */
+    template<size_t Index>
+    [[nodiscard]] friend value_type get(native_simd a) noexcept
+    {
+        static_assert(Index < size);
+        return _mm256_extract_epi32(a.v, Index);
+    }
+
+    /** Select elements from two vectors.
+     *
+     * @tparam Mask A mask to select bits from @a a when '0'; or @a b when '1'. The
+     *         lsb corresponds with element zero.
+     * @param a A vector for which element are selected when the bit in @a Mask is '0'.
+     * @param b A vector for which element are selected when the bit in @a Mask is '1'.
+     * @return A vector with element selected from @a a and @a b
+     */
+    template<size_t Mask>
+    [[nodiscard]] friend native_simd blend(native_simd a, native_simd b) noexcept
+    {
+        static_assert(Mask <= 0b1111'1111);
+
+        if constexpr (Mask == 0b0000'0000) {
+            return a;
+        } else if constexpr (Mask == 0b1111'1111) {
+            return b;
+        } else {
+            return native_simd{_mm256_blend_epi32(a.v, b.v, Mask)};
+        }
+    }
+
+    /** Select elements from two vectors.
+     *
+     * @param a A vector for which element are selected when the element in @a mask is all-zeros.
+     * @param b A vector for which element are selected when the element in @a mask is all-ones.
+     * @param mask A vector with elements set to all-ones or all-zeros, as returned by the compare operators.
+     * @return A vector with element selected from @a a and @a b
+     */
+    [[nodiscard]] friend native_simd blend(native_simd a, native_simd b, native_simd mask) noexcept
+    {
+        return native_simd{_mm256_blendv_epi8(a.v, b.v, mask.v)};
+    }
+
+    /** Permute elements, ignoring numeric elements.
+     *
+     * The characters in @a SourceElements mean the following:
+     * - 'a' - 'p': The indices to elements 0 and 15 of @a a.
+     * - 'x', 'y', 'z', 'w'': The indices to elements 0, 1, 2, 3 of @a a.
+     * - Any other character is treated as if the original element was selected.
+     *
+     * @tparam SourceElements A string representing the order of elements. First character
+     *         matches the first element.
+     * @param a The vector to swizzle the elements
+     * @returns A vector with the elements swizzled.
+     */
+    template<fixed_string SourceElements>
+    [[nodiscard]] friend native_simd permute(native_simd a) noexcept
+    {
+        static_assert(SourceElements.size() == size);
+        constexpr auto order = detail::native_swizzle_to_packed_indices<SourceElements, size>();
+
+        if constexpr (order == 076543210) {
+            return a;
+        } else if constexpr (order == 0) {
+            return broadcast(a);
+        } else {
+            return native_simd{_mm256_permutevar8x32_epi32(a.v, permute_indices<order>())};
+        }
+    }
+
+    /** Permute elements using indices.
+     *
+     * ```
+     * r[i] = a[indices[i] & 7]
+     * ```
+     */
+    [[nodiscard]] friend native_simd permute(native_simd a, native_simd indices) noexcept
+    {
+        return native_simd{_mm256_permutevar8x32_epi32(a.v, indices.v)};
+    }
+
+    /** Swizzle elements.
+     *
+     * The elements are swizzled in the order specified in @a SourceElements.
+     * Each character in @a SourceElements is a index to an element in @a a or
+     * a numeric value.
+     *
+     * The characters in @a SourceElements mean the following:
+     * - 'a' - 'p': The indices to elements 0 and 15 of @a a.
+     * - 'x', 'y', 'z', 'w'': The indices to elements 0, 1, 2, 3 of @a a.
+     * - '0', '1': The values 0 and 1.
+     *
+     * @tparam SourceElements A string representing the order of elements. First character
+     *         matches the first element.
+     * @param a The vector to swizzle the elements
+     * @returns A vector with the elements swizzled.
+     */
+    template<fixed_string SourceElements>
+    [[nodiscard]] friend native_simd swizzle(native_simd a) noexcept
+    {
+        static_assert(SourceElements.size() == size);
+        constexpr auto one_mask = detail::native_swizzle_to_mask<SourceElements, size, '1'>();
+        constexpr auto zero_mask = detail::native_swizzle_to_mask<SourceElements, size, '0'>();
+        constexpr auto number_mask = one_mask | zero_mask;
+
+        if constexpr (number_mask == 0b1111'1111) {
+            // Swizzle was /[01]{8}/.
+            return swizzle_numbers<SourceElements>();
+
+        } else if constexpr (number_mask == 0b0000'0000) {
+            // Swizzle was /[^01]{8}/.
+            return permute<SourceElements>(a);
+
+        } else if constexpr (number_mask == zero_mask) {
+            // Swizzle was /[^1]{8}/.
+            hilet ordered = permute<SourceElements>(a);
+            return set_zero<zero_mask>(ordered);
+
+        } else {
+            hilet ordered = permute<SourceElements>(a);
+            hilet numbers = swizzle_numbers<SourceElements>();
+            return blend<number_mask>(ordered, numbers);
+        }
+    }
+
+    /** Horizontal add.
+     *
+     * Add elements pair-wise in both vectors, then merge the results:
+     * ```
+     * r[0] = a[0] + a[1]
+     * r[1] = a[2] + a[3]
+     * r[2] = a[4] + a[5]
+     * r[3] = a[6] + a[7]
+     * r[4] = b[0] + b[1]
+     * r[5] = b[2] + b[3]
+     * r[6] = b[4] + b[5]
+     * r[7] = b[6] + b[7]
+     * ```
+     */
+    [[nodiscard]] friend native_simd horizontal_add(native_simd a, native_simd b) noexcept
+    {
+        // _mm256_hadd_epi32() works on each 128-bit lane, reorder the 64-bit pairs afterwards.
+        return native_simd{_mm256_permute4x64_epi64(_mm256_hadd_epi32(a.v, b.v), 0b11'01'10'00)};
+    }
+
+    /** Horizontal subtract.
+     *
+     * Subtract elements pair-wise in both vectors, then merge the results:
+     * ```
+     * r[0] = a[0] - a[1]
+     * r[1] = a[2] - a[3]
+     * r[2] = a[4] - a[5]
+     * r[3] = a[6] - a[7]
+     * r[4] = b[0] - b[1]
+     * r[5] = b[2] - b[3]
+     * r[6] = b[4] - b[5]
+     * r[7] = b[6] - b[7]
+     * ```
+     */
+    [[nodiscard]] friend native_simd horizontal_sub(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_permute4x64_epi64(_mm256_hsub_epi32(a.v, b.v), 0b11'01'10'00)};
+    }
+
+    /** Sum all elements of a vector.
+     *
+     * ```
+     * r = broadcast(a[0] + a[1] + a[2] + a[3] + a[4] + a[5] + a[6] + a[7])
+     * ```
+     */
+    [[nodiscard]] friend native_simd horizontal_sum(native_simd a) noexcept
+    {
+        auto tmp = a + native_simd{_mm256_permute2x128_si256(a.v, a.v, 0b0000'0001)};
+        tmp = tmp + native_simd{_mm256_shuffle_epi32(tmp.v, 0b10'11'00'01)};
+        return tmp + native_simd{_mm256_shuffle_epi32(tmp.v, 0b01'00'11'10)};
+    }
+
+    /** Dot product.
+     *
+     * ```
+     * tmp[i] = SourceMask[i] ? a[i] * b[i] : 0
+     * r = broadcast(tmp[0] + tmp[1] + tmp[2] + tmp[3] + tmp[4] + tmp[5] + tmp[6] + tmp[7])
+     * ```
+     */
+    template<size_t SourceMask>
+    [[nodiscard]] friend native_simd dot_product(native_simd a, native_simd b) noexcept
+    {
+        static_assert(SourceMask <= 0b1111'1111);
+        return horizontal_sum(set_zero<~SourceMask & 0b1111'1111>(a * b));
+    }
+
+    /** not followed by and.
+     *
+     * r = ~a & b
+     *
+     */
+    [[nodiscard]] friend native_simd not_and(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_andnot_si256(a.v, b.v)};
+    }
+
+    friend std::ostream& operator<<(std::ostream& a, native_simd b) noexcept
+    {
+        return a << "(" << get<0>(b) << ", " << get<1>(b) << ", " << get<2>(b) << ", " << get<3>(b) << ", " << get<4>(b)
+                 << ", " << get<5>(b) << ", " << get<6>(b) << ", " << get<7>(b) << ")";
+    }
+
+    template<fixed_string SourceElements>
+    [[nodiscard]] static native_simd swizzle_numbers() noexcept
+    {
+        constexpr auto one_mask = detail::native_swizzle_to_mask<SourceElements, size, '1'>();
+        constexpr auto zero_mask = detail::native_swizzle_to_mask<SourceElements, size, '0'>();
+        constexpr auto number_mask = one_mask | zero_mask;
+        constexpr auto alpha_mask = ~number_mask & 0b1111'1111;
+
+        if constexpr ((zero_mask | alpha_mask) == 0b1111'1111) {
+            return {};
+
+        } else if constexpr ((one_mask | alpha_mask) == 0b1111'1111) {
+            return broadcast(1);
+
+        } else {
+            return native_simd{
+                to_bool(one_mask & 0b0000'0001) ? 1 : 0,
+                to_bool(one_mask & 0b0000'0010) ? 1 : 0,
+                to_bool(one_mask & 0b0000'0100) ? 1 : 0,
+                to_bool(one_mask & 0b0000'1000) ? 1 : 0,
+                to_bool(one_mask & 0b0001'0000) ? 1 : 0,
+                to_bool(one_mask & 0b0010'0000) ? 1 : 0,
+                to_bool(one_mask & 0b0100'0000) ? 1 : 0,
+                to_bool(one_mask & 0b1000'0000) ? 1 : 0};
+        }
+    }
+
+private:
+    /** A mask with the first @a count elements set to all-ones.
+     */
+    [[nodiscard]] static register_type tail_mask(size_t count) noexcept
+    {
+        hilet indices = _mm256_set_epi32(7, 6, 5, 4, 3, 2, 1, 0);
+        return _mm256_cmpgt_epi32(_mm256_set1_epi32(narrow_cast<int32_t>(count)), indices);
+    }
+
+    /** The packed 3-bit indices of a permute, as a vector of indices.
+     */
+    template<size_t Order>
+    [[nodiscard]] static register_type permute_indices() noexcept
+    {
+        return _mm256_set_epi32(
+            (Order >> 21) & 7,
+            (Order >> 18) & 7,
+            (Order >> 15) & 7,
+            (Order >> 12) & 7,
+            (Order >> 9) & 7,
+            (Order >> 6) & 7,
+            (Order >> 3) & 7,
+            Order & 7);
+    }
+};
+
+#endif
+
+}} // namespace hi::v1
+
+hi_warning_pop();
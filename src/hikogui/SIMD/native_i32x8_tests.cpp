@@ -0,0 +1,232 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "native_i32x8_avx2.hpp"
+#include "native_simd_conversions_x86.hpp"
+#include "simd_test_utility.hpp"
+#include "../macros.hpp"
+
+#ifdef HI_HAS_AVX2
+
+hi_warning_push();
+// C26474: Don't cast between pointer types when the conversion could be implicit (type.1).
+// For the test we need to do this explicit.
+hi_warning_ignore_msvc(26474);
+
+using S = hi::native_simd<int32_t, 8>;
+using A = S::array_type;
+
+TEST(native_i32x8, construct)
+{
+    {
+        auto expected = A{0, 0, 0, 0, 0, 0, 0, 0};
+        ASSERT_EQ(static_cast<A>(S{}), expected);
+    }
+
+    {
+        auto expected = A{1, 0, 0, 0, 0, 0, 0, 0};
+        ASSERT_EQ(static_cast<A>(S{1}), expected);
+    }
+
+    {
+        auto expected = A{1, 2, 3, 4, 5, 6, 7, 8};
+        ASSERT_EQ(static_cast<A>(S{1, 2, 3, 4, 5, 6, 7, 8}), expected);
+    }
+
+    {
+        auto expected = A{4, 4, 4, 4, 4, 4, 4, 4};
+        ASSERT_EQ(static_cast<A>(S::broadcast(4)), expected);
+    }
+
+    {
+        auto expected = A{3, 3, 3, 3, 3, 3, 3, 3};
+        ASSERT_EQ(static_cast<A>(S::broadcast(S{3, 4, 5, 6, 7, 8, 9, 10})), expected);
+    }
+
+    {
+        auto from = A{1, 2, 3, 4, 5, 6, 7, 8};
+        auto expected = A{1, 2, 3, 4, 5, 6, 7, 8};
+        ASSERT_EQ(static_cast<A>(S{from}), expected);
+    }
+
+    {
+        auto from = A{1, 2, 3, 4, 5, 6, 7, 8};
+        auto expected = A{1, 2, 3, 4, 5, 6, 7, 8};
+        ASSERT_EQ(static_cast<A>(S{from.data()}), expected);
+    }
+
+    {
+        auto from = A{1, 2, 3, 4, 5, 6, 7, 8};
+        auto expected = A{1, 2, 3, 4, 5, 6, 7, 8};
+        ASSERT_EQ(static_cast<A>(S{static_cast<void *>(from.data())}), expected);
+    }
+
+    {
+        auto a = A{1, 2, 3, 4, 5, 6, 7, 8};
+        auto from = std::span(a.data(), a.size());
+        auto expected = A{1, 2, 3, 4, 5, 6, 7, 8};
+        ASSERT_EQ(static_cast<A>(S{from}), expected);
+    }
+}
+
+TEST(native_i32x8, conversion)
+{
+    auto a = S{1, 2, 3, 4, 5, 6, 7, 8};
+    auto expected = A{1, 2, 3, 4, 5, 6, 7, 8};
+
+    {
+        auto result = A{};
+        a.store(result);
+        ASSERT_EQ(result, expected);
+    }
+
+    {
+        auto result = A{};
+        a.store(result.data());
+        ASSERT_EQ(result, expected);
+    }
+
+    {
+        auto result = A{};
+        a.store(static_cast<void *>(result.data()));
+        ASSERT_EQ(result, expected);
+    }
+
+    // SSE conversion rounds floats before converting to integer.
+    HI_ASSERT_SIMD_EQ(S(hi::native_simd<float, 8>(1.0f, -2.4f, 3.6f, -4.0f, 5.0f, -6.0f, 7.0f, -8.0f)), S(1, -2, 4, -4, 5, -6, 7, -8));
+}
+
+TEST(native_i32x8, tail)
+{
+    auto from = std::array<int32_t, 9>{1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    HI_ASSERT_SIMD_EQ(S(from.data(), 0), S());
+    HI_ASSERT_SIMD_EQ(S(from.data(), 3), S(1, 2, 3));
+    HI_ASSERT_SIMD_EQ(S(from.data(), 8), S(1, 2, 3, 4, 5, 6, 7, 8));
+
+    auto to = std::array<int32_t, 9>{};
+    S(1, 2, 3, 4, 5, 6, 7, 8).store(to.data(), 5);
+    ASSERT_EQ(to, (std::array<int32_t, 9>{1, 2, 3, 4, 5, 0, 0, 0, 0}));
+}
+
+TEST(native_i32x8, gather)
+{
+    auto from = std::array<int32_t, 10>{10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+    HI_ASSERT_SIMD_EQ(S::gather(from.data(), S(9, 0, 8, 1, 7, 2, 6, 3)), S(19, 10, 18, 11, 17, 12, 16, 13));
+}
+
+TEST(native_i32x8, compare)
+{
+    HI_ASSERT_SIMD_EQ(S(1, 2, 3, 4, 5, 6, 7, 8), S(1, 2, 3, 4, 5, 6, 7, 8));
+    HI_ASSERT_SIMD_NE(S(1, 2, 3, 4, 5, 6, 7, 8), S(1, 2, 3, 4, 5, 6, 7, 9));
+
+    ASSERT_EQ((S(1, 2, 3, 4, 5, 6, 7, 8) == S(1, 0, 3, 0, 5, 0, 7, 0)).mask(), 0b0101'0101);
+    ASSERT_EQ((S(1, 2, 3, 4, 5, 6, 7, 8) != S(1, 0, 3, 0, 5, 0, 7, 0)).mask(), 0b1010'1010);
+
+    auto a = S(1, 2, 3, 4, -1, -2, -3, -4);
+    auto b = S::broadcast(2);
+    ASSERT_EQ((a < b).mask(), 0b1111'0001);
+    ASSERT_EQ((a <= b).mask(), 0b1111'0011);
+    ASSERT_EQ((a > b).mask(), 0b0000'1100);
+    ASSERT_EQ((a >= b).mask(), 0b0000'1110);
+}
+
+TEST(native_i32x8, math)
+{
+    auto a = S(0, 2, 3, 42, 1, -1, 8, -8);
+    auto b = S(1, 4, -3, 2, 2, 2, -4, 4);
+
+    HI_ASSERT_SIMD_EQ(-a, S(0, -2, -3, -42, -1, 1, -8, 8));
+    HI_ASSERT_SIMD_EQ(+a, a);
+    HI_ASSERT_SIMD_EQ(a + b, S(1, 6, 0, 44, 3, 1, 4, -4));
+    HI_ASSERT_SIMD_EQ(a - b, S(-1, -2, 6, 40, -1, -3, 12, -12));
+    HI_ASSERT_SIMD_EQ(a * b, S(0, 8, -9, 84, 2, -2, -32, -32));
+    HI_ASSERT_SIMD_EQ(min(a, b), S(0, 2, -3, 2, 1, -1, -4, -8));
+    HI_ASSERT_SIMD_EQ(max(a, b), S(1, 4, 3, 42, 2, 2, 8, 4));
+    HI_ASSERT_SIMD_EQ(abs(a), S(0, 2, 3, 42, 1, 1, 8, 8));
+}
+
+TEST(native_i32x8, bit_wise)
+{
+    HI_ASSERT_SIMD_EQ(S(0, 2, 0, 42, 1, 0, 0, 0) | S(1, 0, -3, 0, 2, 0, 0, 1), S(1, 2, -3, 42, 3, 0, 0, 1));
+    HI_ASSERT_SIMD_EQ(S(1, 2, 3, 42, 5, 6, 7, 8) & S::from_mask(0b1000'1010), S(0, 2, 0, 42, 0, 0, 0, 8));
+    HI_ASSERT_SIMD_EQ(S::from_mask(0b0110'0011) ^ S::from_mask(0b1010'1010), S::from_mask(0b1100'1001));
+    HI_ASSERT_SIMD_EQ(~S::from_mask(0b0101'1010), S::from_mask(0b1010'0101));
+    HI_ASSERT_SIMD_EQ(not_and(S::from_mask(0b1000'1010), S(1, 2, 3, 42, 5, 6, 7, 8)), S(1, 0, 3, 0, 5, 6, 7, 0));
+
+    HI_ASSERT_SIMD_EQ(S(1, 2, 3, 4, -1, -2, -3, -4) << 2, S(4, 8, 12, 16, -4, -8, -12, -16));
+    HI_ASSERT_SIMD_EQ(S(4, 8, 12, 16, -4, -8, -12, -16) >> 2, S(1, 2, 3, 4, -1, -2, -3, -4));
+
+    for (size_t i = 0; i != 256; ++i) {
+        ASSERT_EQ(S::from_mask(i).mask(), i);
+    }
+}
+
+TEST(native_i32x8, access)
+{
+    auto tmp = S(1, 2, 3, 4, 5, 6, 7, 8);
+
+    ASSERT_EQ(get<0>(tmp), 1);
+    ASSERT_EQ(get<3>(tmp), 4);
+    ASSERT_EQ(get<4>(tmp), 5);
+    ASSERT_EQ(get<7>(tmp), 8);
+
+    HI_ASSERT_SIMD_EQ(insert<0>(tmp, 42), S(42, 2, 3, 4, 5, 6, 7, 8));
+    HI_ASSERT_SIMD_EQ(insert<5>(tmp, 42), S(1, 2, 3, 4, 5, 42, 7, 8));
+    HI_ASSERT_SIMD_EQ(insert<7>(tmp, 42), S(1, 2, 3, 4, 5, 6, 7, 42));
+
+    HI_ASSERT_SIMD_EQ(set_zero<0b0000'0000>(tmp), tmp);
+    HI_ASSERT_SIMD_EQ(set_zero<0b1001'0001>(tmp), S(0, 2, 3, 4, 0, 6, 7, 0));
+    HI_ASSERT_SIMD_EQ(set_zero<0b1111'1111>(tmp), S());
+}
+
+TEST(native_i32x8, blend)
+{
+    auto a = S(1, 2, 3, 4, 5, 6, 7, 8);
+    auto b = S(42, 43, 44, 45, 46, 47, 48, 49);
+
+    HI_ASSERT_SIMD_EQ(blend<0b0000'0000>(a, b), a);
+    HI_ASSERT_SIMD_EQ(blend<0b1001'0010>(a, b), S(1, 43, 3, 4, 46, 6, 7, 49));
+    HI_ASSERT_SIMD_EQ(blend<0b1111'1111>(a, b), b);
+    HI_ASSERT_SIMD_EQ(blend(a, b, a > S::broadcast(5)), S(1, 2, 3, 4, 5, 47, 48, 49));
+}
+
+TEST(native_i32x8, permute)
+{
+    auto tmp = S(2, 3, 4, 5, 6, 7, 8, 9);
+
+    HI_ASSERT_SIMD_EQ(permute<"abcdefgh">(tmp), tmp);
+    HI_ASSERT_SIMD_EQ(permute<"hgfedcba">(tmp), S(9, 8, 7, 6, 5, 4, 3, 2));
+    HI_ASSERT_SIMD_EQ(permute<"aaaaaaaa">(tmp), S::broadcast(2));
+    HI_ASSERT_SIMD_EQ(permute<"efghabcd">(tmp), S(6, 7, 8, 9, 2, 3, 4, 5));
+
+    HI_ASSERT_SIMD_EQ(permute(tmp, S(7, 6, 5, 4, 3, 2, 1, 0)), S(9, 8, 7, 6, 5, 4, 3, 2));
+}
+
+TEST(native_i32x8, swizzle)
+{
+    auto tmp = S(2, 3, 4, 5, 6, 7, 8, 9);
+
+    HI_ASSERT_SIMD_EQ(swizzle<"abcdefgh">(tmp), tmp);
+    HI_ASSERT_SIMD_EQ(swizzle<"00000000">(tmp), S());
+    HI_ASSERT_SIMD_EQ(swizzle<"11111111">(tmp), S::broadcast(1));
+    HI_ASSERT_SIMD_EQ(swizzle<"h000000a">(tmp), S(9, 0, 0, 0, 0, 0, 0, 2));
+    HI_ASSERT_SIMD_EQ(swizzle<"1h0g1f0e">(tmp), S(1, 9, 0, 8, 1, 7, 0, 6));
+}
+
+TEST(native_i32x8, horizontal)
+{
+    auto a = S(2, 3, 4, 5, 6, 7, 8, 9);
+    auto b = S(12, 13, 14, 15, 16, 17, 18, 19);
+
+    HI_ASSERT_SIMD_EQ(horizontal_add(a, b), S(5, 9, 13, 17, 25, 29, 33, 37));
+    HI_ASSERT_SIMD_EQ(horizontal_sub(a, b), S::broadcast(-1));
+    HI_ASSERT_SIMD_EQ(horizontal_sum(a), S::broadcast(44));
+    HI_ASSERT_SIMD_EQ(dot_product<0b1000'0001>(a, b), S::broadcast(195));
+    HI_ASSERT_SIMD_EQ(dot_product<0b1111'1111>(a, b), S::broadcast(724));
+}
+
+hi_warning_pop();
+
+#endif
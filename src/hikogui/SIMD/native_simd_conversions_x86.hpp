@@ -5,10 +5,17 @@
 #pragma once
 
 #include "native_f32x4_sse.hpp"
+#include "native_f32x8_avx.hpp"
+#include "native_f32x16_avx512f.hpp"
 #include "native_f64x4_avx.hpp"
+#include "native_i16x16_avx2.hpp"
 #include "native_i32x4_sse2.hpp"
+#include "native_i32x8_avx2.hpp"
+#include "native_i32x16_avx512f.hpp"
 #include "native_i64x4_avx2.hpp"
 #include "native_u32x4_sse2.hpp"
+#include "native_u32x8_avx2.hpp"
+#include "native_u8x32_avx2.hpp"
 #include "native_simd_utility.hpp"
 #include "../macros.hpp"
 
@@ -39,6 +46,38 @@ namespace hi { inline namespace v1 {
     v(_mm256_cvtepu32_epi64(a.v))
 {
 }
+[[nodiscard]] inline native_simd<float, 8>::native_simd(native_simd<int32_t, 8> const& a) noexcept : v(_mm256_cvtepi32_ps(a.v)) {}
+[[nodiscard]] inline native_simd<int32_t, 8>::native_simd(native_simd<float, 8> const& a) noexcept : v(_mm256_cvtps_epi32(a.v)) {}
+[[nodiscard]] inline native_simd<int32_t, 8>::native_simd(native_simd<uint32_t, 8> const& a) noexcept : v(a.v) {}
+[[nodiscard]] inline native_simd<uint32_t, 8>::native_simd(native_simd<int32_t, 8> const& a) noexcept : v(a.v) {}
+
+[[nodiscard]] inline native_simd<float, 8>
+native_simd<float, 8>::gather(value_type const *ptr, native_simd<int32_t, 8> const& indices) noexcept
+{
+    return native_simd{_mm256_i32gather_ps(ptr, indices.v, sizeof(value_type))};
+}
+
+[[nodiscard]] inline native_simd<uint32_t, 8>
+native_simd<uint32_t, 8>::gather(value_type const *ptr, native_simd<int32_t, 8> const& indices) noexcept
+{
+    return native_simd{_mm256_i32gather_epi32(reinterpret_cast<int const *>(ptr), indices.v, sizeof(value_type))};
+}
+#endif
+#ifdef HI_HAS_AVX512F
+[[nodiscard]] inline native_simd<float, 16>::native_simd(native_simd<int32_t, 16> const& a) noexcept :
+    v(_mm512_cvtepi32_ps(a.v))
+{
+}
+[[nodiscard]] inline native_simd<int32_t, 16>::native_simd(native_simd<float, 16> const& a) noexcept :
+    v(_mm512_cvtps_epi32(a.v))
+{
+}
+
+[[nodiscard]] inline native_simd<float, 16>
+native_simd<float, 16>::gather(value_type const *ptr, native_simd<int32_t, 16> const& indices) noexcept
+{
+    return native_simd{_mm512_i32gather_ps(indices.v, ptr, sizeof(value_type))};
+}
 #endif
 
 
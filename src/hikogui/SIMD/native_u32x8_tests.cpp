@@ -0,0 +1,127 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "native_u32x8_avx2.hpp"
+#include "native_simd_conversions_x86.hpp"
+#include "simd_test_utility.hpp"
+#include "../macros.hpp"
+
+#ifdef HI_HAS_AVX2
+
+hi_warning_push();
+// C26474: Don't cast between pointer types when the conversion could be implicit (type.1).
+// For the test we need to do this explicit.
+hi_warning_ignore_msvc(26474);
+
+using S = hi::native_simd<uint32_t, 8>;
+using A = S::array_type;
+
+TEST(native_u32x8, construct)
+{
+    {
+        auto expected = A{0, 0, 0, 0, 0, 0, 0, 0};
+        ASSERT_EQ(static_cast<A>(S{}), expected);
+    }
+
+    {
+        auto expected = A{1, 2, 3, 4, 5, 6, 7, 8};
+        ASSERT_EQ(static_cast<A>(S{1, 2, 3, 4, 5, 6, 7, 8}), expected);
+    }
+
+    {
+        auto expected = A{0xffff'fffe, 0xffff'fffe, 0xffff'fffe, 0xffff'fffe, 0xffff'fffe, 0xffff'fffe, 0xffff'fffe, 0xffff'fffe};
+        ASSERT_EQ(static_cast<A>(S::broadcast(0xffff'fffe)), expected);
+    }
+
+    {
+        auto from = A{1, 2, 3, 4, 5, 6, 7, 8};
+        auto expected = A{1, 2, 3, 4, 5, 6, 7, 8};
+        ASSERT_EQ(static_cast<A>(S{from.data()}), expected);
+    }
+
+    // Conversion from signed integers is a bit-cast.
+    HI_ASSERT_SIMD_EQ(S(hi::native_simd<int32_t, 8>(1, -1, 3, 4, 5, 6, 7, 8)), S(1, 0xffff'ffff, 3, 4, 5, 6, 7, 8));
+}
+
+TEST(native_u32x8, tail)
+{
+    auto from = std::array<uint32_t, 9>{1, 2, 3, 4, 5, 6, 7, 8, 9};
+
+    HI_ASSERT_SIMD_EQ(S(from.data(), 0), S());
+    HI_ASSERT_SIMD_EQ(S(from.data(), 7), S(1, 2, 3, 4, 5, 6, 7));
+
+    auto to = std::array<uint32_t, 9>{};
+    S(1, 2, 3, 4, 5, 6, 7, 8).store(to.data(), 2);
+    ASSERT_EQ(to, (std::array<uint32_t, 9>{1, 2, 0, 0, 0, 0, 0, 0, 0}));
+}
+
+TEST(native_u32x8, gather)
+{
+    auto from = std::array<uint32_t, 10>{10, 11, 12, 13, 14, 15, 16, 17, 18, 19};
+    HI_ASSERT_SIMD_EQ(
+        S::gather(from.data(), hi::native_simd<int32_t, 8>(9, 0, 8, 1, 7, 2, 6, 3)), S(19, 10, 18, 11, 17, 12, 16, 13));
+}
+
+TEST(native_u32x8, compare)
+{
+    ASSERT_EQ((S(1, 2, 3, 4, 5, 6, 7, 8) == S(1, 0, 3, 0, 5, 0, 7, 0)).mask(), 0b0101'0101);
+    ASSERT_EQ((S(1, 2, 3, 4, 5, 6, 7, 8) != S(1, 0, 3, 0, 5, 0, 7, 0)).mask(), 0b1010'1010);
+
+    // Compare must be unsigned; values with the top bit set are large.
+    auto a = S(1, 2, 3, 4, 0xffff'ffff, 0x8000'0000, 0, 0x7fff'ffff);
+    auto b = S::broadcast(2);
+    ASSERT_EQ((a < b).mask(), 0b0100'0001);
+    ASSERT_EQ((a <= b).mask(), 0b0100'0011);
+    ASSERT_EQ((a > b).mask(), 0b1011'1100);
+    ASSERT_EQ((a >= b).mask(), 0b1011'1110);
+}
+
+TEST(native_u32x8, math)
+{
+    auto a = S(0, 2, 3, 42, 1, 0xffff'ffff, 8, 0x8000'0000);
+    auto b = S(1, 4, 3, 2, 2, 2, 4, 4);
+
+    HI_ASSERT_SIMD_EQ(a + b, S(1, 6, 6, 44, 3, 1, 12, 0x8000'0004));
+    HI_ASSERT_SIMD_EQ(a - b, S(0xffff'ffff, 0xffff'fffe, 0, 40, 0xffff'ffff, 0xffff'fffd, 4, 0x7fff'fffc));
+    HI_ASSERT_SIMD_EQ(a * b, S(0, 8, 9, 84, 2, 0xffff'fffe, 32, 0));
+    HI_ASSERT_SIMD_EQ(min(a, b), S(0, 2, 3, 2, 1, 2, 4, 4));
+    HI_ASSERT_SIMD_EQ(max(a, b), S(1, 4, 3, 42, 2, 0xffff'ffff, 8, 0x8000'0000));
+}
+
+TEST(native_u32x8, bit_wise)
+{
+    HI_ASSERT_SIMD_EQ(S(1, 2, 3, 42, 5, 6, 7, 8) & S::from_mask(0b1000'1010), S(0, 2, 0, 42, 0, 0, 0, 8));
+    HI_ASSERT_SIMD_EQ(~S::from_mask(0b0101'1010), S::from_mask(0b1010'0101));
+
+    HI_ASSERT_SIMD_EQ(S(1, 2, 3, 4, 5, 6, 7, 0x8000'0000) << 2, S(4, 8, 12, 16, 20, 24, 28, 0));
+    // Shift right is logical.
+    HI_ASSERT_SIMD_EQ(S(4, 8, 12, 16, 20, 24, 28, 0x8000'0000) >> 2, S(1, 2, 3, 4, 5, 6, 7, 0x2000'0000));
+
+    for (size_t i = 0; i != 256; ++i) {
+        ASSERT_EQ(S::from_mask(i).mask(), i);
+    }
+}
+
+TEST(native_u32x8, permute)
+{
+    auto tmp = S(2, 3, 4, 5, 6, 7, 8, 9);
+
+    HI_ASSERT_SIMD_EQ(permute<"hgfedcba">(tmp), S(9, 8, 7, 6, 5, 4, 3, 2));
+    HI_ASSERT_SIMD_EQ(swizzle<"1h0g1f0e">(tmp), S(1, 9, 0, 8, 1, 7, 0, 6));
+    HI_ASSERT_SIMD_EQ(blend<0b1001'0010>(tmp, S::broadcast(42)), S(2, 42, 4, 5, 42, 7, 8, 42));
+}
+
+TEST(native_u32x8, horizontal)
+{
+    auto a = S(2, 3, 4, 5, 6, 7, 8, 9);
+    auto b = S(12, 13, 14, 15, 16, 17, 18, 19);
+
+    HI_ASSERT_SIMD_EQ(horizontal_add(a, b), S(5, 9, 13, 17, 25, 29, 33, 37));
+    HI_ASSERT_SIMD_EQ(horizontal_sum(a), S::broadcast(44));
+    HI_ASSERT_SIMD_EQ(dot_product<0b1111'1111>(a, b), S::broadcast(724));
+}
+
+hi_warning_pop();
+
+#endif
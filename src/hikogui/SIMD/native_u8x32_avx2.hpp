@@ -0,0 +1,445 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "native_simd_utility.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <array>
+#include <ostream>
+#include <cstring>
+
+
+
+hi_warning_push();
+// Ignore "C26490: Don't use reinterpret_cast", needed for intrinsic loads and stores.
+hi_warning_ignore_msvc(26490);
+
+namespace hi { inline namespace v1 {
+
+#ifdef HI_HAS_AVX2
+
+/** A uint8_t x 32 (__m256i) AVX2 register.
+ *
+ *
+ * When loading and storing from memory this is the order of the element in the register
+ *
+ * ```
+ *  +-----+-----+-----+-----+-   -+------+------+
+ *  |el 0 |el 1 |el 2 |el 3 | ... |el 30 |el 31 |
+ *  +-----+-----+-----+-----+-   -+------+------+
+ *     0     1     2     3           30     31    memory address.
+ * ```
+ *
+ * In the function below a `mask` values least-significant-bit corresponds to element 0.
+ *
+ * There are too many elements to describe a permute with a fixed_string, instead
+ * elements can be permuted with a vector of indices.
+ */
+template<>
+struct native_simd<uint8_t, 32> {
+    using value_type = uint8_t;
+    constexpr static size_t size = 32;
+    using register_type = __m256i;
+    using array_type = std::array<value_type, size>;
+
+    register_type v;
+
+    native_simd(native_simd const&) noexcept = default;
+    native_simd(native_simd&&) noexcept = default;
+    native_simd& operator=(native_simd const&) noexcept = default;
+    native_simd& operator=(native_simd&&) noexcept = default;
+
+    /** Initialize all elements to zero.
+     */
+    native_simd() noexcept : v(_mm256_setzero_si256()) {}
+
+    [[nodiscard]] explicit native_simd(register_type other) noexcept : v(other) {}
+
+    [[nodiscard]] explicit operator register_type() const noexcept
+    {
+        return v;
+    }
+
+    [[nodiscard]] explicit native_simd(value_type const *other) noexcept :
+        v(_mm256_loadu_si256(reinterpret_cast<register_type const *>(other)))
+    {
+    }
+
+    void store(value_type *out) const noexcept
+    {
+        hi_axiom_not_null(out);
+        _mm256_storeu_si256(reinterpret_cast<register_type *>(out), v);
+    }
+
+    /** Load the first elements from memory, the other elements are set to zero.
+     *
+     * This is used to load the tail of an array, memory beyond the
+     * @a count elements is not accessed.
+     *
+     * AVX2 has no 8-bit masked load, the elements are copied through the stack.
+     *
+     * @param other A pointer to the elements to load.
+     * @param count The number of elements to load.
+     */
+    [[nodiscard]] native_simd(value_type const *other, size_t count) noexcept
+    {
+        hi_axiom(count <= size);
+        auto tmp = array_type{};
+        std::memcpy(tmp.data(), other, count);
+        v = _mm256_loadu_si256(reinterpret_cast<register_type const *>(tmp.data()));
+    }
+
+    /** Store the first elements to memory.
+     *
+     * This is used to store the tail of an array, memory beyond the
+     * @a count elements is not accessed.
+     *
+     * @param out A pointer to where the elements are stored.
+     * @param count The number of elements to store.
+     */
+    void store(value_type *out, size_t count) const noexcept
+    {
+        hi_axiom(count <= size);
+        hilet tmp = static_cast<array_type>(*this);
+        std::memcpy(out, tmp.data(), count);
+    }
+
+    [[nodiscard]] explicit native_simd(void const *other) noexcept : v(_mm256_loadu_si256(static_cast<register_type const *>(other)))
+    {
+    }
+
+    void store(void *out) const noexcept
+    {
+        hi_axiom_not_null(out);
+        _mm256_storeu_si256(static_cast<register_type *>(out), v);
+    }
+
+    [[nodiscard]] explicit native_simd(std::span<value_type const> other) noexcept
+    {
+        hi_axiom(other.size() >= size);
+        v = _mm256_loadu_si256(reinterpret_cast<register_type const *>(other.data()));
+    }
+
+    void store(std::span<value_type> out) const noexcept
+    {
+        hi_axiom(out.size() >= size);
+        _mm256_storeu_si256(reinterpret_cast<register_type *>(out.data()), v);
+    }
+
+    [[nodiscard]] explicit native_simd(array_type other) noexcept :
+        v(_mm256_loadu_si256(reinterpret_cast<register_type const *>(other.data())))
+    {
+    }
+
+    [[nodiscard]] explicit operator array_type() const noexcept
+    {
+        auto r = array_type{};
+        _mm256_storeu_si256(reinterpret_cast<register_type *>(r.data()), v);
+        return r;
+    }
+
+    /** Broadcast a single value to all the elements.
+     *
+     * ```
+     * r[i] = a
+     * ```
+     */
+    [[nodiscard]] static native_simd broadcast(value_type a) noexcept
+    {
+        return native_simd{_mm256_set1_epi8(char_cast<char>(a))};
+    }
+
+    /** Broadcast the first element to all the elements.
+     *
+     * ```
+     * r[i] = a[0]
+     * ```
+     */
+    [[nodiscard]] static native_simd broadcast(native_simd a) noexcept
+    {
+        return native_simd{_mm256_broadcastb_epi8(_mm256_castsi256_si128(a.v))};
+    }
+
+    [[nodiscard]] static native_simd ones() noexcept
+    {
+        hilet tmp = _mm256_undefined_si256();
+        return native_simd{_mm256_cmpeq_epi8(tmp, tmp)};
+    }
+
+    /** For each bit in mask set corresponding element to all-ones or all-zeros.
+     */
+    [[nodiscard]] static native_simd from_mask(size_t a) noexcept
+    {
+        hi_axiom(a <= 0xffff'ffff);
+
+        // Copy each byte of the mask into the 8 elements it describes,
+        // then test the bit of each element.
+        hilet spread = _mm256_shuffle_epi8(
+            _mm256_set1_epi32(truncate<int32_t>(a)),
+            _mm256_set_epi64x(0x0303'0303'0303'0303, 0x0202'0202'0202'0202, 0x0101'0101'0101'0101, 0x0000'0000'0000'0000));
+        hilet bits = _mm256_set1_epi64x(0x8040'2010'0804'0201);
+        return native_simd{_mm256_cmpeq_epi8(_mm256_and_si256(spread, bits), bits)};
+    }
+
+    /** Concatenate the top bit of each element.
+     */
+    [[nodiscard]] size_t mask() const noexcept
+    {
+        return narrow_cast<size_t>(truncate<uint32_t>(_mm256_movemask_epi8(v)));
+    }
+
+    [[nodiscard]] friend bool equal(native_simd a, native_simd b) noexcept
+    {
+        hilet tmp = _mm256_xor_si256(a.v, b.v);
+        return _mm256_testz_si256(tmp, tmp) == 1;
+    }
+
+    [[nodiscard]] friend native_simd operator==(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_cmpeq_epi8(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator!=(native_simd a, native_simd b) noexcept
+    {
+        return ~(a == b);
+    }
+
+    [[nodiscard]] friend native_simd operator<(native_simd a, native_simd b) noexcept
+    {
+        return ~(a >= b);
+    }
+
+    [[nodiscard]] friend native_simd operator>(native_simd a, native_simd b) noexcept
+    {
+        return ~(a <= b);
+    }
+
+    [[nodiscard]] friend native_simd operator<=(native_simd a, native_simd b) noexcept
+    {
+        // There is no unsigned compare, a <= b when min(a, b) == a.
+        return native_simd{_mm256_cmpeq_epi8(_mm256_min_epu8(a.v, b.v), a.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator>=(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_cmpeq_epi8(_mm256_max_epu8(a.v, b.v), a.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator+(native_simd a) noexcept
+    {
+        return a;
+    }
+
+    [[nodiscard]] friend native_simd operator+(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_add_epi8(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator-(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_sub_epi8(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator&(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_and_si256(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator|(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_or_si256(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator^(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_xor_si256(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd operator~(native_simd a) noexcept
+    {
+        return not_and(a, ones());
+    }
+
+    [[nodiscard]] friend native_simd operator<<(native_simd a, unsigned int b) noexcept
+    {
+        hi_axiom_bounds(b, sizeof(value_type) * CHAR_BIT);
+
+        // There is no 8-bit shift, shift 16-bit elements and clear the bits shifted in from the neighbour.
+        hilet shifted = _mm256_sll_epi16(a.v, _mm_cvtsi32_si128(truncate<int>(b)));
+        return native_simd{_mm256_and_si256(shifted, _mm256_set1_epi8(truncate<char>(0xff << b)))};
+    }
+
+    [[nodiscard]] friend native_simd operator>>(native_simd a, unsigned int b) noexcept
+    {
+        hi_axiom_bounds(b, sizeof(value_type) * CHAR_BIT);
+
+        hilet shifted = _mm256_srl_epi16(a.v, _mm_cvtsi32_si128(truncate<int>(b)));
+        return native_simd{_mm256_and_si256(shifted, _mm256_set1_epi8(truncate<char>(0xff >> b)))};
+    }
+
+    [[nodiscard]] friend native_simd min(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_min_epu8(a.v, b.v)};
+    }
+
+    [[nodiscard]] friend native_simd max(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_max_epu8(a.v, b.v)};
+    }
+
+    /** Add elements, saturating at 255.
+     */
+    [[nodiscard]] friend native_simd add_saturate(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_adds_epu8(a.v, b.v)};
+    }
+
+    /** Subtract elements, saturating at 0.
+     */
+    [[nodiscard]] friend native_simd sub_saturate(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_subs_epu8(a.v, b.v)};
+    }
+
+    /** Set elements to zero.
+     *
+     * @tparam Mask A bit mask corresponding to each element.
+     * @param a The value to modify.
+     * @return argument @a with elements set to zero where the corresponding @a Mask bit was '1'.
+     */
+    template<size_t Mask>
+    [[nodiscard]] friend native_simd set_zero(native_simd a) noexcept
+    {
+        static_assert(Mask <= 0xffff'ffff);
+        return blend<Mask>(a, native_simd{});
+    }
+
+    /** Insert a value into an element of a vector.
+     *
+     * @tparam Index the index of the element where insert the value.
+     * @param a The vector to insert the value into.
+     * @param b The value to insert.
+     * @return The vector with the inserted value.
+     */
+    template<size_t Index>
+    [[nodiscard]] friend native_simd insert(native_simd a, value_type b) noexcept
+    {
+        static_assert(Index < size);
+        return native_simd{_mm256_insert_epi8(a.v, char_cast<char>(b), Index)};
+    }
+
+    /** Extract an element from a vector.
+     *
+     * @tparam Index the index of the element.
+     * @param a The vector to select the element from.
+     * @return The value of the selected element.
+     */
+    template<size_t Index>
+    [[nodiscard]] friend value_type get(native_simd a) noexcept
+    {
+        static_assert(Index < size);
+        return truncate<value_type>(_mm256_extract_epi8(a.v, Index));
+    }
+
+    /** Select elements from two vectors.
+     *
+     * @tparam Mask A mask to select bits from @a a when '0'; or @a b when '1'. The
+     *         lsb corresponds with element zero.
+     * @param a A vector for which element are selected when the bit in @a Mask is '0'.
+     * @param b A vector for which element are selected when the bit in @a Mask is '1'.
+     * @return A vector with element selected from @a a and @a b
+     */
+    template<size_t Mask>
+    [[nodiscard]] friend native_simd blend(native_simd a, native_simd b) noexcept
+    {
+        static_assert(Mask <= 0xffff'ffff);
+
+        if constexpr (Mask == 0) {
+            return a;
+        } else if constexpr (Mask == 0xffff'ffff) {
+            return b;
+        } else {
+            return blend(a, b, from_mask(Mask));
+        }
+    }
+
+    /** Select elements from two vectors.
+     *
+     * @param a A vector for which element are selected when the element in @a mask is all-zeros.
+     * @param b A vector for which element are selected when the element in @a mask is all-ones.
+     * @param mask A vector with elements set to all-ones or all-zeros, as returned by the compare operators.
+     * @return A vector with element selected from @a a and @a b
+     */
+    [[nodiscard]] friend native_simd blend(native_simd a, native_simd b, native_simd mask) noexcept
+    {
+        return native_simd{_mm256_blendv_epi8(a.v, b.v, mask.v)};
+    }
+
+    /** Permute elements using indices.
+     *
+     * ```
+     * r[i] = a[indices[i] & 31]
+     * ```
+     */
+    [[nodiscard]] friend native_simd permute(native_simd a, native_simd indices) noexcept
+    {
+        // _mm256_shuffle_epi8() only shuffles within a 128-bit lane. Shuffle the lanes
+        // and pick for each element the result based on bit 4 of the index.
+        hilet lo_lanes = _mm256_permute2x128_si256(a.v, a.v, 0b0000'0000);
+        hilet hi_lanes = _mm256_permute2x128_si256(a.v, a.v, 0b0001'0001);
+        hilet lo = _mm256_shuffle_epi8(lo_lanes, indices.v);
+        hilet hi = _mm256_shuffle_epi8(hi_lanes, indices.v);
+        hilet select_hi = _mm256_slli_epi16(indices.v, 3);
+        return native_simd{_mm256_blendv_epi8(lo, hi, select_hi)};
+    }
+
+    /** Sum each group of 8 elements.
+     *
+     * ```
+     * r[0] = a[0] + a[1] + ... + a[7]
+     * r[1] = a[8] + a[9] + ... + a[15]
+     * r[2] = a[16] + a[17] + ... + a[23]
+     * r[3] = a[24] + a[25] + ... + a[31]
+     * ```
+     *
+     * @return Four 64-bit sums in a register.
+     */
+    [[nodiscard]] friend register_type horizontal_sum_epi64(native_simd a) noexcept
+    {
+        return _mm256_sad_epu8(a.v, _mm256_setzero_si256());
+    }
+
+    /** not followed by and.
+     *
+     * r = ~a & b
+     *
+     */
+    [[nodiscard]] friend native_simd not_and(native_simd a, native_simd b) noexcept
+    {
+        return native_simd{_mm256_andnot_si256(a.v, b.v)};
+    }
+
+    friend std::ostream& operator<<(std::ostream& a, native_simd b) noexcept
+    {
+        hilet tmp = static_cast<array_type>(b);
+
+        a << "(";
+        for (auto i = 0_uz; i != size; ++i) {
+            if (i != 0) {
+                a << ", ";
+            }
+            a << static_cast<unsigned int>(tmp[i]);
+        }
+        return a << ")";
+    }
+};
+
+#endif
+
+}} // namespace hi::v1
+
+hi_warning_pop();
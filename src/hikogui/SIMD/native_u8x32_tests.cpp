@@ -0,0 +1,152 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "native_u8x32_avx2.hpp"
+#include "simd_test_utility.hpp"
+#include "../macros.hpp"
+#include <numeric>
+
+#ifdef HI_HAS_AVX2
+
+hi_warning_push();
+// C26474: Don't cast between pointer types when the conversion could be implicit (type.1).
+// For the test we need to do this explicit.
+hi_warning_ignore_msvc(26474);
+
+using S = hi::native_simd<uint8_t, 32>;
+using A = S::array_type;
+
+[[nodiscard]] static A iota_array(uint8_t first = 0) noexcept
+{
+    auto r = A{};
+    std::iota(r.begin(), r.end(), first);
+    return r;
+}
+
+TEST(native_u8x32, construct)
+{
+    ASSERT_EQ(static_cast<A>(S{}), A{});
+
+    {
+        auto expected = iota_array(1);
+        ASSERT_EQ(static_cast<A>(S{expected}), expected);
+        ASSERT_EQ(static_cast<A>(S{expected.data()}), expected);
+    }
+
+    {
+        auto expected = A{};
+        expected.fill(200);
+        ASSERT_EQ(static_cast<A>(S::broadcast(200)), expected);
+        ASSERT_EQ(static_cast<A>(S::broadcast(S{expected})), expected);
+    }
+}
+
+TEST(native_u8x32, tail)
+{
+    auto from = iota_array(1);
+
+    {
+        auto expected = A{};
+        std::iota(expected.begin(), expected.begin() + 19, uint8_t{1});
+        ASSERT_EQ(static_cast<A>(S(from.data(), 19)), expected);
+    }
+
+    {
+        auto to = std::array<uint8_t, 33>{};
+        S{from}.store(to.data(), 3);
+        ASSERT_EQ(to[0], 1);
+        ASSERT_EQ(to[2], 3);
+        ASSERT_EQ(to[3], 0);
+        ASSERT_EQ(to[32], 0);
+    }
+}
+
+TEST(native_u8x32, compare)
+{
+    auto a = S{iota_array(0)};
+    auto b = S::broadcast(2);
+
+    ASSERT_EQ((a == b).mask(), 0b100);
+    ASSERT_EQ((a != b).mask(), 0xffff'fffb);
+    ASSERT_EQ((a < b).mask(), 0b011);
+    ASSERT_EQ((a <= b).mask(), 0b111);
+    ASSERT_EQ((a > b).mask(), 0xffff'fff8);
+    ASSERT_EQ((a >= b).mask(), 0xffff'fffc);
+
+    // Compare must be unsigned.
+    ASSERT_EQ((S::broadcast(200) > S::broadcast(100)).mask(), 0xffff'ffff);
+}
+
+TEST(native_u8x32, math)
+{
+    auto a = S::broadcast(200);
+    auto b = S::broadcast(100);
+
+    HI_ASSERT_SIMD_EQ(a + b, S::broadcast(44));
+    HI_ASSERT_SIMD_EQ(b - a, S::broadcast(156));
+    HI_ASSERT_SIMD_EQ(add_saturate(a, b), S::broadcast(255));
+    HI_ASSERT_SIMD_EQ(sub_saturate(b, a), S::broadcast(0));
+    HI_ASSERT_SIMD_EQ(min(a, b), b);
+    HI_ASSERT_SIMD_EQ(max(a, b), a);
+}
+
+TEST(native_u8x32, bit_wise)
+{
+    HI_ASSERT_SIMD_EQ(S::broadcast(0b1100'0011) << 2, S::broadcast(0b0000'1100));
+    HI_ASSERT_SIMD_EQ(S::broadcast(0b1100'0011) >> 2, S::broadcast(0b0011'0000));
+    HI_ASSERT_SIMD_EQ(~S::from_mask(0x5a5a'0ff0), S::from_mask(0xa5a5'f00f));
+    HI_ASSERT_SIMD_EQ(not_and(S::from_mask(0xffff'fffe), S::broadcast(7)), S::from_mask(1) & S::broadcast(7));
+
+    for (auto i : {size_t{0}, size_t{1}, size_t{0x8000'0000}, size_t{0x1234'5678}, size_t{0xffff'ffff}}) {
+        ASSERT_EQ(S::from_mask(i).mask(), i);
+    }
+}
+
+TEST(native_u8x32, access)
+{
+    auto tmp = S{iota_array(1)};
+
+    ASSERT_EQ(get<0>(tmp), 1);
+    ASSERT_EQ(get<16>(tmp), 17);
+    ASSERT_EQ(get<31>(tmp), 32);
+
+    ASSERT_EQ(get<20>(insert<20>(tmp, 42)), 42);
+    ASSERT_EQ(get<21>(insert<20>(tmp, 42)), 22);
+    HI_ASSERT_SIMD_EQ(set_zero<0xffff'ffff>(tmp), S{});
+}
+
+TEST(native_u8x32, blend)
+{
+    auto a = S::broadcast(1);
+    auto b = S::broadcast(2);
+
+    ASSERT_EQ((blend<0x8001'0001>(a, b) == b).mask(), 0x8001'0001);
+    ASSERT_EQ((blend(a, b, S::from_mask(0x0f0f'f0f0)) == b).mask(), 0x0f0f'f0f0);
+}
+
+TEST(native_u8x32, permute)
+{
+    auto tmp = S{iota_array(0)};
+
+    auto reversed = A{};
+    std::iota(reversed.rbegin(), reversed.rend(), uint8_t{0});
+    HI_ASSERT_SIMD_EQ(permute(tmp, S{reversed}), S{reversed});
+
+    auto rotated = iota_array(16);
+    for (auto& x : rotated) {
+        x %= 32;
+    }
+    HI_ASSERT_SIMD_EQ(permute(tmp, S{rotated}), S{rotated});
+}
+
+TEST(native_u8x32, horizontal)
+{
+    auto sums = std::array<int64_t, 4>{};
+    _mm256_storeu_si256(reinterpret_cast<__m256i *>(sums.data()), horizontal_sum_epi64(S{iota_array(1)}));
+    ASSERT_EQ(sums, (std::array<int64_t, 4>{36, 100, 164, 228}));
+}
+
+hi_warning_pop();
+
+#endif
@@ -5,10 +5,17 @@
 #pragma once
 
 #include "native_f32x4_sse.hpp"
+#include "native_f32x8_avx.hpp"
+#include "native_f32x16_avx512f.hpp"
 #include "native_f64x4_avx.hpp"
+#include "native_i16x16_avx2.hpp"
 #include "native_i32x4_sse2.hpp"
+#include "native_i32x8_avx2.hpp"
+#include "native_i32x16_avx512f.hpp"
 #include "native_i64x4_avx2.hpp"
 #include "native_u32x4_sse2.hpp"
+#include "native_u32x8_avx2.hpp"
+#include "native_u8x32_avx2.hpp"
 #include "native_simd_conversions_x86.hpp"
 
 #include "../utility/utility.hpp"
@@ -1257,6 +1264,30 @@ using f64x2 = simd<double, 2>;
 using f64x4 = simd<double, 4>;
 using f64x8 = simd<double, 8>;
 
+namespace detail {
+
+template<numeric_limited T>
+[[nodiscard]] consteval std::size_t fast_simd_size() noexcept
+{
+    if constexpr (simd<T, 64 / sizeof(T)>::has_native_type) {
+        return 64 / sizeof(T);
+    } else if constexpr (simd<T, 32 / sizeof(T)>::has_native_type) {
+        return 32 / sizeof(T);
+    } else {
+        return 16 / sizeof(T);
+    }
+}
+
+} // namespace detail
+
+/** The widest simd type of which the operations are native for the instruction set the library is compiled for.
+ *
+ * When there is no native simd type at all, the size is that of a 128 bit
+ * register, which the compiler may be able to auto-vectorize.
+ */
+template<numeric_limited T>
+using fast_simd = simd<T, detail::fast_simd_size<T>()>;
+
 } // namespace hi::inline v1
 
 template<class T, std::size_t N>
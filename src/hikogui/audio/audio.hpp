@@ -9,7 +9,12 @@
 #include "audio_device_state.hpp" // export
 #include "audio_device_win32.hpp" // export
 #include "audio_direction.hpp" // export
+#include "audio_fake_device_clock.hpp" // export
 #include "audio_format_range.hpp" // export
+#include "audio_graph.hpp" // export
+#include "audio_graph_processor.hpp" // export
+#include "audio_node.hpp" // export
+#include "audio_sample_convert.hpp" // export
 #include "audio_sample_format.hpp" // export
 #include "audio_sample_packer.hpp" // export
 #include "audio_sample_unpacker.hpp" // export
@@ -71,6 +71,17 @@ public:
      * When the state is corrupt; DO NOT READ THE SAMPLE_BUFFER.
      */
     audio_block_state state;
+
+    /** The samples of a single channel.
+     *
+     * @param index The index of the channel.
+     * @return The `num_samples` samples of the channel.
+     */
+    [[nodiscard]] std::span<float> channel(std::size_t index) const noexcept
+    {
+        hi_axiom(index < num_channels);
+        return {samples[index], num_samples};
+    }
 };
 
 }} // namespace hi::inline v1
@@ -0,0 +1,150 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file audio/audio_fake_device_clock.hpp Defines audio_fake_device_clock.
+ * @ingroup audio
+ */
+
+#pragma once
+
+#include "audio_block.hpp"
+#include "audio_graph_processor.hpp"
+#include "../time/module.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <vector>
+#include <span>
+#include <chrono>
+#include <random>
+#include <thread>
+#include <cstdint>
+
+hi_export_module(hikogui.audio.audio_fake_device_clock);
+
+namespace hi { inline namespace v1 {
+
+/** A clock that drives an audio graph without an audio device.
+ *
+ * This is used to run an audio graph headless, for example in tests. Each
+ * tick produces an output block as an audio device would request it; the
+ * time stamps of the blocks may be given a random jitter to test the
+ * statistics of the processor.
+ */
+hi_export class audio_fake_device_clock {
+public:
+    using duration = std::chrono::nanoseconds;
+
+    audio_fake_device_clock(audio_fake_device_clock const&) = delete;
+    audio_fake_device_clock(audio_fake_device_clock&&) = delete;
+    audio_fake_device_clock& operator=(audio_fake_device_clock const&) = delete;
+    audio_fake_device_clock& operator=(audio_fake_device_clock&&) = delete;
+
+    /** Create a fake device clock.
+     *
+     * @param sample_rate The sample rate of the fake device.
+     * @param num_samples The number of samples in each block.
+     * @param num_channels The number of output channels of the fake device.
+     * @param jitter The maximum random offset of the time stamp of a block.
+     * @param seed The seed of the random jitter, so that a run can be repeated.
+     */
+    audio_fake_device_clock(
+        int sample_rate,
+        std::size_t num_samples,
+        std::size_t num_channels,
+        duration jitter = {},
+        uint32_t seed = 1) :
+        _samples(num_samples * num_channels, 0.0f),
+        _channels(num_channels),
+        _jitter(jitter),
+        _random(seed)
+    {
+        hi_assert(sample_rate > 0);
+
+        for (auto c = 0_uz; c != num_channels; ++c) {
+            _channels[c] = _samples.data() + c * num_samples;
+        }
+
+        _block.samples = _channels.data();
+        _block.num_samples = num_samples;
+        _block.num_channels = num_channels;
+        _block.sample_rate = sample_rate;
+        _block.sample_count = 0;
+        _block.time_stamp = {};
+        _block.state = audio_block_state::silent;
+    }
+
+    /** The block of the last tick.
+     */
+    [[nodiscard]] audio_block const& block() const noexcept
+    {
+        return _block;
+    }
+
+    /** The duration of a block.
+     */
+    [[nodiscard]] duration period() const noexcept
+    {
+        return time_of(narrow_cast<int64_t>(_block.num_samples));
+    }
+
+    /** Process a single block.
+     *
+     * The time stamp of the block is calculated from the sample count,
+     * plus a random jitter.
+     *
+     * @param processor The processor that fills the block.
+     */
+    void tick(audio_graph_processor& processor) noexcept
+    {
+        _block.sample_count = _next_sample_count;
+        _block.time_stamp = utc_nanoseconds{time_of(_next_sample_count) + random_jitter()};
+        processor.process(_block);
+
+        _next_sample_count += narrow_cast<int64_t>(_block.num_samples);
+    }
+
+    /** Process a number of blocks.
+     *
+     * @param processor The processor that fills the blocks.
+     * @param num_blocks The number of blocks to process.
+     * @param real_time When true, wait for the period of a block between ticks,
+     *        otherwise the blocks are processed as fast as possible.
+     */
+    void run(audio_graph_processor& processor, std::size_t num_blocks, bool real_time = false) noexcept
+    {
+        auto next = std::chrono::steady_clock::now();
+        for (auto i = 0_uz; i != num_blocks; ++i) {
+            tick(processor);
+
+            if (real_time) {
+                next += period();
+                std::this_thread::sleep_until(next);
+            }
+        }
+    }
+
+private:
+    std::vector<float> _samples;
+    std::vector<float *> _channels;
+    audio_block _block = {};
+    duration _jitter;
+    std::minstd_rand _random;
+    int64_t _next_sample_count = 0;
+
+    [[nodiscard]] duration time_of(int64_t sample_count) const noexcept
+    {
+        return duration{sample_count * 1'000'000'000LL / _block.sample_rate};
+    }
+
+    [[nodiscard]] duration random_jitter() noexcept
+    {
+        if (_jitter == duration{}) {
+            return {};
+        }
+        auto distribution = std::uniform_int_distribution<duration::rep>{-_jitter.count(), _jitter.count()};
+        return duration{distribution(_random)};
+    }
+};
+
+}} // namespace hi::v1
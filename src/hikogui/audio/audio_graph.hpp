@@ -0,0 +1,404 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file audio/audio_graph.hpp Defines audio_graph and audio_graph_program.
+ * @ingroup audio
+ */
+
+#pragma once
+
+#include "audio_node.hpp"
+#include "audio_block.hpp"
+#include "../time/module.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <memory>
+#include <vector>
+#include <span>
+#include <atomic>
+#include <algorithm>
+#include <limits>
+#include <thread>
+#include <cstdint>
+
+hi_export_module(hikogui.audio.audio_graph);
+
+namespace hi { inline namespace v1 {
+
+/** The description of an audio processing graph.
+ *
+ * The graph is edited on a normal thread, then compiled into an
+ * `audio_graph_program` which is executed on the audio thread.
+ *
+ * Only the nodes from which the output node can be reached are compiled
+ * into the program. To remove a node from the processing, disconnect it.
+ */
+hi_export class audio_graph {
+public:
+    using node_id = std::size_t;
+
+    constexpr static node_id invalid_node_id = std::numeric_limits<node_id>::max();
+
+    struct node_type {
+        std::shared_ptr<audio_node> node;
+
+        /** The number of channels of the output block of the node.
+         */
+        std::size_t num_channels;
+
+        /** The nodes connected to the inputs.
+         */
+        std::vector<node_id> inputs;
+    };
+
+    /** Add a node to the graph.
+     *
+     * @param node The node.
+     * @param num_channels The number of channels of the output block of the node.
+     * @return The id of the node.
+     */
+    node_id add(std::shared_ptr<audio_node> node, std::size_t num_channels)
+    {
+        hi_assert_not_null(node);
+        _nodes.emplace_back(std::move(node), num_channels);
+        return _nodes.size() - 1;
+    }
+
+    /** Connect the output of a node to an input of another node.
+     *
+     * @param from The node from which the output is read.
+     * @param to The node which reads from @a from.
+     */
+    void connect(node_id from, node_id to)
+    {
+        hi_assert_bounds(from, _nodes);
+        hi_assert_bounds(to, _nodes);
+        _nodes[to].inputs.push_back(from);
+    }
+
+    /** Remove all connections between two nodes.
+     */
+    void disconnect(node_id from, node_id to) noexcept
+    {
+        hi_assert_bounds(to, _nodes);
+        std::erase(_nodes[to].inputs, from);
+    }
+
+    /** Select the node of which the output is sent to the audio device.
+     */
+    void set_output(node_id id) noexcept
+    {
+        hi_assert_bounds(id, _nodes);
+        _output = id;
+    }
+
+    [[nodiscard]] node_id output() const noexcept
+    {
+        return _output;
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _nodes.size();
+    }
+
+    [[nodiscard]] node_type const& operator[](node_id id) const noexcept
+    {
+        hi_axiom_bounds(id, _nodes);
+        return _nodes[id];
+    }
+
+private:
+    std::vector<node_type> _nodes;
+    node_id _output = invalid_node_id;
+};
+
+/** A compiled audio graph.
+ *
+ * The nodes are sorted topologically and grouped by level; the nodes of a
+ * level only depend on the nodes of lower levels, so that they may be
+ * processed concurrently. The output blocks of the nodes are allocated when
+ * the program is compiled; executing the program does not allocate.
+ *
+ * A program is compiled off the audio thread and then swapped in using
+ * `rcu`; see `audio_graph_processor`.
+ */
+hi_export class audio_graph_program {
+public:
+    /** The per block parameters passed to each node.
+     */
+    struct block_info {
+        std::size_t num_samples;
+        int sample_rate;
+        int64_t sample_count;
+        utc_nanoseconds time_stamp;
+    };
+
+    ~audio_graph_program() = default;
+    audio_graph_program(audio_graph_program const&) = delete;
+    audio_graph_program(audio_graph_program&&) noexcept = default;
+    audio_graph_program& operator=(audio_graph_program const&) = delete;
+    audio_graph_program& operator=(audio_graph_program&&) noexcept = default;
+
+    /** Compile an audio graph.
+     *
+     * @param graph The graph to compile.
+     * @param max_num_samples The maximum number of samples of a block.
+     * @throws operation_error When the graph has no output or contains a cycle.
+     */
+    audio_graph_program(audio_graph const& graph, std::size_t max_num_samples) : _max_num_samples(max_num_samples)
+    {
+        using node_id = audio_graph::node_id;
+
+        hi_assert(max_num_samples != 0);
+        if (graph.output() == audio_graph::invalid_node_id) {
+            throw operation_error("The audio graph has no output.");
+        }
+
+        // Find the nodes from which the output can be reached.
+        auto reachable = std::vector<bool>(graph.size(), false);
+        auto todo = std::vector<node_id>{graph.output()};
+        while (not todo.empty()) {
+            hilet id = todo.back();
+            todo.pop_back();
+            if (not reachable[id]) {
+                reachable[id] = true;
+                todo.insert(todo.end(), graph[id].inputs.begin(), graph[id].inputs.end());
+            }
+        }
+
+        // Kahn's algorithm, the level of a node is one more than the highest level of its inputs.
+        auto num_unresolved = std::vector<std::size_t>(graph.size(), 0);
+        auto consumers = std::vector<std::vector<node_id>>(graph.size());
+        auto levels = std::vector<std::size_t>(graph.size(), 0);
+        auto order = std::vector<node_id>{};
+        for (auto id = 0_uz; id != graph.size(); ++id) {
+            if (reachable[id]) {
+                num_unresolved[id] = graph[id].inputs.size();
+                for (hilet input : graph[id].inputs) {
+                    consumers[input].push_back(id);
+                }
+                if (num_unresolved[id] == 0) {
+                    order.push_back(id);
+                }
+            }
+        }
+        for (auto i = 0_uz; i != order.size(); ++i) {
+            hilet id = order[i];
+            for (hilet consumer : consumers[id]) {
+                levels[consumer] = std::max(levels[consumer], levels[id] + 1);
+                if (--num_unresolved[consumer] == 0) {
+                    order.push_back(consumer);
+                }
+            }
+        }
+        if (order.size() != static_cast<std::size_t>(std::count(reachable.begin(), reachable.end(), true))) {
+            throw operation_error("The audio graph contains a cycle.");
+        }
+
+        std::stable_sort(order.begin(), order.end(), [&](hilet lhs, hilet rhs) {
+            return levels[lhs] < levels[rhs];
+        });
+
+        auto step_index = std::vector<std::size_t>(graph.size(), 0);
+        for (auto i = 0_uz; i != order.size(); ++i) {
+            step_index[order[i]] = i;
+        }
+
+        // Pad each channel to a multiple of 64 bytes so that each channel is aligned.
+        constexpr auto alignment = 64_uz / sizeof(float);
+        hilet channel_stride = (max_num_samples + alignment - 1) / alignment * alignment;
+
+        auto num_channels = 0_uz;
+        for (hilet id : order) {
+            num_channels += graph[id].num_channels;
+        }
+        _samples.resize(num_channels * channel_stride + alignment, 0.0f);
+        _channels.resize(num_channels);
+
+        auto *samples = _samples.data();
+        if (hilet misalignment = reinterpret_cast<uintptr_t>(samples) % 64) {
+            samples += (64 - misalignment) / sizeof(float);
+        }
+
+        _steps.reserve(order.size());
+        _blocks.resize(order.size());
+        auto channel_index = 0_uz;
+        for (hilet id : order) {
+            hilet& node = graph[id];
+
+            auto& step = _steps.emplace_back();
+            step.node = node.node;
+            step.level = levels[id];
+            step.first_input = _input_sources.size();
+            step.num_inputs = node.inputs.size();
+            for (hilet input : node.inputs) {
+                _input_sources.push_back(step_index[input]);
+            }
+
+            auto& block = _blocks[_steps.size() - 1];
+            block.samples = _channels.data() + channel_index;
+            block.num_channels = node.num_channels;
+            block.num_samples = 0;
+            block.state = audio_block_state::silent;
+            for (auto c = 0_uz; c != node.num_channels; ++c) {
+                _channels[channel_index++] = samples;
+                samples += channel_stride;
+            }
+
+            if (_level_offsets.size() <= step.level) {
+                _level_offsets.push_back(_steps.size() - 1);
+            }
+        }
+        _level_offsets.push_back(_steps.size());
+
+        _inputs.resize(_input_sources.size());
+        _done = std::make_unique<std::atomic<uint64_t>[]>(_steps.size());
+    }
+
+    /** The maximum number of samples of a block.
+     */
+    [[nodiscard]] std::size_t max_num_samples() const noexcept
+    {
+        return _max_num_samples;
+    }
+
+    /** The number of nodes in the program.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _steps.size();
+    }
+
+    /** The number of levels, the nodes in a level may be processed concurrently.
+     */
+    [[nodiscard]] std::size_t num_levels() const noexcept
+    {
+        return _level_offsets.size() - 1;
+    }
+
+    /** The output block of the output node.
+     *
+     * @note Only valid after `execute()` has completed for the current cycle.
+     */
+    [[nodiscard]] audio_block const& output() const noexcept
+    {
+        hi_axiom(not _blocks.empty());
+        return _blocks.back();
+    }
+
+    /** Execute the program on the calling thread.
+     *
+     * @param cycle A number unique for this cycle, larger than the previous cycle.
+     * @param info The parameters of the block.
+     */
+    void execute(uint64_t cycle, block_info const& info) const noexcept
+    {
+        for (auto i = 0_uz; i != size(); ++i) {
+            execute_step(i, cycle, info);
+        }
+    }
+
+    /** Execute a single step of the program.
+     *
+     * The steps of a cycle may be executed by multiple threads. Each step must
+     * be executed exactly once, and the steps must be started in order; so that
+     * a step only waits on steps that are being executed by another thread.
+     *
+     * The caller must make sure that all threads have finished a cycle before
+     * the next cycle is started, see `wait()`.
+     *
+     * @param index The index of the step, less than `size()`.
+     * @param cycle A number unique for this cycle, larger than the previous cycle.
+     * @param info The parameters of the block.
+     */
+    void execute_step(std::size_t index, uint64_t cycle, block_info const& info) const noexcept
+    {
+        hi_axiom(index < size());
+        hi_axiom(info.num_samples <= _max_num_samples);
+
+        hilet& step = _steps[index];
+
+        for (auto i = step.first_input; i != step.first_input + step.num_inputs; ++i) {
+            hilet source = _input_sources[i];
+            wait_for_step(source, cycle);
+            _inputs[i] = _blocks[source];
+        }
+
+        auto& block = _blocks[index];
+        block.num_samples = info.num_samples;
+        block.sample_rate = info.sample_rate;
+        block.sample_count = info.sample_count;
+        block.time_stamp = info.time_stamp;
+        block.state = audio_block_state::normal;
+
+        step.node->process(std::span{_inputs}.subspan(step.first_input, step.num_inputs), block);
+
+        _done[index].store(cycle, std::memory_order::release);
+    }
+
+    /** Wait until every step of a cycle has been executed.
+     *
+     * The output node is the last step, and every other step is connected to it
+     * directly or indirectly; so when the output is completed all steps are.
+     *
+     * @param cycle The cycle to wait for.
+     */
+    void wait(uint64_t cycle) const noexcept
+    {
+        wait_for_step(size() - 1, cycle);
+    }
+
+private:
+    struct step_type {
+        std::shared_ptr<audio_node> node;
+        std::size_t level;
+        std::size_t first_input;
+        std::size_t num_inputs;
+    };
+
+    std::size_t _max_num_samples;
+
+    /** The nodes sorted by level.
+     */
+    std::vector<step_type> _steps;
+
+    /** The index of the first step of each level, and one past the last step.
+     */
+    std::vector<std::size_t> _level_offsets;
+
+    /** For each input of each step, the index of the step which is connected to it.
+     */
+    std::vector<std::size_t> _input_sources;
+
+    /** The storage of the samples of all output blocks.
+     */
+    std::vector<float> _samples;
+
+    /** The pointers to the channels of all output blocks.
+     */
+    std::vector<float *> _channels;
+
+    /** The output block of each step.
+     */
+    mutable std::vector<audio_block> _blocks;
+
+    /** The input blocks of each step, copied from the output blocks before the step is executed.
+     */
+    mutable std::vector<audio_block> _inputs;
+
+    /** The last cycle each step was completed.
+     */
+    std::unique_ptr<std::atomic<uint64_t>[]> _done;
+
+    void wait_for_step(std::size_t index, uint64_t cycle) const noexcept
+    {
+        // The producing step was started by another thread, which is processing it now.
+        while (_done[index].load(std::memory_order::acquire) != cycle) {
+            std::this_thread::yield();
+        }
+    }
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,369 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file audio/audio_graph_processor.hpp Defines audio_graph_processor.
+ * @ingroup audio
+ */
+
+#pragma once
+
+#include "audio_graph.hpp"
+#include "audio_block.hpp"
+#include "../telemetry/module.hpp"
+#include "../telemetry/duration_histogram.hpp"
+#include "../concurrency/concurrency.hpp"
+#include "../concurrency/rcu.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <vector>
+#include <atomic>
+#include <thread>
+#include <chrono>
+#include <stop_token>
+#include <string_view>
+#include <algorithm>
+#include <format>
+#include <optional>
+
+hi_export_module(hikogui.audio.audio_graph_processor);
+
+namespace hi { inline namespace v1 {
+
+/** Executes an audio graph on the audio thread.
+ *
+ * The audio graph is compiled on a normal thread by `update()` and the
+ * resulting program is swapped in using `rcu`. The audio thread reads the
+ * current program without locking or allocating; old programs are destroyed
+ * by a later call to `update()`.
+ *
+ * The nodes of the graph may be processed on a fixed set of worker threads
+ * together with the audio thread. The workers run at time-critical priority
+ * and sleep between blocks. They are best-effort: the threads claim the
+ * nodes one by one in order, and the audio thread processes every node that
+ * was not claimed by a worker that woke up in time. The audio thread only
+ * waits for a node that a worker is processing at that moment.
+ *
+ * The processor keeps statistics about the processing time, the jitter of
+ * the time stamps of the blocks and the number of blocks where the
+ * processing took longer than the duration of the block.
+ */
+hi_export class audio_graph_processor {
+public:
+    using duration = duration_histogram::duration;
+
+    ~audio_graph_processor()
+    {
+        for (auto& worker : _workers) {
+            worker.request_stop();
+        }
+        _wake.fetch_add(1, std::memory_order::release);
+        _wake.notify_all();
+        _workers.clear();
+    }
+
+    audio_graph_processor(audio_graph_processor const&) = delete;
+    audio_graph_processor(audio_graph_processor&&) = delete;
+    audio_graph_processor& operator=(audio_graph_processor const&) = delete;
+    audio_graph_processor& operator=(audio_graph_processor&&) = delete;
+
+    /** Create an audio graph processor.
+     *
+     * @param num_workers The number of worker threads, besides the audio thread.
+     */
+    explicit audio_graph_processor(std::size_t num_workers = 0)
+    {
+        _workers.reserve(num_workers);
+        for (auto i = 0_uz; i != num_workers; ++i) {
+            _workers.emplace_back([this, i](std::stop_token stop_token) {
+                set_thread_name(std::format("audio worker {}", i));
+                set_thread_time_critical();
+                worker_proc(std::move(stop_token));
+            });
+        }
+    }
+
+    [[nodiscard]] std::size_t num_workers() const noexcept
+    {
+        return _workers.size();
+    }
+
+    /** Compile a graph and use it for the next block.
+     *
+     * @note This function must not be called from the audio thread.
+     * @param graph The graph to compile.
+     * @param max_num_samples The maximum number of samples of a block;
+     *        larger blocks are processed in multiple parts.
+     * @throws operation_error When the graph has no output or contains a cycle.
+     */
+    void update(audio_graph const& graph, std::size_t max_num_samples)
+    {
+        // Compile before emplacing, so that an error leaves the current program in place.
+        auto program = audio_graph_program{graph, max_num_samples};
+        _program.emplace(std::move(program));
+    }
+
+    /** Stop processing the graph; the output becomes silent.
+     *
+     * @note This function must not be called from the audio thread.
+     */
+    void reset() noexcept
+    {
+        _program.reset();
+    }
+
+    /** Process a block of audio.
+     *
+     * The output of the graph is copied into the block; channels that
+     * the output node does not have are made silent.
+     *
+     * @note This function does not lock or allocate. With worker threads it
+     *       may wait for a node that a worker is processing, see the class
+     *       description.
+     * @param block The block to fill, usually from the audio device.
+     */
+    void process(audio_block& block) noexcept
+    {
+        hilet start = std::chrono::steady_clock::now();
+        add_jitter(block);
+
+        _program.lock();
+        if (auto const *program = _program.get()) {
+            auto offset = 0_uz;
+            while (offset != block.num_samples) {
+                hilet num_samples = std::min(block.num_samples - offset, program->max_num_samples());
+                hilet info = audio_graph_program::block_info{
+                    num_samples,
+                    block.sample_rate,
+                    block.sample_count + narrow_cast<int64_t>(offset),
+                    block.time_stamp + samples_to_duration(offset, block.sample_rate)};
+
+                execute(*program, info);
+
+                hilet& output = program->output();
+                for (auto c = 0_uz; c != block.num_channels; ++c) {
+                    auto *dst = block.samples[c] + offset;
+                    if (c < output.num_channels) {
+                        std::copy_n(output.samples[c], num_samples, dst);
+                    } else {
+                        std::fill_n(dst, num_samples, 0.0f);
+                    }
+                }
+                offset += num_samples;
+            }
+            block.state = audio_block_state::normal;
+
+        } else {
+            for (auto c = 0_uz; c != block.num_channels; ++c) {
+                std::fill_n(block.samples[c], block.num_samples, 0.0f);
+            }
+            block.state = audio_block_state::silent;
+        }
+        _program.unlock();
+
+        hilet processing_time = std::chrono::duration_cast<duration>(std::chrono::steady_clock::now() - start);
+        _processing_time.add(processing_time);
+        if (processing_time > samples_to_duration(block.num_samples, block.sample_rate)) {
+            _num_deadline_misses.fetch_add(1, std::memory_order::relaxed);
+        }
+    }
+
+    /** The histogram of the time it took to process a block.
+     */
+    [[nodiscard]] duration_histogram const& processing_time() const noexcept
+    {
+        return _processing_time;
+    }
+
+    /** The histogram of the difference between the actual and expected time between blocks.
+     *
+     * The expected time is calculated from the difference in `sample_count`
+     * of consecutive blocks, the actual time from the difference in `time_stamp`.
+     */
+    [[nodiscard]] duration_histogram const& jitter() const noexcept
+    {
+        return _jitter;
+    }
+
+    /** The number of blocks where processing took longer than the duration of the block.
+     */
+    [[nodiscard]] uint64_t num_deadline_misses() const noexcept
+    {
+        return _num_deadline_misses.load(std::memory_order::relaxed);
+    }
+
+    /** Clear the statistics.
+     */
+    void clear_statistics() noexcept
+    {
+        _processing_time.clear();
+        _jitter.clear();
+        _num_deadline_misses.store(0, std::memory_order::relaxed);
+    }
+
+    /** Log the statistics.
+     *
+     * @param name The name of the audio device.
+     */
+    void log(std::string_view name) const noexcept
+    {
+        hi_log_statistics(
+            "{} processing: n={} p50={} p99={} max={} deadline-misses={}",
+            name,
+            _processing_time.count(),
+            _processing_time.percentile(0.5),
+            _processing_time.percentile(0.99),
+            _processing_time.max(),
+            num_deadline_misses());
+        hi_log_statistics(
+            "{} jitter: n={} p50={} p99={} max={}",
+            name,
+            _jitter.count(),
+            _jitter.percentile(0.5),
+            _jitter.percentile(0.99),
+            _jitter.max());
+    }
+
+private:
+    rcu<audio_graph_program> _program;
+
+    std::vector<std::jthread> _workers;
+
+    /** The number of the last cycle, incremented for each execution of a program.
+     */
+    uint64_t _cycle = 0;
+
+    /** The cycle that the workers should execute, workers are woken up when it changes.
+     */
+    std::atomic<uint64_t> _wake = 0;
+
+    /** The next step to claim in the low 32 bits, and the low 32 bits of the cycle in the high 32 bits.
+     *
+     * A step can only be claimed when the cycle matches the cycle of the claiming thread,
+     * so that a worker that wakes up late does not claim a step of a later cycle.
+     */
+    std::atomic<uint64_t> _claim = 0;
+
+    /** The number of steps of the program of the cycle.
+     */
+    std::atomic<std::size_t> _cycle_size = 0;
+
+    /** The program and block of the cycle, only read after a step was claimed.
+     */
+    audio_graph_program const *_cycle_program = nullptr;
+    audio_graph_program::block_info _cycle_info = {};
+
+    duration_histogram _processing_time;
+    duration_histogram _jitter;
+    std::atomic<uint64_t> _num_deadline_misses = 0;
+
+    bool _has_previous_block = false;
+    int64_t _previous_sample_count = 0;
+    utc_nanoseconds _previous_time_stamp = {};
+
+    [[nodiscard]] constexpr static duration samples_to_duration(std::size_t num_samples, int sample_rate) noexcept
+    {
+        hi_axiom(sample_rate > 0);
+        return duration{narrow_cast<duration::rep>(num_samples * 1'000'000'000ULL / static_cast<uint64_t>(sample_rate))};
+    }
+
+    void add_jitter(audio_block const& block) noexcept
+    {
+        if (_has_previous_block and block.sample_rate > 0) {
+            hilet expected =
+                samples_to_duration(narrow_cast<std::size_t>(block.sample_count - _previous_sample_count), block.sample_rate);
+            hilet actual = std::chrono::duration_cast<duration>(block.time_stamp - _previous_time_stamp);
+            _jitter.add(actual > expected ? actual - expected : expected - actual);
+        }
+
+        _has_previous_block = true;
+        _previous_sample_count = block.sample_count;
+        _previous_time_stamp = block.time_stamp;
+    }
+
+    /** The value of `_claim` of the next step to claim in a cycle.
+     */
+    [[nodiscard]] constexpr static uint64_t make_claim(uint64_t cycle, uint64_t index) noexcept
+    {
+        return (cycle << 32) | index;
+    }
+
+    /** Claim the next step of a cycle.
+     *
+     * @param cycle The cycle that the calling thread is executing.
+     * @return The index of the claimed step, or `std::nullopt` when all steps of the cycle are claimed.
+     */
+    [[nodiscard]] std::optional<std::size_t> claim_step(uint64_t cycle) noexcept
+    {
+        auto claim = _claim.load(std::memory_order::acquire);
+        while (true) {
+            if ((claim >> 32) != (cycle & 0xffff'ffff)) {
+                return std::nullopt;
+            }
+
+            // A size of a later cycle is only seen after `_claim` was closed, so that the exchange below fails.
+            hilet index = static_cast<std::size_t>(claim & 0xffff'ffff);
+            if (index >= _cycle_size.load(std::memory_order::acquire)) {
+                return std::nullopt;
+            }
+
+            if (_claim.compare_exchange_weak(claim, claim + 1, std::memory_order::acq_rel, std::memory_order::acquire)) {
+                return index;
+            }
+        }
+    }
+
+    /** Execute the steps of a cycle until all steps are claimed.
+     */
+    void execute_steps(uint64_t cycle) noexcept
+    {
+        while (hilet index = claim_step(cycle)) {
+            _cycle_program->execute_step(*index, cycle, _cycle_info);
+        }
+    }
+
+    /** Execute a program on the audio thread and the worker threads.
+     */
+    void execute(audio_graph_program const& program, audio_graph_program::block_info const& info) noexcept
+    {
+        hilet cycle = ++_cycle;
+
+        if (_workers.empty() or program.num_levels() == program.size()) {
+            // There is nothing to process concurrently.
+            program.execute(cycle, info);
+            return;
+        }
+
+        _cycle_program = &program;
+        _cycle_info = info;
+        _cycle_size.store(program.size(), std::memory_order::release);
+        _claim.store(make_claim(cycle, 0), std::memory_order::release);
+        _wake.store(cycle, std::memory_order::release);
+        _wake.notify_all();
+
+        execute_steps(cycle);
+
+        // Close the cycle before the size of the next cycle is written.
+        _claim.store(make_claim(cycle, 0xffff'ffff), std::memory_order::release);
+
+        // The workers must be finished with the program before the next cycle or before the rcu is unlocked.
+        program.wait(cycle);
+    }
+
+    void worker_proc(std::stop_token stop_token) noexcept
+    {
+        auto cycle = uint64_t{0};
+        while (true) {
+            _wake.wait(cycle, std::memory_order::acquire);
+            if (stop_token.stop_requested()) {
+                return;
+            }
+
+            // When the worker wakes up late it may skip cycles, or find that all steps are already claimed.
+            cycle = _wake.load(std::memory_order::acquire);
+            execute_steps(cycle);
+        }
+    }
+};
+
+}} // namespace hi::v1
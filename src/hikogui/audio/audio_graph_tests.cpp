@@ -0,0 +1,282 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "audio_graph.hpp"
+#include "audio_graph_processor.hpp"
+#include "audio_fake_device_clock.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+#include <thread>
+#include <chrono>
+#include <atomic>
+
+using namespace hi;
+
+namespace {
+
+class constant_node : public audio_node {
+public:
+    std::atomic<float> value;
+
+    constant_node(float value) noexcept : value(value) {}
+
+    void process(std::span<audio_block const> inputs, audio_block& output) noexcept override
+    {
+        for (auto c = 0_uz; c != output.num_channels; ++c) {
+            std::fill_n(output.samples[c], output.num_samples, value.load(std::memory_order::relaxed));
+        }
+    }
+};
+
+/** Writes the sample count of each sample.
+ */
+class sample_count_node : public audio_node {
+public:
+    void process(std::span<audio_block const> inputs, audio_block& output) noexcept override
+    {
+        for (auto c = 0_uz; c != output.num_channels; ++c) {
+            for (auto i = 0_uz; i != output.num_samples; ++i) {
+                output.samples[c][i] = static_cast<float>(output.sample_count + static_cast<int64_t>(i));
+            }
+        }
+    }
+};
+
+class mix_node : public audio_node {
+public:
+    float gain;
+
+    mix_node(float gain = 1.0f) noexcept : gain(gain) {}
+
+    void process(std::span<audio_block const> inputs, audio_block& output) noexcept override
+    {
+        for (auto c = 0_uz; c != output.num_channels; ++c) {
+            for (auto i = 0_uz; i != output.num_samples; ++i) {
+                auto sum = 0.0f;
+                for (hilet& input : inputs) {
+                    hi_assert(input.num_samples == output.num_samples);
+                    sum += input.samples[std::min(c, input.num_channels - 1)][i];
+                }
+                output.samples[c][i] = sum * gain;
+            }
+        }
+    }
+};
+
+class sleep_node : public audio_node {
+public:
+    std::chrono::nanoseconds duration;
+
+    sleep_node(std::chrono::nanoseconds duration) noexcept : duration(duration) {}
+
+    void process(std::span<audio_block const> inputs, audio_block& output) noexcept override
+    {
+        std::this_thread::sleep_for(duration);
+        for (auto c = 0_uz; c != output.num_channels; ++c) {
+            std::fill_n(output.samples[c], output.num_samples, 0.0f);
+        }
+    }
+};
+
+} // namespace
+
+TEST(audio_graph, compile)
+{
+    auto graph = audio_graph{};
+    hilet a = graph.add(std::make_shared<constant_node>(1.0f), 1);
+    hilet b = graph.add(std::make_shared<constant_node>(2.0f), 1);
+    hilet unused = graph.add(std::make_shared<constant_node>(3.0f), 1);
+    hilet mix = graph.add(std::make_shared<mix_node>(), 2);
+    hilet out = graph.add(std::make_shared<mix_node>(0.5f), 2);
+    graph.connect(a, mix);
+    graph.connect(b, mix);
+    graph.connect(mix, out);
+    graph.connect(a, out);
+
+    ASSERT_THROW(audio_graph_program(graph, 64), operation_error);
+
+    graph.set_output(out);
+    hilet program = audio_graph_program(graph, 64);
+    ASSERT_EQ(program.size(), 4);
+    ASSERT_EQ(program.num_levels(), 3);
+    ASSERT_EQ(program.max_num_samples(), 64);
+
+    // A node that is not reachable from the output is ignored, even when it makes a cycle.
+    graph.connect(unused, unused);
+    ASSERT_NO_THROW(audio_graph_program(graph, 64));
+
+    graph.connect(out, a);
+    ASSERT_THROW(audio_graph_program(graph, 64), operation_error);
+}
+
+TEST(audio_graph, process)
+{
+    auto graph = audio_graph{};
+    hilet a = graph.add(std::make_shared<constant_node>(1.0f), 1);
+    hilet b = graph.add(std::make_shared<constant_node>(2.0f), 2);
+    hilet out = graph.add(std::make_shared<mix_node>(0.5f), 1);
+    graph.connect(a, out);
+    graph.connect(b, out);
+    graph.set_output(out);
+
+    auto processor = audio_graph_processor{};
+    auto clock = audio_fake_device_clock{48000, 100, 2};
+
+    // Without a graph the output is silent.
+    clock.tick(processor);
+    ASSERT_EQ(clock.block().state, audio_block_state::silent);
+
+    processor.update(graph, 32);
+    clock.run(processor, 3);
+    ASSERT_EQ(clock.block().state, audio_block_state::normal);
+    for (auto i = 0_uz; i != clock.block().num_samples; ++i) {
+        ASSERT_EQ(clock.block().channel(0)[i], 1.5f);
+        // The output node only has a single channel.
+        ASSERT_EQ(clock.block().channel(1)[i], 0.0f);
+    }
+}
+
+TEST(audio_graph, split_block)
+{
+    // Blocks larger than the maximum are processed in parts, with the sample count of each part.
+    auto graph = audio_graph{};
+    graph.set_output(graph.add(std::make_shared<sample_count_node>(), 1));
+
+    auto processor = audio_graph_processor{};
+    processor.update(graph, 16);
+
+    auto clock = audio_fake_device_clock{48000, 50, 1};
+    clock.run(processor, 2);
+    for (auto i = 0_uz; i != 50; ++i) {
+        ASSERT_EQ(clock.block().channel(0)[i], static_cast<float>(50 + i));
+    }
+}
+
+TEST(audio_graph, workers)
+{
+    // Many nodes in parallel, mixed by a tree of nodes.
+    auto graph = audio_graph{};
+    auto mixers = std::vector<audio_graph::node_id>{};
+    auto expected = 0.0f;
+    for (auto i = 0; i != 4; ++i) {
+        hilet mixer = graph.add(std::make_shared<mix_node>(), 2);
+        mixers.push_back(mixer);
+        for (auto j = 0; j != 8; ++j) {
+            hilet value = static_cast<float>(i * 8 + j);
+            graph.connect(graph.add(std::make_shared<constant_node>(value), 2), mixer);
+            expected += value;
+        }
+    }
+    hilet out = graph.add(std::make_shared<mix_node>(), 2);
+    for (hilet mixer : mixers) {
+        graph.connect(mixer, out);
+    }
+    graph.set_output(out);
+
+    for (auto num_workers = 0_uz; num_workers != 4; ++num_workers) {
+        auto processor = audio_graph_processor{num_workers};
+        ASSERT_EQ(processor.num_workers(), num_workers);
+        processor.update(graph, 64);
+
+        auto clock = audio_fake_device_clock{48000, 64, 2};
+        for (auto n = 0; n != 200; ++n) {
+            clock.tick(processor);
+            for (auto c = 0_uz; c != 2; ++c) {
+                for (auto i = 0_uz; i != 64; ++i) {
+                    ASSERT_EQ(clock.block().channel(c)[i], expected) << "num_workers=" << num_workers;
+                }
+            }
+        }
+    }
+}
+
+TEST(audio_graph, update_while_processing)
+{
+    auto processor = audio_graph_processor{2};
+
+    auto make_graph = [](float value) {
+        auto graph = audio_graph{};
+        hilet out = graph.add(std::make_shared<mix_node>(), 1);
+        for (auto i = 0; i != 4; ++i) {
+            graph.connect(graph.add(std::make_shared<constant_node>(value), 1), out);
+        }
+        graph.set_output(out);
+        return graph;
+    };
+    processor.update(make_graph(1.0f), 64);
+
+    auto stop = std::atomic<bool>{false};
+    auto num_errors = std::atomic<int>{0};
+    auto audio_thread = std::jthread{[&] {
+        auto clock = audio_fake_device_clock{48000, 64, 1};
+        while (not stop.load()) {
+            clock.tick(processor);
+            hilet value = clock.block().channel(0)[0];
+            if (value != 4.0f and value != 8.0f) {
+                ++num_errors;
+            }
+        }
+    }};
+
+    for (auto i = 0; i != 100; ++i) {
+        processor.update(make_graph(i % 2 == 0 ? 2.0f : 1.0f), 64);
+        std::this_thread::sleep_for(std::chrono::microseconds(100));
+    }
+    stop.store(true);
+    audio_thread.join();
+
+    ASSERT_EQ(num_errors.load(), 0);
+}
+
+TEST(audio_graph, jitter)
+{
+    auto graph = audio_graph{};
+    graph.set_output(graph.add(std::make_shared<constant_node>(0.0f), 1));
+
+    {
+        auto processor = audio_graph_processor{};
+        processor.update(graph, 64);
+
+        auto clock = audio_fake_device_clock{48000, 64, 1};
+        clock.run(processor, 100);
+
+        ASSERT_EQ(processor.jitter().count(), 99);
+        // Only rounding of the time stamps to nanoseconds.
+        ASSERT_LE(processor.jitter().max(), std::chrono::nanoseconds(1));
+    }
+
+    {
+        auto processor = audio_graph_processor{};
+        processor.update(graph, 64);
+
+        auto clock = audio_fake_device_clock{48000, 64, 1, std::chrono::microseconds(100)};
+        clock.run(processor, 100);
+
+        ASSERT_EQ(processor.jitter().count(), 99);
+        ASSERT_GT(processor.jitter().max(), std::chrono::microseconds(10));
+        ASSERT_LE(processor.jitter().max(), std::chrono::microseconds(200) + std::chrono::nanoseconds(1));
+    }
+}
+
+TEST(audio_graph, deadline_miss)
+{
+    auto graph = audio_graph{};
+    hilet slow = graph.add(std::make_shared<sleep_node>(std::chrono::milliseconds(3)), 1);
+    graph.set_output(slow);
+
+    auto processor = audio_graph_processor{};
+    processor.update(graph, 64);
+
+    // A block of 64 samples at 48 kHz takes 1.3 ms.
+    auto clock = audio_fake_device_clock{48000, 64, 1};
+    clock.run(processor, 5);
+    ASSERT_EQ(processor.num_deadline_misses(), 5);
+    ASSERT_EQ(processor.processing_time().count(), 5);
+    ASSERT_GE(processor.processing_time().min(), std::chrono::milliseconds(3));
+
+    processor.clear_statistics();
+    ASSERT_EQ(processor.num_deadline_misses(), 0);
+}
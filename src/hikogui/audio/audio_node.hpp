@@ -0,0 +1,53 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file audio/audio_node.hpp Defines audio_node.
+ * @ingroup audio
+ */
+
+#pragma once
+
+#include "audio_block.hpp"
+#include "../macros.hpp"
+#include <span>
+
+hi_export_module(hikogui.audio.audio_node);
+
+namespace hi { inline namespace v1 {
+
+/** A node in an audio graph.
+ *
+ * A node generates or processes audio. It reads the output blocks of the
+ * nodes connected to its inputs and writes into its own output block.
+ *
+ * @see audio_graph
+ */
+hi_export class audio_node {
+public:
+    virtual ~audio_node() = default;
+    audio_node() noexcept = default;
+    audio_node(audio_node const&) = delete;
+    audio_node(audio_node&&) = delete;
+    audio_node& operator=(audio_node const&) = delete;
+    audio_node& operator=(audio_node&&) = delete;
+
+    /** Process a block of samples.
+     *
+     * This function is called on a real-time thread; it must not allocate,
+     * lock or wait. When a graph is processed by multiple threads,
+     * different nodes are processed concurrently, but a single node is never
+     * processed by two threads at the same time.
+     *
+     * @param inputs The output blocks of the nodes connected to the inputs,
+     *               in the order the connections were made.
+     * @param output The output block of this node. The number of channels is set
+     *               when the node was added to the graph and the sample buffers
+     *               are pre-allocated; `num_samples`, `sample_rate`,
+     *               `sample_count` and `time_stamp` are set for the current block.
+     *               The samples are not cleared before the call.
+     */
+    virtual void process(std::span<audio_block const> inputs, audio_block& output) noexcept = 0;
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,125 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file audio/audio_sample_convert.hpp Kernels to convert between packed PCM samples and float samples.
+ * @ingroup audio
+ *
+ * These kernels are used by `audio_sample_packer` and `audio_sample_unpacker`.
+ * They convert the samples of a single channel; the samples of the channel
+ * are `stride` bytes apart, so that each channel of an interleaved buffer can
+ * be handled with a separate call.
+ *
+ * Integer samples are stored in `num_bytes` bytes in little or big endian
+ * byte order. Float samples are always 4 bytes.
+ */
+
+#pragma once
+
+#include "../SIMD/cpu_dispatch.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.audio.audio_sample_convert);
+
+namespace hi { inline namespace v1 {
+
+/** The signature of the audio_sample_unpack() kernel.
+ *
+ * Integer samples are aligned to the most significant bits of an `int32_t`
+ * before they are converted to float and multiplied by @a multiplier.
+ *
+ * @param dst The float samples.
+ * @param src The packed samples, the buffer must be at least
+ *            `(dst.size() - 1) * stride + num_bytes` bytes.
+ * @param stride The number of bytes between two samples.
+ * @param num_bytes The number of bytes of a packed sample: 1, 2, 3 or 4.
+ * @param big_endian The packed samples are in big endian byte order.
+ * @param is_float The packed samples are floats.
+ * @param multiplier The value to multiply the samples with, this includes the gain.
+ */
+using audio_sample_unpack_type = void(
+    std::span<float> dst,
+    std::byte const *src,
+    size_t stride,
+    size_t num_bytes,
+    bool big_endian,
+    bool is_float,
+    float multiplier);
+
+/** The signature of the audio_sample_pack() kernel.
+ *
+ * Integer samples are calculated as `(sample * gain + dither) * multiplier`,
+ * clamped and rounded to nearest; where the dither is a triangular
+ * distributed value between -254 and 254 multiplied by @a dither_multiplier.
+ * Every four samples take the next 64 bit value from the xorshift128+ random
+ * generator in @a dither_state; when @a dither_multiplier is zero the random
+ * generator is not used.
+ *
+ * Float samples are calculated as `sample * gain`.
+ *
+ * Only the bytes of the packed samples are written, the bytes in between
+ * are left alone.
+ *
+ * @param dst The packed samples, the buffer must be at least
+ *            `(src.size() - 1) * stride + num_bytes` bytes.
+ * @param src The float samples.
+ * @param stride The number of bytes between two samples.
+ * @param num_bytes The number of bytes of a packed sample: 1, 2, 3 or 4.
+ * @param big_endian The packed samples are in big endian byte order.
+ * @param is_float The packed samples are floats.
+ * @param gain The value to multiply the samples with, before dither is added.
+ * @param multiplier The value to multiply a normalized sample with to get the integer value.
+ * @param dither_state The state of the xorshift128+ random generator, must not be all zero.
+ * @param dither_multiplier The value to multiply the triangular distributed dither with.
+ */
+using audio_sample_pack_type = void(
+    std::byte *dst,
+    std::span<float const> src,
+    size_t stride,
+    size_t num_bytes,
+    bool big_endian,
+    bool is_float,
+    float gain,
+    float multiplier,
+    std::span<uint64_t, 2> dither_state,
+    float dither_multiplier);
+
+#if HI_PROCESSOR == HI_CPU_X64
+namespace cpu_x64v1 {
+audio_sample_unpack_type audio_sample_unpack;
+audio_sample_pack_type audio_sample_pack;
+} // namespace cpu_x64v1
+namespace cpu_x64v2 {
+audio_sample_unpack_type audio_sample_unpack;
+audio_sample_pack_type audio_sample_pack;
+} // namespace cpu_x64v2
+namespace cpu_x64v3 {
+audio_sample_unpack_type audio_sample_unpack;
+audio_sample_pack_type audio_sample_pack;
+} // namespace cpu_x64v3
+namespace cpu_x64v4 {
+audio_sample_unpack_type audio_sample_unpack;
+audio_sample_pack_type audio_sample_pack;
+} // namespace cpu_x64v4
+
+#define HI_X_cpu_dispatch(name) \
+    hi_export inline cpu_dispatch<name##_type> name = { \
+        cpu_x64v1::name, cpu_x64v2::name, cpu_x64v3::name, cpu_x64v4::name};
+#else
+namespace cpu_generic {
+audio_sample_unpack_type audio_sample_unpack;
+audio_sample_pack_type audio_sample_pack;
+} // namespace cpu_generic
+
+#define HI_X_cpu_dispatch(name) hi_export inline cpu_dispatch<name##_type> name{cpu_generic::name};
+#endif
+
+HI_X_cpu_dispatch(audio_sample_unpack)
+HI_X_cpu_dispatch(audio_sample_pack)
+#undef HI_X_cpu_dispatch
+
+}} // namespace hi::v1
@@ -0,0 +1,399 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file audio/audio_sample_convert_kernels.hpp The audio sample conversion kernels, compiled once for each CPU level.
+ *
+ * Only include this file from `SIMD/cpu_dispatch_kernels.hpp`.
+ *
+ * The AVX2 and AVX-512 variants gather the packed samples from any stride
+ * with 32 bit loads; the samples at the end of the buffer, where such a load
+ * would read past the last sample, are converted one at a time. Packed
+ * samples are written one sample at a time, so that the other channels of an
+ * interleaved buffer are never read or written, except when 32 bit samples
+ * can be stored with a single instruction.
+ *
+ * All variants do the same floating point operations in the same order so
+ * that the results, including the dither, are bit-exact between CPU levels.
+ */
+
+#pragma once
+
+#include "audio_sample_convert.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <array>
+#include <bit>
+#include <algorithm>
+#include <limits>
+#include <cmath>
+#include <cstring>
+#include <cstdint>
+#if HI_CPU_DISPATCH_LEVEL >= 1
+#include <immintrin.h>
+#endif
+
+#ifndef HI_CPU_DISPATCH_NAMESPACE
+#error "audio_sample_convert_kernels.hpp must be included through cpu_dispatch_kernels.hpp"
+#endif
+
+hi_cpu_dispatch_target_push()
+
+namespace hi { inline namespace v1 { namespace HI_CPU_DISPATCH_NAMESPACE {
+
+/** The next 64 bit random value from xorshift128+.
+ */
+[[nodiscard]] hi_force_inline uint64_t audio_sample_random(std::span<uint64_t, 2> state) noexcept
+{
+    auto s = state[0];
+    hilet t = state[1];
+
+    s ^= s << 23;
+    s ^= s >> 17;
+    s ^= t ^ (t >> 26);
+
+    state[0] = t;
+    state[1] = s;
+    return s + t;
+}
+
+/** The triangular distributed dither for one of the four samples of a random value.
+ *
+ * Two consecutive signed bytes of the random value are added together.
+ */
+[[nodiscard]] hi_force_inline int32_t audio_sample_tpdf(uint64_t random, size_t i) noexcept
+{
+    hilet a = static_cast<int8_t>(static_cast<uint8_t>(random >> (i * 16)));
+    hilet b = static_cast<int8_t>(static_cast<uint8_t>(random >> (i * 16 + 8)));
+    return int32_t{a} + int32_t{b};
+}
+
+/** Load a packed sample, aligned to the most significant bits.
+ */
+[[nodiscard]] hi_force_inline uint32_t audio_sample_load(std::byte const *p, size_t num_bytes, bool big_endian) noexcept
+{
+    auto r = uint32_t{0};
+    for (auto i = 0_uz; i != num_bytes; ++i) {
+        r <<= 8;
+        r |= static_cast<uint32_t>(p[big_endian ? i : num_bytes - i - 1]);
+    }
+    return r << (32 - num_bytes * 8);
+}
+
+/** Store the least significant bytes of a value as a packed sample.
+ */
+hi_force_inline void audio_sample_store(std::byte *p, uint32_t value, size_t num_bytes, bool big_endian) noexcept
+{
+    for (auto i = 0_uz; i != num_bytes; ++i) {
+        p[big_endian ? num_bytes - i - 1 : i] = static_cast<std::byte>(value);
+        value >>= 8;
+    }
+}
+
+/** Convert a float sample to an integer sample.
+ *
+ * The comparisons are done in the same way as the `minps` and `maxps` instructions.
+ */
+[[nodiscard]] hi_force_inline int32_t
+audio_sample_quantize(float sample, float gain, float dither, float multiplier, float maximum) noexcept
+{
+    auto x = sample * gain;
+    x = x + dither;
+    x = x * multiplier;
+    x = x < maximum ? x : maximum;
+    x = x > -maximum ? x : -maximum;
+    return static_cast<int32_t>(std::nearbyint(x));
+}
+
+#if HI_CPU_DISPATCH_LEVEL >= 3
+[[nodiscard]] hi_force_inline __m256i
+audio_sample_load8(std::byte const *p, __m256i offsets, size_t stride, size_t num_bytes, bool big_endian) noexcept
+{
+    auto r = stride == 4 ? _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p)) :
+                           _mm256_i32gather_epi32(reinterpret_cast<int const *>(p), offsets, 1);
+
+    if (big_endian) {
+        hilet bswap = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+        r = _mm256_shuffle_epi8(r, bswap);
+        // Remove the bytes of the next sample.
+        return _mm256_and_si256(r, _mm256_set1_epi32(std::bit_cast<int32_t>(0xffff'ffffU << (32 - num_bytes * 8))));
+    } else {
+        return _mm256_sll_epi32(r, _mm_cvtsi32_si128(static_cast<int>(32 - num_bytes * 8)));
+    }
+}
+
+hi_force_inline void audio_sample_store8(std::byte *p, __m256i values, size_t stride, size_t num_bytes, bool big_endian) noexcept
+{
+    if (big_endian) {
+        hilet bswap = _mm256_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12, 3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12);
+        // Align to the most significant bytes, so that the sample is in the first bytes after the swap.
+        values = _mm256_sll_epi32(values, _mm_cvtsi32_si128(static_cast<int>(32 - num_bytes * 8)));
+        values = _mm256_shuffle_epi8(values, bswap);
+    }
+
+    if (stride == 4 and num_bytes == 4) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(p), values);
+        return;
+    }
+
+    alignas(32) auto tmp = std::array<uint32_t, 8>{};
+    _mm256_store_si256(reinterpret_cast<__m256i *>(tmp.data()), values);
+    switch (num_bytes) {
+    case 1:
+        for (auto i = 0_uz; i != tmp.size(); ++i) {
+            std::memcpy(p + i * stride, &tmp[i], 1);
+        }
+        return;
+    case 2:
+        for (auto i = 0_uz; i != tmp.size(); ++i) {
+            std::memcpy(p + i * stride, &tmp[i], 2);
+        }
+        return;
+    case 3:
+        for (auto i = 0_uz; i != tmp.size(); ++i) {
+            std::memcpy(p + i * stride, &tmp[i], 3);
+        }
+        return;
+    case 4:
+        for (auto i = 0_uz; i != tmp.size(); ++i) {
+            std::memcpy(p + i * stride, &tmp[i], 4);
+        }
+        return;
+    default:
+        hi_no_default();
+    }
+}
+
+[[nodiscard]] hi_force_inline __m256 audio_sample_dither8(std::span<uint64_t, 2> state, float dither_multiplier) noexcept
+{
+    if (dither_multiplier == 0.0f) {
+        return _mm256_setzero_ps();
+    }
+
+    hilet r0 = audio_sample_random(state);
+    hilet r1 = audio_sample_random(state);
+    hilet rpdf = _mm256_cvtepi8_epi16(_mm_set_epi64x(std::bit_cast<int64_t>(r1), std::bit_cast<int64_t>(r0)));
+    hilet tpdf = _mm256_madd_epi16(rpdf, _mm256_set1_epi16(1));
+    return _mm256_mul_ps(_mm256_cvtepi32_ps(tpdf), _mm256_set1_ps(dither_multiplier));
+}
+#endif
+
+#if HI_CPU_DISPATCH_LEVEL >= 4
+[[nodiscard]] hi_force_inline __m512i
+audio_sample_load16(std::byte const *p, __m512i offsets, size_t stride, size_t num_bytes, bool big_endian) noexcept
+{
+    auto r = stride == 4 ? _mm512_loadu_si512(p) : _mm512_i32gather_epi32(offsets, p, 1);
+
+    if (big_endian) {
+        hilet bswap = _mm512_broadcast_i32x4(_mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+        r = _mm512_shuffle_epi8(r, bswap);
+        return _mm512_and_si512(r, _mm512_set1_epi32(std::bit_cast<int32_t>(0xffff'ffffU << (32 - num_bytes * 8))));
+    } else {
+        return _mm512_sll_epi32(r, _mm_cvtsi32_si128(static_cast<int>(32 - num_bytes * 8)));
+    }
+}
+
+hi_force_inline void
+audio_sample_store16(std::byte *p, __m512i values, __m512i offsets, size_t stride, size_t num_bytes, bool big_endian) noexcept
+{
+    if (big_endian) {
+        hilet bswap = _mm512_broadcast_i32x4(_mm_setr_epi8(3, 2, 1, 0, 7, 6, 5, 4, 11, 10, 9, 8, 15, 14, 13, 12));
+        values = _mm512_sll_epi32(values, _mm_cvtsi32_si128(static_cast<int>(32 - num_bytes * 8)));
+        values = _mm512_shuffle_epi8(values, bswap);
+    }
+
+    if (num_bytes == 4) {
+        if (stride == 4) {
+            _mm512_storeu_si512(p, values);
+        } else {
+            _mm512_i32scatter_epi32(p, offsets, values, 1);
+        }
+        return;
+    }
+
+    alignas(64) auto tmp = std::array<uint32_t, 16>{};
+    _mm512_store_si512(tmp.data(), values);
+    switch (num_bytes) {
+    case 1:
+        for (auto i = 0_uz; i != tmp.size(); ++i) {
+            std::memcpy(p + i * stride, &tmp[i], 1);
+        }
+        return;
+    case 2:
+        for (auto i = 0_uz; i != tmp.size(); ++i) {
+            std::memcpy(p + i * stride, &tmp[i], 2);
+        }
+        return;
+    case 3:
+        for (auto i = 0_uz; i != tmp.size(); ++i) {
+            std::memcpy(p + i * stride, &tmp[i], 3);
+        }
+        return;
+    default:
+        hi_no_default();
+    }
+}
+
+[[nodiscard]] hi_force_inline __m512 audio_sample_dither16(std::span<uint64_t, 2> state, float dither_multiplier) noexcept
+{
+    if (dither_multiplier == 0.0f) {
+        return _mm512_setzero_ps();
+    }
+
+    hilet r0 = audio_sample_random(state);
+    hilet r1 = audio_sample_random(state);
+    hilet r2 = audio_sample_random(state);
+    hilet r3 = audio_sample_random(state);
+    hilet r01 = _mm_set_epi64x(std::bit_cast<int64_t>(r1), std::bit_cast<int64_t>(r0));
+    hilet r23 = _mm_set_epi64x(std::bit_cast<int64_t>(r3), std::bit_cast<int64_t>(r2));
+    hilet rpdf = _mm512_cvtepi8_epi16(_mm256_setr_m128i(r01, r23));
+    hilet tpdf = _mm512_madd_epi16(rpdf, _mm512_set1_epi16(1));
+    return _mm512_mul_ps(_mm512_cvtepi32_ps(tpdf), _mm512_set1_ps(dither_multiplier));
+}
+#endif
+
+void audio_sample_unpack(
+    std::span<float> dst,
+    std::byte const *src,
+    size_t stride,
+    size_t num_bytes,
+    bool big_endian,
+    bool is_float,
+    float multiplier)
+{
+    hi_axiom(num_bytes >= 1 and num_bytes <= 4);
+    hi_axiom(stride >= num_bytes);
+    hi_axiom(not is_float or num_bytes == 4);
+
+    auto *hi_restrict d = dst.data();
+    hilet num_samples = dst.size();
+    auto i = 0_uz;
+
+#if HI_CPU_DISPATCH_LEVEL >= 3
+    // The number of samples that can be loaded with a 32 bit load without reading past the last sample.
+    hilet num_overrun = (4 - num_bytes + stride - 1) / stride;
+    hilet num_safe = num_samples > num_overrun ? num_samples - num_overrun : 0_uz;
+
+    if (stride <= std::numeric_limits<int32_t>::max() / 16) {
+        hilet stride_ = static_cast<int32_t>(stride);
+
+#if HI_CPU_DISPATCH_LEVEL >= 4
+        hilet offsets16 = _mm512_mullo_epi32(
+            _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32(stride_));
+        hilet multiplier16 = _mm512_set1_ps(multiplier);
+        for (; i + 16 <= num_safe; i += 16) {
+            hilet samples = audio_sample_load16(src + i * stride, offsets16, stride, num_bytes, big_endian);
+            hilet samples_ps = is_float ? _mm512_castsi512_ps(samples) : _mm512_cvtepi32_ps(samples);
+            _mm512_storeu_ps(d + i, _mm512_mul_ps(samples_ps, multiplier16));
+        }
+#endif
+
+        hilet offsets = _mm256_mullo_epi32(_mm256_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7), _mm256_set1_epi32(stride_));
+        hilet multiplier8 = _mm256_set1_ps(multiplier);
+        for (; i + 8 <= num_safe; i += 8) {
+            hilet samples = audio_sample_load8(src + i * stride, offsets, stride, num_bytes, big_endian);
+            hilet samples_ps = is_float ? _mm256_castsi256_ps(samples) : _mm256_cvtepi32_ps(samples);
+            _mm256_storeu_ps(d + i, _mm256_mul_ps(samples_ps, multiplier8));
+        }
+    }
+#endif
+
+    for (; i != num_samples; ++i) {
+        hilet sample = audio_sample_load(src + i * stride, num_bytes, big_endian);
+        hilet sample_f = is_float ? std::bit_cast<float>(sample) : static_cast<float>(std::bit_cast<int32_t>(sample));
+        d[i] = sample_f * multiplier;
+    }
+}
+
+void audio_sample_pack(
+    std::byte *dst,
+    std::span<float const> src,
+    size_t stride,
+    size_t num_bytes,
+    bool big_endian,
+    bool is_float,
+    float gain,
+    float multiplier,
+    std::span<uint64_t, 2> dither_state,
+    float dither_multiplier)
+{
+    hi_axiom(num_bytes >= 1 and num_bytes <= 4);
+    hi_axiom(stride >= num_bytes);
+    hi_axiom(not is_float or num_bytes == 4);
+
+    auto const *hi_restrict s = src.data();
+    hilet num_samples = src.size();
+    auto i = 0_uz;
+
+    // The largest float that can be converted to an int32_t.
+    hilet maximum = std::min(multiplier, 2147483520.0f);
+
+#if HI_CPU_DISPATCH_LEVEL >= 3
+    if (stride <= std::numeric_limits<int32_t>::max() / 16) {
+        hilet stride_ = static_cast<int32_t>(stride);
+
+#if HI_CPU_DISPATCH_LEVEL >= 4
+        hilet offsets16 = _mm512_mullo_epi32(
+            _mm512_setr_epi32(0, 1, 2, 3, 4, 5, 6, 7, 8, 9, 10, 11, 12, 13, 14, 15), _mm512_set1_epi32(stride_));
+        hilet gain16 = _mm512_set1_ps(gain);
+        hilet multiplier16 = _mm512_set1_ps(multiplier);
+        hilet maximum16 = _mm512_set1_ps(maximum);
+        hilet minimum16 = _mm512_set1_ps(-maximum);
+        for (; i + 16 <= num_samples; i += 16) {
+            auto x = _mm512_mul_ps(_mm512_loadu_ps(s + i), gain16);
+            if (is_float) {
+                audio_sample_store16(dst + i * stride, _mm512_castps_si512(x), offsets16, stride, num_bytes, big_endian);
+            } else {
+                x = _mm512_add_ps(x, audio_sample_dither16(dither_state, dither_multiplier));
+                x = _mm512_mul_ps(x, multiplier16);
+                x = _mm512_min_ps(x, maximum16);
+                x = _mm512_max_ps(x, minimum16);
+                audio_sample_store16(dst + i * stride, _mm512_cvtps_epi32(x), offsets16, stride, num_bytes, big_endian);
+            }
+        }
+#endif
+
+        hilet gain8 = _mm256_set1_ps(gain);
+        hilet multiplier8 = _mm256_set1_ps(multiplier);
+        hilet maximum8 = _mm256_set1_ps(maximum);
+        hilet minimum8 = _mm256_set1_ps(-maximum);
+        for (; i + 8 <= num_samples; i += 8) {
+            auto x = _mm256_mul_ps(_mm256_loadu_ps(s + i), gain8);
+            if (is_float) {
+                audio_sample_store8(dst + i * stride, _mm256_castps_si256(x), stride, num_bytes, big_endian);
+            } else {
+                x = _mm256_add_ps(x, audio_sample_dither8(dither_state, dither_multiplier));
+                x = _mm256_mul_ps(x, multiplier8);
+                x = _mm256_min_ps(x, maximum8);
+                x = _mm256_max_ps(x, minimum8);
+                audio_sample_store8(dst + i * stride, _mm256_cvtps_epi32(x), stride, num_bytes, big_endian);
+            }
+        }
+    }
+#endif
+
+    // The SIMD loops consume whole random values, so `i` is a multiple of four here.
+    auto random = uint64_t{0};
+    for (; i != num_samples; ++i) {
+        if (is_float) {
+            audio_sample_store(dst + i * stride, std::bit_cast<uint32_t>(s[i] * gain), num_bytes, big_endian);
+            continue;
+        }
+
+        auto dither = 0.0f;
+        if (dither_multiplier != 0.0f) {
+            if (i % 4 == 0) {
+                random = audio_sample_random(dither_state);
+            }
+            dither = static_cast<float>(audio_sample_tpdf(random, i % 4)) * dither_multiplier;
+        }
+
+        hilet sample = audio_sample_quantize(s[i], gain, dither, multiplier, maximum);
+        audio_sample_store(dst + i * stride, std::bit_cast<uint32_t>(sample), num_bytes, big_endian);
+    }
+}
+
+}}} // namespace hi::v1::HI_CPU_DISPATCH_NAMESPACE
+
+hi_cpu_dispatch_target_pop()
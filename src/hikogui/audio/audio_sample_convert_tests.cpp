@@ -0,0 +1,191 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "audio_sample_convert.hpp"
+#include "audio_sample_format.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+#include <array>
+#include <bit>
+#include <algorithm>
+
+using namespace hi;
+
+namespace {
+
+constexpr auto all_formats = std::array{
+    audio_sample_format::int16_le(),
+    audio_sample_format::int16_be(),
+    audio_sample_format::int20_le(),
+    audio_sample_format::int20_be(),
+    audio_sample_format::int24_le(),
+    audio_sample_format::int24_be(),
+    audio_sample_format::int32_le(),
+    audio_sample_format::int32_be(),
+    audio_sample_format::fix8_23_le(),
+    audio_sample_format::fix8_23_be(),
+    audio_sample_format::float32_le(),
+    audio_sample_format::float32_be()};
+
+constexpr auto all_sizes = std::array{0_uz, 1_uz, 3_uz, 4_uz, 7_uz, 8_uz, 9_uz, 16_uz, 17_uz, 33_uz, 100_uz};
+
+[[nodiscard]] std::vector<size_t> make_strides(audio_sample_format format)
+{
+    // Mono, stereo, an odd number of channels, and 32 channels.
+    return {format.num_bytes, format.num_bytes * 2_uz, format.num_bytes * 3_uz + 1, format.num_bytes * 32_uz};
+}
+
+[[nodiscard]] std::vector<std::byte> make_packed(size_t size)
+{
+    auto r = std::vector<std::byte>(size);
+    for (auto i = 0_uz; i != size; ++i) {
+        r[i] = static_cast<std::byte>(i * 73 + 11);
+    }
+    return r;
+}
+
+[[nodiscard]] std::vector<float> make_samples(size_t size)
+{
+    auto r = std::vector<float>(size);
+    for (auto i = 0_uz; i != size; ++i) {
+        // Include samples beyond -1.0 and 1.0 to test the clamping.
+        r[i] = static_cast<float>(static_cast<int>(i * 7919 % 2501) - 1250) / 1000.0f;
+    }
+    return r;
+}
+
+[[nodiscard]] size_t packed_size(size_t num_samples, size_t stride, audio_sample_format format)
+{
+    return num_samples == 0 ? 0 : (num_samples - 1) * stride + format.num_bytes;
+}
+
+} // namespace
+
+TEST(audio_sample_convert, unpack)
+{
+    for (hilet format : all_formats) {
+        for (hilet stride : make_strides(format)) {
+            for (hilet num_samples : all_sizes) {
+                hilet packed = make_packed(packed_size(num_samples, stride, format));
+                hilet multiplier = format.unpack_multiplier() * 0.5f;
+
+                auto expected = std::vector<float>(num_samples);
+                hi::audio_sample_unpack.get(0)(
+                    expected, packed.data(), stride, format.num_bytes, format.endian == std::endian::big, format.is_float, multiplier);
+
+                for (auto level = 1; level <= hi::cpu_dispatch_level(); ++level) {
+                    auto samples = std::vector<float>(num_samples);
+                    hi::audio_sample_unpack.get(level)(
+                        samples, packed.data(), stride, format.num_bytes, format.endian == std::endian::big, format.is_float, multiplier);
+
+                    for (auto i = 0_uz; i != num_samples; ++i) {
+                        ASSERT_EQ(std::bit_cast<uint32_t>(samples[i]), std::bit_cast<uint32_t>(expected[i]))
+                            << "level=" << level << " stride=" << stride << " index=" << i;
+                    }
+                }
+            }
+        }
+    }
+}
+
+TEST(audio_sample_convert, pack)
+{
+    for (hilet format : all_formats) {
+        for (hilet stride : make_strides(format)) {
+            for (hilet num_samples : all_sizes) {
+                hilet samples = make_samples(num_samples);
+                hilet multiplier = format.is_float ? 1.0f :
+                                                     format.pack_multiplier() / static_cast<float>(1_uz << (32 - format.num_bytes * 8));
+                hilet dither_multiplier = format.is_float ? 0.0f : 1.0f / (static_cast<float>((1_uz << format.num_bits) - 1) * 254.0f);
+
+                auto expected = make_packed(packed_size(num_samples, stride, format));
+                auto expected_state = std::array<uint64_t, 2>{0x0123'4567'89ab'cdef, 0xfedc'ba98'7654'3210};
+                hi::audio_sample_pack.get(0)(
+                    expected.data(),
+                    samples,
+                    stride,
+                    format.num_bytes,
+                    format.endian == std::endian::big,
+                    format.is_float,
+                    0.75f,
+                    multiplier,
+                    expected_state,
+                    dither_multiplier);
+
+                // Bytes between the samples are not modified.
+                hilet original = make_packed(expected.size());
+                for (auto i = 0_uz; i != expected.size(); ++i) {
+                    if (i % stride >= format.num_bytes) {
+                        ASSERT_EQ(expected[i], original[i]);
+                    }
+                }
+
+                for (auto level = 1; level <= hi::cpu_dispatch_level(); ++level) {
+                    auto packed = make_packed(expected.size());
+                    auto state = std::array<uint64_t, 2>{0x0123'4567'89ab'cdef, 0xfedc'ba98'7654'3210};
+                    hi::audio_sample_pack.get(level)(
+                        packed.data(),
+                        samples,
+                        stride,
+                        format.num_bytes,
+                        format.endian == std::endian::big,
+                        format.is_float,
+                        0.75f,
+                        multiplier,
+                        state,
+                        dither_multiplier);
+
+                    ASSERT_EQ(packed, expected) << "level=" << level << " stride=" << stride << " size=" << num_samples;
+                    ASSERT_EQ(state, expected_state) << "level=" << level;
+                }
+            }
+        }
+    }
+}
+
+TEST(audio_sample_convert, round_trip)
+{
+    for (hilet format : all_formats) {
+        hilet stride = format.num_bytes * 3_uz;
+        hilet multiplier =
+            format.is_float ? 1.0f : format.pack_multiplier() / static_cast<float>(1_uz << (32 - format.num_bytes * 8));
+        hilet dither_multiplier = format.is_float ? 0.0f : 1.0f / (static_cast<float>((1_uz << format.num_bits) - 1) * 254.0f);
+        // Two quantization steps, but not smaller than the precision of a float.
+        hilet max_diff = format.is_float ? 0.0f : std::max(2.0f / static_cast<float>((1_uz << format.num_bits) - 1), 0x1p-22f);
+
+        for (auto level = 0; level <= hi::cpu_dispatch_level(); ++level) {
+            hilet samples = make_samples(100);
+
+            auto packed = std::vector<std::byte>(packed_size(samples.size(), stride, format));
+            auto state = std::array<uint64_t, 2>{1, 2};
+            hi::audio_sample_pack.get(level)(
+                packed.data(),
+                samples,
+                stride,
+                format.num_bytes,
+                format.endian == std::endian::big,
+                format.is_float,
+                1.0f,
+                multiplier,
+                state,
+                dither_multiplier);
+
+            auto unpacked = std::vector<float>(samples.size());
+            hi::audio_sample_unpack.get(level)(
+                unpacked,
+                packed.data(),
+                stride,
+                format.num_bytes,
+                format.endian == std::endian::big,
+                format.is_float,
+                format.unpack_multiplier());
+
+            for (auto i = 0_uz; i != samples.size(); ++i) {
+                hilet expected = format.is_float ? samples[i] : std::clamp(samples[i], -1.0f, 1.0f);
+                ASSERT_NEAR(unpacked[i], expected, max_diff) << "level=" << level << " index=" << i;
+            }
+        }
+    }
+}
@@ -5,7 +5,6 @@
 #pragma once
 
 #include "../utility/utility.hpp"
-#include "../SIMD/module.hpp"
 #include "../macros.hpp"
 #include <bit>
 
@@ -209,117 +208,6 @@ hi_export struct audio_sample_format {
         return 1.0f / pack_multiplier();
     }
 
-    /** The number of packed samples that are handled in a single 128 bit load or store.
-     * Always one of: 1, 2 or 4.
-     */
-    [[nodiscard]] std::size_t num_samples_per_chunk(std::size_t stride) const noexcept
-    {
-        auto r = narrow_cast<int>(std::bit_floor((((16u - num_bytes) / stride) & 3) + 1));
-        hi_assert(r == 1 or r == 2 or r == 4);
-        return r;
-    }
-
-    /** The number of bytes to advance to the next chunk to be loaded or stored.
-     */
-    [[nodiscard]] std::size_t chunk_stride(std::size_t stride) const noexcept
-    {
-        return stride * num_samples_per_chunk(stride);
-    }
-
-    /** The number of chunks to load or store to handle 4 samples.
-     */
-    [[nodiscard]] std::size_t num_chunks_per_quad(std::size_t stride) const noexcept
-    {
-        return 4 / num_samples_per_chunk(stride);
-    }
-
-    /** Calculate the number of 4 sample-quads can be handled as chunked loads and stores.
-     */
-    [[nodiscard]] std::size_t num_fast_quads(std::size_t stride, std::size_t num_samples) const noexcept
-    {
-        hilet src_buffer_size = (num_samples - 1) * stride + num_bytes;
-        if (src_buffer_size < 16) {
-            return 0;
-        }
-
-        hilet num_chunks = (src_buffer_size - 16) / chunk_stride(stride) + 1;
-        return num_chunks / num_chunks_per_quad(stride);
-    }
-
-    /** Return a shuffle indices for loading samples into 32 bit integers.
-     */
-    [[nodiscard]] i8x16 load_shuffle_indices(std::size_t stride) const noexcept
-    {
-        hilet num_samples = num_samples_per_chunk(stride);
-
-        // Indices set to -1 result in a zero after a byte shuffle.
-        auto r = i8x16::broadcast(-1);
-        for (int sample_nr = 0; sample_nr != num_samples; ++sample_nr) {
-            hilet sample_src_offset = sample_nr * stride;
-
-            // Offset the samples to the highest elements in the i32x4 vector.
-            // By shifting the samples from high to low together with 'OR' we can
-            // concatenate 1, 2, or 4 loads into a single 4 samples vector.
-            // Where the sample in the lowest index is the first sample in memory.
-            hilet sample_dst_offset = (sample_nr + (4 - num_samples)) * 4;
-
-            // Bytes are ordered least to most significant.
-            for (int byte_nr = 0; byte_nr != num_bytes; ++byte_nr) {
-                hilet src_offset = sample_src_offset + (endian == std::endian::little ? byte_nr : num_bytes - byte_nr - 1);
-
-                // Offset the bytes so they become aligned to the left.
-                hilet dst_offset = sample_dst_offset + byte_nr + (4 - num_bytes);
-
-                r[dst_offset] = narrow_cast<int8_t>(src_offset);
-            }
-        }
-
-        return r;
-    }
-
-    /** Return a shuffle indices for storing 32 bit samples into packed samples.
-     */
-    [[nodiscard]] i8x16 store_shuffle_indices(std::size_t stride) const noexcept
-    {
-        hilet num_samples = num_samples_per_chunk(stride);
-
-        // Indices set to -1 result in a zero after a byte shuffle.
-        auto r = i8x16::broadcast(-1);
-        for (int sample_nr = 0; sample_nr != num_samples; ++sample_nr) {
-            hilet sample_dst_offset = sample_nr * stride;
-
-            // Offset the samples to the lowest elements in the i32x4 vector.
-            // By shifting the samples from high to low we can extract 1, 2, or 4 stores
-            // from a single 4 samples vector.
-            // Where the sample at the lowest index becomes the first sample in memory.
-            hilet sample_src_offset = sample_nr * 4;
-
-            // Bytes are ordered least to most significant.
-            for (int byte_nr = 0; byte_nr != num_bytes; ++byte_nr) {
-                hilet dst_offset = sample_dst_offset + (endian == std::endian::little ? byte_nr : num_bytes - byte_nr - 1);
-
-                // Offset the bytes so they become aligned to the left.
-                hilet src_offset = sample_src_offset + byte_nr + (4 - num_bytes);
-
-                r[dst_offset] = narrow_cast<int8_t>(src_offset);
-            }
-        }
-
-        return r;
-    }
-
-    /** Return a shuffle indices to shift previous loaded samples for concatenation.
-     */
-    [[nodiscard]] i8x16 concat_shuffle_indices(std::size_t stride) const noexcept
-    {
-        hilet num_samples = num_samples_per_chunk(stride);
-
-        // The bytes are shifted right.
-        hilet byte_shift = (4 - num_samples) * 4;
-
-        return i8x16::byte_srl_shuffle_indices(narrow_cast<unsigned int>(byte_shift));
-    }
-
     /** Is the audio sample format valid.
      */
     [[nodiscard]] constexpr bool holds_invariant() const noexcept
@@ -5,11 +5,14 @@
 #pragma once
 
 #include "audio_sample_format.hpp"
+#include "audio_sample_convert.hpp"
 #include "../utility/utility.hpp"
-#include "../SIMD/module.hpp"
-#include "../random/random.hpp"
+#include "../random/seed.hpp"
 #include "../macros.hpp"
 #include <cstddef>
+#include <cstdint>
+#include <array>
+#include <span>
 #include <bit>
 
 hi_export_module(hikogui.audio.audio_sample_packer);
@@ -23,178 +26,62 @@ public:
      * from one audio-proc to the next, or for each channel in a group of
      * interleaved channels.
      *
+     * Integer samples are dithered with a triangular distribution of
+     * plus or minus one quantization step.
+     *
      * @param format The sample format.
      * @param stride Number of bytes to step for the next sample of the same channel.
      */
-    audio_sample_packer(audio_sample_format format, std::size_t stride) noexcept :
-        _dither(format.num_bits), _format(format), _stride(stride)
+    audio_sample_packer(audio_sample_format format, std::size_t stride) noexcept : _format(format), _stride(stride)
     {
-        _store_shuffle_indices = format.store_shuffle_indices(stride);
-        _concat_shuffle_indices = format.concat_shuffle_indices(stride);
+        hi_assert(stride >= format.num_bytes);
 
-        _multiplier = f32x4::broadcast(format.pack_multiplier());
+        if (not format.is_float) {
+            // The multiplier for a sample that is aligned to the least significant bits.
+            _multiplier = format.pack_multiplier() / static_cast<float>(1_uz << (32 - format.num_bytes * 8));
 
-        _num_chunks_per_quad = format.num_chunks_per_quad(stride);
-        _chunk_stride = format.chunk_stride(stride);
+            // The triangular dither has a range of -254 to 254.
+            _dither_multiplier = 1.0f / (static_cast<float>((1_uz << format.num_bits) - 1) * 254.0f);
+        }
 
-        _direction = format.endian == std::endian::little ? 1 : -1;
-        _start_byte = format.endian == std::endian::little ? 0 : format.num_bytes - 1;
-        _align_shift = 32 - format.num_bytes * 8;
+        // xorshift128+ does not work with an all zero state.
+        while (_dither_state[0] == 0 and _dither_state[1] == 0) {
+            _dither_state = seed<std::array<uint64_t, 2>>{}();
+        }
     }
 
-    /** Unpack samples.
+    /** Pack samples.
      *
      * @param src A pointer to an array of floating point samples of a single channel.
      * @param dst A pointer to a byte array to store the packed samples into.
      * @param num_samples Number of samples.
+     * @param gain The gain to apply to the samples before they are dithered and packed.
      */
-    void operator()(float const *hi_restrict src, std::byte *hi_restrict dst, std::size_t num_samples) const noexcept
+    void operator()(float const *hi_restrict src, std::byte *hi_restrict dst, std::size_t num_samples, float gain = 1.0f)
+        const noexcept
     {
         hi_assert(src != nullptr);
         hi_assert(dst != nullptr);
 
-        // Calculate a conservative number of samples that can be copied quickly
-        // without overflowing the dst buffer.
-        hilet src_end = src + num_samples;
-        hilet src_fast_end = src + _format.num_fast_quads(_stride, num_samples) * 4;
-
-        hilet store_shuffle_indices = _store_shuffle_indices;
-        hilet concat_shuffle_indices = _concat_shuffle_indices;
-        hilet num_chunks_per_quad = _num_chunks_per_quad;
-        hilet chunk_stride = _chunk_stride;
-
-        if (_format.is_float) {
-            while (src != src_fast_end) {
-                hilet float_samples = load_samples(src);
-                hilet int_samples = i8x16::cast_from(float_samples);
-                store_samples(int_samples, dst, store_shuffle_indices, concat_shuffle_indices, num_chunks_per_quad, chunk_stride);
-            }
-            while (src != src_end) {
-                hilet float_sample = load_sample(src);
-                hilet int_sample = std::bit_cast<int32_t>(float_sample);
-                store_sample(int_sample, dst, _stride, _format.num_bytes, _direction, _start_byte, _align_shift);
-            }
-
-        } else {
-            hilet multiplier = _multiplier;
-            hilet one = f32x4::broadcast(1);
-            hilet min_one = f32x4::broadcast(-1);
-
-            auto dither = _dither;
-
-            while (src != src_fast_end) {
-                hilet dither_value = dither.next();
-
-                auto float_samples = load_samples(src);
-                float_samples += dither_value;
-                float_samples = min(float_samples, one);
-                float_samples = max(float_samples, min_one);
-                float_samples *= multiplier;
-                hilet int_samples = i8x16::cast_from(static_cast<i32x4>(float_samples));
-                store_samples(int_samples, dst, store_shuffle_indices, concat_shuffle_indices, num_chunks_per_quad, chunk_stride);
-            }
-            while (src != src_end) {
-                hilet dither_value = dither.next();
-
-                auto float_sample = f32x4::broadcast(load_sample(src));
-                float_sample += dither_value;
-                float_sample = min(float_sample, one);
-                float_sample = max(float_sample, min_one);
-                float_sample *= multiplier;
-                hilet int_sample = get<0>(static_cast<i32x4>(float_sample));
-                store_sample(int_sample, dst, _stride, _format.num_bytes, _direction, _start_byte, _align_shift);
-            }
-
-            _dither = dither;
-        }
+        audio_sample_pack(
+            dst,
+            std::span{src, num_samples},
+            _stride,
+            _format.num_bytes,
+            _format.endian == std::endian::big,
+            _format.is_float,
+            gain,
+            _multiplier,
+            _dither_state,
+            _dither_multiplier);
     }
 
 private:
-    i8x16 _store_shuffle_indices;
-    i8x16 _concat_shuffle_indices;
-    f32x4 _multiplier;
-    mutable dither _dither;
     audio_sample_format _format;
-    std::size_t _num_chunks_per_quad;
     std::size_t _stride;
-    std::size_t _chunk_stride;
-    int _direction;
-    int _start_byte;
-    int _align_shift;
-
-    static void store_sample(
-        int32_t int_sample,
-        std::byte *& dst,
-        std::size_t stride,
-        int num_bytes,
-        int direction,
-        int start_byte,
-        int align_shift) noexcept
-    {
-        int_sample >>= align_shift;
-
-        hi_axiom(dst != nullptr);
-        auto p = dst + start_byte;
-        do {
-            *p = static_cast<std::byte>(int_sample);
-            p += direction;
-            int_sample >>= 8;
-        } while (--num_bytes);
-
-        dst += stride;
-    }
-
-    [[nodiscard]] static void
-    store_samples(i8x16 int_samples, std::byte *& dst, i8x16 store_shuffle_indices, std::size_t stride) noexcept
-    {
-        hi_axiom(dst != nullptr);
-        hi_axiom(stride > 0);
-
-        // Read out the samples from the other channels, that where packed before.
-        auto tmp = i8x16::load(dst);
-
-        hilet packed_samples = permute(int_samples, store_shuffle_indices);
-
-        // When the shuffle-index is -1 use the samples from the other channels.
-        tmp = blend(packed_samples, tmp, store_shuffle_indices);
-
-        // Store back the samples from this channel and from the other channel.
-        tmp.store(dst);
-
-        dst += stride;
-    }
-
-    [[nodiscard]] static void store_samples(
-        i8x16 int_samples,
-        std::byte *& dst,
-        i8x16 store_shuffle_indices,
-        i8x16 concat_shuffle_indices,
-        std::size_t num_chunks,
-        std::size_t stride) noexcept
-    {
-        hi_assert(dst != nullptr);
-        hi_assert(num_chunks > 0 and num_chunks <= 4);
-        hi_assert(stride > 0);
-
-        do {
-            store_samples(int_samples, dst, store_shuffle_indices, stride);
-            int_samples = permute(int_samples, concat_shuffle_indices);
-            // The result of the last shuffle is not used, so will be pipelined by the CPU.
-        } while (--num_chunks);
-    }
-
-    [[nodiscard]] static float load_sample(float const *& src) noexcept
-    {
-        hi_axiom(src != nullptr);
-        return *(src++);
-    }
-
-    [[nodiscard]] static f32x4 load_samples(float const *& src) noexcept
-    {
-        hilet r = f32x4::load(src);
-        src += 4;
-        return r;
-    }
+    float _multiplier = 1.0f;
+    float _dither_multiplier = 0.0f;
+    mutable std::array<uint64_t, 2> _dither_state = {};
 };
 
 }} // namespace hi::inline v1
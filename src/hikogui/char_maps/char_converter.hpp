@@ -8,10 +8,13 @@
 
 #pragma once
 
+#include "utf_transcode.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
 #include <string>
 #include <string_view>
+#include <iterator>
+#include <concepts>
 #if defined(HI_HAS_SSE2)
 #include <emmintrin.h>
 #endif
@@ -137,7 +140,7 @@ public:
             using std::size;
             std::memcpy(std::addressof(*begin(r)), std::addressof(*cbegin(src)), size(src) * sizeof(from_char_type));
         } else {
-            _convert(cbegin(src), cend(src), begin(r));
+            _convert(cbegin(src), cend(src), begin(r), end(r));
         }
         return r;
     }
@@ -153,6 +156,7 @@ public:
     [[nodiscard]] constexpr OutRange convert(It first, EndIt last) const noexcept
     {
         using std::begin;
+        using std::end;
 
         hilet[size, valid] = _size(first, last);
         auto r = OutRange{};
@@ -166,7 +170,7 @@ public:
 
             std::memcpy(std::addressof(*begin(r)), std::addressof(*first), std::distance(first, last) * sizeof(from_char_type));
         } else {
-            _convert(first, last, begin(r));
+            _convert(first, last, begin(r), end(r));
         }
         return r;
     }
@@ -229,6 +233,78 @@ private:
     constexpr static bool _has_read_ascii_chunk16 = true;
     constexpr static bool _has_write_ascii_chunk16 = true;
 
+    constexpr static bool _from_utf = From == "utf-8" or From == "utf-16" or From == "utf-32";
+    constexpr static bool _to_utf = To == "utf-8" or To == "utf-16" or To == "utf-32";
+
+    /** Check if the UTF kernels can be used on a range of code-units in memory.
+     */
+    template<typename It, typename EndIt, typename CharT>
+    constexpr static bool _is_utf_range =
+        std::contiguous_iterator<It> and std::sized_sentinel_for<EndIt, It> and std::same_as<std::iter_value_t<It>, CharT>;
+
+    /** Count the correctly encoded UTF code-units with the UTF kernels.
+     */
+    template<typename It, typename EndIt>
+    constexpr void _size_utf(It& it, EndIt last, size_t& count) const noexcept
+    {
+        if constexpr (_from_utf and _to_utf and _is_utf_range<It, EndIt, from_char_type>) {
+            if (not std::is_constant_evaluated()) {
+                hilet ptr = std::to_address(it);
+                hilet size = narrow_cast<size_t>(last - it);
+
+                auto r = utf_scan_result{};
+                if constexpr (From == "utf-8") {
+                    r = utf8_scan(ptr, size);
+                } else if constexpr (From == "utf-16") {
+                    r = utf16_scan(ptr, size);
+                } else {
+                    r = utf32_scan(ptr, size);
+                }
+
+                if constexpr (To == "utf-8") {
+                    count += r.utf8_size;
+                } else if constexpr (To == "utf-16") {
+                    count += r.utf16_size;
+                } else {
+                    count += r.utf32_size;
+                }
+                it += r.size;
+            }
+        }
+    }
+
+    /** Convert the correctly encoded UTF code-units with the UTF kernels.
+     */
+    template<typename SrcIt, typename SrcEndIt, typename DstIt, typename DstEndIt>
+    void _convert_utf(SrcIt& src, SrcEndIt src_last, DstIt& dst, DstEndIt dst_last) const noexcept
+    {
+        if constexpr (
+            _from_utf and _to_utf and From != To and _is_utf_range<SrcIt, SrcEndIt, from_char_type> and
+            _is_utf_range<DstIt, DstEndIt, to_char_type>) {
+            hilet src_ptr = std::to_address(src);
+            hilet src_size = narrow_cast<size_t>(src_last - src);
+            hilet dst_ptr = std::to_address(dst);
+            hilet dst_size = narrow_cast<size_t>(dst_last - dst);
+
+            auto r = utf_transcode_result{};
+            if constexpr (From == "utf-8" and To == "utf-16") {
+                r = utf8_to_utf16(src_ptr, src_size, dst_ptr, dst_size);
+            } else if constexpr (From == "utf-8") {
+                r = utf8_to_utf32(src_ptr, src_size, dst_ptr, dst_size);
+            } else if constexpr (From == "utf-16" and To == "utf-8") {
+                r = utf16_to_utf8(src_ptr, src_size, dst_ptr, dst_size);
+            } else if constexpr (From == "utf-16") {
+                r = utf16_to_utf32(src_ptr, src_size, dst_ptr, dst_size);
+            } else if constexpr (To == "utf-8") {
+                r = utf32_to_utf8(src_ptr, src_size, dst_ptr, dst_size);
+            } else {
+                r = utf32_to_utf16(src_ptr, src_size, dst_ptr, dst_size);
+            }
+            src += r.src_size;
+            dst += r.dst_size;
+        }
+    }
+
     template<typename It, typename EndIt>
     [[nodiscard]] constexpr void _size_ascii(It& it, EndIt last, size_t& count) const noexcept
     {
@@ -282,9 +358,10 @@ private:
         auto count = 0_uz;
         auto valid = true;
         while (true) {
-            // This loop toggles between converting chunks of ASCII characters and converting
-            // a single non-ASCII character.
+            // This loop toggles between counting chunks of ASCII characters, counting
+            // correctly encoded UTF and counting a single character.
             _size_ascii(it, last, count);
+            _size_utf(it, last, count);
 
             if (it == last) {
                 break;
@@ -301,13 +378,14 @@ private:
         return {count, valid};
     }
 
-    template<typename SrcIt, typename SrcEndIt, typename DstIt>
-    void _convert(SrcIt src, SrcEndIt src_last, DstIt dst) const noexcept
+    template<typename SrcIt, typename SrcEndIt, typename DstIt, typename DstEndIt>
+    void _convert(SrcIt src, SrcEndIt src_last, DstIt dst, DstEndIt dst_last) const noexcept
     {
         while (true) {
-            // This loop toggles between converting chunks of ASCII characters and converting
-            // a single non-ASCII character.
+            // This loop toggles between converting chunks of ASCII characters, converting
+            // correctly encoded UTF and converting a single character.
             _convert_ascii(src, src_last, dst);
+            _convert_utf(src, src_last, dst, dst_last);
 
             if (src == src_last) {
                 break;
@@ -12,6 +12,7 @@
 #include "utf_8.hpp"
 #include "utf_16.hpp"
 #include "utf_32.hpp"
+#include "utf_transcode.hpp"
 
 namespace hi {
 inline namespace v1 {
@@ -0,0 +1,155 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file char_maps/utf_transcode.hpp Kernels to validate and convert between UTF-8, UTF-16 and UTF-32.
+ * @ingroup char_maps
+ *
+ * These kernels are used by `char_converter` when converting between the
+ * Unicode encodings. Each kernel handles the longest prefix of the text
+ * that is correctly encoded, and stops before the first code-unit that is
+ * incorrectly encoded or that is part of an incomplete code-point at the end
+ * of the text. The caller continues with the code-point-at-a-time
+ * conversion of the `char_map`, which also handles the replacement of
+ * incorrectly encoded code-points.
+ */
+
+#pragma once
+
+#include "../SIMD/cpu_dispatch.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.char_maps.utf_transcode);
+
+namespace hi { inline namespace v1 {
+
+/** The result of the utf*_scan() kernels.
+ */
+hi_export struct utf_scan_result {
+    /** The number of code-units of the correctly encoded prefix.
+     */
+    size_t size = 0;
+
+    /** The number of code-units needed to encode the prefix in UTF-8.
+     */
+    size_t utf8_size = 0;
+
+    /** The number of code-units needed to encode the prefix in UTF-16.
+     */
+    size_t utf16_size = 0;
+
+    /** The number of code-units needed to encode the prefix in UTF-32.
+     */
+    size_t utf32_size = 0;
+};
+
+/** The result of the transcode kernels.
+ */
+hi_export struct utf_transcode_result {
+    /** The number of code-units read.
+     */
+    size_t src_size = 0;
+
+    /** The number of code-units written.
+     */
+    size_t dst_size = 0;
+};
+
+/** The signature of the utf8_scan() kernel.
+ *
+ * @param src The UTF-8 text.
+ * @param size The number of code-units in the text.
+ * @return The size of the correctly encoded prefix, and its size in each encoding.
+ */
+using utf8_scan_type = utf_scan_result(char const *src, size_t size);
+
+/** The signature of the utf16_scan() kernel.
+ *
+ * @param src The UTF-16 text.
+ * @param size The number of code-units in the text.
+ * @return The size of the correctly encoded prefix, and its size in each encoding.
+ */
+using utf16_scan_type = utf_scan_result(char16_t const *src, size_t size);
+
+/** The signature of the utf32_scan() kernel.
+ *
+ * @param src The UTF-32 text.
+ * @param size The number of code-units in the text.
+ * @return The size of the correctly encoded prefix, and its size in each encoding.
+ */
+using utf32_scan_type = utf_scan_result(char32_t const *src, size_t size);
+
+/** The signature of the transcode kernels.
+ *
+ * The kernel converts the correctly encoded prefix of the text, as long as it
+ * fits in the destination buffer. Code-units in the destination buffer beyond
+ * the ones that are written may be overwritten.
+ *
+ * @param src The text to convert.
+ * @param src_size The number of code-units in the text.
+ * @param dst The buffer to write the converted text to.
+ * @param dst_size The number of code-units in the buffer.
+ * @return The number of code-units read and written.
+ */
+template<typename From, typename To>
+using utf_transcode_type = utf_transcode_result(From const *src, size_t src_size, To *dst, size_t dst_size);
+
+using utf8_to_utf16_type = utf_transcode_type<char, char16_t>;
+using utf8_to_utf32_type = utf_transcode_type<char, char32_t>;
+using utf16_to_utf8_type = utf_transcode_type<char16_t, char>;
+using utf16_to_utf32_type = utf_transcode_type<char16_t, char32_t>;
+using utf32_to_utf8_type = utf_transcode_type<char32_t, char>;
+using utf32_to_utf16_type = utf_transcode_type<char32_t, char16_t>;
+
+#define HI_X_declare_kernels() \
+    utf8_scan_type utf8_scan; \
+    utf16_scan_type utf16_scan; \
+    utf32_scan_type utf32_scan; \
+    utf8_to_utf16_type utf8_to_utf16; \
+    utf8_to_utf32_type utf8_to_utf32; \
+    utf16_to_utf8_type utf16_to_utf8; \
+    utf16_to_utf32_type utf16_to_utf32; \
+    utf32_to_utf8_type utf32_to_utf8; \
+    utf32_to_utf16_type utf32_to_utf16;
+
+#if HI_PROCESSOR == HI_CPU_X64
+namespace cpu_x64v1 {
+HI_X_declare_kernels()
+} // namespace cpu_x64v1
+namespace cpu_x64v2 {
+HI_X_declare_kernels()
+} // namespace cpu_x64v2
+namespace cpu_x64v3 {
+HI_X_declare_kernels()
+} // namespace cpu_x64v3
+namespace cpu_x64v4 {
+HI_X_declare_kernels()
+} // namespace cpu_x64v4
+
+#define HI_X_cpu_dispatch(name) \
+    hi_export inline cpu_dispatch<name##_type> name = { \
+        cpu_x64v1::name, cpu_x64v2::name, cpu_x64v3::name, cpu_x64v4::name};
+#else
+namespace cpu_generic {
+HI_X_declare_kernels()
+} // namespace cpu_generic
+
+#define HI_X_cpu_dispatch(name) hi_export inline cpu_dispatch<name##_type> name{cpu_generic::name};
+#endif
+
+HI_X_cpu_dispatch(utf8_scan)
+HI_X_cpu_dispatch(utf16_scan)
+HI_X_cpu_dispatch(utf32_scan)
+HI_X_cpu_dispatch(utf8_to_utf16)
+HI_X_cpu_dispatch(utf8_to_utf32)
+HI_X_cpu_dispatch(utf16_to_utf8)
+HI_X_cpu_dispatch(utf16_to_utf32)
+HI_X_cpu_dispatch(utf32_to_utf8)
+HI_X_cpu_dispatch(utf32_to_utf16)
+#undef HI_X_cpu_dispatch
+#undef HI_X_declare_kernels
+
+}} // namespace hi::v1
@@ -0,0 +1,1069 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file char_maps/utf_transcode_kernels.hpp The UTF validation and conversion kernels, compiled once for each CPU level.
+ *
+ * Only include this file from `SIMD/cpu_dispatch_kernels.hpp`.
+ *
+ * The SSE4.1 variants handle 16 bytes of UTF-8, 8 code-units of UTF-16 or
+ * 4 code-units of UTF-32 at a time; the AVX2 variants of the scan kernels
+ * handle twice as many. UTF-8 is validated with the nibble lookup tables of
+ * Keiser and Lemire, "Validating UTF-8 In Less Than One Instruction Per Byte".
+ *
+ * The conversions only handle code-points in the basic multilingual plane
+ * with vector instructions. Code-points of four UTF-8 code-units, surrogate
+ * pairs and the code-units around an encoding error are handled by the
+ * scalar code, which is also the only code for CPUs without SSE4.1.
+ */
+
+#pragma once
+
+#include "utf_transcode.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <array>
+#include <bit>
+#include <utility>
+#include <algorithm>
+#include <cstdint>
+#include <cstddef>
+#if HI_CPU_DISPATCH_LEVEL >= 1
+#include <immintrin.h>
+#endif
+
+#ifndef HI_CPU_DISPATCH_NAMESPACE
+#error "utf_transcode_kernels.hpp must be included through cpu_dispatch_kernels.hpp"
+#endif
+
+hi_cpu_dispatch_target_push()
+
+namespace hi { inline namespace v1 { namespace HI_CPU_DISPATCH_NAMESPACE {
+
+/** Decode a single UTF-8 code-point.
+ *
+ * @param src The text, starting at the first code-unit of the code-point.
+ * @param size The number of code-units in the text, must be non-zero.
+ * @return The code-point and its number of code-units, or zero code-units
+ *         when the code-point is incorrectly encoded or incomplete.
+ */
+[[nodiscard]] hi_force_inline std::pair<char32_t, size_t> utf8_decode(char const *src, size_t size) noexcept
+{
+    hilet c0 = static_cast<uint8_t>(src[0]);
+    if (c0 < 0x80) {
+        return {char32_t{c0}, 1};
+    }
+
+    // Continuation code-units, the overlong leaders 0xc0 and 0xc1 and leaders of code-points beyond U+10ffff.
+    if (c0 < 0xc2 or c0 > 0xf4) {
+        return {char32_t{0}, 0};
+    }
+
+    hilet length = c0 < 0xe0 ? 2_uz : c0 < 0xf0 ? 3_uz : 4_uz;
+    if (size < length) {
+        return {char32_t{0}, 0};
+    }
+
+    auto cp = char32_t{c0} & (char32_t{0x7f} >> length);
+    for (auto i = 1_uz; i != length; ++i) {
+        hilet c = static_cast<uint8_t>(src[i]);
+        if ((c & 0xc0) != 0x80) {
+            return {char32_t{0}, 0};
+        }
+        cp = (cp << 6) | (c & 0x3f);
+    }
+
+    if (length == 3 and (cp < 0x800 or (cp >= 0xd800 and cp < 0xe000))) {
+        return {char32_t{0}, 0};
+    }
+    if (length == 4 and (cp < 0x1'0000 or cp > 0x10'ffff)) {
+        return {char32_t{0}, 0};
+    }
+    return {cp, length};
+}
+
+/** Decode a single UTF-16 code-point.
+ *
+ * @param src The text, starting at the first code-unit of the code-point.
+ * @param size The number of code-units in the text, must be non-zero.
+ * @return The code-point and its number of code-units, or zero code-units
+ *         when the code-point is incorrectly encoded or incomplete.
+ */
+[[nodiscard]] hi_force_inline std::pair<char32_t, size_t> utf16_decode(char16_t const *src, size_t size) noexcept
+{
+    hilet c0 = char32_t{src[0]};
+    if (c0 < 0xd800 or c0 >= 0xe000) {
+        return {c0, 1};
+    }
+
+    if (c0 >= 0xdc00 or size < 2) {
+        return {char32_t{0}, 0};
+    }
+
+    hilet c1 = char32_t{src[1]};
+    if (c1 < 0xdc00 or c1 >= 0xe000) {
+        return {char32_t{0}, 0};
+    }
+    return {char32_t{0x1'0000} + ((c0 & 0x3ff) << 10) + (c1 & 0x3ff), 2};
+}
+
+/** Check if a UTF-32 code-unit is a valid code-point.
+ */
+[[nodiscard]] hi_force_inline bool utf32_is_valid(char32_t cp) noexcept
+{
+    return cp < 0xd800 or (cp >= 0xe000 and cp < 0x11'0000);
+}
+
+/** Encode a code-point as UTF-8.
+ *
+ * @param cp The code-point.
+ * @param dst The buffer, with room for at least `utf8_size(cp)` code-units.
+ * @return The number of code-units written.
+ */
+hi_force_inline size_t utf8_encode(char32_t cp, char *dst) noexcept
+{
+    if (cp < 0x80) {
+        dst[0] = static_cast<char>(cp);
+        return 1;
+
+    } else if (cp < 0x800) {
+        dst[0] = static_cast<char>(0xc0 | (cp >> 6));
+        dst[1] = static_cast<char>(0x80 | (cp & 0x3f));
+        return 2;
+
+    } else if (cp < 0x1'0000) {
+        dst[0] = static_cast<char>(0xe0 | (cp >> 12));
+        dst[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+        dst[2] = static_cast<char>(0x80 | (cp & 0x3f));
+        return 3;
+
+    } else {
+        dst[0] = static_cast<char>(0xf0 | (cp >> 18));
+        dst[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3f));
+        dst[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3f));
+        dst[3] = static_cast<char>(0x80 | (cp & 0x3f));
+        return 4;
+    }
+}
+
+/** Encode a code-point as UTF-16.
+ *
+ * @param cp The code-point.
+ * @param dst The buffer, with room for at least `utf16_size(cp)` code-units.
+ * @return The number of code-units written.
+ */
+hi_force_inline size_t utf16_encode(char32_t cp, char16_t *dst) noexcept
+{
+    if (cp < 0x1'0000) {
+        dst[0] = static_cast<char16_t>(cp);
+        return 1;
+
+    } else {
+        cp -= 0x1'0000;
+        dst[0] = static_cast<char16_t>(0xd800 + (cp >> 10));
+        dst[1] = static_cast<char16_t>(0xdc00 + (cp & 0x3ff));
+        return 2;
+    }
+}
+
+/** The number of UTF-8 code-units needed to encode a code-point.
+ */
+[[nodiscard]] hi_force_inline size_t utf8_size(char32_t cp) noexcept
+{
+    return 1_uz + (cp >= 0x80) + (cp >= 0x800) + (cp >= 0x1'0000);
+}
+
+/** The number of UTF-16 code-units needed to encode a code-point.
+ */
+[[nodiscard]] hi_force_inline size_t utf16_size(char32_t cp) noexcept
+{
+    return 1_uz + (cp >= 0x1'0000);
+}
+
+/** Count a block of UTF-8 that was validated with vector instructions.
+ *
+ * @param ends The code-units that end a correctly encoded code-point.
+ * @param starts The code-units that start a code-point.
+ * @param fours The code-units that start a code-point of four code-units.
+ * @param[in,out] r The result to add the counts to.
+ * @return The number of code-units of the block that are counted.
+ */
+hi_force_inline size_t utf8_scan_block(uint64_t ends, uint64_t starts, uint64_t fours, utf_scan_result& r) noexcept
+{
+    hilet size = static_cast<size_t>(std::bit_width(ends));
+    hilet mask = (uint64_t{1} << size) - 1;
+    hilet num_code_points = static_cast<size_t>(std::popcount(starts & mask));
+
+    r.utf8_size += size;
+    r.utf16_size += num_code_points + static_cast<size_t>(std::popcount(fours & mask));
+    r.utf32_size += num_code_points;
+    return size;
+}
+
+/** Count a block of UTF-16 that was classified with vector instructions.
+ *
+ * The masks have two bits for each code-unit, as returned by `movemask_epi8`.
+ *
+ * @param num_units The number of code-units in the block.
+ * @param high The high surrogates.
+ * @param low The low surrogates.
+ * @param ge80 The code-units of 0x80 and above.
+ * @param ge800 The code-units of 0x800 and above.
+ * @param[in,out] r The result to add the counts to.
+ * @return The number of code-units of the block that are counted.
+ */
+hi_force_inline size_t
+utf16_scan_block(size_t num_units, uint64_t high, uint64_t low, uint64_t ge80, uint64_t ge800, utf_scan_result& r) noexcept
+{
+    hilet all = (uint64_t{1} << (num_units * 2)) - 1;
+
+    // A high surrogate must be followed by a low surrogate, and a low surrogate must follow a high surrogate.
+    auto size = num_units;
+    if (hilet bad = (low ^ (high << 2)) & all) {
+        size = static_cast<size_t>(std::countr_zero(bad)) / 2;
+    }
+    // Don't split a surrogate pair, or include a high surrogate without its low surrogate.
+    if (size != 0 and ((high >> ((size - 1) * 2)) & 1) != 0) {
+        --size;
+    }
+
+    hilet mask = (uint64_t{1} << (size * 2)) - 1;
+    hilet num_surrogates = static_cast<size_t>(std::popcount((high | low) & mask));
+    hilet num_ge80 = static_cast<size_t>(std::popcount(ge80 & mask));
+    hilet num_ge800 = static_cast<size_t>(std::popcount(ge800 & mask));
+
+    // Each surrogate is counted as three UTF-8 code-units, but a surrogate pair is encoded in four.
+    r.utf8_size += size + (num_ge80 + num_ge800 - num_surrogates) / 2;
+    r.utf16_size += size;
+    r.utf32_size += size - static_cast<size_t>(std::popcount(low & mask)) / 2;
+    return size;
+}
+
+/** Count a block of UTF-32 that was classified with vector instructions.
+ *
+ * The masks have one bit for each code-unit, as returned by `movemask_ps`.
+ *
+ * @param num_units The number of code-units in the block.
+ * @param invalid The code-units that are not valid code-points.
+ * @param ge80 The code-units of 0x80 and above.
+ * @param ge800 The code-units of 0x800 and above.
+ * @param ge10000 The code-units of 0x10000 and above.
+ * @param[in,out] r The result to add the counts to.
+ * @return The number of code-units of the block that are counted.
+ */
+hi_force_inline size_t
+utf32_scan_block(size_t num_units, uint32_t invalid, uint32_t ge80, uint32_t ge800, uint32_t ge10000, utf_scan_result& r) noexcept
+{
+    hilet size = invalid != 0 ? static_cast<size_t>(std::countr_zero(invalid)) : num_units;
+    hilet mask = (uint32_t{1} << size) - 1;
+    hilet num_ge10000 = static_cast<size_t>(std::popcount(ge10000 & mask));
+
+    r.utf8_size += size + static_cast<size_t>(std::popcount(ge80 & mask) + std::popcount(ge800 & mask)) + num_ge10000;
+    r.utf16_size += size + num_ge10000;
+    r.utf32_size += size;
+    return size;
+}
+
+#if HI_CPU_DISPATCH_LEVEL >= 2
+/** The shuffle masks that move the selected 16 bit lanes to the front.
+ */
+constexpr auto utf_compress16_table = [] {
+    auto r = std::array<std::array<uint8_t, 16>, 256>{};
+    for (auto mask = 0_uz; mask != r.size(); ++mask) {
+        auto j = 0_uz;
+        for (auto i = 0_uz; i != 8; ++i) {
+            if ((mask >> i) & 1) {
+                r[mask][j++] = static_cast<uint8_t>(i * 2);
+                r[mask][j++] = static_cast<uint8_t>(i * 2 + 1);
+            }
+        }
+        while (j != 16) {
+            r[mask][j++] = 0x80;
+        }
+    }
+    return r;
+}();
+
+/** The shuffle masks that move the selected 8 bit lanes to the front.
+ */
+constexpr auto utf_compress8_table = [] {
+    auto r = std::array<std::array<uint8_t, 8>, 256>{};
+    for (auto mask = 0_uz; mask != r.size(); ++mask) {
+        auto j = 0_uz;
+        for (auto i = 0_uz; i != 8; ++i) {
+            if ((mask >> i) & 1) {
+                r[mask][j++] = static_cast<uint8_t>(i);
+            }
+        }
+        while (j != 8) {
+            r[mask][j++] = 0x80;
+        }
+    }
+    return r;
+}();
+
+constexpr uint8_t utf8_too_short = 1 << 0;
+constexpr uint8_t utf8_too_long = 1 << 1;
+constexpr uint8_t utf8_overlong_3 = 1 << 2;
+constexpr uint8_t utf8_too_large = 1 << 3;
+constexpr uint8_t utf8_surrogate = 1 << 4;
+constexpr uint8_t utf8_overlong_2 = 1 << 5;
+constexpr uint8_t utf8_too_large_1000 = 1 << 6;
+constexpr uint8_t utf8_overlong_4 = 1 << 6;
+constexpr uint8_t utf8_two_conts = 1 << 7;
+constexpr uint8_t utf8_carry = utf8_too_short | utf8_too_long | utf8_two_conts;
+
+/** The errors that are possible for each value of the high nibble of the previous code-unit.
+ */
+constexpr auto utf8_byte_1_high_table = std::array<uint8_t, 16>{
+    utf8_too_long,
+    utf8_too_long,
+    utf8_too_long,
+    utf8_too_long,
+    utf8_too_long,
+    utf8_too_long,
+    utf8_too_long,
+    utf8_too_long,
+    utf8_two_conts,
+    utf8_two_conts,
+    utf8_two_conts,
+    utf8_two_conts,
+    utf8_too_short | utf8_overlong_2,
+    utf8_too_short,
+    utf8_too_short | utf8_overlong_3 | utf8_surrogate,
+    utf8_too_short | utf8_too_large | utf8_too_large_1000 | utf8_overlong_4};
+
+/** The errors that are possible for each value of the low nibble of the previous code-unit.
+ */
+constexpr auto utf8_byte_1_low_table = std::array<uint8_t, 16>{
+    utf8_carry | utf8_overlong_3 | utf8_overlong_2 | utf8_overlong_4,
+    utf8_carry | utf8_overlong_2,
+    utf8_carry,
+    utf8_carry,
+    utf8_carry | utf8_too_large,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000 | utf8_surrogate,
+    utf8_carry | utf8_too_large | utf8_too_large_1000,
+    utf8_carry | utf8_too_large | utf8_too_large_1000};
+
+/** The errors that are possible for each value of the high nibble of the current code-unit.
+ */
+constexpr auto utf8_byte_2_high_table = std::array<uint8_t, 16>{
+    utf8_too_short,
+    utf8_too_short,
+    utf8_too_short,
+    utf8_too_short,
+    utf8_too_short,
+    utf8_too_short,
+    utf8_too_short,
+    utf8_too_short,
+    utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_overlong_3 | utf8_too_large_1000 | utf8_overlong_4,
+    utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_overlong_3 | utf8_too_large,
+    utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_surrogate | utf8_too_large,
+    utf8_too_long | utf8_overlong_2 | utf8_two_conts | utf8_surrogate | utf8_too_large,
+    utf8_too_short,
+    utf8_too_short,
+    utf8_too_short,
+    utf8_too_short};
+
+[[nodiscard]] hi_force_inline __m128i utf_load_table(std::array<uint8_t, 16> const& table) noexcept
+{
+    return _mm_loadu_si128(reinterpret_cast<__m128i const *>(table.data()));
+}
+
+/** Find the encoding errors in a chunk of UTF-8.
+ *
+ * An error in a code-point is found at the code-unit that follows it.
+ *
+ * @param input The chunk of UTF-8.
+ * @param prev1 The chunk shifted by one code-unit.
+ * @param prev2 The chunk shifted by two code-units.
+ * @param prev3 The chunk shifted by three code-units.
+ * @return Non-zero for the code-units that have an error.
+ */
+[[nodiscard]] hi_force_inline __m128i utf8_check(__m128i input, __m128i prev1, __m128i prev2, __m128i prev3) noexcept
+{
+    hilet nibble = _mm_set1_epi8(0x0f);
+    hilet byte_1_high =
+        _mm_shuffle_epi8(utf_load_table(utf8_byte_1_high_table), _mm_and_si128(_mm_srli_epi16(prev1, 4), nibble));
+    hilet byte_1_low = _mm_shuffle_epi8(utf_load_table(utf8_byte_1_low_table), _mm_and_si128(prev1, nibble));
+    hilet byte_2_high =
+        _mm_shuffle_epi8(utf_load_table(utf8_byte_2_high_table), _mm_and_si128(_mm_srli_epi16(input, 4), nibble));
+    hilet special = _mm_and_si128(_mm_and_si128(byte_1_high, byte_1_low), byte_2_high);
+
+    // The two_conts error is expected for the third and fourth code-unit of a code-point.
+    hilet is_third = _mm_subs_epu8(prev2, _mm_set1_epi8(static_cast<char>(0xe0 - 0x80)));
+    hilet is_fourth = _mm_subs_epu8(prev3, _mm_set1_epi8(static_cast<char>(0xf0 - 0x80)));
+    hilet must_23 = _mm_and_si128(_mm_or_si128(is_third, is_fourth), _mm_set1_epi8(static_cast<char>(0x80)));
+    return _mm_xor_si128(must_23, special);
+}
+
+/** Find the code-units that end a correctly encoded code-point in a chunk of UTF-8.
+ *
+ * The chunk must start at the first code-unit of a code-point.
+ *
+ * @param num_units The number of code-units in the chunk.
+ * @param errors The code-units where an encoding error was found.
+ * @param starts The code-units that are not continuation code-units.
+ * @param ascii The ASCII code-units.
+ * @return The code-units that end a correctly encoded code-point, before the first error.
+ */
+[[nodiscard]] hi_force_inline uint64_t utf8_ends(size_t num_units, uint64_t errors, uint64_t starts, uint64_t ascii) noexcept
+{
+    // A code-point ends before the start of the next one; the last code-unit of
+    // the chunk is only known to end a code-point when it is ASCII.
+    auto r = (starts >> 1) | (ascii & (uint64_t{1} << (num_units - 1)));
+    if (errors != 0) {
+        // The error is found in the code-unit after the code-point.
+        r &= ((uint64_t{1} << std::countr_zero(errors)) - 1) >> 1;
+    }
+    return r;
+}
+
+/** Classify a chunk of 16 code-units of UTF-8.
+ *
+ * @param input The chunk, starting at the first code-unit of a code-point.
+ * @param[out] starts The code-units that start a code-point.
+ * @param[out] fours The code-units that start a code-point of four code-units.
+ * @return The code-units that end a correctly encoded code-point, before the first error.
+ */
+[[nodiscard]] hi_force_inline uint64_t utf8_classify(__m128i input, uint64_t& starts, uint64_t& fours) noexcept
+{
+    hilet errors = utf8_check(input, _mm_slli_si128(input, 1), _mm_slli_si128(input, 2), _mm_slli_si128(input, 3));
+    hilet error_mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(errors, _mm_setzero_si128()))) ^ 0xffff;
+
+    // Continuation code-units, 0x80 - 0xbf, are the signed values below -64.
+    hilet cont_mask = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmplt_epi8(input, _mm_set1_epi8(-64))));
+    hilet ascii_mask = static_cast<uint32_t>(_mm_movemask_epi8(input)) ^ 0xffff;
+    hilet f0 = _mm_set1_epi8(static_cast<char>(0xf0));
+
+    starts = cont_mask ^ 0xffff;
+    fours = static_cast<uint32_t>(_mm_movemask_epi8(_mm_cmpeq_epi8(_mm_max_epu8(input, f0), input)));
+    return utf8_ends(16, error_mask, starts, ascii_mask);
+}
+
+/** Decode a chunk of 16 code-units of UTF-8 into 16 bit code-points.
+ *
+ * Code-points of four code-units are not decoded; only the code-points
+ * before the first one are returned.
+ *
+ * @param input The chunk, starting at the first code-unit of a code-point.
+ * @param[out] first The code-points that end at the code-units 0 to 7, in the lane of their last code-unit.
+ * @param[out] second The code-points that end at the code-units 8 to 15, in the lane of their last code-unit.
+ * @return The code-units that end a decoded code-point.
+ */
+[[nodiscard]] hi_force_inline uint32_t utf8_decode16(__m128i input, __m128i& first, __m128i& second) noexcept
+{
+    auto starts = uint64_t{};
+    auto fours = uint64_t{};
+    auto ends = utf8_classify(input, starts, fours);
+    if (fours != 0) {
+        ends &= (uint64_t{1} << std::countr_zero(fours)) - 1;
+    }
+
+    hilet cont0 = _mm_cmplt_epi8(input, _mm_set1_epi8(-64));
+    hilet cont1 = _mm_slli_si128(cont0, 1);
+    hilet byte1 = _mm_slli_si128(input, 1);
+    hilet byte2 = _mm_slli_si128(input, 2);
+
+    // The last code-unit; 7 bits of an ASCII character or 6 bits of a continuation.
+    hilet low = _mm_and_si128(input, _mm_xor_si128(_mm_set1_epi8(0x7f), _mm_and_si128(cont0, _mm_set1_epi8(0x40))));
+    // The code-unit before a continuation; 5 bits of a leader or 6 bits of a continuation.
+    hilet mid = _mm_and_si128(cont0, _mm_and_si128(byte1, _mm_or_si128(_mm_set1_epi8(0x1f), _mm_and_si128(cont1, _mm_set1_epi8(0x20)))));
+    // The 4 bits of the leader of a code-point of three code-units.
+    hilet high = _mm_and_si128(_mm_and_si128(cont0, cont1), _mm_and_si128(byte2, _mm_set1_epi8(0x0f)));
+
+    hilet zero = _mm_setzero_si128();
+    first = _mm_or_si128(
+        _mm_or_si128(_mm_unpacklo_epi8(low, zero), _mm_slli_epi16(_mm_unpacklo_epi8(mid, zero), 6)),
+        _mm_slli_epi16(_mm_unpacklo_epi8(high, zero), 12));
+    second = _mm_or_si128(
+        _mm_or_si128(_mm_unpackhi_epi8(low, zero), _mm_slli_epi16(_mm_unpackhi_epi8(mid, zero), 6)),
+        _mm_slli_epi16(_mm_unpackhi_epi8(high, zero), 12));
+    return static_cast<uint32_t>(ends);
+}
+
+/** Store the selected 16 bit lanes.
+ *
+ * @param dst The buffer, with room for 8 code-units.
+ * @param values The 16 bit lanes.
+ * @param mask The lanes to store.
+ * @return The number of code-units written.
+ */
+hi_force_inline size_t utf_compress16(char16_t *dst, __m128i values, uint32_t mask) noexcept
+{
+    hilet shuffle = utf_load_table(utf_compress16_table[mask]);
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_shuffle_epi8(values, shuffle));
+    return static_cast<size_t>(std::popcount(mask));
+}
+
+/** Store the selected 16 bit lanes, widened to 32 bits.
+ *
+ * @param dst The buffer, with room for 8 code-units.
+ * @param values The 16 bit lanes.
+ * @param mask The lanes to store.
+ * @return The number of code-units written.
+ */
+hi_force_inline size_t utf_compress16(char32_t *dst, __m128i values, uint32_t mask) noexcept
+{
+    hilet compressed = _mm_shuffle_epi8(values, utf_load_table(utf_compress16_table[mask]));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst), _mm_cvtepu16_epi32(compressed));
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + 4), _mm_cvtepu16_epi32(_mm_srli_si128(compressed, 8)));
+    return static_cast<size_t>(std::popcount(mask));
+}
+
+/** Spread the lowest four bits of a mask to every fourth bit.
+ */
+[[nodiscard]] hi_force_inline uint32_t utf_spread4(uint32_t mask) noexcept
+{
+    return (mask & 1) | ((mask & 2) << 3) | ((mask & 4) << 6) | ((mask & 8) << 9);
+}
+
+/** Encode four code-points as UTF-8.
+ *
+ * @param values Four 32 bit code-points, in the basic multilingual plane and not surrogates.
+ * @param num_values The number of code-points to encode, 1 to 4.
+ * @param dst The buffer, with room for 16 code-units.
+ * @return The number of code-units written.
+ */
+hi_force_inline size_t utf8_encode4(__m128i values, size_t num_values, char *dst) noexcept
+{
+    hilet six = _mm_set1_epi32(0x3f);
+
+    // Each 32 bit lane holds the encoded code-point, with the first code-unit in the lowest byte.
+    hilet two = _mm_or_si128(
+        _mm_or_si128(_mm_set1_epi32(0x80c0), _mm_srli_epi32(values, 6)), _mm_slli_epi32(_mm_and_si128(values, six), 8));
+    hilet three = _mm_or_si128(
+        _mm_or_si128(_mm_set1_epi32(0x8080e0), _mm_srli_epi32(values, 12)),
+        _mm_or_si128(
+            _mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(values, 6), six), 8), _mm_slli_epi32(_mm_and_si128(values, six), 16)));
+
+    hilet ge80 = _mm_cmpeq_epi32(_mm_max_epu32(values, _mm_set1_epi32(0x80)), values);
+    hilet ge800 = _mm_cmpeq_epi32(_mm_max_epu32(values, _mm_set1_epi32(0x800)), values);
+    auto encoded = _mm_blendv_epi8(values, two, ge80);
+    encoded = _mm_blendv_epi8(encoded, three, ge800);
+
+    hilet lanes = (uint32_t{1} << num_values) - 1;
+    hilet ge80_mask = static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(ge80))) & lanes;
+    hilet ge800_mask = static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(ge800))) & lanes;
+    hilet keep = utf_spread4(lanes) | (utf_spread4(ge80_mask) << 1) | (utf_spread4(ge800_mask) << 2);
+
+    hilet keep_first = keep & 0xff;
+    hilet keep_second = keep >> 8;
+    hilet shuffle_first = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(utf_compress8_table[keep_first].data()));
+    hilet shuffle_second = _mm_loadl_epi64(reinterpret_cast<__m128i const *>(utf_compress8_table[keep_second].data()));
+
+    hilet size_first = static_cast<size_t>(std::popcount(keep_first));
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(dst), _mm_shuffle_epi8(encoded, shuffle_first));
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + size_first), _mm_shuffle_epi8(_mm_srli_si128(encoded, 8), shuffle_second));
+    return size_first + static_cast<size_t>(std::popcount(keep_second));
+}
+
+/** The lanes of 32 bit code-points that are in the basic multilingual plane and are not surrogates.
+ */
+[[nodiscard]] hi_force_inline __m128i utf32_is_bmp(__m128i values) noexcept
+{
+    hilet below_surrogates = _mm_cmpeq_epi32(_mm_min_epu32(values, _mm_set1_epi32(0xd7ff)), values);
+    hilet above_surrogates = _mm_cmpeq_epi32(_mm_max_epu32(values, _mm_set1_epi32(0xe000)), values);
+    hilet below_10000 = _mm_cmpeq_epi32(_mm_min_epu32(values, _mm_set1_epi32(0xffff)), values);
+    return _mm_or_si128(below_surrogates, _mm_and_si128(above_surrogates, below_10000));
+}
+
+/** The surrogate code-units of 16 bit lanes, two mask bits for each lane.
+ */
+[[nodiscard]] hi_force_inline uint32_t utf16_surrogate_mask(__m128i values) noexcept
+{
+    hilet surrogates = _mm_cmpeq_epi16(
+        _mm_and_si128(values, _mm_set1_epi16(static_cast<short>(0xf800))), _mm_set1_epi16(static_cast<short>(0xd800)));
+    return static_cast<uint32_t>(_mm_movemask_epi8(surrogates));
+}
+#endif
+
+#if HI_CPU_DISPATCH_LEVEL >= 3
+[[nodiscard]] hi_force_inline __m256i utf_load_table256(std::array<uint8_t, 16> const& table) noexcept
+{
+    return _mm256_broadcastsi128_si256(utf_load_table(table));
+}
+
+/** Find the encoding errors in a chunk of UTF-8.
+ *
+ * @see utf8_check(__m128i, __m128i, __m128i, __m128i)
+ */
+[[nodiscard]] hi_force_inline __m256i utf8_check(__m256i input, __m256i prev1, __m256i prev2, __m256i prev3) noexcept
+{
+    hilet nibble = _mm256_set1_epi8(0x0f);
+    hilet byte_1_high =
+        _mm256_shuffle_epi8(utf_load_table256(utf8_byte_1_high_table), _mm256_and_si256(_mm256_srli_epi16(prev1, 4), nibble));
+    hilet byte_1_low = _mm256_shuffle_epi8(utf_load_table256(utf8_byte_1_low_table), _mm256_and_si256(prev1, nibble));
+    hilet byte_2_high =
+        _mm256_shuffle_epi8(utf_load_table256(utf8_byte_2_high_table), _mm256_and_si256(_mm256_srli_epi16(input, 4), nibble));
+    hilet special = _mm256_and_si256(_mm256_and_si256(byte_1_high, byte_1_low), byte_2_high);
+
+    hilet is_third = _mm256_subs_epu8(prev2, _mm256_set1_epi8(static_cast<char>(0xe0 - 0x80)));
+    hilet is_fourth = _mm256_subs_epu8(prev3, _mm256_set1_epi8(static_cast<char>(0xf0 - 0x80)));
+    hilet must_23 = _mm256_and_si256(_mm256_or_si256(is_third, is_fourth), _mm256_set1_epi8(static_cast<char>(0x80)));
+    return _mm256_xor_si256(must_23, special);
+}
+
+/** Classify a chunk of 32 code-units of UTF-8.
+ *
+ * @see utf8_classify(__m128i, uint64_t&, uint64_t&)
+ */
+[[nodiscard]] hi_force_inline uint64_t utf8_classify(__m256i input, uint64_t& starts, uint64_t& fours) noexcept
+{
+    // The chunk shifted by 16 code-units, with zeros shifted in.
+    hilet shifted = _mm256_permute2x128_si256(input, input, 0x08);
+    hilet errors = utf8_check(
+        input, _mm256_alignr_epi8(input, shifted, 15), _mm256_alignr_epi8(input, shifted, 14), _mm256_alignr_epi8(input, shifted, 13));
+    hilet error_mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(errors, _mm256_setzero_si256()))) ^ 0xffff'ffff;
+
+    hilet cont_mask = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpgt_epi8(_mm256_set1_epi8(-64), input)));
+    hilet ascii_mask = static_cast<uint32_t>(_mm256_movemask_epi8(input)) ^ 0xffff'ffff;
+    hilet f0 = _mm256_set1_epi8(static_cast<char>(0xf0));
+
+    starts = cont_mask ^ 0xffff'ffff;
+    fours = static_cast<uint32_t>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(_mm256_max_epu8(input, f0), input)));
+    return utf8_ends(32, error_mask, starts, ascii_mask);
+}
+#endif
+
+utf_scan_result utf8_scan(char const *src, size_t size)
+{
+    auto r = utf_scan_result{};
+    auto i = 0_uz;
+    while (i != size) {
+#if HI_CPU_DISPATCH_LEVEL >= 3
+        while (size - i >= 32) {
+            hilet input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i));
+            if (_mm256_movemask_epi8(input) == 0) {
+                r.utf8_size += 32;
+                r.utf16_size += 32;
+                r.utf32_size += 32;
+                i += 32;
+                continue;
+            }
+
+            auto starts = uint64_t{};
+            auto fours = uint64_t{};
+            hilet ends = utf8_classify(input, starts, fours);
+            if (ends == 0) {
+                break;
+            }
+            i += utf8_scan_block(ends, starts, fours, r);
+        }
+#endif
+#if HI_CPU_DISPATCH_LEVEL >= 2
+        while (size - i >= 16) {
+            hilet input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+            if (_mm_movemask_epi8(input) == 0) {
+                r.utf8_size += 16;
+                r.utf16_size += 16;
+                r.utf32_size += 16;
+                i += 16;
+                continue;
+            }
+
+            auto starts = uint64_t{};
+            auto fours = uint64_t{};
+            hilet ends = utf8_classify(input, starts, fours);
+            if (ends == 0) {
+                break;
+            }
+            i += utf8_scan_block(ends, starts, fours, r);
+        }
+#endif
+        if (i == size) {
+            break;
+        }
+
+        hilet [cp, length] = utf8_decode(src + i, size - i);
+        if (length == 0) {
+            break;
+        }
+        i += length;
+        r.utf8_size += length;
+        r.utf16_size += utf16_size(cp);
+        r.utf32_size += 1;
+    }
+
+    r.size = i;
+    return r;
+}
+
+utf_scan_result utf16_scan(char16_t const *src, size_t size)
+{
+    auto r = utf_scan_result{};
+    auto i = 0_uz;
+    while (i != size) {
+#if HI_CPU_DISPATCH_LEVEL >= 3
+        while (size - i >= 16) {
+            hilet input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i));
+            hilet high = _mm256_cmpeq_epi16(
+                _mm256_and_si256(input, _mm256_set1_epi16(static_cast<short>(0xfc00))), _mm256_set1_epi16(static_cast<short>(0xd800)));
+            hilet low = _mm256_cmpeq_epi16(
+                _mm256_and_si256(input, _mm256_set1_epi16(static_cast<short>(0xfc00))), _mm256_set1_epi16(static_cast<short>(0xdc00)));
+            hilet ge80 = _mm256_cmpeq_epi16(_mm256_max_epu16(input, _mm256_set1_epi16(0x80)), input);
+            hilet ge800 = _mm256_cmpeq_epi16(_mm256_max_epu16(input, _mm256_set1_epi16(0x800)), input);
+
+            hilet n = utf16_scan_block(
+                16,
+                static_cast<uint32_t>(_mm256_movemask_epi8(high)),
+                static_cast<uint32_t>(_mm256_movemask_epi8(low)),
+                static_cast<uint32_t>(_mm256_movemask_epi8(ge80)),
+                static_cast<uint32_t>(_mm256_movemask_epi8(ge800)),
+                r);
+            if (n == 0) {
+                break;
+            }
+            i += n;
+        }
+#endif
+#if HI_CPU_DISPATCH_LEVEL >= 2
+        while (size - i >= 8) {
+            hilet input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+            hilet high = _mm_cmpeq_epi16(
+                _mm_and_si128(input, _mm_set1_epi16(static_cast<short>(0xfc00))), _mm_set1_epi16(static_cast<short>(0xd800)));
+            hilet low = _mm_cmpeq_epi16(
+                _mm_and_si128(input, _mm_set1_epi16(static_cast<short>(0xfc00))), _mm_set1_epi16(static_cast<short>(0xdc00)));
+            hilet ge80 = _mm_cmpeq_epi16(_mm_max_epu16(input, _mm_set1_epi16(0x80)), input);
+            hilet ge800 = _mm_cmpeq_epi16(_mm_max_epu16(input, _mm_set1_epi16(0x800)), input);
+
+            hilet n = utf16_scan_block(
+                8,
+                static_cast<uint32_t>(_mm_movemask_epi8(high)),
+                static_cast<uint32_t>(_mm_movemask_epi8(low)),
+                static_cast<uint32_t>(_mm_movemask_epi8(ge80)),
+                static_cast<uint32_t>(_mm_movemask_epi8(ge800)),
+                r);
+            if (n == 0) {
+                break;
+            }
+            i += n;
+        }
+#endif
+        if (i == size) {
+            break;
+        }
+
+        hilet [cp, length] = utf16_decode(src + i, size - i);
+        if (length == 0) {
+            break;
+        }
+        i += length;
+        r.utf8_size += utf8_size(cp);
+        r.utf16_size += length;
+        r.utf32_size += 1;
+    }
+
+    r.size = i;
+    return r;
+}
+
+utf_scan_result utf32_scan(char32_t const *src, size_t size)
+{
+    auto r = utf_scan_result{};
+    auto i = 0_uz;
+    while (i != size) {
+#if HI_CPU_DISPATCH_LEVEL >= 3
+        while (size - i >= 8) {
+            hilet input = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(src + i));
+            hilet too_large = _mm256_cmpeq_epi32(_mm256_max_epu32(input, _mm256_set1_epi32(0x11'0000)), input);
+            hilet surrogate =
+                _mm256_cmpeq_epi32(_mm256_and_si256(input, _mm256_set1_epi32(static_cast<int>(0xffff'f800))), _mm256_set1_epi32(0xd800));
+            hilet ge80 = _mm256_cmpeq_epi32(_mm256_max_epu32(input, _mm256_set1_epi32(0x80)), input);
+            hilet ge800 = _mm256_cmpeq_epi32(_mm256_max_epu32(input, _mm256_set1_epi32(0x800)), input);
+            hilet ge10000 = _mm256_cmpeq_epi32(_mm256_max_epu32(input, _mm256_set1_epi32(0x1'0000)), input);
+
+            hilet n = utf32_scan_block(
+                8,
+                static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(_mm256_or_si256(too_large, surrogate)))),
+                static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(ge80))),
+                static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(ge800))),
+                static_cast<uint32_t>(_mm256_movemask_ps(_mm256_castsi256_ps(ge10000))),
+                r);
+            if (n == 0) {
+                break;
+            }
+            i += n;
+        }
+#endif
+#if HI_CPU_DISPATCH_LEVEL >= 2
+        while (size - i >= 4) {
+            hilet input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+            hilet too_large = _mm_cmpeq_epi32(_mm_max_epu32(input, _mm_set1_epi32(0x11'0000)), input);
+            hilet surrogate = _mm_cmpeq_epi32(_mm_and_si128(input, _mm_set1_epi32(static_cast<int>(0xffff'f800))), _mm_set1_epi32(0xd800));
+            hilet ge80 = _mm_cmpeq_epi32(_mm_max_epu32(input, _mm_set1_epi32(0x80)), input);
+            hilet ge800 = _mm_cmpeq_epi32(_mm_max_epu32(input, _mm_set1_epi32(0x800)), input);
+            hilet ge10000 = _mm_cmpeq_epi32(_mm_max_epu32(input, _mm_set1_epi32(0x1'0000)), input);
+
+            hilet n = utf32_scan_block(
+                4,
+                static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(_mm_or_si128(too_large, surrogate)))),
+                static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(ge80))),
+                static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(ge800))),
+                static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(ge10000))),
+                r);
+            if (n == 0) {
+                break;
+            }
+            i += n;
+        }
+#endif
+        if (i == size) {
+            break;
+        }
+
+        hilet cp = src[i];
+        if (not utf32_is_valid(cp)) {
+            break;
+        }
+        i += 1;
+        r.utf8_size += utf8_size(cp);
+        r.utf16_size += utf16_size(cp);
+        r.utf32_size += 1;
+    }
+
+    r.size = i;
+    return r;
+}
+
+utf_transcode_result utf8_to_utf16(char const *src, size_t src_size, char16_t *dst, size_t dst_size)
+{
+    auto i = 0_uz;
+    auto j = 0_uz;
+    while (i != src_size) {
+#if HI_CPU_DISPATCH_LEVEL >= 2
+        while (src_size - i >= 16 and dst_size - j >= 16) {
+            hilet input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+            if (_mm_movemask_epi8(input) == 0) {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + j), _mm_cvtepu8_epi16(input));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + j + 8), _mm_unpackhi_epi8(input, _mm_setzero_si128()));
+                i += 16;
+                j += 16;
+                continue;
+            }
+
+            auto first = __m128i{};
+            auto second = __m128i{};
+            hilet ends = utf8_decode16(input, first, second);
+            if (ends == 0) {
+                break;
+            }
+            j += utf_compress16(dst + j, first, ends & 0xff);
+            j += utf_compress16(dst + j, second, ends >> 8);
+            i += static_cast<size_t>(std::bit_width(ends));
+        }
+#endif
+        if (i == src_size) {
+            break;
+        }
+
+        hilet [cp, length] = utf8_decode(src + i, src_size - i);
+        if (length == 0 or dst_size - j < utf16_size(cp)) {
+            break;
+        }
+        i += length;
+        j += utf16_encode(cp, dst + j);
+    }
+
+    return {i, j};
+}
+
+utf_transcode_result utf8_to_utf32(char const *src, size_t src_size, char32_t *dst, size_t dst_size)
+{
+    auto i = 0_uz;
+    auto j = 0_uz;
+    while (i != src_size) {
+#if HI_CPU_DISPATCH_LEVEL >= 2
+        while (src_size - i >= 16 and dst_size - j >= 16) {
+            hilet input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+            if (_mm_movemask_epi8(input) == 0) {
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + j), _mm_cvtepu8_epi32(input));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + j + 4), _mm_cvtepu8_epi32(_mm_srli_si128(input, 4)));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + j + 8), _mm_cvtepu8_epi32(_mm_srli_si128(input, 8)));
+                _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + j + 12), _mm_cvtepu8_epi32(_mm_srli_si128(input, 12)));
+                i += 16;
+                j += 16;
+                continue;
+            }
+
+            auto first = __m128i{};
+            auto second = __m128i{};
+            hilet ends = utf8_decode16(input, first, second);
+            if (ends == 0) {
+                break;
+            }
+            j += utf_compress16(dst + j, first, ends & 0xff);
+            j += utf_compress16(dst + j, second, ends >> 8);
+            i += static_cast<size_t>(std::bit_width(ends));
+        }
+#endif
+        if (i == src_size) {
+            break;
+        }
+
+        hilet [cp, length] = utf8_decode(src + i, src_size - i);
+        if (length == 0 or dst_size - j < 1) {
+            break;
+        }
+        i += length;
+        dst[j++] = cp;
+    }
+
+    return {i, j};
+}
+
+utf_transcode_result utf16_to_utf8(char16_t const *src, size_t src_size, char *dst, size_t dst_size)
+{
+    auto i = 0_uz;
+    auto j = 0_uz;
+    while (i != src_size) {
+#if HI_CPU_DISPATCH_LEVEL >= 2
+        while (src_size - i >= 8 and dst_size - j >= 32) {
+            hilet input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+            if (_mm_movemask_epi8(_mm_cmpeq_epi16(_mm_min_epu16(input, _mm_set1_epi16(0x7f)), input)) == 0xffff) {
+                _mm_storel_epi64(reinterpret_cast<__m128i *>(dst + j), _mm_packus_epi16(input, input));
+                i += 8;
+                j += 8;
+                continue;
+            }
+
+            hilet surrogates = utf16_surrogate_mask(input);
+            hilet n = surrogates != 0 ? static_cast<size_t>(std::countr_zero(surrogates)) / 2 : 8_uz;
+            if (n == 0) {
+                break;
+            }
+            j += utf8_encode4(_mm_cvtepu16_epi32(input), std::min(n, 4_uz), dst + j);
+            if (n > 4) {
+                j += utf8_encode4(_mm_cvtepu16_epi32(_mm_srli_si128(input, 8)), n - 4, dst + j);
+            }
+            i += n;
+        }
+#endif
+        if (i == src_size) {
+            break;
+        }
+
+        hilet [cp, length] = utf16_decode(src + i, src_size - i);
+        if (length == 0 or dst_size - j < utf8_size(cp)) {
+            break;
+        }
+        i += length;
+        j += utf8_encode(cp, dst + j);
+    }
+
+    return {i, j};
+}
+
+utf_transcode_result utf16_to_utf32(char16_t const *src, size_t src_size, char32_t *dst, size_t dst_size)
+{
+    auto i = 0_uz;
+    auto j = 0_uz;
+    while (i != src_size) {
+#if HI_CPU_DISPATCH_LEVEL >= 2
+        while (src_size - i >= 8 and dst_size - j >= 8) {
+            hilet input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+            hilet surrogates = utf16_surrogate_mask(input);
+            hilet n = surrogates != 0 ? static_cast<size_t>(std::countr_zero(surrogates)) / 2 : 8_uz;
+            if (n == 0) {
+                break;
+            }
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + j), _mm_cvtepu16_epi32(input));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + j + 4), _mm_cvtepu16_epi32(_mm_srli_si128(input, 8)));
+            i += n;
+            j += n;
+        }
+#endif
+        if (i == src_size) {
+            break;
+        }
+
+        hilet [cp, length] = utf16_decode(src + i, src_size - i);
+        if (length == 0 or dst_size - j < 1) {
+            break;
+        }
+        i += length;
+        dst[j++] = cp;
+    }
+
+    return {i, j};
+}
+
+utf_transcode_result utf32_to_utf8(char32_t const *src, size_t src_size, char *dst, size_t dst_size)
+{
+    auto i = 0_uz;
+    auto j = 0_uz;
+    while (i != src_size) {
+#if HI_CPU_DISPATCH_LEVEL >= 2
+        while (src_size - i >= 4 and dst_size - j >= 16) {
+            hilet input = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+            hilet bmp = static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(utf32_is_bmp(input))));
+            hilet n = static_cast<size_t>(std::countr_one(bmp));
+            if (n == 0) {
+                break;
+            }
+            j += utf8_encode4(input, n, dst + j);
+            i += n;
+        }
+#endif
+        if (i == src_size) {
+            break;
+        }
+
+        hilet cp = src[i];
+        if (not utf32_is_valid(cp) or dst_size - j < utf8_size(cp)) {
+            break;
+        }
+        i += 1;
+        j += utf8_encode(cp, dst + j);
+    }
+
+    return {i, j};
+}
+
+utf_transcode_result utf32_to_utf16(char32_t const *src, size_t src_size, char16_t *dst, size_t dst_size)
+{
+    auto i = 0_uz;
+    auto j = 0_uz;
+    while (i != src_size) {
+#if HI_CPU_DISPATCH_LEVEL >= 2
+        while (src_size - i >= 8 and dst_size - j >= 8) {
+            hilet first = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i));
+            hilet second = _mm_loadu_si128(reinterpret_cast<__m128i const *>(src + i + 4));
+            hilet bmp = static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(utf32_is_bmp(first)))) |
+                (static_cast<uint32_t>(_mm_movemask_ps(_mm_castsi128_ps(utf32_is_bmp(second)))) << 4);
+            hilet n = static_cast<size_t>(std::countr_one(bmp));
+            if (n == 0) {
+                break;
+            }
+            // Code-points beyond the basic multilingual plane are saturated, but those are not counted.
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(dst + j), _mm_packus_epi32(first, second));
+            i += n;
+            j += n;
+        }
+#endif
+        if (i == src_size) {
+            break;
+        }
+
+        hilet cp = src[i];
+        if (not utf32_is_valid(cp) or dst_size - j < utf16_size(cp)) {
+            break;
+        }
+        i += 1;
+        j += utf16_encode(cp, dst + j);
+    }
+
+    return {i, j};
+}
+
+}}} // namespace hi::v1::HI_CPU_DISPATCH_NAMESPACE
+
+hi_cpu_dispatch_target_pop()
@@ -0,0 +1,306 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "utf_transcode.hpp"
+#include "char_converter.hpp"
+#include "utf_8.hpp"
+#include "utf_16.hpp"
+#include "utf_32.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <vector>
+#include <array>
+#include <cstdint>
+
+using namespace hi;
+
+namespace {
+
+constexpr auto all_sizes = std::array{0_uz, 1_uz, 7_uz, 15_uz, 16_uz, 17_uz, 31_uz, 32_uz, 33_uz, 64_uz, 100_uz, 257_uz};
+
+/** Code-points from each range of the encodings; ASCII, Cyrillic, CJK and emoji.
+ */
+constexpr auto test_code_points = std::array<char32_t, 12>{
+    U'a', U'Z', U' ', U'\u007f', U'\u0416', U'\u00e9', U'\u07ff', U'\u4e2d', U'\ufffd', U'\uffff', U'\U0001f600', U'\U0010ffff'};
+
+class text_generator {
+public:
+    explicit text_generator(uint64_t seed) noexcept : _state(seed) {}
+
+    [[nodiscard]] uint64_t next() noexcept
+    {
+        _state = _state * 6364136223846793005ULL + 1442695040888963407ULL;
+        return _state >> 33;
+    }
+
+    /** Make a text where most code-points are from a single range, like real text.
+     */
+    [[nodiscard]] std::u32string make(size_t size) noexcept
+    {
+        auto r = std::u32string{};
+        hilet main = test_code_points[next() % test_code_points.size()];
+        for (auto i = 0_uz; i != size; ++i) {
+            hilet dice = next() % 16;
+            if (dice < 10) {
+                r += main - static_cast<char32_t>(dice % 2);
+            } else if (dice < 12) {
+                r += U'a' + static_cast<char32_t>(next() % 26);
+            } else {
+                r += test_code_points[next() % test_code_points.size()];
+            }
+        }
+        return r;
+    }
+
+private:
+    uint64_t _state;
+};
+
+[[nodiscard]] std::string encode_utf8(std::u32string_view str)
+{
+    auto r = std::string{};
+    for (hilet c : str) {
+        if (c < 0x80) {
+            r += static_cast<char>(c);
+        } else if (c < 0x800) {
+            r += static_cast<char>(0xc0 | (c >> 6));
+            r += static_cast<char>(0x80 | (c & 0x3f));
+        } else if (c < 0x1'0000) {
+            r += static_cast<char>(0xe0 | (c >> 12));
+            r += static_cast<char>(0x80 | ((c >> 6) & 0x3f));
+            r += static_cast<char>(0x80 | (c & 0x3f));
+        } else {
+            r += static_cast<char>(0xf0 | (c >> 18));
+            r += static_cast<char>(0x80 | ((c >> 12) & 0x3f));
+            r += static_cast<char>(0x80 | ((c >> 6) & 0x3f));
+            r += static_cast<char>(0x80 | (c & 0x3f));
+        }
+    }
+    return r;
+}
+
+[[nodiscard]] std::u16string encode_utf16(std::u32string_view str)
+{
+    auto r = std::u16string{};
+    for (hilet c : str) {
+        if (c < 0x1'0000) {
+            r += static_cast<char16_t>(c);
+        } else {
+            r += static_cast<char16_t>(0xd800 + ((c - 0x1'0000) >> 10));
+            r += static_cast<char16_t>(0xdc00 + ((c - 0x1'0000) & 0x3ff));
+        }
+    }
+    return r;
+}
+
+/** Make the texts to test with; valid texts, and texts with an error at different positions.
+ */
+template<typename Char, typename Encode, typename Errors>
+[[nodiscard]] std::vector<std::basic_string<Char>> make_texts(Encode const& encode, Errors const& errors)
+{
+    auto r = std::vector<std::basic_string<Char>>{};
+    auto generator = text_generator{size(errors) * 31 + sizeof(Char)};
+    for (hilet size : all_sizes) {
+        for (auto i = 0; i != 4; ++i) {
+            hilet text = encode(generator.make(size));
+            r.push_back(text);
+
+            for (hilet& error : errors) {
+                auto broken = text;
+                broken.insert(generator.next() % (broken.size() + 1), error);
+                r.push_back(std::move(broken));
+            }
+
+            if (not text.empty()) {
+                // Cut the text in the middle of a code-point.
+                r.push_back(text.substr(0, text.size() - 1));
+            }
+        }
+    }
+    return r;
+}
+
+[[nodiscard]] std::vector<std::string> make_utf8_texts()
+{
+    using namespace std::literals;
+    hilet errors = std::array{
+        "\x80"s, // Continuation without a leader.
+        "\xc3"s, // Leader without a continuation.
+        "\xc0\xaf"s, // Overlong encoding of '/'.
+        "\xe0\x80\xaf"s, // Overlong encoding of '/'.
+        "\xf0\x80\x80\xaf"s, // Overlong encoding of '/'.
+        "\xed\xa0\x80"s, // Surrogate.
+        "\xf4\x90\x80\x80"s, // Beyond U+10ffff.
+        "\xf8\x88\x80\x80\x80"s, // Five code-units.
+        "\xe4\xb8"s, // Truncated code-point.
+        "\xff"s};
+    return make_texts<char>(encode_utf8, errors);
+}
+
+[[nodiscard]] std::vector<std::u16string> make_utf16_texts()
+{
+    hilet errors = std::array{
+        std::u16string{char16_t{0xd800}},
+        std::u16string{char16_t{0xdfff}},
+        std::u16string{char16_t{0xdc00}, char16_t{0xd800}},
+        std::u16string{char16_t{0xdbff}, u'a'}};
+    return make_texts<char16_t>(encode_utf16, errors);
+}
+
+[[nodiscard]] std::vector<std::u32string> make_utf32_texts()
+{
+    hilet errors = std::array{
+        std::u32string{char32_t{0xd800}},
+        std::u32string{char32_t{0xdfff}},
+        std::u32string{char32_t{0x11'0000}},
+        std::u32string{char32_t{0xffff'ffff}}};
+    hilet identity = [](std::u32string_view str) {
+        return std::u32string{str};
+    };
+    return make_texts<char32_t>(identity, errors);
+}
+
+template<typename Text>
+void check_scan(auto& kernel, std::vector<Text> const& texts)
+{
+    for (hilet& text : texts) {
+        hilet expected = kernel.get(0)(text.data(), text.size());
+        for (auto level = 1; level <= hi::cpu_dispatch_level(); ++level) {
+            hilet result = kernel.get(level)(text.data(), text.size());
+            ASSERT_EQ(result.size, expected.size) << "level=" << level << " size=" << text.size();
+            ASSERT_EQ(result.utf8_size, expected.utf8_size) << "level=" << level << " size=" << text.size();
+            ASSERT_EQ(result.utf16_size, expected.utf16_size) << "level=" << level << " size=" << text.size();
+            ASSERT_EQ(result.utf32_size, expected.utf32_size) << "level=" << level << " size=" << text.size();
+        }
+    }
+}
+
+template<typename To, typename Text>
+void check_transcode(auto& kernel, std::vector<Text> const& texts)
+{
+    for (hilet& text : texts) {
+        // Also convert into buffers that are too small, to check that the last code-point is not split.
+        for (hilet dst_capacity : {text.size() * 3 + 4, text.size() / 2 + 1}) {
+            auto expected = std::vector<To>(dst_capacity);
+            hilet expected_size = kernel.get(0)(text.data(), text.size(), expected.data(), expected.size());
+            expected.resize(expected_size.dst_size);
+
+            for (auto level = 1; level <= hi::cpu_dispatch_level(); ++level) {
+                auto result = std::vector<To>(dst_capacity);
+                hilet result_size = kernel.get(level)(text.data(), text.size(), result.data(), result.size());
+                result.resize(result_size.dst_size);
+
+                ASSERT_EQ(result_size.src_size, expected_size.src_size) << "level=" << level << " size=" << text.size();
+                ASSERT_EQ(result_size.dst_size, expected_size.dst_size) << "level=" << level << " size=" << text.size();
+                ASSERT_EQ(result, expected) << "level=" << level << " size=" << text.size();
+            }
+        }
+    }
+}
+
+} // namespace
+
+TEST(utf_transcode, utf8_scan)
+{
+    hilet text = std::string{"a\xd0\x96\xe4\xb8\xad\xf0\x9f\x98\x80"};
+    hilet r = utf8_scan.get(0)(text.data(), text.size());
+    ASSERT_EQ(r.size, 10);
+    ASSERT_EQ(r.utf8_size, 10);
+    ASSERT_EQ(r.utf16_size, 5);
+    ASSERT_EQ(r.utf32_size, 4);
+
+    // The scan stops before the incomplete code-point.
+    hilet r2 = utf8_scan.get(0)(text.data(), text.size() - 1);
+    ASSERT_EQ(r2.size, 6);
+    ASSERT_EQ(r2.utf16_size, 3);
+    ASSERT_EQ(r2.utf32_size, 3);
+
+    check_scan(utf8_scan, make_utf8_texts());
+}
+
+TEST(utf_transcode, utf16_scan)
+{
+    hilet text = std::u16string{u"aЖ中\U0001f600"};
+    hilet r = utf16_scan.get(0)(text.data(), text.size());
+    ASSERT_EQ(r.size, 5);
+    ASSERT_EQ(r.utf8_size, 10);
+    ASSERT_EQ(r.utf16_size, 5);
+    ASSERT_EQ(r.utf32_size, 4);
+
+    // The scan stops before the high surrogate without a low surrogate.
+    hilet r2 = utf16_scan.get(0)(text.data(), text.size() - 1);
+    ASSERT_EQ(r2.size, 3);
+
+    check_scan(utf16_scan, make_utf16_texts());
+}
+
+TEST(utf_transcode, utf32_scan)
+{
+    hilet text = std::u32string{U"aЖ中\U0001f600"};
+    hilet r = utf32_scan.get(0)(text.data(), text.size());
+    ASSERT_EQ(r.size, 4);
+    ASSERT_EQ(r.utf8_size, 10);
+    ASSERT_EQ(r.utf16_size, 5);
+    ASSERT_EQ(r.utf32_size, 4);
+
+    check_scan(utf32_scan, make_utf32_texts());
+}
+
+TEST(utf_transcode, utf8_to_utf16)
+{
+    check_transcode<char16_t>(utf8_to_utf16, make_utf8_texts());
+}
+
+TEST(utf_transcode, utf8_to_utf32)
+{
+    check_transcode<char32_t>(utf8_to_utf32, make_utf8_texts());
+}
+
+TEST(utf_transcode, utf16_to_utf8)
+{
+    check_transcode<char>(utf16_to_utf8, make_utf16_texts());
+}
+
+TEST(utf_transcode, utf16_to_utf32)
+{
+    check_transcode<char32_t>(utf16_to_utf32, make_utf16_texts());
+}
+
+TEST(utf_transcode, utf32_to_utf8)
+{
+    check_transcode<char>(utf32_to_utf8, make_utf32_texts());
+}
+
+TEST(utf_transcode, utf32_to_utf16)
+{
+    check_transcode<char16_t>(utf32_to_utf16, make_utf32_texts());
+}
+
+TEST(utf_transcode, round_trip)
+{
+    auto generator = text_generator{42};
+    for (hilet size : all_sizes) {
+        hilet text = generator.make(size);
+        hilet utf8 = encode_utf8(text);
+        hilet utf16 = encode_utf16(text);
+
+        ASSERT_EQ((char_converter<"utf-32", "utf-8">{}.convert<std::string>(text)), utf8);
+        ASSERT_EQ((char_converter<"utf-32", "utf-16">{}.convert<std::u16string>(text)), utf16);
+        ASSERT_EQ((char_converter<"utf-8", "utf-32">{}.convert<std::u32string>(utf8)), text);
+        ASSERT_EQ((char_converter<"utf-8", "utf-16">{}.convert<std::u16string>(utf8)), utf16);
+        ASSERT_EQ((char_converter<"utf-16", "utf-8">{}.convert<std::string>(utf16)), utf8);
+        ASSERT_EQ((char_converter<"utf-16", "utf-32">{}.convert<std::u32string>(utf16)), text);
+    }
+}
+
+TEST(utf_transcode, invalid)
+{
+    // Invalid code-units are replaced in the same way as without the kernels.
+    auto text = std::string(40, 'a');
+    text[20] = '\xff';
+    hilet replacement = char_converter<"utf-8", "utf-32">{}.convert<std::u32string>(std::string{"\xff"});
+    hilet expected = std::u32string(20, U'a') + replacement + std::u32string(19, U'a');
+    ASSERT_EQ((char_converter<"utf-8", "utf-32">{}.convert<std::u32string>(text)), expected);
+}
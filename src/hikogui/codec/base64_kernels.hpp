@@ -0,0 +1,192 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file codec/base64_kernels.hpp The base64 block kernels, compiled once for each CPU level.
+ *
+ * Only include this file from `SIMD/cpu_dispatch_kernels.hpp`.
+ *
+ * The SSSE3 and AVX2 variants use the algorithms of Wojciech Muła and Daniel Lemire,
+ * "Faster Base64 Encoding and Decoding using AVX2 Instructions".
+ */
+
+#pragma once
+
+#include "base_n.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <cstring>
+#if HI_CPU_DISPATCH_LEVEL >= 1
+#include <immintrin.h>
+#endif
+
+#ifndef HI_CPU_DISPATCH_NAMESPACE
+#error "base64_kernels.hpp must be included through cpu_dispatch_kernels.hpp"
+#endif
+
+hi_cpu_dispatch_target_push()
+
+namespace hi { inline namespace v1 { namespace HI_CPU_DISPATCH_NAMESPACE {
+
+#if HI_CPU_DISPATCH_LEVEL >= 2
+/** Convert the 6-bit values in the bytes of @a indices to characters of the base64 alphabet.
+ */
+[[nodiscard]] hi_force_inline __m128i base64_encode_lookup(__m128i indices) noexcept
+{
+    // 0-25 map to 13, 26-51 to 0, 52-61 to 1-10, 62 to 11 and 63 to 12.
+    auto r = _mm_subs_epu8(indices, _mm_set1_epi8(51));
+    hilet less = _mm_cmpgt_epi8(_mm_set1_epi8(26), indices);
+    r = _mm_or_si128(r, _mm_and_si128(less, _mm_set1_epi8(13)));
+
+    hilet offsets = _mm_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0);
+    return _mm_add_epi8(_mm_shuffle_epi8(offsets, r), indices);
+}
+
+/** Split each group of 3 bytes, from the first 12 bytes of @a in, into 4 bytes holding 6 bits each.
+ */
+[[nodiscard]] hi_force_inline __m128i base64_encode_split(__m128i in) noexcept
+{
+    in = _mm_shuffle_epi8(in, _mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1));
+    hilet t0 = _mm_mulhi_epu16(_mm_and_si128(in, _mm_set1_epi32(0x0fc0fc00)), _mm_set1_epi32(0x04000040));
+    hilet t1 = _mm_mullo_epi16(_mm_and_si128(in, _mm_set1_epi32(0x003f03f0)), _mm_set1_epi32(0x01000010));
+    return _mm_or_si128(t0, t1);
+}
+
+/** Convert 16 characters to their 6-bit values.
+ *
+ * @param[out] values The 6-bit values.
+ * @return True when all characters are in the base64 alphabet.
+ */
+[[nodiscard]] hi_force_inline bool base64_decode_lookup(__m128i in, __m128i& values) noexcept
+{
+    hilet hi_nibbles = _mm_and_si128(_mm_srli_epi32(in, 4), _mm_set1_epi8(0x0f));
+    hilet lo_nibbles = _mm_and_si128(in, _mm_set1_epi8(0x0f));
+
+    hilet lut_lo = _mm_setr_epi8(0x15, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x11, 0x13, 0x1a, 0x1b, 0x1b, 0x1b, 0x1a);
+    hilet lut_hi = _mm_setr_epi8(0x10, 0x10, 0x01, 0x02, 0x04, 0x08, 0x04, 0x08, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10, 0x10);
+    hilet lut_roll = _mm_setr_epi8(0, 16, 19, 4, -65, -65, -71, -71, 0, 0, 0, 0, 0, 0, 0, 0);
+
+    hilet lo = _mm_shuffle_epi8(lut_lo, lo_nibbles);
+    hilet hi = _mm_shuffle_epi8(lut_hi, hi_nibbles);
+    if (not _mm_testz_si128(lo, hi)) {
+        return false;
+    }
+
+    hilet eq_slash = _mm_cmpeq_epi8(in, _mm_set1_epi8('/'));
+    hilet roll = _mm_shuffle_epi8(lut_roll, _mm_add_epi8(eq_slash, hi_nibbles));
+    values = _mm_add_epi8(in, roll);
+    return true;
+}
+
+/** Pack 16 6-bit values into 12 bytes, in the low 12 bytes of the result.
+ */
+[[nodiscard]] hi_force_inline __m128i base64_decode_pack(__m128i values) noexcept
+{
+    hilet merged = _mm_maddubs_epi16(values, _mm_set1_epi32(0x01400140));
+    hilet packed = _mm_madd_epi16(merged, _mm_set1_epi32(0x00011000));
+    return _mm_shuffle_epi8(packed, _mm_setr_epi8(2, 1, 0, 6, 5, 4, 10, 9, 8, 14, 13, 12, -1, -1, -1, -1));
+}
+#endif
+
+#if HI_CPU_DISPATCH_LEVEL >= 3
+[[nodiscard]] hi_force_inline __m256i base64_encode_lookup(__m256i indices) noexcept
+{
+    auto r = _mm256_subs_epu8(indices, _mm256_set1_epi8(51));
+    hilet less = _mm256_cmpgt_epi8(_mm256_set1_epi8(26), indices);
+    r = _mm256_or_si256(r, _mm256_and_si256(less, _mm256_set1_epi8(13)));
+
+    hilet offsets = _mm256_broadcastsi128_si256(_mm_setr_epi8(
+        'a' - 26, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52, '0' - 52,
+        '0' - 52, '0' - 52, '0' - 52, '+' - 62, '/' - 63, 'A', 0, 0));
+    return _mm256_add_epi8(_mm256_shuffle_epi8(offsets, r), indices);
+}
+
+[[nodiscard]] hi_force_inline __m256i base64_encode_split(__m256i in) noexcept
+{
+    in = _mm256_shuffle_epi8(
+        in,
+        _mm256_broadcastsi128_si256(_mm_set_epi8(10, 11, 9, 10, 7, 8, 6, 7, 4, 5, 3, 4, 1, 2, 0, 1)));
+    hilet t0 = _mm256_mulhi_epu16(_mm256_and_si256(in, _mm256_set1_epi32(0x0fc0fc00)), _mm256_set1_epi32(0x04000040));
+    hilet t1 = _mm256_mullo_epi16(_mm256_and_si256(in, _mm256_set1_epi32(0x003f03f0)), _mm256_set1_epi32(0x01000010));
+    return _mm256_or_si256(t0, t1);
+}
+#endif
+
+std::size_t base64_encode(char *r, std::byte const *a, std::size_t size)
+{
+    hilet& alphabet = detail::base64_rfc4648_alphabet;
+
+    auto i = 0_uz;
+    auto j = 0_uz;
+#if HI_CPU_DISPATCH_LEVEL >= 3
+    // Each lane reads 16 bytes and uses the first 12 of them.
+    for (; i + 28 <= size; i += 24, j += 32) {
+        hilet lo = _mm_loadu_si128(reinterpret_cast<__m128i const *>(a + i));
+        hilet hi = _mm_loadu_si128(reinterpret_cast<__m128i const *>(a + i + 12));
+        hilet in = _mm256_inserti128_si256(_mm256_castsi128_si256(lo), hi, 1);
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(r + j), base64_encode_lookup(base64_encode_split(in)));
+    }
+#endif
+#if HI_CPU_DISPATCH_LEVEL >= 2
+    for (; i + 16 <= size; i += 12, j += 16) {
+        hilet in = _mm_loadu_si128(reinterpret_cast<__m128i const *>(a + i));
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(r + j), base64_encode_lookup(base64_encode_split(in)));
+    }
+#endif
+    for (; i + 3 <= size; i += 3, j += 4) {
+        hilet block = (static_cast<uint32_t>(a[i]) << 16) | (static_cast<uint32_t>(a[i + 1]) << 8) |
+            static_cast<uint32_t>(a[i + 2]);
+        r[j] = alphabet.char_from_int_table[(block >> 18) & 0x3f];
+        r[j + 1] = alphabet.char_from_int_table[(block >> 12) & 0x3f];
+        r[j + 2] = alphabet.char_from_int_table[(block >> 6) & 0x3f];
+        r[j + 3] = alphabet.char_from_int_table[block & 0x3f];
+    }
+    return i;
+}
+
+std::size_t base64_decode(std::byte *r, char const *a, std::size_t size)
+{
+    hilet& alphabet = detail::base64_rfc4648_alphabet;
+
+    auto i = 0_uz;
+    auto j = 0_uz;
+#if HI_CPU_DISPATCH_LEVEL >= 2
+    for (; i + 16 <= size; i += 16, j += 12) {
+        auto values = __m128i{};
+        if (not base64_decode_lookup(_mm_loadu_si128(reinterpret_cast<__m128i const *>(a + i)), values)) {
+            // Decode the blocks before the character that is not in the alphabet one at a time.
+            break;
+        }
+
+        hilet packed = base64_decode_pack(values);
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(r + j), packed);
+        hilet last = static_cast<uint32_t>(_mm_cvtsi128_si32(_mm_srli_si128(packed, 8)));
+        std::memcpy(r + j + 8, &last, sizeof(last));
+    }
+#endif
+    for (; i + 4 <= size; i += 4, j += 3) {
+        hilet d0 = alphabet.int_from_char(a[i]);
+        hilet d1 = alphabet.int_from_char(a[i + 1]);
+        hilet d2 = alphabet.int_from_char(a[i + 2]);
+        hilet d3 = alphabet.int_from_char(a[i + 3]);
+        if ((d0 | d1 | d2 | d3) < 0) {
+            // White-space, padding or an invalid character is handled by the caller.
+            break;
+        }
+
+        hilet block = (static_cast<uint32_t>(d0) << 18) | (static_cast<uint32_t>(d1) << 12) |
+            (static_cast<uint32_t>(d2) << 6) | static_cast<uint32_t>(d3);
+        r[j] = static_cast<std::byte>(block >> 16);
+        r[j + 1] = static_cast<std::byte>(block >> 8);
+        r[j + 2] = static_cast<std::byte>(block);
+    }
+    return i;
+}
+
+}}} // namespace hi::v1::HI_CPU_DISPATCH_NAMESPACE
+
+hi_cpu_dispatch_target_pop()
@@ -5,6 +5,7 @@
 #pragma once
 
 #include "../container/module.hpp"
+#include "../SIMD/cpu_dispatch.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
 #include <span>
@@ -13,6 +14,8 @@
 #include <string>
 #include <string_view>
 #include <bit>
+#include <iterator>
+#include <type_traits>
 
 hi_export_module(hikogui.codec.base_n);
 
@@ -113,6 +116,68 @@ constexpr auto base85_btoa_alphabet =
 
 } // namespace detail
 
+/** The signature of the base64_encode() kernel.
+ *
+ * Encode whole blocks of 3 bytes into 4 characters of the RFC 4648 base64 alphabet.
+ *
+ * @param r The output, room for `size / 3 * 4` characters.
+ * @param a The bytes to encode.
+ * @param size The number of bytes to encode.
+ * @return The number of bytes that were encoded, `size` rounded down to a multiple of 3.
+ */
+using base64_encode_type = std::size_t(char *r, std::byte const *a, std::size_t size);
+
+/** The signature of the base64_decode() kernel.
+ *
+ * Decode whole blocks of 4 characters of the RFC 4648 base64 alphabet into 3 bytes.
+ * Decoding stops before the first block that contains white-space, padding or an
+ * invalid character, so that the caller can continue with the generic decoder.
+ *
+ * @param r The output, room for `size / 4 * 3` bytes.
+ * @param a The characters to decode.
+ * @param size The number of characters.
+ * @return The number of characters that were decoded, a multiple of 4.
+ */
+using base64_decode_type = std::size_t(std::byte *r, char const *a, std::size_t size);
+
+#if HI_PROCESSOR == HI_CPU_X64
+namespace cpu_x64v1 {
+base64_encode_type base64_encode;
+base64_decode_type base64_decode;
+}
+namespace cpu_x64v2 {
+base64_encode_type base64_encode;
+base64_decode_type base64_decode;
+}
+namespace cpu_x64v3 {
+base64_encode_type base64_encode;
+base64_decode_type base64_decode;
+}
+namespace cpu_x64v4 {
+base64_encode_type base64_encode;
+base64_decode_type base64_decode;
+}
+
+hi_export inline cpu_dispatch<base64_encode_type> base64_encode = {
+    cpu_x64v1::base64_encode,
+    cpu_x64v2::base64_encode,
+    cpu_x64v3::base64_encode,
+    cpu_x64v4::base64_encode};
+hi_export inline cpu_dispatch<base64_decode_type> base64_decode = {
+    cpu_x64v1::base64_decode,
+    cpu_x64v2::base64_decode,
+    cpu_x64v3::base64_decode,
+    cpu_x64v4::base64_decode};
+#else
+namespace cpu_generic {
+base64_encode_type base64_encode;
+base64_decode_type base64_decode;
+}
+
+hi_export inline cpu_dispatch<base64_encode_type> base64_encode{cpu_generic::base64_encode};
+hi_export inline cpu_dispatch<base64_decode_type> base64_decode{cpu_generic::base64_decode};
+#endif
+
 template<detail::base_n_alphabet Alphabet, int CharsPerBlock, int BytesPerBlock>
 class base_n {
 public:
@@ -124,6 +189,11 @@ public:
     static_assert(bytes_per_block != 0, "radix must be 16, 32, 64 or 85");
     static_assert(chars_per_block != 0, "radix must be 16, 32, 64 or 85");
 
+    /** The RFC 4648 base64 alphabet is encoded and decoded by the base64 kernels.
+     */
+    constexpr static bool use_base64_kernels =
+        radix == 64 and alphabet.char_from_int_table[62] == '+' and alphabet.char_from_int_table[63] == '/';
+
     template<typename T>
     constexpr static T int_from_char(char c) noexcept
     {
@@ -186,6 +256,14 @@ public:
      */
     constexpr static std::string encode(std::span<std::byte const> bytes) noexcept
     {
+        if constexpr (use_base64_kernels) {
+            if (not std::is_constant_evaluated()) {
+                auto r = std::string(bytes.size() / 3 * 4, '\0');
+                hilet num_encoded = base64_encode(r.data(), bytes.data(), bytes.size());
+                encode(begin(bytes) + num_encoded, end(bytes), std::back_inserter(r));
+                return r;
+            }
+        }
         return encode(begin(bytes), end(bytes));
     }
 
@@ -237,7 +315,16 @@ public:
     static bstring decode(std::string_view str)
     {
         auto r = bstring{};
-        auto i = decode(begin(str), end(str), std::back_inserter(r));
+        auto first = begin(str);
+        if constexpr (use_base64_kernels) {
+            r.resize(str.size() / 4 * 3);
+            hilet num_decoded = base64_decode(r.data(), str.data(), str.size());
+            r.resize(num_decoded / 4 * 3);
+            first += num_decoded;
+        }
+
+        // Continue after the blocks that were decoded by the kernel, at a block boundary.
+        auto i = decode(first, end(str), std::back_inserter(r));
         hi_check(i == end(str), "base-n encoded string not completely decoded");
         return r;
     }
@@ -60,3 +60,71 @@ TEST(base_n, base64_decode)
     ASSERT_EQ(base64::decode("SGVsb G8g\nV29ybGQK"), to_bstring("Hello World\n"));
     ASSERT_THROW(base64::decode("SGVsbG8g,V29ybGQK"), parse_error);
 }
+
+TEST(base_n, base64_long)
+{
+    // Long enough for the vectorized kernels, with a tail that is not a whole block.
+    auto bytes = bstring{};
+    for (auto i = 0; i != 1000; ++i) {
+        bytes += static_cast<std::byte>(i * 37 + i / 7);
+    }
+
+    for (auto size = 0_uz; size != 100; ++size) {
+        hilet data = bytes.substr(0, size);
+        hilet encoded = base64::encode(data);
+        ASSERT_EQ(encoded.size(), (size + 2) / 3 * 4);
+        ASSERT_EQ(base64::decode(encoded), data) << "size=" << size;
+    }
+
+    hilet encoded = base64::encode(bytes);
+    ASSERT_EQ(base64::decode(encoded), bytes);
+
+    // White-space in the middle of the encoded data.
+    auto wrapped = encoded;
+    for (auto i = wrapped.size() / 76 * 76; i != 0; i -= 76) {
+        wrapped.insert(i, "\n");
+    }
+    ASSERT_EQ(base64::decode(wrapped), bytes);
+
+    // An invalid character after data that was decoded by the kernel.
+    auto invalid = encoded;
+    invalid[500] = ',';
+    ASSERT_THROW(base64::decode(invalid), parse_error);
+}
+
+TEST(base_n, base64_cpu_levels)
+{
+    auto bytes = bstring{};
+    for (auto i = 0; i != 200; ++i) {
+        bytes += static_cast<std::byte>(i * 101 + 7);
+    }
+    hilet chars = base64::encode(bytes);
+
+    // Each variant of the kernels gives the same result as the generic variant.
+    for (auto level = 1; level <= hi::cpu_dispatch_level(); ++level) {
+        for (auto size = 0_uz; size != bytes.size(); ++size) {
+            auto expected = std::string(size / 3 * 4, '\0');
+            auto result = std::string(size / 3 * 4, '\0');
+            ASSERT_EQ(base64_encode.get(0)(expected.data(), bytes.data(), size), size / 3 * 3);
+            ASSERT_EQ(base64_encode.get(level)(result.data(), bytes.data(), size), size / 3 * 3);
+            ASSERT_EQ(result, expected) << "level=" << level << " size=" << size;
+        }
+
+        for (auto size = 0_uz; size != chars.size(); ++size) {
+            auto expected = bstring(size / 4 * 3, std::byte{0});
+            auto result = bstring(size / 4 * 3, std::byte{0});
+            ASSERT_EQ(base64_decode.get(0)(expected.data(), chars.data(), size), size / 4 * 4);
+            ASSERT_EQ(base64_decode.get(level)(result.data(), chars.data(), size), size / 4 * 4);
+            ASSERT_EQ(result, expected) << "level=" << level << " size=" << size;
+        }
+
+        // The kernels stop before a block with a character outside of the alphabet.
+        for (auto position = 0_uz; position != 64; ++position) {
+            auto text = chars.substr(0, 64);
+            text[position] = '=';
+            auto result = bstring(48, std::byte{0});
+            ASSERT_EQ(base64_decode.get(level)(result.data(), text.data(), text.size()), position / 4 * 4)
+                << "level=" << level << " position=" << position;
+        }
+    }
+}
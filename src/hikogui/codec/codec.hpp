@@ -12,6 +12,7 @@
 #include "jsonpath.hpp" // export
 #include "pickle.hpp" // export
 #include "png.hpp" // export
+#include "png_unfilter.hpp" // export
 #include "SHA2.hpp" // export
 #include "zlib.hpp" // export
 
@@ -12,6 +12,7 @@
 #include "../parser/parser.hpp"
 #include "../macros.hpp"
 #include "zlib.hpp"
+#include "png_unfilter.hpp"
 #include <span>
 #include <vector>
 #include <cstddef>
@@ -156,26 +157,6 @@ private:
         throw parse_error("string is not null terminated.");
     }
 
-    static uint8_t paeth_predictor(uint8_t _a, uint8_t _b, uint8_t _c) noexcept
-    {
-        hilet a = static_cast<int>(_a);
-        hilet b = static_cast<int>(_b);
-        hilet c = static_cast<int>(_c);
-
-        hilet p = a + b - c;
-        hilet pa = std::abs(p - a);
-        hilet pb = std::abs(p - b);
-        hilet pc = std::abs(p - c);
-
-        if (pa <= pb && pa <= pc) {
-            return narrow_cast<uint8_t>(a);
-        } else if (pb <= pc) {
-            return narrow_cast<uint8_t>(b);
-        } else {
-            return narrow_cast<uint8_t>(c);
-        }
-    }
-
     static uint16_t get_sample(std::span<std::byte const> bytes, ssize_t& offset, bool two_bytes)
     {
         uint16_t value = static_cast<uint8_t>(bytes[offset++]);
@@ -428,59 +409,12 @@ private:
 
     void unfilter_line(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const
     {
-        switch (line[0]) {
-        case 0:
-            return;
-        case 1:
-            return unfilter_line_sub(line.subspan(1, _bytes_per_line), prev_line);
-        case 2:
-            return unfilter_line_up(line.subspan(1, _bytes_per_line), prev_line);
-        case 3:
-            return unfilter_line_average(line.subspan(1, _bytes_per_line), prev_line);
-        case 4:
-            return unfilter_line_paeth(line.subspan(1, _bytes_per_line), prev_line);
-        default:
+        hilet filter = line[0];
+        if (filter > 4) {
             throw parse_error("Unknown line-filter type");
         }
-    }
-
-    void unfilter_line_sub(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
-    {
-        for (int i = 0; i != _bytes_per_line; ++i) {
-            hilet j = i - _bytes_per_pixel;
-
-            uint8_t prev_raw = j >= 0 ? line[j] : 0;
-            line[i] += prev_raw;
-        }
-    }
-
-    void unfilter_line_up(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
-    {
-        for (int i = 0; i != _bytes_per_line; ++i) {
-            line[i] += prev_line[i];
-        }
-    }
-
-    void unfilter_line_average(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
-    {
-        for (int i = 0; i != _bytes_per_line; ++i) {
-            hilet j = i - _bytes_per_pixel;
-
-            uint8_t prev_raw = j >= 0 ? line[j] : 0;
-            line[i] += (prev_raw + prev_line[i]) / 2;
-        }
-    }
 
-    void unfilter_line_paeth(std::span<uint8_t> line, std::span<uint8_t const> prev_line) const noexcept
-    {
-        for (int i = 0; i != _bytes_per_line; ++i) {
-            hilet j = i - _bytes_per_pixel;
-
-            uint8_t const up = prev_line[i];
-            uint8_t const left = j >= 0 ? line[j] : 0;
-            uint8_t const left_up = j >= 0 ? prev_line[j] : 0;
-            line[i] += paeth_predictor(left, up, left_up);
-        }
+        png_unfilter_line(filter, line.subspan(1, _bytes_per_line), prev_line, narrow_cast<size_t>(_bytes_per_pixel));
     }
 
     void data_to_image(bstring bytes, pixmap_span<sfloat_rgba16> image) const noexcept
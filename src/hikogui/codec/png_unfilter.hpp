@@ -0,0 +1,56 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file codec/png_unfilter.hpp Reverse the PNG line filters.
+ */
+
+#pragma once
+
+#include "../SIMD/cpu_dispatch.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.codec.png_unfilter);
+
+namespace hi { inline namespace v1 {
+
+/** The signature of the png_unfilter_line() kernel.
+ *
+ * @param filter The filter type of the line: 0 = none, 1 = sub, 2 = up, 3 = average, 4 = paeth.
+ * @param line The bytes of the line to unfilter in-place, excluding the filter-type byte.
+ * @param prev_line The unfiltered bytes of the previous line, or all zeros for the first line.
+ * @param bytes_per_pixel The distance in bytes to the corresponding byte of the pixel on the left.
+ */
+using png_unfilter_line_type = void(uint8_t filter, std::span<uint8_t> line, std::span<uint8_t const> prev_line, size_t bytes_per_pixel);
+
+#if HI_PROCESSOR == HI_CPU_X64
+namespace cpu_x64v1 {
+png_unfilter_line_type png_unfilter_line;
+}
+namespace cpu_x64v2 {
+png_unfilter_line_type png_unfilter_line;
+}
+namespace cpu_x64v3 {
+png_unfilter_line_type png_unfilter_line;
+}
+namespace cpu_x64v4 {
+png_unfilter_line_type png_unfilter_line;
+}
+
+hi_export inline cpu_dispatch<png_unfilter_line_type> png_unfilter_line = {
+    cpu_x64v1::png_unfilter_line,
+    cpu_x64v2::png_unfilter_line,
+    cpu_x64v3::png_unfilter_line,
+    cpu_x64v4::png_unfilter_line};
+#else
+namespace cpu_generic {
+png_unfilter_line_type png_unfilter_line;
+}
+
+hi_export inline cpu_dispatch<png_unfilter_line_type> png_unfilter_line{cpu_generic::png_unfilter_line};
+#endif
+
+}} // namespace hi::v1
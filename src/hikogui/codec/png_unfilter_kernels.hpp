@@ -0,0 +1,113 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file codec/png_unfilter_kernels.hpp The png_unfilter_line() kernel, compiled once for each CPU level.
+ *
+ * Only include this file from `SIMD/cpu_dispatch_kernels.hpp`.
+ */
+
+#pragma once
+
+#include "png_unfilter.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <cstdint>
+#include <cstdlib>
+#if HI_CPU_DISPATCH_LEVEL >= 1
+#include <immintrin.h>
+#endif
+
+#ifndef HI_CPU_DISPATCH_NAMESPACE
+#error "png_unfilter_kernels.hpp must be included through cpu_dispatch_kernels.hpp"
+#endif
+
+hi_cpu_dispatch_target_push()
+
+namespace hi { inline namespace v1 { namespace HI_CPU_DISPATCH_NAMESPACE {
+
+[[nodiscard]] hi_force_inline uint8_t png_paeth_predictor(uint8_t a, uint8_t b, uint8_t c) noexcept
+{
+    hilet p = int{a} + int{b} - int{c};
+    hilet pa = std::abs(p - int{a});
+    hilet pb = std::abs(p - int{b});
+    hilet pc = std::abs(p - int{c});
+
+    // Branch-free so that the compiler can use conditional moves.
+    hilet b_or_c = pb <= pc ? b : c;
+    return pa <= pb and pa <= pc ? a : b_or_c;
+}
+
+void png_unfilter_line(uint8_t filter, std::span<uint8_t> line, std::span<uint8_t const> prev_line, size_t bytes_per_pixel)
+{
+    hi_axiom(line.size() == prev_line.size());
+    hi_axiom(bytes_per_pixel != 0);
+
+    hilet size = line.size();
+    hilet first_size = std::min(bytes_per_pixel, size);
+    auto *hi_restrict p = line.data();
+    auto const *hi_restrict q = prev_line.data();
+
+    switch (filter) {
+    case 0:
+        return;
+
+    case 1:
+        // sub: the first pixel has a zero pixel on its left.
+        for (auto i = bytes_per_pixel; i < size; ++i) {
+            p[i] += p[i - bytes_per_pixel];
+        }
+        return;
+
+    case 2: {
+        // up: there is no dependency between bytes of the same line.
+        auto i = 0_uz;
+#if HI_CPU_DISPATCH_LEVEL >= 3
+        for (; i + 32 <= size; i += 32) {
+            hilet a = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(p + i));
+            hilet b = _mm256_loadu_si256(reinterpret_cast<__m256i const *>(q + i));
+            _mm256_storeu_si256(reinterpret_cast<__m256i *>(p + i), _mm256_add_epi8(a, b));
+        }
+#endif
+#if HI_CPU_DISPATCH_LEVEL >= 1
+        for (; i + 16 <= size; i += 16) {
+            hilet a = _mm_loadu_si128(reinterpret_cast<__m128i const *>(p + i));
+            hilet b = _mm_loadu_si128(reinterpret_cast<__m128i const *>(q + i));
+            _mm_storeu_si128(reinterpret_cast<__m128i *>(p + i), _mm_add_epi8(a, b));
+        }
+#endif
+        for (; i != size; ++i) {
+            p[i] += q[i];
+        }
+        return;
+    }
+
+    case 3:
+        // average: the first pixel has a zero pixel on its left.
+        for (auto i = 0_uz; i != first_size; ++i) {
+            p[i] += q[i] >> 1;
+        }
+        for (auto i = first_size; i != size; ++i) {
+            p[i] += (p[i - bytes_per_pixel] + q[i]) >> 1;
+        }
+        return;
+
+    case 4:
+        // paeth: the first pixel has zero pixels on its left; the predictor then always selects up.
+        for (auto i = 0_uz; i != first_size; ++i) {
+            p[i] += q[i];
+        }
+        for (auto i = first_size; i != size; ++i) {
+            p[i] += png_paeth_predictor(p[i - bytes_per_pixel], q[i], q[i - bytes_per_pixel]);
+        }
+        return;
+
+    default:
+        hi_no_default();
+    }
+}
+
+}}} // namespace hi::v1::HI_CPU_DISPATCH_NAMESPACE
+
+hi_cpu_dispatch_target_pop()
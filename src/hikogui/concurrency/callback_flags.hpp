@@ -31,6 +31,14 @@ enum class callback_flags {
     /** Call the function once, then automatically unsubscribe.
      */
     once = 0x1'00,
+
+    /** Coalesce notifications that have not been delivered yet.
+     *
+     * When the notifier is triggered multiple times before the asynchronous
+     * callback is called, the callback is only called once with the arguments
+     * of the latest notification. This flag is ignored for synchronous callbacks.
+     */
+    coalesce = 0x2'00,
 };
 
 [[nodiscard]] constexpr callback_flags operator|(callback_flags const &lhs, callback_flags const &rhs) noexcept
@@ -44,6 +52,11 @@ enum class callback_flags {
     return to_bool(std::to_underlying(rhs) & std::to_underlying(callback_flags::once));
 }
 
+[[nodiscard]] constexpr bool is_coalesce(callback_flags const& rhs) noexcept
+{
+    return to_bool(std::to_underlying(rhs) & std::to_underlying(callback_flags::coalesce));
+}
+
 [[nodiscard]] constexpr bool is_synchronous(callback_flags const& rhs) noexcept
 {
     return to_bool((std::to_underlying(rhs) & 0xff) == std::to_underlying(callback_flags::synchronous));
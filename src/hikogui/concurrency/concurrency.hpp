@@ -11,6 +11,7 @@
 #include "rcu.hpp" // export
 #include "subsystem.hpp" // export
 #include "thread.hpp" // export
+#include "thread_pool.hpp" // export
 #include "unfair_mutex.hpp" // export
 #include "unfair_recursive_mutex.hpp" // export
 #include "wfree_idle_count.hpp" // export
@@ -7,12 +7,17 @@
 #include "../utility/utility.hpp"
 #include "unfair_mutex.hpp"
 #include "callback_flags.hpp"
+#include "rcu.hpp"
 #include "../macros.hpp"
 #include <vector>
 #include <tuple>
 #include <functional>
 #include <coroutine>
 #include <mutex>
+#include <memory>
+#include <atomic>
+#include <optional>
+#include <utility>
 
 
 
@@ -126,9 +131,12 @@ public:
     subscribe(forward_of<callback_proto> auto&& callback, callback_flags flags = callback_flags::synchronous) noexcept
     {
         auto token = std::make_shared<function_type>(hi_forward(callback));
+        auto subscriber = std::make_shared<subscriber_type>(token, flags);
 
         hilet lock = std::scoped_lock(_mutex);
-        _callbacks.emplace_back(token, flags);
+        auto new_subscribers = copy_subscribers();
+        new_subscribers.push_back(std::move(subscriber));
+        _subscribers.emplace(std::move(new_subscribers));
         return token;
     }
 
@@ -141,97 +149,184 @@ public:
 
     /** Call the subscribed callbacks with the given arguments.
      *
-     * @note This function is not reentrant.
+     * The list of subscribers is read through RCU, so that calling the notifier
+     * does not take a lock and may be done from multiple threads. A callback
+     * may subscribe or unsubscribe while being called.
+     *
      * @param args The arguments to pass with the invocation of the callback
      */
     void operator()(Args const&...args) const noexcept
     {
-        hilet lock = std::scoped_lock(_mutex);
-
-        for (auto& callback : _callbacks) {
-            if (is_synchronous(callback.flags)) {
-                if (auto func = callback.lock()) {
-                    (*func)(args...);
-                }
-
-            } else if (is_local(callback.flags)) {
-                loop_local_post_function([=] {
-                    if (auto func = callback.lock()) {
-                        (*func)(args...);
-                    }
-                });
-
-            } else if (is_main(callback.flags)) {
-                loop_main_post_function([=] {
-                    if (auto func = callback.lock()) {
-                        (*func)(args...);
-                    }
-                });
-
-            } else if (is_timer(callback.flags)) {
-                loop_timer_post_function([=] {
-                    if (auto func = callback.lock()) {
-                        (*func)(args...);
-                    }
-                });
+        auto expired = false;
 
-            } else {
-                hi_no_default();
+        _subscribers.lock();
+        if (hilet subscribers = _subscribers.get()) {
+            for (hilet& subscriber : *subscribers) {
+                expired |= notify(subscriber, args...);
             }
+        }
+        _subscribers.unlock();
 
-            // If the callback should only be triggered once, like inside an awaitable.
-            // Then reset the weak_ptr in _callbacks so that it will be cleaned up.
-            // In the lambda above the weak_ptr is copied first so that it callback will get executed
-            // as long as the shared_ptr's use count does not go to zero.
-            if (is_once(callback.flags)) {
-                callback.reset();
-            }
+        if (expired) {
+            clean_up();
         }
-        clean_up();
     }
 
 private:
-    struct callback_type {
+    /** The arguments of the latest notification of a coalesced callback.
+     *
+     * The arguments are empty when the posted function has already taken them.
+     */
+    struct coalesced_arguments_type {
+        unfair_mutex mutex;
+        std::optional<std::tuple<Args...>> arguments;
+    };
+
+    struct subscriber_type {
         weak_callback_token token;
         callback_flags flags;
 
-        [[nodiscard]] bool expired() const noexcept
-        {
-            return token.expired();
-        }
+        /** A callback with the `once` flag has been triggered.
+         */
+        std::atomic<bool> triggered = false;
+
+        /** A coalesced callback has been posted, but has not been called yet.
+         */
+        std::atomic<bool> pending = false;
 
-        void reset() noexcept
+        /** The arguments of the latest notification, only allocated for a coalesced callback.
+         */
+        std::unique_ptr<coalesced_arguments_type> coalesced;
+
+        subscriber_type(weak_callback_token token, callback_flags flags) noexcept : token(std::move(token)), flags(flags)
         {
-            token.reset();
+            if (is_coalesce(flags)) {
+                coalesced = std::make_unique<coalesced_arguments_type>();
+            }
         }
 
-        [[nodiscard]] callback_token lock() const noexcept
+        [[nodiscard]] bool expired() const noexcept
         {
-            return token.lock();
+            return token.expired() or (is_once(flags) and triggered.load(std::memory_order::relaxed));
         }
     };
 
+    using subscribers_type = std::vector<std::shared_ptr<subscriber_type>>;
+
+    /** Serializes the updates of the subscribers.
+     */
     mutable unfair_mutex _mutex;
 
-    /** A list of callbacks and it's associated token.
+    /** A list of subscribers, published through RCU.
      */
-    mutable std::vector<callback_type> _callbacks;
+    mutable rcu<subscribers_type> _subscribers;
 
-    void clean_up() const noexcept
+    /** Copy the subscribers that have not expired.
+     */
+    [[nodiscard]] subscribers_type copy_subscribers() const noexcept
     {
         hi_axiom(_mutex.is_locked());
 
-        // Cleanup all callbacks that have expired, or when they may only be triggered once.
-        std::erase_if(_callbacks, [](hilet& item) {
-            return item.expired();
-        });
+        auto r = subscribers_type{};
+
+        _subscribers.lock();
+        if (hilet subscribers = _subscribers.get()) {
+            r.reserve(subscribers->size() + 1);
+            for (hilet& subscriber : *subscribers) {
+                if (not subscriber->expired()) {
+                    r.push_back(subscriber);
+                }
+            }
+        }
+        _subscribers.unlock();
+        return r;
+    }
+
+    /** Remove the expired subscribers.
+     *
+     * When another thread is updating the subscribers, the clean-up is left for that thread.
+     */
+    void clean_up() const noexcept
+    {
+        if (not _mutex.try_lock()) {
+            return;
+        }
+        _subscribers.emplace(copy_subscribers());
+        _mutex.unlock();
+    }
+
+    template<typename F>
+    void post_function(callback_flags flags, F&& func) const noexcept
+    {
+        if (is_local(flags)) {
+            loop_local_post_function(std::forward<F>(func));
+        } else if (is_main(flags)) {
+            loop_main_post_function(std::forward<F>(func));
+        } else if (is_timer(flags)) {
+            loop_timer_post_function(std::forward<F>(func));
+        } else {
+            hi_no_default();
+        }
     }
 
-#ifndef NDEBUG
-    /** The notifier is currently calling all the callbacks.
+    /** Call or post a single callback.
+     *
+     * @return True if the subscriber has expired.
      */
-    mutable bool _notifying = false;
-#endif
+    bool notify(std::shared_ptr<subscriber_type> const& subscriber, Args const&...args) const noexcept
+    {
+        // If the callback should only be triggered once, like inside an awaitable.
+        // The subscriber is removed during the next clean-up.
+        if (is_once(subscriber->flags) and subscriber->triggered.exchange(true, std::memory_order::relaxed)) {
+            return true;
+        }
+
+        if (is_synchronous(subscriber->flags)) {
+            if (auto func = subscriber->token.lock()) {
+                (*func)(args...);
+            }
+
+        } else if (is_coalesce(subscriber->flags)) {
+            hi_axiom_not_null(subscriber->coalesced);
+            {
+                hilet lock = std::scoped_lock(subscriber->coalesced->mutex);
+                subscriber->coalesced->arguments.emplace(args...);
+            }
+
+            // Only post a function when the previous posted function was called, the
+            // posted function will call the callback with the latest arguments.
+            if (not subscriber->pending.exchange(true, std::memory_order::acq_rel)) {
+                post_function(subscriber->flags, [subscriber] {
+                    subscriber->pending.store(false, std::memory_order::release);
+
+                    auto arguments = [&] {
+                        hilet lock = std::scoped_lock(subscriber->coalesced->mutex);
+                        return std::exchange(subscriber->coalesced->arguments, std::nullopt);
+                    }();
+
+                    // The arguments were already taken by a function that was posted by a concurrent notification.
+                    if (not arguments) {
+                        return;
+                    }
+
+                    if (auto func = subscriber->token.lock()) {
+                        std::apply(*func, *arguments);
+                    }
+                });
+            }
+
+        } else {
+            // The weak_ptr is copied so that the callback will get executed
+            // as long as the shared_ptr's use count does not go to zero.
+            post_function(subscriber->flags, [token = subscriber->token, args...] {
+                if (auto func = token.lock()) {
+                    (*func)(args...);
+                }
+            });
+        }
+
+        return subscriber->expired();
+    }
 };
 
 } // namespace hi::inline v1
@@ -9,6 +9,7 @@
 #include <gtest/gtest.h>
 #include <iostream>
 #include <string>
+#include <vector>
 
 using namespace std;
 using namespace hi;
@@ -112,3 +113,135 @@ TEST(notifier, local_coroutine)
     ASSERT_EQ(b, 1);
     ASSERT_TRUE(cr.done());
 }
+
+TEST(notifier, local_coalesce)
+{
+    auto count = 0;
+    auto value = 0;
+
+    auto n = notifier<void(int)>{};
+
+    auto cbt = n.subscribe(
+        [&](int x) {
+            ++count;
+            value = x;
+        },
+        callback_flags::local | callback_flags::coalesce);
+
+    // Multiple notifications before the event-loop is resumed are delivered once,
+    // with the latest value.
+    for (auto i = 1; i <= 1000; ++i) {
+        n(i);
+    }
+    ASSERT_EQ(count, 0);
+
+    loop::local().resume_once();
+    ASSERT_EQ(count, 1);
+    ASSERT_EQ(value, 1000);
+
+    n(5);
+    loop::local().resume_once();
+    ASSERT_EQ(count, 2);
+    ASSERT_EQ(value, 5);
+}
+
+TEST(notifier, not_default_constructible)
+{
+    struct value_type {
+        explicit value_type(int value) noexcept : value(value) {}
+        int value;
+    };
+
+    auto synchronous_value = 0;
+    auto coalesced_value = 0;
+
+    auto n = notifier<void(value_type)>{};
+
+    auto cbt1 = n.subscribe([&](value_type x) {
+        synchronous_value = x.value;
+    });
+    auto cbt2 = n.subscribe(
+        [&](value_type x) {
+            coalesced_value = x.value;
+        },
+        callback_flags::local | callback_flags::coalesce);
+
+    n(value_type{1});
+    n(value_type{2});
+    ASSERT_EQ(synchronous_value, 2);
+    ASSERT_EQ(coalesced_value, 0);
+
+    loop::local().resume_once();
+    ASSERT_EQ(coalesced_value, 2);
+}
+
+TEST(notifier, synchronous_once)
+{
+    auto count = 0;
+
+    auto n = notifier{};
+
+    auto cbt = n.subscribe(
+        [&] {
+            ++count;
+        },
+        callback_flags::synchronous | callback_flags::once);
+
+    n();
+    n();
+    ASSERT_EQ(count, 1);
+}
+
+TEST(notifier, subscribe_from_callback)
+{
+    auto a = 0;
+    auto b = 0;
+
+    auto n = notifier{};
+    auto b_cbt = notifier<>::callback_token{};
+
+    // The subscribers may be modified while the notifier is calling the callbacks.
+    auto a_cbt = n.subscribe([&] {
+        if (++a == 1) {
+            b_cbt = n.subscribe([&] {
+                ++b;
+            });
+        }
+    });
+
+    n();
+    ASSERT_EQ(a, 1);
+    ASSERT_EQ(b, 0);
+
+    n();
+    ASSERT_EQ(a, 2);
+    ASSERT_EQ(b, 1);
+}
+
+TEST(notifier, synchronous_1_10_100_subscribers)
+{
+    // Notify repeatedly with a growing number of subscribers; calling the
+    // notifier does not take a lock, nor does it allocate.
+    for (auto num_subscribers : {1, 10, 100}) {
+        auto count = 0;
+        auto n = notifier<void(int)>{};
+
+        auto cbts = std::vector<notifier<void(int)>::callback_token>{};
+        for (auto i = 0; i != num_subscribers; ++i) {
+            cbts.push_back(n.subscribe([&](int x) {
+                count += x;
+            }));
+        }
+
+        for (auto i = 0; i != 10'000; ++i) {
+            n(1);
+        }
+        ASSERT_EQ(count, num_subscribers * 10'000);
+
+        // Unsubscribe half of the callbacks.
+        cbts.resize(num_subscribers / 2);
+        count = 0;
+        n(1);
+        ASSERT_EQ(count, num_subscribers / 2);
+    }
+}
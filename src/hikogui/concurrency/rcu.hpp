@@ -35,7 +35,25 @@ public:
      */
     constexpr rcu(allocator_type allocator = allocator_type{}) noexcept : _allocator(allocator) {}
 
-    ~rcu() = default;
+    /** Destroy the rcu object.
+     *
+     * @note No thread may hold a read-lock while the rcu object is destroyed.
+     */
+    ~rcu()
+    {
+        hi_axiom(not _idle_count.is_locked());
+
+        if (auto *const ptr = _ptr.exchange(nullptr, std::memory_order::acquire)) {
+            std::allocator_traits<allocator_type>::destroy(_allocator, ptr);
+            std::allocator_traits<allocator_type>::deallocate(_allocator, ptr, 1);
+        }
+
+        for (hilet& old_copy : _old_ptrs) {
+            std::allocator_traits<allocator_type>::destroy(_allocator, old_copy.second);
+            std::allocator_traits<allocator_type>::deallocate(_allocator, old_copy.second, 1);
+        }
+    }
+
     rcu(rcu const&) = delete;
     rcu(rcu&&) = delete;
     rcu& operator=(rcu const&) = delete;
@@ -50,6 +50,16 @@ inline unfair_mutex thread_names_mutex = {};
  */
 void set_thread_name(std::string_view name) noexcept;
 
+/** Raise the priority of the current thread to time-critical.
+ *
+ * Use this for threads that must keep up with a real-time thread, such as
+ * the workers that process audio together with the audio thread of a device.
+ *
+ * @ingroup concurrency
+ * @return True when the priority was raised.
+ */
+bool set_thread_time_critical() noexcept;
+
 /** Get the thread name of a thread id.
  *
  * This function is designed to be reasonably fast, so that it can be used
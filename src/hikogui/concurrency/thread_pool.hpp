@@ -0,0 +1,180 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "thread.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <thread>
+#include <mutex>
+#include <condition_variable>
+#include <vector>
+#include <format>
+#include <algorithm>
+#include <cstddef>
+
+namespace hi::inline v1 {
+
+/** A pool of persistent worker threads, for splitting a job over multiple CPUs.
+ *
+ * The threads are created once and sleep between jobs, so that a job that
+ * is run every frame, like rendering or resampling an image, does not pay
+ * for creating and joining threads.
+ *
+ * A job is a function that is called once on each participating thread,
+ * including the calling thread. The function itself divides the work,
+ * for example by taking tiles from an atomic counter.
+ *
+ * ```cpp
+ * auto next_tile = std::atomic<std::size_t>{0};
+ * thread_pool::global().run(num_tiles, [&](std::size_t thread_nr) {
+ *     for (auto i = next_tile.fetch_add(1); i < num_tiles; i = next_tile.fetch_add(1)) {
+ *         render_tile(i);
+ *     }
+ * });
+ * ```
+ */
+class thread_pool {
+public:
+    thread_pool(thread_pool const&) = delete;
+    thread_pool(thread_pool&&) = delete;
+    thread_pool& operator=(thread_pool const&) = delete;
+    thread_pool& operator=(thread_pool&&) = delete;
+
+    /** Create a thread pool.
+     *
+     * @param num_workers The number of worker threads, excluding the thread that calls `run()`.
+     */
+    explicit thread_pool(std::size_t num_workers)
+    {
+        _workers.reserve(num_workers);
+        for (auto i = 0_uz; i != num_workers; ++i) {
+            _workers.emplace_back([this, i] {
+                set_thread_name(std::format("pool {}", i));
+                worker_loop(i);
+            });
+        }
+    }
+
+    ~thread_pool()
+    {
+        {
+            hilet lock = std::scoped_lock(_mutex);
+            _stop = true;
+        }
+        _wake_cv.notify_all();
+        // The jthreads are joined by their destructors.
+    }
+
+    /** The thread pool shared by the library.
+     *
+     * It has a worker for each CPU except one, as the calling thread participates in each job.
+     */
+    [[nodiscard]] static thread_pool& global() noexcept
+    {
+        static auto r = thread_pool{std::max(std::thread::hardware_concurrency(), 1u) - 1};
+        return r;
+    }
+
+    /** The maximum number of threads that can run a job, including the calling thread.
+     */
+    [[nodiscard]] std::size_t concurrency() const noexcept
+    {
+        return _workers.size() + 1;
+    }
+
+    /** Run a job on multiple threads.
+     *
+     * `func(thread_nr)` is called once on each of the participating threads, `thread_nr` 0 is the
+     * calling thread. This function returns after `func` returned on every participating thread.
+     *
+     * Jobs are run one at a time. A job started from inside a job, of any thread pool, is run on
+     * the calling thread only.
+     *
+     * @param num_threads The maximum number of threads to use, including the calling thread.
+     * @param func The job, must not throw.
+     */
+    void run(std::size_t num_threads, function_ref<void(std::size_t)> func) noexcept
+    {
+        num_threads = std::min(num_threads, concurrency());
+        if (num_threads <= 1 or _in_job) {
+            return func(0);
+        }
+
+        hilet job_lock = std::scoped_lock(_job_mutex);
+        {
+            hilet lock = std::scoped_lock(_mutex);
+            _job = &func;
+            _num_job_workers = num_threads - 1;
+            _num_busy = _num_job_workers;
+            ++_generation;
+        }
+        _wake_cv.notify_all();
+
+        _in_job = true;
+        func(0);
+        _in_job = false;
+
+        auto lock = std::unique_lock(_mutex);
+        _done_cv.wait(lock, [&] {
+            return _num_busy == 0;
+        });
+        _job = nullptr;
+    }
+
+private:
+    /** Set while a thread is running a job, so that nested jobs are run on the calling thread.
+     */
+    inline static thread_local bool _in_job = false;
+
+    std::mutex _job_mutex;
+
+    std::mutex _mutex;
+    std::condition_variable _wake_cv;
+    std::condition_variable _done_cv;
+    function_ref<void(std::size_t)> *_job = nullptr;
+    std::size_t _generation = 0;
+    std::size_t _num_job_workers = 0;
+    std::size_t _num_busy = 0;
+    bool _stop = false;
+
+    std::vector<std::jthread> _workers;
+
+    void worker_loop(std::size_t worker_nr) noexcept
+    {
+        _in_job = true;
+
+        auto generation = 0_uz;
+        while (true) {
+            function_ref<void(std::size_t)> *job = nullptr;
+            {
+                auto lock = std::unique_lock(_mutex);
+                _wake_cv.wait(lock, [&] {
+                    return _stop or _generation != generation;
+                });
+                if (_stop) {
+                    return;
+                }
+
+                generation = _generation;
+                if (worker_nr >= _num_job_workers) {
+                    // This worker is not needed for this job.
+                    continue;
+                }
+                job = _job;
+            }
+
+            hi_assert_not_null(job);
+            (*job)(worker_nr + 1);
+
+            hilet lock = std::scoped_lock(_mutex);
+            if (--_num_busy == 0) {
+                _done_cv.notify_one();
+            }
+        }
+    }
+};
+
+} // namespace hi::inline v1
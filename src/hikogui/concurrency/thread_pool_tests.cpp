@@ -0,0 +1,91 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "thread_pool.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <atomic>
+#include <vector>
+#include <thread>
+
+using namespace hi;
+
+TEST(thread_pool, run)
+{
+    auto pool = thread_pool{3};
+    ASSERT_EQ(pool.concurrency(), 4);
+
+    auto calls = std::vector<std::atomic<int>>(4);
+    auto calling_thread = std::thread::id{};
+    pool.run(4, [&](std::size_t thread_nr) {
+        ++calls[thread_nr];
+        if (thread_nr == 0) {
+            calling_thread = std::this_thread::get_id();
+        }
+    });
+
+    for (hilet& count : calls) {
+        ASSERT_EQ(count.load(), 1);
+    }
+    ASSERT_EQ(calling_thread, std::this_thread::get_id());
+}
+
+TEST(thread_pool, fewer_threads)
+{
+    auto pool = thread_pool{3};
+
+    auto calls = std::vector<std::atomic<int>>(4);
+    pool.run(2, [&](std::size_t thread_nr) {
+        ++calls[thread_nr];
+    });
+    ASSERT_EQ(calls[0].load(), 1);
+    ASSERT_EQ(calls[1].load(), 1);
+    ASSERT_EQ(calls[2].load(), 0);
+    ASSERT_EQ(calls[3].load(), 0);
+
+    // More threads than the pool has are limited to the pool.
+    pool.run(100, [&](std::size_t thread_nr) {
+        ++calls[thread_nr];
+    });
+    ASSERT_EQ(calls[0].load(), 2);
+    ASSERT_EQ(calls[1].load(), 2);
+    ASSERT_EQ(calls[2].load(), 1);
+    ASSERT_EQ(calls[3].load(), 1);
+}
+
+TEST(thread_pool, divide_work)
+{
+    auto pool = thread_pool{3};
+
+    for (auto repeat = 0; repeat != 1000; ++repeat) {
+        constexpr auto num_items = 100_uz;
+        auto items = std::vector<int>(num_items);
+        auto next_item = std::atomic<std::size_t>{0};
+
+        pool.run(repeat % 5, [&](std::size_t) {
+            for (auto i = next_item.fetch_add(1); i < num_items; i = next_item.fetch_add(1)) {
+                items[i] += 1;
+            }
+        });
+
+        for (hilet item : items) {
+            ASSERT_EQ(item, 1);
+        }
+    }
+}
+
+TEST(thread_pool, nested)
+{
+    auto pool = thread_pool{3};
+
+    auto total = std::atomic<int>{0};
+    pool.run(4, [&](std::size_t) {
+        // A job inside a job is run on the calling thread only.
+        pool.run(4, [&](std::size_t thread_nr) {
+            ASSERT_EQ(thread_nr, 0);
+            ++total;
+        });
+    });
+    ASSERT_EQ(total.load(), 4);
+}
@@ -34,6 +34,11 @@ inline void set_thread_name(std::string_view name) noexcept
     detail::thread_names.emplace(current_thread_id(), std::string{name});
 }
 
+inline bool set_thread_time_critical() noexcept
+{
+    return to_bool(SetThreadPriority(GetCurrentThread(), THREAD_PRIORITY_TIME_CRITICAL));
+}
+
 inline  std::vector<bool> mask_int_to_vec(DWORD_PTR rhs) noexcept
 {
     auto r = std::vector<bool>{};
@@ -0,0 +1,162 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <list>
+#include <unordered_map>
+#include <utility>
+#include <functional>
+
+namespace hi::inline v1 {
+
+/** A least-recently-used cache.
+ *
+ * The cache holds at most `capacity()` items, when a new item is inserted
+ * in a full cache the least recently used item is evicted.
+ *
+ * @note This class is not thread-safe.
+ * @tparam Key The type of the key, must be hashable and equality comparable.
+ * @tparam Value The type of the value.
+ */
+template<typename Key, typename Value, typename Hash = std::hash<Key>, typename KeyEqual = std::equal_to<Key>>
+class lru_cache {
+public:
+    using key_type = Key;
+    using mapped_type = Value;
+    using value_type = std::pair<key_type const, mapped_type>;
+    using size_type = std::size_t;
+
+    ~lru_cache() = default;
+    lru_cache(lru_cache const&) = delete;
+    lru_cache(lru_cache&&) = delete;
+    lru_cache& operator=(lru_cache const&) = delete;
+    lru_cache& operator=(lru_cache&&) = delete;
+
+    /** Create a cache.
+     *
+     * @param capacity The maximum number of items in the cache.
+     */
+    explicit lru_cache(size_type capacity) noexcept : _capacity(capacity)
+    {
+        hi_assert(capacity > 0);
+        _map.reserve(capacity);
+    }
+
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return _map.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _map.empty();
+    }
+
+    [[nodiscard]] size_type capacity() const noexcept
+    {
+        return _capacity;
+    }
+
+    /** Find an item in the cache.
+     *
+     * The item found is marked as most recently used.
+     *
+     * @param key The key of the item to find.
+     * @return A pointer to the value, or nullptr when not found. The pointer
+     *         is valid until the next modification of the cache.
+     */
+    [[nodiscard]] mapped_type *find(key_type const& key) noexcept
+    {
+        if (hilet it = _map.find(key); it != _map.end()) {
+            // Move the item to the front of the list; iterators remain valid.
+            _list.splice(_list.begin(), _list, it->second);
+            return std::addressof(it->second->second);
+        } else {
+            return nullptr;
+        }
+    }
+
+    /** Insert or replace an item in the cache.
+     *
+     * The item is marked as most recently used, when the cache is full the
+     * least recently used item is evicted.
+     *
+     * @param key The key of the item.
+     * @param value The value of the item.
+     * @return A reference to the value in the cache. The reference is valid
+     *         until the next modification of the cache.
+     * @throws std::bad_alloc When the item could not be allocated, the cache
+     *         is left without the new item.
+     */
+    mapped_type& emplace(key_type key, mapped_type value)
+    {
+        if (hilet it = _map.find(key); it != _map.end()) {
+            _list.splice(_list.begin(), _list, it->second);
+            it->second->second = std::move(value);
+            return it->second->second;
+        }
+
+        if (_map.size() == _capacity) {
+            // Evict the least recently used item.
+            _map.erase(_list.back().first);
+            _list.pop_back();
+        }
+
+        _list.emplace_front(std::move(key), std::move(value));
+        try {
+            _map.emplace(_list.front().first, _list.begin());
+        } catch (...) {
+            _list.pop_front();
+            throw;
+        }
+        return _list.front().second;
+    }
+
+    /** Find an item, or create it.
+     *
+     * @param key The key of the item.
+     * @param func A function returning a value, called when the key was not found.
+     * @return A reference to the value in the cache. The reference is valid
+     *         until the next modification of the cache.
+     * @throws std::bad_alloc When the item could not be allocated.
+     * @throws std::exception Any exception thrown by @a func.
+     */
+    template<typename Func>
+    mapped_type& find_or_emplace(key_type const& key, Func&& func)
+    {
+        if (auto ptr = find(key)) {
+            return *ptr;
+        } else {
+            return emplace(key, std::forward<Func>(func)());
+        }
+    }
+
+    /** Remove all items from the cache.
+     */
+    void clear() noexcept
+    {
+        _map.clear();
+        _list.clear();
+    }
+
+private:
+    using list_type = std::list<value_type>;
+
+    size_type _capacity;
+
+    /** Items ordered from most recently used to least recently used.
+     */
+    list_type _list;
+
+    /** Index into the list.
+     *
+     * The key is a copy of the key in the list.
+     */
+    std::unordered_map<key_type, typename list_type::iterator, Hash, KeyEqual> _map;
+};
+
+} // namespace hi::inline v1
@@ -0,0 +1,74 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "lru_cache.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <string>
+
+using namespace hi;
+
+TEST(lru_cache, find_emplace)
+{
+    auto cache = lru_cache<int, std::string>(3);
+    ASSERT_TRUE(cache.empty());
+    ASSERT_EQ(cache.find(1), nullptr);
+
+    cache.emplace(1, "one");
+    cache.emplace(2, "two");
+    cache.emplace(3, "three");
+    ASSERT_EQ(cache.size(), 3);
+
+    ASSERT_NE(cache.find(1), nullptr);
+    ASSERT_EQ(*cache.find(1), "one");
+    ASSERT_EQ(*cache.find(2), "two");
+    ASSERT_EQ(*cache.find(3), "three");
+
+    cache.emplace(2, "TWO");
+    ASSERT_EQ(cache.size(), 3);
+    ASSERT_EQ(*cache.find(2), "TWO");
+}
+
+TEST(lru_cache, evict)
+{
+    auto cache = lru_cache<int, int>(3);
+    cache.emplace(1, 10);
+    cache.emplace(2, 20);
+    cache.emplace(3, 30);
+
+    // Touch 1, so that 2 becomes the least recently used item.
+    ASSERT_EQ(*cache.find(1), 10);
+
+    cache.emplace(4, 40);
+    ASSERT_EQ(cache.size(), 3);
+    ASSERT_EQ(cache.find(2), nullptr);
+    ASSERT_EQ(*cache.find(1), 10);
+    ASSERT_EQ(*cache.find(3), 30);
+    ASSERT_EQ(*cache.find(4), 40);
+
+    // 1 is now the least recently used item.
+    cache.emplace(5, 50);
+    ASSERT_EQ(cache.find(1), nullptr);
+
+    cache.clear();
+    ASSERT_TRUE(cache.empty());
+    ASSERT_EQ(cache.find(3), nullptr);
+}
+
+TEST(lru_cache, find_or_emplace)
+{
+    auto cache = lru_cache<int, int>(2);
+    auto num_calls = 0;
+
+    ASSERT_EQ(cache.find_or_emplace(1, [&] { ++num_calls; return 10; }), 10);
+    ASSERT_EQ(cache.find_or_emplace(1, [&] { ++num_calls; return 11; }), 10);
+    ASSERT_EQ(num_calls, 1);
+
+    ASSERT_EQ(cache.find_or_emplace(2, [&] { ++num_calls; return 20; }), 20);
+    ASSERT_EQ(cache.find_or_emplace(3, [&] { ++num_calls; return 30; }), 30);
+    ASSERT_EQ(num_calls, 3);
+
+    ASSERT_EQ(cache.find_or_emplace(1, [&] { ++num_calls; return 12; }), 12);
+    ASSERT_EQ(num_calls, 4);
+}
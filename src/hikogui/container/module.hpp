@@ -6,6 +6,7 @@
 #include "gap_buffer.hpp"
 #include "hash_map.hpp"
 #include "lean_vector.hpp"
+#include "lru_cache.hpp"
 #include "packed_int_array.hpp"
 #include "polymorphic_optional.hpp"
 #include "secure_vector.hpp"
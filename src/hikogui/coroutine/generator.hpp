@@ -11,6 +11,7 @@
 #include <memory_resource>
 #include <type_traits>
 #include "../utility/utility.hpp"
+#include "../telemetry/counters.hpp"
 #include "../macros.hpp"
 
 
@@ -37,6 +38,21 @@ public:
 
     class promise_type {
     public:
+        /** Allocate the coroutine frame.
+         *
+         * The number of allocations is counted in the "generator:allocate" counter.
+         */
+        [[nodiscard]] static void *operator new(std::size_t size)
+        {
+            ++global_counter<"generator:allocate">;
+            return ::operator new(size);
+        }
+
+        static void operator delete(void *ptr) noexcept
+        {
+            ::operator delete(ptr);
+        }
+
         generator get_return_object()
         {
             return generator{handle_type::from_promise(*this)};
@@ -232,6 +248,21 @@ public:
 
     class promise_type {
     public:
+        /** Allocate the coroutine frame.
+         *
+         * The number of allocations is counted in the "generator:allocate" counter.
+         */
+        [[nodiscard]] static void *operator new(std::size_t size)
+        {
+            ++global_counter<"generator:allocate">;
+            return ::operator new(size);
+        }
+
+        static void operator delete(void *ptr) noexcept
+        {
+            ::operator delete(ptr);
+        }
+
         generator get_return_object()
         {
             return generator{handle_type::from_promise(*this)};
@@ -14,6 +14,7 @@
 #include <concepts>
 #include <vector>
 #include <memory>
+#include <chrono>
 
 hi_export_module(hikogui.dispatch.loop : intf);
 
@@ -22,7 +23,7 @@ namespace hi::inline v1 {
 class loop {
 public:
     using timer_callback_token = function_timer<>::callback_token;
-    using render_callback_type = std::function<void(utc_nanoseconds)>;
+    using render_callback_type = std::function<void(utc_nanoseconds, std::chrono::nanoseconds)>;
     using render_callback_token = std::shared_ptr<render_callback_type>;
 
     class impl_type {
@@ -275,9 +276,10 @@ public:
 
     /** Subscribe a render function to be called on vsync.
      *
-     * @param f A function to be called when vsync occurs.
+     * @param f A function `f(vsync_time, period)` to be called when vsync occurs, with the time of
+     *          the vertical-sync and the time between two frames.
      */
-    template<std::invocable<utc_nanoseconds> F>
+    template<std::invocable<utc_nanoseconds, std::chrono::nanoseconds> F>
     render_callback_token subscribe_render(F &&f) noexcept
     {
         hi_assert_not_null(_pimpl);
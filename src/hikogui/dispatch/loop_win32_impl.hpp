@@ -314,6 +314,10 @@ private:
      */
     std::atomic<utc_nanoseconds> _vsync_time;
 
+    /** Time between two vertical blanks, or the time between wake-ups when not using vsync.
+     */
+    std::atomic<std::chrono::nanoseconds> _vsync_period = std::chrono::milliseconds(30);
+
     /** The last vsync_time update was made by a call to Sleep().
      */
     bool _vsync_time_from_sleep = true;
@@ -405,11 +409,13 @@ private:
             _vsync_time.store(std::chrono::utc_clock::now());
         }
 
-        hilet display_time = _vsync_time.load(std::memory_order::relaxed) + std::chrono::milliseconds(30);
+        hilet vsync_time = _vsync_time.load(std::memory_order::relaxed);
+        // With pull-down a frame is started on every `0x100 / pull_down` vertical blank.
+        hilet frame_period = _vsync_period.load(std::memory_order::relaxed) * 0x100 / _pull_down.load(std::memory_order::relaxed);
 
         for (auto& render_function : _render_functions) {
             if (auto render_function_ = render_function.lock()) {
-                (*render_function_)(display_time);
+                (*render_function_)(vsync_time, frame_period);
             }
         }
 
@@ -550,13 +556,19 @@ private:
             hi_log_error_once("vsync:error:WaitForVBlank", "WaitForVBlank() failed. {}", get_last_error_message());
         }
 
-        if (vsync_thread_update_time(false) < 1ms) {
+        hilet duration = vsync_thread_update_time(false);
+        if (duration < 1ms) {
             hi_log_info_once("vsync:monitor-off", "WaitForVBlank() did not block; is the monitor turned off?");
             Sleep(16);
 
             // Fixup the time after the fallback sleep.
             vsync_thread_update_time(true);
+            _vsync_period.store(16ms, std::memory_order::relaxed);
         } else {
+            if (duration < 100ms) {
+                // The duration of the first vertical blank after sleeping is unknown.
+                _vsync_period.store(duration, std::memory_order::relaxed);
+            }
             ++global_counter<"vsync:vertical-blank">;
         }
     }
@@ -598,6 +610,7 @@ private:
             case WAIT_TIMEOUT:
                 // When use_vsync is off wake the main loop every 30ms.
                 vsync_thread_update_time(true);
+                _vsync_period.store(std::chrono::milliseconds(30), std::memory_order::relaxed);
 
                 vsync_thread_update_priority(THREAD_PRIORITY_NORMAL);
 
@@ -5,11 +5,13 @@
 #pragma once
 
 #include "pixmap.hpp"
+#include "pixmap_resample.hpp"
 #include "pixmap_span.hpp"
 #include "sdf_r8.hpp"
 #include "sfloat_rg32.hpp"
 #include "sfloat_rgb32.hpp"
 #include "sfloat_rgba16.hpp"
+#include "sfloat_rgba16_row.hpp"
 #include "sfloat_rgba32.hpp"
 #include "sfloat_rgba32x4.hpp"
 #include "sint_abgr8_pack.hpp"
@@ -0,0 +1,374 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file image/pixmap_resample.hpp Functions to scale images and build mipmaps.
+ * @ingroup image
+ */
+
+#pragma once
+
+#include "pixmap.hpp"
+#include "pixmap_span.hpp"
+#include "pixmap_resample_row.hpp"
+#include "sfloat_rgba16.hpp"
+#include "../concurrency/concurrency.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <vector>
+#include <span>
+#include <tuple>
+#include <limits>
+#include <thread>
+#include <atomic>
+#include <algorithm>
+#include <numbers>
+#include <cmath>
+#include <cstdint>
+
+hi_export_module(hikogui.image.pixmap_resample);
+
+namespace hi { inline namespace v1 {
+
+/** The filter used when resampling an image.
+ *
+ * @ingroup image
+ */
+hi_export enum class resample_filter {
+    /** Average the source pixels covered by a destination pixel.
+     *
+     * When up-sampling this is nearest-neighbor. This is the fastest filter
+     * and is used to build mipmaps.
+     */
+    box,
+
+    /** Linear interpolation between the two nearest source pixels.
+     */
+    bilinear,
+
+    /** The Mitchell-Netravali cubic filter with B = C = 1/3.
+     *
+     * A good compromise between sharpness and ringing.
+     */
+    mitchell,
+
+    /** The Lanczos filter with 3 lobes.
+     *
+     * The sharpest filter, with some ringing near hard edges.
+     */
+    lanczos3
+};
+
+namespace detail {
+
+[[nodiscard]] constexpr float resample_filter_support(resample_filter filter) noexcept
+{
+    switch (filter) {
+    case resample_filter::box:
+        return 0.5f;
+    case resample_filter::bilinear:
+        return 1.0f;
+    case resample_filter::mitchell:
+        return 2.0f;
+    case resample_filter::lanczos3:
+        return 3.0f;
+    }
+    hi_no_default();
+}
+
+[[nodiscard]] inline float resample_filter_weight(resample_filter filter, float x) noexcept
+{
+    x = std::abs(x);
+
+    switch (filter) {
+    case resample_filter::box:
+        return x <= 0.5f ? 1.0f : 0.0f;
+
+    case resample_filter::bilinear:
+        return std::max(1.0f - x, 0.0f);
+
+    case resample_filter::mitchell:
+        {
+            constexpr float B = 1.0f / 3.0f;
+            constexpr float C = 1.0f / 3.0f;
+            if (x < 1.0f) {
+                return ((12.0f - 9.0f * B - 6.0f * C) * x * x * x + (-18.0f + 12.0f * B + 6.0f * C) * x * x + (6.0f - 2.0f * B)) /
+                    6.0f;
+            } else if (x < 2.0f) {
+                return ((-B - 6.0f * C) * x * x * x + (6.0f * B + 30.0f * C) * x * x + (-12.0f * B - 48.0f * C) * x +
+                        (8.0f * B + 24.0f * C)) /
+                    6.0f;
+            } else {
+                return 0.0f;
+            }
+        }
+
+    case resample_filter::lanczos3:
+        if (x == 0.0f) {
+            return 1.0f;
+        } else if (x < 3.0f) {
+            constexpr float pi = std::numbers::pi_v<float>;
+            return 3.0f * std::sin(pi * x) * std::sin(pi * x / 3.0f) / (pi * pi * x * x);
+        } else {
+            return 0.0f;
+        }
+    }
+    hi_no_default();
+}
+
+} // namespace detail
+
+/** The weights to resample one axis of an image.
+ *
+ * Each destination pixel is a weighted sum of `num_taps` consecutive source
+ * pixels, starting at `first`. Source pixels beyond the edge of the image are
+ * replaced by the pixel at the edge, by adding their weight to the edge pixel.
+ * An axis that does not change size is copied as-is, with a single tap.
+ *
+ * @ingroup image
+ */
+hi_export struct resample_weights {
+    /** The number of source pixels that contribute to each destination pixel.
+     */
+    size_t num_taps = 0;
+
+    /** The index of the first source pixel for each destination pixel.
+     */
+    std::vector<uint32_t> first;
+
+    /** The weights, `num_taps` for each destination pixel, normalized to a sum of one.
+     */
+    std::vector<float> weights;
+
+    /** Calculate the weights to resample one axis.
+     *
+     * @param src_size The number of pixels in the source image.
+     * @param dst_size The number of pixels in the destination image.
+     * @param filter The filter to use.
+     */
+    resample_weights(size_t src_size, size_t dst_size, resample_filter filter) : first(dst_size)
+    {
+        hi_assert(src_size != 0 and src_size <= std::numeric_limits<uint32_t>::max());
+
+        if (src_size == dst_size) {
+            // Copy exactly, the Mitchell filter would otherwise blur the image.
+            num_taps = 1;
+            weights.assign(dst_size, 1.0f);
+            for (auto i = 0_uz; i != dst_size; ++i) {
+                first[i] = narrow_cast<uint32_t>(i);
+            }
+            return;
+        }
+
+        hilet scale = static_cast<float>(src_size) / static_cast<float>(dst_size);
+        // When down-sampling the filter is stretched so that every source pixel contributes.
+        hilet filter_scale = std::max(scale, 1.0f);
+        hilet support = detail::resample_filter_support(filter) * filter_scale;
+        hilet last = narrow_cast<ptrdiff_t>(src_size) - 1;
+
+        hilet window = [&](size_t i) {
+            hilet center = (static_cast<float>(i) + 0.5f) * scale - 0.5f;
+            hilet left = static_cast<ptrdiff_t>(std::ceil(center - support));
+            hilet right = static_cast<ptrdiff_t>(std::floor(center + support));
+            return std::tuple{center, left, right};
+        };
+
+        for (auto i = 0_uz; i != dst_size; ++i) {
+            hilet [center, left, right] = window(i);
+            num_taps = std::max(num_taps, narrow_cast<size_t>(right - left + 1));
+        }
+        num_taps = std::min(num_taps, src_size);
+
+        weights.resize(dst_size * num_taps);
+        for (auto i = 0_uz; i != dst_size; ++i) {
+            hilet [center, left, right] = window(i);
+            hilet first_ = std::clamp(left, ptrdiff_t{0}, narrow_cast<ptrdiff_t>(src_size - num_taps));
+            first[i] = narrow_cast<uint32_t>(first_);
+
+            hilet w = std::span{weights}.subspan(i * num_taps, num_taps);
+            auto sum = 0.0f;
+            for (auto j = left; j <= right; ++j) {
+                hilet weight = detail::resample_filter_weight(filter, (static_cast<float>(j) - center) / filter_scale);
+                w[narrow_cast<size_t>(std::clamp(j, ptrdiff_t{0}, last) - first_)] += weight;
+                sum += weight;
+            }
+
+            if (sum != 0.0f) {
+                for (auto& weight : w) {
+                    weight /= sum;
+                }
+            }
+        }
+    }
+};
+
+namespace detail {
+
+/** Call `func(first_row, last_row)` for strips of rows, from the threads of `thread_pool::global()`.
+ */
+template<typename Func>
+void resample_parallel(size_t num_rows, size_t num_threads, Func const& func)
+{
+    constexpr auto strip_size = 16_uz;
+    hilet num_strips = (num_rows + strip_size - 1) / strip_size;
+
+    auto next_strip = std::atomic<size_t>{0};
+    thread_pool::global().run(std::min(num_threads, num_strips), [&](size_t) {
+        for (auto i = next_strip.fetch_add(1, std::memory_order::relaxed); i < num_strips;
+             i = next_strip.fetch_add(1, std::memory_order::relaxed)) {
+            func(i * strip_size, std::min((i + 1) * strip_size, num_rows));
+        }
+    });
+}
+
+template<typename T>
+void resample(pixmap_span<T> dst, pixmap_span<T const> src, resample_filter filter, size_t num_threads)
+{
+    constexpr auto num_channels = std::is_same_v<T, sfloat_rgba16> ? 4_uz : 1_uz;
+
+    if (dst.width() == 0 or dst.height() == 0) {
+        return;
+    }
+    hi_assert(src.width() != 0 and src.height() != 0);
+
+    hilet horizontal = resample_weights{src.width(), dst.width(), filter};
+    hilet vertical = resample_weights{src.height(), dst.height(), filter};
+
+    // The horizontal pass, for each source row.
+    hilet tmp_stride = dst.width() * num_channels;
+    auto tmp = std::vector<float>(src.height() * tmp_stride);
+    resample_parallel(src.height(), num_threads, [&](size_t first_row, size_t last_row) {
+        for (auto y = first_row; y != last_row; ++y) {
+            hilet tmp_row = std::span{tmp}.subspan(y * tmp_stride, tmp_stride);
+            if constexpr (std::is_same_v<T, sfloat_rgba16>) {
+                resample_rgba16_horizontal(
+                    tmp_row, sfloat_rgba16_row_elements(src[y]), horizontal.first, horizontal.weights, horizontal.num_taps);
+            } else {
+                resample_r8_horizontal(tmp_row, src[y], horizontal.first, horizontal.weights, horizontal.num_taps);
+            }
+        }
+    });
+
+    // The vertical pass, for each destination row.
+    resample_parallel(dst.height(), num_threads, [&](size_t first_row, size_t last_row) {
+        auto rows = std::vector<float const *>(vertical.num_taps);
+        for (auto y = first_row; y != last_row; ++y) {
+            for (auto k = 0_uz; k != vertical.num_taps; ++k) {
+                rows[k] = tmp.data() + (vertical.first[y] + k) * tmp_stride;
+            }
+
+            hilet weights = std::span{vertical.weights}.subspan(y * vertical.num_taps, vertical.num_taps);
+            if constexpr (std::is_same_v<T, sfloat_rgba16>) {
+                resample_rgba16_vertical(sfloat_rgba16_row_elements(dst[y]), rows, weights);
+            } else {
+                resample_r8_vertical(dst[y], rows, weights);
+            }
+        }
+    });
+}
+
+template<typename T>
+[[nodiscard]] std::vector<pixmap<T>> make_mipmaps(pixmap_span<T const> image, resample_filter filter, size_t num_threads)
+{
+    auto num_levels = 0_uz;
+    for (auto size = std::max(image.width(), image.height()); size > 1; size /= 2) {
+        ++num_levels;
+    }
+
+    // Reserve, so that the span to the previous level stays valid.
+    auto r = std::vector<pixmap<T>>{};
+    r.reserve(num_levels);
+
+    auto width = image.width();
+    auto height = image.height();
+    auto previous = image;
+    for (auto i = 0_uz; i != num_levels; ++i) {
+        width = std::max(width / 2, 1_uz);
+        height = std::max(height / 2, 1_uz);
+
+        auto& level = r.emplace_back(width, height);
+        resample(pixmap_span<T>{level}, previous, filter, num_threads);
+        previous = pixmap_span<T const>{level};
+    }
+    return r;
+}
+
+} // namespace detail
+
+/** Resample an image to the size of another image.
+ *
+ * The image is resampled with separate horizontal and vertical passes, each
+ * pass is split in strips of rows that are processed by multiple threads.
+ *
+ * The colors are resampled as-is; to resample an image with transparency
+ * without dark fringes, premultiply() the source image first and
+ * unpremultiply() the destination image afterwards.
+ *
+ * @ingroup image
+ * @param dst The destination image, which determines the size to resample to.
+ * @param src The source image.
+ * @param filter The filter to use.
+ * @param num_threads The maximum number of threads, including the calling thread, taken from `thread_pool::global()`.
+ */
+hi_export inline void resample(
+    pixmap_span<sfloat_rgba16> dst,
+    pixmap_span<sfloat_rgba16 const> src,
+    resample_filter filter = resample_filter::lanczos3,
+    size_t num_threads = std::thread::hardware_concurrency())
+{
+    detail::resample(dst, src, filter, num_threads);
+}
+
+/** Resample a single channel 8-bit image to the size of another image.
+ *
+ * @ingroup image
+ * @param dst The destination image, which determines the size to resample to.
+ * @param src The source image.
+ * @param filter The filter to use, the results are clamped between 0 and 255.
+ * @param num_threads The maximum number of threads, including the calling thread, taken from `thread_pool::global()`.
+ */
+hi_export inline void resample(
+    pixmap_span<uint8_t> dst,
+    pixmap_span<uint8_t const> src,
+    resample_filter filter = resample_filter::lanczos3,
+    size_t num_threads = std::thread::hardware_concurrency())
+{
+    detail::resample(dst, src, filter, num_threads);
+}
+
+/** Build the chain of mipmaps of an image.
+ *
+ * Each level is half the width and height of the previous level, rounded
+ * down, with a minimum of 1 pixel; the last level is 1 x 1 pixel.
+ *
+ * @ingroup image
+ * @param image The image at full resolution, level 0 of the mipmap chain.
+ * @param filter The filter to use to resample each level from the previous level.
+ * @param num_threads The maximum number of threads, including the calling thread, taken from `thread_pool::global()`.
+ * @return The mipmap levels starting at level 1.
+ */
+hi_export [[nodiscard]] inline std::vector<pixmap<sfloat_rgba16>> make_mipmaps(
+    pixmap_span<sfloat_rgba16 const> image,
+    resample_filter filter = resample_filter::box,
+    size_t num_threads = std::thread::hardware_concurrency())
+{
+    return detail::make_mipmaps(image, filter, num_threads);
+}
+
+/** Build the chain of mipmaps of a single channel 8-bit image.
+ *
+ * @ingroup image
+ * @param image The image at full resolution, level 0 of the mipmap chain.
+ * @param filter The filter to use to resample each level from the previous level.
+ * @param num_threads The maximum number of threads, including the calling thread, taken from `thread_pool::global()`.
+ * @return The mipmap levels starting at level 1.
+ */
+hi_export [[nodiscard]] inline std::vector<pixmap<uint8_t>> make_mipmaps(
+    pixmap_span<uint8_t const> image,
+    resample_filter filter = resample_filter::box,
+    size_t num_threads = std::thread::hardware_concurrency())
+{
+    return detail::make_mipmaps(image, filter, num_threads);
+}
+
+}} // namespace hi::v1
@@ -0,0 +1,126 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file image/pixmap_resample_row.hpp Kernels for the horizontal and vertical passes of resample().
+ * @ingroup image
+ *
+ * The horizontal pass resamples a row of the source image into a row of
+ * floats with the width of the destination image. The vertical pass combines
+ * multiple of these rows into a row of the destination image.
+ *
+ * The weights of the horizontal pass are given per destination pixel: the
+ * index of the first source pixel and `num_taps` weights for that pixel and
+ * the pixels on its right.
+ */
+
+#pragma once
+
+#include "../SIMD/cpu_dispatch.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.image.pixmap_resample_row);
+
+namespace hi { inline namespace v1 {
+
+/** The signature of the resample_rgba16_horizontal() kernel.
+ *
+ * @param dst The resampled row, 4 floats per destination pixel.
+ * @param src The source row, 4 float16 per source pixel.
+ * @param first The index of the first source pixel for each destination pixel.
+ * @param weights The weights, `num_taps` for each destination pixel.
+ * @param num_taps The number of source pixels that contribute to a destination pixel.
+ */
+using resample_rgba16_horizontal_type = void(
+    std::span<float> dst,
+    std::span<float16 const> src,
+    std::span<uint32_t const> first,
+    std::span<float const> weights,
+    size_t num_taps);
+
+/** The signature of the resample_r8_horizontal() kernel.
+ *
+ * @param dst The resampled row, 1 float per destination pixel.
+ * @param src The source row, 1 byte per source pixel.
+ * @param first The index of the first source pixel for each destination pixel.
+ * @param weights The weights, `num_taps` for each destination pixel.
+ * @param num_taps The number of source pixels that contribute to a destination pixel.
+ */
+using resample_r8_horizontal_type = void(
+    std::span<float> dst,
+    std::span<uint8_t const> src,
+    std::span<uint32_t const> first,
+    std::span<float const> weights,
+    size_t num_taps);
+
+/** The signature of the resample_rgba16_vertical() kernel.
+ *
+ * @param dst The destination row, 4 float16 per pixel.
+ * @param rows The rows from the horizontal pass, as many as @a weights.
+ * @param weights The weight of each row.
+ */
+using resample_rgba16_vertical_type =
+    void(std::span<float16> dst, std::span<float const *const> rows, std::span<float const> weights);
+
+/** The signature of the resample_r8_vertical() kernel.
+ *
+ * The result is rounded and clamped between 0 and 255.
+ *
+ * @param dst The destination row, 1 byte per pixel.
+ * @param rows The rows from the horizontal pass, as many as @a weights.
+ * @param weights The weight of each row.
+ */
+using resample_r8_vertical_type =
+    void(std::span<uint8_t> dst, std::span<float const *const> rows, std::span<float const> weights);
+
+#if HI_PROCESSOR == HI_CPU_X64
+namespace cpu_x64v1 {
+resample_rgba16_horizontal_type resample_rgba16_horizontal;
+resample_r8_horizontal_type resample_r8_horizontal;
+resample_rgba16_vertical_type resample_rgba16_vertical;
+resample_r8_vertical_type resample_r8_vertical;
+} // namespace cpu_x64v1
+namespace cpu_x64v2 {
+resample_rgba16_horizontal_type resample_rgba16_horizontal;
+resample_r8_horizontal_type resample_r8_horizontal;
+resample_rgba16_vertical_type resample_rgba16_vertical;
+resample_r8_vertical_type resample_r8_vertical;
+} // namespace cpu_x64v2
+namespace cpu_x64v3 {
+resample_rgba16_horizontal_type resample_rgba16_horizontal;
+resample_r8_horizontal_type resample_r8_horizontal;
+resample_rgba16_vertical_type resample_rgba16_vertical;
+resample_r8_vertical_type resample_r8_vertical;
+} // namespace cpu_x64v3
+namespace cpu_x64v4 {
+resample_rgba16_horizontal_type resample_rgba16_horizontal;
+resample_r8_horizontal_type resample_r8_horizontal;
+resample_rgba16_vertical_type resample_rgba16_vertical;
+resample_r8_vertical_type resample_r8_vertical;
+} // namespace cpu_x64v4
+
+#define HI_X_cpu_dispatch(name) \
+    hi_export inline cpu_dispatch<name##_type> name = { \
+        cpu_x64v1::name, cpu_x64v2::name, cpu_x64v3::name, cpu_x64v4::name};
+#else
+namespace cpu_generic {
+resample_rgba16_horizontal_type resample_rgba16_horizontal;
+resample_r8_horizontal_type resample_r8_horizontal;
+resample_rgba16_vertical_type resample_rgba16_vertical;
+resample_r8_vertical_type resample_r8_vertical;
+} // namespace cpu_generic
+
+#define HI_X_cpu_dispatch(name) hi_export inline cpu_dispatch<name##_type> name{cpu_generic::name};
+#endif
+
+HI_X_cpu_dispatch(resample_rgba16_horizontal)
+HI_X_cpu_dispatch(resample_r8_horizontal)
+HI_X_cpu_dispatch(resample_rgba16_vertical)
+HI_X_cpu_dispatch(resample_r8_vertical)
+#undef HI_X_cpu_dispatch
+
+}} // namespace hi::v1
@@ -0,0 +1,181 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file image/pixmap_resample_row_kernels.hpp The resample kernels, compiled once for each CPU level.
+ *
+ * Only include this file from `SIMD/cpu_dispatch_kernels.hpp`.
+ */
+
+#pragma once
+
+#include "pixmap_resample_row.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <array>
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#if HI_CPU_DISPATCH_LEVEL >= 1
+#include <immintrin.h>
+#endif
+
+#ifndef HI_CPU_DISPATCH_NAMESPACE
+#error "pixmap_resample_row_kernels.hpp must be included through cpu_dispatch_kernels.hpp"
+#endif
+
+hi_cpu_dispatch_target_push()
+
+namespace hi { inline namespace v1 { namespace HI_CPU_DISPATCH_NAMESPACE {
+
+void resample_rgba16_horizontal(
+    std::span<float> dst,
+    std::span<float16 const> src,
+    std::span<uint32_t const> first,
+    std::span<float const> weights,
+    size_t num_taps)
+{
+    hi_axiom(dst.size() == first.size() * 4);
+    hi_axiom(weights.size() == first.size() * num_taps);
+
+    for (auto i = 0_uz; i != first.size(); ++i) {
+        hi_axiom((first[i] + num_taps) * 4 <= src.size());
+        auto const *hi_restrict s = src.data() + first[i] * 4_uz;
+        auto const *hi_restrict w = weights.data() + i * num_taps;
+
+#if HI_CPU_DISPATCH_LEVEL >= 3
+        // Two source pixels per iteration.
+        auto sum2 = _mm256_setzero_ps();
+        auto k = 0_uz;
+        for (; k + 2 <= num_taps; k += 2) {
+            hilet pixels = _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const *>(s + k * 4)));
+            hilet weight = _mm256_setr_m128(_mm_set1_ps(w[k]), _mm_set1_ps(w[k + 1]));
+            sum2 = _mm256_add_ps(sum2, _mm256_mul_ps(pixels, weight));
+        }
+
+        auto sum = _mm_add_ps(_mm256_castps256_ps128(sum2), _mm256_extractf128_ps(sum2, 1));
+        if (k != num_taps) {
+            hilet pixel = _mm_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(s + k * 4)));
+            sum = _mm_add_ps(sum, _mm_mul_ps(pixel, _mm_set1_ps(w[k])));
+        }
+        _mm_storeu_ps(dst.data() + i * 4, sum);
+#else
+        auto sum = std::array<float, 4>{};
+        for (auto k = 0_uz; k != num_taps; ++k) {
+            for (auto c = 0_uz; c != 4; ++c) {
+                sum[c] += cvtsh_ss(s[k * 4 + c].get()) * w[k];
+            }
+        }
+        std::copy(sum.begin(), sum.end(), dst.data() + i * 4);
+#endif
+    }
+}
+
+void resample_r8_horizontal(
+    std::span<float> dst,
+    std::span<uint8_t const> src,
+    std::span<uint32_t const> first,
+    std::span<float const> weights,
+    size_t num_taps)
+{
+    hi_axiom(dst.size() == first.size());
+    hi_axiom(weights.size() == first.size() * num_taps);
+
+    for (auto i = 0_uz; i != first.size(); ++i) {
+        hi_axiom(first[i] + num_taps <= src.size());
+        auto const *hi_restrict s = src.data() + first[i];
+        auto const *hi_restrict w = weights.data() + i * num_taps;
+
+        auto sum = 0.0f;
+        auto k = 0_uz;
+#if HI_CPU_DISPATCH_LEVEL >= 3
+        // Eight source pixels per iteration, only when down-sampling by a large factor.
+        if (num_taps >= 8) {
+            auto sum8 = _mm256_setzero_ps();
+            for (; k + 8 <= num_taps; k += 8) {
+                hilet pixels = _mm256_cvtepi32_ps(_mm256_cvtepu8_epi32(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(s + k))));
+                sum8 = _mm256_add_ps(sum8, _mm256_mul_ps(pixels, _mm256_loadu_ps(w + k)));
+            }
+
+            auto sum4 = _mm_add_ps(_mm256_castps256_ps128(sum8), _mm256_extractf128_ps(sum8, 1));
+            sum4 = _mm_add_ps(sum4, _mm_movehl_ps(sum4, sum4));
+            sum4 = _mm_add_ss(sum4, _mm_shuffle_ps(sum4, sum4, 0b01));
+            sum = _mm_cvtss_f32(sum4);
+        }
+#endif
+        for (; k != num_taps; ++k) {
+            sum += static_cast<float>(s[k]) * w[k];
+        }
+        dst[i] = sum;
+    }
+}
+
+void resample_rgba16_vertical(std::span<float16> dst, std::span<float const *const> rows, std::span<float const> weights)
+{
+    hi_axiom(rows.size() == weights.size());
+    hi_axiom(dst.size() % 4 == 0);
+
+    hilet size = dst.size();
+    auto *hi_restrict d = dst.data();
+    auto i = 0_uz;
+
+#if HI_CPU_DISPATCH_LEVEL >= 3
+    for (; i + 8 <= size; i += 8) {
+        auto sum = _mm256_setzero_ps();
+        for (auto k = 0_uz; k != rows.size(); ++k) {
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(rows[k] + i), _mm256_set1_ps(weights[k])));
+        }
+        _mm_storeu_si128(reinterpret_cast<__m128i *>(d + i), _mm256_cvtps_ph(sum, _MM_FROUND_TO_ZERO));
+    }
+    if (i != size) {
+        auto sum = _mm_setzero_ps();
+        for (auto k = 0_uz; k != rows.size(); ++k) {
+            sum = _mm_add_ps(sum, _mm_mul_ps(_mm_loadu_ps(rows[k] + i), _mm_set1_ps(weights[k])));
+        }
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(d + i), _mm_cvtps_ph(sum, _MM_FROUND_TO_ZERO));
+    }
+#else
+    for (; i != size; ++i) {
+        auto sum = 0.0f;
+        for (auto k = 0_uz; k != rows.size(); ++k) {
+            sum += rows[k][i] * weights[k];
+        }
+        d[i].set(cvtss_sh(sum));
+    }
+#endif
+}
+
+void resample_r8_vertical(std::span<uint8_t> dst, std::span<float const *const> rows, std::span<float const> weights)
+{
+    hi_axiom(rows.size() == weights.size());
+
+    hilet size = dst.size();
+    auto *hi_restrict d = dst.data();
+    auto i = 0_uz;
+
+#if HI_CPU_DISPATCH_LEVEL >= 3
+    for (; i + 8 <= size; i += 8) {
+        auto sum = _mm256_setzero_ps();
+        for (auto k = 0_uz; k != rows.size(); ++k) {
+            sum = _mm256_add_ps(sum, _mm256_mul_ps(_mm256_loadu_ps(rows[k] + i), _mm256_set1_ps(weights[k])));
+        }
+
+        // Round to nearest-even, then saturate to 0 - 255 while packing.
+        hilet sum_i32 = _mm256_cvtps_epi32(sum);
+        hilet sum_u16 = _mm_packus_epi32(_mm256_castsi256_si128(sum_i32), _mm256_extracti128_si256(sum_i32, 1));
+        _mm_storel_epi64(reinterpret_cast<__m128i *>(d + i), _mm_packus_epi16(sum_u16, sum_u16));
+    }
+#endif
+    for (; i != size; ++i) {
+        auto sum = 0.0f;
+        for (auto k = 0_uz; k != rows.size(); ++k) {
+            sum += rows[k][i] * weights[k];
+        }
+        d[i] = static_cast<uint8_t>(std::nearbyint(std::clamp(sum, 0.0f, 255.0f)));
+    }
+}
+
+}}} // namespace hi::v1::HI_CPU_DISPATCH_NAMESPACE
+
+hi_cpu_dispatch_target_pop()
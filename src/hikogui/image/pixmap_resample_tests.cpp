@@ -0,0 +1,244 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "pixmap_resample.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+#include <cmath>
+
+using namespace hi;
+
+namespace {
+
+constexpr auto all_filters =
+    std::array{resample_filter::box, resample_filter::bilinear, resample_filter::mitchell, resample_filter::lanczos3};
+
+[[nodiscard]] pixmap<uint8_t> make_pattern(size_t width, size_t height)
+{
+    auto r = pixmap<uint8_t>{width, height};
+    for (auto y = 0_uz; y != height; ++y) {
+        for (auto x = 0_uz; x != width; ++x) {
+            r[y][x] = static_cast<uint8_t>((x * 97 + y * 31 + x * y) % 256);
+        }
+    }
+    return r;
+}
+
+[[nodiscard]] pixmap<uint8_t> make_checkerboard(size_t width, size_t height)
+{
+    auto r = pixmap<uint8_t>{width, height};
+    for (auto y = 0_uz; y != height; ++y) {
+        for (auto x = 0_uz; x != width; ++x) {
+            r[y][x] = (x + y) % 2 == 0 ? 0 : 255;
+        }
+    }
+    return r;
+}
+
+} // namespace
+
+TEST(pixmap_resample, weights)
+{
+    for (hilet filter : all_filters) {
+        for (hilet [src_size, dst_size] : std::vector<std::pair<size_t, size_t>>{{10, 10}, {10, 3}, {3, 10}, {1, 5}, {7, 1}, {100, 37}}) {
+            hilet w = resample_weights{src_size, dst_size, filter};
+            ASSERT_EQ(w.first.size(), dst_size);
+            ASSERT_EQ(w.weights.size(), dst_size * w.num_taps);
+
+            for (auto i = 0_uz; i != dst_size; ++i) {
+                ASSERT_LE(w.first[i] + w.num_taps, src_size);
+
+                auto sum = 0.0f;
+                for (auto k = 0_uz; k != w.num_taps; ++k) {
+                    sum += w.weights[i * w.num_taps + k];
+                }
+                ASSERT_NEAR(sum, 1.0f, 0.0001f);
+            }
+        }
+    }
+}
+
+TEST(pixmap_resample, identity)
+{
+    hilet src = make_pattern(13, 7);
+
+    for (hilet filter : all_filters) {
+        auto dst = pixmap<uint8_t>{13, 7};
+        resample(dst, pixmap_span{src}, filter);
+        ASSERT_EQ(dst, src);
+    }
+}
+
+TEST(pixmap_resample, constant)
+{
+    auto src = pixmap<uint8_t>{13, 7};
+    for (auto& pixel : src) {
+        pixel = 100;
+    }
+
+    for (hilet filter : all_filters) {
+        for (hilet [width, height] : std::vector<std::pair<size_t, size_t>>{{5, 3}, {31, 17}, {1, 1}, {13, 20}}) {
+            auto dst = pixmap<uint8_t>{width, height};
+            resample(dst, pixmap_span<uint8_t const>{src}, filter);
+            for (hilet pixel : dst) {
+                ASSERT_EQ(pixel, 100);
+            }
+        }
+    }
+}
+
+TEST(pixmap_resample, box_down)
+{
+    auto src = pixmap<uint8_t>{4, 2};
+    src[0][0] = 10;
+    src[0][1] = 20;
+    src[0][2] = 30;
+    src[0][3] = 50;
+    src[1][0] = 30;
+    src[1][1] = 40;
+    src[1][2] = 70;
+    src[1][3] = 90;
+
+    auto dst = pixmap<uint8_t>{2, 1};
+    resample(dst, pixmap_span<uint8_t const>{src}, resample_filter::box);
+    ASSERT_EQ(dst[0][0], 25);
+    ASSERT_EQ(dst[0][1], 60);
+}
+
+TEST(pixmap_resample, bilinear_up)
+{
+    auto src = pixmap<uint8_t>{2, 1};
+    src[0][0] = 0;
+    src[0][1] = 255;
+
+    auto dst = pixmap<uint8_t>{4, 1};
+    resample(dst, pixmap_span<uint8_t const>{src}, resample_filter::bilinear);
+    ASSERT_EQ(dst[0][0], 0);
+    ASSERT_EQ(dst[0][1], 64);
+    ASSERT_EQ(dst[0][2], 191);
+    ASSERT_EQ(dst[0][3], 255);
+}
+
+TEST(pixmap_resample, anti_alias)
+{
+    // Down-sampling a checkerboard must not alias, every pixel should become gray.
+    // The pixels along the edge are skipped, the edge pixels of the source get extra weight there.
+    hilet src = make_checkerboard(64, 64);
+
+    for (hilet filter : all_filters) {
+        auto dst = pixmap<uint8_t>{8, 8};
+        resample(dst, pixmap_span{src}, filter);
+        for (auto y = 1_uz; y != 7; ++y) {
+            for (auto x = 1_uz; x != 7; ++x) {
+                ASSERT_NEAR(dst[y][x], 128, 2);
+            }
+        }
+    }
+}
+
+TEST(pixmap_resample, threads)
+{
+    hilet src = make_pattern(100, 50);
+
+    for (hilet filter : all_filters) {
+        auto expected = pixmap<uint8_t>{37, 80};
+        resample(expected, pixmap_span{src}, filter, 1);
+
+        auto dst = pixmap<uint8_t>{37, 80};
+        resample(dst, pixmap_span{src}, filter, 4);
+        ASSERT_EQ(dst, expected);
+    }
+}
+
+TEST(pixmap_resample, rgba16)
+{
+    auto src = pixmap<sfloat_rgba16>{6, 4};
+    for (auto y = 0_uz; y != src.height(); ++y) {
+        for (auto x = 0_uz; x != src.width(); ++x) {
+            src[y][x] = f32x4{static_cast<float>(x) / 5.0f, 0.5f, static_cast<float>(y) / 3.0f, 1.0f};
+        }
+    }
+
+    auto dst = pixmap<sfloat_rgba16>{3, 2};
+    resample(dst, pixmap_span<sfloat_rgba16 const>{src}, resample_filter::box);
+
+    for (auto y = 0_uz; y != dst.height(); ++y) {
+        for (auto x = 0_uz; x != dst.width(); ++x) {
+            hilet pixel = static_cast<f32x4>(static_cast<f16x4>(dst[y][x]));
+            ASSERT_NEAR(pixel.x(), (x * 2.0f + 0.5f) / 5.0f, 0.005f);
+            ASSERT_NEAR(pixel.y(), 0.5f, 0.005f);
+            ASSERT_NEAR(pixel.z(), (y * 2.0f + 0.5f) / 3.0f, 0.005f);
+            ASSERT_NEAR(pixel.w(), 1.0f, 0.005f);
+        }
+    }
+}
+
+TEST(pixmap_resample, mipmaps)
+{
+    hilet src = make_pattern(5, 3);
+
+    hilet levels = make_mipmaps(pixmap_span{src});
+    ASSERT_EQ(levels.size(), 2);
+    ASSERT_EQ(levels[0].width(), 2);
+    ASSERT_EQ(levels[0].height(), 1);
+    ASSERT_EQ(levels[1].width(), 1);
+    ASSERT_EQ(levels[1].height(), 1);
+
+    hilet src_1x1 = make_pattern(1, 1);
+    ASSERT_TRUE(make_mipmaps(pixmap_span{src_1x1}).empty());
+
+    hilet src_64x16 = make_pattern(64, 16);
+    ASSERT_EQ(make_mipmaps(pixmap_span{src_64x16}).size(), 6);
+}
+
+TEST(pixmap_resample, kernels)
+{
+    // Every variant that can run on this CPU must give the same result as the generic variant.
+    hilet weights = resample_weights{50, 19, resample_filter::lanczos3};
+
+    auto src_r8 = std::vector<uint8_t>(50);
+    auto src_rgba16 = std::vector<float16>(200);
+    for (auto i = 0_uz; i != 50; ++i) {
+        src_r8[i] = static_cast<uint8_t>(i * 37);
+        for (auto c = 0_uz; c != 4; ++c) {
+            src_rgba16[i * 4 + c] = float16{static_cast<float>((i * 7 + c * 3) % 11) / 10.0f};
+        }
+    }
+
+    auto expected_r8 = std::vector<float>(19);
+    auto expected_rgba16 = std::vector<float>(19 * 4);
+    hi::resample_r8_horizontal.get(0)(expected_r8, src_r8, weights.first, weights.weights, weights.num_taps);
+    hi::resample_rgba16_horizontal.get(0)(expected_rgba16, src_rgba16, weights.first, weights.weights, weights.num_taps);
+
+    auto expected_r8_out = std::vector<uint8_t>(19);
+    auto expected_rgba16_out = std::vector<float16>(19 * 4);
+    hilet row_weights = std::vector<float>{0.25f, 0.5f, 0.25f};
+    hilet r8_rows = std::vector<float const *>{expected_r8.data(), expected_r8.data(), expected_r8.data()};
+    hilet rgba16_rows = std::vector<float const *>{expected_rgba16.data(), expected_rgba16.data(), expected_rgba16.data()};
+    hi::resample_r8_vertical.get(0)(expected_r8_out, r8_rows, row_weights);
+    hi::resample_rgba16_vertical.get(0)(expected_rgba16_out, rgba16_rows, row_weights);
+
+    for (auto level = 1; level <= hi::cpu_dispatch_level(); ++level) {
+        auto r8 = std::vector<float>(19);
+        auto rgba16 = std::vector<float>(19 * 4);
+        hi::resample_r8_horizontal.get(level)(r8, src_r8, weights.first, weights.weights, weights.num_taps);
+        hi::resample_rgba16_horizontal.get(level)(rgba16, src_rgba16, weights.first, weights.weights, weights.num_taps);
+        for (auto i = 0_uz; i != r8.size(); ++i) {
+            ASSERT_NEAR(r8[i], expected_r8[i], 0.01f) << "level=" << level;
+        }
+        for (auto i = 0_uz; i != rgba16.size(); ++i) {
+            ASSERT_NEAR(rgba16[i], expected_rgba16[i], 0.001f) << "level=" << level;
+        }
+
+        auto r8_out = std::vector<uint8_t>(19);
+        auto rgba16_out = std::vector<float16>(19 * 4);
+        hi::resample_r8_vertical.get(level)(r8_out, r8_rows, row_weights);
+        hi::resample_rgba16_vertical.get(level)(rgba16_out, rgba16_rows, row_weights);
+        ASSERT_EQ(r8_out, expected_r8_out) << "level=" << level;
+        for (auto i = 0_uz; i != rgba16_out.size(); ++i) {
+            ASSERT_NEAR(static_cast<float>(rgba16_out[i]), static_cast<float>(expected_rgba16_out[i]), 0.002f) << "level=" << level;
+        }
+    }
+}
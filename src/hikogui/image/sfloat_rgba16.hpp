@@ -9,6 +9,7 @@
 #pragma once
 
 #include "pixmap_span.hpp"
+#include "sfloat_rgba16_row.hpp"
 #include "../color/module.hpp"
 #include "../geometry/module.hpp"
 #include "../SIMD/module.hpp"
@@ -17,6 +18,7 @@
 #include <algorithm>
 #include <bit>
 #include <array>
+#include <span>
 
 
 
@@ -88,50 +90,118 @@ public:
     }
 };
 
-constexpr void fill(pixmap_span<sfloat_rgba16> image, f32x4 color) noexcept
+namespace detail {
+
+/** Get the elements of a row of pixels, 4 elements per pixel.
+ */
+[[nodiscard]] inline std::span<float16> sfloat_rgba16_row_elements(std::span<sfloat_rgba16> row) noexcept
+{
+    static_assert(sizeof(sfloat_rgba16) == 4 * sizeof(float16));
+    return {reinterpret_cast<float16 *>(row.data()), row.size() * 4};
+}
+
+/** Get the elements of a row of pixels, 4 elements per pixel.
+ */
+[[nodiscard]] inline std::span<float16 const> sfloat_rgba16_row_elements(std::span<sfloat_rgba16 const> row) noexcept
+{
+    static_assert(sizeof(sfloat_rgba16) == 4 * sizeof(float16));
+    return {reinterpret_cast<float16 const *>(row.data()), row.size() * 4};
+}
+
+} // namespace detail
+
+/** Fill an image with a single color.
+ *
+ * @param image The image to fill.
+ * @param color The color to fill the image with.
+ */
+inline void fill(pixmap_span<sfloat_rgba16> image, f32x4 color) noexcept
 {
-    for (std::size_t y = 0; y != image.height(); ++y) {
-        hilet row = image[y];
-        for (std::size_t x = 0; x != image.width(); ++x) {
-            row[x] = color;
-        }
+    hilet color_ = std::bit_cast<std::array<float16, 4>>(static_cast<f16x4>(color));
+
+    for (hilet row : image.rows()) {
+        sfloat_rgba16_fill_row(detail::sfloat_rgba16_row_elements(row), color_);
     }
 }
 
+/** Composit an image over another image.
+ *
+ * @param under The image to composit onto.
+ * @param over The image to composit over @a under, at least as large as @a under.
+ */
 inline void composit(pixmap_span<sfloat_rgba16> under, pixmap_span<sfloat_rgba16 const> over) noexcept
 {
     hi_assert(over.height() >= under.height());
     hi_assert(over.width() >= under.width());
 
     for (auto y = 0_uz; y != under.height(); ++y) {
-        hilet over_line = over[y];
-        hilet under_line = under[y];
-        for (auto x = 0_uz; x != under.width(); ++x) {
-            hilet &overPixel = over_line[x];
-            auto &underPixel = under_line[x];
-
-            underPixel = composit(static_cast<f16x4>(underPixel), static_cast<f16x4>(overPixel));
-        }
+        sfloat_rgba16_composit_row(
+            detail::sfloat_rgba16_row_elements(under[y]), detail::sfloat_rgba16_row_elements(over[y]));
     }
 }
 
+/** Composit a color over an image through a mask.
+ *
+ * @param under The image to composit onto.
+ * @param over The color to composit over @a under.
+ * @param mask The coverage of each pixel, at least as large as @a under.
+ */
 inline void composit(pixmap_span<sfloat_rgba16> under, color over, pixmap_span<uint8_t const> mask) noexcept
 {
     hi_assert(mask.height() >= under.height());
     hi_assert(mask.width() >= under.width());
 
-    auto mask_pixel = color{1.0f, 1.0f, 1.0f, 1.0f};
+    hilet over_ = static_cast<std::array<float, 4>>(static_cast<f32x4>(over));
 
     for (auto y = 0_uz; y != under.height(); ++y) {
-        hilet mask_line = mask[y];
-        hilet under_line = under[y];
-        for (auto x = 0_uz; x != under.width(); ++x) {
-            hilet mask_value = mask_line[x] / 255.0f;
-            mask_pixel.a() = mask_value;
-
-            auto &pixel = under_line[x];
-            pixel = composit(static_cast<color>(pixel), over * mask_pixel);
-        }
+        sfloat_rgba16_composit_mask_row(detail::sfloat_rgba16_row_elements(under[y]), over_, mask[y]);
+    }
+}
+
+/** Multiply the color of each pixel with its alpha.
+ *
+ * @param image The image to premultiply.
+ */
+inline void premultiply(pixmap_span<sfloat_rgba16> image) noexcept
+{
+    for (hilet row : image.rows()) {
+        sfloat_rgba16_premultiply_row(detail::sfloat_rgba16_row_elements(row));
+    }
+}
+
+/** Divide the color of each pixel by its alpha.
+ *
+ * Pixels that are fully transparent are left unchanged.
+ *
+ * @param image The image to unpremultiply.
+ */
+inline void unpremultiply(pixmap_span<sfloat_rgba16> image) noexcept
+{
+    for (hilet row : image.rows()) {
+        sfloat_rgba16_unpremultiply_row(detail::sfloat_rgba16_row_elements(row));
+    }
+}
+
+/** Transform the color of each pixel with a color matrix.
+ *
+ * This is the same as `matrix3 * color` on each pixel, for example
+ * `XYZ_to_Rec2020 * sRGB_to_XYZ` converts an image from the sRGB to the
+ * Rec.2020 color primaries.
+ *
+ * @param image The image to transform.
+ * @param matrix The color matrix, without translation. The alpha is not transformed.
+ */
+inline void transform(pixmap_span<sfloat_rgba16> image, matrix3 const& matrix) noexcept
+{
+    auto matrix_ = std::array<float, 16>{};
+    hilet columns = static_cast<std::array<f32x4, 4>>(matrix);
+    for (auto i = 0_uz; i != 4; ++i) {
+        hilet column = static_cast<std::array<float, 4>>(columns[i]);
+        std::copy(column.begin(), column.end(), matrix_.begin() + i * 4);
+    }
+
+    for (hilet row : image.rows()) {
+        sfloat_rgba16_transform_row(detail::sfloat_rgba16_row_elements(row), matrix_);
     }
 }
 
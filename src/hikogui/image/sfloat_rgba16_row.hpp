@@ -0,0 +1,136 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file image/sfloat_rgba16_row.hpp Kernels that operate on a row of sfloat_rgba16 pixels.
+ * @ingroup image
+ *
+ * A row is passed as a span of `float16` with 4 elements per pixel: red,
+ * green, blue and alpha. These kernels are used by the `pixmap_span`
+ * algorithms in `sfloat_rgba16.hpp`.
+ */
+
+#pragma once
+
+#include "../SIMD/cpu_dispatch.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <array>
+#include <cstdint>
+
+hi_export_module(hikogui.image.sfloat_rgba16_row);
+
+namespace hi { inline namespace v1 {
+
+/** The signature of the sfloat_rgba16_fill_row() kernel.
+ *
+ * @param row The pixels to fill.
+ * @param color The color to fill the pixels with.
+ */
+using sfloat_rgba16_fill_row_type = void(std::span<float16> row, std::array<float16, 4> color);
+
+/** The signature of the sfloat_rgba16_composit_row() kernel.
+ *
+ * The colors are not premultiplied by alpha, the same as `composit()` of `f32x4`.
+ *
+ * @param under The pixels to composit onto, in-place.
+ * @param over The pixels to composit over @a under, at least as many as @a under.
+ */
+using sfloat_rgba16_composit_row_type = void(std::span<float16> under, std::span<float16 const> over);
+
+/** The signature of the sfloat_rgba16_composit_mask_row() kernel.
+ *
+ * @param under The pixels to composit onto, in-place.
+ * @param over The color to composit over @a under, the alpha is scaled by the mask.
+ * @param mask The coverage of each pixel between 0 and 255, at least as many as the pixels in @a under.
+ */
+using sfloat_rgba16_composit_mask_row_type =
+    void(std::span<float16> under, std::array<float, 4> over, std::span<uint8_t const> mask);
+
+/** The signature of the sfloat_rgba16_premultiply_row() kernel.
+ *
+ * Multiply the color of each pixel with its alpha.
+ *
+ * @param row The pixels to premultiply in-place.
+ */
+using sfloat_rgba16_premultiply_row_type = void(std::span<float16> row);
+
+/** The signature of the sfloat_rgba16_unpremultiply_row() kernel.
+ *
+ * Divide the color of each pixel by its alpha. Pixels with an alpha of zero
+ * or less are left unchanged.
+ *
+ * @param row The pixels to unpremultiply in-place.
+ */
+using sfloat_rgba16_unpremultiply_row_type = void(std::span<float16> row);
+
+/** The signature of the sfloat_rgba16_transform_row() kernel.
+ *
+ * Transform the color of each pixel with a color matrix, the same as
+ * `matrix3 * color`; alpha is copied unchanged.
+ *
+ * @param row The pixels to transform in-place.
+ * @param matrix The 4 columns of the matrix, each column has 4 elements.
+ */
+using sfloat_rgba16_transform_row_type = void(std::span<float16> row, std::array<float, 16> const& matrix);
+
+#if HI_PROCESSOR == HI_CPU_X64
+namespace cpu_x64v1 {
+sfloat_rgba16_fill_row_type sfloat_rgba16_fill_row;
+sfloat_rgba16_composit_row_type sfloat_rgba16_composit_row;
+sfloat_rgba16_composit_mask_row_type sfloat_rgba16_composit_mask_row;
+sfloat_rgba16_premultiply_row_type sfloat_rgba16_premultiply_row;
+sfloat_rgba16_unpremultiply_row_type sfloat_rgba16_unpremultiply_row;
+sfloat_rgba16_transform_row_type sfloat_rgba16_transform_row;
+} // namespace cpu_x64v1
+namespace cpu_x64v2 {
+sfloat_rgba16_fill_row_type sfloat_rgba16_fill_row;
+sfloat_rgba16_composit_row_type sfloat_rgba16_composit_row;
+sfloat_rgba16_composit_mask_row_type sfloat_rgba16_composit_mask_row;
+sfloat_rgba16_premultiply_row_type sfloat_rgba16_premultiply_row;
+sfloat_rgba16_unpremultiply_row_type sfloat_rgba16_unpremultiply_row;
+sfloat_rgba16_transform_row_type sfloat_rgba16_transform_row;
+} // namespace cpu_x64v2
+namespace cpu_x64v3 {
+sfloat_rgba16_fill_row_type sfloat_rgba16_fill_row;
+sfloat_rgba16_composit_row_type sfloat_rgba16_composit_row;
+sfloat_rgba16_composit_mask_row_type sfloat_rgba16_composit_mask_row;
+sfloat_rgba16_premultiply_row_type sfloat_rgba16_premultiply_row;
+sfloat_rgba16_unpremultiply_row_type sfloat_rgba16_unpremultiply_row;
+sfloat_rgba16_transform_row_type sfloat_rgba16_transform_row;
+} // namespace cpu_x64v3
+namespace cpu_x64v4 {
+sfloat_rgba16_fill_row_type sfloat_rgba16_fill_row;
+sfloat_rgba16_composit_row_type sfloat_rgba16_composit_row;
+sfloat_rgba16_composit_mask_row_type sfloat_rgba16_composit_mask_row;
+sfloat_rgba16_premultiply_row_type sfloat_rgba16_premultiply_row;
+sfloat_rgba16_unpremultiply_row_type sfloat_rgba16_unpremultiply_row;
+sfloat_rgba16_transform_row_type sfloat_rgba16_transform_row;
+} // namespace cpu_x64v4
+
+#define HI_X_cpu_dispatch(name) \
+    hi_export inline cpu_dispatch<name##_type> name = { \
+        cpu_x64v1::name, cpu_x64v2::name, cpu_x64v3::name, cpu_x64v4::name};
+#else
+namespace cpu_generic {
+sfloat_rgba16_fill_row_type sfloat_rgba16_fill_row;
+sfloat_rgba16_composit_row_type sfloat_rgba16_composit_row;
+sfloat_rgba16_composit_mask_row_type sfloat_rgba16_composit_mask_row;
+sfloat_rgba16_premultiply_row_type sfloat_rgba16_premultiply_row;
+sfloat_rgba16_unpremultiply_row_type sfloat_rgba16_unpremultiply_row;
+sfloat_rgba16_transform_row_type sfloat_rgba16_transform_row;
+} // namespace cpu_generic
+
+#define HI_X_cpu_dispatch(name) hi_export inline cpu_dispatch<name##_type> name{cpu_generic::name};
+#endif
+
+HI_X_cpu_dispatch(sfloat_rgba16_fill_row)
+HI_X_cpu_dispatch(sfloat_rgba16_composit_row)
+HI_X_cpu_dispatch(sfloat_rgba16_composit_mask_row)
+HI_X_cpu_dispatch(sfloat_rgba16_premultiply_row)
+HI_X_cpu_dispatch(sfloat_rgba16_unpremultiply_row)
+HI_X_cpu_dispatch(sfloat_rgba16_transform_row)
+#undef HI_X_cpu_dispatch
+
+}} // namespace hi::v1
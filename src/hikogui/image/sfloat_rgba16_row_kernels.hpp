@@ -0,0 +1,333 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file image/sfloat_rgba16_row_kernels.hpp The sfloat_rgba16 row kernels, compiled once for each CPU level.
+ *
+ * Only include this file from `SIMD/cpu_dispatch_kernels.hpp`.
+ *
+ * With F16C two pixels are converted to a `__m256` at once. The conversion to
+ * float16 truncates toward zero, like the conversion of `float16`, so that
+ * the result does not depend on the CPU. Unlike `float16` the F16C instructions
+ * handle sub-normal numbers instead of flushing them to zero.
+ */
+
+#pragma once
+
+#include "sfloat_rgba16_row.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <span>
+#include <array>
+#include <bit>
+#include <algorithm>
+#include <cstdint>
+#if HI_CPU_DISPATCH_LEVEL >= 1
+#include <immintrin.h>
+#endif
+
+#ifndef HI_CPU_DISPATCH_NAMESPACE
+#error "sfloat_rgba16_row_kernels.hpp must be included through cpu_dispatch_kernels.hpp"
+#endif
+
+hi_cpu_dispatch_target_push()
+
+namespace hi { inline namespace v1 { namespace HI_CPU_DISPATCH_NAMESPACE {
+
+#if HI_CPU_DISPATCH_LEVEL >= 3
+[[nodiscard]] hi_force_inline __m256 sfloat_rgba16_load2(float16 const *p) noexcept
+{
+    return _mm256_cvtph_ps(_mm_loadu_si128(reinterpret_cast<__m128i const *>(p)));
+}
+
+[[nodiscard]] hi_force_inline __m256 sfloat_rgba16_load1(float16 const *p) noexcept
+{
+    return _mm256_cvtph_ps(_mm_loadl_epi64(reinterpret_cast<__m128i const *>(p)));
+}
+
+hi_force_inline void sfloat_rgba16_store2(float16 *p, __m256 v) noexcept
+{
+    _mm_storeu_si128(reinterpret_cast<__m128i *>(p), _mm256_cvtps_ph(v, _MM_FROUND_TO_ZERO));
+}
+
+hi_force_inline void sfloat_rgba16_store1(float16 *p, __m256 v) noexcept
+{
+    _mm_storel_epi64(reinterpret_cast<__m128i *>(p), _mm256_cvtps_ph(v, _MM_FROUND_TO_ZERO));
+}
+
+/** Broadcast the alpha of each pixel to all its elements.
+ */
+[[nodiscard]] hi_force_inline __m256 sfloat_rgba16_alpha2(__m256 v) noexcept
+{
+    return _mm256_permute_ps(v, 0b11'11'11'11);
+}
+
+/** Replace the alpha of each pixel with one.
+ */
+[[nodiscard]] hi_force_inline __m256 sfloat_rgba16_color2(__m256 v) noexcept
+{
+    return _mm256_blend_ps(v, _mm256_set1_ps(1.0f), 0b1000'1000);
+}
+
+[[nodiscard]] hi_force_inline __m256 sfloat_rgba16_composit2(__m256 under, __m256 over) noexcept
+{
+    hilet one = _mm256_set1_ps(1.0f);
+    hilet over_alpha = sfloat_rgba16_alpha2(over);
+    hilet under_alpha = sfloat_rgba16_alpha2(under);
+
+    hilet output = _mm256_add_ps(
+        _mm256_mul_ps(sfloat_rgba16_color2(over), over_alpha),
+        _mm256_mul_ps(_mm256_mul_ps(sfloat_rgba16_color2(under), under_alpha), _mm256_sub_ps(one, over_alpha)));
+
+    auto r = _mm256_div_ps(output, sfloat_rgba16_color2(sfloat_rgba16_alpha2(output)));
+
+    // Fully opaque or fully transparent pixels are copied.
+    r = _mm256_blendv_ps(r, over, _mm256_cmp_ps(over_alpha, one, _CMP_GE_OQ));
+    return _mm256_blendv_ps(r, under, _mm256_cmp_ps(over_alpha, _mm256_setzero_ps(), _CMP_LE_OQ));
+}
+
+/** Get the over color of two pixels with the alpha scaled by the mask.
+ */
+[[nodiscard]] hi_force_inline __m256 sfloat_rgba16_mask2(__m256 over, uint8_t mask0, uint8_t mask1) noexcept
+{
+    hilet coverage = _mm256_div_ps(
+        _mm256_setr_m128(_mm_set1_ps(static_cast<float>(mask0)), _mm_set1_ps(static_cast<float>(mask1))),
+        _mm256_set1_ps(255.0f));
+    return _mm256_blend_ps(over, _mm256_mul_ps(over, coverage), 0b1000'1000);
+}
+
+[[nodiscard]] hi_force_inline __m256 sfloat_rgba16_premultiply2(__m256 v) noexcept
+{
+    return _mm256_mul_ps(v, sfloat_rgba16_color2(sfloat_rgba16_alpha2(v)));
+}
+
+[[nodiscard]] hi_force_inline __m256 sfloat_rgba16_unpremultiply2(__m256 v) noexcept
+{
+    hilet alpha = sfloat_rgba16_alpha2(v);
+    hilet r = _mm256_div_ps(v, sfloat_rgba16_color2(alpha));
+    return _mm256_blendv_ps(r, v, _mm256_cmp_ps(alpha, _mm256_setzero_ps(), _CMP_LE_OQ));
+}
+
+[[nodiscard]] hi_force_inline __m256
+sfloat_rgba16_transform2(__m256 v, __m256 col0, __m256 col1, __m256 col2, __m256 col3) noexcept
+{
+    auto r = _mm256_mul_ps(col0, _mm256_permute_ps(v, 0b00'00'00'00));
+    r = _mm256_add_ps(r, _mm256_mul_ps(col1, _mm256_permute_ps(v, 0b01'01'01'01)));
+    r = _mm256_add_ps(r, _mm256_mul_ps(col2, _mm256_permute_ps(v, 0b10'10'10'10)));
+    r = _mm256_add_ps(r, col3);
+    return _mm256_blend_ps(r, v, 0b1000'1000);
+}
+
+#else
+[[nodiscard]] hi_force_inline std::array<float, 4> sfloat_rgba16_load1(float16 const *p) noexcept
+{
+    return {cvtsh_ss(p[0].get()), cvtsh_ss(p[1].get()), cvtsh_ss(p[2].get()), cvtsh_ss(p[3].get())};
+}
+
+hi_force_inline void sfloat_rgba16_store1(float16 *p, std::array<float, 4> const& v) noexcept
+{
+    for (auto i = 0_uz; i != 4; ++i) {
+        p[i].set(cvtss_sh(v[i]));
+    }
+}
+
+[[nodiscard]] hi_force_inline std::array<float, 4>
+sfloat_rgba16_composit1(std::array<float, 4> const& under, std::array<float, 4> const& over) noexcept
+{
+    hilet over_alpha = over[3];
+    hilet under_alpha = under[3];
+
+    if (over_alpha <= 0.0f) {
+        return under;
+    }
+    if (over_alpha >= 1.0f) {
+        return over;
+    }
+
+    hilet alpha = over_alpha + under_alpha * (1.0f - over_alpha);
+
+    auto r = std::array<float, 4>{};
+    for (auto i = 0_uz; i != 3; ++i) {
+        r[i] = (over[i] * over_alpha + under[i] * under_alpha * (1.0f - over_alpha)) / alpha;
+    }
+    r[3] = alpha;
+    return r;
+}
+
+[[nodiscard]] hi_force_inline std::array<float, 4> sfloat_rgba16_premultiply1(std::array<float, 4> v) noexcept
+{
+    for (auto i = 0_uz; i != 3; ++i) {
+        v[i] *= v[3];
+    }
+    return v;
+}
+
+[[nodiscard]] hi_force_inline std::array<float, 4> sfloat_rgba16_unpremultiply1(std::array<float, 4> v) noexcept
+{
+    if (v[3] > 0.0f) {
+        for (auto i = 0_uz; i != 3; ++i) {
+            v[i] /= v[3];
+        }
+    }
+    return v;
+}
+
+[[nodiscard]] hi_force_inline std::array<float, 4>
+sfloat_rgba16_transform1(std::array<float, 4> const& v, std::array<float, 16> const& matrix) noexcept
+{
+    auto r = std::array<float, 4>{};
+    for (auto i = 0_uz; i != 3; ++i) {
+        r[i] = matrix[i] * v[0] + matrix[4 + i] * v[1] + matrix[8 + i] * v[2] + matrix[12 + i];
+    }
+    r[3] = v[3];
+    return r;
+}
+#endif
+
+void sfloat_rgba16_fill_row(std::span<float16> row, std::array<float16, 4> color)
+{
+    hi_axiom(row.size() % 4 == 0);
+
+    hilet size = row.size();
+    auto *hi_restrict p = row.data();
+    auto i = 0_uz;
+
+#if HI_CPU_DISPATCH_LEVEL >= 3
+    hilet pixels = _mm256_set1_epi64x(std::bit_cast<int64_t>(color));
+    for (; i + 16 <= size; i += 16) {
+        _mm256_storeu_si256(reinterpret_cast<__m256i *>(p + i), pixels);
+    }
+#endif
+    for (; i != size; i += 4) {
+        std::copy_n(color.data(), 4, p + i);
+    }
+}
+
+void sfloat_rgba16_composit_row(std::span<float16> under, std::span<float16 const> over)
+{
+    hi_axiom(under.size() % 4 == 0);
+    hi_axiom(over.size() >= under.size());
+
+    hilet size = under.size();
+    auto *hi_restrict p = under.data();
+    auto const *hi_restrict q = over.data();
+    auto i = 0_uz;
+
+#if HI_CPU_DISPATCH_LEVEL >= 3
+    for (; i + 8 <= size; i += 8) {
+        sfloat_rgba16_store2(p + i, sfloat_rgba16_composit2(sfloat_rgba16_load2(p + i), sfloat_rgba16_load2(q + i)));
+    }
+    if (i != size) {
+        sfloat_rgba16_store1(p + i, sfloat_rgba16_composit2(sfloat_rgba16_load1(p + i), sfloat_rgba16_load1(q + i)));
+    }
+#else
+    for (; i != size; i += 4) {
+        sfloat_rgba16_store1(p + i, sfloat_rgba16_composit1(sfloat_rgba16_load1(p + i), sfloat_rgba16_load1(q + i)));
+    }
+#endif
+}
+
+void sfloat_rgba16_composit_mask_row(std::span<float16> under, std::array<float, 4> over, std::span<uint8_t const> mask)
+{
+    hi_axiom(under.size() % 4 == 0);
+    hi_axiom(mask.size() >= under.size() / 4);
+
+    hilet size = under.size();
+    auto *hi_restrict p = under.data();
+    auto const *hi_restrict m = mask.data();
+    auto i = 0_uz;
+
+#if HI_CPU_DISPATCH_LEVEL >= 3
+    hilet over_ = _mm256_setr_ps(over[0], over[1], over[2], over[3], over[0], over[1], over[2], over[3]);
+
+    for (; i + 8 <= size; i += 8) {
+        hilet over_pixels = sfloat_rgba16_mask2(over_, m[i / 4], m[i / 4 + 1]);
+        sfloat_rgba16_store2(p + i, sfloat_rgba16_composit2(sfloat_rgba16_load2(p + i), over_pixels));
+    }
+    if (i != size) {
+        hilet over_pixels = sfloat_rgba16_mask2(over_, m[i / 4], 0);
+        sfloat_rgba16_store1(p + i, sfloat_rgba16_composit2(sfloat_rgba16_load1(p + i), over_pixels));
+    }
+#else
+    for (; i != size; i += 4) {
+        auto over_pixel = over;
+        over_pixel[3] *= static_cast<float>(m[i / 4]) / 255.0f;
+        sfloat_rgba16_store1(p + i, sfloat_rgba16_composit1(sfloat_rgba16_load1(p + i), over_pixel));
+    }
+#endif
+}
+
+void sfloat_rgba16_premultiply_row(std::span<float16> row)
+{
+    hi_axiom(row.size() % 4 == 0);
+
+    hilet size = row.size();
+    auto *hi_restrict p = row.data();
+    auto i = 0_uz;
+
+#if HI_CPU_DISPATCH_LEVEL >= 3
+    for (; i + 8 <= size; i += 8) {
+        sfloat_rgba16_store2(p + i, sfloat_rgba16_premultiply2(sfloat_rgba16_load2(p + i)));
+    }
+    if (i != size) {
+        sfloat_rgba16_store1(p + i, sfloat_rgba16_premultiply2(sfloat_rgba16_load1(p + i)));
+    }
+#else
+    for (; i != size; i += 4) {
+        sfloat_rgba16_store1(p + i, sfloat_rgba16_premultiply1(sfloat_rgba16_load1(p + i)));
+    }
+#endif
+}
+
+void sfloat_rgba16_unpremultiply_row(std::span<float16> row)
+{
+    hi_axiom(row.size() % 4 == 0);
+
+    hilet size = row.size();
+    auto *hi_restrict p = row.data();
+    auto i = 0_uz;
+
+#if HI_CPU_DISPATCH_LEVEL >= 3
+    for (; i + 8 <= size; i += 8) {
+        sfloat_rgba16_store2(p + i, sfloat_rgba16_unpremultiply2(sfloat_rgba16_load2(p + i)));
+    }
+    if (i != size) {
+        sfloat_rgba16_store1(p + i, sfloat_rgba16_unpremultiply2(sfloat_rgba16_load1(p + i)));
+    }
+#else
+    for (; i != size; i += 4) {
+        sfloat_rgba16_store1(p + i, sfloat_rgba16_unpremultiply1(sfloat_rgba16_load1(p + i)));
+    }
+#endif
+}
+
+void sfloat_rgba16_transform_row(std::span<float16> row, std::array<float, 16> const& matrix)
+{
+    hi_axiom(row.size() % 4 == 0);
+
+    hilet size = row.size();
+    auto *hi_restrict p = row.data();
+    auto i = 0_uz;
+
+#if HI_CPU_DISPATCH_LEVEL >= 3
+    hilet col0 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(matrix.data()));
+    hilet col1 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(matrix.data() + 4));
+    hilet col2 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(matrix.data() + 8));
+    hilet col3 = _mm256_broadcast_ps(reinterpret_cast<__m128 const *>(matrix.data() + 12));
+
+    for (; i + 8 <= size; i += 8) {
+        sfloat_rgba16_store2(p + i, sfloat_rgba16_transform2(sfloat_rgba16_load2(p + i), col0, col1, col2, col3));
+    }
+    if (i != size) {
+        sfloat_rgba16_store1(p + i, sfloat_rgba16_transform2(sfloat_rgba16_load1(p + i), col0, col1, col2, col3));
+    }
+#else
+    for (; i != size; i += 4) {
+        sfloat_rgba16_store1(p + i, sfloat_rgba16_transform1(sfloat_rgba16_load1(p + i), matrix));
+    }
+#endif
+}
+
+}}} // namespace hi::v1::HI_CPU_DISPATCH_NAMESPACE
+
+hi_cpu_dispatch_target_pop()
@@ -0,0 +1,184 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "sfloat_rgba16_row.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+#include <array>
+#include <cmath>
+
+using namespace hi;
+
+namespace {
+
+using rgba = std::array<float, 4>;
+
+[[nodiscard]] std::vector<hi::float16> make_row(std::vector<rgba> const& pixels)
+{
+    auto r = std::vector<hi::float16>{};
+    for (hilet& pixel : pixels) {
+        for (hilet element : pixel) {
+            r.push_back(hi::float16{element});
+        }
+    }
+    return r;
+}
+
+/** Pixels with a mix of transparent, translucent and opaque alpha values.
+ */
+[[nodiscard]] std::vector<rgba> make_pixels(size_t size, size_t seed)
+{
+    auto r = std::vector<rgba>{};
+    for (auto i = 0_uz; i != size; ++i) {
+        hilet j = i + seed;
+        hilet alpha = j % 5 == 0 ? 0.0f : j % 5 == 1 ? 1.0f : static_cast<float>(j % 7 + 1) / 8.0f;
+        r.push_back(rgba{static_cast<float>(j % 11 + 1) / 11.0f, static_cast<float>(j % 3) / 2.0f, 0.25f + static_cast<float>(j % 13) / 4.0f, alpha});
+    }
+    return r;
+}
+
+[[nodiscard]] rgba composit(rgba const& under, rgba const& over)
+{
+    if (over[3] <= 0.0f) {
+        return under;
+    } else if (over[3] >= 1.0f) {
+        return over;
+    }
+
+    hilet alpha = over[3] + under[3] * (1.0f - over[3]);
+    auto r = rgba{};
+    for (auto i = 0_uz; i != 3; ++i) {
+        r[i] = (over[i] * over[3] + under[i] * under[3] * (1.0f - over[3])) / alpha;
+    }
+    r[3] = alpha;
+    return r;
+}
+
+void expect_row(std::vector<hi::float16> const& row, std::vector<rgba> const& expected, int level)
+{
+    ASSERT_EQ(row.size(), expected.size() * 4);
+    for (auto i = 0_uz; i != row.size(); ++i) {
+        hilet e = expected[i / 4][i % 4];
+        // float16 has 11 bits of precision, allow for a couple of bits of rounding.
+        ASSERT_NEAR(static_cast<float>(row[i]), e, std::abs(e) / 256.0f + 0.0001f) << "level=" << level << " index=" << i;
+    }
+}
+
+} // namespace
+
+TEST(sfloat_rgba16_row, fill)
+{
+    for (auto level = 0; level <= hi::cpu_dispatch_level(); ++level) {
+        hilet kernel = hi::sfloat_rgba16_fill_row.get(level);
+
+        for (auto size : {0_uz, 1_uz, 3_uz, 4_uz, 5_uz, 17_uz}) {
+            auto row = make_row(std::vector<rgba>(size, rgba{0.5f, 0.5f, 0.5f, 0.5f}));
+            kernel(row, {hi::float16{0.25f}, hi::float16{0.5f}, hi::float16{0.75f}, hi::float16{1.0f}});
+            expect_row(row, std::vector<rgba>(size, rgba{0.25f, 0.5f, 0.75f, 1.0f}), level);
+        }
+    }
+}
+
+TEST(sfloat_rgba16_row, composit)
+{
+    for (auto level = 0; level <= hi::cpu_dispatch_level(); ++level) {
+        hilet kernel = hi::sfloat_rgba16_composit_row.get(level);
+
+        for (auto size : {0_uz, 1_uz, 2_uz, 3_uz, 16_uz, 35_uz}) {
+            hilet under = make_pixels(size, 0);
+            hilet over = make_pixels(size + 1, 3);
+
+            auto expected = std::vector<rgba>{};
+            for (auto i = 0_uz; i != size; ++i) {
+                expected.push_back(composit(under[i], over[i]));
+            }
+
+            auto row = make_row(under);
+            hilet over_row = make_row(over);
+            kernel(row, over_row);
+            expect_row(row, expected, level);
+        }
+    }
+}
+
+TEST(sfloat_rgba16_row, composit_mask)
+{
+    for (auto level = 0; level <= hi::cpu_dispatch_level(); ++level) {
+        hilet kernel = hi::sfloat_rgba16_composit_mask_row.get(level);
+
+        for (auto size : {0_uz, 1_uz, 2_uz, 3_uz, 16_uz, 35_uz}) {
+            hilet under = make_pixels(size, 1);
+            hilet over = rgba{1.0f, 0.5f, 0.25f, 0.75f};
+
+            auto mask = std::vector<uint8_t>{};
+            auto expected = std::vector<rgba>{};
+            for (auto i = 0_uz; i != size; ++i) {
+                mask.push_back(static_cast<uint8_t>(i * 37));
+                auto over_pixel = over;
+                over_pixel[3] *= mask.back() / 255.0f;
+                expected.push_back(composit(under[i], over_pixel));
+            }
+
+            auto row = make_row(under);
+            kernel(row, over, mask);
+            expect_row(row, expected, level);
+        }
+    }
+}
+
+TEST(sfloat_rgba16_row, premultiply)
+{
+    for (auto level = 0; level <= hi::cpu_dispatch_level(); ++level) {
+        hilet premultiply = hi::sfloat_rgba16_premultiply_row.get(level);
+        hilet unpremultiply = hi::sfloat_rgba16_unpremultiply_row.get(level);
+
+        for (auto size : {0_uz, 1_uz, 2_uz, 3_uz, 16_uz, 35_uz}) {
+            hilet pixels = make_pixels(size, 2);
+
+            auto expected = std::vector<rgba>{};
+            for (hilet& pixel : pixels) {
+                expected.push_back(rgba{pixel[0] * pixel[3], pixel[1] * pixel[3], pixel[2] * pixel[3], pixel[3]});
+            }
+
+            auto row = make_row(pixels);
+            premultiply(row);
+            expect_row(row, expected, level);
+
+            // Transparent pixels lose their color.
+            for (auto i = 0_uz; i != size; ++i) {
+                if (pixels[i][3] != 0.0f) {
+                    expected[i] = pixels[i];
+                }
+            }
+
+            unpremultiply(row);
+            expect_row(row, expected, level);
+        }
+    }
+}
+
+TEST(sfloat_rgba16_row, transform)
+{
+    // A column-major matrix that swaps red and blue and halves green.
+    hilet matrix =
+        std::array<float, 16>{0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.5f, 0.0f, 0.0f, 1.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 0.0f, 1.0f};
+
+    for (auto level = 0; level <= hi::cpu_dispatch_level(); ++level) {
+        hilet kernel = hi::sfloat_rgba16_transform_row.get(level);
+
+        for (auto size : {0_uz, 1_uz, 2_uz, 3_uz, 16_uz, 35_uz}) {
+            hilet pixels = make_pixels(size, 4);
+
+            auto expected = std::vector<rgba>{};
+            for (hilet& pixel : pixels) {
+                expected.push_back(rgba{pixel[2], pixel[1] * 0.5f, pixel[0], pixel[3]});
+            }
+
+            auto row = make_row(pixels);
+            kernel(row, matrix);
+            expect_row(row, expected, level);
+        }
+    }
+}
@@ -35,7 +35,7 @@ public:
         v = rhs;
         return *this;
     }
-    constexpr operator uint32_t() noexcept
+    constexpr operator uint32_t() const noexcept
     {
         return v;
     }
@@ -73,18 +73,58 @@ public:
     }
 };
 
-//inline void fill(pixmap<srgb_abgr8_pack> &dst, pixmap<sfloat_rgba16> const &src) noexcept
-//{
-//    hi_assert(dst.width >= src.width);
-//    hi_assert(dst.height >= src.height);
-//
-//    for (auto rowNr = 0; rowNr < src.height; rowNr++) {
-//        hilet srcRow = src.at(rowNr);
-//        auto dstRow = dst.at(rowNr);
-//        for (auto columnNr = 0; columnNr < src.width; columnNr++) {
-//            dstRow[columnNr] = srcRow[columnNr];
-//        }
-//    }
-//}
+/** Convert a linear image to an sRGB image.
+ *
+ * The sRGB transfer function is applied through a lookup table indexed by
+ * the float16 value, which is faster than a vectorized `std::pow()`.
+ *
+ * @param dst The sRGB image, at least as large as @a src.
+ * @param src The linear image.
+ */
+inline void fill(pixmap_span<srgb_abgr8_pack> dst, pixmap_span<sfloat_rgba16 const> src) noexcept
+{
+    hi_assert(dst.width() >= src.width());
+    hi_assert(dst.height() >= src.height());
+
+    for (auto y = 0_uz; y != src.height(); ++y) {
+        hilet src_row = detail::sfloat_rgba16_row_elements(src[y]);
+        hilet dst_row = dst[y];
+        for (auto x = 0_uz; x != src.width(); ++x) {
+            hilet pixel = src_row.subspan(x * 4, 4);
+
+            hilet r = sRGB_linear16_to_gamma8(pixel[0]);
+            hilet g = sRGB_linear16_to_gamma8(pixel[1]);
+            hilet b = sRGB_linear16_to_gamma8(pixel[2]);
+            hilet a = static_cast<uint8_t>(std::clamp(static_cast<float>(pixel[3]) * 255.0f, 0.0f, 255.0f));
+            dst_row[x] = (static_cast<uint32_t>(a) << 24) | (static_cast<uint32_t>(b) << 16) |
+                (static_cast<uint32_t>(g) << 8) | static_cast<uint32_t>(r);
+        }
+    }
+}
+
+/** Convert an sRGB image to a linear image.
+ *
+ * @param dst The linear image, at least as large as @a src.
+ * @param src The sRGB image.
+ */
+inline void fill(pixmap_span<sfloat_rgba16> dst, pixmap_span<srgb_abgr8_pack const> src) noexcept
+{
+    hi_assert(dst.width() >= src.width());
+    hi_assert(dst.height() >= src.height());
+
+    for (auto y = 0_uz; y != src.height(); ++y) {
+        hilet src_row = src[y];
+        hilet dst_row = detail::sfloat_rgba16_row_elements(dst[y]);
+        for (auto x = 0_uz; x != src.width(); ++x) {
+            hilet packed = static_cast<uint32_t>(src_row[x]);
+            hilet pixel = dst_row.subspan(x * 4, 4);
+
+            pixel[0] = sRGB_gamma8_to_linear16(truncate<uint8_t>(packed));
+            pixel[1] = sRGB_gamma8_to_linear16(truncate<uint8_t>(packed >> 8));
+            pixel[2] = sRGB_gamma8_to_linear16(truncate<uint8_t>(packed >> 16));
+            pixel[3] = float16{truncate<uint8_t>(packed >> 24) / 255.0f};
+        }
+    }
+}
 
 } // namespace hi::inline v1
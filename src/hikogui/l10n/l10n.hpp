@@ -6,6 +6,7 @@
 #include "po_parser.hpp" // export
 #include "txt.hpp" // export
 #include "translation.hpp" // export
+#include "translation_catalog.hpp" // export
 
 hi_export_module(hikogui.l10n);
 
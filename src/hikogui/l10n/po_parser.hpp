@@ -4,7 +4,6 @@
 
 #pragma once
 
-#include "translation.hpp"
 #include "../i18n/module.hpp"
 #include "../file/file.hpp"
 #include "../parser/parser.hpp"
@@ -127,7 +126,12 @@ template<std::input_iterator It, std::sentinel_for<It> ItEnd>
         }
     }
 
-    return std::nullopt;
+    if (r.msgstr.empty()) {
+        return std::nullopt;
+    } else {
+        // The last translation in the file.
+        return r;
+    }
 }
 
 constexpr void parse_po_header(po_translations& r, std::string_view header)
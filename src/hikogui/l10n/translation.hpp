@@ -4,8 +4,8 @@
 
 #pragma once
 
-#include "translation.hpp"
 #include "po_parser.hpp"
+#include "translation_catalog.hpp"
 #include "../i18n/module.hpp"
 #include "../formula/formula.hpp"
 #include "../utility/utility.hpp"
@@ -16,66 +16,77 @@
 #include <string>
 #include <string_view>
 #include <vector>
-#include <unordered_map>
 #include <tuple>
+#include <filesystem>
+#include <atomic>
+#include <cstddef>
+#include <ranges>
+#include <system_error>
 
 hi_export_module(hikogui.l10n.translation);
 
 namespace hi {
 inline namespace v1 {
 
-struct translation_key {
-    std::string msgid;
-    language_tag language;
-
-    [[nodiscard]] std::size_t hash() const noexcept
-    {
-        return hash_mix(msgid, language);
-    }
-
-    [[nodiscard]] constexpr friend bool operator==(translation_key const &, translation_key const &) noexcept = default;
-};
-
-}} // namespace hi::inline v1
-
-template<>
-struct std::hash<hi::translation_key> {
-    [[nodiscard]] std::size_t operator()(hi::translation_key const &rhs) const noexcept
-    {
-        return rhs.hash();
-    }
-};
-
-namespace hi {
-inline namespace v1 {
-
-inline std::unordered_map<translation_key, std::vector<std::string>> translations;
+/** The loaded translation catalogs, one for each loaded translation file.
+ *
+ * A catalog that is loaded later overrides the translations of the catalogs loaded before it.
+ */
+inline std::vector<translation_catalog> translation_catalogs;
 inline std::atomic<bool> translations_loaded = false;
 
-inline void add_translation(std::string_view msgid, language_tag language, std::vector<std::string> const &plural_forms) noexcept
-{
-    auto key = translation_key{std::string{msgid}, language};
-    translations[key] = plural_forms;
-}
+/** The generation of the translation catalogs.
+ *
+ * It is incremented each time a catalog is added, so that a cached translation
+ * made with an older generation can be detected as stale.
+ */
+inline std::atomic<std::size_t> translations_generation = 0;
 
-inline void add_translations(po_translations const &po_translations) noexcept
+inline void add_translations(po_translations const &po_translations)
 {
-    for (hilet &translation : po_translations.translations) {
-        auto msgid = translation.msgctxt ? *translation.msgctxt + '|' + translation.msgid : translation.msgid;
-        add_translation(std::move(msgid), po_translations.language, translation.msgstr);
-    }
+    translation_catalogs.emplace_back(compile_translation_catalog(po_translations));
+    translations_generation.fetch_add(1, std::memory_order::release);
 }
 
+/** Load a translation file.
+ *
+ * @param path The path to a compiled catalog with the .hitc extension, which is
+ *             memory-mapped; or the path to a .po file which is compiled in memory.
+ */
 inline void load_translations(std::filesystem::path path)
 {
     hi_log_info("Loading translation file {}.", path.string());
-    return add_translations(parse_po(path));
+    if (path.extension() == ".hitc") {
+        translation_catalogs.emplace_back(path);
+        translations_generation.fetch_add(1, std::memory_order::release);
+    } else {
+        add_translations(parse_po(path));
+    }
 }
 
 inline void load_translations()
 {
     if (not translations_loaded.exchange(true)) {
+        for (auto &path : glob(path_location::resource_dirs, "**/*.hitc")) {
+            try {
+                load_translations(path);
+            } catch (std::exception const &e) {
+                hi_log_error("Could not load translation file. {}", e.what());
+            }
+        }
+
         for (auto &path : glob(path_location::resource_dirs, "**/*.po")) {
+            // A .po file with an up-to-date compiled catalog next to it was already loaded.
+            // A .po file that was edited after it was compiled is loaded after, and overrides, the stale catalog.
+            hilet catalog_path = std::filesystem::path{path}.replace_extension(".hitc");
+            auto catalog_ec = std::error_code{};
+            auto po_ec = std::error_code{};
+            hilet catalog_time = std::filesystem::last_write_time(catalog_path, catalog_ec);
+            hilet po_time = std::filesystem::last_write_time(path, po_ec);
+            if (not catalog_ec and not po_ec and catalog_time >= po_time) {
+                continue;
+            }
+
             try {
                 load_translations(path);
             } catch (std::exception const &e) {
@@ -85,23 +96,32 @@ inline void load_translations()
     }
 }
 
+/** Get the translation of a message.
+ *
+ * @note Apart from loading the translations on the first call, this function does not allocate.
+ * @param msgid The message to translate; with a context the msgid is "msgctxt|msgid".
+ * @param n The count used to select the plural form.
+ * @param languages The languages in order of preference.
+ * @return The translation and its language, or @a msgid when no translation was found.
+ */
 [[nodiscard]] inline std::pair<std::string_view, language_tag>
 get_translation(std::string_view msgid, long long n, std::vector<language_tag> const &languages) noexcept
 {
     load_translations();
 
-    // Update only the language in each iteration.
-    auto key = translation_key{std::string{msgid}, language_tag{}};
-
     for (hilet language : languages) {
-        key.language = language;
-
-        hilet i = translations.find(key);
-        if (i != translations.cend()) {
-            hilet plurality = cardinal_plural(language, n, i->second.size());
-            hilet &translation = i->second[plurality];
-            if (translation.size() != 0) {
-                return {translation, language};
+        // Search the last loaded catalog first, so that later loaded translations override earlier ones.
+        for (hilet &catalog : std::views::reverse(translation_catalogs)) {
+            if (catalog.language() != language) {
+                continue;
+            }
+
+            if (hilet plural_forms = catalog.find(msgid); not plural_forms.empty()) {
+                hilet plurality = cardinal_plural(language, n, plural_forms.size());
+                hilet translation = plural_forms[plurality];
+                if (translation.size() != 0) {
+                    return {translation, language};
+                }
             }
         }
     }
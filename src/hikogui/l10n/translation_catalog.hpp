@@ -0,0 +1,457 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file l10n/translation_catalog.hpp Defines translation_catalog and compile_translation_catalog().
+ * @ingroup l10n
+ */
+
+#pragma once
+
+#include "po_parser.hpp"
+#include "../i18n/module.hpp"
+#include "../file/file.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <string>
+#include <string_view>
+#include <vector>
+#include <span>
+#include <map>
+#include <algorithm>
+#include <limits>
+#include <filesystem>
+#include <cstdint>
+#include <cstddef>
+
+hi_export_module(hikogui.l10n.translation_catalog);
+
+namespace hi { inline namespace v1 {
+namespace detail {
+
+/** The header of a compiled translation catalog.
+ *
+ * All integers in the catalog are unsigned 32-bit little-endian, offsets are
+ * from the start of the catalog. After the header follow:
+ *  - The displacement seed of each bucket of the perfect hash.
+ *  - The slots of the perfect hash, each containing the offset and size of the msgid,
+ *    the index of the first plural form and the number of plural forms. Empty slots
+ *    have zero plural forms.
+ *  - The offset and size of each plural form; the plural forms of a message are contiguous.
+ *  - The text of the language tag, the msgids and the plural forms.
+ */
+struct translation_catalog_header {
+    little_uint32_buf_t magic;
+    little_uint32_buf_t version;
+    little_uint32_buf_t num_entries;
+    little_uint32_buf_t num_buckets;
+    little_uint32_buf_t num_slots;
+    little_uint32_buf_t num_forms;
+    little_uint32_buf_t buckets_offset;
+    little_uint32_buf_t slots_offset;
+    little_uint32_buf_t forms_offset;
+    little_uint32_buf_t language_offset;
+    little_uint32_buf_t language_size;
+    little_uint32_buf_t reserved;
+};
+
+constexpr uint32_t translation_catalog_magic = "HITC"_fcc;
+constexpr uint32_t translation_catalog_version = 1;
+constexpr std::size_t translation_catalog_slot_size = 4 * sizeof(uint32_t);
+constexpr std::size_t translation_catalog_form_size = 2 * sizeof(uint32_t);
+
+/** The hash function of the perfect hash of a translation catalog.
+ *
+ * This hash is part of the file format and must not be changed without
+ * changing the version of the catalog.
+ *
+ * @param str The msgid to hash.
+ * @param seed The seed, 0 for selecting the bucket; or the displacement seed of the bucket.
+ */
+[[nodiscard]] constexpr uint64_t translation_catalog_hash(std::string_view str, uint32_t seed) noexcept
+{
+    // FNV-1a, with the seed mixed into the offset-basis.
+    auto h = uint64_t{0xcbf2'9ce4'8422'2325} ^ (uint64_t{seed} * 0x9e37'79b9'7f4a'7c15);
+    for (hilet c : str) {
+        h ^= static_cast<uint8_t>(c);
+        h *= 0x0000'0100'0000'01b3;
+    }
+
+    // The finalizer of murmur3 so that all bits of the hash depend on the seed.
+    h ^= h >> 33;
+    h *= 0xff51'afd7'ed55'8ccd;
+    h ^= h >> 33;
+    h *= 0xc4ce'b9fe'1a85'ec53;
+    h ^= h >> 33;
+    return h;
+}
+
+} // namespace detail
+
+/** A compiled catalog of the translations of a single language.
+ *
+ * The catalog is a binary file compiled from a .po file by
+ * `compile_translation_catalog()`. It is memory-mapped and used in place;
+ * there is no parsing at load time beyond validating the offsets.
+ *
+ * The msgid are indexed with a perfect hash (hash-and-displace) so that a
+ * lookup requires two hashes of the msgid and a single string compare.
+ */
+hi_export class translation_catalog {
+public:
+    /** The plural forms of a message.
+     *
+     * The plural forms are a view into the catalog, and are valid for as long
+     * as the catalog is alive.
+     */
+    class plural_forms_type {
+    public:
+        constexpr plural_forms_type() noexcept = default;
+
+        constexpr plural_forms_type(std::byte const *data, std::byte const *forms, std::size_t size) noexcept :
+            _data(data), _forms(forms), _size(size)
+        {
+        }
+
+        [[nodiscard]] constexpr std::size_t size() const noexcept
+        {
+            return _size;
+        }
+
+        [[nodiscard]] constexpr bool empty() const noexcept
+        {
+            return _size == 0;
+        }
+
+        [[nodiscard]] std::string_view operator[](std::size_t index) const noexcept
+        {
+            hi_axiom(index < _size);
+            hilet *form = _forms + index * detail::translation_catalog_form_size;
+            hilet offset = load_le<uint32_t>(form);
+            hilet size = load_le<uint32_t>(form + sizeof(uint32_t));
+            return {reinterpret_cast<char const *>(_data + offset), size};
+        }
+
+    private:
+        std::byte const *_data = nullptr;
+        std::byte const *_forms = nullptr;
+        std::size_t _size = 0;
+    };
+
+    translation_catalog(translation_catalog const&) = delete;
+    translation_catalog(translation_catalog&&) noexcept = default;
+    translation_catalog& operator=(translation_catalog const&) = delete;
+    translation_catalog& operator=(translation_catalog&&) noexcept = default;
+
+    /** Memory-map a compiled catalog.
+     *
+     * @param path The path to the compiled catalog.
+     * @throws io_error When the file could not be mapped.
+     * @throws parse_error When the file is not a valid catalog.
+     */
+    explicit translation_catalog(std::filesystem::path const& path) : _view(path)
+    {
+        hilet bytes = as_span<std::byte const>(_view);
+        _data = bytes.data();
+        _size = bytes.size();
+        validate();
+    }
+
+    /** Use a compiled catalog from memory.
+     *
+     * @param bytes The compiled catalog, as returned by `compile_translation_catalog()`.
+     * @throws parse_error When the bytes are not a valid catalog.
+     */
+    explicit translation_catalog(std::vector<std::byte> bytes) : _storage(std::move(bytes))
+    {
+        // The data of a vector does not move when the vector is moved, so the catalog is movable.
+        _data = _storage.data();
+        _size = _storage.size();
+        validate();
+    }
+
+    /** The language of the translations in this catalog.
+     */
+    [[nodiscard]] language_tag language() const noexcept
+    {
+        return _language;
+    }
+
+    /** The number of messages in this catalog.
+     */
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _num_entries;
+    }
+
+    /** Find the translation of a message.
+     *
+     * @note This function does not allocate.
+     * @param msgid The message to find; with a context the msgid is "msgctxt|msgid".
+     * @return The plural forms of the translation, empty when the message is not in the catalog.
+     */
+    [[nodiscard]] plural_forms_type find(std::string_view msgid) const noexcept
+    {
+        hilet bucket = detail::translation_catalog_hash(msgid, 0) % _num_buckets;
+        hilet seed = load_le<uint32_t>(_buckets + bucket * sizeof(uint32_t));
+        hilet slot_index = detail::translation_catalog_hash(msgid, seed) % _num_slots;
+        hilet *slot = _slots + slot_index * detail::translation_catalog_slot_size;
+
+        hilet num_forms = load_le<uint32_t>(slot + 3 * sizeof(uint32_t));
+        if (num_forms == 0) {
+            return {};
+        }
+
+        hilet msgid_offset = load_le<uint32_t>(slot);
+        hilet msgid_size = load_le<uint32_t>(slot + sizeof(uint32_t));
+        if (std::string_view{reinterpret_cast<char const *>(_data + msgid_offset), msgid_size} != msgid) {
+            return {};
+        }
+
+        hilet first_form = load_le<uint32_t>(slot + 2 * sizeof(uint32_t));
+        return {_data, _forms + first_form * detail::translation_catalog_form_size, num_forms};
+    }
+
+private:
+    file_view _view;
+    std::vector<std::byte> _storage;
+    std::byte const *_data = nullptr;
+    std::size_t _size = 0;
+
+    std::byte const *_buckets = nullptr;
+    std::byte const *_slots = nullptr;
+    std::byte const *_forms = nullptr;
+    std::size_t _num_entries = 0;
+    std::size_t _num_buckets = 0;
+    std::size_t _num_slots = 0;
+    language_tag _language;
+
+    [[nodiscard]] bool in_bounds(uint64_t offset, uint64_t size) const noexcept
+    {
+        return offset <= _size and size <= _size - offset;
+    }
+
+    /** Check that all offsets in the catalog are within the file.
+     *
+     * After validation `find()` can use the offsets without checking.
+     */
+    void validate()
+    {
+        using header_type = detail::translation_catalog_header;
+
+        hi_check(_size >= sizeof(header_type), "Translation catalog is too small.");
+        hilet& header = *reinterpret_cast<header_type const *>(_data);
+        hi_check(*header.magic == detail::translation_catalog_magic, "Translation catalog has an invalid magic.");
+        hi_check(
+            *header.version == detail::translation_catalog_version,
+            "Translation catalog has unsupported version {}.",
+            *header.version);
+
+        _num_entries = *header.num_entries;
+        _num_buckets = *header.num_buckets;
+        _num_slots = *header.num_slots;
+        hilet num_forms = uint64_t{*header.num_forms};
+        hi_check(_num_buckets != 0 and _num_slots != 0, "Translation catalog has an empty index.");
+        hi_check(_num_entries <= _num_slots, "Translation catalog has more entries than slots.");
+
+        hi_check(
+            in_bounds(*header.buckets_offset, uint64_t{_num_buckets} * sizeof(uint32_t)),
+            "Translation catalog buckets are out of bounds.");
+        hi_check(
+            in_bounds(*header.slots_offset, uint64_t{_num_slots} * detail::translation_catalog_slot_size),
+            "Translation catalog slots are out of bounds.");
+        hi_check(
+            in_bounds(*header.forms_offset, num_forms * detail::translation_catalog_form_size),
+            "Translation catalog plural forms are out of bounds.");
+        hi_check(in_bounds(*header.language_offset, *header.language_size), "Translation catalog language is out of bounds.");
+
+        _buckets = _data + *header.buckets_offset;
+        _slots = _data + *header.slots_offset;
+        _forms = _data + *header.forms_offset;
+        _language = language_tag{
+            std::string_view{reinterpret_cast<char const *>(_data + *header.language_offset), *header.language_size}};
+
+        auto num_used_slots = 0_uz;
+        for (auto i = 0_uz; i != _num_slots; ++i) {
+            hilet *slot = _slots + i * detail::translation_catalog_slot_size;
+            hilet msgid_offset = load_le<uint32_t>(slot);
+            hilet msgid_size = load_le<uint32_t>(slot + sizeof(uint32_t));
+            hilet first_form = uint64_t{load_le<uint32_t>(slot + 2 * sizeof(uint32_t))};
+            hilet slot_num_forms = uint64_t{load_le<uint32_t>(slot + 3 * sizeof(uint32_t))};
+            if (slot_num_forms == 0) {
+                continue;
+            }
+
+            ++num_used_slots;
+            hi_check(in_bounds(msgid_offset, msgid_size), "Translation catalog msgid is out of bounds.");
+            hi_check(first_form + slot_num_forms <= num_forms, "Translation catalog plural forms index is out of bounds.");
+        }
+        hi_check(num_used_slots == _num_entries, "Translation catalog number of entries does not match the slots.");
+
+        for (auto i = 0_uz; i != num_forms; ++i) {
+            hilet *form = _forms + i * detail::translation_catalog_form_size;
+            hi_check(
+                in_bounds(load_le<uint32_t>(form), load_le<uint32_t>(form + sizeof(uint32_t))),
+                "Translation catalog plural form is out of bounds.");
+        }
+    }
+};
+
+/** Compile translations into a catalog.
+ *
+ * Messages with a context are added as "msgctxt|msgid". When a msgid occurs
+ * multiple times the last translation is used.
+ *
+ * @param translations The translations of a .po file.
+ * @return The compiled catalog, to be written to a file or passed to `translation_catalog`.
+ */
+hi_export [[nodiscard]] inline std::vector<std::byte> compile_translation_catalog(po_translations const& translations)
+{
+    using header_type = detail::translation_catalog_header;
+
+    auto messages = std::map<std::string, std::vector<std::string> const *>{};
+    for (hilet& translation : translations.translations) {
+        auto msgid = translation.msgctxt ? *translation.msgctxt + '|' + translation.msgid : translation.msgid;
+        messages[std::move(msgid)] = &translation.msgstr;
+    }
+
+    // Messages without translations are left out, they would be indistinguishable from an empty slot.
+    auto entries = std::vector<std::pair<std::string_view, std::vector<std::string> const *>>{};
+    entries.reserve(messages.size());
+    for (hilet& [msgid, msgstr] : messages) {
+        if (not msgstr->empty()) {
+            entries.emplace_back(msgid, msgstr);
+        }
+    }
+
+    hilet num_entries = entries.size();
+    hilet num_buckets = std::max(1_uz, (num_entries + 3) / 4);
+    hilet num_slots = std::max(1_uz, num_entries + num_entries / 4);
+
+    // Hash-and-displace: distribute the entries over buckets, then starting with
+    // the largest bucket find a seed that places all entries of the bucket in free slots.
+    auto buckets = std::vector<std::vector<std::size_t>>(num_buckets);
+    for (auto i = 0_uz; i != num_entries; ++i) {
+        buckets[detail::translation_catalog_hash(entries[i].first, 0) % num_buckets].push_back(i);
+    }
+
+    auto bucket_order = std::vector<std::size_t>(num_buckets);
+    for (auto i = 0_uz; i != num_buckets; ++i) {
+        bucket_order[i] = i;
+    }
+    std::stable_sort(bucket_order.begin(), bucket_order.end(), [&](hilet lhs, hilet rhs) {
+        return buckets[lhs].size() > buckets[rhs].size();
+    });
+
+    constexpr auto empty_slot = std::numeric_limits<std::size_t>::max();
+    auto slot_entries = std::vector<std::size_t>(num_slots, empty_slot);
+    auto bucket_seeds = std::vector<uint32_t>(num_buckets, 0);
+    auto bucket_slots = std::vector<std::size_t>{};
+    for (hilet bucket : bucket_order) {
+        if (buckets[bucket].empty()) {
+            break;
+        }
+
+        for (auto seed = uint32_t{1};; ++seed) {
+            if (seed == 0) {
+                throw operation_error("Could not find a perfect hash for the translation catalog.");
+            }
+
+            bucket_slots.clear();
+            for (hilet entry : buckets[bucket]) {
+                hilet slot = detail::translation_catalog_hash(entries[entry].first, seed) % num_slots;
+                if (slot_entries[slot] != empty_slot or std::find(bucket_slots.begin(), bucket_slots.end(), slot) != bucket_slots.end()) {
+                    break;
+                }
+                bucket_slots.push_back(slot);
+            }
+
+            if (bucket_slots.size() == buckets[bucket].size()) {
+                for (auto i = 0_uz; i != bucket_slots.size(); ++i) {
+                    slot_entries[bucket_slots[i]] = buckets[bucket][i];
+                }
+                bucket_seeds[bucket] = seed;
+                break;
+            }
+        }
+    }
+
+    auto num_forms = 0_uz;
+    for (hilet& entry : entries) {
+        num_forms += entry.second->size();
+    }
+
+    hilet buckets_offset = sizeof(header_type);
+    hilet slots_offset = buckets_offset + num_buckets * sizeof(uint32_t);
+    hilet forms_offset = slots_offset + num_slots * detail::translation_catalog_slot_size;
+    hilet strings_offset = forms_offset + num_forms * detail::translation_catalog_form_size;
+
+    auto r = std::vector<std::byte>(strings_offset);
+    hilet store = [&r](std::size_t offset, std::size_t value) {
+        if (value > std::numeric_limits<uint32_t>::max()) {
+            throw operation_error("Translation catalog is too large.");
+        }
+        store_le(narrow_cast<uint32_t>(value), r.data() + offset);
+    };
+    hilet append = [&r](std::string_view str) {
+        hilet offset = r.size();
+        r.insert(r.end(), reinterpret_cast<std::byte const *>(str.data()), reinterpret_cast<std::byte const *>(str.data() + str.size()));
+        return offset;
+    };
+
+    hilet language = translations.language.to_string();
+    hilet language_offset = append(language);
+
+    for (auto i = 0_uz; i != num_buckets; ++i) {
+        store(buckets_offset + i * sizeof(uint32_t), bucket_seeds[i]);
+    }
+
+    // The plural forms are stored in the order of the slots, so that lookups of neighbouring slots share cache lines.
+    auto form_index = 0_uz;
+    for (auto i = 0_uz; i != num_slots; ++i) {
+        if (slot_entries[i] == empty_slot) {
+            continue;
+        }
+
+        hilet& [msgid, msgstr] = entries[slot_entries[i]];
+        hilet slot_offset = slots_offset + i * detail::translation_catalog_slot_size;
+        store(slot_offset, append(msgid));
+        store(slot_offset + sizeof(uint32_t), msgid.size());
+        store(slot_offset + 2 * sizeof(uint32_t), form_index);
+        store(slot_offset + 3 * sizeof(uint32_t), msgstr->size());
+
+        for (hilet& form : *msgstr) {
+            hilet form_offset = forms_offset + form_index++ * detail::translation_catalog_form_size;
+            store(form_offset, append(form));
+            store(form_offset + sizeof(uint32_t), form.size());
+        }
+    }
+
+    store(offsetof(header_type, magic), detail::translation_catalog_magic);
+    store(offsetof(header_type, version), detail::translation_catalog_version);
+    store(offsetof(header_type, num_entries), num_entries);
+    store(offsetof(header_type, num_buckets), num_buckets);
+    store(offsetof(header_type, num_slots), num_slots);
+    store(offsetof(header_type, num_forms), num_forms);
+    store(offsetof(header_type, buckets_offset), buckets_offset);
+    store(offsetof(header_type, slots_offset), slots_offset);
+    store(offsetof(header_type, forms_offset), forms_offset);
+    store(offsetof(header_type, language_offset), language_offset);
+    store(offsetof(header_type, language_size), language.size());
+    return r;
+}
+
+/** Compile a .po file into a catalog file.
+ *
+ * @param po_path The path to the .po file.
+ * @param catalog_path The path to the catalog file to write, by convention with the .hitc extension.
+ */
+hi_export inline void compile_translation_catalog(std::filesystem::path const& po_path, std::filesystem::path const& catalog_path)
+{
+    hilet catalog = compile_translation_catalog(parse_po(po_path));
+    auto f = file{catalog_path, access_mode::truncate_or_create_for_write};
+    f.write(std::span<std::byte const>{catalog});
+    f.close();
+}
+
+}} // namespace hi::v1
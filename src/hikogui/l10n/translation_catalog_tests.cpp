@@ -0,0 +1,127 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "translation_catalog.hpp"
+#include "po_parser.hpp"
+#include "../file/file.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <format>
+#include <string>
+#include <filesystem>
+
+using namespace hi;
+
+namespace {
+
+constexpr auto test_po = std::string_view{
+    "msgid \"\"\n"
+    "msgstr \"\"\n"
+    "\"Language: nl\\n\"\n"
+    "\"Plural-Forms: nplurals=2; plural=(n != 1);\\n\"\n"
+    "\n"
+    "msgid \"Hello\"\n"
+    "msgstr \"Hallo\"\n"
+    "\n"
+    "msgctxt \"menu\"\n"
+    "msgid \"Open\"\n"
+    "msgstr \"Openen\"\n"
+    "\n"
+    "msgid \"one file\"\n"
+    "msgid_plural \"{} files\"\n"
+    "msgstr[0] \"een bestand\"\n"
+    "msgstr[1] \"{} bestanden\"\n"};
+
+} // namespace
+
+TEST(translation_catalog, find)
+{
+    hilet catalog = translation_catalog{compile_translation_catalog(parse_po(test_po, "test.po"))};
+    ASSERT_EQ(catalog.language(), language_tag{"nl"});
+    ASSERT_EQ(catalog.size(), 3);
+
+    hilet hello = catalog.find("Hello");
+    ASSERT_EQ(hello.size(), 1);
+    ASSERT_EQ(hello[0], "Hallo");
+
+    hilet open = catalog.find("menu|Open");
+    ASSERT_EQ(open.size(), 1);
+    ASSERT_EQ(open[0], "Openen");
+
+    hilet files = catalog.find("one file");
+    ASSERT_EQ(files.size(), 2);
+    ASSERT_EQ(files[0], "een bestand");
+    ASSERT_EQ(files[1], "{} bestanden");
+
+    ASSERT_TRUE(catalog.find("Open").empty());
+    ASSERT_TRUE(catalog.find("Goodbye").empty());
+    ASSERT_TRUE(catalog.find("").empty());
+}
+
+TEST(translation_catalog, many)
+{
+    auto translations = po_translations{};
+    translations.language = language_tag{"en-GB"};
+    translations.nr_plural_forms = 2;
+    for (auto i = 0; i != 5000; ++i) {
+        auto& translation = translations.translations.emplace_back();
+        translation.msgid = std::format("message {}", i);
+        translation.msgstr.push_back(std::format("one {}", i));
+        translation.msgstr.push_back(std::format("other {}", i));
+    }
+
+    hilet catalog = translation_catalog{compile_translation_catalog(translations)};
+    ASSERT_EQ(catalog.size(), 5000);
+    for (auto i = 0; i != 5000; ++i) {
+        hilet plural_forms = catalog.find(std::format("message {}", i));
+        ASSERT_EQ(plural_forms.size(), 2);
+        ASSERT_EQ(plural_forms[0], std::format("one {}", i));
+        ASSERT_EQ(plural_forms[1], std::format("other {}", i));
+    }
+    ASSERT_TRUE(catalog.find("message 5000").empty());
+}
+
+TEST(translation_catalog, empty)
+{
+    auto translations = po_translations{};
+    translations.language = language_tag{"fr"};
+
+    hilet catalog = translation_catalog{compile_translation_catalog(translations)};
+    ASSERT_EQ(catalog.size(), 0);
+    ASSERT_TRUE(catalog.find("Hello").empty());
+}
+
+TEST(translation_catalog, invalid)
+{
+    auto bytes = compile_translation_catalog(parse_po(test_po, "test.po"));
+
+    ASSERT_THROW(translation_catalog{std::vector<std::byte>(bytes.begin(), bytes.begin() + 16)}, parse_error);
+
+    auto bad_magic = bytes;
+    bad_magic[0] = std::byte{'X'};
+    ASSERT_THROW(translation_catalog{std::move(bad_magic)}, parse_error);
+
+    // Truncating the strings makes the offsets point outside of the catalog.
+    bytes.resize(bytes.size() - 1);
+    ASSERT_THROW(translation_catalog{std::move(bytes)}, parse_error);
+}
+
+TEST(translation_catalog, file)
+{
+    hilet path = std::filesystem::temp_directory_path() / "translation_catalog_test.hitc";
+    {
+        hilet bytes = compile_translation_catalog(parse_po(test_po, "test.po"));
+        auto f = file{path, access_mode::truncate_or_create_for_write};
+        f.write(std::span<std::byte const>{bytes});
+        f.close();
+    }
+
+    {
+        hilet catalog = translation_catalog{path};
+        ASSERT_EQ(catalog.language(), language_tag{"nl"});
+        ASSERT_EQ(catalog.find("Hello")[0], "Hallo");
+        ASSERT_EQ(catalog.find("one file")[1], "{} bestanden");
+    }
+    std::filesystem::remove(path);
+}
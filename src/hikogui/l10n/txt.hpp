@@ -8,13 +8,20 @@
 #include "../utility/utility.hpp"
 #include "../unicode/module.hpp"
 #include "../settings/settings.hpp"
+#include "../concurrency/concurrency.hpp"
+#include "../telemetry/module.hpp"
 #include "../macros.hpp"
 #include <memory>
+#include <mutex>
+#include <optional>
+#include <vector>
+#include <locale>
 #include <string>
 #include <string_view>
 #include <tuple>
 #include <algorithm>
 #include <utility>
+#include <cstddef>
 
 hi_export_module(hikogui.l10n.txt);
 
@@ -74,6 +81,15 @@ constexpr std::unique_ptr<txt_arguments_base> make_unique_txt_arguments(Args&&..
     return std::make_unique<txt_arguments_type>(std::forward<Args>(args)...);
 }
 
+/** The result of `txt::translate()` and the parameters it was translated with.
+ */
+struct txt_cache {
+    std::vector<language_tag> languages;
+    std::locale locale;
+    std::size_t generation;
+    gstring text;
+};
+
 } // namespace detail
 
 [[nodiscard]] constexpr long long get_first_integer_argument() noexcept
@@ -96,6 +112,11 @@ template<typename First, typename... Rest>
  * The translation and formatting of the message is delayed until displaying
  * it to the user. This allows the user to change the language while the
  * application is running.
+ *
+ * The result of `translate()` is cached together with the languages, locale and
+ * generation of the translation catalogs it was translated with; the message is
+ * only translated and formatted again when these change. The arguments of a message can not be changed, a new
+ * message is assigned instead, which replaces the cache.
  */
 hi_export class txt {
 public:
@@ -106,21 +127,24 @@ public:
     txt(txt const& other) noexcept :
         _first_integer_argument(other._first_integer_argument), _msg_id(other._msg_id), _args(other._args->make_unique_copy())
     {
+        hilet lock = std::scoped_lock(other._cache_mutex);
+        _cache = other._cache;
     }
 
     txt(txt&& other) noexcept
     {
+        hilet lock = std::scoped_lock(other._cache_mutex);
         std::swap(_first_integer_argument, other._first_integer_argument);
         std::swap(_msg_id, other._msg_id);
         std::swap(_args, other._args);
+        std::swap(_cache, other._cache);
     }
 
     txt& operator=(txt const& other) noexcept
     {
         if (std::addressof(other) != this) {
-            _first_integer_argument = other._first_integer_argument;
-            _msg_id = other._msg_id;
-            _args = other._args->make_unique_copy();
+            // Copy first, so that only a single cache-mutex is locked at a time.
+            *this = txt{other};
         }
         return *this;
     }
@@ -128,9 +152,11 @@ public:
     txt& operator=(txt&& other) noexcept
     {
         if (std::addressof(other) != this) {
+            hilet lock = std::scoped_lock(_cache_mutex, other._cache_mutex);
             std::swap(_first_integer_argument, other._first_integer_argument);
             std::swap(_msg_id, other._msg_id);
             std::swap(_args, other._args);
+            std::swap(_cache, other._cache);
         }
         return *this;
     }
@@ -177,6 +203,9 @@ public:
     /** Translate and format the message.
      * Find the translation of the message, then format it.
      *
+     * When the message was translated before with the same languages and
+     * locale, and no translations were added since, the cached result is returned.
+     *
      * @param loc The locale to use when formatting the message.
      * @param languages A list of languages to search for translations.
      * @return The translated and formatted message.
@@ -186,12 +215,25 @@ public:
         std::vector<language_tag> const& languages = os_settings::language_tags()) const noexcept
     {
         hi_axiom_not_null(_args);
+
+        // Make sure the translations are loaded before the generation is read.
+        load_translations();
+        hilet generation = translations_generation.load(std::memory_order::acquire);
+
+        hilet lock = std::scoped_lock(_cache_mutex);
+        if (_cache and _cache->generation == generation and _cache->languages == languages and _cache->locale == loc) {
+            ++global_counter<"txt:translate:hit">;
+            return _cache->text;
+        }
+
+        ++global_counter<"txt:translate:miss">;
         hilet[fmt, language_tag] = ::hi::get_translation(_msg_id, _first_integer_argument, languages);
         hilet msg = _args->format(loc, fmt);
 
         // hilet default_attributes = character_attributes{language_tag.expand()};
         // return to_text_with_markup(msg, default_attributes);
-        return to_gstring(msg);
+        _cache = detail::txt_cache{languages, loc, generation, to_gstring(msg)};
+        return _cache->text;
     }
 
     /** Translate and format the message.
@@ -224,6 +266,9 @@ private:
     long long _first_integer_argument = 0;
     std::string _msg_id = {};
     std::unique_ptr<detail::txt_arguments_base> _args;
+
+    mutable unfair_mutex _cache_mutex;
+    mutable std::optional<detail::txt_cache> _cache;
 };
 
 }} // namespace hi::v1
@@ -0,0 +1,102 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "txt.hpp"
+#include "../telemetry/module.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <locale>
+#include <vector>
+
+using namespace hi;
+
+TEST(txt, translate)
+{
+    hilet languages = std::vector<language_tag>{language_tag{"en-US"}};
+
+    hilet message = txt("{} apples", 5);
+    ASSERT_EQ(to_string(message.translate(std::locale::classic(), languages)), "5 apples");
+    ASSERT_EQ(to_string(message.original()), "5 apples");
+}
+
+TEST(txt, translate_cache)
+{
+    hilet languages = std::vector<language_tag>{language_tag{"en-US"}};
+    hilet other_languages = std::vector<language_tag>{language_tag{"nl-NL"}, language_tag{"en-US"}};
+    hilet hits = [] {
+        return static_cast<uint64_t>(global_counter<"txt:translate:hit">);
+    };
+    hilet misses = [] {
+        return static_cast<uint64_t>(global_counter<"txt:translate:miss">);
+    };
+
+    auto message = txt("{} pears", 3);
+    hilet hits_0 = hits();
+    hilet misses_0 = misses();
+
+    ASSERT_EQ(to_string(message.translate(std::locale::classic(), languages)), "3 pears");
+    ASSERT_EQ(hits(), hits_0);
+    ASSERT_EQ(misses(), misses_0 + 1);
+
+    ASSERT_EQ(to_string(message.translate(std::locale::classic(), languages)), "3 pears");
+    ASSERT_EQ(hits(), hits_0 + 1);
+    ASSERT_EQ(misses(), misses_0 + 1);
+
+    // A change of languages translates the message again.
+    ASSERT_EQ(to_string(message.translate(std::locale::classic(), other_languages)), "3 pears");
+    ASSERT_EQ(hits(), hits_0 + 1);
+    ASSERT_EQ(misses(), misses_0 + 2);
+
+    // A copy retains the cache.
+    hilet copy = message;
+    ASSERT_EQ(to_string(copy.translate(std::locale::classic(), other_languages)), "3 pears");
+    ASSERT_EQ(hits(), hits_0 + 2);
+    ASSERT_EQ(misses(), misses_0 + 2);
+
+    // A new message replaces the cache.
+    message = txt("{} pears", 4);
+    ASSERT_EQ(to_string(message.translate(std::locale::classic(), other_languages)), "4 pears");
+    ASSERT_EQ(hits(), hits_0 + 2);
+    ASSERT_EQ(misses(), misses_0 + 3);
+}
+
+TEST(txt, translate_added_translations)
+{
+    hilet languages = std::vector<language_tag>{language_tag{"fy"}};
+
+    hilet message = txt("{} plums", 7);
+    ASSERT_EQ(to_string(message.translate(std::locale::classic(), languages)), "7 plums");
+
+    // Translations that are added after the message was translated are used.
+    auto translations = po_translations{};
+    translations.language = language_tag{"fy"};
+    translations.nr_plural_forms = 2;
+    auto& translation = translations.translations.emplace_back();
+    translation.msgid = "{} plums";
+    translation.msgstr.push_back("{} pruim");
+    translation.msgstr.push_back("{} pruimen");
+    add_translations(translations);
+
+    ASSERT_EQ(to_string(message.translate(std::locale::classic(), languages)), "7 pruimen");
+
+    // Translations that are added later override earlier translations.
+    translations.translations.front().msgstr = {"{} pruimpje", "{} pruimpjes"};
+    add_translations(translations);
+
+    ASSERT_EQ(to_string(message.translate(std::locale::classic(), languages)), "7 pruimpjes");
+}
+
+TEST(txt, move_assign)
+{
+    hilet languages = std::vector<language_tag>{language_tag{"en-US"}};
+
+    auto message = txt("{} cherries", 1);
+    ASSERT_EQ(to_string(message.translate(std::locale::classic(), languages)), "1 cherries");
+
+    auto other = txt("{} grapes", 2);
+    ASSERT_EQ(to_string(other.translate(std::locale::classic(), languages)), "2 grapes");
+
+    message = std::move(other);
+    ASSERT_EQ(to_string(message.translate(std::locale::classic(), languages)), "2 grapes");
+}
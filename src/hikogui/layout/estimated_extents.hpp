@@ -0,0 +1,211 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <vector>
+#include <cstddef>
+#include <bit>
+
+namespace hi { inline namespace v1 {
+
+/** The sizes of a large number of rows or columns.
+ * @ingroup layout
+ *
+ * Each row starts with an estimated size, which is replaced by the measured size
+ * once the row has been measured. This allows a widget to show millions of rows
+ * while only measuring the rows that are visible.
+ *
+ * The differences between the measured and estimated sizes are stored in a
+ * Fenwick tree, so that the offset of a row and the row at an offset are
+ * calculated in O(log n).
+ */
+class estimated_extents {
+public:
+    using size_type = std::size_t;
+
+    constexpr estimated_extents() noexcept = default;
+    estimated_extents(estimated_extents const&) = default;
+    estimated_extents(estimated_extents&&) noexcept = default;
+    estimated_extents& operator=(estimated_extents const&) = default;
+    estimated_extents& operator=(estimated_extents&&) noexcept = default;
+
+    /** Create extents with all rows set to the estimated size.
+     *
+     * @param size The number of rows.
+     * @param estimate The estimated size of each row.
+     */
+    estimated_extents(size_type size, float estimate) noexcept
+    {
+        reset(size, estimate);
+    }
+
+    /** Forget all measurements.
+     *
+     * @param size The number of rows.
+     * @param estimate The estimated size of each row.
+     */
+    void reset(size_type size, float estimate) noexcept
+    {
+        hi_axiom(estimate >= 0.0f);
+        _estimate = estimate;
+        _tree.assign(size + 1, 0.0f);
+    }
+
+    /** Change the number of rows, keeping the measurements.
+     *
+     * The rows that remain keep their measured size, the new rows
+     * start with the estimated size.
+     *
+     * @param new_size The number of rows.
+     */
+    void resize(size_type new_size) noexcept
+    {
+        hilet old_size = size();
+        if (new_size <= old_size) {
+            // Each node of the tree only covers the rows before its own index.
+            _tree.resize(new_size + 1);
+            return;
+        }
+
+        _tree.resize(new_size + 1, 0.0f);
+        for (auto i = old_size + 1; i <= new_size; ++i) {
+            // The new nodes cover the measured rows before the old size.
+            hilet first = i - lowest_bit(i);
+            _tree[i] = first < old_size ? static_cast<float>(delta_sum(old_size) - delta_sum(first)) : 0.0f;
+        }
+    }
+
+    /** The number of rows.
+     */
+    [[nodiscard]] size_type size() const noexcept
+    {
+        return _tree.empty() ? 0 : _tree.size() - 1;
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return size() == 0;
+    }
+
+    /** The estimated size of a row that was not measured.
+     */
+    [[nodiscard]] float estimate() const noexcept
+    {
+        return _estimate;
+    }
+
+    /** The size of a row.
+     *
+     * @param index The index of the row.
+     * @return The measured size, or the estimated size if the row was not measured.
+     */
+    [[nodiscard]] float operator[](size_type index) const noexcept
+    {
+        hi_axiom(index < size());
+        return _estimate + static_cast<float>(delta_sum(index + 1) - delta_sum(index));
+    }
+
+    /** Set the measured size of a row.
+     *
+     * @param index The index of the row.
+     * @param new_size The measured size of the row.
+     * @return True if the size of the row has changed.
+     */
+    bool set(size_type index, float new_size) noexcept
+    {
+        hi_axiom(index < size());
+        hi_axiom(new_size >= 0.0f);
+
+        hilet delta = new_size - (*this)[index];
+        if (delta == 0.0f) {
+            return false;
+        }
+
+        for (auto i = index + 1; i < _tree.size(); i += lowest_bit(i)) {
+            _tree[i] += delta;
+        }
+        return true;
+    }
+
+    /** The offset of the start of a row.
+     *
+     * @param index The index of the row, or `size()` for the total size of all rows.
+     * @return The sum of the sizes of the rows before @a index.
+     */
+    [[nodiscard]] float offset(size_type index) const noexcept
+    {
+        hi_axiom(index <= size());
+        return static_cast<float>(static_cast<double>(index) * _estimate + delta_sum(index));
+    }
+
+    /** The total size of all rows.
+     */
+    [[nodiscard]] float total() const noexcept
+    {
+        return offset(size());
+    }
+
+    /** Find the row at an offset.
+     *
+     * @param offset The offset from the start of the first row.
+     * @return The index of the row that contains the offset, or
+     *         `size()` if the offset is beyond the last row.
+     */
+    [[nodiscard]] size_type find(float offset) const noexcept
+    {
+        if (offset < 0.0f) {
+            return 0;
+        }
+
+        // Descend the Fenwick tree, to find the number of rows that end at or before the offset.
+        auto index = 0_uz;
+        auto sum = 0.0;
+        for (auto step = std::bit_floor(size()); step != 0; step >>= 1) {
+            hilet next_index = index + step;
+            if (next_index <= size()) {
+                hilet next_sum = sum + _tree[next_index];
+                if (static_cast<double>(next_index) * _estimate + next_sum <= offset) {
+                    index = next_index;
+                    sum = next_sum;
+                }
+            }
+        }
+        return index;
+    }
+
+    /** The number of bytes of memory used by the extents.
+     */
+    [[nodiscard]] size_type capacity_in_bytes() const noexcept
+    {
+        return _tree.capacity() * sizeof(float);
+    }
+
+private:
+    float _estimate = 0.0f;
+
+    /** A 1-based Fenwick tree with the difference between measured and estimated sizes.
+     */
+    std::vector<float> _tree;
+
+    [[nodiscard]] constexpr static size_type lowest_bit(size_type i) noexcept
+    {
+        return i & (~i + 1);
+    }
+
+    /** The sum of the differences of the rows before @a index.
+     */
+    [[nodiscard]] double delta_sum(size_type index) const noexcept
+    {
+        auto r = 0.0;
+        for (auto i = index; i != 0; i -= lowest_bit(i)) {
+            r += _tree[i];
+        }
+        return r;
+    }
+};
+
+}} // namespace hi::v1
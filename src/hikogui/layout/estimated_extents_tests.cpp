@@ -0,0 +1,162 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "estimated_extents.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+#include <random>
+
+using namespace hi;
+
+TEST(estimated_extents, estimated)
+{
+    auto extents = estimated_extents{10, 20.0f};
+    ASSERT_EQ(extents.size(), 10U);
+    ASSERT_EQ(extents[3], 20.0f);
+    ASSERT_EQ(extents.offset(0), 0.0f);
+    ASSERT_EQ(extents.offset(3), 60.0f);
+    ASSERT_EQ(extents.total(), 200.0f);
+
+    ASSERT_EQ(extents.find(-1.0f), 0U);
+    ASSERT_EQ(extents.find(0.0f), 0U);
+    ASSERT_EQ(extents.find(19.9f), 0U);
+    ASSERT_EQ(extents.find(20.0f), 1U);
+    ASSERT_EQ(extents.find(199.0f), 9U);
+    ASSERT_EQ(extents.find(200.0f), 10U);
+}
+
+TEST(estimated_extents, measured)
+{
+    auto extents = estimated_extents{10, 20.0f};
+    ASSERT_TRUE(extents.set(2, 50.0f));
+    ASSERT_FALSE(extents.set(2, 50.0f));
+    ASSERT_TRUE(extents.set(5, 0.0f));
+
+    ASSERT_EQ(extents[2], 50.0f);
+    ASSERT_EQ(extents[5], 0.0f);
+    ASSERT_EQ(extents[6], 20.0f);
+    ASSERT_EQ(extents.offset(3), 90.0f);
+    ASSERT_EQ(extents.offset(6), 130.0f);
+    ASSERT_EQ(extents.total(), 210.0f);
+
+    ASSERT_EQ(extents.find(39.0f), 1U);
+    ASSERT_EQ(extents.find(40.0f), 2U);
+    ASSERT_EQ(extents.find(89.0f), 2U);
+    ASSERT_EQ(extents.find(90.0f), 3U);
+    // Row 5 is empty, the offset 130 is at the start of row 6.
+    ASSERT_EQ(extents.find(130.0f), 6U);
+
+    extents.reset(4, 10.0f);
+    ASSERT_EQ(extents[2], 10.0f);
+    ASSERT_EQ(extents.total(), 40.0f);
+}
+
+TEST(estimated_extents, random)
+{
+    auto engine = std::mt19937{42};
+    auto index_dist = std::uniform_int_distribution<std::size_t>{0, 999};
+    auto size_dist = std::uniform_int_distribution<int>{0, 100};
+
+    auto extents = estimated_extents{1000, 25.0f};
+    auto sizes = std::vector<float>(1000, 25.0f);
+
+    for (auto i = 0; i != 2000; ++i) {
+        hilet index = index_dist(engine);
+        hilet size = static_cast<float>(size_dist(engine));
+        extents.set(index, size);
+        sizes[index] = size;
+    }
+
+    auto offset = 0.0f;
+    for (auto i = 0_uz; i != sizes.size(); ++i) {
+        ASSERT_EQ(extents[i], sizes[i]);
+        ASSERT_EQ(extents.offset(i), offset);
+        if (sizes[i] != 0.0f) {
+            ASSERT_EQ(extents.find(offset), i);
+            ASSERT_EQ(extents.find(offset + sizes[i] - 0.5f), i);
+        }
+        offset += sizes[i];
+    }
+    ASSERT_EQ(extents.total(), offset);
+}
+
+TEST(estimated_extents, resize)
+{
+    auto engine = std::mt19937{42};
+    auto size_dist = std::uniform_int_distribution<int>{0, 100};
+
+    auto extents = estimated_extents{100, 25.0f};
+    auto sizes = std::vector<float>(100, 25.0f);
+    for (auto i = 0_uz; i < sizes.size(); i += 3) {
+        sizes[i] = static_cast<float>(size_dist(engine));
+        extents.set(i, sizes[i]);
+    }
+
+    hilet check = [&] {
+        ASSERT_EQ(extents.size(), sizes.size());
+        auto offset = 0.0f;
+        for (auto i = 0_uz; i != sizes.size(); ++i) {
+            ASSERT_EQ(extents[i], sizes[i]) << "index=" << i;
+            ASSERT_EQ(extents.offset(i), offset) << "index=" << i;
+            offset += sizes[i];
+        }
+        ASSERT_EQ(extents.total(), offset);
+    };
+
+    // The measurements of the remaining rows are kept.
+    extents.resize(37);
+    sizes.resize(37);
+    check();
+
+    extents.resize(259);
+    sizes.resize(259, 25.0f);
+    check();
+
+    extents.resize(0);
+    sizes.clear();
+    check();
+
+    extents.resize(5);
+    sizes.resize(5, 25.0f);
+    check();
+}
+
+TEST(estimated_extents, scroll_through_1M_rows)
+{
+    // Scroll through a list of one million rows, 10 rows of which are
+    // visible at a time. The visible rows are measured at 30 pixels, while
+    // they are estimated at 20 pixels.
+    constexpr auto num_rows = 1'000'000_uz;
+    constexpr auto aperture_height = 200.0f;
+
+    auto extents = estimated_extents{num_rows, 20.0f};
+    ASSERT_EQ(extents.total(), 20'000'000.0f);
+
+    // The memory used is a single float per row.
+    ASSERT_LE(extents.capacity_in_bytes(), (num_rows + 1) * sizeof(float) * 2);
+
+    auto scroll_offset = 0.0f;
+    auto num_visible_rows = 0_uz;
+    while (true) {
+        hilet first = extents.find(scroll_offset);
+        if (first == num_rows) {
+            break;
+        }
+
+        auto last = first;
+        while (last != num_rows and extents.offset(last) < scroll_offset + aperture_height) {
+            extents.set(last, 30.0f);
+            ++last;
+        }
+        num_visible_rows = std::max(num_visible_rows, last - first);
+
+        // Scroll down by a page.
+        scroll_offset = extents.offset(last);
+    }
+
+    ASSERT_LE(num_visible_rows, 10U);
+    ASSERT_EQ(extents.total(), 30'000'000.0f);
+    ASSERT_EQ(extents.find(15'000'000.0f), 500'000U);
+}
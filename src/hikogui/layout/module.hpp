@@ -3,6 +3,7 @@
 
 #include "box_constraints.hpp"
 #include "box_shape.hpp"
+#include "estimated_extents.hpp"
 #include "grid_layout.hpp"
 #include "row_column_layout.hpp"
 #include "spreadsheet_address.hpp"
@@ -18,6 +19,7 @@ Layout algorithms
  * `hi::grid_layout`: An algorithm that lays out boxes in rows and colunms.
  * `hi::row_layout`: An algorithm that lays out boxes in a single row.
  * `hi::column_layout`: An algorithm that lays out boxes in a single column.
+ * `hi::estimated_extents`: The sizes of a large number of rows, estimated until measured.
  * `hi::flex_layout`: An algorithm that lays out boxes next to each other, possibly flowing to a next line.
 
 */
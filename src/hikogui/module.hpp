@@ -14,6 +14,7 @@
 #include "container/module.hpp"
 #include "coroutine/module.hpp"
 #include "crt/crt.hpp"
+#include "DSP/module.hpp"
 #include "file/file.hpp"
 #include "font/module.hpp"
 #include "formula/formula.hpp"
@@ -2,6 +2,7 @@
 #pragma once
 
 #include "observable.hpp"
+#include "observable_path.hpp"
 #include "observable_value.hpp"
 #include "observer.hpp"
 #include "shared_state.hpp"
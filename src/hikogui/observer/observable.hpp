@@ -5,21 +5,43 @@
 #pragma once
 
 #include "group_ptr.hpp"
+#include "observable_path.hpp"
 #include "../coroutine/module.hpp"
+#include "../concurrency/concurrency.hpp"
 #include "../macros.hpp"
 #include <memory>
 #include <vector>
-#include <string>
+#include <span>
+#include <mutex>
+#include <algorithm>
 
 namespace hi::inline v1 {
 
 struct observable_msg {
     /** The type of the path used for notifying observers.
      */
-    using path_type = std::vector<std::string>;
+    using path_type = observable_path;
 
+    /** A pointer to the value of the observable.
+     */
     void const * const ptr;
-    path_type const& path;
+
+    /** The paths to the sub-objects that were modified.
+     */
+    std::span<path_type const> const paths;
+
+    observable_msg(void const *ptr, path_type const& path) noexcept : ptr(ptr), paths(&path, 1) {}
+
+    observable_msg(void const *ptr, std::span<path_type const> paths) noexcept : ptr(ptr), paths(paths) {}
+
+    /** Check if the message is relevant for an observer of the sub-object at @a path.
+     */
+    [[nodiscard]] bool overlaps(path_type const& path) const noexcept
+    {
+        return std::any_of(paths.begin(), paths.end(), [&](hilet& item) {
+            return hi::overlaps(item, path);
+        });
+    }
 };
 
 /** An abstract observable object.
@@ -79,6 +101,121 @@ public:
     /** Unlock for writing.
      */
     virtual void write_unlock() const noexcept = 0;
+
+    /** Notify the observers that a sub-object was modified.
+     *
+     * While a transaction is in progress the notification is deferred until
+     * the end of the transaction.
+     *
+     * @param ptr A pointer to the new value of the observable.
+     * @param path The path to the sub-object that was modified.
+     */
+    void notify(void const *ptr, observable_msg::path_type const& path) noexcept
+    {
+        {
+            hilet lock = std::scoped_lock(_transaction_mutex);
+            if (_transaction_depth != 0) {
+                add_modified_path(path);
+                return;
+            }
+        }
+
+        notify_group_ptr(observable_msg{ptr, path});
+    }
+
+    /** Start a transaction.
+     *
+     * Notifications are deferred until the outermost transaction ends.
+     */
+    void begin_transaction() noexcept
+    {
+        hilet lock = std::scoped_lock(_transaction_mutex);
+        ++_transaction_depth;
+    }
+
+    /** End a transaction.
+     *
+     * When the outermost transaction ends, the observers are notified once
+     * with the paths of all the sub-objects that were modified.
+     */
+    void end_transaction() noexcept
+    {
+        auto modified_paths = std::vector<observable_msg::path_type>{};
+        {
+            hilet lock = std::scoped_lock(_transaction_mutex);
+            hi_assert(_transaction_depth != 0);
+            if (--_transaction_depth != 0) {
+                return;
+            }
+            std::swap(modified_paths, _modified_paths);
+        }
+
+        if (not modified_paths.empty()) {
+            read_lock();
+            notify_group_ptr(observable_msg{read(), std::span<observable_msg::path_type const>{modified_paths}});
+            read_unlock();
+        }
+    }
+
+private:
+    mutable unfair_mutex _transaction_mutex;
+    std::size_t _transaction_depth = 0;
+
+    /** The paths modified during a transaction, none of which are a prefix of another.
+     */
+    std::vector<observable_msg::path_type> _modified_paths;
+
+    void add_modified_path(observable_msg::path_type const& path) noexcept
+    {
+        hi_axiom(_transaction_mutex.is_locked());
+
+        for (hilet& modified_path : _modified_paths) {
+            if (modified_path.is_prefix_of(path)) {
+                // The containing object was already modified.
+                return;
+            }
+        }
+
+        std::erase_if(_modified_paths, [&](hilet& modified_path) {
+            return path.is_prefix_of(modified_path);
+        });
+        _modified_paths.push_back(path);
+    }
+};
+
+/** A scope in which the notifications of an observable are batched.
+ *
+ * Multiple writes to an observable during the transaction result in a single
+ * notification to each observer when the transaction ends. Observers of the
+ * sub-objects that were not modified are not notified.
+ *
+ * The transaction does not lock the observable, writes by other threads
+ * during the transaction are batched as well.
+ */
+class observable_transaction {
+public:
+    ~observable_transaction()
+    {
+        _observed->end_transaction();
+    }
+
+    observable_transaction(observable_transaction const&) = delete;
+    observable_transaction(observable_transaction&&) = delete;
+    observable_transaction& operator=(observable_transaction const&) = delete;
+    observable_transaction& operator=(observable_transaction&&) = delete;
+
+    /** Start a transaction on an observable.
+     *
+     * @param observed The observable.
+     */
+    explicit observable_transaction(group_ptr<observable> observed) noexcept : _observed(std::move(observed))
+    {
+        hi_assert(static_cast<bool>(_observed));
+        _observed->begin_transaction();
+    }
+
+private:
+    group_ptr<observable> _observed;
 };
 
 } // namespace hi::inline v1
@@ -0,0 +1,160 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../concurrency/concurrency.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <vector>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+#include <algorithm>
+#include <mutex>
+#include <cstdint>
+
+namespace hi::inline v1 {
+
+/** The path to a sub-object of an observable.
+ *
+ * Each element of the path is the name of a member variable, an index or a key,
+ * encoded as an integer when the `observer` for the sub-object is created.
+ * This allows observers to compare paths without comparing strings
+ * when being notified.
+ *
+ * Only the names of member variables are interned, these are a fixed set
+ * of names from the program. Indices and keys, which may be chosen at run time,
+ * are encoded in the identifier so that the table of names does not grow.
+ * Keys and very large indices are hashed; two different keys with the same
+ * hash are treated as the same sub-object, which results in extra notifications.
+ */
+class observable_path {
+public:
+    using value_type = uint32_t;
+    using const_iterator = std::vector<value_type>::const_iterator;
+
+    constexpr observable_path() noexcept = default;
+    observable_path(observable_path const&) noexcept = default;
+    observable_path(observable_path&&) noexcept = default;
+    observable_path& operator=(observable_path const&) noexcept = default;
+    observable_path& operator=(observable_path&&) noexcept = default;
+
+    /** Get the identifier of the name of a member variable.
+     *
+     * @param name The name of a member variable.
+     * @return The same identifier for each call with the same name.
+     */
+    [[nodiscard]] static value_type intern(std::string_view name) noexcept
+    {
+        static auto mutex = unfair_mutex{};
+        static auto ids = std::unordered_map<std::string, value_type>{};
+
+        hilet lock = std::scoped_lock(mutex);
+        auto [it, inserted] = ids.try_emplace(std::string{name}, narrow_cast<value_type>(ids.size()));
+        hi_assert(it->second < index_flag);
+        return it->second;
+    }
+
+    /** Get the identifier of an index.
+     *
+     * Indices below 2^30 are encoded directly in the identifier, larger indices are hashed.
+     *
+     * @param index The index of an element.
+     * @return The same identifier for each call with the same index.
+     */
+    [[nodiscard]] static value_type intern_index(std::size_t index) noexcept
+    {
+        if (index <= payload_mask) {
+            return index_flag | narrow_cast<value_type>(index);
+        } else {
+            return hash_key(index);
+        }
+    }
+
+    /** Get the identifier of a key.
+     *
+     * @param hash The hash of the key.
+     * @return The same identifier for each call with the same hash.
+     */
+    [[nodiscard]] static value_type hash_key(std::size_t hash) noexcept
+    {
+        // Fold all the bits of the hash into the payload.
+        auto r = uint64_t{hash};
+        r ^= r >> 30;
+        r ^= r >> 60;
+        return key_flag | (static_cast<value_type>(r) & payload_mask);
+    }
+
+    [[nodiscard]] std::size_t size() const noexcept
+    {
+        return _ids.size();
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return _ids.empty();
+    }
+
+    [[nodiscard]] const_iterator begin() const noexcept
+    {
+        return _ids.begin();
+    }
+
+    [[nodiscard]] const_iterator end() const noexcept
+    {
+        return _ids.end();
+    }
+
+    /** Create the path to a sub-object.
+     *
+     * @param lhs The path of the object.
+     * @param rhs The identifier of the sub-object, from `intern()` or `intern_index()`.
+     * @return The path to the sub-object.
+     */
+    [[nodiscard]] friend observable_path operator/(observable_path lhs, value_type rhs) noexcept
+    {
+        lhs._ids.push_back(rhs);
+        return lhs;
+    }
+
+    [[nodiscard]] friend bool operator==(observable_path const&, observable_path const&) noexcept = default;
+
+    /** Check if this path is a prefix of another path.
+     *
+     * A path is also a prefix of itself.
+     */
+    [[nodiscard]] bool is_prefix_of(observable_path const& other) const noexcept
+    {
+        return size() <= other.size() and std::equal(_ids.begin(), _ids.end(), other._ids.begin());
+    }
+
+    /** Check if either path is a prefix of the other path.
+     *
+     * When a sub-object is modified, the objects that contain it and the
+     * objects that it contains are modified as well.
+     */
+    [[nodiscard]] friend bool overlaps(observable_path const& lhs, observable_path const& rhs) noexcept
+    {
+        hilet n = std::min(lhs.size(), rhs.size());
+        return std::equal(lhs._ids.begin(), lhs._ids.begin() + n, rhs._ids.begin());
+    }
+
+private:
+    /** Set in an identifier that encodes an index or a key.
+     */
+    constexpr static value_type index_flag = 0x8000'0000;
+
+    /** Set, together with `index_flag`, in an identifier that encodes a key.
+     */
+    constexpr static value_type key_flag = 0xc000'0000;
+
+    /** The bits of an identifier that hold the index or the hash of the key.
+     */
+    constexpr static value_type payload_mask = 0x3fff'ffff;
+
+    std::vector<value_type> _ids;
+};
+
+} // namespace hi::inline v1
@@ -0,0 +1,71 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "observable_path.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <functional>
+
+using namespace hi;
+
+TEST(observable_path, intern)
+{
+    hilet foo = observable_path::intern("foo");
+    hilet bar = observable_path::intern("bar");
+    ASSERT_NE(foo, bar);
+    ASSERT_EQ(observable_path::intern("foo"), foo);
+
+    hilet index0 = observable_path::intern_index(0);
+    hilet index1 = observable_path::intern_index(1);
+    ASSERT_NE(index0, index1);
+    ASSERT_NE(index0, foo);
+    ASSERT_NE(index0, bar);
+    ASSERT_EQ(observable_path::intern_index(0), index0);
+
+    hilet large_index = observable_path::intern_index(0x1'0000'0000);
+    ASSERT_EQ(observable_path::intern_index(0x1'0000'0000), large_index);
+    ASSERT_NE(observable_path::intern_index(0x1'0000'0001), large_index);
+    ASSERT_NE(large_index, foo);
+    ASSERT_NE(observable_path::intern_index(0x4000'0000), observable_path::intern_index(0));
+    ASSERT_NE(observable_path::intern_index(0x8000'0000), observable_path::intern_index(0));
+}
+
+TEST(observable_path, hash_key)
+{
+    hilet foo = observable_path::intern("foo");
+    hilet key_foo = observable_path::hash_key(std::hash<std::string>{}("foo"));
+    hilet key_bar = observable_path::hash_key(std::hash<std::string>{}("bar"));
+    ASSERT_EQ(observable_path::hash_key(std::hash<std::string>{}("foo")), key_foo);
+    ASSERT_NE(key_foo, key_bar);
+
+    // Keys are distinct from names and small indices.
+    ASSERT_NE(key_foo, foo);
+    for (auto i = 0_uz; i != 100; ++i) {
+        hilet key = observable_path::hash_key(i);
+        ASSERT_NE(key, observable_path::intern_index(i));
+        ASSERT_NE(key, foo);
+    }
+}
+
+TEST(observable_path, overlaps)
+{
+    hilet root = observable_path{};
+    hilet foo = root / observable_path::intern("foo");
+    hilet foo_bar = foo / observable_path::intern("bar");
+    hilet foo_baz = foo / observable_path::intern("baz");
+    hilet foo_0 = foo / observable_path::intern_index(0);
+
+    ASSERT_TRUE(root.is_prefix_of(foo_bar));
+    ASSERT_TRUE(foo.is_prefix_of(foo_bar));
+    ASSERT_TRUE(foo_bar.is_prefix_of(foo_bar));
+    ASSERT_FALSE(foo_bar.is_prefix_of(foo));
+    ASSERT_FALSE(foo_bar.is_prefix_of(foo_baz));
+
+    ASSERT_TRUE(overlaps(root, foo_bar));
+    ASSERT_TRUE(overlaps(foo_bar, foo));
+    ASSERT_TRUE(overlaps(foo, foo_0));
+    ASSERT_FALSE(overlaps(foo_bar, foo_baz));
+    ASSERT_FALSE(overlaps(foo_bar, foo_0));
+}
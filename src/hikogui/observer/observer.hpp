@@ -427,7 +427,7 @@ public:
         // Rewire the callback subscriptions and notify listeners to this observer.
         update_state_callback();
         _observed->read_lock();
-        _observed->notify_group_ptr(observable_msg{_observed->read(), _path});
+        _observed->notify(_observed->read(), _path);
         _observed->read_unlock();
         return *this;
     }
@@ -449,7 +449,7 @@ public:
         // Rewire the callback subscriptions and notify listeners to this observer.
         update_state_callback();
         _observed->read_lock();
-        _observed->notify_group_ptr({_observed->read(), _path});
+        _observed->notify(_observed->read(), _path);
         _observed->read_unlock();
         return *this;
     }
@@ -509,6 +509,18 @@ public:
         return _notifier.operator co_await();
     }
 
+    /** Start a transaction on the observed value.
+     *
+     * Writes through any observer of the same observable are notified together
+     * when the transaction ends, each observer is notified at most once.
+     *
+     * @return A RAII object which ends the transaction when it is destroyed.
+     */
+    [[nodiscard]] observable_transaction transaction() const noexcept
+    {
+        return observable_transaction{_observed};
+    }
+
     /** Create a sub-observer by indexing into the value.
      *
      * @param index The index into the value being observed.
@@ -519,10 +531,19 @@ public:
     {
         using result_type = std::decay_t<decltype(std::declval<value_type>()[index])>;
 
-        auto new_path = _path;
-        new_path.push_back(std::format("[{}]", index));
+        using index_type = std::decay_t<decltype(index)>;
+        hilet id = [&] {
+            if constexpr (std::is_integral_v<index_type>) {
+                return observable_path::intern_index(narrow_cast<std::size_t>(index));
+            } else if constexpr (requires { std::hash<index_type>{}(index); }) {
+                return observable_path::hash_key(std::hash<index_type>{}(index));
+            } else {
+                return observable_path::hash_key(std::hash<std::string>{}(std::format("{}", index)));
+            }
+        }();
+
         return observer<result_type>{
-            _observed, std::move(new_path), [convert_copy = this->_convert, index](void *base) -> void * {
+            _observed, _path / id, [convert_copy = this->_convert, index](void *base) -> void * {
                 return std::addressof((*std::launder(static_cast<value_type *>(convert_copy(base))))[index]);
             }};
     }
@@ -538,12 +559,13 @@ public:
     {
         using result_type = std::decay_t<decltype(selector<value_type>{}.get<Name>(std::declval<value_type&>()))>;
 
-        auto new_path = _path;
-        new_path.push_back(std::string{Name});
+        // The name is interned once for each member variable.
+        static hilet id = observable_path::intern(std::string{Name});
+
         // clang-format off
         return observer<result_type>(
             _observed,
-            std::move(new_path),
+            _path / id,
             [convert_copy = this->_convert](void *base) -> void * {
                 return std::addressof(selector<value_type>{}.get<Name>(
                     *std::launder(static_cast<value_type *>(convert_copy(base)))));
@@ -723,13 +745,13 @@ private:
             // Since there is a write-lock being held, _observed->read() will be the previous value.
             if (*convert(_observed->read()) != *convert(base)) {
                 _observed->commit(base);
-                _observed->notify_group_ptr({base, _path});
+                _observed->notify(base, _path);
             } else {
                 _observed->abort(base);
             }
         } else {
             _observed->commit(base);
-            _observed->notify_group_ptr({base, _path});
+            _observed->notify(base, _path);
         }
         _observed->write_unlock();
     }
@@ -753,10 +775,9 @@ private:
     void update_state_callback() noexcept
     {
         _observed.subscribe([this](observable_msg const& msg) {
-            hilet [msg_it, this_it] = std::mismatch(msg.path.cbegin(), msg.path.cend(), _path.cbegin(), _path.cend());
             // If the message's path is fully within the this' path, then this is a sub-path.
             // If this' path is fully within the message's path, then this is along the path.
-            if (msg_it == msg.path.cend() or this_it == _path.cend()) {
+            if (msg.overlaps(_path)) {
 #ifndef NDEBUG
                 _notifier(_debug_value = *convert(msg.ptr));
 #else
@@ -84,6 +84,17 @@ public:
         return observer().get<Name>();
     }
 
+    /** Start a transaction on the shared state.
+     *
+     * Writes to the shared state are notified together when the transaction ends.
+     *
+     * @return A RAII object which ends the transaction when it is destroyed.
+     */
+    [[nodiscard]] observable_transaction transaction() const& noexcept
+    {
+        return observer().transaction();
+    }
+
 private:
     std::shared_ptr<observable_value<value_type>> _pimpl;
 };
@@ -605,3 +605,129 @@ TEST(shared_state, convenience_operators)
     a += 2;
     ASSERT_EQ(a, 3);
 }
+
+TEST(shared_state, transaction)
+{
+    using namespace test_shared_space;
+
+    auto state = hi::shared_state<A>{B{"hello world", 42}, std::vector<int>{5, 15}};
+
+    auto a_cursor = state.observer();
+    auto b_cursor = a_cursor.get<"b">();
+    auto foo_cursor = b_cursor.get<"foo">();
+    auto bar_cursor = b_cursor.get<"bar">();
+    auto baz_cursor = a_cursor.get<"baz">();
+
+    auto a_count = 0;
+    auto b_count = 0;
+    auto foo_count = 0;
+    auto bar_count = 0;
+    auto baz_count = 0;
+    auto bar_value = 0;
+
+    // clang-format off
+    auto a_cbt = a_cursor.subscribe([&](auto...) { ++a_count; });
+    auto b_cbt = b_cursor.subscribe([&](auto...) { ++b_count; });
+    auto foo_cbt = foo_cursor.subscribe([&](auto...) { ++foo_count; });
+    auto bar_cbt = bar_cursor.subscribe([&](int value) { ++bar_count; bar_value = value; });
+    auto baz_cbt = baz_cursor.subscribe([&](auto...) { ++baz_count; });
+    // clang-format on
+
+    {
+        auto t = state.transaction();
+        bar_cursor = 1;
+        bar_cursor = 2;
+        foo_cursor = "foo";
+
+        // Notifications are deferred until the end of the transaction.
+        ASSERT_EQ(a_count, 0);
+        ASSERT_EQ(bar_count, 0);
+        ASSERT_EQ(*bar_cursor, 2);
+
+        {
+            // Nested transactions are part of the outermost transaction.
+            auto t2 = bar_cursor.transaction();
+            bar_cursor = 3;
+        }
+        ASSERT_EQ(bar_count, 0);
+    }
+
+    // Each observer along the modified paths is notified once with the latest value.
+    ASSERT_EQ(a_count, 1);
+    ASSERT_EQ(b_count, 1);
+    ASSERT_EQ(foo_count, 1);
+    ASSERT_EQ(bar_count, 1);
+    ASSERT_EQ(bar_value, 3);
+    ASSERT_EQ(baz_count, 0);
+
+    {
+        // When the containing object is modified, all its members are notified.
+        auto t = state.transaction();
+        bar_cursor = 4;
+        b_cursor.copy()->foo = "bar";
+    }
+    ASSERT_EQ(a_count, 2);
+    ASSERT_EQ(b_count, 2);
+    ASSERT_EQ(foo_count, 2);
+    ASSERT_EQ(bar_count, 2);
+    ASSERT_EQ(baz_count, 0);
+
+    {
+        // Assigning an observer notifies the observers of its new path, deferred as well.
+        auto t = state.transaction();
+        auto other_cursor = b_cursor.get<"bar">();
+        other_cursor = bar_cursor;
+        ASSERT_EQ(bar_count, 2);
+    }
+    ASSERT_EQ(a_count, 3);
+    ASSERT_EQ(bar_count, 3);
+    ASSERT_EQ(baz_count, 0);
+
+    {
+        // A transaction without writes does not notify.
+        auto t = state.transaction();
+    }
+    ASSERT_EQ(a_count, 3);
+}
+
+TEST(shared_state, transaction_1000_fields)
+{
+    // A shared state with 1000 fields, each with its own observer. The state is
+    // updated many times, each update writes 10 fields in a single transaction.
+    constexpr auto num_fields = 1000;
+    constexpr auto num_updates = 100;
+
+    auto state = hi::shared_state<std::vector<int>>{std::vector<int>(num_fields, 0)};
+
+    auto root_count = 0;
+    auto root_cursor = state.observer();
+    auto root_cbt = root_cursor.subscribe([&](auto...) {
+        ++root_count;
+    });
+
+    auto counts = std::vector<int>(num_fields, 0);
+    auto cursors = std::vector<hi::observer<int>>{};
+    auto cbts = std::vector<hi::observer<int>::callback_token>{};
+
+    // The observers subscribe with their own address, they must not be moved after creation.
+    cursors.reserve(num_fields);
+    for (auto i = 0_uz; i != counts.size(); ++i) {
+        cursors.push_back(state.get(i));
+        cbts.push_back(cursors.back().subscribe([&counts, i](auto...) {
+            ++counts[i];
+        }));
+    }
+
+    for (auto update = 0; update != num_updates; ++update) {
+        auto t = state.transaction();
+        for (auto i = 0; i != 10; ++i) {
+            cursors[(update * 10 + i) % num_fields] = update + 1;
+        }
+    }
+
+    // Each update is a single notification to the root, and each field is written once.
+    ASSERT_EQ(root_count, num_updates);
+    for (auto i = 0_uz; i != counts.size(); ++i) {
+        ASSERT_EQ(counts[i], 1);
+    }
+}
@@ -7,6 +7,8 @@
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
 #include <array>
+#include <string>
+#include <cstring>
 
 #if HI_COMPILER == HI_CC_MSVC
 #include <intrin.h>
@@ -21,6 +23,12 @@ hi_export_module(hikogui.settings.cpu_id);
 namespace hi {
 inline namespace v1 {
 
+/** Information about the CPU this process is running on.
+ *
+ * The instruction-set flags only report an extension when the operating system
+ * also saves the extended register state on a context switch; for example
+ * `has_avx()` is false on a CPU with AVX when the OS does not enable the YMM state.
+ */
 class cpu_id {
 public:
     constexpr static uint32_t processor_type_OEM = 0;
@@ -35,9 +43,6 @@ public:
     uint32_t family_id:9 = 0;
     uint32_t processor_type:2 = 0;
 
-    uint64_t features = 0;
-
-
     size_t cache_flush_size = 0;
 
     /** Local processor id.
@@ -56,11 +61,10 @@ public:
 
         // vendor_id are 12 characters from ebx, edx, ecx in that order.
         vendor_id.resize(12);
-        std::memcpy(vendor_id.data() + 0, leaf0.b, 4);
-        std::memcpy(vendor_id.data() + 4, leaf0.d, 4);
-        std::memcpy(vendor_id.data() + 8, leaf0.c, 4);
+        std::memcpy(vendor_id.data() + 0, &leaf0.b, 4);
+        std::memcpy(vendor_id.data() + 4, &leaf0.d, 4);
+        std::memcpy(vendor_id.data() + 8, &leaf0.c, 4);
 
-        size_t brand_index = 0;
         if (max_leaf >= 1) {
             hilet leaf1 = get_leaf(1);
 
@@ -78,15 +82,143 @@ public:
                 family_id += (leaf1.a >> 20) & 0xff;
             }
 
-            brand_index = leaf1.b & 0xff;
             cache_flush_size = ((leaf1.b >> 8) & 0xff) * 8;
             APIC_id = (leaf1.b >> 24) & 0xff;
 
-            
-            
+            instruction_set |= ((leaf1.c >> 25) & 1) ? instruction_set_aesni : 0;
+            instruction_set |= ((leaf1.c >> 28) & 1) ? instruction_set_avx : 0;
+            instruction_set |= ((leaf1.c >> 13) & 1) ? instruction_set_cmpxchg16b : 0;
+            instruction_set |= ((leaf1.d >> 19) & 1) ? instruction_set_clfsh : 0;
+            instruction_set |= ((leaf1.d >> 15) & 1) ? instruction_set_cmov : 0;
+            instruction_set |= ((leaf1.d >> 8) & 1) ? instruction_set_cx8 : 0;
+            instruction_set |= ((leaf1.c >> 12) & 1) ? instruction_set_fma : 0;
+            instruction_set |= ((leaf1.c >> 29) & 1) ? instruction_set_f16c : 0;
+            instruction_set |= ((leaf1.d >> 24) & 1) ? instruction_set_fxsr : 0;
+            instruction_set |= ((leaf1.d >> 25) & 1) ? instruction_set_sse : 0;
+            instruction_set |= ((leaf1.d >> 26) & 1) ? instruction_set_sse2 : 0;
+            instruction_set |= ((leaf1.c >> 0) & 1) ? instruction_set_sse3 : 0;
+            instruction_set |= ((leaf1.c >> 9) & 1) ? instruction_set_ssse3 : 0;
+            instruction_set |= ((leaf1.c >> 19) & 1) ? instruction_set_sse4_1 : 0;
+            instruction_set |= ((leaf1.c >> 20) & 1) ? instruction_set_sse4_2 : 0;
+            instruction_set |= ((leaf1.c >> 22) & 1) ? instruction_set_movbe : 0;
+            instruction_set |= ((leaf1.d >> 23) & 1) ? instruction_set_mmx : 0;
+            instruction_set |= ((leaf1.d >> 5) & 1) ? instruction_set_msr : 0;
+            instruction_set |= ((leaf1.c >> 27) & 1) ? instruction_set_osxsave : 0;
+            instruction_set |= ((leaf1.c >> 1) & 1) ? instruction_set_pclmulqdq : 0;
+            instruction_set |= ((leaf1.c >> 23) & 1) ? instruction_set_popcnt : 0;
+            instruction_set |= ((leaf1.c >> 30) & 1) ? instruction_set_rdrand : 0;
+            instruction_set |= ((leaf1.d >> 11) & 1) ? instruction_set_sep : 0;
+            instruction_set |= ((leaf1.d >> 4) & 1) ? instruction_set_tsc : 0;
+            instruction_set |= ((leaf1.c >> 26) & 1) ? instruction_set_xsave : 0;
+
+            features |= ((leaf1.d >> 22) & 1) ? features_acpi : 0;
+            features |= ((leaf1.d >> 9) & 1) ? features_apic : 0;
+            features |= ((leaf1.c >> 10) & 1) ? features_cnxt_id : 0;
+            features |= ((leaf1.c >> 18) & 1) ? features_dca : 0;
+            features |= ((leaf1.d >> 2) & 1) ? features_de : 0;
+            features |= ((leaf1.d >> 21) & 1) ? features_ds : 0;
+            features |= ((leaf1.c >> 4) & 1) ? features_ds_cpl : 0;
+            features |= ((leaf1.c >> 2) & 1) ? features_dtes64 : 0;
+            features |= ((leaf1.c >> 7) & 1) ? features_eist : 0;
+            features |= ((leaf1.d >> 0) & 1) ? features_fpu : 0;
+            features |= ((leaf1.d >> 28) & 1) ? features_htt : 0;
+            features |= ((leaf1.d >> 14) & 1) ? features_mca : 0;
+            features |= ((leaf1.d >> 7) & 1) ? features_mce : 0;
+            features |= ((leaf1.c >> 3) & 1) ? features_monitor : 0;
+            features |= ((leaf1.d >> 12) & 1) ? features_mttr : 0;
+            features |= ((leaf1.d >> 6) & 1) ? features_pae : 0;
+            features |= ((leaf1.d >> 16) & 1) ? features_pat : 0;
+            features |= ((leaf1.d >> 31) & 1) ? features_pbe : 0;
+            features |= ((leaf1.c >> 17) & 1) ? features_pcid : 0;
+            features |= ((leaf1.c >> 15) & 1) ? features_pdcm : 0;
+            features |= ((leaf1.d >> 13) & 1) ? features_pge : 0;
+            features |= ((leaf1.d >> 3) & 1) ? features_pse : 0;
+            features |= ((leaf1.d >> 17) & 1) ? features_pse_36 : 0;
+            features |= ((leaf1.d >> 18) & 1) ? features_psn : 0;
+            features |= ((leaf1.c >> 11) & 1) ? features_sdbg : 0;
+            features |= ((leaf1.c >> 6) & 1) ? features_smx : 0;
+            features |= ((leaf1.d >> 27) & 1) ? features_ss : 0;
+            features |= ((leaf1.d >> 29) & 1) ? features_tm : 0;
+            features |= ((leaf1.c >> 8) & 1) ? features_tm2 : 0;
+            features |= ((leaf1.c >> 24) & 1) ? features_tsc_deadline : 0;
+            features |= ((leaf1.d >> 1) & 1) ? features_vme : 0;
+            features |= ((leaf1.c >> 5) & 1) ? features_vmx : 0;
+            features |= ((leaf1.c >> 21) & 1) ? features_x2apic : 0;
+            features |= ((leaf1.c >> 14) & 1) ? features_xtpr : 0;
+        }
+
+        if (max_leaf >= 7) {
+            hilet leaf7 = get_leaf(7);
+
+            instruction_set |= ((leaf7.b >> 5) & 1) ? instruction_set_avx2 : 0;
+            instruction_set |= ((leaf7.b >> 30) & 1) ? instruction_set_avx512bw : 0;
+            instruction_set |= ((leaf7.b >> 28) & 1) ? instruction_set_avx512cd : 0;
+            instruction_set |= ((leaf7.b >> 17) & 1) ? instruction_set_avx512dq : 0;
+            instruction_set |= ((leaf7.b >> 16) & 1) ? instruction_set_avx512f : 0;
+            instruction_set |= ((leaf7.b >> 31) & 1) ? instruction_set_avx512vl : 0;
+            instruction_set |= ((leaf7.b >> 3) & 1) ? instruction_set_bmi1 : 0;
+            instruction_set |= ((leaf7.b >> 8) & 1) ? instruction_set_bmi2 : 0;
+        }
+
+        hilet max_extended_leaf = get_leaf(0x8000'0000).a;
+        if (max_extended_leaf >= 0x8000'0001) {
+            hilet leaf_ext1 = get_leaf(0x8000'0001);
+
+            instruction_set |= ((leaf_ext1.c >> 0) & 1) ? instruction_set_lahf_sahf : 0;
+            instruction_set |= ((leaf_ext1.c >> 5) & 1) ? instruction_set_lzcnt : 0;
+        }
+
+        if (max_extended_leaf >= 0x8000'0004) {
+            // The brand name is 48 characters from eax, ebx, ecx, edx of three leafs, nul terminated.
+            auto brand = std::array<char, 48>{};
+            for (auto i = 0_uz; i != 3; ++i) {
+                hilet leaf = get_leaf(narrow_cast<uint32_t>(0x8000'0002 + i));
+                std::memcpy(brand.data() + i * 16, &leaf, 16);
+            }
+            brand_name = std::string{brand.data(), strnlen(brand.data(), brand.size())};
+        }
+
+        // The extended registers may only be used when the operating system
+        // saves them during a context switch.
+        hilet xcr0 = has_osxsave() ? get_xcr0() : uint64_t{0};
+        if ((xcr0 & xcr0_ymm_state) != xcr0_ymm_state) {
+            instruction_set &= ~(instruction_set_avx | instruction_set_avx2 | instruction_set_fma | instruction_set_f16c);
+        }
+        if ((xcr0 & xcr0_zmm_state) != xcr0_zmm_state) {
+            instruction_set &= ~(instruction_set_avx512f | instruction_set_avx512bw | instruction_set_avx512cd |
+                                 instruction_set_avx512dq | instruction_set_avx512vl);
         }
     }
 
+    /** The x86-64 micro-architecture level supported by this CPU.
+     *
+     * The levels are the same as used by the `HI_X86_64_LEVEL` macro and the
+     * `-march=x86-64-v*` compiler options.
+     *
+     * @return 1 to 4, or 0 if the CPU does not even support the baseline x86-64 instructions.
+     */
+    [[nodiscard]] int x86_64_level() const noexcept
+    {
+        if (not(has_cmov() and has_cx8() and has_fpu() and has_fxsr() and has_mmx() and has_sse() and has_sse2())) {
+            return 0;
+        }
+
+        if (not(has_cmpxchg16b() and has_lahf_sahf() and has_popcnt() and has_sse3() and has_sse4_1() and has_sse4_2() and
+                has_ssse3())) {
+            return 1;
+        }
+
+        if (not(has_avx() and has_avx2() and has_bmi1() and has_bmi2() and has_f16c() and has_fma() and has_lzcnt() and
+                has_movbe() and has_osxsave())) {
+            return 2;
+        }
+
+        if (not(has_avx512f() and has_avx512bw() and has_avx512cd() and has_avx512dq() and has_avx512vl())) {
+            return 3;
+        }
+
+        return 4;
+    }
 
     [[nodiscard]] bool has_aesni() const noexcept
     {
@@ -98,6 +230,46 @@ public:
         return to_bool(instruction_set & instruction_set_avx);
     }
 
+    [[nodiscard]] bool has_avx2() const noexcept
+    {
+        return to_bool(instruction_set & instruction_set_avx2);
+    }
+
+    [[nodiscard]] bool has_avx512bw() const noexcept
+    {
+        return to_bool(instruction_set & instruction_set_avx512bw);
+    }
+
+    [[nodiscard]] bool has_avx512cd() const noexcept
+    {
+        return to_bool(instruction_set & instruction_set_avx512cd);
+    }
+
+    [[nodiscard]] bool has_avx512dq() const noexcept
+    {
+        return to_bool(instruction_set & instruction_set_avx512dq);
+    }
+
+    [[nodiscard]] bool has_avx512f() const noexcept
+    {
+        return to_bool(instruction_set & instruction_set_avx512f);
+    }
+
+    [[nodiscard]] bool has_avx512vl() const noexcept
+    {
+        return to_bool(instruction_set & instruction_set_avx512vl);
+    }
+
+    [[nodiscard]] bool has_bmi1() const noexcept
+    {
+        return to_bool(instruction_set & instruction_set_bmi1);
+    }
+
+    [[nodiscard]] bool has_bmi2() const noexcept
+    {
+        return to_bool(instruction_set & instruction_set_bmi2);
+    }
+
     [[nodiscard]] bool has_cmpxchg16b() const noexcept
     {
         return to_bool(instruction_set & instruction_set_cmpxchg16b);
@@ -133,6 +305,16 @@ public:
         return to_bool(instruction_set & instruction_set_fxsr);
     }
 
+    [[nodiscard]] bool has_lahf_sahf() const noexcept
+    {
+        return to_bool(instruction_set & instruction_set_lahf_sahf);
+    }
+
+    [[nodiscard]] bool has_lzcnt() const noexcept
+    {
+        return to_bool(instruction_set & instruction_set_lzcnt);
+    }
+
     [[nodiscard]] bool has_sse() const noexcept
     {
         return to_bool(instruction_set & instruction_set_sse);
@@ -330,7 +512,7 @@ public:
 
     [[nodiscard]] bool has_psn() const noexcept
     {
-        return to_bool(features & features_psm);
+        return to_bool(features & features_psn);
     }
 
     [[nodiscard]] bool has_sdbg() const noexcept
@@ -387,29 +569,39 @@ private:
     // clang-format off
     constexpr static uint64_t instruction_set_aesni        = 0x0000'0000'0000'0001;
     constexpr static uint64_t instruction_set_avx          = 0x0000'0000'0000'0002;
-    constexpr static uint64_t instruction_set_cmpxchg16b   = 0x0000'0000'0000'0004;
-    constexpr static uint64_t instruction_set_clfsh        = 0x0000'0000'0000'0008;
-    constexpr static uint64_t instruction_set_cmov         = 0x0000'0000'0000'0010;
-    constexpr static uint64_t instruction_set_cx8          = 0x0000'0000'0000'0020;
-    constexpr static uint64_t instruction_set_fma          = 0x0000'0000'0000'0040;
-    constexpr static uint64_t instruction_set_f16c         = 0x0000'0000'0000'0080;
-    constexpr static uint64_t instruction_set_fxsr         = 0x0000'0000'0000'0100;
-    constexpr static uint64_t instruction_set_sse          = 0x0000'0000'0000'0200;
-    constexpr static uint64_t instruction_set_sse2         = 0x0000'0000'0000'0300;
-    constexpr static uint64_t instruction_set_sse3         = 0x0000'0000'0000'0800;
-    constexpr static uint64_t instruction_set_ssse3        = 0x0000'0000'0000'1000;
-    constexpr static uint64_t instruction_set_sse4_1       = 0x0000'0000'0000'2000;
-    constexpr static uint64_t instruction_set_sse4_2       = 0x0000'0000'0000'4000;
-    constexpr static uint64_t instruction_set_movbe        = 0x0000'0000'0000'8000;
-    constexpr static uint64_t instruction_set_mmx          = 0x0000'0000'0001'0000;
-    constexpr static uint64_t instruction_set_msr          = 0x0000'0000'0002'0000;
-    constexpr static uint64_t instruction_set_osxsave      = 0x0000'0000'0004'0000;
-    constexpr static uint64_t instruction_set_pclmulqdq    = 0x0000'0000'0008'0000;
-    constexpr static uint64_t instruction_set_popcnt       = 0x0000'0000'0010'0000;
-    constexpr static uint64_t instruction_set_rdrand       = 0x0000'0000'0020'0000;
-    constexpr static uint64_t instruction_set_sep          = 0x0000'0000'0040'0000;
-    constexpr static uint64_t instruction_set_tsc          = 0x0000'0000'0080'0000;
-    constexpr static uint64_t instruction_set_xsave        = 0x0000'0000'0100'0000;
+    constexpr static uint64_t instruction_set_avx2         = 0x0000'0000'0000'0004;
+    constexpr static uint64_t instruction_set_avx512bw     = 0x0000'0000'0000'0008;
+    constexpr static uint64_t instruction_set_avx512cd     = 0x0000'0000'0000'0010;
+    constexpr static uint64_t instruction_set_avx512dq     = 0x0000'0000'0000'0020;
+    constexpr static uint64_t instruction_set_avx512f      = 0x0000'0000'0000'0040;
+    constexpr static uint64_t instruction_set_avx512vl     = 0x0000'0000'0000'0080;
+    constexpr static uint64_t instruction_set_bmi1         = 0x0000'0000'0000'0100;
+    constexpr static uint64_t instruction_set_bmi2         = 0x0000'0000'0000'0200;
+    constexpr static uint64_t instruction_set_cmpxchg16b   = 0x0000'0000'0000'0400;
+    constexpr static uint64_t instruction_set_clfsh        = 0x0000'0000'0000'0800;
+    constexpr static uint64_t instruction_set_cmov         = 0x0000'0000'0000'1000;
+    constexpr static uint64_t instruction_set_cx8          = 0x0000'0000'0000'2000;
+    constexpr static uint64_t instruction_set_fma          = 0x0000'0000'0000'4000;
+    constexpr static uint64_t instruction_set_f16c         = 0x0000'0000'0000'8000;
+    constexpr static uint64_t instruction_set_fxsr         = 0x0000'0000'0001'0000;
+    constexpr static uint64_t instruction_set_lahf_sahf    = 0x0000'0000'0002'0000;
+    constexpr static uint64_t instruction_set_lzcnt        = 0x0000'0000'0004'0000;
+    constexpr static uint64_t instruction_set_sse          = 0x0000'0000'0008'0000;
+    constexpr static uint64_t instruction_set_sse2         = 0x0000'0000'0010'0000;
+    constexpr static uint64_t instruction_set_sse3         = 0x0000'0000'0020'0000;
+    constexpr static uint64_t instruction_set_ssse3        = 0x0000'0000'0040'0000;
+    constexpr static uint64_t instruction_set_sse4_1       = 0x0000'0000'0080'0000;
+    constexpr static uint64_t instruction_set_sse4_2       = 0x0000'0000'0100'0000;
+    constexpr static uint64_t instruction_set_movbe        = 0x0000'0000'0200'0000;
+    constexpr static uint64_t instruction_set_mmx          = 0x0000'0000'0400'0000;
+    constexpr static uint64_t instruction_set_msr          = 0x0000'0000'0800'0000;
+    constexpr static uint64_t instruction_set_osxsave      = 0x0000'0000'1000'0000;
+    constexpr static uint64_t instruction_set_pclmulqdq    = 0x0000'0000'2000'0000;
+    constexpr static uint64_t instruction_set_popcnt       = 0x0000'0000'4000'0000;
+    constexpr static uint64_t instruction_set_rdrand       = 0x0000'0000'8000'0000;
+    constexpr static uint64_t instruction_set_sep          = 0x0000'0001'0000'0000;
+    constexpr static uint64_t instruction_set_tsc          = 0x0000'0002'0000'0000;
+    constexpr static uint64_t instruction_set_xsave        = 0x0000'0004'0000'0000;
 
     constexpr static uint64_t features_acpi                = 0x0000'0000'0000'0001;
     constexpr static uint64_t features_apic                = 0x0000'0000'0000'0002;
@@ -445,9 +637,12 @@ private:
     constexpr static uint64_t features_vmx                 = 0x0000'0000'8000'0000;
     constexpr static uint64_t features_x2apic              = 0x0000'0001'0000'0000;
     constexpr static uint64_t features_xtpr                = 0x0000'0002'0000'0000;
-    // clang-format off
 
-    uint32_t instruction_set = 0;
+    constexpr static uint64_t xcr0_ymm_state = 0x0000'0000'0000'0006;
+    constexpr static uint64_t xcr0_zmm_state = 0x0000'0000'0000'00e6;
+    // clang-format on
+
+    uint64_t instruction_set = 0;
     uint64_t features = 0;
 
     struct leaf_type {
@@ -461,28 +656,41 @@ private:
 
     [[nodiscard]] static leaf_type get_leaf(uint32_t leaf_id, uint32_t index = 0) noexcept
     {
-        query_result_type r;
+        leaf_type r;
         int tmp[4];
 
-        __cpuindex(tmp, char_cast<int>(cpu_id_leaf), char_cast<int>(index));
+        __cpuidex(tmp, static_cast<int>(leaf_id), static_cast<int>(index));
 
-        std::memcpy(&r, tmp, sizeof(result_type));
+        std::memcpy(&r, tmp, sizeof(leaf_type));
         return r;
     }
 
+    [[nodiscard]] static uint64_t get_xcr0() noexcept
+    {
+        return _xgetbv(0);
+    }
+
 #elif HI_COMPILER == HI_CC_GCC || HI_COMPILER == HI_CC_CLANG
 
     [[nodiscard]] static leaf_type get_leaf(uint32_t leaf_id, uint32_t index = 0) noexcept
     {
-        query_result_type r;
+        leaf_type r;
         __cpuid_count(leaf_id, index, r.a, r.b, r.c, r.d);
         return r;
     }
 
+    [[nodiscard]] static uint64_t get_xcr0() noexcept
+    {
+        // The _xgetbv() intrinsic requires -mxsave, which we can not assume.
+        uint32_t lo = 0;
+        uint32_t hi = 0;
+        __asm__("xgetbv" : "=a"(lo), "=d"(hi) : "c"(0));
+        return (static_cast<uint64_t>(hi) << 32) | lo;
+    }
+
 #else
 #error "Unsuported compiler for x64 cpu_id"
 #endif
 };
 
 }}
-
@@ -131,6 +131,13 @@ public:
         return _total_count.fetch_sub(1, std::memory_order::relaxed);
     }
 
+    /** Add a number of items, such as bytes or pixels.
+     */
+    uint64_t operator+=(uint64_t rhs) noexcept
+    {
+        return _total_count.fetch_add(rhs, std::memory_order::relaxed) + rhs;
+    }
+
     /** Add a duration.
      */
     void add_duration(uint64_t duration) noexcept
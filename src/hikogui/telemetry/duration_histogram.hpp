@@ -0,0 +1,171 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file telemetry/duration_histogram.hpp Defines duration_histogram.
+ */
+
+#pragma once
+
+#include "../concurrency/concurrency.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <array>
+#include <atomic>
+#include <chrono>
+#include <bit>
+#include <limits>
+#include <cstdint>
+#include <cmath>
+
+namespace hi::inline v1 {
+
+/** A histogram of durations.
+ *
+ * The buckets are spaced logarithmically with 8 buckets for each power of two,
+ * so that the relative error of a percentile is at most 12.5% for durations
+ * from nanoseconds up to centuries, using a fixed amount of memory.
+ *
+ * Durations may be added from multiple threads without locking.
+ */
+class duration_histogram {
+public:
+    using duration = std::chrono::nanoseconds;
+
+    constexpr static std::size_t num_sub_buckets = 8;
+    constexpr static std::size_t num_buckets = (64 - 2) * num_sub_buckets;
+
+    duration_histogram(duration_histogram const&) = delete;
+    duration_histogram(duration_histogram&&) = delete;
+    duration_histogram& operator=(duration_histogram const&) = delete;
+    duration_histogram& operator=(duration_histogram&&) = delete;
+    constexpr duration_histogram() noexcept = default;
+
+    /** Add a duration to the histogram.
+     *
+     * @param value The duration, negative durations are counted as zero.
+     */
+    void add(duration value) noexcept
+    {
+        hilet ns = value.count() > 0 ? static_cast<uint64_t>(value.count()) : uint64_t{0};
+
+        _buckets[bucket_index(ns)].fetch_add(1, std::memory_order::relaxed);
+        _count.fetch_add(1, std::memory_order::relaxed);
+        _sum.fetch_add(ns, std::memory_order::relaxed);
+        fetch_min(_min, ns, std::memory_order::relaxed);
+        fetch_max(_max, ns, std::memory_order::relaxed);
+    }
+
+    /** Remove all durations from the histogram.
+     *
+     * @note Durations that are added concurrently may be partially removed.
+     */
+    void clear() noexcept
+    {
+        for (auto& bucket : _buckets) {
+            bucket.store(0, std::memory_order::relaxed);
+        }
+        _count.store(0, std::memory_order::relaxed);
+        _sum.store(0, std::memory_order::relaxed);
+        _min.store(std::numeric_limits<uint64_t>::max(), std::memory_order::relaxed);
+        _max.store(0, std::memory_order::relaxed);
+    }
+
+    /** The number of durations in the histogram.
+     */
+    [[nodiscard]] uint64_t count() const noexcept
+    {
+        return _count.load(std::memory_order::relaxed);
+    }
+
+    [[nodiscard]] bool empty() const noexcept
+    {
+        return count() == 0;
+    }
+
+    [[nodiscard]] duration min() const noexcept
+    {
+        return empty() ? duration{} : duration{narrow_cast<duration::rep>(_min.load(std::memory_order::relaxed))};
+    }
+
+    [[nodiscard]] duration max() const noexcept
+    {
+        return duration{narrow_cast<duration::rep>(_max.load(std::memory_order::relaxed))};
+    }
+
+    [[nodiscard]] duration mean() const noexcept
+    {
+        hilet n = count();
+        return n == 0 ? duration{} : duration{narrow_cast<duration::rep>(_sum.load(std::memory_order::relaxed) / n)};
+    }
+
+    /** Get the duration below which a fraction of the durations fall.
+     *
+     * @param fraction The fraction between 0.0 and 1.0, for example 0.99 for the 99th percentile.
+     * @return The upper bound of the bucket which contains the percentile,
+     *         clamped to the maximum duration.
+     */
+    [[nodiscard]] duration percentile(double fraction) const noexcept
+    {
+        hi_axiom(fraction >= 0.0 and fraction <= 1.0);
+
+        hilet n = count();
+        if (n == 0) {
+            return {};
+        }
+
+        hilet target = std::max(uint64_t{1}, static_cast<uint64_t>(std::ceil(fraction * static_cast<double>(n))));
+        auto cumulative = uint64_t{0};
+        for (auto i = 0_uz; i != num_buckets; ++i) {
+            cumulative += _buckets[i].load(std::memory_order::relaxed);
+            if (cumulative >= target) {
+                return std::min(duration{narrow_cast<duration::rep>(bucket_upper_bound(i))}, max());
+            }
+        }
+        return max();
+    }
+
+    /** The bucket that holds a duration.
+     *
+     * @param ns The duration in nanoseconds.
+     */
+    [[nodiscard]] constexpr static std::size_t bucket_index(uint64_t ns) noexcept
+    {
+        if (ns < num_sub_buckets) {
+            return narrow_cast<std::size_t>(ns);
+        }
+
+        hilet exponent = std::bit_width(ns) - 1;
+        hilet mantissa = (ns >> (exponent - 3)) & (num_sub_buckets - 1);
+        return narrow_cast<std::size_t>((exponent - 2) * num_sub_buckets + mantissa);
+    }
+
+    /** The smallest duration in nanoseconds that is counted in a bucket.
+     */
+    [[nodiscard]] constexpr static uint64_t bucket_lower_bound(std::size_t index) noexcept
+    {
+        if (index < num_sub_buckets) {
+            return index;
+        }
+
+        hilet exponent = index / num_sub_buckets + 2;
+        hilet mantissa = index % num_sub_buckets;
+        return uint64_t{num_sub_buckets + mantissa} << (exponent - 3);
+    }
+
+    /** The largest duration in nanoseconds that is counted in a bucket.
+     */
+    [[nodiscard]] constexpr static uint64_t bucket_upper_bound(std::size_t index) noexcept
+    {
+        return index + 1 == num_buckets ? std::numeric_limits<uint64_t>::max() : bucket_lower_bound(index + 1) - 1;
+    }
+
+private:
+    std::array<std::atomic<uint64_t>, num_buckets> _buckets = {};
+    std::atomic<uint64_t> _count = 0;
+    std::atomic<uint64_t> _sum = 0;
+    std::atomic<uint64_t> _min = std::numeric_limits<uint64_t>::max();
+    std::atomic<uint64_t> _max = 0;
+};
+
+} // namespace hi::inline v1
@@ -0,0 +1,66 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "duration_histogram.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <chrono>
+#include <limits>
+
+using namespace hi;
+using namespace std::chrono_literals;
+
+TEST(duration_histogram, buckets)
+{
+    // The buckets are continuous and ordered.
+    for (auto i = 0_uz; i + 1 != duration_histogram::num_buckets; ++i) {
+        ASSERT_EQ(duration_histogram::bucket_upper_bound(i) + 1, duration_histogram::bucket_lower_bound(i + 1));
+        ASSERT_EQ(duration_histogram::bucket_index(duration_histogram::bucket_lower_bound(i)), i);
+        ASSERT_EQ(duration_histogram::bucket_index(duration_histogram::bucket_upper_bound(i)), i);
+    }
+
+    ASSERT_EQ(duration_histogram::bucket_index(0), 0U);
+    ASSERT_EQ(duration_histogram::bucket_index(std::numeric_limits<uint64_t>::max()), duration_histogram::num_buckets - 1);
+}
+
+TEST(duration_histogram, empty)
+{
+    auto histogram = duration_histogram{};
+    ASSERT_TRUE(histogram.empty());
+    ASSERT_EQ(histogram.min(), 0ns);
+    ASSERT_EQ(histogram.max(), 0ns);
+    ASSERT_EQ(histogram.mean(), 0ns);
+    ASSERT_EQ(histogram.percentile(0.5), 0ns);
+}
+
+TEST(duration_histogram, percentile)
+{
+    auto histogram = duration_histogram{};
+
+    // 99 fast frames and a single slow frame.
+    for (auto i = 0; i != 99; ++i) {
+        histogram.add(1ms);
+    }
+    histogram.add(50ms);
+
+    ASSERT_EQ(histogram.count(), 100U);
+    ASSERT_EQ(histogram.min(), 1ms);
+    ASSERT_EQ(histogram.max(), 50ms);
+    ASSERT_EQ(histogram.mean(), 1490us);
+
+    // The percentiles are accurate within 12.5%.
+    hilet p50 = histogram.percentile(0.5);
+    ASSERT_GE(p50, 1ms);
+    ASSERT_LE(p50, 1125us);
+
+    hilet p99 = histogram.percentile(0.99);
+    ASSERT_GE(p99, 1ms);
+    ASSERT_LE(p99, 1125us);
+
+    ASSERT_EQ(histogram.percentile(1.0), 50ms);
+
+    histogram.clear();
+    ASSERT_TRUE(histogram.empty());
+    ASSERT_EQ(histogram.max(), 0ns);
+}
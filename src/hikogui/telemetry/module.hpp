@@ -2,5 +2,6 @@
 #pragma once
 
 #include "counters.hpp"
+#include "duration_histogram.hpp"
 #include "log.hpp"
 #include "trace.hpp"
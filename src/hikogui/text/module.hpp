@@ -8,4 +8,5 @@
 #include "text_shaper.hpp"
 #include "text_shaper_char.hpp"
 #include "text_shaper_line.hpp"
+#include "text_shaper_run_cache.hpp"
 #include "text_style.hpp"
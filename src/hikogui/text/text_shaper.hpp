@@ -96,6 +96,35 @@ public:
         bool left_to_right,
         iso_15924 script = iso_15924{"Zyyy"}) noexcept;
 
+    /** Update the text of the text shaper.
+     *
+     * When the font-book, style, scale, alignment, direction and script are the same as the ones
+     * used to construct the text shaper, only the paragraphs that were modified are re-analyzed;
+     * the glyphs, break-opportunities and scripts of unmodified paragraphs are reused.
+     *
+     * The lines of unmodified paragraphs are reused by the next call to `layout()` with the same
+     * arguments as the previous call, they are only shifted vertically to their new position.
+     *
+     * Otherwise this function is equivalent to assigning a newly constructed text_shaper.
+     *
+     * @note The lines are only valid again after the next call to `layout()`.
+     * @param font_book The font_book instance to retrieve fonts from.
+     * @param text The new text as a vector of attributed graphemes.
+     * @param style The initial text-style to use to display the text.
+     * @param dpi_scale The scaling factor to use to scale a font's size to match the physical display.
+     * @param alignment The alignment how to align the text.
+     * @param text_direction The default text direction when it can not be deduced from the text.
+     * @param script The script of the text.
+     */
+    void update(
+        hi::font_book& font_book,
+        gstring const& text,
+        text_style const& style,
+        float dpi_scale,
+        hi::alignment alignment,
+        bool left_to_right,
+        iso_15924 script = iso_15924{"Zyyy"}) noexcept;
+
     [[nodiscard]] bool empty() const noexcept
     {
         return _text.empty();
@@ -152,6 +181,9 @@ public:
      *  - middle, odd number of lines: y=0 is the base-line of the middle line.
      *  - middle, even number of lines: y=0 is half-way between the base-line of the two lines in the middle.
      *
+     * The folded paragraphs are kept for a few different @a maximum_line_width values, after `update()`
+     * only the modified paragraphs are folded again.
+     *
      * @param maximum_line_width The maximum line width allowed, this may be infinite to determine
      *        the natural text size without folding.
      * @param line_spacing The scaling of the spacing between lines.
@@ -471,6 +503,75 @@ private:
      */
     aarectangle _rectangle;
 
+    /** The style used to construct the text shaper.
+     */
+    text_style _style;
+
+    /** The default text direction used to construct the text shaper.
+     */
+    bool _left_to_right = true;
+
+    /** The arguments of the last call to `layout()`.
+     */
+    float _baseline = 0.0f;
+    extent2 _sub_pixel_size = {};
+    float _line_spacing = 0.0f;
+    float _paragraph_spacing = 0.0f;
+
+    /** The first character of the paragraphs that need to be laid out again.
+     */
+    size_t _dirty_first = 0;
+
+    /** One beyond the last character of the paragraphs that need to be laid out again.
+     */
+    size_t _dirty_last = 0;
+
+    /** The index in `_lines` where the lines of the dirty paragraphs need to be inserted.
+     */
+    size_t _dirty_line_index = 0;
+
+    /** The lines outside of the dirty paragraphs are valid.
+     *
+     * When true, `layout()` with the same arguments only needs to create the lines
+     * between `_dirty_first` and `_dirty_last`.
+     */
+    bool _has_dirty_lines = false;
+
+    /** The size of a folded line, used to calculate the bounding rectangle without laying out the text.
+     */
+    struct line_extent_type {
+        float width;
+        font_metrics metrics;
+        unicode_general_category last_category;
+        float y = 0.0f;
+    };
+
+    /** The folded lines of a single paragraph.
+     */
+    struct paragraph_extent_type {
+        size_t first;
+        size_t last;
+        std::vector<line_extent_type> lines;
+    };
+
+    /** The folded paragraphs of the text at a maximum line width.
+     */
+    struct text_extent_type {
+        float maximum_line_width;
+        std::vector<paragraph_extent_type> paragraphs;
+    };
+
+    /** The maximum number of different line widths for which the folded paragraphs are kept.
+     */
+    constexpr static size_t max_text_extents = 4;
+
+    /** The folded paragraphs used by `bounding_rectangle()`.
+     *
+     * `update()` only removes the paragraphs that were modified, so that `bounding_rectangle()`
+     * only needs to fold those paragraphs again.
+     */
+    std::vector<text_extent_type> _text_extents;
+
     /** Create lines from the characters in the text shaper.
      *
      * @param rectangle The rectangle to position the glyphs in.
@@ -495,8 +596,44 @@ private:
     void position_glyphs(aarectangle rectangle, extent2 sub_pixel_size) noexcept;
 
     /** Resolve the script of each character in text.
+     *
+     * @param first The index of the first character of a paragraph.
+     * @param last The index one beyond the last character of a paragraph.
+     */
+    void resolve_script(size_t first, size_t last) noexcept;
+
+    /** Resolve the script of each character in text.
+     */
+    void resolve_script() noexcept
+    {
+        return resolve_script(0, _text.size());
+    }
+
+    /** Fold a paragraph, without creating the lines.
+     *
+     * @param first The index of the first character of the paragraph.
+     * @param last The index one beyond the last character of the paragraph.
+     * @param maximum_line_width The maximum width of a line.
+     * @return The width, metrics and category of the last character of each line of the paragraph.
+     */
+    [[nodiscard]] paragraph_extent_type fold_paragraph(size_t first, size_t last, float maximum_line_width) noexcept;
+
+    /** Fold all paragraphs of the text.
+     *
+     * Paragraphs that were folded before at the same width and not modified since are reused.
+     *
+     * @param maximum_line_width The maximum width of a line.
+     * @return The folded paragraphs in order.
+     */
+    [[nodiscard]] std::vector<paragraph_extent_type> const& fold_paragraphs(float maximum_line_width) noexcept;
+
+    /** Layout only the lines of the paragraphs that were modified by `update()`.
+     *
+     * @pre `_has_dirty_lines == true`.
+     * @param rectangle The rectangle to position the glyphs in.
+     * @param sub_pixel_size The size of a sub-pixel in device-independent-pixels.
      */
-    void resolve_script() noexcept;
+    void layout_dirty_lines(aarectangle rectangle, float baseline, extent2 sub_pixel_size) noexcept;
 
     [[nodiscard]] std::pair<text_cursor, text_cursor>
     get_selection_from_break(text_cursor cursor, unicode_break_vector const& break_opportunities) const noexcept;
@@ -15,7 +15,14 @@
 
 namespace hi::inline v1 {
 
-static void layout_lines_vertical_spacing(text_shaper::line_vector& lines, float line_spacing, float paragraph_spacing) noexcept
+/** Position the lines vertically relative to the first line.
+ *
+ * @param[in,out] lines The lines, or the extent of the lines.
+ * @param line_spacing The scaling of the spacing between lines.
+ * @param paragraph_spacing The scaling of the spacing between paragraphs.
+ */
+template<typename Lines>
+static void layout_lines_vertical_spacing(Lines& lines, float line_spacing, float paragraph_spacing) noexcept
 {
     hi_assert(not lines.empty());
 
@@ -30,8 +37,9 @@ static void layout_lines_vertical_spacing(text_shaper::line_vector& lines, float
     }
 }
 
+template<typename Lines>
 static void layout_lines_vertical_alignment(
-    text_shaper::line_vector& lines,
+    Lines& lines,
     vertical_alignment alignment,
     float baseline,
     float min_y,
@@ -80,20 +88,31 @@ static void layout_lines_vertical_alignment(
 
 /** Run the bidi-algorithm over the text and replace the columns of each line.
  *
- * @param[in,out] lines The lines to be modified
+ * @param first_line The first line to be modified, must be the first line of a paragraph.
+ * @param last_line One beyond the last line to be modified, must be one beyond the last line of a paragraph.
  * @param[in,out] text The input text. non-const because modifications on the text is required.
  * @param writing_direction The initial writing direction.
  */
-static void
-bidi_algorithm(text_shaper::line_vector& lines, text_shaper::char_vector& text, unicode_bidi_context bidi_context) noexcept
+static void bidi_algorithm(
+    text_shaper::line_iterator first_line,
+    text_shaper::line_iterator last_line,
+    text_shaper::char_vector& text,
+    unicode_bidi_context bidi_context) noexcept
 {
-    hi_assert(not lines.empty());
+    if (first_line == last_line) {
+        return;
+    }
+
+    auto num_chars = 0_uz;
+    for (auto it = first_line; it != last_line; ++it) {
+        num_chars += narrow_cast<size_t>(std::distance(it->first, it->last));
+    }
 
     // Create a list of all character indices.
     auto char_its = std::vector<text_shaper::char_iterator>{};
     // Make room for implicit line-separators.
-    char_its.reserve(text.size() + lines.size());
-    for (hilet& line : lines) {
+    char_its.reserve(num_chars + narrow_cast<size_t>(std::distance(first_line, last_line)));
+    for (hilet& line : std::ranges::subrange(first_line, last_line)) {
         // Add all the characters of a line.
         for (auto it = line.first; it != line.last; ++it) {
             char_its.push_back(it);
@@ -130,7 +149,7 @@ bidi_algorithm(text_shaper::line_vector& lines, text_shaper::char_vector& text,
 
     // Add the paragraph direction for each line.
     auto par_it = paragraph_directions.cbegin();
-    for (auto& line : lines) {
+    for (auto& line : std::ranges::subrange(first_line, last_line)) {
         hi_axiom(par_it != paragraph_directions.cend());
         line.paragraph_direction = *par_it;
         if (line.last_category == unicode_general_category::Zp) {
@@ -140,7 +159,7 @@ bidi_algorithm(text_shaper::line_vector& lines, text_shaper::char_vector& text,
     hi_assert(par_it <= paragraph_directions.cend());
 
     // Add the character indices for each line in display order.
-    auto line_it = lines.begin();
+    auto line_it = first_line;
     line_it->columns.clear();
     auto column_nr = 0_uz;
     for (hilet char_it : char_its) {
@@ -154,7 +173,7 @@ bidi_algorithm(text_shaper::line_vector& lines, text_shaper::char_vector& text,
             line_it->columns.clear();
             column_nr = 0_uz;
         }
-        hi_axiom(line_it != lines.end());
+        hi_axiom(line_it != last_line);
         hi_axiom(char_it >= line_it->first);
         hi_axiom(char_it < line_it->last);
         line_it->columns.push_back(char_it);
@@ -164,12 +183,62 @@ bidi_algorithm(text_shaper::line_vector& lines, text_shaper::char_vector& text,
         char_it->column_nr = column_nr++;
     }
 
-    // All of the characters in the text must be positioned.
-    for (auto& c : text) {
-        hi_axiom(c.line_nr != std::numeric_limits<size_t>::max() and c.column_nr != std::numeric_limits<size_t>::max());
+    // All of the characters in the lines must be positioned.
+    for (hilet& line : std::ranges::subrange(first_line, last_line)) {
+        for (auto it = line.first; it != line.last; ++it) {
+            hi_axiom(
+                it->line_nr != std::numeric_limits<size_t>::max() and it->column_nr != std::numeric_limits<size_t>::max());
+        }
+    }
+}
+
+/** Replace a range of items in a vector with a new set of items.
+ *
+ * @param[in,out] v The vector to modify.
+ * @param first The index of the first item to replace.
+ * @param last The index one beyond the last item to replace.
+ * @param replacement The new items.
+ */
+template<typename T>
+static void replace_range(std::vector<T>& v, size_t first, size_t last, std::vector<T>&& replacement) noexcept
+{
+    hi_axiom(first <= last and last <= v.size());
+
+    hilet num_old = last - first;
+    hilet num_common = std::min(num_old, replacement.size());
+    std::move(replacement.begin(), replacement.begin() + num_common, v.begin() + first);
+
+    if (replacement.size() > num_old) {
+        v.insert(
+            v.begin() + first + num_common,
+            std::make_move_iterator(replacement.begin() + num_common),
+            std::make_move_iterator(replacement.end()));
+    } else {
+        v.erase(v.begin() + first + num_common, v.begin() + last);
     }
 }
 
+/** Replace the break opportunities of a range of paragraphs.
+ *
+ * The opportunity before the first character of the range is kept, as it
+ * belongs to the end of the previous paragraph.
+ *
+ * @param[in,out] opportunities The break opportunities of the whole text, one more than the number of characters.
+ * @param first The index of the first character of the paragraphs.
+ * @param last The index one beyond the last character of the paragraphs.
+ * @param replacement The break opportunities of the new paragraphs.
+ */
+static void replace_break_opportunities(
+    unicode_break_vector& opportunities,
+    size_t first,
+    size_t last,
+    unicode_break_vector&& replacement) noexcept
+{
+    hi_axiom(not replacement.empty());
+    replacement.erase(replacement.begin());
+    replace_range(opportunities, first + 1, last + 1, std::move(replacement));
+}
+
 [[nodiscard]] text_shaper::text_shaper(
     hi::font_book& font_book,
     gstring const& text,
@@ -182,7 +251,9 @@ bidi_algorithm(text_shaper::line_vector& lines, text_shaper::char_vector& text,
     _bidi_context(left_to_right ? unicode_bidi_class::L : unicode_bidi_class::R),
     _dpi_scale(dpi_scale),
     _alignment(alignment),
-    _script(script)
+    _script(script),
+    _style(style),
+    _left_to_right(left_to_right)
 {
     hilet& font = font_book.find_font(style->family_id, style->variant);
     _initial_line_metrics = (style->size * dpi_scale) * font.metrics;
@@ -235,6 +306,201 @@ bidi_algorithm(text_shaper::line_vector& lines, text_shaper::char_vector& text,
 {
 }
 
+void text_shaper::update(
+    hi::font_book& font_book,
+    gstring const& text,
+    text_style const& style,
+    float dpi_scale,
+    hi::alignment alignment,
+    bool left_to_right,
+    iso_15924 script) noexcept
+{
+    if (_font_book != &font_book or _style != style or _dpi_scale != dpi_scale or _alignment != alignment or
+        _left_to_right != left_to_right or _script != script) {
+        *this = text_shaper{font_book, text, style, dpi_scale, alignment, left_to_right, script};
+        return;
+    }
+
+    hilet clean_grapheme = [](grapheme const& c) {
+        return c == '\n' ? grapheme{unicode_PS} : c;
+    };
+
+    hilet old_size = _text.size();
+    hilet new_size = text.size();
+
+    // Find the part of the text that was modified.
+    auto prefix = 0_uz;
+    while (prefix != old_size and prefix != new_size and _text[prefix].grapheme == clean_grapheme(text[prefix])) {
+        ++prefix;
+    }
+    if (prefix == old_size and prefix == new_size) {
+        return;
+    }
+
+    auto suffix = 0_uz;
+    while (prefix + suffix != old_size and prefix + suffix != new_size and
+           _text[old_size - suffix - 1].grapheme == clean_grapheme(text[new_size - suffix - 1])) {
+        ++suffix;
+    }
+
+    // Extend the modification to whole paragraphs, in both the old and the new text.
+    auto first = prefix;
+    while (first != 0 and _text[first - 1].grapheme != unicode_PS) {
+        --first;
+    }
+
+    auto old_last = old_size - suffix;
+    auto new_last = new_size - suffix;
+    hilet is_paragraph_end = [first](auto const& str, size_t i, auto const& get_grapheme) {
+        return i == str.size() or (i > first and get_grapheme(str[i - 1]) == unicode_PS);
+    };
+    hilet get_old = [](text_shaper_char const& c) -> grapheme const& {
+        return c.grapheme;
+    };
+    while (not is_paragraph_end(_text, old_last, get_old) or not is_paragraph_end(text, new_last, clean_grapheme)) {
+        // Both texts are the same in the suffix, so they advance in lock-step.
+        ++old_last;
+        ++new_last;
+    }
+    hilet delta = static_cast<ptrdiff_t>(new_size) - static_cast<ptrdiff_t>(old_size);
+
+    hilet old_first_script = old_size == 0 ? _script : ucd_get_script(_text.front().grapheme[0]);
+
+    // Remove the lines of the modified paragraphs, and remember the rest of the lines as indices.
+    // The lines from previous calls to update() that are not yet laid out are merged.
+    struct line_indices_type {
+        size_t first;
+        size_t last;
+        size_t columns_offset;
+    };
+    auto line_indices = std::vector<line_indices_type>{};
+    auto column_indices = std::vector<size_t>{};
+    auto kept_lines = line_vector{};
+    auto dirty_first = first;
+    auto dirty_last = old_last;
+    auto dirty_line_index = 0_uz;
+    hilet has_dirty_lines = not _lines.empty();
+    if (has_dirty_lines) {
+        if (_has_dirty_lines) {
+            inplace_min(dirty_first, _dirty_first);
+            inplace_max(dirty_last, _dirty_last);
+        }
+
+        kept_lines.reserve(_lines.size());
+        line_indices.reserve(_lines.size());
+        column_indices.reserve(old_size);
+        for (auto& line : _lines) {
+            hilet line_first = narrow_cast<size_t>(std::distance(_text.begin(), line.first));
+            hilet line_last = narrow_cast<size_t>(std::distance(_text.begin(), line.last));
+            hilet is_before = line_last <= dirty_first and line_first != old_size;
+            hilet is_after = line_first >= dirty_last and not(line_first == old_size and dirty_last == old_size);
+
+            if (not is_before and not is_after) {
+                continue;
+            }
+            if (is_before) {
+                ++dirty_line_index;
+            }
+
+            hilet offset = is_after ? delta : ptrdiff_t{0};
+            line_indices.emplace_back(
+                narrow_cast<size_t>(static_cast<ptrdiff_t>(line_first) + offset),
+                narrow_cast<size_t>(static_cast<ptrdiff_t>(line_last) + offset),
+                column_indices.size());
+            for (hilet column : line.columns) {
+                column_indices.push_back(narrow_cast<size_t>(std::distance(_text.begin(), column) + offset));
+            }
+            kept_lines.push_back(std::move(line));
+        }
+    }
+    _lines = std::move(kept_lines);
+
+    // Analyze the new paragraphs.
+    hilet& font = font_book.find_font(style->family_id, style->variant);
+
+    auto new_text = char_vector{};
+    new_text.reserve(new_last - first);
+    for (auto i = first; i != new_last; ++i) {
+        auto& tmp = new_text.emplace_back(clean_grapheme(text[i]), style, dpi_scale);
+        tmp.initialize_glyph(font_book, font);
+    }
+
+    auto new_widths = std::vector<float>{};
+    new_widths.reserve(new_text.size());
+    for (hilet& c : new_text) {
+        new_widths.push_back(is_visible(c.general_category) ? c.width : -c.width);
+    }
+
+    hilet get_code_point = [](hilet& c) -> decltype(auto) {
+        return c.grapheme[0];
+    };
+    auto new_line_break_opportunities = unicode_line_break(new_text.begin(), new_text.end(), get_code_point);
+    auto new_word_break_opportunities = unicode_word_break(new_text.begin(), new_text.end(), get_code_point);
+    auto new_sentence_break_opportunities = unicode_sentence_break(new_text.begin(), new_text.end(), get_code_point);
+
+    // Replace the modified paragraphs.
+    replace_range(_text, first, old_last, std::move(new_text));
+    replace_range(_line_break_widths, first, old_last, std::move(new_widths));
+    replace_break_opportunities(_line_break_opportunities, first, old_last, std::move(new_line_break_opportunities));
+    replace_break_opportunities(_word_break_opportunities, first, old_last, std::move(new_word_break_opportunities));
+    replace_break_opportunities(
+        _sentence_break_opportunities, first, old_last, std::move(new_sentence_break_opportunities));
+    hi_axiom(_text.size() == new_size);
+
+    // The direction of the text is determined by the first paragraph. unicode_bidi_direction() stops
+    // at the first paragraph separator, so this does not look at the rest of the text.
+    _text_direction = unicode_bidi_direction(
+        _text.begin(),
+        _text.end(),
+        [](text_shaper::char_const_reference it) {
+            return it.grapheme[0];
+        },
+        _bidi_context);
+
+    // Remove the folded paragraphs that were modified, and move the ones after the modification.
+    for (auto& extent : _text_extents) {
+        std::erase_if(extent.paragraphs, [&](paragraph_extent_type const& paragraph) {
+            return paragraph.last > first and paragraph.first < old_last;
+        });
+        for (auto& paragraph : extent.paragraphs) {
+            if (paragraph.first >= old_last) {
+                paragraph.first = narrow_cast<size_t>(static_cast<ptrdiff_t>(paragraph.first) + delta);
+                paragraph.last = narrow_cast<size_t>(static_cast<ptrdiff_t>(paragraph.last) + delta);
+            }
+        }
+    }
+
+    hilet new_first_script = new_size == 0 ? _script : ucd_get_script(_text.front().grapheme[0]);
+    if (new_first_script != old_first_script) {
+        // The first script is used as default for the whole text.
+        resolve_script();
+    } else {
+        resolve_script(first, new_last);
+    }
+
+    // Point the lines that were not modified to the new text.
+    if (has_dirty_lines) {
+        hi_axiom(_lines.size() == line_indices.size());
+        for (auto i = 0_uz; i != _lines.size(); ++i) {
+            auto& line = _lines[i];
+            hilet& indices = line_indices[i];
+            hilet columns_last = i + 1 == line_indices.size() ? column_indices.size() : line_indices[i + 1].columns_offset;
+            hi_axiom(line.columns.size() == columns_last - indices.columns_offset);
+
+            line.first = _text.begin() + indices.first;
+            line.last = _text.begin() + indices.last;
+            for (auto j = indices.columns_offset; j != columns_last; ++j) {
+                line.columns[j - indices.columns_offset] = _text.begin() + column_indices[j];
+            }
+        }
+
+        _dirty_first = dirty_first;
+        _dirty_last = narrow_cast<size_t>(static_cast<ptrdiff_t>(dirty_last) + delta);
+        _dirty_line_index = dirty_line_index;
+    }
+    _has_dirty_lines = has_dirty_lines;
+}
+
 [[nodiscard]] text_shaper::line_vector text_shaper::make_lines(
     aarectangle rectangle,
     float baseline,
@@ -279,15 +545,17 @@ void text_shaper::position_glyphs(aarectangle rectangle, extent2 sub_pixel_size)
     hi_assert(not _lines.empty());
 
     // The bidi algorithm will reorder the characters on each line, and mirror the brackets in the text when needed.
-    bidi_algorithm(_lines, _text, _bidi_context);
+    bidi_algorithm(_lines.begin(), _lines.end(), _text, _bidi_context);
     for (auto& line : _lines) {
         // Position the glyphs on each line. Possibly morph glyphs to handle ligatures and calculate the bounding rectangles.
         line.layout(_alignment.horizontal(), rectangle.left(), rectangle.right(), sub_pixel_size.width());
     }
 }
 
-[[deprecated("should be handled by unicode")]] void text_shaper::resolve_script() noexcept
+[[deprecated("should be handled by unicode")]] void text_shaper::resolve_script(size_t first, size_t last) noexcept
 {
+    hi_axiom(first <= last and last <= _text.size());
+
     // Find the first script in the text if no script is found use the text_shaper's default script.
     auto first_script = _script;
     for (auto& c : _text) {
@@ -299,12 +567,21 @@ void text_shaper::position_glyphs(aarectangle rectangle, extent2 sub_pixel_size)
         }
     }
 
+    // The backward pass starts with the script of the first character with an explicit script after the range.
+    auto previous_script = first_script;
+    for (auto i = last; i != _text.size(); ++i) {
+        hilet script = ucd_get_script(_text[i].grapheme[0]);
+        if (script != iso_15924::uncoded() and script != iso_15924::common() and script != iso_15924::inherited()) {
+            previous_script = script;
+            break;
+        }
+    }
+
     // Backward pass: fix start of words and open-brackets.
     // After this pass unknown-script is no longer in the text.
     // Close brackets will not be fixed, those will be fixed in the last forward pass.
     auto word_script = iso_15924::common();
-    auto previous_script = first_script;
-    for (auto i = std::ssize(_text) - 1; i >= 0; --i) {
+    for (auto i = static_cast<ptrdiff_t>(last) - 1; i >= static_cast<ptrdiff_t>(first); --i) {
         auto& c = _text[i];
 
         if (_word_break_opportunities[i + 1] != unicode_break_opportunity::no) {
@@ -327,8 +604,9 @@ void text_shaper::position_glyphs(aarectangle rectangle, extent2 sub_pixel_size)
     }
 
     // Forward pass: fix all common and inherited with previous or first script.
-    previous_script = first_script;
-    for (auto i = 0_uz; i != _text.size(); ++i) {
+    // The forward pass starts with the already resolved script of the character before the range.
+    previous_script = first == 0 ? first_script : _text[first - 1].script;
+    for (auto i = first; i != last; ++i) {
         auto& c = _text[i];
 
         if (c.script == iso_15924::common() or c.script == iso_15924::inherited()) {
@@ -343,13 +621,29 @@ void text_shaper::position_glyphs(aarectangle rectangle, extent2 sub_pixel_size)
 [[nodiscard]] aarectangle
 text_shaper::bounding_rectangle(float maximum_line_width, float line_spacing, float paragraph_spacing) noexcept
 {
-    hilet rectangle = aarectangle{
-        point2{0.0f, std::numeric_limits<float>::lowest()}, point2{maximum_line_width, std::numeric_limits<float>::max()}};
     constexpr auto baseline = 0.0f;
-    constexpr auto sub_pixel_size = extent2{1.0f, 1.0f};
+    constexpr auto sub_pixel_height = 1.0f;
 
-    hilet lines = make_lines(rectangle, baseline, sub_pixel_size, line_spacing, paragraph_spacing);
-    hi_assert(not lines.empty());
+    // Only the width, metrics and vertical position of each line is needed, which is much cheaper
+    // than make_lines(). Lines are never folded across paragraphs, so each paragraph is folded separately.
+    auto lines = std::vector<line_extent_type>{};
+    for (hilet& paragraph : fold_paragraphs(maximum_line_width)) {
+        lines.insert(lines.end(), paragraph.lines.begin(), paragraph.lines.end());
+    }
+
+    // The same empty line as added by make_lines().
+    if (lines.empty() or is_Zp_or_Zl(lines.back().last_category)) {
+        lines.emplace_back(0.0f, _initial_line_metrics, unicode_general_category::Cn);
+    }
+
+    layout_lines_vertical_spacing(lines, line_spacing, paragraph_spacing);
+    layout_lines_vertical_alignment(
+        lines,
+        _alignment.vertical(),
+        baseline,
+        std::numeric_limits<float>::lowest(),
+        std::numeric_limits<float>::max(),
+        sub_pixel_height);
 
     auto max_width = 0.0f;
     for (auto& line : lines) {
@@ -361,6 +655,85 @@ text_shaper::bounding_rectangle(float maximum_line_width, float line_spacing, fl
     return aarectangle{point2{0.0f, min_y}, point2{std::ceil(max_width), max_y}};
 }
 
+[[nodiscard]] text_shaper::paragraph_extent_type
+text_shaper::fold_paragraph(size_t first, size_t last, float maximum_line_width) noexcept
+{
+    hi_axiom(first <= last and last <= _text.size());
+
+    // The first opportunity is the end of the previous paragraph.
+    hilet opportunities =
+        unicode_break_vector(_line_break_opportunities.begin() + first, _line_break_opportunities.begin() + last + 1);
+    hilet widths = std::vector<float>(_line_break_widths.begin() + first, _line_break_widths.begin() + last);
+    hilet line_sizes = unicode_line_break(opportunities, widths, maximum_line_width);
+
+    auto r = paragraph_extent_type{first, last, {}};
+    r.lines.reserve(line_sizes.size());
+
+    auto char_it = _text.begin() + first;
+    auto width_it = _line_break_widths.begin() + first;
+    for (hilet line_size : line_sizes) {
+        hi_axiom(line_size > 0);
+        hilet char_eol = char_it + line_size;
+        hilet width_eol = width_it + line_size;
+
+        // Use a temporary line so that the metrics are calculated exactly like make_lines() does.
+        hilet line = text_shaper_line{
+            0_uz, _text.begin(), char_it, char_eol, detail::unicode_LB_width(width_it, width_eol), _initial_line_metrics};
+        r.lines.emplace_back(line.width, line.metrics, line.last_category);
+
+        char_it = char_eol;
+        width_it = width_eol;
+    }
+    return r;
+}
+
+[[nodiscard]] std::vector<text_shaper::paragraph_extent_type> const&
+text_shaper::fold_paragraphs(float maximum_line_width) noexcept
+{
+    auto extent_it = std::ranges::find(_text_extents, maximum_line_width, &text_extent_type::maximum_line_width);
+    if (extent_it == _text_extents.end()) {
+        if (_text_extents.size() == max_text_extents) {
+            _text_extents.erase(_text_extents.begin());
+        }
+        extent_it = _text_extents.insert(_text_extents.end(), text_extent_type{maximum_line_width, {}});
+    }
+
+    auto& cached = extent_it->paragraphs;
+    auto cached_it = cached.begin();
+
+    auto r = std::vector<paragraph_extent_type>{};
+    r.reserve(cached.size());
+    auto first = 0_uz;
+    while (first != _text.size()) {
+        while (cached_it != cached.end() and cached_it->first < first) {
+            ++cached_it;
+        }
+
+        if (cached_it != cached.end() and cached_it->first == first) {
+            ++global_counter<"text_shaper:fold:hit">;
+            first = cached_it->last;
+            r.push_back(std::move(*cached_it));
+            ++cached_it;
+
+        } else {
+            ++global_counter<"text_shaper:fold:miss">;
+            // Find the end of the paragraph, including the paragraph separator.
+            auto last = first;
+            while (last != _text.size()) {
+                if (_text[last++].grapheme == unicode_PS) {
+                    break;
+                }
+            }
+
+            r.push_back(fold_paragraph(first, last, maximum_line_width));
+            first = last;
+        }
+    }
+
+    cached = std::move(r);
+    return cached;
+}
+
 [[nodiscard]] std::pair<font_metrics, unicode_general_category>
 text_shaper::get_line_metrics(text_shaper::char_const_iterator first, text_shaper::char_const_iterator last) const noexcept
 {
@@ -492,12 +865,117 @@ get_widths(unicode_break_vector const& opportunities, std::vector<float> const&
     float line_spacing,
     float paragraph_spacing) noexcept
 {
+    hilet same_arguments = _rectangle == rectangle and _baseline == baseline and _sub_pixel_size == sub_pixel_size and
+        _line_spacing == line_spacing and _paragraph_spacing == paragraph_spacing;
+
+    if (std::exchange(_has_dirty_lines, false) and same_arguments) {
+        ++global_counter<"text_shaper:layout:incremental">;
+        layout_dirty_lines(rectangle, baseline, sub_pixel_size);
+        return;
+    }
+
+    ++global_counter<"text_shaper:layout:full">;
     _rectangle = rectangle;
+    _baseline = baseline;
+    _sub_pixel_size = sub_pixel_size;
+    _line_spacing = line_spacing;
+    _paragraph_spacing = paragraph_spacing;
     _lines = make_lines(rectangle, baseline, sub_pixel_size, line_spacing, paragraph_spacing);
     hi_assert(not _lines.empty());
     position_glyphs(rectangle, sub_pixel_size);
 }
 
+void text_shaper::layout_dirty_lines(aarectangle rectangle, float baseline, extent2 sub_pixel_size) noexcept
+{
+    hi_axiom(_dirty_first <= _dirty_last and _dirty_last <= _text.size());
+    hi_axiom(_dirty_line_index <= _lines.size());
+
+    // Fold only the modified paragraphs, the first opportunity is the end of the previous paragraph.
+    hilet dirty_opportunities = unicode_break_vector(
+        _line_break_opportunities.begin() + _dirty_first, _line_break_opportunities.begin() + _dirty_last + 1);
+    hilet dirty_widths =
+        std::vector<float>(_line_break_widths.begin() + _dirty_first, _line_break_widths.begin() + _dirty_last);
+    hilet line_sizes = unicode_line_break(dirty_opportunities, dirty_widths, rectangle.width());
+
+    auto dirty_lines = line_vector{};
+    dirty_lines.reserve(line_sizes.size() + 1);
+
+    auto char_it = _text.begin() + _dirty_first;
+    auto width_it = _line_break_widths.begin() + _dirty_first;
+    for (hilet line_size : line_sizes) {
+        hi_axiom(line_size > 0);
+        hilet char_eol = char_it + line_size;
+        hilet width_eol = width_it + line_size;
+
+        hilet line_width = detail::unicode_LB_width(width_it, width_eol);
+        dirty_lines.emplace_back(0_uz, _text.begin(), char_it, char_eol, line_width, _initial_line_metrics);
+
+        char_it = char_eol;
+        width_it = width_eol;
+    }
+
+    if (_dirty_last == _text.size()) {
+        // The modified paragraphs are at the end of the text, an empty line may be needed after the last paragraph.
+        hilet previous_line = not dirty_lines.empty() ? &dirty_lines.back() :
+            _dirty_line_index != 0                    ? &_lines[_dirty_line_index - 1] :
+                                                        nullptr;
+
+        if (previous_line == nullptr or is_Zp_or_Zl(previous_line->last_category)) {
+            dirty_lines.emplace_back(0_uz, _text.begin(), _text.end(), _text.end(), 0.0f, _initial_line_metrics);
+            dirty_lines.back().paragraph_direction = _text_direction;
+        }
+    }
+
+    // Remember the vertical position of the lines that are kept, so that they can be moved.
+    auto old_y = std::vector<float>{};
+    old_y.reserve(_lines.size());
+    for (hilet& line : _lines) {
+        old_y.push_back(line.y);
+    }
+
+    hilet num_dirty_lines = dirty_lines.size();
+    _lines.insert(
+        _lines.begin() + _dirty_line_index,
+        std::make_move_iterator(dirty_lines.begin()),
+        std::make_move_iterator(dirty_lines.end()));
+    hi_assert(not _lines.empty());
+
+    // Renumber the lines, and the back-references from the characters of the lines after the modification.
+    for (auto line_nr = _dirty_line_index; line_nr != _lines.size(); ++line_nr) {
+        auto& line = _lines[line_nr];
+        if (std::exchange(line.line_nr, line_nr) != line_nr) {
+            for (hilet column : line.columns) {
+                column->line_nr = line_nr;
+            }
+        }
+    }
+
+    layout_lines_vertical_spacing(_lines, _line_spacing, _paragraph_spacing);
+    layout_lines_vertical_alignment(
+        _lines, _alignment.vertical(), baseline, rectangle.bottom(), rectangle.top(), sub_pixel_size.height());
+
+    // Move the lines that were kept to their new vertical position.
+    for (auto i = 0_uz; i != old_y.size(); ++i) {
+        auto& line = i < _dirty_line_index ? _lines[i] : _lines[i + num_dirty_lines];
+        hilet offset = translate2{0.0f, line.y - old_y[i]};
+        if (offset != translate2{}) {
+            line.rectangle = offset * line.rectangle;
+            for (hilet column : line.columns) {
+                column->position = offset * column->position;
+                column->rectangle = offset * column->rectangle;
+            }
+        }
+    }
+
+    // Position the glyphs of the new lines.
+    hilet first_dirty_line = _lines.begin() + _dirty_line_index;
+    hilet last_dirty_line = first_dirty_line + num_dirty_lines;
+    bidi_algorithm(first_dirty_line, last_dirty_line, _text, _bidi_context);
+    for (auto& line : std::ranges::subrange(first_dirty_line, last_dirty_line)) {
+        line.layout(_alignment.horizontal(), rectangle.left(), rectangle.right(), sub_pixel_size.width());
+    }
+}
+
 [[nodiscard]] text_shaper::char_const_iterator text_shaper::get_it(size_t index) const noexcept
 {
     if (static_cast<ptrdiff_t>(index) < 0) {
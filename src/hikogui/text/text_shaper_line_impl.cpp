@@ -3,6 +3,7 @@
 // (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
 
 #include "text_shaper_line.hpp"
+#include "text_shaper_run_cache.hpp"
 #include "../unicode/module.hpp"
 #include "../macros.hpp"
 
@@ -60,10 +61,11 @@ static void advance_glyphs_run(
         run += (*it)->grapheme;
     }
 
-    auto result = font.shape_run(language, script, run);
-    result.scale(char_it->scale);
-    hi_axiom(result.grapheme_advances.size() == run.size());
-    hi_axiom(result.glyph_count.size() == run.size());
+    hilet result_ptr = text_shaper_run_cache_global.shape_run(font, char_it->scale, language, script, std::move(run));
+    hi_axiom_not_null(result_ptr);
+    hilet& result = *result_ptr;
+    hi_axiom(result.grapheme_advances.size() == narrow_cast<size_t>(std::distance(first, last)));
+    hi_axiom(result.glyph_count.size() == narrow_cast<size_t>(std::distance(first, last)));
 
     auto grapheme_index = 0_uz;
     auto glyph_index = 0_uz;
@@ -0,0 +1,120 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../font/module.hpp"
+#include "../unicode/module.hpp"
+#include "../i18n/module.hpp"
+#include "../container/module.hpp"
+#include "../concurrency/concurrency.hpp"
+#include "../telemetry/module.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <mutex>
+#include <memory>
+
+namespace hi::inline v1 {
+
+/** The key of a shaped run in the `text_shaper_run_cache`.
+ *
+ * The style of the text is not part of the key, as the only parts of the style
+ * that influence shaping are the font and size, which are already in the key.
+ */
+struct text_shaper_run_key {
+    hi::font const *font;
+    float scale;
+    iso_639 language;
+    iso_15924 script;
+    gstring run;
+
+    [[nodiscard]] std::size_t hash() const noexcept
+    {
+        hi_assert_not_null(font);
+        return hash_mix(reinterpret_cast<ptrdiff_t>(font), scale, language, script, run);
+    }
+
+    [[nodiscard]] friend bool operator==(text_shaper_run_key const&, text_shaper_run_key const&) noexcept = default;
+};
+
+} // namespace hi::inline v1
+
+template<>
+struct std::hash<hi::text_shaper_run_key> {
+    [[nodiscard]] std::size_t operator()(hi::text_shaper_run_key const& rhs) const noexcept
+    {
+        return rhs.hash();
+    }
+};
+
+namespace hi::inline v1 {
+
+/** A cache of shaped runs.
+ *
+ * Labels are re-shaped on every re-layout, shaping a run through the GSUB and
+ * kern tables of a font is expensive. This cache holds the result of
+ * `font::shape_run()` already scaled to the size of the text.
+ *
+ * The hit and miss rates are available through the global counters
+ * "text_shaper:run-cache:hit" and "text_shaper:run-cache:miss".
+ */
+class text_shaper_run_cache {
+public:
+    using result_type = font::shape_run_result_type;
+    using result_ptr = std::shared_ptr<result_type const>;
+
+    constexpr static std::size_t default_capacity = 4096;
+
+    explicit text_shaper_run_cache(std::size_t capacity = default_capacity) noexcept : _cache(capacity) {}
+
+    /** Shape a run, or retrieve the previous result from the cache.
+     *
+     * @param font The font to shape the run with.
+     * @param scale The scale to apply to the result.
+     * @param language The language of the run.
+     * @param script The script of the run.
+     * @param run The graphemes of the run.
+     * @return The shaped run, scaled by @a scale. The result is shared with the cache and
+     *         remains valid after it is evicted, so that a cache hit does not allocate.
+     * @throws std::bad_alloc When the cache could not allocate the new entry.
+     * @throws std::exception Any exception thrown by `font::shape_run()`, the
+     *         failed run is not added to the cache.
+     */
+    [[nodiscard]] result_ptr
+    shape_run(hi::font const& font, float scale, iso_639 language, iso_15924 script, gstring run)
+    {
+        auto key = text_shaper_run_key{&font, scale, language, script, std::move(run)};
+
+        hilet lock = std::scoped_lock(_mutex);
+        if (hilet ptr = _cache.find(key)) {
+            ++global_counter<"text_shaper:run-cache:hit">;
+            return *ptr;
+        }
+
+        ++global_counter<"text_shaper:run-cache:miss">;
+        auto r = font.shape_run(key.language, key.script, key.run);
+        r.scale(scale);
+        return _cache.emplace(std::move(key), std::make_shared<result_type const>(std::move(r)));
+    }
+
+    /** Remove all shaped runs from the cache.
+     *
+     * This should be called when fonts are unloaded.
+     */
+    void clear() noexcept
+    {
+        hilet lock = std::scoped_lock(_mutex);
+        _cache.clear();
+    }
+
+private:
+    mutable unfair_mutex _mutex;
+    lru_cache<text_shaper_run_key, result_ptr> _cache;
+};
+
+/** The global cache of shaped runs used by the text_shaper.
+ */
+inline auto text_shaper_run_cache_global = text_shaper_run_cache{};
+
+} // namespace hi::inline v1
@@ -0,0 +1,161 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "text_shaper_run_cache.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <stdexcept>
+
+using namespace hi;
+
+namespace {
+
+/** A font which gives each grapheme a single glyph with an advance of 1 em.
+ *
+ * It counts how often a run was actually shaped.
+ */
+class fake_font : public font {
+public:
+    mutable int num_shaped = 0;
+    bool throw_on_shape = false;
+
+    [[nodiscard]] bool loaded() const noexcept override
+    {
+        return true;
+    }
+
+    [[nodiscard]] graphic_path get_path(glyph_id) const override
+    {
+        return {};
+    }
+
+    [[nodiscard]] float get_advance(glyph_id) const override
+    {
+        return 1.0f;
+    }
+
+    [[nodiscard]] glyph_metrics get_metrics(glyph_id) const override
+    {
+        return {};
+    }
+
+    [[nodiscard]] shape_run_result_type shape_run(iso_639, iso_15924, gstring run) const override
+    {
+        if (throw_on_shape) {
+            throw std::runtime_error("shape_run failed");
+        }
+
+        ++num_shaped;
+
+        auto r = shape_run_result_type{};
+        r.reserve(run.size());
+        auto x = 0.0f;
+        for (auto i = 0_uz; i != run.size(); ++i) {
+            r.grapheme_advances.push_back(1.0f);
+            r.glyph_count.push_back(1);
+            r.glyphs.push_back(glyph_id{i + 1});
+            r.glyph_positions.push_back(point2{x, 0.0f});
+            r.glyph_bounding_rectangles.push_back(aarectangle{x, 0.0f, 1.0f, 1.0f});
+            x += 1.0f;
+        }
+        return r;
+    }
+};
+
+[[nodiscard]] uint64_t hits() noexcept
+{
+    return global_counter<"text_shaper:run-cache:hit">;
+}
+
+[[nodiscard]] uint64_t misses() noexcept
+{
+    return global_counter<"text_shaper:run-cache:miss">;
+}
+
+} // namespace
+
+TEST(text_shaper_run_cache, hit_and_miss)
+{
+    auto font = fake_font{};
+    auto cache = text_shaper_run_cache{};
+    hilet hits_before = hits();
+    hilet misses_before = misses();
+
+    hilet r1 = cache.shape_run(font, 2.0f, iso_639{}, iso_15924{}, to_gstring(std::string_view{"abc"}));
+    ASSERT_EQ(font.num_shaped, 1);
+    ASSERT_EQ(hits() - hits_before, 0);
+    ASSERT_EQ(misses() - misses_before, 1);
+    ASSERT_EQ(r1->grapheme_advances.size(), 3);
+    // The cached result is already scaled.
+    ASSERT_EQ(r1->grapheme_advances[0], 2.0f);
+    ASSERT_EQ(r1->glyph_positions[2], (point2{4.0f, 0.0f}));
+
+    hilet r2 = cache.shape_run(font, 2.0f, iso_639{}, iso_15924{}, to_gstring(std::string_view{"abc"}));
+    ASSERT_EQ(font.num_shaped, 1);
+    ASSERT_EQ(hits() - hits_before, 1);
+    ASSERT_EQ(misses() - misses_before, 1);
+    ASSERT_EQ(r2->grapheme_advances, r1->grapheme_advances);
+    ASSERT_EQ(r2->glyphs, r1->glyphs);
+    // A hit shares the cached result instead of copying it.
+    ASSERT_EQ(r2, r1);
+
+    // A different scale, run or font is a different key.
+    std::ignore = cache.shape_run(font, 3.0f, iso_639{}, iso_15924{}, to_gstring(std::string_view{"abc"}));
+    std::ignore = cache.shape_run(font, 2.0f, iso_639{}, iso_15924{}, to_gstring(std::string_view{"abd"}));
+    auto other_font = fake_font{};
+    std::ignore = cache.shape_run(other_font, 2.0f, iso_639{}, iso_15924{}, to_gstring(std::string_view{"abc"}));
+    ASSERT_EQ(font.num_shaped, 3);
+    ASSERT_EQ(other_font.num_shaped, 1);
+    ASSERT_EQ(hits() - hits_before, 1);
+    ASSERT_EQ(misses() - misses_before, 4);
+}
+
+TEST(text_shaper_run_cache, clear)
+{
+    auto font = fake_font{};
+    auto cache = text_shaper_run_cache{};
+
+    std::ignore = cache.shape_run(font, 1.0f, iso_639{}, iso_15924{}, to_gstring(std::string_view{"abc"}));
+    std::ignore = cache.shape_run(font, 1.0f, iso_639{}, iso_15924{}, to_gstring(std::string_view{"abc"}));
+    ASSERT_EQ(font.num_shaped, 1);
+
+    cache.clear();
+    hilet misses_before = misses();
+    std::ignore = cache.shape_run(font, 1.0f, iso_639{}, iso_15924{}, to_gstring(std::string_view{"abc"}));
+    ASSERT_EQ(font.num_shaped, 2);
+    ASSERT_EQ(misses() - misses_before, 1);
+}
+
+TEST(text_shaper_run_cache, capacity)
+{
+    auto font = fake_font{};
+    auto cache = text_shaper_run_cache{2};
+
+    std::ignore = cache.shape_run(font, 1.0f, iso_639{}, iso_15924{}, to_gstring(std::string_view{"a"}));
+    std::ignore = cache.shape_run(font, 1.0f, iso_639{}, iso_15924{}, to_gstring(std::string_view{"b"}));
+    std::ignore = cache.shape_run(font, 1.0f, iso_639{}, iso_15924{}, to_gstring(std::string_view{"c"}));
+    ASSERT_EQ(font.num_shaped, 3);
+
+    // "a" was the least recently used and was evicted.
+    std::ignore = cache.shape_run(font, 1.0f, iso_639{}, iso_15924{}, to_gstring(std::string_view{"c"}));
+    ASSERT_EQ(font.num_shaped, 3);
+    std::ignore = cache.shape_run(font, 1.0f, iso_639{}, iso_15924{}, to_gstring(std::string_view{"a"}));
+    ASSERT_EQ(font.num_shaped, 4);
+}
+
+TEST(text_shaper_run_cache, shape_throws)
+{
+    auto font = fake_font{};
+    auto cache = text_shaper_run_cache{};
+
+    font.throw_on_shape = true;
+    ASSERT_THROW(
+        std::ignore = cache.shape_run(font, 1.0f, iso_639{}, iso_15924{}, to_gstring(std::string_view{"abc"})),
+        std::runtime_error);
+
+    // The failed run was not cached.
+    font.throw_on_shape = false;
+    std::ignore = cache.shape_run(font, 1.0f, iso_639{}, iso_15924{}, to_gstring(std::string_view{"abc"}));
+    ASSERT_EQ(font.num_shaped, 1);
+}
@@ -0,0 +1,157 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "text_shaper.hpp"
+#include "../path/module.hpp"
+#include "../telemetry/module.hpp"
+#include "../concurrency/module.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <string>
+#include <limits>
+
+using namespace hi;
+
+class text_shaper_tests : public ::testing::Test {
+protected:
+    constexpr static auto rectangle = aarectangle{0.0f, 0.0f, 100.0f, 400.0f};
+    constexpr static auto baseline = 200.0f;
+    constexpr static auto sub_pixel_size = extent2{1.0f, 1.0f};
+    constexpr static auto alignment = hi::alignment{horizontal_alignment::left, vertical_alignment::top};
+
+    hi::text_style style;
+
+    static void SetUpTestSuite()
+    {
+        hi::start_system();
+
+        auto& fb = font_book::global();
+        for (auto const& path : get_paths(path_location::font_dirs)) {
+            fb.register_font_directory(path);
+        }
+    }
+
+    void SetUp() override
+    {
+        style = text_style{std::vector{text_sub_style{
+            phrasing_mask::all,
+            iso_639{},
+            iso_15924{},
+            font_book::global().find_family("Arial"),
+            font_variant{},
+            14.0f,
+            color::white(),
+            text_decoration::None}}};
+    }
+
+    [[nodiscard]] text_shaper make_shaper(std::string_view text) const noexcept
+    {
+        return text_shaper{font_book::global(), to_gstring(text), style, 1.0f, alignment, true};
+    }
+
+    /** Check that updating a text shaper results in the same text and lines as shaping the text from scratch.
+     */
+    void check_update(std::string_view before, std::string_view after) const
+    {
+        auto incremental = make_shaper(before);
+        incremental.layout(rectangle, baseline, sub_pixel_size);
+        // Fill the cache of folded paragraphs.
+        std::ignore = incremental.bounding_rectangle(std::numeric_limits<float>::infinity());
+        std::ignore = incremental.bounding_rectangle(rectangle.width());
+
+        hilet num_incremental = static_cast<uint64_t>(global_counter<"text_shaper:layout:incremental">);
+        incremental.update(font_book::global(), to_gstring(after), style, 1.0f, alignment, true);
+        incremental.layout(rectangle, baseline, sub_pixel_size);
+        ASSERT_EQ(global_counter<"text_shaper:layout:incremental"> - num_incremental, 1);
+
+        auto full = make_shaper(after);
+        full.layout(rectangle, baseline, sub_pixel_size);
+
+        ASSERT_EQ(incremental.text_direction(), full.text_direction());
+        ASSERT_EQ(
+            incremental.bounding_rectangle(std::numeric_limits<float>::infinity()),
+            full.bounding_rectangle(std::numeric_limits<float>::infinity()));
+        ASSERT_EQ(incremental.bounding_rectangle(rectangle.width()), full.bounding_rectangle(rectangle.width()));
+
+        ASSERT_EQ(incremental.size(), full.size());
+        for (auto i = 0_uz; i != full.size(); ++i) {
+            hilet& a = incremental.begin()[i];
+            hilet& b = full.begin()[i];
+            ASSERT_EQ(a.grapheme, b.grapheme) << "index=" << i;
+            ASSERT_EQ(a.script, b.script) << "index=" << i;
+            ASSERT_EQ(a.line_nr, b.line_nr) << "index=" << i;
+            ASSERT_EQ(a.column_nr, b.column_nr) << "index=" << i;
+            ASSERT_NEAR(a.position.x(), b.position.x(), 0.01f) << "index=" << i;
+            ASSERT_NEAR(a.position.y(), b.position.y(), 0.01f) << "index=" << i;
+        }
+
+        ASSERT_EQ(incremental.lines().size(), full.lines().size());
+        for (auto i = 0_uz; i != full.lines().size(); ++i) {
+            hilet& a = incremental.lines()[i];
+            hilet& b = full.lines()[i];
+            ASSERT_EQ(a.line_nr, b.line_nr) << "line=" << i;
+            ASSERT_EQ(a.first - incremental.cbegin(), b.first - full.cbegin()) << "line=" << i;
+            ASSERT_EQ(a.last - incremental.cbegin(), b.last - full.cbegin()) << "line=" << i;
+            ASSERT_EQ(a.columns.size(), b.columns.size()) << "line=" << i;
+            ASSERT_EQ(a.paragraph_direction, b.paragraph_direction) << "line=" << i;
+            ASSERT_NEAR(a.y, b.y, 0.01f) << "line=" << i;
+        }
+    }
+};
+
+TEST_F(text_shaper_tests, update_insert)
+{
+    check_update("Hello world.\nThe second paragraph.\nThird.", "Hello world.\nThe second nice paragraph.\nThird.");
+    check_update("Hello world.\nThe second paragraph.\nThird.", "XHello world.\nThe second paragraph.\nThird.");
+    check_update("Hello world.\nThe second paragraph.\nThird.", "Hello world.\nThe second paragraph.\nThird. Fourth.");
+    check_update("", "Hello");
+}
+
+TEST_F(text_shaper_tests, update_delete)
+{
+    check_update("Hello world.\nThe second nice paragraph.\nThird.", "Hello world.\nThe second paragraph.\nThird.");
+    check_update("Hello world.\nThe second paragraph.\nThird.", "ello world.\nThe second paragraph.\nThird.");
+    check_update("Hello world.\nThe second paragraph.\nThird.", "Hello world.\nThe second paragraph.\n");
+    check_update("Hello", "");
+}
+
+TEST_F(text_shaper_tests, update_split_paragraph)
+{
+    check_update("Hello world.\nThe second paragraph.\nThird.", "Hello world.\nThe second\nparagraph.\nThird.");
+    check_update("Hello world.\nThe second paragraph.\nThird.", "Hello world.\nThe second paragraph.\nThird.\n");
+    check_update("Hello world.", "\nHello world.");
+}
+
+TEST_F(text_shaper_tests, update_merge_paragraphs)
+{
+    check_update("Hello world.\nThe second paragraph.\nThird.", "Hello world.\nThe second paragraph.Third.");
+    check_update("Hello world.\nThe second paragraph.\nThird.", "Hello world.The second paragraph.\nThird.");
+    check_update("Hello world.\n\n\nThird.", "Hello world.\nThird.");
+}
+
+TEST_F(text_shaper_tests, update_text_direction)
+{
+    // The direction of the text is determined by the first paragraph.
+    check_update("\xd7\xa9\xd7\x9c\xd7\x95\xd7\x9d\nabc", "abc \xd7\xa9\xd7\x9c\xd7\x95\xd7\x9d\nabc");
+    check_update("abc\n\xd7\xa9\xd7\x9c\xd7\x95\xd7\x9d", "\xd7\xa9\xd7\x9c\xd7\x95\xd7\x9d");
+    check_update("123\nabc", "123\n\xd7\xa9\xd7\x9c\xd7\x95\xd7\x9d");
+    check_update("123\nabc", "\xd7\xa9\xd7\x9c\xd7\x95\xd7\x9d 123\nabc");
+}
+
+TEST_F(text_shaper_tests, bounding_rectangle_folds_modified_paragraphs)
+{
+    auto shaper = make_shaper("Hello world.\nThe second paragraph.\nThird.");
+    std::ignore = shaper.bounding_rectangle(rectangle.width());
+
+    hilet num_hits = static_cast<uint64_t>(global_counter<"text_shaper:fold:hit">);
+    hilet num_misses = static_cast<uint64_t>(global_counter<"text_shaper:fold:miss">);
+    hilet text = to_gstring(std::string_view{"Hello world.\nThe 2nd paragraph.\nThird."});
+    shaper.update(font_book::global(), text, style, 1.0f, alignment, true);
+    hilet r = shaper.bounding_rectangle(rectangle.width());
+
+    // Only the second paragraph is folded again.
+    ASSERT_EQ(global_counter<"text_shaper:fold:hit"> - num_hits, 2);
+    ASSERT_EQ(global_counter<"text_shaper:fold:miss"> - num_misses, 1);
+    ASSERT_EQ(r, make_shaper("Hello world.\nThe 2nd paragraph.\nThird.").bounding_rectangle(rectangle.width()));
+}
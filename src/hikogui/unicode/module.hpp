@@ -18,6 +18,7 @@
 #include "ucd_grapheme_cluster_breaks.hpp"
 #include "ucd_lexical_classes.hpp"
 #include "ucd_line_break_classes.hpp"
+#include "ucd_properties.hpp"
 #include "ucd_scripts.hpp"
 #include "ucd_sentence_break_properties.hpp"
 #include "ucd_word_break_properties.hpp"
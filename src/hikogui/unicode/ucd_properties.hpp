@@ -0,0 +1,2604 @@
+// This file was generated by generate_unicode_data.py
+
+#pragma once
+
+#include "ucd_bidi_classes.hpp"
+#include "ucd_bidi_paired_bracket_types.hpp"
+#include "ucd_east_asian_widths.hpp"
+#include "ucd_general_categories.hpp"
+#include "ucd_grapheme_cluster_breaks.hpp"
+#include "ucd_line_break_classes.hpp"
+#include "ucd_scripts.hpp"
+#include "ucd_sentence_break_properties.hpp"
+#include "ucd_word_break_properties.hpp"
+#include "../i18n/module.hpp"
+#include "../utility/utility.hpp"
+#include <cstdint>
+
+namespace hi {
+inline namespace v1 {
+namespace detail {
+
+constexpr auto ucd_properties_chunk_size = 128_uz;
+constexpr auto ucd_properties_index_width = 9_uz;
+constexpr auto ucd_properties_indices_size = 8704_uz;
+constexpr auto ucd_properties_record_index_width = 11_uz;
+
+constexpr auto ucd_properties_general_category_shift = 0;
+constexpr auto ucd_properties_general_category_mask = uint64_t{0x1f};
+
+constexpr auto ucd_properties_grapheme_cluster_break_shift = 5;
+constexpr auto ucd_properties_grapheme_cluster_break_mask = uint64_t{0xf};
+
+constexpr auto ucd_properties_line_break_class_shift = 9;
+constexpr auto ucd_properties_line_break_class_mask = uint64_t{0x3f};
+
+constexpr auto ucd_properties_word_break_property_shift = 15;
+constexpr auto ucd_properties_word_break_property_mask = uint64_t{0x1f};
+
+constexpr auto ucd_properties_sentence_break_property_shift = 20;
+constexpr auto ucd_properties_sentence_break_property_mask = uint64_t{0xf};
+
+constexpr auto ucd_properties_east_asian_width_shift = 24;
+constexpr auto ucd_properties_east_asian_width_mask = uint64_t{0x7};
+
+constexpr auto ucd_properties_bidi_class_shift = 27;
+constexpr auto ucd_properties_bidi_class_mask = uint64_t{0x1f};
+
+constexpr auto ucd_properties_bidi_paired_bracket_type_shift = 32;
+constexpr auto ucd_properties_bidi_paired_bracket_type_mask = uint64_t{0x3};
+
+constexpr auto ucd_properties_script_shift = 34;
+constexpr auto ucd_properties_script_mask = uint64_t{0x3ff};
+
+constexpr auto ucd_properties_canonical_combining_class_shift = 44;
+constexpr auto ucd_properties_canonical_combining_class_mask = uint64_t{0xff};
+
+constexpr auto ucd_properties_nfc_quick_check_shift = 52;
+constexpr auto ucd_properties_nfc_quick_check_mask = uint64_t{0x3};
+
+constexpr auto ucd_properties_nfd_quick_check_shift = 54;
+constexpr auto ucd_properties_nfd_quick_check_mask = uint64_t{0x1};
+
+static_assert(std::has_single_bit(ucd_properties_chunk_size));
+
+constexpr uint8_t ucd_properties_indices_bytes[9808] = {
+     0,  0, 64, 64, 48, 32, 20, 12,  7,  4,  2, 65, 64,176, 96, 52, 28, 15,  8,  4, 66, 65, 48,160, 84, 44, 23, 12,  6, 67, 65,176,
+   224,116, 60, 31, 16,  8, 68, 66, 49, 32,148, 76, 39, 20, 10, 69, 34,145, 80,172, 88, 45, 23, 11,198,  3, 17,144,204,104, 53, 27,
+    13,199,  3,145,208,236,120, 61, 31, 15,200,  4, 18, 17, 12,136, 69, 35, 17,201,  4,146, 81, 44,152, 77, 39, 19,137,229,  2,137,
+    72,166, 84, 42,149,138,229,130,201,104,182, 92, 46,151,139,230,  3,  9,136,198,100, 50,153, 76,166, 83, 41,148,202,101, 50,153,
+    76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,
+   202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 99, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,
+   166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,
+   101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166,
+    83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101,
+    50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83,
+    41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,
+   153, 76,166, 83, 41,148,202,101, 51,154, 13,  6,131, 65,160,208,104, 52, 26, 77, 70,163, 89,176,218,110, 55,156, 14, 39, 35,153,
+   208,234,118, 59,158, 15, 39,163,217,240,250,119, 60, 30, 79, 71,179,225,244,238,120, 60,158,143,103,195,233,220,240,121, 61, 30,
+   207,135,211,185,224,242,122, 61,159, 15,167,115,193,228,244,123, 62, 31, 78,231,131,201,232,246,124, 62,157,207,  7,147,209,236,
+   248,125, 59,158, 15, 39,163,217,240,250,119, 60, 30, 79, 71,179,225,244,238,120, 60,158,143,103,195,233,220,240,121, 61, 30,207,
+   135,211,185,224,242,126, 63,159,207,231,243,249,252,254,127, 63,159,207,231,243,249,252,254,127, 64, 32, 16,  8,  4,  2,  1,  0,
+   128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,
+     4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16, 40, 20, 18, 13,  8,133, 67, 33,144,232,132, 74, 41, 22,140,
+    70,163,145,233,  4,138, 73, 38,148, 74,165,146,233,132,202,101, 52,155, 78, 39, 83,201,245,  2,133, 68,163, 82, 41, 84,201, 21,
+    58,161, 82,170, 85,171, 21,170,229,122,193, 98,145, 89, 44,210, 43, 69,170,217,110,145, 92, 46, 87, 75,181,226,245,124,145, 95,
+   176, 24, 44, 36,139, 13,136,197, 99, 49,152,204,102, 51, 25,140,199,100, 49,153, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,202,101,178,217,108,182, 99, 53,156,203,103,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,104, 52, 26, 13, 22,146, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145,105,180,218,109, 54,163, 85,172,215, 72,164, 82, 41, 22,195,101,180,219,110, 55, 27,141,
+   198,227,113,184,220,110, 55, 27,141,198,227,113,184,220,110, 55, 27,141,198,227,113,184,220,110, 55, 27,141,198,227,113,184,220,
+   110, 55, 27,141,198,227,113,184,220,110, 55, 27,141,198,227,113,184,221,110, 55, 27,141,198,227,113,188,222,111, 55,220,  9, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,225,113, 56,220,142, 87, 43,153, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145,115,186, 18, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,210,234,117,187, 29,174,231,123,193,226,145,121, 60,222,
+   143, 87,179,221,240,249,125, 62,159, 79,167,219,241, 34,145, 72,164, 82, 41, 20,138, 69,250,145,127, 63,224,  9, 20,140,  5, 34,
+   145, 72,192,146, 41, 20,138, 69, 35,  3,130, 65, 96,201, 20,138, 69, 34,145,131,194, 33, 41, 24, 84, 45, 34,145,134, 67, 97,208,
+   248,132, 70, 37, 19,138, 69, 98,209,120,196,102, 53, 27,142, 71, 99,209,249,  4,134, 69, 35,136,196, 98, 49, 24,140, 70, 35, 36,
+    50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83,
+    41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,
+   153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,
+   148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153,
+    76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,
+   202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,
+   166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,
+   101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166,
+    83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101,
+    50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83,
+    41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,
+   153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 44,148,202,101, 50,153, 76,166, 83, 41,
+   148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,150, 76,101,147,153,
+    76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,
+   202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 44,160,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,
+   166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,
+   101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,203, 41,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,
+   169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42, 64,160, 80, 40, 25, 92,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 44,
+    50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83,
+    41,148,202,101, 50,153, 76,166, 83, 41,150, 90,101, 50,153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,202,101, 50,
+   153, 76,166, 83, 41,148,202,101, 50,153, 76,166, 83, 41,148,203, 46,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,
+   170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,
+   165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170,
+    85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165,
+    82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85,
+    42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,
+   169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,
+   149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169,
+    84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149,
+    74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,
+   170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,
+   165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170,
+    85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165,
+    82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85,
+    42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,
+   169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 42,149, 74,165, 82,169, 84,170, 85, 44,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+   151,204, 38, 51, 41,132,194, 97, 48,152, 76, 38, 19,  9,132,194, 97, 48,152, 76, 38, 19,  9,132,194, 97, 48,152, 76, 38, 19,  9,
+   132,194, 97, 48, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,
+   138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,
+   164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138,
+    69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164,
+    82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69,
+    34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82,
+    41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,
+   145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41,
+    20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145, 72,164, 82, 41, 20,138, 69, 34,145,
+    64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,
+     2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64,
+    32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,
+     1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32,
+    16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,
+     0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,
+     8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,
+   128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,
+     4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128,
+    64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,
+     2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64,
+    32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,
+     1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32,
+    16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,
+     0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,
+     8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,
+   128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,
+     4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  1, 51,
+    64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,
+     2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64,
+    32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,
+     1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32,
+    16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,
+     0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,
+     8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,
+   128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,
+     4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128,
+    64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,
+     2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64,
+    32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,
+     1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32,
+    16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,
+     0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,
+     8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,
+   128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,
+     4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  0,128, 64, 32, 16,  8,  4,  2,  1,  1, 51,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+constexpr uint8_t ucd_properties_record_indices_bytes[54224] = {
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4,  1,  0, 48,  8,  1, 64,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0, 12,  1,128, 48,  7,  1,  0, 36,  5,  0,176, 24,  3, 64,112, 15,  2,  0, 68,  7,  1, 32, 38,  5,  0,
+   168, 22,  2,224, 92, 11,129,112, 46,  5,192,184, 23,  2,224, 92, 12,  1,144, 52,  6,128,208,  9,  1,192,108, 13,129,176, 54,  6,
+   192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,  0, 56,
+     4, 64,232, 30,  3,160,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240,
+    62,  7,192,248, 31,  3,224,124, 15,129,  0, 64,  8, 64,208,  0,  0,  0,  0,  0,  0,  0,  0,  8,128,  0,  0,  0,  0,  0,  0,  0,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  4, 96,144, 18,
+   128,192, 76,  3,  1, 56, 40,  5, 32,168, 21,130,192, 52, 11, 65,112, 29,  5,224,192, 24,131, 16,100, 12,193, 64, 52,  5, 32,196,
+    21,131, 80,108, 13,129,176, 36,  6,224,220, 27,131,112,110, 13,193,192, 55,  6,224,220, 27,131,112,110, 13,193,184, 55,  7,  0,
+   220, 27,131,112,110, 13,193,184, 57,  7,  0,220, 27,131,112,110, 13,193,192, 58,  7, 96,236, 30,  3,192,120, 15,  1,208, 60,  7,
+    96,236, 29,131,192,118, 14,193,224, 60,  7, 64,240, 29,131,176,120, 15,  1,224, 57,  7, 64,236, 29,131,192,118, 15,  1,208, 60,
+     6,224,236, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  7,160,232, 27,131,176,110, 15,  1,184,
+    60,  6,224,240, 27,131,176,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,192, 58,  6,224,240, 27,131,176,110, 15,  1,
+   184, 60,  6,224,232, 28,  3,160,110, 15,  1,184, 60,  7, 64,220, 30,  3,112,120, 13,193,224, 56,  7, 64,224, 29,  3,112,118, 13,
+   193,224, 55,  7, 96,232, 28,  3,160,110, 14,193,184, 60,  6,224,240, 28,  3,160,110, 15,  1,184, 60,  6,224,240, 27,131,192,110,
+    15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,192, 58,  6,224,240, 27,131,176,110, 15,  1,184, 60,  6,224,240, 27,131,192,
+   110, 15,  1,184, 60,  6,224,220, 30,  3,112,120, 13,193,224, 62,  7,192,244, 30,131,224,122, 15,129,232, 61,  7,192,244, 30,131,
+   208,124, 15,129,232, 61,  7,160,244, 31,  3,208,122, 15,129,232, 61,  7,160,248, 31,  3,224,122, 15, 65,240, 61,  6,224,240, 30,
+   131,224,122, 15,129,232, 61,  7,192,244, 31,  3,224,122, 15,129,232, 55,  7,128,244, 30,131,208,124, 15, 65,240, 61,  7,160,248,
+    31,  3,240,122, 15,129,240, 62,  7,224,252, 31,131,240,122, 16,  1,240, 61,  8,  0,248, 30,132,  0,124, 13,193,216, 55,  7, 96,
+   220, 29,131,112,118, 13,193,216, 55,  7, 96,220, 29,131,112,118, 15,129,184, 60,  6,224,240, 27,131,192,122, 15,129,184, 60,  6,
+   224,240, 27,131,192,110, 15,  1,184, 60,  7,128,244, 32,  3,224,110, 15,  1,232, 61,  6,224,240, 27,131,192,110, 15,  1,184, 60,
+     6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184,
+    60,  6,224,240, 27,131,192,122, 15,129,184, 60,  7,160,248, 30,131,224,122, 15,129,184, 60,  6,224,240, 27,131,192,110, 15,  1,
+   184, 60,  6,224,240, 27,131,192,124, 15,129,240, 62,  7,192,248, 30,131,208,124, 15, 65,232, 62,  7,192,244, 31,  3,208,122, 15,
+    65,232, 62,  7,160,248, 30,131,224,122, 15,129,232, 62,  7,192,232, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124,
+    15,129,240, 62,  7,192,232, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,
+   124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,
+   224,124, 15,129,240, 62,  7,192,248, 31,  3,224,126, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,
+     3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  8,
+    33,  4, 48,134, 16,194, 24, 67,  8,129, 16, 34,132, 80,140, 17, 66, 16, 71,  9,  1, 28, 35,132,112,144, 17,194, 16, 66,  9, 33,
+    12, 34,132, 80,138, 17, 66, 40, 69,  5, 32,164, 20,130,144,148, 10, 66, 40, 75,  8, 33,  4, 32,132, 16,130, 17, 66, 40, 69,  8,
+   161, 20, 38,  4,192,132, 17, 66, 24, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,
+     9,161, 52, 38,132,208,154, 19,130,104, 77,  9,161, 52, 38,132,208,154, 19,130,112, 77,  9,193, 52, 39,  4,208,154, 19,194,128,
+    80, 10,  1, 64, 39,133, 16,160, 20,  2,128, 80, 10,  1, 72, 41,  5, 48,166, 20,194,152, 84, 10,129, 64, 40,  5,  0,160, 20,194,
+   152, 80, 10, 97, 76, 40,  5,  0,170, 21, 66,168, 85, 10,193, 64, 40,  5,  0,160, 19,130,112, 78, 10,225, 92, 38,133,112,174, 22,
+     2,112, 80, 10,  1, 64, 39,  4,224,156, 20,  2,128, 89,  9,193, 56, 39,  5,  0,160, 20,  2,128, 78,  9,225, 64, 40,  4,224,180,
+    22,194,216, 90, 11, 97,108, 45,  4,224,156, 19,130,112, 78,  9,193, 56, 39,  4,224,156, 19,130,112, 78, 11,129,116, 46,  5,208,
+   188, 23,194,224, 93, 12,  1,128, 48,133,208,186, 23, 67, 16, 92, 12,  1,128, 48,  6,  0,190, 24,195, 32,101, 12,129,144, 50,  6,
+     0,200, 24,  3, 32,100, 12,193,156, 51,134,112,206, 25,195, 56,103, 12,225,156, 51,134,112,206, 25,195, 56,103, 12,225,156, 48,
+     6,112,206, 25,195, 56,103, 12,225,156, 50,  6, 64,204, 25,131, 48,102, 12,193,160, 52,  6,128,208, 26,  3, 64,104, 13,  1,160,
+    52,  6,128,208, 26,  3, 64,104, 13,  1,160, 46,134,128,208, 26,  3, 64,104, 13,  1,160, 51,  6, 96,204, 25,131, 48, 92, 11,161,
+   116, 46,  6, 64,200, 23, 66,232, 93, 11,129,116, 46,  5,208,184, 23, 66,224, 93, 11,129,116, 52,134,160,210, 26,131, 72,106, 13,
+    33,168, 52,134,160,210, 26,131, 72,106, 11,161,116, 46,133,208,184, 23, 67, 88, 92, 11,161,112, 46,  5,208,186, 23,  2,224, 92,
+    13,129,180, 55,  6,192,220, 27,131,112,108, 13,193,184, 55,  6,224,216, 27,  3, 96,110, 13,225,188, 55,134,240,222, 27,195,120,
+   111, 13,225,180, 55,134,240,222, 27,195,120,111, 13,225,188, 55,134,240,222, 27,195,120,111, 13,225,188, 55,134,240,222, 27,195,
+   120,111, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,196, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,
+     3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14, 65,196, 57,135, 32,230, 28,195,152,114, 14, 97,204, 57,135, 48,228,
+    28,131,144,115, 13,193,204, 55,  7, 48,220, 28,195,112,115, 13,193,204, 55,  7, 48,220, 28,195,112,115, 13,193,204, 55,  7, 48,
+   220, 28,195, 96,114, 13,193,204, 55,  7, 48,220, 28,195,112,115, 13,193,204, 58,  7, 80,234, 29,131,176,117, 14,225,220, 55,  7,
+    48,220, 28,195,112,115, 13,193,204, 55,  7, 48,220, 28,195,112,115, 13,193,204, 55,  7, 48,220, 28,195,112,115, 13,193,204, 55,
+     7, 48,220, 28,195,112,115, 13,193,204, 55,  7, 48,220, 28,195,112,115, 13,193,204, 55,  7, 48,220, 28,195,112,115, 13,193,204,
+    55,  7, 48,220, 28,195,112,115, 13,193,176, 57,  6,224,230, 27,131,152,110, 14, 97,184, 57,134,224,230, 27,131,152,115, 13,129,
+   200, 54,  7, 32,220, 28,195, 96,114, 13,193,204, 54,  7, 32,216, 28,131, 96,114, 13,193,204, 54,  7, 32,216, 28,131, 96,114, 13,
+   193,204, 54,  7, 32,216, 28,131, 96,114, 13,129,200, 54,  7, 32,216, 28,131,112,115, 13,129,200, 55,  7, 48,220, 28,195,112,115,
+    13,193,204, 55,  7, 48,220, 28,195,112,115, 13,193,204, 55,  7, 48,220, 28,195,112,115, 13,193,204, 55,  7, 48,220, 28,195,112,
+   115, 13,193,204, 55,  7, 48,220, 28,195,112,115, 13,193,204, 55,  7, 48,220, 28,195,112,115, 13,193,204, 55,  7, 48,220, 28,195,
+   112,115, 12,  1,224, 60,  7,128,240, 30,  3,192,120, 15,  1,224, 60,  7,128,240, 30,  3,192,120, 15,  1,224, 60,  7,128,240, 30,
+     3,192,120, 15,  1,224, 60,  7,128,240, 30,  3,192,120, 15,  1,224, 60,  7,128,240, 30,  3,192, 96, 12,  1,228, 61,  7,160,244,
+    30,195,208,124, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,
+   250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,244, 62,135,208,250, 31, 67,232,125, 15,161,248, 63,134,
+     0,192, 32,  4,  0,129, 12,  2,  8, 65,136, 49,  6, 32,196, 16,131, 16, 98, 12, 66,  8, 33,  6, 32,196, 24,131, 16, 98, 12, 65,
+     8, 33,  4, 32,132, 16,130, 16, 98, 12, 65,  8, 49,  6, 33,  4, 40,131, 16,194, 28, 68,  8,145, 20, 34,196, 96,141, 17,194, 60,
+    71,137,  1, 34, 36,132,152,148, 18,162, 88, 75,137, 81,  6, 32,132,192,142, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 19, 34,
+   100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19,
+    34,100, 76,134,  0,192, 24,  3,  0,153, 19, 34,100, 76,137,161, 54, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+    19,130,112, 78,  9,193, 56, 39, 68,240,158, 19,226,128, 80, 10, 17, 68, 40,197, 32,164, 20,162,148, 82,138, 81, 74, 41, 69, 40,
+   165, 20,194,156, 84, 10,145, 84, 42,197, 88,172, 21,162,180, 87, 10,225, 92, 43,133,112,173, 21,162,180, 86,138,209, 90, 43, 69,
+   104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,226,180, 86,138,209, 90, 43,
+    69,104,173, 21,162,180, 86,139,  1, 98, 44,133,152,180, 22,162,216, 91,139,129,112, 46, 69,208,165, 20,162,148, 82,138, 81,116,
+    41, 69, 40,186, 23, 98,236, 93,139,177,118, 46,197,216,187, 23, 98,236, 80, 11,193,122, 47,133,104,173, 23,226,180, 86,138,209,
+    90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,
+   209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,
+   138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180,
+    86,138,209, 90, 43, 69,104,173, 21,194,180, 87, 10,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,
+   180, 86,138,225, 86, 43, 69, 40,165, 20,162,148, 82,138, 81, 74, 39, 69, 32,165, 20,162,148, 82,139,161, 74, 48,  6,  0,165, 20,
+   162,144, 93, 10, 81, 74, 46,133,104,173, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 35,  4, 86,138,209, 90, 48,134, 16,173,
+    24, 99, 12, 97,140, 65,136, 49,  6, 32,196, 24,131, 16, 98, 12, 65,136, 49,  3,  0,197, 24,195, 28, 99, 12, 97,140, 49,134, 48,
+   198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134,
+    48,198, 25,  3, 36,100, 12,129,146, 50,  6, 64,201, 25, 35, 36,100, 12,145,146, 50,  6, 72,200, 25,  3, 32,100,140,129,146, 50,
+     6, 72,200, 25, 35, 32,100,  6,  0,192, 49,134, 48,198, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90,
+    43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209,
+    90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,
+   161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101,
+    12,161,148, 50,134, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 40, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102,140,209,154, 51, 70,104,205, 25,163,
+    52,102,140,209,154, 51, 70,104,205, 25,163, 52,102,140,209,154, 51, 70,104,205, 25,163, 52,102,140,209,154, 51, 70,104,205, 25,
+   163, 52,102,140,225,156, 51,134,112,206, 25,195, 56,103,140,225,160, 52,  6,136,210, 26, 99, 80,104,  6,  0,192, 51,198,168,213,
+    26,195, 88,107, 13, 97,172, 53,134,176,214, 26,195, 88,107, 13, 97,172, 53,134,176,214, 26,195, 88,107, 13, 97,172, 53,134,184,
+   215, 26,227, 92,108, 13,113,174, 53,198,184,215, 26,227, 92,107,141,113,176, 53,198,184,215, 27,  3, 92,107,141,113,174, 53,195,
+     0, 96, 27, 35,100,108,141,145,178, 54, 70,200,218, 27, 35,104,108,141,145,178, 54,134,208, 96, 27, 99,108,109,141,177,182, 54,
+   198,216,219, 27, 99,108,109,141,177,182, 54,198,216,219, 27, 99,108,109,141,177,182, 54,198,216,219, 27, 99,112,110, 13,192,192,
+    24,  6,232, 96, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99,  6,  0,192, 24,  3,  0, 96, 21,162,180, 86,138,209,
+    90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 27,194,180, 86,138,
+   209, 90, 43, 69,104, 96, 19,130,112, 48,  6,  0,192, 24,  3,  0, 96, 20,162,232, 93, 11,161, 74, 41, 69, 40,165, 21,162,180, 86,
+   138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180,
+    86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,163,  0, 82,138, 81, 74, 41, 69, 40,186, 23, 66,
+   232, 93, 11,161, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 78,139,161, 74, 41, 69,208,165, 20,
+   162,232, 82,138, 81, 74, 46,133,208,186, 27,227,128,112,138, 81, 74, 41, 69,208,165, 20,162,232, 93, 10, 81, 74, 41, 69, 40,165,
+    28, 67,136,113, 14, 49,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,
+   228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,148,114, 14, 65,200, 57,  7,
+    32,228, 28,131,148,114, 14, 65,202, 57,  7, 32,228, 28,131,144,113, 14, 49,204, 57,  7, 24,227, 28, 99,136,113, 14, 33,196, 56,
+   135, 16,226, 28, 67,140,113,142, 49,198, 57,199, 24,227, 28,129,216,116,  7, 96,236, 56,135, 16,226, 29, 35,164,116,142,145,210,
+    58, 71, 72,233, 28,131,144,113, 14, 33,212, 58,135, 88,235, 29, 99,172,117,142,177,214, 58,199, 88,235, 29,131,180,114, 14, 65,
+   200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 29,195,188,120, 15,  0,192, 59,135,112,238, 29,195,184,119, 14,
+   225,220, 24,  3,  0,238, 29,193,128, 48, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119,
+    14,225,220, 59,135,112,238, 29,193,128,119, 14,225,220, 59,135,112,238, 29,193,128,119,  6,  0,192, 24,  7,112,238, 29,195,184,
+    48,  6,  1,226, 59,135,144,240, 30,  3,188,119,142,241,222, 24,  3,  0,240, 30,  1,128, 48, 15, 49,230, 61,  7,112, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0,242, 12,  1,128, 48,  6,  1,234, 61, 67,  0,245, 29,195,184,119,142,240,192, 24,  7,176,246, 30,
+   195,216,123, 15, 97,236, 61,135,176,246, 29,195,184,123,143,113,240, 62,  7,192,248, 31,  3,228,125, 15,177,220, 63,  7,232, 96,
+    12,  3,248,127, 15,240,192, 64,  8,  1,  0, 32,  4,  0,128,  6,  0,192, 24,  3,  1,  0, 32,  1,128, 48, 16,  2,  0, 64,  8,  1,
+     0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  1,128,128, 16,  2,  0, 64,  8,
+     1,  0, 32,  1,128,128, 16, 16,192, 64,  8,  8, 96, 32,  4,  0, 48,  6,  2,  4, 24,  7,248,255, 31,227,248,127,  6,  0,192, 24,
+     3,  0,254, 31,193,128, 48, 15,225,252, 64,195,  0, 96, 12,  3,248, 48,  6,  0,192, 24,  3,  0, 96, 12,  4,  4,128,144, 18,  0,
+    24,  8,  8, 96, 12,  1,128, 48,  6,  0,192, 24,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 31,195,248,128, 16,  2,
+     0, 63,136, 40, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  4, 24,131, 16,112,192, 66,  8, 65,  8, 33,  4, 32,132, 16,
+   130, 16, 66,  3,  1,  8, 33,  4, 32, 48, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132,
+    16,130, 16, 66,  8, 65,  8, 33,  1,128,132, 16,130, 16, 66,  8, 65,  8, 33,  1,128,132, 16,128,192, 66,  8, 65,  8, 33,  4, 32,
+    48,  6,  2, 18, 66,  8, 57,  7, 32,228, 24,131, 16, 98, 12, 65,131,  1,  6, 32,196, 28, 48, 16,114, 14, 66,131,  0, 96, 33,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 33,  4, 32,131, 16, 96,192, 24,  8, 89, 11, 33,
+   100, 44,133,144,178, 22, 66,200, 89, 11, 33,132, 52, 48,  6,  0,192, 24,  3,  0, 96, 12,  4, 32,131, 16, 98, 12, 65,136, 49,  6,
+    12,  4, 56,135,144,240,192, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 24,  3,  1, 16, 34,  1,128, 48, 17,  2, 32, 68,  8,129,
+    16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  4, 64,136, 17,  2, 32, 68,  8,129, 16, 34,  1,128,136, 17,  2, 32, 68,  8,
+   129, 16, 34,  1,128,136, 17,  0,192, 68,  8,129, 16, 34,  4, 64, 48,  6,  2, 34, 68,  8,145, 14, 33,228, 56,135, 16,226, 28, 24,
+     3,  1, 15, 34, 97,128, 48, 17, 50, 38, 69,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 67,136,169, 18, 12,  1,128, 48,  6,  2, 44,
+    69,131,  1, 16, 34,  4, 64,135, 16,224,192, 24,  8,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 35,  4, 64,140,145,146,
+    50, 70, 72,201, 25, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,141, 17,176,192, 70,200,217, 27, 35,100,108,141,134,
+     0,192, 24,  8,217, 27, 35, 97,128,141,145,178, 56, 70,195,  0, 96, 12,  4,108,141,134,  2, 54, 24,  8,217, 27, 12,  1,128, 48,
+    17,178, 54, 24,  3,  0, 96, 35,100,108,141,134,  0,192, 24,  8,217, 27, 35,100,108,141,145,178, 54, 70,200,217, 27, 35,100,108,
+    48,  6,  0,192, 24,  8,233, 30, 35, 68,120,143,  6,  0,192, 24,  8,241, 30, 35,193,128,143,145,242, 62, 72,  3,  0, 96, 35, 97,
+   128, 48,  6,  0,192, 24,  3,  1, 29, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  9,  9, 33, 36,
+    36,132,144,146, 18, 66, 72, 73,  9, 33, 36, 68,136,145, 18, 50, 70, 72,201, 25, 35, 36,100,144,145,134,  0,192, 24,  3,  0, 96,
+    36,164,152,147, 18, 98, 74, 73,201, 57, 39, 36,228,156,147,146,114, 78, 24,  9, 57, 39, 36,225,128,147,146,114, 78, 73,201, 57,
+    39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,225,128,147,146,114, 78, 73,201,
+    57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156, 48,  6,  2, 80, 73,201, 41, 37, 36,164,152,147, 18, 98, 76, 24,
+     9, 41, 37, 37, 33,128,146,146, 82, 74, 74,131,  0, 96, 12,  1,128, 48,  6,  0,192, 74,201, 96, 96, 36,228,156,147,134,  0,192,
+    73,195,  0, 96, 36,228,156,146,146, 80,192, 24,  9,105, 45, 37,164,180,150,146,210, 90, 75, 73,105, 45, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  1, 46, 37,228,188,151,146,242, 94, 75,201,121, 48, 38, 36,200,153,147, 50,104, 76, 73,137, 49, 38, 36,196,152,147,
+    18, 98, 24,  9,137, 49, 38, 33,128,152,147, 18, 98, 76, 73,137, 49, 38, 36,196,152,147, 18, 98, 76, 73,137, 49, 38, 36,196,152,
+   147, 18, 98, 76, 73,137, 49, 38, 33,128,152,147, 18, 98, 76, 73,137, 49, 38, 36,196,152,147, 16,192, 76, 73,137, 49, 38, 36,196,
+    48,  6,  2,106, 76, 73,153, 54, 38,228,204,156, 19, 50,102, 24,  9,177, 55, 38,225,128,155,147,114,100, 78, 67,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 78,  9,192, 96, 12,  1,128, 48,  6,  0,192, 76, 73,136, 96, 38, 36,196,153, 19, 32,192, 24,  9,209, 58, 39,
+    68,232,157, 19,162,116, 78,137,209, 58, 12,  4,196,152,147, 48,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+    39,100,236,158, 19,194,122, 79, 73,233, 61, 39,164,244,158,147,210,122, 24,  9,233, 61, 39,161,128,158,147,210,122, 79, 73,233,
+    61, 39,164,244,158,147,210,122, 79, 73,233, 61, 39,164,244,158,147,210,122, 79, 73,233, 61, 39,164,244,158,147,210,122, 79, 73,
+   233, 61, 39,164,244,158,147,210,122, 79, 73,233, 61, 39,164,244,158,147,226,124, 79, 73,249, 60, 39,132,236,157,147,178,118, 24,
+     9,225, 60, 39,129,128,160, 20,  2,128, 79,138,  9, 66, 12,  1,128, 48,  6,  2,122, 79, 73,233, 63, 40,101, 12,161,148, 50,134,
+    80,202, 25, 61, 39,164,244,157,147,176,192, 24, 10, 33, 68, 40,133, 16,162, 20, 66,136, 81, 10, 33, 68, 40,101, 12,161,148, 50,
+   134, 80,202, 25, 67, 40,101, 20,158,147,210,122, 79, 73,233, 61, 12,  5, 24,163,148,112,192, 82, 10, 65, 72, 41,  5, 32,164, 20,
+   130,144, 82, 10, 65, 72, 41,  5, 32,164, 20,130,144, 82, 10, 64, 96, 12,  1,128,164, 20,130,144, 82, 10, 65, 72, 41,  5, 32,164,
+    20,130,144, 82, 10, 65, 72, 41,  5, 32,164, 20,130,144, 82, 10, 65, 72, 41,  5, 32, 48, 20,130,144, 82, 10, 65, 72, 41,  5, 32,
+   164, 20,128,192, 82,  3,  0, 96, 41,  5, 32,164, 20,130,144, 82, 10, 64, 96, 12,  1,128,164,134,  0,192, 24,  3,  1, 74, 40,229,
+    28,163, 20, 98,140, 24, 10, 48, 96, 40,229, 28,165,148,114,150, 82,202, 89, 74, 12,  1,128, 48,  6,  0,192, 24, 10, 97, 76, 41,
+   133, 48,166, 20,194,152, 83, 10, 97, 76, 12,  1,128,163,148,114,154, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+    12,  5, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113,
+    78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,113, 78, 41,197, 56,167, 20,226,156, 83,138,
+   113, 78, 41,197, 60,167, 21,  2,158, 83,202,121, 79, 42, 37, 68,169,  6,  0,192, 24,  3,  1, 83, 41,197, 56,167, 20,226,156, 83,
+   138,161, 79, 42,165, 84,170,149, 82,158, 83,202,121, 86, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,172, 21,128,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  5,100,172,134,  2,178, 24, 10,201, 89, 43, 37,100,172,134,
+     2,178, 86, 74,201, 89, 43, 37,100,172,149,146,178, 86, 74,201, 89, 43, 37,100,172,149,146,178, 86, 74,201, 89, 43, 37,100,172,
+   149,144,192, 86, 67,  1, 89, 43, 37,100,172,149,146,178, 86, 74,201, 89, 43, 37,104,172,149,178,180, 86,138,209, 90, 43,133,112,
+   174,149,162,180, 86, 67,  0, 96, 43, 37,100,172,149,146,178, 24, 10,240, 96, 43,229,124,175,149,242,180, 86,138,208, 96, 44,  5,
+   128,176, 22,  2,192, 88, 11,  1, 96, 44,  5,128, 48,  6,  2,178, 86, 74,201, 89, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+    44, 37,136,177, 22, 34,198, 89, 11, 25, 99, 44,165,140,177,150, 98,202, 89,203, 57,103, 44,229,156,178,150,130,206, 90, 11, 65,
+   104, 45, 37,164,180, 22,130,208, 90, 11, 65,104, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181,150,178,214, 90,203,
+    89,107, 45,101,172,181,150,178,216, 90, 75, 65,105, 45,  5,180,183, 22,242,220, 91,203,129,112, 44, 37,132,176,151, 18,194, 88,
+    75,  9, 97, 12,  5,132,176,150, 18,194, 92, 75,  9, 97, 44, 37,132,184,150, 18,194, 88, 75,  9,113, 44, 37,132,176,150, 18,226,
+    88, 75,  9, 97, 44, 37,132,176,150, 18,194, 88, 75,  9, 97, 44, 37,196,176,150, 18,194, 24,  3,  0, 96, 12,  5,200,185,151, 66,
+   234, 93, 11,161,118, 46,133,216,185,151, 50,230, 92,203,177,119, 46,101,208,188, 23,130,242, 89,139,193,120, 44, 37,132,176,150,
+    18,194, 93,139,177,118, 46,197,216,187, 23, 66,236, 93,139,177,118, 12,  5,216,187, 23, 98,236, 93, 11,177,118, 46,197,216,186,
+    23, 98,236, 93,139,177,116, 46,197,216,187, 23, 98,232, 93,139,177,118, 46,197,216,187, 23, 98,236, 93,139,177,118, 46,197,208,
+   187, 23, 98,236, 24, 11, 97,108, 45,  5,160,180, 22,130,208, 90, 11, 73,104, 45,  5,160,180, 22,130,208, 24, 11, 65,104, 44,101,
+   140,179, 22, 50,200, 94,139,209,122, 47, 69,148,178,134,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+    47,101,236,189,151,178,246, 94,203,217,123, 47,101,236,189,151,178,246, 94,203,217,123, 47,101,236,189,151,178,246, 94,203,217,
+   123, 47,101,236,189,151,178,246, 94,203,217,123, 47,101,236,189,151,178,246, 94,203,225,123, 47,101,236,189,151,210,250, 95,139,
+   249,126, 47,198,  0,191, 23,226,252, 95,139,241,129, 47,166,  8,193, 24,  3,  0, 95,139,241,123, 48,102, 12,193,152, 51,  6, 96,
+   204, 25,131, 48,102, 12,194, 24, 67, 10, 97, 76, 41,133, 47,101,236,189,151,178,246, 94,204,  1,128, 47,197,248,189,151,178,246,
+    94,203,241,126, 47,197,236,190,151,210,250, 94,203,217,125, 47,165,244,190,151,210,250, 95, 75,217,123, 47,101,248,191, 23,226,
+   252, 94,203,217,123, 47,101,236,189,151,178,246, 94,203,217,123, 47,101,236,191, 23,211,  0, 95,139,241,125, 47,165,244,190,151,
+   210,250, 97,139,217,125, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,190,151,210,250, 95,140, 57,135, 49,  6, 32,196,
+    24,131, 16, 98, 12, 65,136, 49,  6, 32,196, 24,131, 16, 98, 12, 65,136, 49,  6, 32,196, 24,131, 16, 98, 12, 65,136, 49,  6, 32,
+   196, 24,131, 16, 98, 12, 65,136, 49,  6, 32,196, 24,131, 16, 98,  3,  1,136, 12,  1,128, 48,  6,  0,192, 98,  3,  0, 96, 49, 38,
+    36,196,152,147, 18, 98, 76, 73,137, 49, 38, 36,196,152,147, 18, 98, 76, 73,137, 49, 38, 36,196,152,147, 18, 98, 76, 73,137, 49,
+    38, 36,196,152,147, 18, 98, 76, 73,137, 49, 38, 36,196,152,147, 18, 98, 76, 73,137, 49, 38, 36,196,152,163, 22, 98, 76, 73,137,
+    49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,
+   140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12,
+    97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99,
+    12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24,
+    99, 12, 97,140, 49,166, 56,199, 24,227, 28, 99,140,113,142, 49,198, 56,199, 24,227, 28, 99,140,113,142, 49,198, 56,199, 24,227,
+    28, 99,140,105,141, 49,166, 52,198,152,211, 26, 99, 76,105,141, 49,166, 52,198,152,211, 26, 99, 76,105,141, 49,166, 52,198,152,
+   211, 26, 99, 76,105,141, 49,166, 52,198,152,211, 26, 99, 76,105,141, 49,166, 52,198,152,211, 26, 99, 76,105,141, 49,166, 52,198,
+   152,211, 26, 99, 76,105,141, 49,230, 60,199,152,243, 30, 99,204,121,143, 49,230, 60,199,152,243, 30, 99,204,121,143, 49,230, 60,
+   199,152,243, 30, 99,204,121,143, 49,230, 60,199,153,  3, 32,100, 12,129,144, 50,  6, 64,200, 25,  3, 32,100, 12,129,144, 50,  6,
+    64,200, 25,  3, 32,100, 12,129,144, 50,  6, 64,200, 25,  3, 32,100, 12,129,144, 50,  6, 64,200, 25,  3, 32,100, 12,129,144, 50,
+     6, 64,200, 25,  3, 32,100, 12,129,144, 50,  6, 64,200, 25,  3, 32,100, 12,129,144, 50,  6, 64,200, 25,  3, 32,100, 12,129,144,
+    50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,
+   145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,
+   137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100,
+    76,137,145, 50, 33,128,200,153, 19, 34,100, 67,  0, 96, 50, 38, 68,200,153, 19, 34,100, 76,136, 96, 50, 33,128,200,153, 19, 34,
+   100, 67,  0, 96, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19,
+    34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 33,128,200,153,
+    19, 34,100, 67,  0, 96, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,
+   153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 33,128,200,153, 19, 34,100, 67,  0, 96, 50, 38, 68,
+   200,153, 19, 34,100, 76,136, 96, 50, 33,128,200,153, 19, 34,100, 67,  0, 96, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38,
+    68,200,153, 19, 34,100, 76,136, 96, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50,
+    38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145,
+    50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 33,128,200,153, 19, 34,100, 67,  0,
+    96, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,
+   137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100,
+    76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,134,  0,192,
+   100,140,145,146, 50,102, 80,202,153, 51, 38,100,204,153,149, 50,166, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99,
+    44,101,140,177,150, 50,198, 88,203, 25, 99, 44, 24,  3,  0, 96, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153,
+    19, 34,100, 76,137,145, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230, 92, 48,  6,  0,192, 24,  3,  0, 96, 51,  6, 96,204,
+    25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,
+   204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6,
+    96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,
+     6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102,  3,  0, 96, 51, 38,100,204,153,147, 50,102, 67,  0, 96,
+    51, 70,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,
+   155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,
+   217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,
+   204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,
+   102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179,
+    54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,
+   179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,
+   153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,
+   205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,
+   108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,
+   102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155,
+    51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,
+   155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,
+   217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,
+   204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,
+   102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,103, 12,233,155, 51,102,108,205,153,179,
+    54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,198,124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,
+   243, 62,103,204,249,159, 51,230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,154,  3, 66, 24,  3,  0, 96, 52, 70,136,209,
+    26, 35, 68,104,141, 17,162, 52, 70,136,209, 26, 35, 68,104,141, 17,162, 52, 70,136,209, 26, 35, 68,104,141, 17,162, 52, 70,136,
+   209, 26, 35, 68,104,141, 17,162, 52, 70,136,209, 26, 35, 68,104,141, 17,162, 52, 70,136,209, 26, 35, 68,104,141, 17,162, 52, 70,
+   136,209, 26, 35, 68,104,141, 17,162, 52, 70,136,209, 26, 35, 68,104,141, 17,162, 52, 70,136,209, 26, 35, 68,104,141, 17,162, 52,
+    70,136,209, 26, 51, 70,104,205, 33,164, 52,134,136,209, 26, 35, 68,104,141, 17,162, 52, 65,128, 48,  6,  0,192, 24,  3,  0, 96,
+    52,166,148,210,154, 83, 74,105, 77, 41,165, 52,166,148,210,154, 83, 74,105, 77, 41,165, 52,166,148,211, 26, 99, 78,106,  3,  0,
+    96, 12,  1,128, 48,  6,  0,192, 24,  3,  1,165, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77,
+    73,169, 53, 38,164,213, 26,163, 86, 58,135, 80, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 53,134,176,214, 26,195, 88,107,
+    13, 97,172, 53,134,176,214, 26,195, 88,107, 13, 97,172, 53,134,176,214,154,208,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 53,198,184,215, 26,227, 92,107,141,113,174, 53,198,184,215, 26,227, 92, 24, 13,113,174, 53,193,128,215,154,240,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,
+     3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216,
+    27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 98,108, 77,145,177, 54, 38,196,
+   216,155, 19, 98,108, 77,145,178, 54, 70,200,217, 27, 35,100,108,141,137,178, 54, 70,196,216,155, 19, 98,108, 77,137,177, 54, 38,
+   196,217,155, 19,104,109, 13,169,182, 54,134,220,218, 27,131, 96,110, 67,  0, 96, 55, 70,232,221, 27,163,116,110,141,209,186, 55,
+    70,232, 48,  6,  0,192, 24,  3,  0, 96, 55,102,236,221,155,179,118,110,205,217,187, 55,102,236, 48,  6,  0,192, 24,  3,  0, 96,
+    55,134,240,222,155,227,126,112, 14,  9,188, 56, 71, 12,222, 28, 67,136,113, 14, 41,196, 56,199, 24,227, 28, 99,140,113,142, 49,
+   198, 56,199, 24, 48,  6,  0,192, 24,  3,  0, 96, 56,231, 28,227,156,115,142,113,206, 57,199, 56,231, 28,227,156,115,142,113,206,
+    57,199, 56,231, 28,227,156,115,142,113,206, 57,199, 56,231, 28,227,156,115,142,113,206, 57,199, 56,231, 28,227,156,131,142,113,
+   206, 57,199, 56,231, 28,227,156,115,142,113,206, 57,199, 56,231, 28,227,156,115,142,113,206, 57,199, 56,231, 28,227,156,115,142,
+   113,206, 57,199, 56,231, 28,227,156,115,142,113,206, 57,199, 56,231, 28,227,156,115,142,113,206, 57,199, 56,231, 28,227,156,115,
+   142,113,206, 57,199, 56,225,128, 48,  6,  0,192, 24,  3,  0, 96, 56,231, 28,227,156,115,142,113, 14, 33,199, 56,231, 28,227,156,
+   115,142,113,206, 57,199, 56,231, 28,227,156,115,142,113,206, 57,199, 56,231, 28,227,156,115,142,113,206, 57,199, 56,231, 28,227,
+   156,115,142,113,206, 57,199, 56,231, 36,227,134,  0,192, 24,  3,  0, 96, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,
+   205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,
+   108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,
+   102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,195,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+    57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,202, 57, 71, 40,229, 28,163,148,114,142, 81,
+   202, 57, 71, 40,229, 28,163,148,114,142, 80, 96, 57,103, 44,229,156,195,152,115, 14, 97,203, 57,103, 48,230, 28,192,192, 24,  3,
+     0, 96, 57,135, 48,229,156,195,152,115, 14, 97,204, 57,135, 52,231, 28,240,192, 24,  3,  0, 96, 58,  1,128, 48,  6,  3,162,116,
+    78,145,210, 58, 71, 72,233, 29, 35,164,116,142,145,210, 58,103, 76,233,157, 51,166,116,206,153,211, 58,103, 76,233,157, 51,166,
+   116,206,153,211, 58,103, 76,233,157, 51,166,116,206,153,211, 58,103, 76,233,157, 51,166,116,195,  0, 96, 58,103, 76,233,157, 51,
+   166, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29,
+    67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234,
+    29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 64,192, 24,  3,  0, 96, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,
+   234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80, 48,  6,  0,192, 24,  3,  0, 96, 58,167,
+    84,234,157, 83,170,117, 78,169,213, 58,167, 84,235,  6,  0,192, 24, 14,185,215, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,
+     7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216,
+    59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,
+   218, 59,103,112,238, 29,208,192, 24, 14,241,222, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,
+   249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,119,
+   206,249,223, 59,231,124,239,157,243,190,119,206,249,223, 59,231,124,239,157,243,190,120, 15,  9,224, 60, 39,132,240,158, 19,194,
+   120, 79,  8, 96, 60, 71,140,240,158, 51,198,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 15,  1,224, 60,  7,128,240, 30, 19,
+   194,121, 15, 33,228, 60,135,144,242, 30, 67,200, 24,  3,  1,229, 60,199,152,243, 30, 99,204,121,143, 49,230, 60,199,152, 48,  6,
+     0,192, 24,  3,  0, 96, 60,199,152,243, 30, 99,204,121,143, 49,230, 60,199,152, 48,  6,  0,192, 24,  3,  0, 96, 60,231,156,243,
+   158,115,206,121,207, 57,232, 61, 39,164,244,158,147,206,121,195,  0, 96, 14,193,216, 59,  7, 96,236, 58,  7, 64,232, 29,  3,160,
+   116,  7, 96,236, 58, 15, 80,232, 29,  1,216, 59, 14,129,208, 29,131,176,118, 14,193,216,116,  7, 96,236, 29,131,176, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+    61,103,172,245,158,179,216,123, 79,113,237, 61,199,180,247, 30,211,220,123, 79,113,237, 61,167,180,247, 30,211,218,123, 79,105,
+   237, 61,167,180,246,158,211,218,123, 79,105,237, 61,167,180,246,158,211,218,123, 79,105,237, 61,167,180,246,158,211,218,123, 79,
+   105,237, 61,167,180,246,158,211,222,124, 15, 89,235, 61,103,172,245,159, 19,214,124, 79, 97,236, 62, 39,196,245,159, 19,228,123,
+    79,105,237, 61,167,180,246,158,211,218, 24,  3,  0, 96, 62,103,204,249,159, 51,230,124,207,153,243, 62,103,204,250, 31, 67,234,
+   125,143,161,244, 62,199,220,251,159,115,238,125,207,185,247, 62,231,220,251,159,131,242,126, 15,193,248, 63,  7,224,252, 31,131,
+   238,125,207,185,247, 62,231,220,251,159,115,238,125, 15,160, 96, 63, 71,232,253,159,195,248,127, 15,225,252, 63,135,240,254, 31,
+   195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,236,253,
+    31,163,244,126,143,217,251, 63, 71,232,254,159,227,244,126,143,225,252, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,
+   254, 31,195,248,127, 15,225,252, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,
+     1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16, 10,  2, 64,
+   104, 13,  1, 32, 36,  4,128,208, 18,  3, 64,104, 13,  2, 32, 64,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  4, 10,129, 80, 42,  5,
+    64,200, 25,  3, 32,100, 12,129,144, 50,  6, 64,200, 25,  3, 32,100, 12,129,144, 50,  6, 64,200, 25,  3, 32,100, 12,129,144, 50,
+     6, 64,200, 25,  3, 32,100, 12,129,144, 50,  6, 64,200, 25,  3, 32,100, 14,129,208, 58,  7, 64,232, 29,  3,160,116, 16,130, 16,
+    66,  8, 65,  8, 33,  4, 32,132, 14,129,208, 66,  9, 12,  1,128, 48, 32,164, 20,130,208, 90, 11, 65,136, 49,  6, 32,196, 24,131,
+    16, 98, 12, 65,136, 48, 48,  6,  0,192,129,144, 50,  6, 65,168, 53,  6,160,212, 26,131, 80,106, 13, 65,168, 53,  7, 32,228, 28,
+   131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200, 57,  7, 32,228,
+    28,131,144,114, 14, 65,232, 61,  7,160,244, 30,131,208,130, 16, 14, 97,204, 57,135, 48,230, 28,195,152,115, 14, 97,128, 48,  6,
+     0,192, 24,  3,  0, 96, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,
+   161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,
+     8,134,  0,192,132, 80,138, 17, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 14,193,
+   216, 59, 24,164, 38, 58,  7, 64,232, 29,  3,160, 59,  7, 97,208, 58,  7, 64,232, 14,200, 81,  9,161, 52, 38,132,208,154, 19, 66,
+   104, 85, 10,161, 84, 42, 58, 16,170, 21, 66,168, 85, 10,161, 80,236,133, 80,170, 20, 14,193,217, 10,134,  0,192, 24,  3,  0, 96,
+     7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240,
+    62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,130,232, 93, 11,161,116, 46,135, 48,130, 16, 66,
+     8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16,
+    66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130,
+    24, 67,  8, 97, 12, 33,132, 32,132, 16,130, 16, 67,  8, 97, 12, 33,132, 48,131,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,
+   124, 15,129,240, 62, 66,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,
+   224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  4, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,
+   132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4,
+    32,132, 16,130, 16, 66,  8, 97, 14,193,216,116,  7, 96,236, 29,131,176,118, 14,193,216,116,  7, 96,236,133,208,192,232, 67, 33,
+   216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,
+   193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,144,210, 27, 67, 99,161, 14,  7,100, 58, 58,  3,176,232,
+     6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184,
+    60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,
+   184, 60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,
+     1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110,
+    15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,
+   110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,
+   192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,224, 60,  7,128,240, 31,  3,192,124, 15,129,232, 62,  6,224,240, 27,
+   131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240,
+    27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,
+   240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  6,
+   224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 27,131,192,110, 15,  1,184, 60,  6,224,240, 30,131,224,122, 15,129,232, 62,
+    12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,129,144, 50,  6, 64,200, 25,  3, 32,100, 12,193,152, 51,  6, 96,204, 25,131,  0,
+    96, 12,129,144, 50,  6, 64,200, 25,  3,  0, 96, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,129,144, 50,  6, 64,200, 25,  3,
+    32,100, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,129,144, 50,  6, 64,200, 25,  3, 32,100, 12,193,152, 51,  6, 96,204, 25,
+   131,  0, 96, 12,129,144, 50,  6, 64,200, 25,  3,  0, 96, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,  1,144, 48,  6, 64,192,
+    25,  3,  0,100, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,129,144, 50,  6, 64,200, 25,  3, 32,100, 12,200,120, 51, 33,224,
+   204,135,131, 50, 30, 12,200,120, 51, 33,224,204,135,131,  0, 96, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 67,232,125, 15,161,
+   244, 62,135,208,250, 31, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 67,232,125, 15,161,244, 62,135,208,250, 31, 12,193,152, 51,
+     6, 96,204, 25,131, 48,102, 67,232,125, 15,161,244, 62,135,208,250, 31, 12,193,152, 51,  6, 96,204, 24,  3, 48,102, 12,129,144,
+    50, 34,  4, 62, 23,208,240, 95, 11,232,132, 51,  6, 96,204, 24,  3, 48,102, 12,136,128, 50, 34,  4, 62,136, 81, 10, 33, 12,193,
+   152, 51, 33,224,192, 24,  3, 48,102, 12,129,144, 50, 34,  0,192,136, 81, 10, 33, 12,193,152, 51, 33,224,204, 25,131, 48,102, 12,
+   129,144, 50, 34,  0,200,136, 81, 18, 34, 12,  1,128, 51,  6, 96,204, 24,  3, 48,102, 12,136,128, 50, 34,  4, 62,136,194,248, 96,
+    68,136,145, 18,162, 84, 74,137, 81, 42, 38, 68,168,149, 18,162,116, 80,138, 81, 82, 43, 69,136,181, 23, 34,244, 96,140, 65, 66,
+    50, 70,104,209, 26,130,196,108,141,209,168, 44,  5,  0,161, 28, 35, 36,114,142,145,210, 59, 71,136,245, 31, 35,244,128,144, 82,
+    18, 67, 72,137, 21, 34, 36, 68,138,145,146, 58, 71, 70, 64,176, 26,130,132,144,146, 81,194, 74, 73, 72,201, 25, 35, 36,150,147,
+    18,106, 73, 73, 41, 33, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 39, 35, 36,148,140,142,  2, 71, 56,  7,  0,224, 28,  4,100,
+   112, 14,  2, 37, 73,233, 65, 40, 37,  4,160,148, 82,146, 83, 74,137, 85, 43, 37,100,172,149,146,178, 86, 74,225,  4, 48,  6,  0,
+    98,149,210,186, 87, 74,233, 93, 44, 37,132,156,147, 18,106, 89, 74,224,196, 24,131, 16, 98,149,210,186, 87, 74,233, 93, 44, 37,
+   132,156,147, 18,104, 96,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 24,  3,  0, 96, 42,101, 76,169,
+   149, 50,166, 84,202,154, 90, 42,105,108,169,149, 48, 76, 84,202,153, 83, 42,101, 76,169,149, 50,166, 84,210,209, 83, 42,101, 76,
+   169,165,162,166, 84,210,209, 83, 75, 73,113, 46, 37,196,184,151, 18,226, 92, 75,137,113, 46, 37,196,184,151, 18,226, 92, 14,193,
+   217,  9,161, 48,236, 29,131,176,118, 66,104, 77,  9,135, 96,236,122,143, 81,234, 61, 65,216,245, 30,163,212,132,208,152,118, 29,
+     1,217,  9,161, 49,208, 58,  7, 64,232, 14,193,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+    75,169,117, 47, 37,244,186,152, 18,234, 94, 75,169,124, 25,165,228,188,151,129,152, 51, 75,201,121, 47, 38, 20,186,151,147, 18,
+    93, 73,201,121, 47, 37,228,188,151,146,234, 93, 75,169,129, 49,165,212,188,151, 83, 34, 93, 75,201,117, 50,166,100,188,151,147,
+    56, 51, 75,201,120, 30,165,224,102,133, 80,170, 21, 66,169,161, 46,165,208,102, 12,210,242, 94, 73,201, 57, 39, 36,228,156,151,
+   129,152, 51,  6, 96,205, 46,164,228,186,151, 65,241,122, 77, 41,165, 52,166,160,108,154,211, 74,105, 77, 41,165, 52,131,100,212,
+   154,129,178,105, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,218,155, 83,106,109, 77,201,185, 55, 38,228,
+   220,155,147,114,110, 77,201,185, 55,166,244,222,155,211,122,111, 78,  9,193, 56,  3,208,124,156, 19,130,112, 78,  0,217, 46,165,
+   208,192, 24,  3,  0, 96,  7, 32,228, 28,131,148,226,152,211, 26, 99, 76,105,141, 57, 39, 36,186,151, 82,234, 93, 73,201,117, 46,
+   164,228,186,151, 82,114, 93, 75,160,168, 21, 37,212,186,151, 83,146, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 78,105,205,
+    46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,157, 19,146,114, 75,169,
+   116, 28,165,208,114,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234,115, 75,
+   169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78,
+     7, 41, 56, 28,131,148,228,147,146,112, 57,  7, 41,201, 39,  3,148,228,147,146,112, 57, 73,192,229, 58,167,100,156, 14, 82,114,
+    78, 73,201, 56, 28,164,228,156, 14, 65,200, 57,  7, 41, 57, 39,  3,148,228, 14, 83,144, 57,  7, 32,228, 28,131,144,114,147,129,
+   202, 78, 73,201, 57, 39, 36,224,114, 14, 65,200, 57, 73,201, 57, 39, 36,224,114, 14, 82,114, 78, 73,201,201, 39, 36,228,228,147,
+   146,114,114,  7, 41,201, 39, 36,224,114,147,146,114, 78, 73,201, 56, 28,164,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,
+   147,146,114, 78, 78,224,229, 57, 36,224,114, 14, 65,200, 57, 73,201, 56, 28,131,148,156,156,147,186,119, 78, 73,201, 39, 36,228,
+   228,156,146,114, 78, 78, 73,201, 39, 36,228,156,147,146,114, 78, 78, 73,200, 28,131,148,228,156,129,200, 57, 78, 73,201, 39, 36,
+   228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156, 14, 82,114, 78, 73,192,229, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39,
+    36,228,156, 14, 82,114, 78, 73,201, 57, 39, 36,228,228,156,147,146,114, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57,
+    39, 36,228,156,147,146,112, 57, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201,
+    57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 78, 73,201, 57, 39, 36,156,147,146,114, 78, 73,
+   201, 57, 57, 39, 36,228,156,146,114,120, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78,
+    75,169,117, 46,165,212,186,151, 82,234, 93, 73,137, 53, 38, 36,212,186,151, 82,234, 93, 75,169,117, 48, 37,212,186,151, 82,234,
+    93, 75,169,117, 60,167,148,186,151, 82,234, 93, 73,201, 57, 46,165,212,186,151, 82,234, 93,  5, 73,233, 61,165,212,186,151, 82,
+   234, 93, 75,169,117, 46,165,212,186,151, 75,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,
+   139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244,
+    94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,
+   244, 94,139,209,122, 47, 69,232,189, 37,212,156,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93,  5, 73,117, 46,165,
+   212,186,151, 82,234, 93, 75,169,117, 46,165,212,186, 94,146,234, 93, 75,169,117, 46,164,228,156,147,146,114, 78, 73,201, 57, 39,
+    36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,186,151, 82,234, 93, 75,169,117,
+    46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,232, 42, 75,169,
+   117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,156,147,146,114, 78, 73,201, 57, 46,165,212,186,151, 82,234, 93, 75,
+   169,241, 62, 39,196,248, 10,129, 80, 42, 79, 41,245, 62,167,148,186,151, 82,234, 93,  5, 64,168, 21, 37,212,186,151, 82,234, 93,
+    75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234,
+    93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,232, 96, 12,  1,128, 48,  6,  0,192, 24,  3,
+     0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 75,169,117, 46,165,212,186,151,
+    82,234, 93, 75,169,117, 46,134,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,
+   108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6, 32,196, 24,131,
+    16, 98, 12, 65,136, 49,  6, 32,196, 24,131, 16, 98, 12, 65,136, 49,  6, 32,196, 24,131, 20,252,159,147,242,126, 79,201,249, 63,
+    39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,250,127, 79,233,253,
+    63,167,244,254,159,211,250,127, 79,233,253, 64, 39,244,254,159,211,250,127, 79,233,253, 63,167,244,254,159,211,250,127, 80, 42,
+     5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80,
+    42,  5, 53,131, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,178,106,
+    76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2,
+    96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,
+     2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152,
+    19,  2, 96, 76,  9,129, 48, 38,  4,186,151, 82,234, 93, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,
+   152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  5,
+     4,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,
+     4,192,152, 19,  2, 96, 75,169,117, 48, 38,  4,192,152, 18,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 76,  9,129, 46,
+   166,  4,192,152, 19,  2, 96, 76,  9,128, 21,  2,164,186,151, 82,234, 93, 75,169,117, 48, 38,  4,186,151, 83, 24, 57, 75,169,117,
+    46,165,212,192,152, 18,234, 93, 76, 96,229, 46,165,212,186,151, 83,  2, 96, 76,  9,117, 46,166,  4,186,151, 83,  2, 96, 76,  9,
+   129, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 48, 38,  4,192,152, 18,234, 93, 75,
+   169,117, 46,165,212,186,151, 82,234, 96, 75,169,117, 46,165,212,186,151, 82,234, 93, 73,201, 57, 39, 40, 53,  6,161, 20, 34, 78,
+    79,169,245, 62,167,208, 84,152,211,  0, 42,  5, 73,140, 21,  2,160, 84, 10,147, 26, 99,  5, 64,168, 21, 37,212,242,158, 84, 42,
+   133, 79,160,169, 62,167,213, 12,161,212, 50,125,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129,
+    80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 73,245, 62,167,208, 84, 10,129, 80, 42, 76, 96,169, 49,130,160, 84, 10,
+   129, 80, 42, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,192, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84,
+    10,129, 80, 42, 76,105,140, 21, 38, 52,198,152,193, 82, 99, 80,201,141, 49,130,164,198,152,193, 82,113,  5, 64,168, 21,  2,160,
+    84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 82,121,  5, 64,168, 21,  2,160, 84, 10,146,234, 93, 75,169,117, 46,165,
+   212,186,151, 82,234, 93,  5, 64,168, 21, 39,192, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,147, 26, 99,  5, 73,240, 21,
+     2,160, 84, 10,129, 80, 42,  5, 64,169, 62, 39,197, 16, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168,
+    21,  2,160, 84,158, 83,202,134, 79,169,245, 62,167,212,242,158, 84, 50,134, 80,201,141, 49,166, 52,198,161,147,226,134, 80,202,
+    25, 49,168,100,242,152,211, 26, 99, 80,202, 25, 49,166, 53, 12,152,211, 26,134, 80,202, 24, 21, 38, 48, 84, 10,129, 80, 42, 76,
+   105,141, 60,166, 52,198,152,211, 26, 99, 76,106, 25, 60,167,149, 12,158, 83, 26,134, 80,202, 37, 60,166, 52,198,158, 84, 50,134,
+    79,169,245, 62,167,212,250,159, 18,234, 93, 79,169,245, 69, 40,165, 14,161,193, 80, 42,  5, 64,168, 21, 37,208, 84,151, 65, 82,
+    93, 75,169,117, 46,165,212,186, 10,146,234, 93, 75,160,169, 46,165,212,186,151, 82,234, 93, 79,137,117, 46,165,212,186,151, 82,
+   234, 93, 75,169,117, 46,130,160, 84,151, 82,234, 93, 75,169,117, 46,165,212,186,156,210,234, 93, 75,169,117, 46,165,208, 84,151,
+    82,232, 42, 75,169,117, 46,165,212,248,151, 83,226, 93, 75,169,117, 46,167,196,248,159, 18,234,139, 75,169,117, 46,168,197, 24,
+   163, 20, 98,140, 81,137,117, 70,168,228,250, 10,129, 80, 42, 73,137, 53, 38, 36,212,152,147, 82, 98, 77, 73,137, 53, 38, 36,212,
+   152,147, 65,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54, 77,105,173, 53,166,180,214,154,211, 90,107, 77,105,173, 53,166,
+   180,214,154,211, 90,107, 77,105,173, 53,166,180,186,159, 19,226,124, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,160,169, 46,
+   165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 79,137,117, 46,165,212,186,151, 82,234, 93, 75,169,117,
+    46,165,212,186,151, 82,234,124, 73,201, 57, 39, 36,228,156,147, 18,106, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201,
+    57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,128,128, 33,  2,
+     0,132,  8,  2, 16, 32,  8, 82, 98, 77, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78,
+    81,234, 61, 71,168,245, 30,163,212,122,143, 81,234, 61, 71,168,245, 30,163,212,122,143, 81,234, 61, 71,168,245, 30,163,212,122,
+   143, 81,234, 61, 71,168,245, 30,163,212,122,143, 81,234, 61, 71,168,245, 30,163,212,122,143, 81,234, 61, 71,168,245, 30,163,212,
+   122,143, 81,234, 61, 71,168,245, 30,163,212,122,143, 81,234, 61, 71,168,245, 30,163,212,122,143, 81,234, 61, 71,168,245, 30,163,
+   212,122,143, 81,234, 61, 71,168,245, 30,163,212,122,143, 81,234, 61, 71,168,245, 30,163,212,122,143, 81,234, 61, 71,168,245, 30,
+   163,212,122,143, 81,234, 61, 71,168,245, 30,163,212,122,143, 81,234, 61, 71,168,245, 30,163,212,122,143, 81,234, 61, 71,168,245,
+    30,163,212,122,143, 81,234, 61, 71,168,245, 30,163,212,122,143, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,
+   228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39,
+    36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,229,  6,160,210,114, 78, 73,201, 57,
+    39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201,
+    57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,
+   201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78,
+    73,201, 57, 39, 36,196,154,  4,  1, 10, 76, 73,169, 49, 38,164,196,154,147, 18,106, 76, 73,169, 49, 38,164,196,154,147, 18,106,
+    76, 73,169, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,
+   114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,
+   146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,137, 53, 38, 36,212,156,
+   147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,
+   156,147,146,114, 78, 73,201, 57, 39, 36,228,152,147, 82,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,
+   228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39,
+    36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57,
+    39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201,
+    57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,
+   201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78,
+    73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114,
+    78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,
+   114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,
+   146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,229, 32,
+   147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,
+   156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 75,169,117, 46,165,212,186, 10,129, 80, 42, 75,169,117, 46,165,
+   212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,167,196,248,151, 82,234, 93, 75,169,117, 46,
+   165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57,
+    39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,151, 82,234, 78, 73,201, 57, 39, 36,228,156,151, 82,234, 93, 79,137,
+   117, 46,165,212,186,162,211,  2, 96, 76,  9,129, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,
+   169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,208,192, 24, 18,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93,
+    75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 67,  2,
+    93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,
+   234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151,
+    82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,
+   151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,
+   186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169,
+    21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 42, 69, 72,
+   169, 21, 34,164, 84,138,145, 82, 42, 69, 72,169, 21, 34,164, 84,138,145, 82, 74, 73, 73, 41, 37, 36,164,148,146,146, 82, 74, 73,
+    73, 41, 37, 36,164,148,146,146, 82, 74, 73, 73, 41, 37, 36,164,148,146,146, 82, 74, 73, 73, 41, 37, 36,164,148,146,146, 82, 74,
+    73, 73, 41, 37, 36,164,148,146,146, 82, 74, 73, 73, 41, 37, 36,164,148,146,146,  7,160,248, 30,131,208,122, 15,129,240, 61,  7,
+   192,244, 31,  3,208,124, 15, 65,232, 61,  7,160,248, 30,131,224,124, 15, 65,240, 62,  7,192,248, 31,  3,224,130, 16, 65,232, 61,
+    13, 33,168, 52,134,160,210, 26,131, 72,106, 13, 33,168, 52,134,160,210, 26,131, 72,106, 13, 33,168, 52,134,160,210, 26,131, 72,
+   106, 13, 33,168, 52,134,160,210, 26,131, 72,106, 13, 33,168, 52,134,160,210, 26,131, 72,106, 13, 33,168, 52,134,160,210, 26,131,
+    72,106, 13, 33,168, 52,134,160,210, 26,131, 72,106, 13, 33,168, 52,134,160,210, 26,131, 72,106, 13, 33,168, 52,134,160,210, 26,
+   131, 72,106, 13, 33,168, 52,134,160,210, 26,131, 72,106, 13, 33,168, 52,134,160,210, 26,131, 72,106, 13, 33,168, 52,134,160,210,
+    26,131, 72,106, 13, 33,168, 52,134,160,212,164,212,154,147, 82,106, 77, 73,134,144,212, 26, 67, 82,148, 82,138, 80, 52,134,160,
+   192, 24,  3,  0, 96, 12, 10, 85, 75, 41,101, 44,165,212,170,150, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,
+   133, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76, 41,133, 48,166, 20,194,152, 83, 10, 97, 76,
+    41,133, 48,166,  3,  2,152, 12,  1,128, 48,  6,  0,192,166,  3,  0, 96, 83, 42,101, 76,169,149, 50,166, 84,202,153, 83, 42,101,
+    76,169,149, 50,166, 84,202,153, 83, 42,101, 76,169,149, 50,166, 84,202,153, 83, 42,101, 76,169,149, 50,166, 84,202,153, 83, 42,
+   101, 76,169,149, 50,166, 84,202,153, 83, 42,101, 76,169,149, 50,166, 84,202,153, 83, 42,101, 76,169,149, 50,166, 84,202,153, 12,
+     1,128, 48,  6,  0,192, 24,  3,  2,154, 83, 97,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  2,156,
+    50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,136,
+    96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 50, 38, 68,200,153, 19, 34,100, 76,136, 96, 50, 38, 68,200,153, 19, 34,100, 76,
+   136, 96, 50, 38, 68,200,153, 19, 34,100, 76,136, 96, 50, 38, 68,200,153, 19, 34,100, 76,136, 96, 50, 38, 68,200,153, 19, 34,100,
+    76,136, 96, 50, 38, 68,200,153, 19, 34,100, 76,136, 96, 50, 38, 68,200,153, 19, 34,100, 76,136, 96, 50, 38, 68,200,153, 19, 34,
+   100, 76,136, 96, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 14,161,212, 58,135, 80,
+   234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 67,168,117, 83,170,116, 22,  3, 80, 88, 13, 84,234,157, 83,160,176, 26,169,
+   208, 88, 13, 78,  1,192, 56,  7,  0,224, 28,  3,128,112, 17,146, 46, 83,199,  1, 79,163, 32, 88, 13, 81,146, 50,  5,128,213, 38,
+    36,212,152,147, 82, 98, 77, 73,137, 52,224, 28,  3,128,112, 13,240, 66, 56,  7,  1, 25, 28,  3,128,140,145,146, 50, 70, 72,201,
+    80, 42,  5, 66,112, 14,  2, 50, 69,199,  1, 26,156,  3,128,112, 14,  1,192, 56,  7,  0,224, 35, 35,128,140,142,  1,192, 75,169,
+   117, 25, 27,227,124,147, 18,106, 76, 73,169, 49, 38,164,196,154,139,131,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+    84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,
+   162, 84, 74,136, 48, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149,
+    18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,
+   149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,
+   168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 32,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42,
+    37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81,
+    42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137,
+    81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,
+   137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84,
+    74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162,
+    84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,
+   162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149,
+    18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,
+   149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,131,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 84,106,141, 81,170, 53,
+    70,168,213, 26,163, 84,106,141, 81,170, 48,192, 24,  3,  0, 96, 84,138,149, 83, 42,117, 70,170, 21, 74,170, 85,106,177, 85,170,
+   197, 86,171, 21, 90,172, 85,106,177, 81,170, 53, 86,171, 21, 90,172, 85,106,177, 85,170,197, 90,171,149,122,175, 84,106,169, 85,
+    42,165, 84,170,149, 82,170, 85, 74,169, 88, 43, 21,100,172,213,162,180, 86,170,217, 91, 43,101,108,173,213, 26,163, 85, 74,169,
+    85, 42,133,112,174, 85, 26,186, 12, 10,237, 94, 43,181,120,174,213,226,187, 87,138,237, 94, 43,197,122,175, 21,234,188, 87,170,
+   241, 94,171,197,122,175, 21,234,188, 87,170,241, 94,171,197,122,175, 21,234,188, 87,170,241, 94,171,181,120,175, 85,226,189, 87,
+   138,245, 94, 43,197,120,175, 21,226,188, 87,170,245, 94, 43,213,122,175, 21,234,189, 87,138,245, 94,171,197,122,175, 85,226,188,
+    87,138,241, 94, 43,181,120,174,213,226,187, 87,138,241, 94, 43,197,120,175, 21,218,188, 87,138,241, 94, 43,197,122,174,213,216,
+    96, 12, 10,249, 95, 43,245,126,176, 22, 10,188, 88, 75, 13, 98, 44, 53,136,176,214, 34,195, 88,139, 13, 98, 44, 69,138,177, 22,
+    42,196, 88,171, 17, 98,172, 69,138,177, 22, 42,196, 88,171, 17, 98,172, 69,138,177, 22, 42,196, 88,171, 17, 98,172, 53,136,177,
+    86, 34,197, 88,139, 21, 98, 44, 69,136,177, 22, 34,196, 88,171, 21, 98, 44, 85,138,177, 22, 42,197, 88,139, 21, 98,172, 69,138,
+   177, 86, 34,196, 88,139, 17, 98, 44, 53,136,176,214, 34,195, 88,139, 17, 98, 44, 69,136,177, 22, 26,196, 88,139, 17, 98, 44, 69,
+   138,176,214, 26,197, 88,171, 21, 98,172,101,142,178, 22, 74,196, 12,  1,128, 48,  6,  0,192,178,150, 82,202, 89, 75, 41,101, 44,
+   165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101,
+    44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 12, 11, 45,101,172,181,150,178,214, 90,203, 89,107, 45,
+   101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107,
+    45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,
+   107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203,
+    89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 88, 96, 89,139, 49,102,172,213,154,179, 86, 98,
+   204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150,
+    82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 84,106,141, 81,170, 53, 70,168,
+   213, 26,163, 84,106,141, 81,170, 53, 70,168,213, 26,163, 84,106,141, 81,170, 53, 70,168,213, 26,163, 84,106,141, 81,170, 53, 70,
+   168,213, 26,163, 84,106,141, 81,170, 48,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 88,107, 13, 97,172, 53,
+   134,176,214, 26,195, 88,107, 13, 97,172, 53,134,176,214, 26,195, 89,203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,
+   229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,214,120, 96, 89,171, 53,102,
+   172,213,154,179, 86,106,205, 89,171, 53,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,
+   102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 90, 11, 65,104, 45,  5,160,180, 22,130,208, 84,107,
+    69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 89,203, 57,103, 44,229,156,179,150,114,206, 89,
+   203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,158,179,214,122,204,
+    89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,
+   210, 89,139, 73,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22,
+    98,204, 89,139, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 89,139, 49,102, 44,197,152,179,
+    22, 98,204, 89,139, 49,102, 44,197, 70,168,213, 26,163, 90,107, 77,105,173, 53,166,180,214,154,211, 90,107, 77,105,173, 53,166,
+   180,214,154,211, 90,107, 77,105,173, 53,166,180,214,154,211, 90,107, 77,105,173, 53,166,180,214,154,211, 90,107, 77,105,173, 53,
+   166,180,214,154,211, 90,107, 77,105,173, 53,166,180,214,154,204, 90,107, 77,105,173, 53,166,180,214,154,211, 90,107, 77,105,173,
+    53,166,180,214,154,211, 90,107, 77,105,173, 53,166,180,214,154,211, 90,107, 77,105,173, 53,166,180,214,154,211, 90,107, 77,105,
+   173, 53,166,180,214,154,211, 90,107, 77,105,173, 53,166,180,214,154,211, 90,107, 77,105,173, 53,166,180,214,154,211, 90,107, 77,
+   105,173, 53,166,180,214,154,211, 90,107, 77,105,173, 53,166,180,214,154,211, 90,107, 77,105,173, 53,166,180,214,154,211, 90,107,
+    77,105,173, 53,166,180,214,154,211, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,
+   139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,163, 84,106,141, 81,172,197,152,179, 22, 98,204,
+    89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,
+   204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22,
+    98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179,
+    22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,
+   179, 21, 26,163, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,
+   152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,163, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45,
+    69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106,
+    45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,
+   106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139,
+    81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,
+   139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212,
+    90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,
+   212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,
+   162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 75,169,117, 46,165,212,186,151,
+    82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,
+   151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,
+   186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173,
+    85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181,150,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,
+   173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,
+   106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171,
+    85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,
+   171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213,
+    90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,
+   213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,
+   170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181,
+    86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,
+   181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,
+   170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173, 85,170,181, 86,170,213, 90,171, 85,106,173,
+    85,170, 24,  3,  0, 96, 90,235, 93,107,173,117,174,181,214,186,215, 90,235, 93,107,173,117,174,181,214,186,215, 90,235, 93,107,
+   173,117,174,181,214,186,215, 90,235, 93,107,173,117,174,181,214,186,215, 90,235, 93,107,173,117,174,181,214,186,215, 90,235, 93,
+   107,173,117,174,181,214,186,215, 90,235, 93,107,173,117,174,181,214,184, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 91, 11,
+    97,108, 45,133,176,182, 22,194,216, 91, 11, 97,108, 45,133,176,182, 22,194,216, 91, 11, 97,108, 45,133,176,182, 22,194,216, 91,
+    11, 97,108, 45,133,176,182, 22,194,216, 91, 11, 97,108, 45,133,176,182, 22,194,216, 91, 43,101,108,173,149,178,182, 86,210,219,
+    91,139,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,184,183, 22,226,
+   220, 91,139,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,184,183, 22,
+   226,220, 91,139,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,184,183,
+    22,226,220, 91,139,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,184,
+   183, 22,226,220, 91,139,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,
+   184,183, 22,226,220, 91,139,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,
+   197,186,183,150,250,224, 91,139,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,184,183, 22,226,220, 92, 43,133,112,
+   174, 21,194,184, 87, 10,225, 92, 43,133,110, 45,192,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96, 13,193,204, 55,  7, 48,220, 28,195,112,115, 13,193,204, 55,  7, 48,220, 28,195,112,115, 13,193,
+   204, 55,  7, 48,220, 28,195,112,115, 13,193,204, 55,  7, 48,220, 28,195,112,115, 13,193,204, 55,  7, 48,220, 28,195,112,115, 13,
+   193,204, 55,  7, 48,220, 28,215, 16,117, 14,225,220, 59,174, 48,234, 29, 67,168,117, 14,161,212, 58,135, 80,234, 29, 87, 26,228,
+    13,193,204, 55,  7, 48,220, 28,195,112,115, 13,193,204, 55,  7, 48,220, 28,195,112,115, 13,193,204, 55,  7, 48,220, 28,195,112,
+   115, 13,193,204, 55,  7, 52, 44,133,131,168,117, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87,
+    42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185,
+    87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,
+   185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230, 92,235,157,116, 46,149,
+   212,186,151, 82,233, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,  9, 65, 40, 37,  4,160,148, 18,130, 80, 74,  8,161, 20, 34,132,
+    80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8,161, 20, 30,
+   131,224,122, 15,129,232, 62,  7,160,248, 30,131,224,122, 15,129,232, 62,  7,192,248, 30,131,224,122, 15,129,232, 62,  7,160,248,
+    30,131,224,122, 15,129,232, 62,  7,160,248, 30,131,224,122, 15,129,232, 62,  7,160,248, 30,131,224,122, 15,129,232, 62,  7,160,
+   248, 30,131,224,122, 15,129,232, 62,  7,160,248, 30,131,224,122, 15,129,232, 62,  7,160,248, 30,131,224,122, 15,129,232, 62,  7,
+   160,248, 30,131,224,122, 15,129,232, 62,  8, 32,248, 31,  3,224,124, 15,129,240, 62,  7,192,244, 31,  3,208,124, 15, 65,232, 62,
+     7,160,248, 30,131,224,122, 15,129,232, 62,  8, 75,173,117,131,208,124, 15, 65,240, 63,  7,160,248, 30,131,224,124, 15,129,232,
+    62,  7,160,248, 30,131,224,122, 15,129,232, 62,  7,160,248, 30,131,224,122, 15,129,232, 62,  7,160,248, 30,131,208,122, 15, 65,
+   232, 62,  7,160,244, 30,131,208,122, 15,129,232, 62,  7,160,248, 30,131,224,122, 15,129,232, 62,  7,160,248, 30,131,224,122, 15,
+    65,232, 61,  7,192,244, 31,  6,  0,192, 24,  3,  0, 96,  7,160,248, 48,  3,224,192, 15,129,232, 62,  7,160,248, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 32,132, 16,
+   130, 15, 65,240, 63,  8, 33,  4, 31,  3,240,126, 15,193,248, 63, 93,139,177,118,174,197,216,187, 23,114,236, 93,139,177,118, 46,
+   213,216,187, 23, 98,236, 93,139,177,118, 46,197,216,187, 23, 98,236, 93,139,177,118, 46,197,216,187, 23, 98,236, 93,139,177,118,
+    46,245,222,187, 87,106,239, 94, 11,193,120, 47,  5,220, 24,  3,  0, 96, 94, 43,197,120,175, 21,226,188, 75,209,122, 75, 73,156,
+    48,  6,  0,192, 24,  3,  0, 96, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,
+   201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94,
+    75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,230,188,215,162,244, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+    94,171,213,123, 47,101,236,189,151,178,246, 94,203,217,123, 47,101,236,189,151,178,246, 94,203,217,123, 47,101,236,189,151,178,
+   246, 94,203,217,123, 47,101,236,189,151,178,246, 94,203,217,123, 47,101,236,189,151,178,246, 94,203,217,123, 47,101,236,189,151,
+   178,246, 94,203,217,123, 47,101,234,189, 87,170,245, 94,171,213,122,175, 85,234,189, 87,170,245, 94,171,213,122,175, 85,238,190,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24, 23,202,249, 95, 75,233,125, 47,165,244,190,151,210,250, 95, 75,232, 48,  6,  0,192,
+    24,  3,  0, 96, 95,107,237,125,175,181,246,190,215,218,251, 95,107,237,125,175,181,246,190,215,218,251, 95,107,236,114, 14, 65,
+   200, 57,  7, 32,228, 29,131,176,118, 14, 69,248, 57,  7, 32,226, 95,171,245,126,175,213,250,191, 87,234,253, 95,171,245,127, 47,
+   229,252,191,151,242,254, 95,203,249,127, 47,229,252,191,151,242,254, 95,203,249,127, 47,229,252,191,151,242,254, 95,203,249,127,
+    47,229,252,191,151,250,255, 95,235,253,127,176,  6,  0,192, 13, 27,  1, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,
+   129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108,
+    13,130, 48, 80,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  3,  6, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,
+   134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 99, 12, 97,140, 49,134, 48,198, 24,195, 24, 24,  3,  0, 96,
+    96,236, 29,131,176,134, 18,194, 88, 75,  9, 97, 44, 37,132,176,150, 18,194, 88, 75,  9, 97, 44, 37,132,176,150, 18,194, 88, 75,
+     9, 97, 44, 37,132,176,150, 18,194, 88, 75,  9, 97, 44, 37,132,176,150, 18,194, 88, 75,  9, 97, 44, 37,132,176,150, 18,194, 88,
+    75,  9, 97, 44, 37,132,176,166, 16,194, 24, 59,  7, 96,236, 29,132, 48,134, 14,193,216, 67,  8, 97,108, 49,134, 48,198, 24,195,
+    24, 99, 13, 97,204, 57,134, 48,198, 24,195,  3,  0, 67, 97,236, 61,135,176,246, 30,195,216,123, 15, 97,236, 60, 48,  6,  0,192,
+    24, 24, 99, 12, 47,101,236,189,151,178,246, 95,152,129,123, 47,101,236,189,151,178,246, 94,203,217,123, 48,102, 12,193,152, 51,
+     6, 96,204, 25,131, 48,102, 12,189,151,178,246, 94,203,216, 96, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177,
+    22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44, 69,136,
+   177, 22, 34,196, 88,139, 17, 98, 44, 73,137, 49, 38, 36,196,152,147, 19, 98,108, 73,137, 49, 54, 38,196,152,144, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96, 98, 44, 69,136,177, 38, 34,196, 88,139, 17, 98, 44, 69,136,177, 22, 36,196,195,  0, 96, 98,140,
+    81,138, 49, 70, 40,197, 24,163, 20, 98,140, 80, 48,  6,  6, 42,197,152,179, 22, 47,101,236,189,151,178,246, 94,203,217,123, 47,
+   101,236,189,151,178,246, 94,203,217,123, 98,  5,236,189,151,178,246, 94,203,217,135, 48,230, 28,189,151,210,252, 95, 75,217,123,
+    98,236, 93,139,177,118, 46,197,216,187, 23, 98,236, 93,139,177,118, 46,197,216,187, 23, 98,236, 93,139,177,118, 46,197,216,187,
+    23, 98,236, 93,139,177,118, 46,197,216,187, 23, 98,236, 93,139,177,118, 46,197,216,187, 23, 98,236, 93,139,177,118, 46,197,216,
+   187, 23, 99, 12, 93,140, 49,134, 50,197,216,187, 24, 99, 12, 93,139,177,118, 46,197,216,195, 24, 98,236, 97,139,134,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48, 49,118, 46,
+   198,152,219, 27, 99,140,113,142, 49,198, 56,199, 24,227, 28, 99,140,113,142, 49,214, 60,199,152,235, 29, 99,236,125,142, 50,  6,
+    64,199, 89,  8, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  6, 68,200,153, 19, 34,100, 76,136, 96, 12,  6, 68,200,153,
+    19, 34,100, 76,136, 96, 12,  6, 68,200,153, 19, 34,100, 76,136, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 50, 38, 68,200,
+   153, 19, 34,100, 76,136, 96, 50, 38, 68,200,153, 19, 34,100, 76,136, 96,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248,
+    31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,
+   248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31, 46,176,130, 16, 66,  8, 65,  7,192,248, 31,  3,224,124, 23, 65,240, 62,  7,
+   193,  4, 37,  4,160,192, 24,  3,  0, 96, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153,
+    51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,
+   153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,
+   201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 99,140,113,142, 49,198, 56,199,
+    24,227, 28, 99,140,113,142, 49,198, 56,199, 24,227, 28, 99,140,113,142, 49,198, 56,199, 24,227, 28, 99,140,113,142, 49,198, 56,
+   199, 24,227, 28, 99,140,113,142, 49,214, 58,199,152,235, 29, 99,204,117,142,177,246, 58,200, 67,  0, 96,100, 76,137,145, 50, 38,
+    68,200,153, 19, 34,100, 76,136, 48,  6,  0,192, 24,  3,  0, 96,100,108,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50,
+    70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 70,201, 25, 35, 36,100,140,145,146,
+    50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,108,145,
+   146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,
+   145,146, 50, 70, 70,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,
+   140,145,146, 50, 70, 72,201, 25, 35, 36,100,108,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,
+   100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 70,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35,
+    36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,108,145,146, 50, 70, 72,201, 25,
+    35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 70,201,
+    25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,
+   201, 25, 35, 36,100,108,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70,
+    72,201, 25, 35, 36,100,140,145,146, 50, 70, 70,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50,
+    70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,108,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146,
+    50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 70,201, 25, 35, 36,100,140,145,
+   146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,108,
+   145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,
+   140,145,146, 50, 70, 70,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,
+   100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,108,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35,
+    36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 70,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25,
+    35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,108,145,146, 50, 70, 72,201,
+    25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 70,
+   201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70,
+    72,201, 25, 35, 36,100,108,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50,
+    70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 70,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146,
+    50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,108,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,
+   146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 70,201, 25, 35, 36,100,140,
+   145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,
+   108,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,
+   100,140,145,146, 50, 70, 70,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35,
+    36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,108,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25,
+    35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 70,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201,
+    25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,108,145,146, 50, 70, 72,
+   201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70,
+    70,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50,
+    70, 72,201, 25, 35, 36,100,108,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146,
+    50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 70,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,
+   146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,108,145,146, 50, 70, 72,201, 25, 35, 36,100,140,
+   145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 70,201, 25, 35, 36,100,
+   140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,
+   100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,108,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35,
+    36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 64,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,
+     0, 96, 49,166, 52,198,152,211, 26, 99, 76,105,141, 49,166, 52,198,152,211, 26, 99, 76,105,141, 49,166, 52,198,152,211, 26, 99,
+    76,104, 96, 12,  1,128, 48, 25,  3, 32,100, 12,129,144, 50,  6, 64,200, 25,  3, 32,100, 12,129,144, 50,  6, 64,200, 25,  3, 32,
+   100, 12,129,144, 50,  6, 64,200, 25,  3, 32,100, 12,129,144, 50,  6, 64,200, 25,  3, 32,100, 12,129,144, 50,  6, 64,200, 25,  3,
+    32,100, 12,129,144, 50,  6, 64,200, 25,  0,192, 24,  3,  0, 96,100,172,149,146,178, 86, 74,201, 89, 43, 37,100,172,149,146,178,
+    86, 74,201, 89, 43, 37,100,172,149,146,178, 86, 74,201, 89, 43, 37,100,172,149,146,178, 86, 74,201, 89, 43, 37,100,172,149,146,
+   178, 86, 74,201, 89, 43, 37,100,172,149,146,178, 86, 74,201, 89, 43, 37,100,172,149,146,178, 86, 74,201, 89, 43, 37,100,172,149,
+   146,178, 86, 74,201, 89, 43, 37,100,172,149,146,178, 86, 74,201, 89, 43, 37,100,172,149,146,178, 86, 74,201, 89, 43, 37,100,172,
+   149,146,178, 86, 74,201, 89, 43, 37,100,172,149,146,178, 86, 74,201, 89, 43, 37,100,172,149,146,178, 86, 74,201, 89, 43, 37,100,
+   172,149,146,178, 86, 74,201, 89, 43, 37,100,172,149,146,178, 86, 74,201, 89, 43, 37,100,172,149,146,178, 86, 74,201, 89, 43, 37,
+   100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51,
+    38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153,
+    51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,
+   153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,
+   201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102,
+    76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,
+   118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,
+   178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,
+   147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,
+   157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,
+   236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,
+   100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,214,162,212,100,235, 81,147,173, 69,168,201,217, 59,
+    39,100,236,157,147,178,118, 78,201,217, 58,212,100,235, 81,147,173, 69,168,201,217, 58,212, 90,139, 81,147,178,118, 78,201,217,
+    59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,
+   217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,
+   201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 67, 40,100,236,157,147,178,118,
+    78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,
+   118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,
+   178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,
+   147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,
+   157,147,178,118, 78,201,217, 59, 39,100,236,157,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101,
+    12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,
+     7,192,248, 31,  3,224,124, 15,129,240, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  7,208,250, 31, 67,232,
+   125, 12,  1,128, 48,  6,  0,192,202, 89, 83, 41, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 44,173,148,178,150, 82,202, 89,
+    75, 41,101, 44,165,148,178,150, 82,202, 89, 72, 96,101, 44,165,148,178,150, 82, 24, 25, 72, 96,101, 44,164, 48, 50,150, 82, 24,
+    25, 75, 41,101, 44,165,148,178,150, 82,202, 89, 72,153, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90,
+    43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209,
+    90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,
+   209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,
+   138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180,111, 13,225,188, 55,134,240,222, 27,195,120,
+   111, 13,225,188, 55,134,240,222, 27,195,120,111,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48, 10,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,
+   162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173,
+    21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,
+   173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,
+   104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43,
+    69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90,
+    43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209,
+    90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,
+   209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,
+   138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180,
+    86,138,209, 90, 43, 89, 98, 53, 20,130,144, 82, 10, 65, 72, 41,  5, 32,164, 20,130,144, 82, 10, 65, 72, 41,  5, 32,164, 21,162,
+   180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,
+   162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173,
+    21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 12,  1,128, 86,138,209, 90, 43, 69,104,
+   173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,
+   104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43,
+    69,104,173, 12,  1,128, 48,  6,  0,192, 24,  3,  0,164, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 21,162,180, 86,138,209,
+    90, 43, 69,104,173, 21,162,180, 86,138,209, 66, 41,  5, 32,164,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,
+   214, 90,203, 89,107, 45,101,202,149,151,179,  6, 98,204,153,146,174, 85,236,204, 48,  6,  0,192, 24,  3,  0, 96, 14,193,216, 59,
+     7, 96,236, 29,131,176,232, 29,  3,160,116, 14,129,208, 58,  3,168,117, 84,236,209,154, 51, 86,106,171,149,122,174, 85,234,185,
+    87,170,229, 94,171,149,122,174, 85,234,185, 87,170,229, 94,169,213, 58,174, 85,234,157, 83,170,117, 78,205, 89,171, 53,102,204,
+   221,156,  6,  6,114,206,153,219, 59,102,138,173, 86, 42,181, 88,170,213, 99, 60, 84,234,157,158,179,230,126,207,217,248, 96, 84,
+   237,  1,160,170,112,192, 24,  3,  0, 96, 21,162,180, 86,138,209, 90, 24,  5,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173,
+    21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,
+   173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,
+   104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43,
+    69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90,
+    43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209,
+    90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 24,  3,  2, 79, 12, 13,  9,161,180, 70,138,209,154, 27, 71,105, 13, 37,161,180,
+   166,150,211, 26,107, 78,105,237, 61,167,180,246,158,211,218,123, 79,105,237, 61,168, 53, 22,164,212,154,147, 66,104,109, 77,169,
+   181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,
+   169,180,134,134,210, 90,163, 85,106,141, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205,
+    89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 52,134,164,210, 90,147, 72,105, 45, 93,172, 53,150,180,214,218,227, 93,107,
+   173,117,174,181,214,186,215, 90,235, 93,107,205,113,174, 53,198,184,215, 26,227, 92,107,141,113,174, 53,198,184,215, 26,227, 92,
+   107,141,113,174, 53,198,184,215, 26,227, 92,107,141,113,174, 53,198,184,215, 26,227, 92,107,141,113,174, 53,198,184,215, 26,227,
+    92,107,141,113,174, 53,198,184,215, 26,251, 95,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,
+     3, 96,108, 13,129,176, 54,  6,192,216, 27,  3, 96,108, 13,129,176, 54,  6,192,216, 27,  0, 96, 12,  1,129,176, 54,  6,192,216,
+    27,  3, 96, 12,  1,129,176, 54,  6,192,216, 27,  3, 96, 12,  1,129,176, 54,  6,192,216, 27,  3, 96, 12,  1,129,176, 54,  6,192,
+    24,  3,  0, 96,108, 45, 21,169, 53, 70,196,209, 90, 40, 96,108,109,145,178, 54, 70,200,216,219, 24, 96, 74, 41, 69, 40,165, 20,
+   162,148, 82,138, 81, 74, 45,149,178,182, 86,204,152,  3,  0, 96,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,
+   112,192,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,
+   182,118,206,217,219, 56, 96,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,
+   179,134,  6,206,217,195,  3,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,195,  0, 96,108,237,
+   157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,195,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,
+   103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219,
+    59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,
+   219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,
+   217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,103,108,237,157,179,182,118,
+   206,217,219, 59,103,108,237,157,179,134,  0,192, 24,  3,  0, 96, 52,103,  0,209,134,  0,192, 24,  3,  2,241, 94, 43,197,120,175,
+    21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,
+   175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 16,192, 24,  3,  1,122, 47, 69,232,
+   189, 23,162,244, 94,139,209,122,109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,
+   161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 27, 67,104,109,
+    13,161,180, 54,134,208,218, 27, 67,104,109, 13,161,180, 54,134,208,218, 91, 75,105,109, 45,169,181, 54,166,212,218,155, 83,106,
+   109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,180,182,150,212,218,219, 88, 96, 75,169,117, 46,165,212,186,151, 82,234,
+    93, 75,169,117, 46,165,212,186, 24,  3,  0, 96,109, 65,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,
+     0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244,
+    94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,
+   244, 94,139,209,122, 47, 69,232,189, 23,162,244, 58,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,
+     0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,
+     6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   109,141,177,182, 54,198,216,219, 27, 99,108,109,141,177,182, 54,198,216,219, 27, 99,108,109,141,177,182, 54,198,216,219, 27, 99,
+   108,109,141,177,182, 54,198,216, 24,  3,  0, 96,109,173,181,182,182,214,218,219, 91,107,109,109,173,181,182,182,214,218,219, 91,
+   107,109,109,173,181,182,182,214,218,219, 91,107,109,109,173,181,182,182,214,218,219, 91,107,109,109,173,181,182,182,214,218,219,
+    91,107,109,109,173,181,182,182,214,218,219, 91,107,109,109,161,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 29,  9, 93, 43,165,116,174,149,210,186, 87, 74,233, 93, 43,165,116,174,149,210,186, 87, 74,233, 93, 43,165,116,
+   174,149,210,186, 87, 74,233, 93, 43,165,112,192, 24,  3,  0, 96,109,205,185,183, 54,230,220,219,155,115,110,109,205,185,183, 54,
+   230,220,219,155,115,110,109,205,185,183, 54,230,220,219,155,115,110,109,205,185,183, 54,230,220,219,155,115,110,109,237,189,183,
+   182,240,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,219,155,115,110,110, 13,193,184, 55,  6,224,220, 27,131,112,110, 13,193,
+   184, 55,  6,224,220, 27,131,112,110, 13,197,184, 55,  6,224,220, 27,131,112,110, 13,193,184,134,  0,192, 24,  3,  0, 96,110, 77,
+   201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,147,114,110,
+    77,201,185, 55, 38,228,220,155,147,114,110, 77,201,185, 55, 38,228,220,155,155,115,110,109,205,185,134,  0,192, 24,  3,  0, 96,
+   110,141,209,186, 55, 70,232,221, 27,163,116,110,141,209,186, 55, 70,232,221, 27,163,116,110,141,209,186, 55, 70,232,221, 27,163,
+   116,110,141,209,186, 55, 70,232,221,  3,  3,117,110,205,217,187, 55,102,236,221,155,179,118,110,205,217,187, 55,102,236,221,155,
+   179,118,110,205,217,187, 55,102,236,221,155,179,118,110,205,217,187, 55,102,236,221,155,179,118,110,205,217,187, 55, 96,192, 24,
+     3,  0, 96,110,205,217,187, 55,102,236,221,155,179,118,110,237,225,188, 55,134,240,222,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,111, 45,229,188,183,150,242,222, 91,203,121,111, 45,229,188,183,
+   150,242,222, 91,203,121,111, 45,229,188,183,150,242,222, 91,203,121,111, 45,229,188,183,150,242,222, 91,203,121,111, 45,229,188,
+   183,150,242,222, 91,203,121,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,
+   189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,155,211,122,111,109,
+   237,189,183,182,246,222,219,219,123,111,109,237,189,183,182,246,222,219,219,123,111,109,237,189,183,182,246,222,219,219,123,111,
+   109,237,189,183,182,246,222,219,219,123,111,109,237,189,183,182,246,222,219,219,123,111,109,237,189,183,182,246,222,219,219,123,
+   111,141,241,190, 55,198,248,223, 27,227,124,111,141,241,190, 55,198,248,223, 27,227,124,111,141,241,190, 55,198,248,223, 27,227,
+   124,111,141,241,190, 55,198,248,223,  3,  0, 96,111,173,245,190,183,214,250,223, 91,235,125,111,173,244, 48,  6,  0,192, 24,  3,
+     0, 96,111,205,249,191, 55,230,252,223,155,243,126,111,205,249,191, 55,230,252,223,155,243,126,111,205,249,191, 55,230,252,223,
+   155,243,126,111,205,249,191, 55,230,252,223,155,243,126,111,205,249,191, 55,224,192, 24,  3,  0, 96,111,237,253,191,183,246,254,
+   223,219,251,127,111,237,253,191,183,246,254,223,219,251,127,111,237,253,191,183,246,254,223,219,251,127,111,237,253,191,183,246,
+   254,223,219,251,127,111,237,253,191,183,240,192, 24,  3,  0, 96,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,
+     7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192, 56,  7,  0,224, 28,  3,128,112, 14,  1,192,
+    56,  7,  0,224, 28,  3,128, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,112, 46,  5,192,184, 23,  2,224, 92, 11,129,112, 46,  5,
+   192,184, 23,  2,224, 92, 11,129,112, 46,  5,192,184, 23,  2,224, 92, 11,129,112, 46,  5,192,184, 23,  2,224, 92, 11,129,112, 46,
+     5,192,184, 23,  2,224, 92, 11,129,112, 46,  5,192,184, 23,  2,224, 92, 11,129,112, 46,  5,192,184, 16,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  3,130,112,110, 13,193,184, 55,  6,224,220, 27,131,112,110, 13,193,134,  7,  6,224,220, 27,131,
+   112,110, 13,193,184, 55,  6,224,220, 27,131,112,110, 13,193,134,  7,  6,224,220, 27,131,112,110, 13,193,134,  7,  6,224,195,  3,
+   132,112,142, 17,194, 56, 71,  8,225, 28, 35,132,112,142, 16, 48, 56, 71,  8,225, 28, 35,132,112,142, 17,194, 56, 71,  8,225, 28,
+    35,132,112,142, 16, 48, 56, 71,  8,225, 28, 35,132,112,142, 16, 48, 56, 71,  8, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184,
+    87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,
+   184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,
+   194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174,
+    21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,
+   174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,
+   112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,
+   133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 92,
+    43,133,112,174, 21,194,184, 87, 10,225, 92, 40, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,112,174, 21,194,184, 87, 10,225,
+    92, 43,133,112,174, 21,194,184, 87, 10,225, 92, 43,133,112,174, 21,194,184, 87, 10,225, 67,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96,112,174, 21,194,184, 87, 10,225, 92, 43,133, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,  8, 46, 25,195,  4, 16,130, 16, 67,  0, 65,  8, 33,  4, 32,132,
+    16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,
+   132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 16, 66,  8, 65,  8, 33,128, 32,132, 16,130, 16, 66,  8, 65,  8, 33,  4,
+    32,134,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   112,238, 29,195,184,119, 14,225,195,  0, 96,112,225,129,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,
+   135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220, 59,135,112,238, 29,195,184,119, 14,225,220,
+    59,135,112,238, 29,195,184,119, 14,225,195,  3,135,112,225,128, 48,  6,  7, 14, 24,  3,  3,135,113, 14, 33,196, 56,135, 16,226,
+    28, 67,136,113, 14, 33,196, 56,135, 16,226, 28, 67,136,113, 14, 33,196, 56,135, 16,226,  3,  3,137,113, 78, 41,197, 56,167, 20,
+   226,156, 83,138,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,184,183, 22,226,220, 91,139,113,110, 45,197,184,183,
+    22,226,220, 91,140,113,142, 53,198,184,215, 26,227, 92,107,141,113,206, 57,199, 56,231, 28,227,156,115,142,113,206, 57,199, 56,
+   231, 28,227,156,115,142,113,206, 57,199, 56,231, 28,227,156,115,142,113,206, 57,199, 56,231, 28,227,156,112, 96, 12,  1,128, 48,
+     6,  0,192, 24,  3,  3,143,113,238, 61,199,184,247, 30,227,220,123,143, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,114, 14, 65,200, 57,  7, 32,228, 28,131,144,114,
+    14, 65,200, 57,  7, 32,228, 28,131,144,114, 14, 65,200,  6,  7, 32,228,  3,  0, 96, 12,  1,128, 48, 57, 23, 34,228, 92,139,145,
+   114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,155,
+   147,114,110, 77,201,185, 48,192, 24,  3,  3,148,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,
+   171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 84, 48,  6,  0,192, 24,  3,  3,150, 12,  1,128, 48,  6,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,114,238, 93,203,185,119, 46,229,220,187,151,114,238, 93,203,185,
+   119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,115, 14, 97,204,
+    57,135, 48,230, 28,195,152,115, 14, 97,204, 57,135, 48,230, 28,195,152,115, 14, 97,204, 57,135, 48,230, 28,195,152, 12,  1,128,
+    48,  6,  7, 50,230, 92,195,152,115, 46,101,204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230, 92,203,153, 12,  1,
+   129,204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230, 92,203,153,115,
+    46,101,204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230, 92,203,153,
+   115, 78,109,205,185,176,192,230,220,216, 96, 12,  1,128, 48,  6,  7, 54,231, 28,219,157,115, 78,105,205, 57,160,192,230,156,211,
+   154, 12, 14,105,205, 57,167, 52,230,156,211,154,115, 78,105,205, 57,167, 52,230,156,211,154,115, 78,105,205, 57,167, 52,230,156,
+   211,154,115, 78,105,205, 57,167, 52,230,131,  0, 96,115,174,121,206,  6,  0,192, 24,  3,  3,159,116, 14,129,208, 58,  7, 64,232,
+    29,  3,160,116,  1,128, 48,  6,  0,192, 24,  3,  0, 96,116, 46,133,208,186, 23, 66,232, 93, 19,162,116, 97,128, 48,  6,  0,192,
+    24,  3,  0, 96,116,142,145,210, 58, 71, 72,233, 29, 35,164,116,142,145,210, 58, 71, 72,233, 29, 35,164,116,142,145,210, 58, 71,
+    72,233, 29, 35,164,116,142,145,210, 58, 71, 72,233, 93, 43,166,116,238,157,211,186,119, 78,233,221, 59,167,116,238,157,211,186,
+   119, 78,233,221, 59,167,116,238,157,211,186,119, 78,233,221, 59,167,116,238,157,211,186,119, 78,234, 29, 67,168, 12,  1,128, 48,
+     6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 78,165,212,186,151, 82,234, 93, 75,169,117, 46,
+   165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234,221, 96, 96, 12,
+     1,128, 48, 58,215, 90,235, 93,107,173,117,206,185,215, 58,231, 92,235,157,120, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,
+   176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,131,176,118, 14,193,216, 59,  7, 96,236, 29,
+   131,176,118, 14,193,216, 59,  7, 96,236,  3,  0, 96, 12, 14,197,216,187, 23, 98,236, 93,139,177,118, 78,201,217, 59, 39,100,236,
+   157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,131,  0, 96,118,110,205,217,187, 55,102,
+   236,221,155,179,118,142,209,218, 59, 71,104,237, 29,163,180,118,142,209,218, 59, 71,104,237, 29,163,180,118,142,209,218,  6,  0,
+   192, 24,  3,  0, 96,118,174,213,218,187, 87,106,237, 93,171,181,118,206,217,219, 59,103,108,237,157,179,182,118,206,217,219, 59,
+   103,108,237,157,179,182,118,206,216, 48,  6,  0,192, 24,  3,  0, 96, 12, 14,221,219,187,119,110, 24,  3,  0, 96, 12,  1,128, 48,
+     6,  0,192, 24,  3,  0, 96, 12, 14,225,220, 59,135,112,238, 29,195,184, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,238, 93,203,
+   185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,238, 93,
+   203,185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,238, 93,203,185,119, 46,229,220,187,151,114,238,
+    93,203,185,119, 33,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,119, 78,233,221, 59,167,116,238,157,211,186,119, 78,233,221, 59,
+   167,116,238,157,211,186,119, 78,233,221, 59,167,116,238,157,211,186,119, 78,233,221, 59,167,116,238,157,211,186,119, 78,233,221,
+    59,167,116,238,157,211,186,119, 78,233,221, 59,167,116,238,157,211,186,119, 78,233,221,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,
+   237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,110,237,221,187,183,118,238,221,219,187,119,
+   110,237,221,187,183,118,238,221,219,187,119,110,237,221,134,  0,192, 24,  3,  0, 96, 12,  1,129,222, 59,199,120,239, 29,227,188,
+   119,174,245,222,187,215,122,239, 93,235,189,119,174,245,222,187,215,122,239, 93,235,189,119,174,245,222,187,215,122,239, 93,235,
+   189,119,174,245,222,187,215,122,239, 93,235,189,119,174,245,222,187,215,124,239,157,243,190, 12,  1,128, 48,  6,  0,192, 24,  3,
+     0, 96,119,238,253,223,187,247,126,239,221,251,191,119,238,252, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,
+     0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,
+     6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,120, 15,  1,224, 60,  7,128,240, 30,  3,192,120,
+    15,  1,224, 60,  7,128,240, 30,  3,192,120, 15,  1,224, 60,  7,128,240, 30,  3,192,120, 15,  1,224, 60,  7,128,240, 30,  0, 96,
+   120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,
+   193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  5,224,188, 23,130,240, 94, 11,193,120, 47,  4, 48, 60, 39,132,240,195,
+     0, 96,120, 47,  4, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 46,133,208,186,120,143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60,
+    71,136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 30, 35,196,120,143, 17,226, 60, 71,136,241, 94, 43,197,120,175, 21,226,
+   188, 87,138,241, 94, 43,196, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,120,207, 25,227, 60,103,140,241,158, 51,198,120,207, 25,
+   227, 60,103,140,241,158, 51,198,120,207, 25,227, 60,103,140,241,158, 59,199,121, 15, 33,228, 60,119,144,241,222, 59,199,120,239,
+    37,228,188,151,146,242,158, 83,202,121, 79, 40, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96,121,111, 45,229,188,183,150,242,222, 91,203,121,111, 45,229,188,183,150,242,222, 91,203,
+   121,111, 45,230, 60,215,152,243, 94,115,206,121,207, 56, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0,
+    96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,
+     0, 96,121,239, 61,231,188,247,158,243,222,123,207,121,239, 61,231,188,247,158,243,222,123,207,121,239, 61,231,188,247,158,244,
+    30,131,208,122, 15, 65,232, 61,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,
+   162,244, 94,136, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,122, 79, 77,233, 61, 71,168,245, 30,163,212,122,143, 81,234, 61,
+    71,168,245, 30,163,212,122,143, 81,234, 61, 71,168,245, 30,163,212,122,143, 81,234, 61, 71,168,245, 30,163,212,122,143, 81,234,
+    61, 71,168,245, 30,163,212,122,143, 81,234, 61, 71,168,245, 30,163,212,122,143, 81,234, 61, 71,168,245, 30,163,212,122,111, 77,
+   233,189, 55,166,244,222,155,211,122,111, 77,233,189, 55,166,244,222,171,214,122,207, 93,235,189,119,174,245,195,  0, 96, 12,  1,
+   129,236, 61,135,176,246, 30,195,216,123, 15, 97,236, 61,135,176,246, 30,195,216,123, 15, 97,236, 61,135,176,246, 30,203,217,123,
+    47,101,236,189,151,178,246, 94,203,217,122,175, 81,234, 61, 55,166,245,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  3,213,
+   123, 79,105,237,189,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,
+   220,123,143,113,238,189,199,186,247, 30,227,220,123,143,113,238, 61,199,184,247, 30,227,220,123,143,113,238, 61,215,184,247, 30,
+   227,220,123,111,109,237,189,167,180,246,158,211,219,123,111,121,239,190,  7,192,248, 95, 19,226,124, 79,137,237,  6,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192,248, 67,  0, 96,124,111,141,241,190, 55,198,248,223, 27,227,124,111,141,241,190, 55,198,
+   248,223, 27,227,124,111,141,241,190, 55,198,248,223, 27,227,124, 97,128, 48,  6,  0,192, 24,  3,  0, 96,124,143,145,242, 62, 71,
+   200,249, 31, 35,228,124,143,144, 48,  6,  0,192, 24,  3,  0, 96,124,175,149,242,190,103,204,249,159, 51,230,124,207,153,243, 62,
+   103,204,249,159, 51,230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,243, 62,103,204,249,159, 51,230,124,207,153,243,
+    62,103,204,249,159, 51,231,125, 15,161,244, 62,135,210,250, 31, 83,234,125, 15,161,244, 62,183,214, 24, 31, 99,236,125,143,177,
+   246, 62,199,216,251, 31, 99,236,125,175,185,247, 62,231,204,250, 95, 75,230, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,125,239,
+   189,247,190,247,222,251,223,123,239,125,239,189,247,190,247,222,251,223,123,239,125,239,189,247,190,247,222,251,223,123,239,125,
+   239,189,247,190,247,222,251,223,123,239,125,239,189,247,191,  7,226,252,159,120, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   126,111,205,250, 63, 87,234,253, 95,171,245,126,175,213,250,191, 87,234,253, 95,171,245,126,175,213,250,191, 87,234,253, 95,171,
+   245,126,175,213,250,191, 87,234,253, 95,171,245,126,175,213,250,191, 87,234,253, 95,171,245,126,175,213,250,191, 87,234,253, 95,
+   171,245,126,175,213,250,191, 71,232,253, 31,155,243,126,111,205,249,191, 55,230,252,223,155,244,126,207,213,251,191,119,234,254,
+    31,195,249,127, 79,205,253,191, 55,230,255, 31,163,243,127,175,245,254,191,215,250,255, 95,235,253,127,175,245,250,191,231,234,
+   254,159,195,248, 12, 15,253,255,191,247,254,255,223,251,255,127,239,253,255,191,247,254,255,223,251,255,127,239,253,255,191,247,
+   254, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,
+     8,  1,  0, 32,  4,  0,128, 16,  0, 48, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0,
+    64,  8,  1,  0, 32,  4,  0,128, 16,  2,  0, 64,  8,  3,  0, 96, 12,  2,128, 80, 10,  0,192, 24,  5,  0,224, 36,  2,128,176, 22,
+     3, 64, 88, 11,  1,160, 20,  0,128, 16,  8, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   128,240, 30,  3,192,120, 15,  1,224, 56, 96,128,225,130,  3,192,120, 15,  1,195,  4,  7,128,240, 30,  3,192,120, 15,  1,224, 60,
+     7,128,240, 30,  3,192,120, 15,  1,195,  4,  7,128,240, 30,  3,192,120, 15,  1,224, 60,  7,128,240, 32, 48,  6,  0,192, 24,  3,
+     0, 96,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2,
+    96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,  2, 96, 76,  9,129, 48, 38,  4,192,152, 19,
+     2, 96, 76, 10,129,112, 46,  5,192,168, 21,  2,160, 84, 10,129, 80, 50,  6,134,  0,192, 24,  3,  0, 96,129,208, 58,  7, 64,232,
+    29,  3,160,116, 14,129,208, 56, 48,  6,  0,192, 24,  3,  0, 96,129,240, 62,  8, 65,  0,193,  4, 96,140, 17,130, 48, 70,  8,193,
+    24, 34, 24,  3,  4, 17,130, 33,128, 48, 65, 24, 35,  4, 96,140, 17,130, 48, 70,  8,193, 24, 35,  4, 96,140, 17,130, 48, 70,  8,
+   193, 24, 35,  4, 96,140, 17,130, 33,130,  8,193, 24, 35,  4, 96,140, 17,130, 33,130,  8,193, 16,193,  4, 96,140, 17,130, 48, 68,
+    48, 65, 40, 39,  4, 96,164, 16,129,240, 66,  8, 65,  8, 32, 24,  3,  4, 16,130,  1,128, 48, 65, 88, 43,  5,131,  0, 96,130, 33,
+   128, 48,  6,  0,192, 24,  3,  4, 20, 12,  1,128, 48,  6,  0,193,  4, 96,140, 17,130, 48, 70,  8, 65,  0,192, 24, 32,188, 23,130,
+   240, 94, 11,193,120, 46, 24,  3,  0, 96,130,240, 94, 11,193,120, 46, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   131, 16, 98, 12, 65,136, 49,  6, 32,196, 24,131, 16, 98, 12, 65,136, 49,  6, 32,196, 24,131, 16, 98, 12, 65,136, 49,  6, 32,196,
+    24,131, 16, 98, 12, 65,136, 49,  6, 32,196, 24,131, 16, 98, 12, 65,136, 49,  6, 32,196, 24,131, 16, 98, 12, 65,136, 49,  6, 32,
+   196, 24,131, 16, 98, 12, 65,136, 49,  6, 96,204, 25,131, 80,106, 13, 65,168, 53,  6,160,212, 26,131, 48,102, 13,193,168, 53,  6,
+    96,228, 24,131, 16, 98, 12, 65,216, 59,  7,160,244, 31,132, 16,130, 16, 66,  8, 65,  8, 33,  4, 32,132, 16,130, 15, 65,224,193,
+     7,225, 12, 24,131, 16, 96, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66,
+    40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17,
+    66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132,112,146, 18, 66, 88, 75,  9, 97, 44, 37,132,176,146,
+    19, 66,120, 79,  8,225, 60, 37,132,176,146, 20, 66,152, 69,  8,161, 84, 34, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,133,112,
+   174, 21,194,184, 87, 10,225, 92, 43,133,112,172, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100,
+    44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,
+   100, 45,133,208,186, 23,194,248, 95, 11,195,  0, 96,133,208,186, 24, 67,  8, 95, 11,225,116, 49,134, 80,206, 26, 67, 72,107, 13,
+    97,180, 54,134,208,210, 26, 67, 72,105, 13, 33,164, 52,134,144,210, 26, 67, 72,105, 13, 33,164, 52,133,144,178, 22, 66,200, 95,
+    11,195,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,134,240,222, 27,195,120,111, 13,225,188, 55,134,240,222, 27,195,
+   120,111, 13,225,188, 55,134,240,222, 27,195,120,111, 13,225,188, 55,134,240,222, 27,195,120,111, 13,225,188, 55,134,240,222, 27,
+   195,120,111, 13,225,188, 55,134,240,222, 27,195,120,111, 13,225,188, 55,135, 16,226, 28, 67,152,115, 14, 97,204, 57,135, 48,230,
+    28,195,136,113, 14, 97,196, 58,135, 48,238, 29,195,200,110, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,135,176,
+   246, 30,195,216,123, 15, 97,236, 61,135,176,244, 48,  6,  0,192, 24,  3,  0, 96,135,208,250, 31, 67,232,125, 15,161,244, 62,135,
+   208,250, 31, 67,232,124, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252,
+    63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,195,248,127, 15,225,252, 63,135,240,254, 31,196,  8,131, 16, 34,
+    12, 65,136, 17,  2, 32, 68,  8,129, 16, 34, 20, 67,135,241, 16, 48,  6,  0,192, 24,  3,  0, 96,136,177, 22, 34,196, 88,139, 17,
+    98, 44, 69,136,177, 20, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,136,209, 26, 35, 68,104,141, 17,162, 52, 70,136,209, 26, 35, 68,
+   104,141, 17,162, 52, 70,136,209, 26, 35, 68,104,141, 17,162, 52, 70,136,209, 26, 35,  6,  0,193, 17,226, 60, 71,137, 17, 34, 35,
+   196,120,143, 17,226, 76, 71,136,241, 30, 35,196,160,192, 24,  3,  0, 96,137,113, 46, 37,196,184,151, 18,226, 92, 75,137,113, 46,
+    38, 68,200,155, 19, 98,108, 78,136,209, 26, 35, 68,104,141, 17,162, 48, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,159, 19,226,124,
+    79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,161, 20, 34,
+   132, 81,138, 49, 70, 40,197, 24,163, 20, 98,140, 81,138, 17, 74, 41,197, 64,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,
+     0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,138,177, 86, 42,
+   197, 88,171, 21, 98,172, 85,138,177, 86, 42,197, 88,171, 21, 98,172, 85,138,177, 86, 42,197, 88,171, 21, 98,172, 85,138,177, 86,
+    42,197, 88,171, 21, 98,172, 85,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209,
+    90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,241, 94, 43,197,120,175, 21,226,188, 87,138,
+   241, 94, 44, 69,136,177, 22, 34,196, 88,139, 17, 98, 44,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  4, 89,
+   139, 81,106, 45, 69,168,181, 22,162,208, 96, 12, 17,104, 48,  6,  8,181, 22,162,212, 90,139, 81,106, 45, 69,160,193, 22,162,208,
+    96,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,
+   212, 90,139,113,114, 46, 69,200,185, 23,  3,  4, 92,139,161,128, 48, 69,232,189, 23,227,  4, 97,139,145,134, 46, 70, 40,199, 25,
+    35, 24, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,148, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,
+     0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,140,209,154, 51,
+    70,104,205, 25,163, 52,102, 12,  1,130, 51, 70,104,205, 25,163, 52,102,140,209,154, 51, 70,104,205, 25,163, 52,102,140,209,154,
+    51, 70,104,205, 25,163, 52,102,140,209,154, 51, 70,104,205, 25,163, 52,102,140,209,154, 51, 70,104,205, 25,163, 52,102,140,209,
+   158, 51,198,120,209, 26, 35, 68,104, 12,  1,130, 52, 70,136,207, 25,227, 60,103,141, 49,154, 53, 70,104,206, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   141,113,178, 54, 70,200,217, 27, 35,100,109,141,177,178, 54, 70,184,215, 26,227, 92,107,141,113,174, 53,198,184,215, 26,227, 92,
+   107,141,113,174, 53,198,184,215, 26,227, 92,107,141,113,174, 53,198,184,215, 26,227, 92,107,141,113,174, 53,198,184,215, 26,227,
+    92,107,141,113,174, 53,198,200,221, 27, 35,100,108,141,145,190, 56, 70,200,217, 27, 35,100,113,142, 81,206, 58, 71, 72,231, 28,
+    99,148,110, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,142,177,218, 59, 71,104,237, 29,163,180,119,142,241,218, 59, 71,104,235,
+    29, 99,172,117,142,177,214, 58,199, 88,235, 29, 99,172,117,142,177,214, 58,199, 88,235, 29, 99,172,117,142,177,214, 58,199, 88,
+   235, 29, 99,172,117,142,177,214, 58,199, 88,235, 29, 99,172,117,142,177,214, 58,199, 88,241, 30, 35,196,120,143, 17,226, 59, 71,
+   104,237, 29,163,180,118,142,209,218, 59, 71,104,237, 29,163,180,119,142,209,230, 61, 71,184,247, 29, 99,228,124,143,145,234, 61,
+     6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,
+   205,153,179, 54,102,204,217,155,143,177,246, 62,199,216,251, 31, 99,236,125,143,177,246, 62,199,216,251, 31, 99,236,125,143,177,
+   246, 62,199,216,251, 31, 99,236,125,143,177,246, 62,199,216,251, 31, 99,236,125,143,177,246, 62,199,216,251, 31, 99,236,125,143,
+   177,246, 62,199,216,251, 31, 99,236,125,143,177,246, 62,199,216,251, 31, 99,236,125,143,161,128, 48,  6,  0,192, 24,  3,  0, 96,
+    95,139,241,126, 47,197,248,191, 23,226,252, 95,139,240, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0,
+    96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,
+     0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,143,209,250, 63, 71,232,253, 31,163,244,126,143,193,130, 63, 71,
+   232,253, 31,163,244,126,143,209,250, 63, 71,232,253, 31,163,244,126,143,209,250, 63, 71,232,253, 31,163,244,126,143,209,250, 63,
+    71,232,253, 31,163,244,126,143,209,250, 63, 71,232,253, 31,163,244,127,144, 18,  2, 64, 72,  9,  1, 32, 36,  0, 96,144, 18,  2,
+    64, 72,  9,  1, 32, 35,252,129,143,210, 10, 65, 72, 57,  7, 32,195,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,144,146,
+    18, 66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,
+   178, 22, 66,200, 89, 10, 24,  3,  0, 96,144,210, 30, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,
+   145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136, 12,  1,130, 68,200,153, 19, 34,100, 76,
+   137,145, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,137, 12, 18, 42, 68,200,153, 19, 34,100,
+    76,137,145, 50, 42, 68,200,153, 21, 34,100, 72, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,145,114, 46, 69,200,185, 23, 34,228, 88, 96,145,114, 44, 48, 72,
+   185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 46, 69,
+   200,185, 23, 34,228, 92,139,145,114, 46, 69,200,185, 23, 34,228, 92,139,145,114, 50, 70, 72,201, 25, 35, 36, 96, 96, 12,  1,130,
+    70,  6,  9, 25, 35,  3,  4,140,145,146, 50, 70,200,201, 29, 35,164,124,140, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,146, 18,
+    66, 72, 73,  9, 33, 36, 36,132,144,146, 18, 64, 48,  6,  0,192, 24,  3,  0, 96,146, 50, 70, 72,201, 25, 35, 36, 67,  4,145,146,
+    33,130, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140,145,
+   146, 50, 70, 72,201, 25, 35, 36,100,140,145,146, 50, 70, 73, 73, 41, 37, 36,164,144, 96,146,114, 76, 48, 73, 41, 37, 36,228,148,
+   148,146, 33,128, 48,  6,  0,192, 24,  3,  0, 96,146,178, 86, 74,201, 89, 43, 37,100,172,149,146,178, 84, 48,  6,  0,192, 24,  3,
+     0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,
+     0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,
+     6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,146,210, 90, 75, 73,105, 45, 37,164,180,150,146,
+   210, 90, 75, 73,105, 45, 37,164,180,150,146,210, 90, 75, 73,121, 47, 38, 36,196,153,147, 33,128, 48,  6,  0,192, 24,  3,  0, 96,
+   147, 82,106, 77,201,201, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,161,130, 78,201,217, 59, 39,100,236,
+   157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,
+   236,157,147,178,118, 78,201,217, 57, 39, 36,212,154,147, 82,106, 77,  6,  0,192, 24, 36,228,156,147, 82,122, 79,202,  9, 65, 40,
+   101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,136, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,
+     0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,
+     6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 91,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,136,145, 18, 34, 68, 72,137, 17, 34, 36, 68,
+   136,145, 18, 34, 68, 72,201, 25, 35, 36,100,140,145,146, 50, 71, 40,229, 28,163,148,100,140,145,146, 50, 70, 72,201, 25, 35, 36,
+   100,140,145,146, 50, 70, 72,201, 25, 35, 36,100,140, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  4,164,
+   148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,
+   165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101,
+    44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,
+   101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75,
+    41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89,
+    75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202,
+    89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,148, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,
+     6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   148,210,154, 83, 74,105, 77, 41,165, 52,166,148,210,154, 83, 74,105, 77, 41,165, 52,166,148,210,154, 83, 74,105, 77, 41,165, 52,
+   166,148,210,154, 83, 74,105, 77, 41,165, 52,166,148,210,154, 83, 74,105, 77, 41,165, 52,166,148,210,154, 83, 74,105, 77, 41,165,
+    52,166,148,210,154, 83, 74,105, 77, 41,165, 52,166,148,210,154, 83, 74,105, 77, 41,165, 52,166,148,210,154, 83, 74,105, 77, 41,
+   165, 52,166,148,210,154, 83, 74,105, 77, 41,165, 52,166,148,210,154, 83, 74,105, 77, 41,165, 52,166,148,210,154, 83, 74,105, 77,
+    41,165, 52,166,148,210,154, 83, 74,105, 77, 41,165, 52,166,148,210,154, 83, 74,105, 77, 41,165, 48, 96,148,242,158, 83,202,121,
+    78, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202,
+    89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,
+   202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 89, 75, 41,101, 44,165,148,178,150,
+    82,202, 89, 75, 41,101, 44,165,148,178,150, 82,202, 80,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+    12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,149, 18,162, 84, 74,137, 81, 42, 37, 68,
+   168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37,
+    68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42,
+    37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81,
+    42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,162, 84, 74,137, 81, 42, 37, 68,168,149, 18,166, 84,134,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,
+   169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85,
+    74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170,
+    85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,
+   170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149,
+    82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,
+   149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,
+   170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165,
+    84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,
+   165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149,114,174, 85,202,201, 89,
+    43, 37, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169,
+    85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 86, 74,169, 85, 42,165, 92,172,149,114,178, 85, 74,
+   169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85,
+    74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170,
+    85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,
+   170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149,
+    82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,
+   149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,
+   170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165,
+    84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,
+   165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85,
+    42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169,
+    85, 42,165, 84,170,149, 82,174, 86, 74,201, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,
+   169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149, 82,170, 85,
+    74,169, 85, 42,165, 84,170,149, 82,170, 85, 74,169, 85, 42,165, 84,170,149,178,182, 86,202,217, 91, 43,101,108,174,149,242,182,
+    86,202,217, 93, 43,229,116,175,150, 18,170, 85, 74,169, 85, 42,165, 84,176,150, 18,194, 88, 75,  9, 97, 44, 37,132,176,150, 18,
+   194, 88, 75,  9, 97, 44,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,
+   177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,
+   140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,
+   101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99,
+    44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25,
+    99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203,
+    25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,
+   203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198,
+    88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,148,179,150, 50,
+   198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150,
+    50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,
+   150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,
+   177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,
+   140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,101,140,177,150, 50,198, 88,203, 25, 99, 44,
+   101,136, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174,
+    85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,
+   174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,
+   114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,
+   149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,
+   171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229,
+    92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,
+   229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,171,149,114,174, 85,202,185, 87,
+    42,229, 92,171,149,114,174, 85,202,185, 87, 42,229, 92,161,128, 48,  6,  0,192, 24,  3,  0, 96,150,146,210, 90, 75, 73,105, 45,
+    37,164,180,150,146,210, 90, 75, 73,105, 45, 37,164,180,150,146,210, 90, 75, 73,105, 45, 37,164,180,150,146,210, 90, 75, 73,105,
+    45, 37,160, 96,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,212, 48,  6,  0,192, 24, 37,180,182,150,242,222, 91,203,121,
+   111, 45,229,188,183,150,242,222, 91,203,121,111, 45,229,188,183,150,242,222, 91,203,121,111, 45,229,188,183,150,242,222, 91,203,
+   121,111, 45,229,188,183,150,242,222, 91,203,121,111, 45,229,188,183,150,242,222, 91,203,121,111, 45,229,188,183,150,242,222, 91,
+   203,121,111, 45,229,188,183,150,242,222, 91,203,121,111, 45,229,188,183,150,242,222, 91,203,121,111, 45,229,188,183,150,242,222,
+    91,203,121,111, 45,229,184, 96,151, 18,226, 92, 75,137,113, 46, 37,196,184,151, 18,224, 48,  6,  0,192, 24,  3,  0, 96,151, 50,
+   230, 92,203,153,115, 46,101,204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151,
+    50,230, 92,203,153,115, 46, 67,  0, 96,151, 82,234, 93, 75,169,117, 46,195,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,
+   188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,
+   228,188,151,178,246, 94,203,217,123, 47,101,236,190,151,210,254, 96, 76,  9,131, 48,102, 12,193,152, 83, 10, 97, 76, 41,125, 48,
+    67,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,152,115, 14, 97,204, 57,135, 48,230, 28,195,152,115, 12, 48, 76, 73,137,
+    49, 38, 36,196,152,147, 16, 48, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,
+   121, 47, 37,228,188, 12,  1,128, 48,  6,  0,193, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,
+   201,121, 47, 37,228,188, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,
+     6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+    12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0,
+    96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,
+     0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,152,179, 22, 98,204, 89,139, 49,
+   102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139,
+    49,102, 44,197,152,211, 26, 99, 76,105,141, 49,166, 52,198,152,211, 26, 99, 76,105,141, 49,166, 52,198,152,211, 26, 99, 76,105,
+   141, 49,166, 52,198,152,211, 26, 99, 76,105,141, 49,166, 52,198,152,243, 30, 99,204,121,143, 49,230, 60,199,152,243, 30, 99,204,
+   121,143, 49,230, 60,199,152,243, 30, 99,204,121,143, 49,230, 60,200,153, 51, 42,101,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,
+     6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   153,115, 46,101,204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230, 92,
+   203,153,115, 46,101,204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230,
+    92,203,153,115, 46,101,204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151, 50,230, 92,203,153,115, 46,101,204,185,151, 50,
+   230, 92,203,153,115, 46,101,134,  0,192, 24,  3,  4,204,153,115, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155,
+    51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,
+   155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205,153,179, 54,102,204,217,155, 51,102,108,205, 12,  1,128, 48,  6,
+     0,192, 24,  3,  4,204,153,147, 50,102, 76,233,157, 51,166,116,206,153,211, 58,103, 76,233,157, 51,166,116,206, 12,  1,128, 48,
+     6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,153,243, 66,104,170,137,164, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96,154,115, 76, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,
+   212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,
+   164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53,
+    38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169,
+    53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,
+   169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77,
+    73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106,
+    77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,
+   106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147,
+    82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212,154,
+   147, 82,106, 77, 73,169, 53, 38,164,212,154,147, 82,106, 77, 73,169, 53, 38,164,212, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,
+   213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,
+   172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,
+   102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171,
+    53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,
+   171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205,
+    89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,
+   205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,
+   106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179, 86,106,205, 89,171, 53,102,172,213,154,179,
+    86,106,205, 89,171, 53, 67,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   154,147, 82,106, 77, 73,169, 53, 38,164,212,154,129,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0,
+    96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,
+     0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,
+     0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,
+     6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96,154,211, 90,107, 77, 96,193, 53,166,180,214,154,211, 90,107, 77, 96,193, 53,166,176, 96,
+    88,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,
+   188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,
+   226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175,
+    21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,
+   175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,
+   120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,
+   197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94,
+    43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241,
+    94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,
+   241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,
+   138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188,
+    87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,
+   188, 87,138,241, 94, 43,197,120,175, 21,226,188, 88,139, 17, 98,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,
+     0, 96, 12,  1,129, 93,134,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 87,106,237, 93,134,  0,192,176,195,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  5,134,176,214, 26,195, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,154,243, 94,107,205,121,
+   175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,
+   121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,
+   205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,
+   107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243,
+    94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,
+   243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,
+   154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,
+   215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,
+   188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,
+   230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175,
+    53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,175, 53,230,188,215,154,243, 94,107,205,121,
+   175, 53,230,188,215,154,243, 94,107,205,112,192, 24,  3,  0, 96,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,
+   137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108,
+    77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,
+   108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19,
+    98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,177, 54, 38,196,216,155,
+    19, 98,108,  6,  0,192, 24,  3,  0, 96,155, 19, 98,108, 77,137,177, 54, 38,196,216,155, 19, 98,108, 77,137,176, 24,  3,  0, 96,
+   155, 19, 98,108, 77,137,177, 54, 38,196,216,155,  1,128, 48,  6,  0,192, 24,  3,  0, 96,155, 19, 98,108, 77,137,177, 54, 38,196,
+   216,155, 19, 96, 48,  6,  9,179, 54,166,220,220, 74,201, 89, 43, 37, 96,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,
+     0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,155,179,118,110,205,217,187, 55,102,236,221,155,179,118,110,205,
+   217,187, 55,102,236,221,155,179,118,110,205,217,187, 55,102,236,221,155,179,118,110,205,217,187, 55,102,236,221,155,179,118,110,
+   205,217,187, 55,102,236,221,155,179,118,110,205,217,187, 55, 67,  0, 96,155,179,118,110,205,217,187, 55,102,236,221,155,179,118,
+   110,205,217,187, 55,102,236,221,155,179,118,110,205,217,187, 55,102,232, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 47, 69,
+   232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47,
+    69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122,
+    47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,
+   122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,
+   209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,160,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,
+   162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189,
+    23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,
+   189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,
+   232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47,
+    69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122,
+    47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,
+   122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,
+   209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,
+   139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244,
+    94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,
+   244, 94,131,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,
+   162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189,
+    23,162,244, 94,139,208, 96, 12,  5,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,
+   189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,
+   232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,166,244,222,155,211,122,111, 77,233,189, 55,231,  2, 19, 66,
+   104, 76,189, 23,162,245, 56,102,252,223,155,243,126,111,165,100,172,149,146,178, 86, 74,201, 89, 43, 14,129,208, 58,  7, 64,232,
+    29,  3,160,116, 23,162,244, 29,131,176,118, 14,193,216,116, 14,130,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,
+   122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232, 59,  7, 96,236, 29,139,
+   209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 77,233,189, 55,166,244,222,155,197,232,189, 23,162,244, 94,
+   139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 69,232,189, 23,162,244,
+    94,139,209,122, 47, 69,232,189, 23,162,244, 94,139,209,122, 47, 73,117, 46,134,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,
+   166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181,
+    54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,181, 54,166,212,218,155, 83,106,109, 77,169,
+   181, 54,166,212,218,155, 83,106,109, 77,170,113, 78, 41,196,218,131,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+    12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0,
+    96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,
+     0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 94, 43,197,120,175, 21,226,188,
+    87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 16,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 16,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,
+   212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,
+   165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117,
+    46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,
+   117, 46,165,212,186,151, 82,232, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 94, 43,197,120,175, 21,226,188, 87,138,241, 94,
+    43,197,120,175, 21,226,188, 87,138,241, 94, 43,197,120,175, 21,226,188, 87,138,241, 94, 33,128, 48,  6,  0,192, 24,  3,  0, 96,
+    75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242,
+    94, 75,201,120, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,
+   152, 51,  6, 96,204, 25,131, 52,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,
+   146,242, 94, 75,201,121, 47, 37,228,188,151,129,152, 51,  6, 96,204, 25,131, 48,102, 24,  1,152, 51,  6, 96,204, 25,131, 48,102,
+    12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,
+   188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,120, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131,
+    48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 52,188, 24, 18,242, 94, 12,  1,129, 47,
+     6,  0,192,151,146,240, 96, 12,  9,121, 47, 37,228,188, 24, 18,242, 94, 75,201,121, 47, 37,228,188,151,129,152, 51,  6, 96,204,
+    48,  3, 48,192, 12,193,152, 51,  6, 96,204, 25,131, 48,192, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51, 75,201,
+   121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,
+   201,120, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,
+     6, 96,204, 25,131, 52,188,151,131,  2, 94, 75,201,121, 47,  6,  0,192,151,146,242, 94, 75,201,121, 47, 37,228,188, 24, 18,242,
+    94, 75,201,121, 47, 37,228,188, 24,  1,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,
+   152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51, 75,201,120, 48, 37,228,188,151,146,240, 96, 75,201,121, 47, 37,228,188, 24,
+    18,240, 96, 12,  1,129, 47, 37,228,188,151,146,242, 94, 75,193,128, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102,
+    12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 52,188,151,146,242, 94, 75,201,121, 47, 37,228,
+   188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,129,152, 51,  6, 96,204, 25,131,
+    48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51, 75,201,121, 47,
+    37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,120,
+    25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,
+   204, 25,131, 52,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,
+   201,121, 47, 37,228,188,151,129,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,
+     6, 96,204, 25,131, 48,102, 12,193,152, 51, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242,
+    94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,120, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,
+   152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 52,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,
+   146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,129,152, 51,  6, 96,204, 25,131, 48,102,
+    12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51, 75,201,121, 47, 37,228,
+   188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,120, 25,131,
+    48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,
+   131, 48,102, 12,195,  0, 96, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121,
+    47, 37,228,188,151,146,242, 94, 75,211,140, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,
+   204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,164,224,102, 12,193,152, 51,  6, 96,205, 47, 37,228,188,151,146,242, 94, 75,
+   201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 78, 48,102, 12,193,152, 51,
+     6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102,147,129,152,
+    51,  6, 96,204, 25,131, 52,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,
+   242, 94, 75,201,121, 47, 37,228,189, 56,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,
+   193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,154, 78,  6, 96,204, 25,131, 48,102, 12,210,242, 94, 75,201,121, 47, 37,228,188,
+   151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,244,227,  6, 96,204, 25,131, 48,
+   102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6,105, 56, 25,131,
+    48,102, 12,193,152, 51, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47, 37,228,188,151,146,242, 94, 75,201,121, 47,
+    37,228,188,151,146,242, 94, 75,211,140, 25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,131, 48,102, 12,193,152, 51,  6, 96,204,
+    25,131, 48,102, 12,193,152, 51,  6, 96,204, 25,164,224,102, 12,193,152, 51,  6, 96,205, 47,  3, 48,192, 24, 39, 36,228,156,147,
+   146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,
+   147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,146,114, 78, 73,201, 57, 39, 36,228,
+   156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,
+   229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,103,
+    44,229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,
+   103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,114,206, 89,203,
+    57,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,156,179,150,114,206, 89,
+   203, 57,103, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,156,211,154,115, 78,105,205, 57,167, 52,230,156,211,154,115, 78,
+   105,205, 57,167, 52,230,156,211,154,115, 78,105,205, 57,167, 52,230,156,211,154,115, 78,105,205, 57,167, 52,230,156,211,154,115,
+    78,105,205, 57,167, 52,230,156,211,154,115, 78,105,205, 57,167, 52,230,156,211,154,115, 78,105,205, 57,167, 52,229,156,179,150,
+   114,206,105,205, 57,167, 52,230,156,211,154,115, 78,105,205, 57,167, 52,230,156,211,154,115, 78,105,205, 57,167, 52,230,156,211,
+   154,115, 78,105,205, 57,167, 52,230,156,211,154,115, 78,105,205, 57,167, 52,230,156,211,154,115, 78,105,205, 57,167, 52,230,156,
+   211,154,115, 78,105,205, 57,103, 44,229,156,179,150,114,206, 89,203, 57,167, 44,229,156,179,150,114,206, 89,203, 57,103, 44,229,
+   156,179,150,114,206, 89,205, 57,103, 44,231,157, 19,158,115,206,144,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0,
+    96, 12,  1,128, 48, 78,105,205, 57,167, 52,230, 12, 19,154,115, 78,105,205, 57,167, 52,230,156,211,154,115, 78,105,205, 57,167,
+    52,230, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,131,
+   224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 62,  7,192,248, 31,  3,224,124, 15,129,240, 96, 12,  1,128, 48,
+     6,  0,192, 15,129,240, 62,  7,192,248, 31,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   157, 83,170,117, 78,169,213, 58,167, 80, 96,157, 83,170,117, 78,169,213, 58,167, 84,234,157, 83,170,117, 78,169,213, 58,167, 84,
+   234,157, 65,128, 48, 78,169,213, 58,167, 84,234,157, 83,168, 48, 78,169,212, 24, 39, 84,234,157, 83,170,117,  6,  0,192, 24,  3,
+     0, 96, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,
+   144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,
+   133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,144,178, 22, 66,200, 89, 11, 33,100, 44,133,131,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,
+     0,192, 24,  3,  0,117, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,
+     6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,
+   235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,215, 58,231, 92,235,157,115,174,117,206,185,214, 24,  3,
+     0, 96,157,147,178,118, 78,201,217, 59, 39,100,237,157,179,182,118,206,217,219, 59, 67,  0, 96,157,211,186,119, 78,233,221, 59,
+   167,116,238,157,211,184, 48,  6,  0,192, 24, 39, 92,239, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,
+     0,192, 24,  3,  0, 96,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,132,240,158, 19,194,120,
+    79,  9,225, 60, 39,132,240,158, 19,194,120, 79,  9,225, 60, 39,136, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,
+   202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158,
+    83,202,121, 79, 41,231, 60,231,156,243,158,147,210,122, 79, 73,233, 61, 39,164,244,158,147,208, 48,  6,  0,192, 24,  3,  4,245,
+    12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0,
+    96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,
+     0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,158,211,218,123, 79,105,237, 61,167,180,246,158,211,218,123, 79,105,237,
+    61,167,180,246,158,211,218,123, 79,105,237, 61,167,180,246,158,211,218,123, 79,121,241, 62, 39,204,250,159,115,238,125,207,185,
+   247, 62,231,220,251,159,115,236, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,
+     0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,
+     6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 50, 38, 68,200,153, 19, 34,100, 76,136, 96, 50,
+    38, 68,200,153, 16,192,100, 76,136, 96, 50, 38, 68,200,153, 19, 34,100, 76,137,145, 50, 38, 68,200,153, 19, 34,100, 76,136, 96,
+   159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,
+   252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,
+   228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63,
+    39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249,
+    63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,
+   249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,
+   201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126,
+    79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,
+   126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,248, 24,  3,  4,253,159,179,246,126,207,217,251, 63,103,236,253,159,211,
+   250,127, 79,233,253, 63,167,240, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+   159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,127,207,249,255, 63,231,252,
+   255,159,243,254,127,207,249,255, 63,231,252,255,159,243,254,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,
+     5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  1, 64, 40,  5,  0,160, 20,  2,128, 80, 10,  3, 64,
+   104, 13,  1,160, 52,  6,129, 80, 48,192, 24,  3,  0, 96,160,148, 18,130, 80, 74,  9, 65, 40, 37,  4,160,148, 16, 48,  6,  0,192,
+    24, 40, 45,  5, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,
+     0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,
+     6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128,
+    48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12, 20, 26,131, 80,106, 13, 65,168, 53,  6,160,212, 26,131, 80,106, 13, 65,168, 53,  6,
+   160,212, 26,131, 80,106, 13, 65,168, 53,  6,160,212, 26,131, 80,106, 13, 65,168, 53,  6,160,212, 26,131, 80,106, 13, 65,168, 53,
+     6,160,212, 26,131, 80,106, 13, 65,168, 53,  6,160,212, 26,131, 80,106, 13, 65,168, 53,  6,160,212, 26,131, 80,106, 15, 65,168,
+    53,  6,161, 20, 26,131, 80,106, 12, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,
+     3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192,
+    24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,
+   192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12, 20, 26,131, 80,106, 13, 65,168, 53,  6,160,212, 26,131, 80,
+   106, 13, 65,168, 53,  6,160,212, 26,131, 80,106, 13, 65,168, 53,  6,160,212, 26,131, 80,106, 13, 65,168, 53,  6,160,212, 26,131,
+    80,106, 13, 65,168, 53,  6,160,212, 26,131, 80,106, 13, 65,168, 77,  6,160,212, 26,131, 80,106, 13, 65,168, 53,  6,160,212, 26,
+   131, 80,106, 13, 65,131,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+    21,162,180, 86,138,208,192, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,
+   173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 12,  2,180, 86,134,  1, 90, 24,  3,  0,173, 12,  2,180, 86,138,209, 90, 43, 69,
+   104,173, 21,162,180, 86,134,  1, 90, 43, 69,104,173, 12,  2,180, 48, 10,208,192, 24,  3,  0, 96, 12,  1,128, 86,134,  0,192, 24,
+     3,  0,173, 12,  2,180, 48, 10,208,192, 43, 69,104,173, 12,  2,180, 86,134,  1, 90, 24,  3,  0,173, 12,  2,180, 48, 10,208,192,
+    43, 67,  0,173, 12,  2,180, 86,134,  1, 90, 24,  3,  0,173, 21,162,180, 86,134,  1, 90, 43, 69,104,173, 21,162,180, 86,134,  1,
+    90, 43, 69,104,173, 12,  2,180, 86,138,209, 90, 24,  5,104, 96, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 48, 10,
+   209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180, 86,138,208,192, 24,  3,  0, 96, 12,  2,180, 86,
+   138,208,192, 43, 69,104,173, 21,162,180, 48, 10,209, 90, 43, 69,104,173, 21,162,180, 86,138,209, 90, 43, 69,104,173, 21,162,180,
+    86,138,208,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96, 19,194,120, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96,
+    79,169,245, 62,167,212,242,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,
+   125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,218, 21, 66,168,
+    85, 10, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159,
+    83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,
+   159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,
+   250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,
+   212,250,159, 83,234,125, 79,169,245, 62,167,218, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10, 79,169,245, 62,
+   167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,237, 10,161, 73,245, 62,167,212,250,159, 83,234,125, 79,169,245,
+    62,167,212,250,159, 83,234,125,161, 73,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,121,161, 73,
+   245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,
+   169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159,104, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,
+     6, 32,196, 24,131, 16, 98, 12, 65,136, 49,  6, 32,196, 24,166,180,214,159, 83,234,125, 79,201,249, 63, 39,228,252,159,147,242,
+   126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,139,
+   208, 42, 79,233,253, 63,167,244,254,159,211,250,127, 79,233,253, 63,167,244,254,159,211,250,127, 79,233,253, 63,167,244,254,159,
+   211,250,127, 79,233,253, 63, 39,228,252,159,147,242,126, 79,233,253, 63,167,244,254,159,211,250,127, 79,233,253, 63,167,244,254,
+   159,211,250,127, 79,233,253, 63,167,244,254,159,211,250,127, 79,233,253, 46,165,208, 84,159, 83,234,125, 80, 10,  1, 63,167,244,
+   254,159,211,250,127, 79,233,253, 63,167,244,254,159,212,  2,128, 79,233,253, 63,167,244,254,159,211,250,127, 79,233,253, 63, 39,
+   228,252,159,168, 90,126, 79,212, 46,133,208,186, 23, 66,232, 93, 11,161,116, 46,133,167,228,252,159,147,242,126, 79,201,249, 63,
+    39,228,252,159,147,242,126, 79,201,249, 63, 39,228,252,159,104, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,
+   133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84,
+    42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168,101, 12,161,
+   148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,
+   161,171, 73,105, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10, 89,139, 49,102, 44,197,152,179, 22, 98,
+   204, 89,139, 49,105, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22, 98,204, 89,139, 49,102, 44,197,152,179, 22,
+    98,210, 89,139, 49,105, 45, 37,164,180,150,146,210, 90, 75, 73,105, 44,202, 21, 66,168, 85, 10, 89,139, 49,102, 44,197,152,179,
+    22, 98,204, 89,148, 42,133, 80,170, 21, 66,168, 85, 10, 90, 75, 74,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21,
+    66,168, 85, 10, 79, 41,229, 60,167,148,242,158,104, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170,
+    21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,
+   170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133,
+    80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,
+   133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84,
+    42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161,
+    84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,
+    79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,
+   121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,158, 83,
+   202,121, 79, 41,229, 60,167,148,242,158, 83,234,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158,
+    83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,
+   158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,
+   242,158, 83,202,121, 79, 41,229, 60,167,148,242,159, 83,202,121, 79, 41,229, 60,167,148,242,162,147,202,121, 79, 41,229, 60,167,
+   148,242,158, 83,202,121, 79, 41,229, 60,167,148,250,159, 83,234,125, 79,169,245, 62,167,208, 84, 10,147,234,125, 79, 41,229, 60,
+   167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,159, 19,226,121, 79, 41,229,
+    60,167,148,248,158, 83,202,121, 79, 41,229, 69, 40,165, 20,158, 83,202,138, 79, 41,229, 69, 40,117, 14,159, 83,234,121, 79, 41,
+   229, 60,167,148,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79, 41,229, 60,167,148,242,158, 83,202,121, 79,
+    41,229, 60,167,148,242,158, 83,202,121, 79, 41,245, 62,167,212,242,159, 83,234,125, 79, 41,229, 60,208,234, 29, 67,168,117, 14,
+    79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,
+   121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,
+   202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,125, 79, 41,245, 69, 40,164,242,158,
+    84, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 73,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,
+   158, 83,202,121, 79, 41,229, 60,167,148,242,158, 84, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165,
+    20,162,148, 82,138, 81, 73,229, 60,167,149, 20,158, 83,202,121, 79, 42, 41, 69, 40,164,242,162,148, 82,138, 79, 41,229, 60,167,
+   148,242,158, 83,202,138, 79, 42, 41, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79,137,229, 62,
+    39,148,248,158, 83,202,121, 79, 41,229, 69, 39,148,242,158, 83,202,124, 79, 41,241, 62, 39,148,242,158, 83,202,121, 79, 41,229,
+    60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,
+   229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79,
+    41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,159, 83,234,121,
+    79,137,241, 62, 39,196,248,159, 19,226,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,
+   124, 79,137,241, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,
+   202,121, 79, 41,229, 62, 39,196,248,159, 19,226,124, 79,137,241, 62, 39,196,248,159, 18,234, 93, 75,169,117, 46,165,212,186,151,
+    65, 80, 42,  5, 64,169, 62,167,148,242,158, 83,202,125, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,
+   158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,213,
+    14,161,211,234,125, 79,169,245, 69, 39,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,
+   212,250,159, 83,234,125, 80,233,245, 62,167,212,250,162,148, 82,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,
+   167,212,242,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245,
+    62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,
+   245, 62,167,208, 84, 10,129, 80, 42,  5, 64,168, 21,  2,164,250,159, 83,234,125, 79,169,245, 62,167,212,250,159, 83,234,125, 79,
+   169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,208, 84, 10,129, 80, 42,  5, 64,169, 62,167,148,242,158, 83,202,121,
+    79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,
+   121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,
+   202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,162,
+   148, 82,138, 79, 41,229, 60,168,165, 20,162,148, 82,138, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,
+   151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,
+   186,151, 84, 98,140, 81,148, 62,135,208,244,186,151, 82,234, 93, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,
+   148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,
+   168,164,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,149, 20,162,148, 82,121, 79, 41,229,
+    60,167,148,242,158, 83,202,121, 81, 73,229, 60,167,148,242,158, 83,234,125, 79,169,245, 62,167,213, 20,159, 83,234,125, 79, 41,
+   229, 60,167,212,250,158, 83,202,121,161, 84, 42,133, 80,164,242,158, 83,202,121, 79,169,245, 62,167,212,250,159, 83,234,125, 79,
+   169,245, 62,167,148,243, 66,168, 85, 10, 79,169,245, 62,167,212,242,158, 83,202,121, 79, 41,229, 60,167,148,243, 66,168, 85, 10,
+    75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234,
+    93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,
+   234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151,
+    82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,
+   151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,
+   250,159, 83,237, 10,161, 84, 42,133, 39,212,250,159, 83,234,125, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,
+   212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,
+   165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117,
+    46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,
+   117, 46,165,212,186,159, 83,234,125, 79,169,246,133, 80,170, 21, 66,168, 85, 10, 79, 41,229, 60,167,148,242,158, 83,202,121, 79,
+    41,229, 60,167,154, 21, 66,168, 85, 10, 79, 52, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,
+    75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,218, 21, 66,168, 85, 10, 75,169,117, 46,165,212,186,151, 82,234,
+    93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,
+   234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151,
+    82,234, 93,161, 84, 42,133, 80,170, 21, 66,168, 85, 10, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,118,133, 80,170, 21,
+    66,168, 85, 10, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,
+   186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93,161, 84, 42,133, 80,
+   170, 21, 66,168, 85, 10, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,
+   165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151,104, 85, 10, 79,169,246,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,
+   133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84,
+    42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161,
+    84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,
+    75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,213, 20,158, 83,202,138, 79, 41,229, 60,167,148,242,158, 83,202,
+   121, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 79, 41,229, 60,167,148,242,158, 84, 82,121, 79, 41,229, 60,167,148,242,158, 83,
+   202,121, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 60,171,165, 20,162,148, 82,121, 79, 41,229, 60,167,148,242,158,
+    85,210,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,
+   158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,
+   242,158, 83,202,138, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,
+   148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,
+   167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,162,148, 82,121, 81, 74, 41,
+    60,168,164,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,162,148, 82,138, 79, 42,
+    41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,147,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79,
+    41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121,
+     5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80,
+    42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129,
+    80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,
+   129, 80, 42,  5, 64,168, 21,  2,160, 84, 10,129, 80, 42,  5, 64,168, 21,  2,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21,
+    66,168, 85, 10, 79,169,245, 62,167,212,250,159, 83,234,125, 79,169,245, 62,167,212,250,159,104, 85, 10, 79, 41,229, 60,167,148,
+   242,158, 83,202,121, 79, 41,229, 60,167,148,243, 66,168, 85, 10, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 52, 42,133, 80,
+   170, 21, 66,168, 85, 10, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,
+   167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,148,242,158, 83,202,121, 79, 41,229,
+    60,167,148,242,158,104, 82,121, 79, 41,229, 60,168,165, 20,162,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,147,202,121, 79, 41,
+   229, 60,167,148,242,158, 83,202,121, 79, 41,229, 60,167,154, 21, 66,168, 85, 10, 79, 41,229, 60,167,148,242,158, 83,202,121, 79,
+    52, 42,133, 80,170, 21, 66,168, 85, 10, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 84, 42,133, 80,170, 21, 66,168, 85, 10,
+    75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234,
+    93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,
+   234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151,
+    82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,
+   151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,
+   186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,
+   212,186,151, 82,234, 93, 75,169,117, 46,134,  4,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,
+   165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117,
+    46,165,212,186,151, 82,234, 93, 75,169,117, 46,165,212,186,151, 82,234, 93, 75,169,117, 46,134,  0,192, 24,  3,  0, 96, 12,  1,
+   128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,  1,128, 48,  6,  0,192, 24,  3,  0, 96, 12,
+     1,128, 48,  6,  0,192, 24,  3,  0, 96,156,147,146,114, 78, 73,201, 57, 39, 36,228,156,147,144, 48,  6,  0,192, 24,  3,  0, 96,
+   161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85,
+    10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168,
+    85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,
+   168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21,
+    66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,168, 85, 10,161, 84, 42,133, 80,170,
+    21, 66,168, 85, 10,161, 84, 42,133, 80,170, 21, 66,131,  0, 96, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45,
+    69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106,
+    45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,
+   106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139,
+    81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101,
+    12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,
+    90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,
+   212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,
+   162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,148, 50,134, 80,202, 25, 67, 40, 90,139, 81,106, 45, 69,168,181,
+    22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,
+   181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,
+   168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45,
+    69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 25, 67, 40, 90,139, 81,106,
+    45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,
+   106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139,
+    81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,
+   139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212,
+    90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,
+   212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25,
+    67, 40, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181,
+    22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,
+   181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,
+   168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45,
+    69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106,
+    45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,
+   106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139,
+    81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,140,161,148, 50,134, 80,202, 25, 67, 40,101,
+    12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,
+   101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67,
+    40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25,
+    67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202,
+    25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,
+   202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134,
+    80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,
+   118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 59, 39,100,236,157,147,178,118, 78,201,217, 67, 40,101, 12,161,148,
+    50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,
+   148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,
+   161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101,
+    12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,
+   101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67,
+    40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25,
+    67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202,
+    25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,
+   202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134,
+    80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202,  3,  0, 96, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45,
+    69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106,
+    45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,
+   106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 50,134, 80,202, 25, 67, 40, 90,139,
+    81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,
+   139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212,
+    90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,
+   212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,162,212, 90,139, 81,106, 45, 69,168,181, 22,
+   162,212,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202,
+    25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,
+   202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40,101, 12,161,148, 50,134,
+    80,202, 25, 67, 40,101, 12,161,148, 50,134, 80,202, 25, 67, 40, 74, 41, 89, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165,
+    20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 69,  8,161, 20,
+    34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161,
+    20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,
+   161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,
+     8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40, 69,  8,161, 20, 34,132, 80,138, 17, 66, 40,
+    74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138,
+    81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,
+   138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148,
+    82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,
+   148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81, 74, 41, 69, 40,165, 20,
+   162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,
+   214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,
+   178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,
+   150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,
+   181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,
+   172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,
+   101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107,
+    45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,
+   107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203,
+    89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,
+   203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45,101,172,181,150,178,214, 90,203, 89,107, 45, 74, 41, 69, 40,165, 20,
+   162,148, 82,138, 81, 74, 41, 69, 40,165, 20,162,148, 82,138, 81,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,
+   102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147,
+    50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,
+   147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,
+   153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,
+   204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,153, 51, 38,100,204,153,147, 50,102, 76,201,131,  0, 96,
+     0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,  0,
+};
+
+constexpr uint64_t ucd_properties_records[1296] = {
+    0x00000f8818000221, 0x00000f8820100421, 0x00000f8828208641, 0x00000f8820110821,
+    0x00000f8830110821, 0x00000f8828318a61, 0x00000f8828000221, 0x00000f8820000221,
+    0x00000f8831120c1d, 0x00000f8801400e15, 0x00000f8801529015, 0x00000f8839001215,
+    0x00000f8839001417, 0x00000f8839001615, 0x00000f8801001215, 0x00000f8801531015,
+    0x00000f8901501816, 0x00000f8a01501a12, 0x00000f8841001419, 0x00000f8849639c15,
+    0x00000f8841601e11, 0x00000f8849741c15, 0x00000f8849002015, 0x00000f885184a20d,
+    0x00000f8849651c15, 0x00000f8801039c15, 0x00000f8801001219, 0x0000035c09959209,
+    0x00000f8801001415, 0x00000f8801001218, 0x00000f8801061210, 0x0000035c09a59205,
+    0x00000f8801000419, 0x00000f8a01502412, 0x00000f8828b12621, 0x00000f884810281d,
+    0x00000f8802001815, 0x00000f8839001617, 0x00000f883a001417, 0x00000f880100121a,
+    0x00000f8802002a15, 0x00000f8802002a18, 0x00000f880000129a, 0x0000035c0aa5aa07,
+    0x00000f8800501014, 0x00000f881ac68422, 0x00000f880200129a, 0x00000f883a00161a,
+    0x00000f883a001419, 0x00000f8852002a0f, 0x00000f8802002c18, 0x00000f8808a59205,
+    0x00000f8802052a15, 0x00000f8800501013, 0x00000f8802002a0f, 0x0040035c08959209,
+    0x0000035c0a959209, 0x00000f8802002a19, 0x0000035c0aa59205, 0x0040035c0aa59205,
+    0x0040035c08a59205, 0x0000035c08959209, 0x0000035c08a59205, 0x0000035c08d59207,
+    0x0000035c08959208, 0x0000035c08a59206, 0x00000f8800d59206, 0x00000f8808d59206,
+    0x00000f8808a59206, 0x00000f8800059218, 0x00000f8802059218, 0x00000f8802d5aa06,
+    0x00000f8800d5ac06, 0x00000f880ad5aa06, 0x00000f8800001218, 0x00000f880205ac18,
+    0x0000047400059218, 0x002e6f885ae702ac, 0x000e6f885ae702ac, 0x000e8f885ae702ac,
+    0x000dcf885ae702ac, 0x002d8f885ae702ac, 0x000caf885ae702ac, 0x002dcf885ae702ac,
+    0x002caf885ae702ac, 0x00001f885ae702ac, 0x00201f885ae702ac, 0x005e6f885ae702ac,
+    0x002f0f885ae702ac, 0x00000f885ae728ac, 0x000e9f885ae728ac, 0x000eaf885ae728ac,
+    0x0000032008959209, 0x0000032008a59205, 0x00500f8800d59206, 0x0000032000001218,
+    0x0000000000000000, 0x0000032008a59206, 0x00500f8800039c15, 0x00400f8800001218,
+    0x0040032008959209, 0x00500f8800051215, 0x0040032008a59205, 0x000003200a959209,
+    0x000003200aa59205, 0x0000033008959209, 0x0000033008a59205, 0x0000032000001219,
+    0x0040037008959209, 0x004003700a959209, 0x0000037008959209, 0x000003700a959209,
+    0x000003700aa59205, 0x004003700aa59205, 0x0040037008a59205, 0x0000037008a59205,
+    0x000003700800121a, 0x000e637058e702ac, 0x000e6f8858e702ac, 0x0000037058e702ab,
+    0x0000039808959209, 0x0000039808d59206, 0x0000039808059215, 0x0000039808601215,
+    0x0000039808051215, 0x0000039808a59205, 0x0000039808439c15, 0x0000039800058411,
+    0x000003980000121a, 0x0000039838001417, 0x000dc1f458e702ac, 0x000e61f458e702ac,
+    0x000de1f458e702ac, 0x000e41f458e702ac, 0x0000a1f458e702ac, 0x0000b1f458e702ac,
+    0x0000c1f458e702ac, 0x0000d1f458e702ac, 0x0000e1f458e702ac, 0x0000f1f458e702ac,
+    0x000101f458e702ac, 0x000111f458e702ac, 0x000121f458e702ac, 0x000131f458e702ac,
+    0x000141f458e702ac, 0x000151f458e702ac, 0x000161f458e702ac, 0x000001f410000411,
+    0x000171f458e702ac, 0x000001f410001215, 0x000181f458e702ac, 0x000191f458e702ac,
+    0x000001f410000e15, 0x000001f410d7ae07, 0x000001f410d59215, 0x000001f410051215,
+    0x0000028060c692c2, 0x00000f8860c692c2, 0x0000028000001219, 0x0000028068001219,
+    0x0000028038001615, 0x0000028068001617, 0x00000f8848639c15, 0x0000028068639c15,
+    0x000002800000121a, 0x000e628058e702ac, 0x0001e28058e702ac, 0x0001f28058e702ac,
+    0x0002028058e702ac, 0x00000f8868000e15, 0x0000028068c68222, 0x0000028068400e15,
+    0x00000f8868400e15, 0x0000028068d59207, 0x0040028068d59207, 0x00000f8868d59206,
+    0x0001bf8858e702ac, 0x0001cf8858e702ac, 0x0001df8858e702ac, 0x0001ef8858e702ac,
+    0x0001ff8858e702ac, 0x00020f8858e702ac, 0x00021f8858e702ac, 0x00022f8858e702ac,
+    0x002e6f8858e702ac, 0x002dcf8858e702ac, 0x000dc28058e702ac, 0x000002806084a20d,
+    0x000002806084a215, 0x000002806083a215, 0x0000028068001215, 0x00023f8858e702ac,
+    0x0000028068d59206, 0x000002805084a20d, 0x000002806800121a, 0x0000021c68401215,
+    0x0000021c68001215, 0x0000021c68c692c2, 0x0000021c68d59207, 0x0002421c58e702ac,
+    0x000e621c58e702ac, 0x000dc21c58e702ac, 0x000002a868d59207, 0x000002a858e702ac,
+    0x000002941084a20d, 0x0000029410d59207, 0x000e629458e702ac, 0x000dc29458e702ac,
+    0x0000029410d59206, 0x000002940000121a, 0x0000029400001215, 0x0000029400639c15,
+    0x0000029400400e15, 0x0000029410001417, 0x000001ec10d59207, 0x000e61ec58e702ac,
+    0x000001ec10d59206, 0x000001ec10001215, 0x000001ec10401215, 0x0000023010d59207,
+    0x000dc23058e702ac, 0x0000023010001215, 0x0000028068001218, 0x0001b28058e702ac,
+    0x0001c28058e702ac, 0x0001d28058e702ac, 0x000004ec58e702ac, 0x000004ec08e702ea,
+    0x000004ec08d59207, 0x004004ec08d59207, 0x002074ec58e702ac, 0x000094ec58e702ac,
+    0x000dcf8858e702ac, 0x005004ec08d59207, 0x00000f8808400415, 0x000004ec0884a20d,
+    0x000004ec08001215, 0x000004ec08d59206, 0x0000051408d59207, 0x0000051458e702ac,
+    0x0000051408e702ea, 0x0000751458e702ac, 0x0020051408e702aa, 0x0040051408e702ea,
+    0x0000951458e702ac, 0x0050051408d59207, 0x000005140884a20d, 0x0000051438001617,
+    0x000005140800120f, 0x000005140800160f, 0x000005140800121a, 0x0000051438001417,
+    0x0000051408001215, 0x000e651458e702ac, 0x000004d858e702ac, 0x000004d808e702ea,
+    0x000004d808d59207, 0x005004d808d59207, 0x000074d858e702ac, 0x000094d858e702ac,
+    0x000004d80884a20d, 0x000004d808001215, 0x0000050058e702ac, 0x0000050008e702ea,
+    0x0000050008d59207, 0x0000750058e702ac, 0x0000950058e702ac, 0x000005000884a20d,
+    0x0000050008001215, 0x0000050038001417, 0x0000051c58e702ac, 0x0000051c08e702ea,
+    0x0000051c08d59207, 0x0000751c58e702ac, 0x0020051c08e702aa, 0x0040051c08e702ea,
+    0x0000951c58e702ac, 0x0020051c58e702ac, 0x0050051c08d59207, 0x0000051c0884a20d,
+    0x0000051c0800121a, 0x0000051c0800120f, 0x0000056858e702ac, 0x0000056808d59207,
+    0x0040056808d59207, 0x0020056808e702aa, 0x0000056808e702ea, 0x0040056808e702ea,
+    0x0000956858e702ac, 0x000005680884a20d, 0x000005680800120f, 0x000005680000121a,
+    0x0000056838001417, 0x0000055058e702ac, 0x0000055008e702ea, 0x0000055008d59207,
+    0x0000755058e702ac, 0x0040055058e702ac, 0x0000955058e702ac, 0x0005455058e702ac,
+    0x0025b55058e702ac, 0x000005500884a20d, 0x0000055008002c15, 0x000005500000120f,
+    0x000005500800121a, 0x0000056408d59207, 0x0000056458e702ac, 0x0000056408e702ea,
+    0x0000056408002c15, 0x0000756458e702ac, 0x0000056408e702ac, 0x0040056408e702ea,
+    0x0020056408e702aa, 0x0000956458e702ac, 0x000005640884a20d, 0x0000056c58e702ac,
+    0x0000056c08e702ea, 0x0000056c08d59207, 0x0000956c58e702ac, 0x0020056c08e702aa,
+    0x0040056c08e702ea, 0x0000056c08d592c7, 0x0000056c0800121a, 0x0000056c0800120f,
+    0x0000056c0884a20d, 0x0000056c0800161a, 0x0000057058e702ac, 0x0000057008e702ea,
+    0x0000057008d59207, 0x0020957058e702ac, 0x0020057008e702aa, 0x0040057008e702ea,
+    0x000005700884a20d, 0x0000057008001215, 0x0000058008d03007, 0x0000058058e730ac,
+    0x0000058008d030e7, 0x0006758058e730ac, 0x0000958058e730ac, 0x00000f8838001417,
+    0x0000058008d03006, 0x0006b58058e730ac, 0x0000058008001215, 0x000005800884a20d,
+    0x0000058008000415, 0x0000059008d03007, 0x0000059058e730ac, 0x0000059008d030e7,
+    0x0007659058e730ac, 0x0000959058e730ac, 0x0000059008d03006, 0x0007a59058e730ac,
+    0x000005900884a20d, 0x0000052808d59207, 0x0000052808002c1a, 0x0000052808002c15,
+    0x0000052808001215, 0x0000052808002815, 0x0000052808000415, 0x0000052808000e15,
+    0x000005280800121a, 0x000dc52858e702ac, 0x000005280884a20d, 0x000005280800120f,
+    0x000005280800041a, 0x000d852858e702ac, 0x0000052900501816, 0x0000052a00502412,
+    0x0000052808e702ea, 0x0050052808d59207, 0x0008152858e702ac, 0x0008252858e702ac,
+    0x0050052858e702ac, 0x0008452858e702ac, 0x0000052858e702ac, 0x0000052808e704ea,
+    0x000e652858e702ac, 0x0000952858e702ac, 0x00000f880800121a, 0x0000057808d03007,
+    0x0040057808d03007, 0x0000057808e7300a, 0x0000057858e730ac, 0x0020057858e730ac,
+    0x0000057808e730ea, 0x0000757858e730ac, 0x0000957858e730ac, 0x000005780884a20d,
+    0x0000057808400415, 0x0000057808001215, 0x000dc57858e730ac, 0x000005780800301a,
+    0x000003c008959209, 0x000003c008d59205, 0x00000f8808001215, 0x000003c008a59206,
+    0x000004780bd5b307, 0x0000047808d5b527, 0x0020047808d5b527, 0x0020047808d5b747,
+    0x0000047808d5b747, 0x000006b808d59207, 0x000e66b858e702ac, 0x000006b808001215,
+    0x000006b808000415, 0x000006b808401215, 0x000006b80800120f, 0x000006b80000121a,
+    0x000006f408959209, 0x000006f408a59205, 0x000006e000000411, 0x000006e008d59207,
+    0x000006e00800121a, 0x000006e008401215, 0x000003503012041d, 0x0000035008d59207,
+    0x0000035100501816, 0x0000035200502412, 0x0000034c08d59207, 0x00000f8808000415,
+    0x0000034c08d5920e, 0x000005c808d59207, 0x000005c858e702ac, 0x000095c858e702ac,
+    0x000095c808e702ea, 0x000005cc08d59207, 0x000005cc58e702ac, 0x000095cc08e702ea,
+    0x000005d008d59207, 0x000005d058e702ac, 0x000005d408d59207, 0x000005d458e702ac,
+    0x0000058c08d03007, 0x0000058c58e730ac, 0x0000058c08e730ea, 0x0000958c58e730ac,
+    0x0000058c08000415, 0x0000058c08003815, 0x0000058c08d03006, 0x0000058c08001215,
+    0x0000058c38001417, 0x000e658c58e730ac, 0x0000058c0884a20d, 0x0000058c0000120f,
+    0x0000024400001215, 0x00000f8800600e15, 0x00000f8800400e15, 0x0000024400000415,
+    0x00000f8800000415, 0x0000024400002c11, 0x0000024400600e15, 0x0000024400400e15,
+    0x0000024458e702ac, 0x0000024418c6a822, 0x000002440884a20d, 0x0000024408d59207,
+    0x0000024408d59206, 0x000e424458e702ac, 0x0000054008d59207, 0x0000054058e702ac,
+    0x0000054008e702ea, 0x000de54058e702ac, 0x000e654058e702ac, 0x000dc54058e702ac,
+    0x000005400000121a, 0x0000054000400e15, 0x000005400884a20d, 0x0000058408d03007,
+    0x0000058808d03007, 0x000005880884a20d, 0x000005880800300f, 0x000005880000301a,
+    0x0000058c0000121a, 0x000005bc08d59207, 0x000e65bc58e702ac, 0x000dc5bc58e702ac,
+    0x000005bc08e702ea, 0x000005bc58e702ac, 0x000005bc08001215, 0x0000057c08d03007,
+    0x0000057c08e730ea, 0x0000057c58e730ac, 0x0000957c58e730ac, 0x0000057c08e7300a,
+    0x000e657c58e730ac, 0x000dc57c58e702ac, 0x0000057c0884a20d, 0x0000057c08003015,
+    0x0000057c08d03006, 0x0000057c08403015, 0x00000f8858e702ab, 0x000005a058e702ac,
+    0x000005a008e702ea, 0x000005a008d59207, 0x004005a008d59207, 0x000075a058e702ac,
+    0x002005a008e702aa, 0x004005a008e702ea, 0x000095a008e702ea, 0x000005a00884a20d,
+    0x000005a008400415, 0x000005a008001215, 0x000005a008000415, 0x000005a00800121a,
+    0x000e65a058e702ac, 0x000dc5a058e702ac, 0x000005a858e702ac, 0x000005a808e702ea,
+    0x000005a808d59207, 0x000095a808e702ea, 0x000095a858e702ac, 0x000005a80884a20d,
+    0x000005b408d59207, 0x000075b458e702ac, 0x000005b408e702ea, 0x000005b458e702ac,
+    0x000095b408e702ea, 0x000005b408001215, 0x0000053c08d59207, 0x0000053c08e702ea,
+    0x0000053c58e702ac, 0x0000753c58e702ac, 0x0000053c08400415, 0x0000053c08000415,
+    0x0000053c0884a20d, 0x000004140884a20d, 0x0000041408d59207, 0x0000041408d59206,
+    0x0000041408400415, 0x000003c008d59209, 0x000005a808001215, 0x00001f8858e702ac,
+    0x00000f8808e702ea, 0x00000f8808d59207, 0x0000037008a59206, 0x000eaf8858e728ac,
+    0x000d6f8858e702ac, 0x000caf8858e702ac, 0x000e8f8858e702ac, 0x000e4f8858e702ac,
+    0x000daf8858e702ac, 0x000e9f8858e728ac, 0x0050032008a59205, 0x0040032008959208,
+    0x0050032008959209, 0x0040032000001218, 0x0050032000001218, 0x0050032000002c18,
+    0x00500f883012041d, 0x00000f883012041d, 0x00000f883010281d, 0x00000f8818c03a22,
+    0x00000f8818e702a2, 0x00000f8818e83d62, 0x00000f8808c68222, 0x00000f8810c68222,
+    0x00000f8802000411, 0x00000f8800002811, 0x00000f8800000411, 0x00000f8802600411,
+    0x00000f8802603e11, 0x00000f8802002a11, 0x00000f8800001215, 0x00000f8802541014,
+    0x00000f8802541013, 0x00000f8800501816, 0x00000f8802501014, 0x00000f8802501013,
+    0x00000f8802001215, 0x00000f8802744015, 0x00000f8802004015, 0x00000f8802050415,
+    0x00000f8830b1083b, 0x00000f8828b1083c, 0x00000f8870c68222, 0x00000f8878c68222,
+    0x00000f8880c68222, 0x00000f8888c68222, 0x00000f8890c68222, 0x00000f884816281d,
+    0x00000f883a001615, 0x00000f8838001615, 0x00000f8802001615, 0x00000f8800001615,
+    0x00000f8800403895, 0x00000f8800403815, 0x00000f8800061210, 0x00000f8848039c19,
+    0x00000f8900501816, 0x00000f8a00502412, 0x00000f8800001219, 0x00000f8818c6c222,
+    0x00000f8818c69222, 0x0000000000000020, 0x00000f8898c68222, 0x00000f88a0c68222,
+    0x00000f88a8c68222, 0x00000f88b0c68222, 0x00000f8818c68222, 0x00000f885000120f,
+    0x00000f8840001219, 0x0000035c0aa5aa06, 0x00000f8838001617, 0x00000f883c001417,
+    0x0000000000001400, 0x00000f880000121a, 0x00000f8808959209, 0x00000f880200161a,
+    0x00000f8802002a1a, 0x00000f880aa5aa05, 0x00000f880200141a, 0x00000f8802002a9a,
+    0x005003200a959209, 0x0050035c08959209, 0x0050035c0a95aa09, 0x00000f883800121a,
+    0x00000f8808a59285, 0x00000f880000120f, 0x00000f880200120f, 0x00000f8800002a0f,
+    0x0000035c0a95aa0e, 0x0000035c0895920e, 0x0000035c0aa5aa0e, 0x0000035c08a5920e,
+    0x0000035c08d5920e, 0x00000f8802002a99, 0x00400f8800001219, 0x00000f880200121a,
+    0x00400f880000121a, 0x00000f8840001419, 0x00000f8838001419, 0x00400f8802002a19,
+    0x00000f8800004019, 0x00000f880300449a, 0x00500f8903501816, 0x00500f8a03502412,
+    0x00000f880300129a, 0x00000f880000449a, 0x00000f880a002a1a, 0x00000f880a95aa1a,
+    0x00000f880a95aa9a, 0x00000f880aa5aa1a, 0x00000f8800002a1a, 0x00000f8800001299,
+    0x00000f8803001299, 0x00000f8800002a9a, 0x00000f880200449a, 0x00000f880000469a,
+    0x00000f880800129a, 0x00000f880200469a, 0x00000f880300469a, 0x00000f8803002a9a,
+    0x00000f880050101a, 0x00000f8800000e1a, 0x00000f8800000e9a, 0x000008e80800121a,
+    0x00500f8800001219, 0x0000038408959209, 0x0000038408a59205, 0x000003300000121a,
+    0x000e633058e702ac, 0x0000033000000e15, 0x0000033000000415, 0x000003300000120f,
+    0x000003c008a59205, 0x000001e008d59207, 0x000001e008d59206, 0x000001e008000415,
+    0x000091e058e702ac, 0x00000f8800501015, 0x00000f8800001815, 0x00000f8800001211,
+    0x00000f8800003e11, 0x00000f8800400415, 0x000007d00300441a, 0x00000f880300441a,
+    0x00000f883512041d, 0x00000f8803602415, 0x00000f8803402415, 0x00000f8803004415,
+    0x000007d00bd5b806, 0x00000f880bd04407, 0x000007d00bd0440e, 0x00000f8903501816,
+    0x00000f8a03502412, 0x00000f8803003811, 0x00000f8803501816, 0x00000f8803502412,
+    0x000daf885be702ac, 0x000e4f885be702ac, 0x000e8f885be702ac, 0x000def885be702ac,
+    0x000e04780be702aa, 0x00000f8803004491, 0x00000f880bd8c406, 0x00000f880bd88206,
+    0x00000f880bd5b807, 0x00000f8803004495, 0x00000f880000441a, 0x000006680bd04807,
+    0x000006680bd04407, 0x004006680bd04407, 0x00208f885be702ac, 0x00000f880308b818,
+    0x000006680bd03806, 0x004006680bd03806, 0x00000f880308b811, 0x0000066c0bd8c807,
+    0x0000066c0bd8c407, 0x0040066c0bd8c407, 0x00000f8803003815, 0x00000f880bd8c806,
+    0x0000066c0bd8b806, 0x0040066c0bd8b806, 0x000004740bd5c407, 0x000004780bd5c407,
+    0x00000f880b00441a, 0x00000f880b00440f, 0x000004780b00441a, 0x000004780300441a,
+    0x00000f880a002a0f, 0x00000f880300440f, 0x00000f880b00449a, 0x0000066c0b08c41a,
+    0x000007d00bd04407, 0x000007300bd5c407, 0x000007300bd5b806, 0x000007300300441a,
+    0x0000063c08d59207, 0x0000063c08d59206, 0x0000063c08000415, 0x0000063c08400415,
+    0x0000075808d59207, 0x0000075808d59206, 0x0000075800000415, 0x0000075800400e15,
+    0x0000075800400415, 0x000007580884a20d, 0x0000037008d59207, 0x0000037000001215,
+    0x0000037000d59206, 0x000006cc08d59207, 0x000006cc08d5920e, 0x000e66cc58e702ac,
+    0x000006cc08001215, 0x000006cc08400415, 0x000006cc08000415, 0x00000f8808059218,
+    0x000004f008d59207, 0x000004f058e702ac, 0x000094f058e702ac, 0x000004f008e702ea,
+    0x000004f00000121a, 0x00000f880800120f, 0x0000052c08d59207, 0x0000052c00002c15,
+    0x0000052c00400e15, 0x0000056008e702ea, 0x0000056008d59207, 0x0000956058e702ac,
+    0x0000056058e702ac, 0x0000056008400415, 0x000005600884a20d, 0x000e64ec58e702ac,
+    0x000004ec08002c15, 0x000005940884a20d, 0x0000059408d59207, 0x0000059458e702ac,
+    0x000dc59458e702ac, 0x0000059408400415, 0x000005ac08d59207, 0x000005ac58e702ac,
+    0x000005ac08e702ea, 0x000095ac08e702ea, 0x000005ac08001215, 0x000005a458e702ac,
+    0x000005a408e702ea, 0x000005a408d59207, 0x000075a458e702ac, 0x000095a408e702ea,
+    0x000005a408001215, 0x000005a408000415, 0x000005a408400415, 0x000005a40884a20d,
+    0x0000057808d03006, 0x0000059808d59207, 0x0000059858e702ac, 0x0000059808e702ea,
+    0x000005980884a20d, 0x0000059808001215, 0x0000059808400415, 0x0000059c08d03007,
+    0x000e659c58e730ac, 0x000dc59c58e730ac, 0x0000059c08d03006, 0x0000059c08003015,
+    0x0000054408d59207, 0x0000054408e702ea, 0x0000054458e702ac, 0x0000054408400415,
+    0x0000054408d59206, 0x0000954458e702ac, 0x000005440884a20d, 0x004004780bd5cb87,
+    0x004004780bd5cda7, 0x0000000008004e04, 0x000000000a000003, 0x005007d00bd04407,
+    0x0000000003004400, 0x005001f410d7ae07, 0x0001a1f458e702ac, 0x000001f440001219,
+    0x00000f8800502412, 0x00000f885ae702ac, 0x00000f8803639c15, 0x00000f8803002415,
+    0x00000f8803651c15, 0x00000f8803039c15, 0x00000f8803000e15, 0x00000f8803004015,
+    0x00000f8803604411, 0x00000f8803064410, 0x00000f884b63a415, 0x00000f8803604415,
+    0x00000f884b742415, 0x00000f880303b815, 0x00000f884b653815, 0x00000f8803400e15,
+    0x00000f883b004415, 0x00000f8843004419, 0x00000f8843604411, 0x00000f8803004419,
+    0x00000f883b001417, 0x00000f883b001615, 0x00000f8805400e15, 0x00000f8805004415,
+    0x00000f883d004415, 0x00000f883d001417, 0x00000f883d001615, 0x00000f8805044415,
+    0x00000f8905501816, 0x00000f8a05502412, 0x00000f8845004419, 0x00000f884d63a415,
+    0x00000f8845604411, 0x00000f884d742415, 0x00000f884d004415, 0x00000f885584c40d,
+    0x00000f884d653815, 0x00000f880503b815, 0x00000f8805004419, 0x0000035c0d95c409,
+    0x00000f8805004418, 0x00000f8805064410, 0x0000035c0da5c405, 0x00000f8804402415,
+    0x00000f8904501816, 0x00000f8a04502412, 0x00000f8804602415, 0x00000f8804003815,
+    0x0000066c0cd8c407, 0x0000066c0cd8c807, 0x00000f880cd8c806, 0x00000f880ce738a6,
+    0x000004780cd5c407, 0x00000f883d001617, 0x00000f880500441a, 0x00000f880400121a,
+    0x00000f8804001219, 0x00000f8800c68222, 0x00000f880000501a, 0x0000064408d59207,
+    0x0000032000d5920e, 0x000003200000120f, 0x000003200000121a, 0x000003200800121a,
+    0x0000032808d59207, 0x0000032408d59207, 0x0000034808d59207, 0x000003480800120f,
+    0x0000033808d59207, 0x0000033808d5920e, 0x0000038c08d59207, 0x000e638c58e702ac,
+    0x000000a008d59207, 0x000000a008000415, 0x0000007808d59207, 0x0000007808000415,
+    0x0000007808d5920e, 0x000003e808959209, 0x000003e808a59205, 0x0000046408d59207,
+    0x0000041008d59207, 0x000004100884a20d, 0x0000036c08959209, 0x0000036c08a59205,
+    0x0000038808d59207, 0x000003bc08d59207, 0x000003bc08001215, 0x0000039008959209,
+    0x0000039008a59205, 0x0000064008d59207, 0x0000035c08d59206, 0x0000064c10d59207,
+    0x000001f010d59207, 0x000001f010000415, 0x000001f01000120f, 0x000001f810d59207,
+    0x000001f81000121a, 0x000001f81000120f, 0x0000027c10d59207, 0x0000027c1000120f,
+    0x000001fc10d59207, 0x000001fc1000120f, 0x000001cc10d59207, 0x000001cc1000120f,
+    0x000001cc00000415, 0x000001d010d59207, 0x000001d010001215, 0x0000019010d59207,
+    0x0000019410d59207, 0x000001941000120f, 0x000004c410d59207, 0x000004c458e702ac,
+    0x000dc4c458e702ac, 0x000e64c458e702ac, 0x000014c458e702ac, 0x000094c458e702ac,
+    0x000004c41000120f, 0x000004c410000415, 0x000004c410400415, 0x000004c410001215,
+    0x000001a410d59207, 0x000001a41000120f, 0x000001a410001215, 0x000001a810d59207,
+    0x000001a81000120f, 0x0000022c10d59207, 0x0000022c1000121a, 0x000e622c58e702ac,
+    0x000dc22c58e702ac, 0x0000022c1000120f, 0x0000022c10000415, 0x0000022c10004015,
+    0x0000021810d59207, 0x0000021800000415, 0x0000020810d59207, 0x000002081000120f,
+    0x0000020c10d59207, 0x0000020c1000120f, 0x0000021010d59207, 0x0000021010001215,
+    0x000002101000120f, 0x000002bc10d59207, 0x000002c010959209, 0x000002c010a59205,
+    0x000002c01000120f, 0x0000029c68d59207, 0x000e629c58e702ac, 0x0000029c6084a20d,
+    0x000002806000120f, 0x0000030010d59207, 0x000e630058e702ac, 0x0000030010000411,
+    0x0000023810d59207, 0x000002381000120f, 0x0000023468d59207, 0x000dc23458e702ac,
+    0x000e623458e702ac, 0x000002346800120f, 0x0000023468401215, 0x0000023c10d59207,
+    0x000e623c58e702ac, 0x000dc23c58e702ac, 0x0000023c10401215, 0x000001b410d59207,
+    0x000001b41000120f, 0x0000020010d59207, 0x000004b008e702ea, 0x000004b058e702ac,
+    0x000004b008d59207, 0x000094b058e702ac, 0x000004b008400415, 0x000004b008001215,
+    0x000004b00000120f, 0x000004b00884a20d, 0x000004f458e702ac, 0x000004f408e702ea,
+    0x000004f408d59207, 0x004004f408d59207, 0x000094f458e702ac, 0x002074f458e702ac,
+    0x000004f408001215, 0x000004f408c692c2, 0x000004f408400415, 0x0000063808d59207,
+    0x000006380884a20d, 0x000e657458e702ac, 0x0000057408d59207, 0x0020057458e702ac,
+    0x0000057458e702ac, 0x0000057408e702ea, 0x0040057458e702ac, 0x0000957458e702ac,
+    0x000005740884a20d, 0x0000057408000415, 0x0000057408400415, 0x000004e808d59207,
+    0x000074e858e702ac, 0x000004e808001215, 0x000004e808002c15, 0x000004fc58e702ac,
+    0x000004fc08e702ea, 0x000004fc08d59207, 0x000094fc08e702ea, 0x000004fc08d592c7,
+    0x000004fc08400415, 0x000004fc08001215, 0x000004fc08000415, 0x000074fc58e702ac,
+    0x000004fc08401215, 0x000004fc0884a20d, 0x000004fc08002c15, 0x000005700800120f,
+    0x0000050808d59207, 0x0000050808e702ea, 0x0000050858e702ac, 0x0000950808e702ea,
+    0x0000750858e702ac, 0x0000050808400415, 0x0000050808001215, 0x0000050c08d59207,
+    0x0000050c08400415, 0x000004f808d59207, 0x000004f858e702ac, 0x000004f808e702ea,
+    0x000074f858e702ac, 0x000094f858e702ac, 0x000004f80884a20d, 0x0000055c58e702ac,
+    0x0000055c08e702ea, 0x0000055c08d59207, 0x00007f8858e702ac, 0x0000755c58e702ac,
+    0x0020055c08e702aa, 0x0040055c08e702ea, 0x0000955c08e702ea, 0x000e655c58e702ac,
+    0x0000053408d59207, 0x0000053408e702ea, 0x0000053458e702ac, 0x0000953458e702ac,
+    0x0000753458e702ac, 0x0000053408400415, 0x0000053408000415, 0x0000053408001215,
+    0x000005340884a20d, 0x000e653458e702ac, 0x0000051808d59207, 0x0020051808e702aa,
+    0x0000051808e702ea, 0x0000051858e702ac, 0x0020051858e702ac, 0x0040051808e702ea,
+    0x0000951858e702ac, 0x0000751858e702ac, 0x0000051808001215, 0x000005180884a20d,
+    0x000004b808d59207, 0x002004b808e702aa, 0x000004b808e702ea, 0x000004b858e702ac,
+    0x004004b808e702ea, 0x000094b858e702ac, 0x000074b858e702ac, 0x000004b808002c15,
+    0x000004b808400415, 0x000004b808000e15, 0x000004b808001215, 0x0000051008d59207,
+    0x0000051008e702ea, 0x0000051058e702ac, 0x0000951058e702ac, 0x0000051008400415,
+    0x0000051008001215, 0x000005100884a20d, 0x0000024400002c15, 0x0000050408d59207,
+    0x0000050458e702ac, 0x0000050408e702ea, 0x0000950408e702ea, 0x0000750458e702ac,
+    0x0000050408001215, 0x000005040884a20d, 0x0000054808d03007, 0x0000054858e730ac,
+    0x0000054808e7300a, 0x0000054808e730ea, 0x0000954858e730ac, 0x000005480884a20d,
+    0x000005480800300f, 0x0000054808400415, 0x000005480800301a, 0x0000052008d59207,
+    0x0000052008e702ea, 0x0000052058e702ac, 0x0000952058e702ac, 0x0000752058e702ac,
+    0x0000052008001215, 0x0000041808959209, 0x0000041808a59205, 0x000004180884a20d,
+    0x000004180800120f, 0x0000041808d59207, 0x0000055808d59207, 0x0020055808e702aa,
+    0x0000055808e702ea, 0x0040055808e702ea, 0x0000055858e702ac, 0x0000955808e702ea,
+    0x0000955858e702ac, 0x0000055808d592c7, 0x0000755858e702ac, 0x0000055808400415,
+    0x0000055808000415, 0x000005580884a20d, 0x000004dc08d59207, 0x000004dc08e702ea,
+    0x000004dc58e702ac, 0x000094dc58e702ac, 0x000004dc08002c15, 0x0000054c08d59207,
+    0x0000054c58e702ac, 0x0000054c08e702ac, 0x0000954c58e702ac, 0x0000054c08e702ea,
+    0x0000054c08d592c7, 0x0000054c08002c15, 0x0000054c08001215, 0x0000054c08000415,
+    0x0000054c08400415, 0x0000052408d59207, 0x0000052458e702ac, 0x0000052408e702ea,
+    0x0000052408d592c7, 0x0000952458e702ac, 0x0000052408000415, 0x0000052408400415,
+    0x0000052408002c15, 0x0000041c08d59207, 0x0000053808d59207, 0x0000053808e702ea,
+    0x0000053858e702ac, 0x0000953808e702ac, 0x0000053808400415, 0x0000053808000415,
+    0x000005380884a20d, 0x000005380800120f, 0x0000053008002c15, 0x0000053008000e15,
+    0x0000053008d59207, 0x0000053058e702ac, 0x0000053008e702ea, 0x000004e408d59207,
+    0x000004e458e702ac, 0x000074e458e702ac, 0x000094e458e702ac, 0x000004e408d592c7,
+    0x000004e40884a20d, 0x000004e008d59207, 0x000004e008e702ea, 0x000004e058e702ac,
+    0x000094e058e702ac, 0x000004e00884a20d, 0x000005b808d59207, 0x000005b858e702ac,
+    0x000005b808e702ea, 0x000005b808401215, 0x000005c058e702ac, 0x000005c008d592c7,
+    0x000005c008e702ea, 0x000005c008d59207, 0x000095c008e702ea, 0x000095c058e702ac,
+    0x000005c008400415, 0x000005c008004415, 0x000005c00884a20d, 0x0000056838001617,
+    0x0000056808000415, 0x0000005008d59207, 0x0000005008d5920e, 0x0000005008000415,
+    0x0000064808d59207, 0x0000064808001215, 0x000000c808d59207, 0x000000c808d59807,
+    0x000000c808d5a407, 0x000000c808c6a822, 0x000000c808c69822, 0x000000c808c6a422,
+    0x000000c858e702ac, 0x0000014008d59207, 0x0000014008d59807, 0x0000014008d5a407,
+    0x0000042008d59207, 0x000004200884a20d, 0x0000042008400415, 0x0000082008d59207,
+    0x000008200884a20d, 0x0000040c08d59207, 0x0000140c58e702ac, 0x0000040c08400415,
+    0x0000070808d59207, 0x000e670858e702ac, 0x0000070808400415, 0x0000070808000415,
+    0x0000070808001215, 0x000007080800121a, 0x0000070808d59206, 0x000007080884a20d,
+    0x000007080800120f, 0x0000042408959209, 0x0000042408a59205, 0x000004240800120f,
+    0x0000042408000415, 0x0000042408400415, 0x0000042408001215, 0x0000046808d59207,
+    0x0000046858e702ac, 0x0000046808e702ea, 0x0000046808d59206, 0x000008200bd5b806,
+    0x000007cc0bd5b806, 0x000007d003003815, 0x000004805be728ac, 0x000067d00be702ea,
+    0x000008200bd04407, 0x000004800bd01207, 0x0000066c0bd89206, 0x000007cc0bd04407,
+    0x00000bcc08d59207, 0x00000bcc0800121a, 0x00000bcc58e702ac, 0x00001bcc58e702ac,
+    0x00000bcc08400415, 0x00000f8858e702ac, 0x00500f880800121a, 0x000d8f8808e702aa,
+    0x000d8f8808e702ea, 0x000e2f8808e702ea, 0x000e632058e702ac, 0x00000f8808001219,
+    0x00000f885084a20d, 0x0000017c0800121a, 0x0000017c58e702ac, 0x0000017c08000415,
+    0x0000017c08400415, 0x0000017c08001215, 0x000e638458e702ac, 0x0000070c08d59207,
+    0x000e670c58e702ac, 0x0000070c08d59206, 0x0000070c0884a20d, 0x0000070c0800121a,
+    0x0000049808d59207, 0x000e649858e702ac, 0x0000046c08d59207, 0x000e646c58e702ac,
+    0x0000046c0884a20d, 0x0000046c38001417, 0x0000049c08d59207, 0x0000049c08d59206,
+    0x000e849c58e702ac, 0x000dc49c58e702ac, 0x000e649c58e702ac, 0x0000049c0884a20d,
+    0x000006d810d59207, 0x000006d81000120f, 0x000dc6d858e702ac, 0x0000029810959209,
+    0x0000029810a59205, 0x000e629858e702ac, 0x0000729858e702ac, 0x0000029810d59206,
+    0x000002981084a20d, 0x0000029810001815, 0x00000f886800120f, 0x00000f886800161a,
+    0x00000f8868001617, 0x00000f886800121a, 0x0000000000004480, 0x00000f880b002a9a,
+    0x00000f88080953da, 0x000006680b00441a, 0x00000f88030754b8, 0x00000f880000381a,
+};
+
+constexpr uint64_t ucd_properties_latin1[256] = {
+    0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221,
+    0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221,
+    0x00000f8818000221, 0x00000f8820100421, 0x00000f8828208641, 0x00000f8820110821,
+    0x00000f8830110821, 0x00000f8828318a61, 0x00000f8818000221, 0x00000f8818000221,
+    0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221,
+    0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221,
+    0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221,
+    0x00000f8828000221, 0x00000f8828000221, 0x00000f8828000221, 0x00000f8820000221,
+    0x00000f8831120c1d, 0x00000f8801400e15, 0x00000f8801529015, 0x00000f8839001215,
+    0x00000f8839001417, 0x00000f8839001615, 0x00000f8801001215, 0x00000f8801531015,
+    0x00000f8901501816, 0x00000f8a01501a12, 0x00000f8801001215, 0x00000f8841001419,
+    0x00000f8849639c15, 0x00000f8841601e11, 0x00000f8849741c15, 0x00000f8849002015,
+    0x00000f885184a20d, 0x00000f885184a20d, 0x00000f885184a20d, 0x00000f885184a20d,
+    0x00000f885184a20d, 0x00000f885184a20d, 0x00000f885184a20d, 0x00000f885184a20d,
+    0x00000f885184a20d, 0x00000f885184a20d, 0x00000f8849651c15, 0x00000f8801039c15,
+    0x00000f8801001219, 0x00000f8801001219, 0x00000f8801001219, 0x00000f8801400e15,
+    0x00000f8801001215, 0x0000035c09959209, 0x0000035c09959209, 0x0000035c09959209,
+    0x0000035c09959209, 0x0000035c09959209, 0x0000035c09959209, 0x0000035c09959209,
+    0x0000035c09959209, 0x0000035c09959209, 0x0000035c09959209, 0x0000035c09959209,
+    0x0000035c09959209, 0x0000035c09959209, 0x0000035c09959209, 0x0000035c09959209,
+    0x0000035c09959209, 0x0000035c09959209, 0x0000035c09959209, 0x0000035c09959209,
+    0x0000035c09959209, 0x0000035c09959209, 0x0000035c09959209, 0x0000035c09959209,
+    0x0000035c09959209, 0x0000035c09959209, 0x0000035c09959209, 0x00000f8901501816,
+    0x00000f8801001415, 0x00000f8a01501a12, 0x00000f8801001218, 0x00000f8801061210,
+    0x00000f8801001218, 0x0000035c09a59205, 0x0000035c09a59205, 0x0000035c09a59205,
+    0x0000035c09a59205, 0x0000035c09a59205, 0x0000035c09a59205, 0x0000035c09a59205,
+    0x0000035c09a59205, 0x0000035c09a59205, 0x0000035c09a59205, 0x0000035c09a59205,
+    0x0000035c09a59205, 0x0000035c09a59205, 0x0000035c09a59205, 0x0000035c09a59205,
+    0x0000035c09a59205, 0x0000035c09a59205, 0x0000035c09a59205, 0x0000035c09a59205,
+    0x0000035c09a59205, 0x0000035c09a59205, 0x0000035c09a59205, 0x0000035c09a59205,
+    0x0000035c09a59205, 0x0000035c09a59205, 0x0000035c09a59205, 0x00000f8901501816,
+    0x00000f8801000419, 0x00000f8a01502412, 0x00000f8801001219, 0x00000f8818000221,
+    0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221,
+    0x00000f8818000221, 0x00000f8828b12621, 0x00000f8818000221, 0x00000f8818000221,
+    0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221,
+    0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221,
+    0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221,
+    0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221,
+    0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221,
+    0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221, 0x00000f8818000221,
+    0x00000f884810281d, 0x00000f8802001815, 0x00000f8839001617, 0x00000f8839001417,
+    0x00000f883a001417, 0x00000f8839001417, 0x00000f880100121a, 0x00000f8802002a15,
+    0x00000f8802002a18, 0x00000f880000129a, 0x0000035c0aa5aa07, 0x00000f8800501014,
+    0x00000f8801001219, 0x00000f881ac68422, 0x00000f880200129a, 0x00000f8801001218,
+    0x00000f883a00161a, 0x00000f883a001419, 0x00000f8852002a0f, 0x00000f8852002a0f,
+    0x00000f8802002c18, 0x00000f8808a59205, 0x00000f8802002a15, 0x00000f8802052a15,
+    0x00000f8802002a18, 0x00000f8852002a0f, 0x0000035c0aa5aa07, 0x00000f8800501013,
+    0x00000f8802002a0f, 0x00000f8802002a0f, 0x00000f8802002a0f, 0x00000f8802001815,
+    0x0040035c08959209, 0x0040035c08959209, 0x0040035c08959209, 0x0040035c08959209,
+    0x0040035c08959209, 0x0040035c08959209, 0x0000035c0a959209, 0x0040035c08959209,
+    0x0040035c08959209, 0x0040035c08959209, 0x0040035c08959209, 0x0040035c08959209,
+    0x0040035c08959209, 0x0040035c08959209, 0x0040035c08959209, 0x0040035c08959209,
+    0x0000035c0a959209, 0x0040035c08959209, 0x0040035c08959209, 0x0040035c08959209,
+    0x0040035c08959209, 0x0040035c08959209, 0x0040035c08959209, 0x00000f8802002a19,
+    0x0000035c0a959209, 0x0040035c08959209, 0x0040035c08959209, 0x0040035c08959209,
+    0x0040035c08959209, 0x0040035c08959209, 0x0000035c0a959209, 0x0000035c0aa59205,
+    0x0040035c0aa59205, 0x0040035c0aa59205, 0x0040035c08a59205, 0x0040035c08a59205,
+    0x0040035c08a59205, 0x0040035c08a59205, 0x0000035c0aa59205, 0x0040035c08a59205,
+    0x0040035c0aa59205, 0x0040035c0aa59205, 0x0040035c0aa59205, 0x0040035c08a59205,
+    0x0040035c0aa59205, 0x0040035c0aa59205, 0x0040035c08a59205, 0x0040035c08a59205,
+    0x0000035c0aa59205, 0x0040035c08a59205, 0x0040035c0aa59205, 0x0040035c0aa59205,
+    0x0040035c08a59205, 0x0040035c08a59205, 0x0040035c08a59205, 0x00000f8802002a19,
+    0x0000035c0aa59205, 0x0040035c0aa59205, 0x0040035c0aa59205, 0x0040035c08a59205,
+    0x0040035c0aa59205, 0x0040035c08a59205, 0x0000035c0aa59205, 0x0040035c08a59205,
+};
+
+} // namespace detail
+
+/** The result of a normalization quick-check.
+ *
+ * See UAX #15 "Detecting Normalization Forms".
+ */
+enum class unicode_normalization_quick_check : uint8_t {
+    /** The code-point may appear in the normalization form.
+     */
+    yes = 0,
+
+    /** The code-point can not appear in the normalization form.
+     */
+    no = 1,
+
+    /** The code-point may appear in the normalization form depending on the context.
+     */
+    maybe = 2
+};
+
+/** The Unicode properties of a code-point that are used by the text algorithms.
+ *
+ * The properties are packed in a single 64-bit integer, so that the break and
+ * bidi algorithms can retrieve all the properties of a code-point with a single
+ * table lookup.
+ */
+struct ucd_properties {
+    uint64_t value;
+
+    [[nodiscard]] constexpr unicode_general_category general_category() const noexcept
+    {
+        return static_cast<unicode_general_category>((value >> detail::ucd_properties_general_category_shift) & detail::ucd_properties_general_category_mask);
+    }
+
+    [[nodiscard]] constexpr unicode_grapheme_cluster_break grapheme_cluster_break() const noexcept
+    {
+        return static_cast<unicode_grapheme_cluster_break>((value >> detail::ucd_properties_grapheme_cluster_break_shift) & detail::ucd_properties_grapheme_cluster_break_mask);
+    }
+
+    [[nodiscard]] constexpr unicode_line_break_class line_break_class() const noexcept
+    {
+        return static_cast<unicode_line_break_class>((value >> detail::ucd_properties_line_break_class_shift) & detail::ucd_properties_line_break_class_mask);
+    }
+
+    [[nodiscard]] constexpr unicode_word_break_property word_break_property() const noexcept
+    {
+        return static_cast<unicode_word_break_property>((value >> detail::ucd_properties_word_break_property_shift) & detail::ucd_properties_word_break_property_mask);
+    }
+
+    [[nodiscard]] constexpr unicode_sentence_break_property sentence_break_property() const noexcept
+    {
+        return static_cast<unicode_sentence_break_property>((value >> detail::ucd_properties_sentence_break_property_shift) & detail::ucd_properties_sentence_break_property_mask);
+    }
+
+    [[nodiscard]] constexpr unicode_east_asian_width east_asian_width() const noexcept
+    {
+        return static_cast<unicode_east_asian_width>((value >> detail::ucd_properties_east_asian_width_shift) & detail::ucd_properties_east_asian_width_mask);
+    }
+
+    [[nodiscard]] constexpr unicode_bidi_class bidi_class() const noexcept
+    {
+        return static_cast<unicode_bidi_class>((value >> detail::ucd_properties_bidi_class_shift) & detail::ucd_properties_bidi_class_mask);
+    }
+
+    [[nodiscard]] constexpr unicode_bidi_paired_bracket_type bidi_paired_bracket_type() const noexcept
+    {
+        return static_cast<unicode_bidi_paired_bracket_type>((value >> detail::ucd_properties_bidi_paired_bracket_type_shift) & detail::ucd_properties_bidi_paired_bracket_type_mask);
+    }
+
+    [[nodiscard]] constexpr iso_15924 script() const noexcept
+    {
+        return iso_15924{narrow_cast<uint16_t>((value >> detail::ucd_properties_script_shift) & detail::ucd_properties_script_mask)};
+    }
+
+    [[nodiscard]] constexpr uint8_t canonical_combining_class() const noexcept
+    {
+        return static_cast<uint8_t>((value >> detail::ucd_properties_canonical_combining_class_shift) & detail::ucd_properties_canonical_combining_class_mask);
+    }
+
+    [[nodiscard]] constexpr unicode_normalization_quick_check nfc_quick_check() const noexcept
+    {
+        return static_cast<unicode_normalization_quick_check>((value >> detail::ucd_properties_nfc_quick_check_shift) & detail::ucd_properties_nfc_quick_check_mask);
+    }
+
+    [[nodiscard]] constexpr unicode_normalization_quick_check nfd_quick_check() const noexcept
+    {
+        return static_cast<unicode_normalization_quick_check>((value >> detail::ucd_properties_nfd_quick_check_shift) & detail::ucd_properties_nfd_quick_check_mask);
+    }
+};
+
+/** Get the properties of a Latin-1 code-point.
+ *
+ * @param code_point The code-point to look up, must be less than 256.
+ * @return The properties of the code-point.
+ */
+[[nodiscard]] constexpr ucd_properties ucd_get_latin1_properties(char32_t code_point) noexcept
+{
+    hi_axiom(code_point < 256);
+    return ucd_properties{detail::ucd_properties_latin1[code_point]};
+}
+
+/** Get the properties of a code-point.
+ *
+ * @param code_point The code-point to look up.
+ * @return The properties of the code-point.
+ */
+[[nodiscard]] constexpr ucd_properties ucd_get_properties(char32_t code_point) noexcept
+{
+    if (code_point < 256) {
+        // Most text is ASCII or Latin-1, skip the multi-stage lookup.
+        return ucd_get_latin1_properties(code_point);
+    }
+
+    constexpr auto max_code_point_hi = detail::ucd_properties_indices_size - 1;
+
+    auto code_point_hi = code_point / detail::ucd_properties_chunk_size;
+    hilet code_point_lo = code_point % detail::ucd_properties_chunk_size;
+
+    if (code_point_hi > max_code_point_hi) {
+        code_point_hi = max_code_point_hi;
+    }
+
+    hilet chunk_index = load_bits_be<detail::ucd_properties_index_width>(
+        detail::ucd_properties_indices_bytes,
+        code_point_hi * detail::ucd_properties_index_width);
+
+    // Add back in the lower-bits of the code-point.
+    hilet index = (chunk_index * detail::ucd_properties_chunk_size) + code_point_lo;
+
+    // Get the index of the record from the table.
+    hilet record_index = load_bits_be<detail::ucd_properties_record_index_width>(
+        detail::ucd_properties_record_indices_bytes, index * detail::ucd_properties_record_index_width);
+
+    return ucd_properties{detail::ucd_properties_records[record_index]};
+}
+
+}} // namespace hi::v1
+
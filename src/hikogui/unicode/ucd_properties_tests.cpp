@@ -0,0 +1,71 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "ucd_properties.hpp"
+#include "ucd_canonical_combining_classes.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+
+using namespace hi;
+
+TEST(ucd_properties, ascii)
+{
+    hilet a = ucd_get_properties(U'a');
+    ASSERT_EQ(a.general_category(), unicode_general_category::Ll);
+    ASSERT_EQ(a.line_break_class(), unicode_line_break_class::AL);
+    ASSERT_EQ(a.word_break_property(), unicode_word_break_property::ALetter);
+    ASSERT_EQ(a.sentence_break_property(), unicode_sentence_break_property::Lower);
+    ASSERT_EQ(a.bidi_class(), unicode_bidi_class::L);
+    ASSERT_EQ(a.script(), unicode_script::Latin);
+
+    hilet open_paren = ucd_get_properties(U'(');
+    ASSERT_EQ(open_paren.bidi_paired_bracket_type(), unicode_bidi_paired_bracket_type::o);
+    ASSERT_EQ(open_paren.line_break_class(), unicode_line_break_class::OP);
+}
+
+TEST(ucd_properties, same_as_individual_tables)
+{
+    // The combined table must return the exact same values as the tables of
+    // the individual properties, for every code-point.
+    for (char32_t code_point = 0; code_point <= 0x10'ffff; ++code_point) {
+        hilet properties = ucd_get_properties(code_point);
+        ASSERT_EQ(properties.general_category(), ucd_get_general_category(code_point));
+        ASSERT_EQ(properties.grapheme_cluster_break(), ucd_get_grapheme_cluster_break(code_point));
+        ASSERT_EQ(properties.line_break_class(), ucd_get_line_break_class(code_point));
+        ASSERT_EQ(properties.word_break_property(), ucd_get_word_break_property(code_point));
+        ASSERT_EQ(properties.sentence_break_property(), ucd_get_sentence_break_property(code_point));
+        ASSERT_EQ(properties.east_asian_width(), ucd_get_east_asian_width(code_point));
+        ASSERT_EQ(properties.bidi_class(), ucd_get_bidi_class(code_point));
+        ASSERT_EQ(properties.bidi_paired_bracket_type(), ucd_get_bidi_paired_bracket_type(code_point));
+        ASSERT_EQ(properties.script(), ucd_get_script(code_point));
+        ASSERT_EQ(properties.canonical_combining_class(), ucd_get_canonical_combining_class(code_point));
+    }
+}
+
+TEST(ucd_properties, quick_check)
+{
+    using enum unicode_normalization_quick_check;
+
+    ASSERT_EQ(ucd_get_properties(U'a').nfc_quick_check(), yes);
+    ASSERT_EQ(ucd_get_properties(U'a').nfd_quick_check(), yes);
+
+    // LATIN CAPITAL LETTER A WITH GRAVE
+    ASSERT_EQ(ucd_get_properties(U'\u00c0').nfc_quick_check(), yes);
+    ASSERT_EQ(ucd_get_properties(U'\u00c0').nfd_quick_check(), no);
+
+    // COMBINING GRAVE ACCENT
+    ASSERT_EQ(ucd_get_properties(U'\u0300').nfc_quick_check(), maybe);
+    ASSERT_EQ(ucd_get_properties(U'\u0300').nfd_quick_check(), yes);
+
+    // COMBINING GRAVE TONE MARK, a singleton decomposition.
+    ASSERT_EQ(ucd_get_properties(U'\u0340').nfc_quick_check(), no);
+
+    // DEVANAGARI LETTER QA, a composition exclusion.
+    ASSERT_EQ(ucd_get_properties(U'\u0958').nfc_quick_check(), no);
+
+    // HANGUL JUNGSEONG A and HANGUL SYLLABLE GA.
+    ASSERT_EQ(ucd_get_properties(U'\u1161').nfc_quick_check(), maybe);
+    ASSERT_EQ(ucd_get_properties(U'\uac00').nfc_quick_check(), yes);
+    ASSERT_EQ(ucd_get_properties(U'\uac00').nfd_quick_check(), no);
+}
@@ -4,8 +4,7 @@
 
 #pragma once
 
-#include "ucd_bidi_classes.hpp"
-#include "ucd_bidi_paired_bracket_types.hpp"
+#include "ucd_properties.hpp"
 #include "ucd_bidi_mirroring_glyphs.hpp"
 #include "ucd_decompositions.hpp"
 #include "ucd_general_categories.hpp"
@@ -79,8 +78,10 @@ struct unicode_bidi_char_info {
         this->index = index;
         this->code_point = code_point;
         this->embedding_level = 0;
-        this->direction = this->bidi_class = ucd_get_bidi_class(code_point);
-        this->bracket_type = ucd_get_bidi_paired_bracket_type(code_point);
+
+        hilet properties = ucd_get_properties(code_point);
+        this->direction = this->bidi_class = properties.bidi_class();
+        this->bracket_type = properties.bidi_paired_bracket_type();
     }
 
     /** Constructor for testing to bypass normal initialization.
@@ -0,0 +1,84 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file unicode/unicode_break_latin1.hpp Classification of Latin-1 text for the fast-paths of the break algorithms.
+ */
+
+#pragma once
+
+#include "../SIMD/module.hpp"
+#include "../utility/utility.hpp"
+#include "../macros.hpp"
+#include <cstdint>
+#include <cstddef>
+#include <array>
+#include <vector>
+#include <iterator>
+#include <algorithm>
+#include <bit>
+
+namespace hi { inline namespace v1 {
+namespace detail {
+
+/** Classify the leading Latin-1 characters of a text.
+ *
+ * The code-points are gathered in blocks of 16 characters. For each block
+ * the Latin-1 check and the check for characters that are not handled are
+ * done with SIMD; only the table lookup itself is done per character.
+ *
+ * @param first An iterator to the first character.
+ * @param last An iterator to the last character.
+ * @param code_point_func A function to get the code-point of a character.
+ * @param table The class of each Latin-1 code-point.
+ * @param not_handled The class in @a table of code-points that are not handled.
+ * @return The class of each character, up to the first character that is not
+ *         Latin-1 or not handled.
+ */
+template<typename T, typename It, typename ItEnd, typename CodePointFunc>
+[[nodiscard]] std::vector<T> unicode_break_latin1_classify(
+    It first,
+    ItEnd last,
+    CodePointFunc const& code_point_func,
+    std::array<T, 256> const& table,
+    T not_handled) noexcept
+{
+    static_assert(sizeof(T) == sizeof(uint8_t));
+    static_assert(sizeof(char32_t) == sizeof(uint32_t));
+
+    auto r = std::vector<T>{};
+    r.reserve(narrow_cast<size_t>(std::distance(first, last)));
+
+    alignas(16) auto code_points = std::array<char32_t, 16>{};
+    auto classes = std::array<T, 16>{};
+    auto it = first;
+    while (it != last) {
+        auto size = 0_uz;
+        for (; size != code_points.size() and it != last; ++size, ++it) {
+            code_points[size] = code_point_func(*it);
+        }
+
+        // Any code-point of 256 or larger has a bit set in the upper 24 bits.
+        auto latin1_mask = 0_uz;
+        for (auto i = 0_uz; i != code_points.size(); i += 4) {
+            hilet block = u32x4::load(reinterpret_cast<std::byte const *>(code_points.data() + i));
+            latin1_mask |= ((block >> 8) == u32x4{}).mask() << i;
+        }
+
+        for (auto i = 0_uz; i != classes.size(); ++i) {
+            classes[i] = table[code_points[i] & 0xff];
+        }
+        hilet not_handled_mask =
+            (u8x16{std::bit_cast<std::array<uint8_t, 16>>(classes)} == u8x16::broadcast(std::to_underlying(not_handled)))
+                .mask();
+
+        hilet num_handled = std::min(size, narrow_cast<size_t>(std::countr_one(latin1_mask & ~not_handled_mask)));
+        r.insert(r.end(), classes.begin(), classes.begin() + num_handled);
+        if (num_handled != size) {
+            break;
+        }
+    }
+    return r;
+}
+
+}}} // namespace hi::v1::detail
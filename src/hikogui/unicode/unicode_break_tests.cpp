@@ -18,6 +18,7 @@
 #include <span>
 #include <format>
 #include <ranges>
+#include <random>
 
 
 
@@ -130,3 +131,152 @@ TEST(unicode_break, line_break)
         ASSERT_EQ(test.expected, result) << test.comment;
     }
 }
+
+namespace {
+
+/** Call @a func with every string of length 1 to 4 made from characters of @a alphabet.
+ */
+template<typename Func>
+static void for_each_short_string(std::u32string_view alphabet, Func const& func)
+{
+    auto text = std::u32string{};
+    auto recurse = [&](auto const& self) -> void {
+        func(text);
+        if (text.size() == 4) {
+            return;
+        }
+        for (hilet c : alphabet) {
+            text.push_back(c);
+            self(self);
+            text.pop_back();
+        }
+    };
+
+    for (hilet c : alphabet) {
+        text.push_back(c);
+        recurse(recurse);
+        text.pop_back();
+    }
+}
+
+// Letters, digits, spaces, punctuation, quotes, brackets, hyphens, paragraph separators, Latin-1 letters
+// and symbols, no-break-space (GL), soft-hyphen (Format), next-line (NEL), and the characters
+// that are not handled by the fast-paths: hiragana and a combining mark.
+constexpr auto latin1_alphabet = std::u32string_view{U"aZ1 .,:'\"!?_()}-/\r\n\t\u00e9\u00a9\u00a0\u00ad\u0085\u3042\u0301"};
+
+template<typename Func>
+[[nodiscard]] static std::vector<hi::unicode_break_opportunity> fast_path(std::u32string const& text, Func const& func)
+{
+    hilet code_point_func = [](hilet code_point) -> decltype(auto) {
+        return code_point;
+    };
+
+    auto r = std::vector<hi::unicode_break_opportunity>{};
+    hilet it = func(text.begin(), text.end(), code_point_func, r);
+    return it == text.end() ? r : std::vector<hi::unicode_break_opportunity>{};
+}
+
+} // namespace
+
+TEST(unicode_break, latin1_fast_path)
+{
+    hilet code_point_func = [](hilet code_point) -> decltype(auto) {
+        return code_point;
+    };
+
+    for_each_short_string(latin1_alphabet, [&](std::u32string const& text) {
+        ASSERT_EQ(
+            hi::unicode_line_break(text.begin(), text.end(), code_point_func),
+            hi::detail::unicode_line_break_full(text.begin(), text.end(), code_point_func));
+        ASSERT_EQ(
+            hi::unicode_word_break(text.begin(), text.end(), code_point_func),
+            hi::detail::unicode_word_break_full(text.begin(), text.end(), code_point_func));
+        ASSERT_EQ(
+            hi::unicode_sentence_break(text.begin(), text.end(), code_point_func),
+            hi::detail::unicode_sentence_break_full(text.begin(), text.end(), code_point_func));
+    });
+}
+
+TEST(unicode_break, latin1_fast_path_long)
+{
+    hilet code_point_func = [](hilet code_point) -> decltype(auto) {
+        return code_point;
+    };
+
+    // Longer texts cross the blocks of 16 characters that are classified at once.
+    auto engine = std::mt19937{42};
+    auto length_dist = std::uniform_int_distribution<std::size_t>{0, 80};
+    auto char_dist = std::uniform_int_distribution<std::size_t>{0, latin1_alphabet.size() - 1};
+    for (auto i = 0; i != 10000; ++i) {
+        auto text = std::u32string(length_dist(engine), U' ');
+        for (auto& c : text) {
+            c = latin1_alphabet[char_dist(engine)];
+        }
+
+        ASSERT_EQ(
+            hi::unicode_line_break(text.begin(), text.end(), code_point_func),
+            hi::detail::unicode_line_break_full(text.begin(), text.end(), code_point_func));
+        ASSERT_EQ(
+            hi::unicode_word_break(text.begin(), text.end(), code_point_func),
+            hi::detail::unicode_word_break_full(text.begin(), text.end(), code_point_func));
+        ASSERT_EQ(
+            hi::unicode_sentence_break(text.begin(), text.end(), code_point_func),
+            hi::detail::unicode_sentence_break_full(text.begin(), text.end(), code_point_func));
+    }
+}
+
+TEST(unicode_break, latin1_fast_path_is_taken)
+{
+    hilet line_break = [](auto first, auto last, auto const& code_point_func, auto& r) {
+        return hi::detail::unicode_LB_latin1(first, last, code_point_func, r);
+    };
+    hilet word_break = [](auto first, auto last, auto const& code_point_func, auto& r) {
+        return hi::detail::unicode_word_break_latin1(first, last, code_point_func, r);
+    };
+    hilet sentence_break = [](auto first, auto last, auto const& code_point_func, auto& r) {
+        return hi::detail::unicode_sentence_break_latin1(first, last, code_point_func, r);
+    };
+
+    auto text = std::u32string{U"Hello world, this is caf\u00e9!"};
+    ASSERT_FALSE(fast_path(text, line_break).empty());
+    ASSERT_FALSE(fast_path(text, word_break).empty());
+    ASSERT_FALSE(fast_path(text, sentence_break).empty());
+    ASSERT_TRUE(hi::detail::unicode_grapheme_break_latin1(text.begin(), text.end()));
+
+    text = U"Pi is 3.14. \"Hello world!\" (Well-known) - example/test.";
+    ASSERT_FALSE(fast_path(text, line_break).empty());
+    ASSERT_FALSE(fast_path(text, word_break).empty());
+    ASSERT_FALSE(fast_path(text, sentence_break).empty());
+
+    text = U"\u3042";
+    ASSERT_TRUE(fast_path(text, line_break).empty());
+    ASSERT_TRUE(fast_path(text, word_break).empty());
+    ASSERT_TRUE(fast_path(text, sentence_break).empty());
+    ASSERT_FALSE(hi::detail::unicode_grapheme_break_latin1(text.begin(), text.end()));
+}
+
+TEST(unicode_break, latin1_fast_path_resume)
+{
+    hilet code_point_func = [](hilet code_point) -> decltype(auto) {
+        return code_point;
+    };
+
+    // The full algorithm continues near the first character that is not handled.
+    hilet text = std::u32string{U"Hello world. Good morning \u3042."};
+    hilet first_not_handled = text.find(U'\u3042');
+
+    auto r = std::vector<hi::unicode_break_opportunity>{};
+    auto it = hi::detail::unicode_LB_latin1(text.begin(), text.end(), code_point_func, r);
+    ASSERT_EQ(it - text.begin(), first_not_handled - 1);
+    ASSERT_EQ(r.size(), first_not_handled);
+
+    r.clear();
+    it = hi::detail::unicode_word_break_latin1(text.begin(), text.end(), code_point_func, r);
+    ASSERT_EQ(it - text.begin(), first_not_handled - 1);
+    ASSERT_EQ(r.size(), first_not_handled);
+
+    r.clear();
+    it = hi::detail::unicode_sentence_break_latin1(text.begin(), text.end(), code_point_func, r);
+    ASSERT_EQ(it - text.begin(), text.find(U'g'));
+    ASSERT_EQ(r.size(), text.find(U'g') + 1);
+}
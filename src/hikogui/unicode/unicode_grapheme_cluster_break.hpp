@@ -4,10 +4,14 @@
 
 #pragma once
 
-#include "ucd_grapheme_cluster_breaks.hpp"
+#include "ucd_properties.hpp"
 #include "unicode_break_opportunity.hpp"
+#include "../SIMD/module.hpp"
 #include "../macros.hpp"
 #include <cstdint>
+#include <optional>
+#include <vector>
+#include <iterator>
 
 namespace hi { inline namespace v1 {
 namespace detail {
@@ -133,7 +137,96 @@ struct grapheme_break_state {
  */
 [[nodiscard]] constexpr bool breaks_grapheme(char32_t code_point, grapheme_break_state& state) noexcept
 {
-    return breaks_grapheme(ucd_get_grapheme_cluster_break(code_point), state);
+    return breaks_grapheme(ucd_get_properties(code_point).grapheme_cluster_break(), state);
+}
+
+/** Check if all code-points are Latin-1.
+ *
+ * The code-points are checked 4 at a time (16 bytes) using SIMD.
+ *
+ * @param first A pointer to the first code-point.
+ * @param last A pointer beyond the last code-point.
+ * @return True if all code-points are less than 256.
+ */
+[[nodiscard]] inline bool is_latin1(char32_t const *first, char32_t const *last) noexcept
+{
+    static_assert(sizeof(char32_t) == sizeof(uint32_t));
+
+    // Any code-point of 256 or larger has a bit set in the upper 24 bits.
+    auto all_bits = u32x4{};
+    auto it = first;
+    for (; it + 4 <= last; it += 4) {
+        all_bits |= u32x4::load(reinterpret_cast<std::byte const *>(it));
+    }
+
+    auto r = (all_bits.x() | all_bits.y() | all_bits.z() | all_bits.w()) < 256;
+    for (; it != last; ++it) {
+        r &= *it < 256;
+    }
+    return r;
+}
+
+/** The grapheme cluster break algorithm for Latin-1 text.
+ *
+ * The grapheme cluster break properties of Latin-1 are Other, Control, CR, LF and
+ * Extended_Pictographic, for these the only rule without a break is GB3 "CR × LF".
+ *
+ * @param first An iterator to the first code-point.
+ * @param last An iterator to the last code-point.
+ * @return A list of unicode_break_opportunity, or empty when the text contains
+ *         other characters and the full algorithm needs to be used.
+ */
+template<typename It, typename ItEnd>
+[[nodiscard]] constexpr std::optional<std::vector<unicode_break_opportunity>> unicode_grapheme_break_latin1(It first, ItEnd last) noexcept
+{
+    static_assert(
+        [] {
+            using enum unicode_grapheme_cluster_break;
+            for (auto i = 0_uz; i != 256; ++i) {
+                hilet cluster_break = ucd_get_latin1_properties(char_cast<char32_t>(i)).grapheme_cluster_break();
+                if (cluster_break != Other and cluster_break != Control and cluster_break != CR and cluster_break != LF and
+                    cluster_break != Extended_Pictographic) {
+                    return false;
+                }
+            }
+            return true;
+        }(),
+        "The Latin-1 fast-path must handle all Latin-1 grapheme cluster breaks.");
+
+    using enum unicode_break_opportunity;
+
+    auto is_checked = false;
+    if constexpr (std::contiguous_iterator<It> and std::same_as<std::iter_value_t<It>, char32_t>) {
+        if (not std::is_constant_evaluated()) {
+            if (not is_latin1(std::to_address(first), std::to_address(first) + std::distance(first, last))) {
+                return std::nullopt;
+            }
+            is_checked = true;
+        }
+    }
+
+    auto r = std::vector<unicode_break_opportunity>{};
+    r.reserve(narrow_cast<size_t>(std::distance(first, last)) + 1);
+
+    auto prev = U'\0';
+    for (auto it = first; it != last; ++it) {
+        hilet code_point = char32_t{*it};
+        if (not is_checked and code_point >= 256) {
+            return std::nullopt;
+        }
+
+        if (it == first) {
+            r.push_back(yes); // GB1
+        } else if (prev == U'\r' and code_point == U'\n') {
+            r.push_back(no); // GB3
+        } else {
+            r.push_back(yes); // GB4, GB5, GB999
+        }
+        prev = code_point;
+    }
+
+    r.push_back(yes); // GB2
+    return r;
 }
 
 } // namespace detail
@@ -141,6 +234,10 @@ struct grapheme_break_state {
 template<typename It, typename ItEnd>
 [[nodiscard]] constexpr std::vector<unicode_break_opportunity> unicode_grapheme_break(It first, ItEnd last) noexcept
 {
+    if (auto r = detail::unicode_grapheme_break_latin1(first, last)) {
+        return *std::move(r);
+    }
+
     auto r = std::vector<unicode_break_opportunity>{};
     auto state = detail::grapheme_break_state{};
 
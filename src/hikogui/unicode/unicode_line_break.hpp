@@ -8,16 +8,16 @@
 #pragma once
 
 #include "unicode_break_opportunity.hpp"
-#include "ucd_general_categories.hpp"
-#include "ucd_grapheme_cluster_breaks.hpp"
-#include "ucd_line_break_classes.hpp"
-#include "ucd_east_asian_widths.hpp"
+#include "unicode_break_latin1.hpp"
+#include "ucd_properties.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
 #include <cstdint>
 #include <vector>
+#include <array>
 #include <algorithm>
 #include <numeric>
+#include <iterator>
 
 
 
@@ -78,6 +78,29 @@ using unicode_line_break_info_vector = std::vector<unicode_line_break_info>;
 using unicode_line_break_info_iterator = unicode_line_break_info_vector::iterator;
 using unicode_line_break_info_const_iterator = unicode_line_break_info_vector::const_iterator;
 
+/** Resolve the line break class of a character.
+ *
+ * LB1: Assign a line breaking class to each code point of the input.
+ */
+[[nodiscard]] constexpr unicode_line_break_class unicode_LB1_resolve(ucd_properties properties) noexcept
+{
+    using enum unicode_line_break_class;
+
+    hilet break_class = properties.line_break_class();
+    switch (break_class) {
+    case AI:
+    case SG:
+    case XX:
+        return AL;
+    case CJ:
+        return NS;
+    case SA:
+        return is_Mn_or_Mc(properties.general_category()) ? CM : AL;
+    default:
+        return break_class;
+    }
+}
+
 template<typename It, typename ItEnd, typename CodePointFunc>
 [[nodiscard]] constexpr std::vector<unicode_line_break_info>
 unicode_LB1(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept
@@ -86,33 +109,13 @@ unicode_LB1(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept
     r.reserve(std::distance(first, last));
 
     for (auto it = first; it != last; ++it) {
-        hilet code_point = code_point_func(*it);
-        hilet east_asian_width = ucd_get_east_asian_width(code_point);
-        hilet break_class = ucd_get_line_break_class(code_point);
-        hilet general_category = ucd_get_general_category(code_point);
-        hilet grapheme_cluster_break = ucd_get_grapheme_cluster_break(code_point);
-
-        hilet resolved_break_class = [&]() {
-            switch (break_class) {
-                using enum unicode_line_break_class;
-            case AI:
-            case SG:
-            case XX:
-                return AL;
-            case CJ:
-                return NS;
-            case SA:
-                return is_Mn_or_Mc(general_category) ? CM : AL;
-            default:
-                return break_class;
-            }
-        }();
+        hilet properties = ucd_get_properties(code_point_func(*it));
 
         r.emplace_back(
-            resolved_break_class,
-            general_category == unicode_general_category::Cn,
-            grapheme_cluster_break == unicode_grapheme_cluster_break::Extended_Pictographic,
-            east_asian_width);
+            unicode_LB1_resolve(properties),
+            properties.general_category() == unicode_general_category::Cn,
+            properties.grapheme_cluster_break() == unicode_grapheme_cluster_break::Extended_Pictographic,
+            properties.east_asian_width());
     }
 
     return r;
@@ -618,9 +621,196 @@ unicode_LB_width(unicode_break_vector const& opportunities, std::vector<float> c
     return {width, std::move(line_lengths)};
 }
 
-} // namespace detail
+/** The line break classes of Latin-1 characters handled by the fast-path.
+ *
+ * Characters of other classes are marked XX, which is never a resolved class.
+ */
+constexpr auto unicode_LB_latin1_classes = [] {
+    using enum unicode_line_break_class;
+    using enum unicode_east_asian_width;
+
+    auto r = std::array<unicode_line_break_class, 256>{};
+    for (auto i = 0_uz; i != r.size(); ++i) {
+        hilet properties = ucd_get_latin1_properties(char_cast<char32_t>(i));
+        hilet break_class = unicode_LB1_resolve(properties);
+        hilet east_asian_width = properties.east_asian_width();
+
+        switch (break_class) {
+        case BK:
+        case CR:
+        case LF:
+        case NL:
+        case SP:
+        case GL:
+        case AL:
+        case NU:
+        case IS:
+        case SY:
+        case EX:
+        case HY:
+        case BA:
+        case QU:
+        case OP:
+        case CL:
+        case CP:
+            // LB30 depends on the east-asian-width of OP and CP.
+            r[i] = (east_asian_width == F or east_asian_width == W or east_asian_width == H) ? XX : break_class;
+            break;
+        default:
+            r[i] = XX;
+        }
+    }
+    return r;
+}();
 
-/** The unicode line break algorithm UAX #14
+/** The line break rules LB4 to LB31 for the classes handled by the fast-path.
+ *
+ * Without CM, ZWJ, WJ, B2, NS, PR, PO and the east-asian classes the rules
+ * only depend on the two characters around the break opportunity and the
+ * state that unicode_LB_walk() keeps.
+ *
+ * @param cur The class of the character before the break opportunity.
+ * @param next The class of the character after the break opportunity.
+ * @param cur_sp The class of the last character before the break opportunity that is not SP.
+ * @param cur_nu The state of a "NU (NU|SY|IS)* (CL|CP)?" sequence.
+ */
+[[nodiscard]] constexpr unicode_break_opportunity unicode_LB_latin1_rules(
+    unicode_line_break_class cur,
+    unicode_line_break_class next,
+    unicode_line_break_class cur_sp,
+    unicode_line_break_class cur_nu) noexcept
+{
+    using enum unicode_break_opportunity;
+    using enum unicode_line_break_class;
+
+    if (cur == BK) {
+        return mandatory; // LB4: 4.0
+    } else if (cur == CR and next == LF) {
+        return no; // LB5: 5.01
+    } else if (cur == CR or cur == LF or cur == NL) {
+        return mandatory; // LB5: 5.02, 5.03, 5.04
+    } else if (next == BK or next == CR or next == LF or next == NL) {
+        return no; // LB6: 6.0
+    } else if (next == SP) {
+        return no; // LB7: 7.01
+    } else if (cur == GL) {
+        return no; // LB12: 12.0
+    } else if (cur != SP and cur != BA and cur != HY and next == GL) {
+        return no; // LB12a: 12.1
+    } else if (next == CL or next == CP or next == EX or next == IS or next == SY) {
+        return no; // LB13: 13.0
+    } else if (cur_sp == OP) {
+        return no; // LB14: 14.0
+    } else if (cur_sp == QU and next == OP) {
+        return no; // LB15: 15.0
+    } else if (cur == SP) {
+        return yes; // LB18: 18.0
+    } else if (cur == QU or next == QU) {
+        return no; // LB19: 19.01, 19.02
+    } else if (next == BA or next == HY) {
+        return no; // LB21: 21.02, 21.03
+    } else if (cur == AL and next == NU) {
+        return no; // LB23: 23.02
+    } else if (cur == NU and next == AL) {
+        return no; // LB23: 23.03
+    } else if ((cur == OP or cur == HY) and next == NU) {
+        return no; // LB25: 25.02
+    } else if ((cur == NU or cur_nu == NU) and next == NU) {
+        return no; // LB25: 25.03, 25.04
+    } else if (cur == AL and next == AL) {
+        return no; // LB28: 28.0
+    } else if (cur == IS and next == AL) {
+        return no; // LB29: 29.0
+    } else if ((cur == AL or cur == NU) and next == OP) {
+        return no; // LB30: 30.01
+    } else if (cur == CP and (next == AL or next == NU)) {
+        return no; // LB30: 30.02
+    } else {
+        return yes; // LB31: 999.0
+    }
+}
+
+/** The line break algorithm for the leading Latin-1 characters of a text.
+ *
+ * Most text in a user interface only contains letters, digits, spaces,
+ * punctuation, quotes, brackets and hyphens. The break opportunities of these
+ * characters are appended to @a r until the first character that is not handled.
+ *
+ * The full algorithm then continues at a character where its state is the same
+ * as at the start of a text, so that the opportunities after that character
+ * are identical to running the full algorithm on the whole text.
+ *
+ * @param first An iterator to the first character.
+ * @param last An iterator to the last character.
+ * @param code_point_func A function to get the code-point of a character.
+ * @param[out] r The break opportunities before each character, up to and including
+ *             the character returned.
+ * @return @a last when the whole text was handled, otherwise the character
+ *         from where the full algorithm needs to continue.
+ */
+template<typename It, typename ItEnd, typename CodePointFunc>
+[[nodiscard]] It unicode_LB_latin1(It first, ItEnd last, CodePointFunc const& code_point_func, unicode_break_vector& r) noexcept
+{
+    using enum unicode_line_break_class;
+    using enum unicode_break_opportunity;
+
+    hi_axiom(r.empty());
+    if (first == last) {
+        r.push_back(mandatory); // LB2, LB3
+        return first;
+    }
+
+    hilet size = narrow_cast<size_t>(std::distance(first, last));
+    hilet classes = unicode_break_latin1_classify(first, last, code_point_func, unicode_LB_latin1_classes, XX);
+
+    r.push_back(no); // LB2
+
+    // The same state as unicode_LB_walk().
+    auto prev = XX;
+    auto cur_sp = XX;
+    auto cur_nu = XX;
+    auto resume = 0_uz;
+    for (auto i = 0_uz; i != classes.size(); ++i) {
+        hilet cur = classes[i];
+        if (i != 0) {
+            r.push_back(unicode_LB_latin1_rules(prev, cur, cur_sp, cur_nu));
+        }
+
+        if (cur != SP) {
+            cur_sp = cur;
+        }
+
+        if (cur_nu == CL) {
+            cur_nu = XX;
+        } else if (cur_nu == NU) {
+            if (cur == CL or cur == CP) {
+                cur_nu = CL;
+            } else if (cur != NU and cur != SY and cur != IS) {
+                cur_nu = XX;
+            }
+        } else if (cur == NU) {
+            cur_nu = NU;
+        }
+
+        // The full algorithm starting at this character would track the same state.
+        if ((cur != SP or (cur_sp != OP and cur_sp != QU and cur_sp != CL and cur_sp != CP)) and
+            cur_nu == (cur == NU ? NU : XX)) {
+            resume = i;
+        }
+
+        prev = cur;
+    }
+
+    if (classes.size() == size) {
+        r.push_back(mandatory); // LB3
+        return std::next(first, size);
+    }
+
+    r.resize(resume + 1);
+    return std::next(first, resume);
+}
+
+/** The full unicode line break algorithm UAX #14
  *
  * @param first An iterator to the first character.
  * @param last An iterator to the last character.
@@ -629,17 +819,44 @@ unicode_LB_width(unicode_break_vector const& opportunities, std::vector<float> c
  */
 template<typename It, typename ItEnd, typename CodePointFunc>
 [[nodiscard]] inline unicode_break_vector
-unicode_line_break(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept
+unicode_line_break_full(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept
 {
     auto size = narrow_cast<size_t>(std::distance(first, last));
     auto r = unicode_break_vector{size + 1, unicode_break_opportunity::unassigned};
 
-    auto infos = detail::unicode_LB1(first, last, code_point_func);
-    detail::unicode_LB2_3(r);
-    detail::unicode_LB4_8a(r, infos);
-    detail::unicode_LB9(r, infos);
-    detail::unicode_LB10(infos);
-    detail::unicode_LB11_31(r, infos);
+    auto infos = unicode_LB1(first, last, code_point_func);
+    unicode_LB2_3(r);
+    unicode_LB4_8a(r, infos);
+    unicode_LB9(r, infos);
+    unicode_LB10(infos);
+    unicode_LB11_31(r, infos);
+    return r;
+}
+
+} // namespace detail
+
+/** The unicode line break algorithm UAX #14
+ *
+ * The leading Latin-1 text is handled by a fast-path which gives identical results.
+ *
+ * @param first An iterator to the first character.
+ * @param last An iterator to the last character.
+ * @param code_point_func A function to get the code-point of a character.
+ * @return A list of unicode_break_opportunity.
+ */
+template<typename It, typename ItEnd, typename CodePointFunc>
+[[nodiscard]] inline unicode_break_vector
+unicode_line_break(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept
+{
+    auto r = unicode_break_vector{};
+    r.reserve(narrow_cast<size_t>(std::distance(first, last)) + 1);
+
+    hilet it = detail::unicode_LB_latin1(first, last, code_point_func, r);
+    if (it != last) {
+        // The opportunity before the first character of the tail was determined by the fast-path.
+        hilet tail = detail::unicode_line_break_full(it, last, code_point_func);
+        r.insert(r.end(), tail.begin() + 1, tail.end());
+    }
     return r;
 }
 
@@ -7,13 +7,17 @@
 #include "ucd_decompositions.hpp"
 #include "ucd_compositions.hpp"
 #include "ucd_canonical_combining_classes.hpp"
+#include "ucd_properties.hpp"
 #include "unicode_description.hpp"
 #include "../algorithm/module.hpp"
+#include "../char_maps/module.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
 #include <cstdint>
 #include <string>
 #include <string_view>
+#include <array>
+#include <iterator>
 
 
 
@@ -131,13 +135,22 @@ struct unicode_normalize_config {
 
 namespace detail {
 
-constexpr void unicode_decompose(char32_t code_point, unicode_normalize_config config, std::u32string& r) noexcept
+/** Decompose a code-point.
+ *
+ * @param code_point The code-point to decompose.
+ * @param config The normalization configuration.
+ * @param func A function called with each code-unit of the decomposition; the
+ *             lower 24 bits are the code-point, the upper 8 bits the canonical
+ *             combining class.
+ */
+template<typename Func>
+constexpr void unicode_decompose(char32_t code_point, unicode_normalize_config const& config, Func const& func) noexcept
 {
     for (hilet c : config.line_separators) {
         if (code_point == c) {
-            r += config.line_separator_character;
+            func(config.line_separator_character);
             if (config.line_separator_character == unicode_CR) {
-                r += unicode_LF;
+                func(unicode_LF);
             }
             return;
         }
@@ -145,9 +158,9 @@ constexpr void unicode_decompose(char32_t code_point, unicode_normalize_config c
 
     for (hilet c : config.paragraph_separators) {
         if (code_point == c) {
-            r += config.paragraph_separator_character;
+            func(config.paragraph_separator_character);
             if (config.paragraph_separator_character == unicode_CR) {
-                r += unicode_LF;
+                func(unicode_LF);
             }
             return;
         }
@@ -170,34 +183,48 @@ constexpr void unicode_decompose(char32_t code_point, unicode_normalize_config c
     hilet decomposition_info = ucd_get_decomposition(code_point);
     if (decomposition_info.should_decompose(config.decomposition_mask)) {
         for (hilet c : decomposition_info.decompose()) {
-            unicode_decompose(c, config, r);
+            unicode_decompose(c, config, func);
         }
 
     } else {
         hilet ccc = ucd_get_canonical_combining_class(code_point);
-        r += code_point | (wide_cast<char32_t>(ccc) << 24);
+        func(code_point | (wide_cast<char32_t>(ccc) << 24));
     }
 }
 
-constexpr void unicode_decompose(std::u32string_view text, unicode_normalize_config config, std::u32string& r) noexcept
+constexpr void unicode_decompose(char32_t code_point, unicode_normalize_config const& config, std::u32string& r) noexcept
+{
+    unicode_decompose(code_point, config, [&r](char32_t code_unit) {
+        r += code_unit;
+    });
+}
+
+constexpr void unicode_decompose(std::u32string_view text, unicode_normalize_config const& config, std::u32string& r) noexcept
 {
     for (hilet c : text) {
         unicode_decompose(c, config, r);
     }
 }
 
-constexpr void unicode_compose(std::u32string& text) noexcept
+/** Compose decomposed and reordered text in-place.
+ *
+ * @param first An iterator to the first code-unit.
+ * @param last An iterator beyond the last code-unit.
+ * @return An iterator beyond the last composed code-point.
+ */
+template<std::random_access_iterator It>
+constexpr It unicode_compose(It first, It last) noexcept
 {
-    if (text.size() <= 1) {
-        return;
+    if (std::distance(first, last) <= 1) {
+        return last;
     }
 
-    // This algorithm reads using `i`-index and writes using the `j`-index.
+    // This algorithm reads using `i`-iterator and writes using the `j`-iterator.
     // When compositing characters, `j` will lag behind.
-    auto i = 0_uz;
-    auto j = 0_uz;
-    while (i != text.size()) {
-        hilet code_unit = text[i++];
+    auto i = first;
+    auto j = first;
+    while (i != last) {
+        hilet code_unit = *i++;
         hilet code_point = code_unit & 0xff'ffff;
         hilet combining_class = code_unit >> 24;
         hilet first_is_starter = combining_class == 0;
@@ -210,8 +237,8 @@ constexpr void unicode_compose(std::u32string& text) noexcept
             // Try composing.
             auto first_code_point = code_point;
             char32_t previous_combining_class = 0;
-            for (auto k = i; k != text.size(); ++k) {
-                hilet second_code_unit = text[k];
+            for (auto k = i; k != last; ++k) {
+                hilet second_code_unit = *k;
                 hilet second_code_point = second_code_unit & 0xff'ffff;
                 hilet second_combining_class = second_code_unit >> 24;
 
@@ -225,7 +252,7 @@ constexpr void unicode_compose(std::u32string& text) noexcept
                     // The canonical combined DecompositionOrder is always zero.
                     previous_combining_class = 0;
                     // Snuff out the code-unit.
-                    text[k] = 0xffff'ffff;
+                    *k = 0xffff'ffff;
 
                 } else if (second_is_starter) {
                     // End after failing to compose with the next start-character.
@@ -237,15 +264,20 @@ constexpr void unicode_compose(std::u32string& text) noexcept
                 }
             }
             // Add the new combined character to the text.
-            text[j++] = first_code_point;
+            *j++ = first_code_point;
 
         } else {
             // Unable to compose this character.
-            text[j++] = code_point;
+            *j++ = code_point;
         }
     }
 
-    text.resize(j);
+    return j;
+}
+
+constexpr void unicode_compose(std::u32string& text) noexcept
+{
+    text.erase(unicode_compose(text.begin(), text.end()), text.end());
 }
 
 constexpr void unicode_reorder(std::u32string& text) noexcept
@@ -272,6 +304,32 @@ constexpr void unicode_reorder(std::u32string& text) noexcept
     std::stable_sort(cluster_it, last, ccc_less);
 }
 
+/** Reorder a short sequence of code-units in-place, without allocating.
+ *
+ * The combining characters following a starter are sorted by their canonical
+ * combining class using an insertion sort, which is stable.
+ *
+ * @param first An iterator to the first code-unit.
+ * @param last An iterator beyond the last code-unit.
+ */
+template<std::random_access_iterator It>
+constexpr void unicode_reorder(It first, It last) noexcept
+{
+    for (auto it = first; it != last; ++it) {
+        hilet code_unit = *it;
+        hilet ccc = code_unit >> 24;
+        if (ccc == 0) {
+            continue;
+        }
+
+        auto jt = it;
+        for (; jt != first and (*(jt - 1) >> 24) > ccc; --jt) {
+            *jt = *(jt - 1);
+        }
+        *jt = code_unit;
+    }
+}
+
 constexpr void unicode_clean(std::u32string& text) noexcept
 {
     // clean up the text by removing the upper bits.
@@ -280,8 +338,184 @@ constexpr void unicode_clean(std::u32string& text) noexcept
     }
 }
 
+/** Check if a code-point is replaced or dropped by the options of the configuration.
+ */
+[[nodiscard]] constexpr bool unicode_normalize_is_replaced(char32_t code_point, unicode_normalize_config const& config) noexcept
+{
+    if (config.drop_C0 and ((code_point >= U'\u0000' and code_point <= U'\u001f') or code_point == U'\u007f')) {
+        return true;
+    }
+
+    if (config.drop_C1 and code_point >= U'\u0080' and code_point <= U'\u009f') {
+        return true;
+    }
+
+    return config.line_separators.find(code_point) != std::u32string::npos or
+        config.paragraph_separators.find(code_point) != std::u32string::npos or
+        config.drop.find(code_point) != std::u32string::npos;
+}
+
+/** Quick-check if text is in a canonical normal form.
+ *
+ * See UAX #15 "Detecting Normalization Forms".
+ *
+ * @tparam Compose Check for the composed (NFC) instead of decomposed (NFD) form.
+ * @param text The text to check.
+ * @param config The normalization configuration.
+ * @return yes when the text is normalized, no when it is not and maybe when the
+ *         full normalization algorithm is needed to find out.
+ */
+template<bool Compose>
+[[nodiscard]] constexpr unicode_normalization_quick_check
+unicode_quick_check(std::u32string_view text, unicode_normalize_config const& config) noexcept
+{
+    using enum unicode_normalization_quick_check;
+
+    if (config.decomposition_mask != unicode_normalize_config::NFD().decomposition_mask) {
+        // Quick-check properties are only available for the canonical normal forms.
+        return maybe;
+    }
+
+    auto r = yes;
+    auto prev_ccc = uint8_t{0};
+    for (hilet code_point : text) {
+        if (unicode_normalize_is_replaced(code_point, config)) {
+            return no;
+        }
+
+        hilet properties = ucd_get_properties(code_point);
+        hilet ccc = properties.canonical_combining_class();
+        if (ccc != 0 and prev_ccc > ccc) {
+            // Combining characters are not in canonical order.
+            return no;
+        }
+
+        hilet check = Compose ? properties.nfc_quick_check() : properties.nfd_quick_check();
+        if (check == no) {
+            return no;
+        } else if (check == maybe) {
+            r = maybe;
+        }
+        prev_ccc = ccc;
+    }
+    return r;
+}
+
 } // namespace detail
 
+/** Quick-check if text is in Normalization Form C.
+ *
+ * @param text The text to check.
+ * @return yes when the text is in NFC, no when it is not and maybe when
+ *         `unicode_normalize()` needs to be used to find out.
+ */
+[[nodiscard]] constexpr unicode_normalization_quick_check unicode_quick_check_NFC(std::u32string_view text) noexcept
+{
+    return detail::unicode_quick_check<true>(text, unicode_normalize_config::NFC());
+}
+
+/** Quick-check if text is in Normalization Form D.
+ *
+ * @param text The text to check.
+ * @return yes when the text is in NFD, otherwise no.
+ */
+[[nodiscard]] constexpr unicode_normalization_quick_check unicode_quick_check_NFD(std::u32string_view text) noexcept
+{
+    return detail::unicode_quick_check<false>(text, unicode_normalize_config::NFD());
+}
+
+/** Incremental Unicode normalizer.
+ *
+ * Code-points are added one at a time and the normalized code-points are written
+ * to an output iterator as soon as they can no longer be changed by the
+ * code-points that follow.
+ *
+ * The normalizer does not allocate; the code-points that may still be reordered
+ * or composed are held in a buffer of `capacity` code-units. Text that is not
+ * in the Stream-Safe Text Format (UAX #15 section 13), with more than 30
+ * combining characters in a row, is normalized in parts of `capacity`
+ * code-units.
+ *
+ * @tparam Compose Compose the text (NFC, NFKC) after decomposing (NFD, NFKD).
+ */
+template<bool Compose = true>
+class unicode_normalizer {
+public:
+    constexpr static std::size_t capacity = 64;
+
+    /** Create a normalizer.
+     *
+     * @param config The normalization configuration, must outlive the normalizer.
+     */
+    constexpr explicit unicode_normalizer(unicode_normalize_config const& config) noexcept : _config(&config) {}
+
+    /** Add a code-point to the normalizer.
+     *
+     * @param code_point The code-point to add.
+     * @param out The output iterator to write normalized code-points to.
+     * @return The output iterator after writing.
+     */
+    template<std::output_iterator<char32_t> It>
+    constexpr It push(char32_t code_point, It out) noexcept
+    {
+        detail::unicode_decompose(code_point, *_config, [&](char32_t code_unit) {
+            out = push_code_unit(code_unit, out);
+        });
+        return out;
+    }
+
+    /** Write the remaining code-points to the output.
+     *
+     * This must be called at the end of the text.
+     *
+     * @param out The output iterator to write normalized code-points to.
+     * @return The output iterator after writing.
+     */
+    template<std::output_iterator<char32_t> It>
+    constexpr It flush(It out) noexcept
+    {
+        hilet first = _buffer.begin();
+        auto last = first + _size;
+
+        detail::unicode_reorder(first, last);
+        if constexpr (Compose) {
+            last = detail::unicode_compose(first, last);
+        }
+
+        for (auto it = first; it != last; ++it) {
+            *out = *it & 0x1f'ffff;
+            ++out;
+        }
+
+        _size = 0;
+        return out;
+    }
+
+private:
+    unicode_normalize_config const *_config;
+    std::array<char32_t, capacity> _buffer = {};
+    std::size_t _size = 0;
+
+    template<std::output_iterator<char32_t> It>
+    constexpr It push_code_unit(char32_t code_unit, It out) noexcept
+    {
+        hilet is_starter = (code_unit >> 24) == 0;
+
+        if (is_starter and (not Compose or
+                            ucd_get_properties(code_unit).nfc_quick_check() == unicode_normalization_quick_check::yes)) {
+            // This starter will not be reordered and does not compose with the
+            // code-points before it, so those are final.
+            out = flush(out);
+
+        } else if (_size == capacity) {
+            out = flush(out);
+        }
+
+        _buffer[_size++] = code_unit;
+        return out;
+    }
+};
+
 /** Convert text to a Unicode decomposed normal form.
  *
  * @param text to normalize, in-place.
@@ -290,6 +524,11 @@ constexpr void unicode_clean(std::u32string& text) noexcept
 [[nodiscard]] constexpr std::u32string
 unicode_decompose(std::u32string_view text, unicode_normalize_config config = unicode_normalize_config::NFD()) noexcept
 {
+    if (detail::unicode_quick_check<false>(text, config) == unicode_normalization_quick_check::yes) {
+        // Most text is already normalized.
+        return std::u32string{text};
+    }
+
     auto r = std::u32string{};
     detail::unicode_decompose(text, config, r);
     detail::unicode_reorder(r);
@@ -305,6 +544,11 @@ unicode_decompose(std::u32string_view text, unicode_normalize_config config = un
 [[nodiscard]] constexpr std::u32string
 unicode_normalize(std::u32string_view text, unicode_normalize_config config = unicode_normalize_config::NFC()) noexcept
 {
+    if (detail::unicode_quick_check<true>(text, config) == unicode_normalization_quick_check::yes) {
+        // Most text is already normalized.
+        return std::u32string{text};
+    }
+
     auto r = std::u32string{};
     detail::unicode_decompose(text, config, r);
     detail::unicode_reorder(r);
@@ -313,4 +557,42 @@ unicode_normalize(std::u32string_view text, unicode_normalize_config config = un
     return r;
 }
 
+/** Convert UTF-8 text to a Unicode decomposed normal form, without allocating.
+ *
+ * @param text The UTF-8 encoded text to normalize.
+ * @param out The output iterator to write the normalized code-points to.
+ * @param config The normalization configuration.
+ * @return The output iterator after writing.
+ */
+template<std::output_iterator<char32_t> It>
+constexpr It
+unicode_decompose(std::string_view text, It out, unicode_normalize_config const& config = unicode_normalize_config::NFD()) noexcept
+{
+    auto normalizer = unicode_normalizer<false>{config};
+    for (auto it = text.begin(); it != text.end();) {
+        hilet[code_point, valid] = char_map<"utf-8">{}.read(it, text.end());
+        out = normalizer.push(code_point, out);
+    }
+    return normalizer.flush(out);
+}
+
+/** Convert UTF-8 text to a Unicode composed normal form, without allocating.
+ *
+ * @param text The UTF-8 encoded text to normalize.
+ * @param out The output iterator to write the normalized code-points to.
+ * @param config The normalization configuration.
+ * @return The output iterator after writing.
+ */
+template<std::output_iterator<char32_t> It>
+constexpr It
+unicode_normalize(std::string_view text, It out, unicode_normalize_config const& config = unicode_normalize_config::NFC()) noexcept
+{
+    auto normalizer = unicode_normalizer<true>{config};
+    for (auto it = text.begin(); it != text.end();) {
+        hilet[code_point, valid] = char_map<"utf-8">{}.read(it, text.end());
+        out = normalizer.push(code_point, out);
+    }
+    return normalizer.flush(out);
+}
+
 } // namespace hi::inline v1
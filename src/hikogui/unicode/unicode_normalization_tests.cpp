@@ -212,3 +212,77 @@ TEST(unicode_normalization, Invariant)
 }
 
 #endif
+
+TEST(unicode_normalization, quick_check)
+{
+    ASSERT_EQ(unicode_quick_check_NFC(U"Audio device:"), unicode_normalization_quick_check::yes);
+    ASSERT_EQ(unicode_quick_check_NFD(U"Audio device:"), unicode_normalization_quick_check::yes);
+
+    ASSERT_EQ(unicode_quick_check_NFC(U"caf\u00e9"), unicode_normalization_quick_check::yes);
+    ASSERT_EQ(unicode_quick_check_NFD(U"caf\u00e9"), unicode_normalization_quick_check::no);
+
+    ASSERT_EQ(unicode_quick_check_NFC(U"cafe\u0301"), unicode_normalization_quick_check::maybe);
+    ASSERT_EQ(unicode_quick_check_NFD(U"cafe\u0301"), unicode_normalization_quick_check::yes);
+
+    // Combining characters in the wrong order.
+    ASSERT_EQ(unicode_quick_check_NFC(U"a\u0301\u0323"), unicode_normalization_quick_check::no);
+    ASSERT_EQ(unicode_quick_check_NFD(U"a\u0301\u0323"), unicode_normalization_quick_check::no);
+
+    for (hilet& test : parseNormalizationTests()) {
+        ASSERT_NE(unicode_quick_check_NFC(test.c2), unicode_normalization_quick_check::no) << test.comment;
+        ASSERT_EQ(unicode_quick_check_NFD(test.c3), unicode_normalization_quick_check::yes) << test.comment;
+
+        if (unicode_quick_check_NFC(test.c1) == unicode_normalization_quick_check::yes) {
+            ASSERT_EQ(test.c1, test.c2) << test.comment;
+        }
+        if (unicode_quick_check_NFD(test.c1) == unicode_normalization_quick_check::yes) {
+            ASSERT_EQ(test.c1, test.c3) << test.comment;
+        }
+    }
+}
+
+TEST(unicode_normalization, streaming_NFC_NFD)
+{
+    for (hilet& test : parseNormalizationTests()) {
+        for (hilet& c : {test.c1, test.c2, test.c3}) {
+            auto r = std::u32string{};
+            unicode_normalize(hi::to_string(c), std::back_inserter(r));
+            ASSERT_EQ(r, test.c2) << test.comment;
+
+            r.clear();
+            unicode_decompose(hi::to_string(c), std::back_inserter(r));
+            ASSERT_EQ(r, test.c3) << test.comment;
+        }
+    }
+}
+
+TEST(unicode_normalization, streaming_NFKC_NFKD)
+{
+    hilet NFKC = unicode_normalize_config::NFKC();
+    hilet NFKD = unicode_normalize_config::NFKD();
+
+    for (hilet& test : parseNormalizationTests()) {
+        for (hilet& c : {test.c1, test.c2, test.c3, test.c4, test.c5}) {
+            auto r = std::u32string{};
+            unicode_normalize(hi::to_string(c), std::back_inserter(r), NFKC);
+            ASSERT_EQ(r, test.c4) << test.comment;
+
+            r.clear();
+            unicode_decompose(hi::to_string(c), std::back_inserter(r), NFKD);
+            ASSERT_EQ(r, test.c5) << test.comment;
+        }
+    }
+}
+
+TEST(unicode_normalization, streaming_long_combining_sequence)
+{
+    // Not stream-safe text, more combining characters than fit in the buffer.
+    auto text = std::u32string{U"e"};
+    for (auto i = 0; i != 200; ++i) {
+        text += U'\u0301';
+    }
+
+    auto r = std::u32string{};
+    unicode_normalize(hi::to_string(text), std::back_inserter(r));
+    ASSERT_EQ(r, unicode_normalize(text));
+}
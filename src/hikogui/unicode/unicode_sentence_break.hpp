@@ -7,9 +7,14 @@
 
 #pragma once
 
-#include "ucd_sentence_break_properties.hpp"
+#include "unicode_break_opportunity.hpp"
+#include "unicode_break_latin1.hpp"
+#include "ucd_properties.hpp"
 #include "../macros.hpp"
 #include <tuple>
+#include <array>
+#include <vector>
+#include <iterator>
 
 namespace hi::inline v1 {
 
@@ -237,32 +242,239 @@ private:
     }
 }
 
+/** The sentence break properties of Latin-1 characters handled by the fast-path.
+ *
+ * Characters that are skipped by SB5 (Extend, Format) are not handled and are
+ * marked Extend.
+ */
+constexpr auto unicode_sentence_break_latin1_properties = [] {
+    using enum unicode_sentence_break_property;
+
+    auto r = std::array<unicode_sentence_break_property, 256>{};
+    for (auto i = 0_uz; i != r.size(); ++i) {
+        hilet property = ucd_get_latin1_properties(char_cast<char32_t>(i)).sentence_break_property();
+        r[i] = property == Format ? Extend : property;
+    }
+    return r;
+}();
+
+/** The sentence break rules SB3 to SB998 for Latin-1 characters.
+ *
+ * Latin-1 characters handled by the fast-path are never skipped by SB5.
+ *
+ * @param prev_prev The character before @a prev, or Other.
+ * @param prev The character before the break opportunity, or Other.
+ * @param next The character after the break opportunity.
+ * @param prefix The character before "Close* Sp* ParaSep?" in front of the break opportunity.
+ * @param close_sp_par_found The parts of "Close* Sp* ParaSep?" that were found:
+ *        1 for ParaSep, 2 for Sp and 4 for Close.
+ * @param end_in_lower True when the first character from @a next onward that is
+ *        OLetter, Upper, Lower, ParaSep or SATerm is Lower.
+ */
+[[nodiscard]] constexpr unicode_break_opportunity unicode_sentence_break_latin1_rules(
+    unicode_sentence_break_property prev_prev,
+    unicode_sentence_break_property prev,
+    unicode_sentence_break_property next,
+    unicode_sentence_break_property prefix,
+    int close_sp_par_found,
+    bool end_in_lower) noexcept
+{
+    using enum unicode_break_opportunity;
+    using enum unicode_sentence_break_property;
+
+    hilet is_ParaSep = [](unicode_sentence_break_property x) {
+        return x == Sep or x == CR or x == LF;
+    };
+    hilet is_SATerm = [](unicode_sentence_break_property x) {
+        return x == STerm or x == ATerm;
+    };
+
+    hilet optional_close = (close_sp_par_found & 3) == 0;
+    hilet optional_close_sp = (close_sp_par_found & 1) == 0;
+
+    if (prev == CR and next == LF) {
+        return no; // SB3
+    } else if (is_ParaSep(prev)) {
+        return yes; // SB4
+    } else if (prev == ATerm and next == Numeric) {
+        return no; // SB6
+    } else if ((prev_prev == Upper or prev_prev == Lower) and prev == ATerm and next == Upper) {
+        return no; // SB7
+    } else if (prefix == ATerm and optional_close_sp and end_in_lower) {
+        return no; // SB8
+    } else if (is_SATerm(prefix) and optional_close_sp and (next == SContinue or is_SATerm(next))) {
+        return no; // SB8a
+    } else if (is_SATerm(prefix) and optional_close and (next == Close or next == Sp or is_ParaSep(next))) {
+        return no; // SB9
+    } else if (is_SATerm(prefix) and optional_close_sp and (next == Sp or is_ParaSep(next))) {
+        return no; // SB10
+    } else if (is_SATerm(prefix)) {
+        return yes; // SB11
+    } else {
+        return no; // SB998
+    }
+}
+
+/** The sentence break algorithm for the leading Latin-1 characters of a text.
+ *
+ * The break opportunities are appended to @a r until the first character that
+ * is not handled. The state that the full algorithm finds by looking backward
+ * is tracked while walking forward. SB8 looks forward to the next letter, the
+ * opportunities after the last letter before an unhandled character are left
+ * to the full algorithm.
+ *
+ * The full algorithm then continues at a character that is not ATerm and not
+ * part of "Close* Sp* ParaSep?", so that the opportunities after that character
+ * do not depend on the characters before it.
+ *
+ * @param first An iterator to the first character.
+ * @param last An iterator to the last character.
+ * @param code_point_func A function to get a code-point from an dereferenced iterator.
+ * @param[out] r The break opportunities before each character, up to and including
+ *             the character returned.
+ * @return @a last when the whole text was handled, otherwise the character
+ *         from where the full algorithm needs to continue.
+ */
+template<typename It, typename ItEnd, typename CodePointFunc>
+[[nodiscard]] It
+unicode_sentence_break_latin1(It first, ItEnd last, CodePointFunc const& code_point_func, unicode_break_vector& r) noexcept
+{
+    using enum unicode_break_opportunity;
+    using enum unicode_sentence_break_property;
+
+    hi_axiom(r.empty());
+    r.push_back(yes); // SB1
+    if (first == last) {
+        return first;
+    }
+
+    hilet size = narrow_cast<size_t>(std::distance(first, last));
+    hilet properties =
+        unicode_break_latin1_classify(first, last, code_point_func, unicode_sentence_break_latin1_properties, Extend);
+
+    hilet is_ParaSep = [](unicode_sentence_break_property x) {
+        return x == Sep or x == CR or x == LF;
+    };
+
+    auto prev_prev = Other;
+    auto prev = Other;
+    auto prefix = Other;
+    auto close_sp_par_found = 0;
+    // The index of the first character at or after the break opportunity that decides SB8.
+    auto lower_i = 0_uz;
+    auto resume = 0_uz;
+    for (auto i = 0_uz; i != properties.size(); ++i) {
+        hilet next = properties[i];
+
+        if (i != 0) {
+            if (lower_i < i) {
+                for (lower_i = i; lower_i != properties.size(); ++lower_i) {
+                    hilet x = properties[lower_i];
+                    if (x == Lower or x == OLetter or x == Upper or is_ParaSep(x) or x == STerm or x == ATerm) {
+                        break;
+                    }
+                }
+            }
+            if (lower_i == properties.size() and properties.size() != size) {
+                // SB8 depends on characters that are not handled.
+                break;
+            }
+
+            hilet end_in_lower = lower_i != properties.size() and properties[lower_i] == Lower;
+            r.push_back(unicode_sentence_break_latin1_rules(prev_prev, prev, next, prefix, close_sp_par_found, end_in_lower));
+        }
+
+        if (next != ATerm and next != Close and next != Sp and not is_ParaSep(next)) {
+            resume = i;
+        }
+
+        // Track "prefix Close* Sp* ParaSep?" in front of the next break opportunity.
+        if (is_ParaSep(next)) {
+            if (close_sp_par_found & 1) {
+                prefix = prev;
+                close_sp_par_found = 0;
+            }
+            close_sp_par_found |= 1;
+        } else if (next == Sp) {
+            if (close_sp_par_found & 1) {
+                prefix = prev;
+                close_sp_par_found = 0;
+            }
+            close_sp_par_found |= 2;
+        } else if (next == Close) {
+            if (close_sp_par_found & 3) {
+                prefix = prev;
+                close_sp_par_found = 0;
+            }
+            close_sp_par_found |= 4;
+        } else {
+            prefix = next;
+            close_sp_par_found = 0;
+        }
+
+        prev_prev = prev;
+        prev = next;
+    }
+
+    if (properties.size() == size) {
+        r.push_back(yes); // SB2
+        return std::next(first, size);
+    }
+
+    r.resize(resume + 1);
+    return std::next(first, resume);
 }
 
-/** The unicode word break algorithm UAX#29
-*
-* @param first An iterator to the first character.
-* @param last An iterator to the last character.
-* @param code_point_func A function to get a code-point from an dereferenced iterator.
-* @return A list of unicode_break_opportunity before each character.
+/** The full unicode sentence break algorithm UAX#29
+ *
+ * @param first An iterator to the first character.
+ * @param last An iterator to the last character.
+ * @param code_point_func A function to get a code-point from an dereferenced iterator.
+ * @return A list of unicode_break_opportunity before each character.
  */
 template<typename It, typename ItEnd, typename CodePointFunc>
 [[nodiscard]] inline unicode_break_vector
-unicode_sentence_break(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept
+unicode_sentence_break_full(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept
 {
     auto size = narrow_cast<size_t>(std::distance(first, last));
     auto r = unicode_break_vector{size + 1, unicode_break_opportunity::unassigned};
 
-    auto infos = std::vector<detail::unicode_sentence_break_info>{};
+    auto infos = std::vector<unicode_sentence_break_info>{};
     infos.reserve(size);
     std::transform(first, last, std::back_inserter(infos), [&] (hilet &item) {
-        hilet code_point = code_point_func(item);
-        return detail::unicode_sentence_break_info{ucd_get_sentence_break_property(code_point)};
+        return unicode_sentence_break_info{ucd_get_properties(code_point_func(item)).sentence_break_property()};
         });
 
-    detail::unicode_sentence_break_SB1_SB4(r, infos);
-    detail::unicode_sentence_break_SB5(r, infos);
-    detail::unicode_sentence_break_SB6_SB998(r, infos);
+    unicode_sentence_break_SB1_SB4(r, infos);
+    unicode_sentence_break_SB5(r, infos);
+    unicode_sentence_break_SB6_SB998(r, infos);
+    return r;
+}
+
+}
+
+/** The unicode sentence break algorithm UAX#29
+ *
+ * The leading Latin-1 text is handled by a fast-path which gives identical results.
+ *
+ * @param first An iterator to the first character.
+ * @param last An iterator to the last character.
+ * @param code_point_func A function to get a code-point from an dereferenced iterator.
+ * @return A list of unicode_break_opportunity before each character.
+ */
+template<typename It, typename ItEnd, typename CodePointFunc>
+[[nodiscard]] inline unicode_break_vector
+unicode_sentence_break(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept
+{
+    auto r = unicode_break_vector{};
+    r.reserve(narrow_cast<size_t>(std::distance(first, last)) + 1);
+
+    hilet it = detail::unicode_sentence_break_latin1(first, last, code_point_func, r);
+    if (it != last) {
+        // The opportunity before the first character of the tail was determined by the fast-path.
+        hilet tail = detail::unicode_sentence_break_full(it, last, code_point_func);
+        r.insert(r.end(), tail.begin() + 1, tail.end());
+    }
     return r;
 }
 
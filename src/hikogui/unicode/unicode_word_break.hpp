@@ -8,13 +8,14 @@
 #pragma once
 
 #include "unicode_break_opportunity.hpp"
-#include "ucd_general_categories.hpp"
-#include "ucd_grapheme_cluster_breaks.hpp"
-#include "ucd_word_break_properties.hpp"
+#include "unicode_break_latin1.hpp"
+#include "ucd_properties.hpp"
 #include "../utility/utility.hpp"
 #include "../macros.hpp"
 #include <algorithm>
 #include <vector>
+#include <array>
+#include <iterator>
 
 
 
@@ -225,9 +226,156 @@ unicode_word_break_WB5_WB999(unicode_break_vector& r, std::vector<unicode_word_b
     }
 }
 
-} // namespace detail
+/** The word break properties of Latin-1 characters handled by the fast-path.
+ *
+ * Characters that are skipped by WB4 (Extend, Format, ZWJ) are not handled and
+ * are marked Extend.
+ */
+constexpr auto unicode_word_break_latin1_properties = [] {
+    using enum unicode_word_break_property;
 
-/** The unicode word break algorithm UAX#29
+    auto r = std::array<unicode_word_break_property, 256>{};
+    for (auto i = 0_uz; i != r.size(); ++i) {
+        hilet property = ucd_get_latin1_properties(char_cast<char32_t>(i)).word_break_property();
+        switch (property) {
+        case Other:
+        case CR:
+        case LF:
+        case Newline:
+        case ALetter:
+        case Numeric:
+        case ExtendNumLet:
+        case WSegSpace:
+        case MidLetter:
+        case MidNum:
+        case MidNumLet:
+        case Single_Quote:
+        case Double_Quote:
+            r[i] = property;
+            break;
+        default:
+            r[i] = Extend;
+        }
+    }
+    return r;
+}();
+
+/** The word break rules WB3 to WB999 for Latin-1 characters.
+ *
+ * Latin-1 characters handled by the fast-path are never skipped by WB4, so the
+ * characters around the break opportunity are the actual neighbours.
+ *
+ * @param prev_prev The character before @a prev, or Other.
+ * @param prev The character before the break opportunity.
+ * @param next The character after the break opportunity.
+ * @param next_next The character after @a next, or Other.
+ */
+[[nodiscard]] constexpr unicode_break_opportunity unicode_word_break_latin1_rules(
+    unicode_word_break_property prev_prev,
+    unicode_word_break_property prev,
+    unicode_word_break_property next,
+    unicode_word_break_property next_next) noexcept
+{
+    using enum unicode_break_opportunity;
+    using enum unicode_word_break_property;
+
+    // Hebrew_Letter is not part of Latin-1.
+    hilet is_AHLetter = [](unicode_word_break_property x) {
+        return x == ALetter;
+    };
+    hilet is_MidNumLetQ = [](unicode_word_break_property x) {
+        return x == MidNumLet or x == Single_Quote;
+    };
+
+    if (prev == CR and next == LF) {
+        return no; // WB3
+    } else if (prev == Newline or prev == CR or prev == LF) {
+        return yes; // WB3a
+    } else if (next == Newline or next == CR or next == LF) {
+        return yes; // WB3b
+    } else if (prev == WSegSpace and next == WSegSpace) {
+        return no; // WB3d
+    } else if (is_AHLetter(prev) and is_AHLetter(next)) {
+        return no; // WB5
+    } else if (is_AHLetter(prev) and (next == MidLetter or is_MidNumLetQ(next)) and is_AHLetter(next_next)) {
+        return no; // WB6
+    } else if (is_AHLetter(prev_prev) and (prev == MidLetter or is_MidNumLetQ(prev)) and is_AHLetter(next)) {
+        return no; // WB7
+    } else if (prev == Numeric and next == Numeric) {
+        return no; // WB8
+    } else if (is_AHLetter(prev) and next == Numeric) {
+        return no; // WB9
+    } else if (prev == Numeric and is_AHLetter(next)) {
+        return no; // WB10
+    } else if (prev_prev == Numeric and (prev == MidNum or is_MidNumLetQ(prev)) and next == Numeric) {
+        return no; // WB11
+    } else if (prev == Numeric and (next == MidNum or is_MidNumLetQ(next)) and next_next == Numeric) {
+        return no; // WB12
+    } else if ((is_AHLetter(prev) or prev == Numeric or prev == ExtendNumLet) and next == ExtendNumLet) {
+        return no; // WB13a
+    } else if (prev == ExtendNumLet and (is_AHLetter(next) or next == Numeric)) {
+        return no; // WB13b
+    } else {
+        return yes; // WB999
+    }
+}
+
+/** The word break algorithm for the leading Latin-1 characters of a text.
+ *
+ * The break opportunities are appended to @a r until the first character that
+ * is not handled. The full algorithm then continues at a character that is not
+ * part of the middle of WB6, WB7, WB11 and WB12, so that the opportunities
+ * after that character do not depend on the characters before it.
+ *
+ * @param first An iterator to the first character.
+ * @param last An iterator to the last character.
+ * @param code_point_func A function to code-point from a character.
+ * @param[out] r The break opportunities before each character, up to and including
+ *             the character returned.
+ * @return @a last when the whole text was handled, otherwise the character
+ *         from where the full algorithm needs to continue.
+ */
+template<typename It, typename ItEnd, typename CodePointFunc>
+[[nodiscard]] It
+unicode_word_break_latin1(It first, ItEnd last, CodePointFunc const& code_point_func, unicode_break_vector& r) noexcept
+{
+    using enum unicode_break_opportunity;
+    using enum unicode_word_break_property;
+
+    hi_axiom(r.empty());
+    r.push_back(yes); // WB1
+    if (first == last) {
+        return first;
+    }
+
+    hilet size = narrow_cast<size_t>(std::distance(first, last));
+    hilet properties =
+        unicode_break_latin1_classify(first, last, code_point_func, unicode_word_break_latin1_properties, Extend);
+
+    auto resume = 0_uz;
+    for (auto i = 1_uz; i < properties.size(); ++i) {
+        hilet prev_prev = i >= 2 ? properties[i - 2] : Other;
+        hilet next_next = i + 1 < properties.size() ? properties[i + 1] : Other;
+        r.push_back(unicode_word_break_latin1_rules(prev_prev, properties[i - 1], properties[i], next_next));
+
+        // Only the rules for the middle character of WB6, WB7, WB11 and WB12
+        // look past the characters around the break opportunity.
+        hilet next = properties[i];
+        if (next != MidLetter and next != MidNum and next != MidNumLet and next != Single_Quote and next != Double_Quote) {
+            resume = i;
+        }
+    }
+
+    if (properties.size() == size) {
+        r.push_back(yes); // WB2
+        return std::next(first, size);
+    }
+
+    r.resize(resume + 1);
+    return std::next(first, resume);
+}
+
+/** The full unicode word break algorithm UAX#29
  *
  * @param first An iterator to the first character.
  * @param last An iterator to the last character.
@@ -235,24 +383,49 @@ unicode_word_break_WB5_WB999(unicode_break_vector& r, std::vector<unicode_word_b
  * @return A list of unicode_break_opportunity.
  */
 template<typename It, typename ItEnd, typename CodePointFunc>
-[[nodiscard]] inline unicode_break_vector unicode_word_break(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept
+[[nodiscard]] inline unicode_break_vector unicode_word_break_full(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept
 {
     auto size = narrow_cast<size_t>(std::distance(first, last));
     auto r = unicode_break_vector{size + 1, unicode_break_opportunity::unassigned};
 
-    auto infos = std::vector<detail::unicode_word_break_info>{};
+    auto infos = std::vector<unicode_word_break_info>{};
     infos.reserve(size);
     std::transform(first, last, std::back_inserter(infos), [&](hilet& item) {
-        hilet code_point = code_point_func(item);
-        hilet word_break_property = ucd_get_word_break_property(code_point);
-        hilet grapheme_cluster_break = ucd_get_grapheme_cluster_break(code_point);
-        return detail::unicode_word_break_info{
-            word_break_property, grapheme_cluster_break == unicode_grapheme_cluster_break::Extended_Pictographic};
+        hilet properties = ucd_get_properties(code_point_func(item));
+        return unicode_word_break_info{
+            properties.word_break_property(),
+            properties.grapheme_cluster_break() == unicode_grapheme_cluster_break::Extended_Pictographic};
     });
 
-    detail::unicode_word_break_WB1_WB3d(r, infos);
-    detail::unicode_word_break_WB4(r, infos);
-    detail::unicode_word_break_WB5_WB999(r, infos);
+    unicode_word_break_WB1_WB3d(r, infos);
+    unicode_word_break_WB4(r, infos);
+    unicode_word_break_WB5_WB999(r, infos);
+    return r;
+}
+
+} // namespace detail
+
+/** The unicode word break algorithm UAX#29
+ *
+ * The leading Latin-1 text is handled by a fast-path which gives identical results.
+ *
+ * @param first An iterator to the first character.
+ * @param last An iterator to the last character.
+ * @param code_point_func A function to code-point from a character.
+ * @return A list of unicode_break_opportunity.
+ */
+template<typename It, typename ItEnd, typename CodePointFunc>
+[[nodiscard]] inline unicode_break_vector unicode_word_break(It first, ItEnd last, CodePointFunc const& code_point_func) noexcept
+{
+    auto r = unicode_break_vector{};
+    r.reserve(narrow_cast<size_t>(std::distance(first, last)) + 1);
+
+    hilet it = detail::unicode_word_break_latin1(first, last, code_point_func, r);
+    if (it != last) {
+        // The opportunity before the first character of the tail was determined by the fast-path.
+        hilet tail = detail::unicode_word_break_full(it, last, code_point_func);
+        r.insert(r.end(), tail.begin() + 1, tail.end());
+    }
     return r;
 }
 
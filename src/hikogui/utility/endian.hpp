@@ -256,7 +256,7 @@ template<unsigned int NumBits, byte_like B>
 }
 
 template<std::endian Endian = std::endian::native, std::integral T, byte_like B>
-constexpr void store(T value, B const *dst) noexcept
+constexpr void store(T value, B *dst) noexcept
 {
     if constexpr (Endian != std::endian::native) {
         value = std::byteswap(value);
@@ -265,7 +265,7 @@ constexpr void store(T value, B const *dst) noexcept
 }
 
 template<std::endian Endian = std::endian::native, std::integral T>
-constexpr void store(T value, void const *dst) noexcept
+constexpr void store(T value, void *dst) noexcept
 {
     if constexpr (Endian != std::endian::native) {
         value = std::byteswap(value);
@@ -274,25 +274,25 @@ constexpr void store(T value, void const *dst) noexcept
 }
 
 template<std::integral T, byte_like B>
-constexpr void store_le(T value, B const *dst) noexcept
+constexpr void store_le(T value, B *dst) noexcept
 {
     store<std::endian::little>(value, dst);
 }
 
 template<std::integral T>
-inline void store_le(T value, void const *dst) noexcept
+inline void store_le(T value, void *dst) noexcept
 {
     store<std::endian::little>(value, dst);
 }
 
 template<std::integral T, byte_like B>
-constexpr void store_be(T value, B const *dst) noexcept
+constexpr void store_be(T value, B *dst) noexcept
 {
     store<std::endian::big>(value, dst);
 }
 
 template<std::integral T>
-inline void store_be(T value, void const *dst) noexcept
+inline void store_be(T value, void *dst) noexcept
 {
     store<std::endian::big>(value, dst);
 }
@@ -0,0 +1,55 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#pragma once
+
+#include "../macros.hpp"
+#include <type_traits>
+#include <functional>
+#include <memory>
+
+hi_export_module(hikogui.utility.function_ref);
+
+namespace hi { inline namespace v1 {
+
+template<typename Signature>
+class function_ref;
+
+/** A non-owning reference to a callable object.
+ *
+ * Unlike `std::function` this does not allocate and does not copy the callable
+ * object. It is used for passing a callback into a function, where the callable
+ * object outlives the call; for example a lambda passed as an argument.
+ *
+ * This is similar to the proposed `std::function_ref`.
+ */
+hi_export template<typename R, typename... Args>
+class function_ref<R(Args...)> {
+public:
+    function_ref() = delete;
+    constexpr function_ref(function_ref const&) noexcept = default;
+    constexpr function_ref& operator=(function_ref const&) noexcept = default;
+
+    template<typename Func>
+    constexpr function_ref(Func&& func) noexcept
+        requires(not std::is_same_v<std::remove_cvref_t<Func>, function_ref> and std::is_invocable_r_v<R, Func&, Args...>)
+        :
+        _object(const_cast<void *>(static_cast<void const *>(std::addressof(func)))),
+        _invoke([](void *object, Args... args) -> R {
+            return std::invoke(*static_cast<std::remove_reference_t<Func> *>(object), std::forward<Args>(args)...);
+        })
+    {
+    }
+
+    R operator()(Args... args) const
+    {
+        return _invoke(_object, std::forward<Args>(args)...);
+    }
+
+private:
+    void *_object;
+    R (*_invoke)(void *, Args...);
+};
+
+}} // namespace hi::v1
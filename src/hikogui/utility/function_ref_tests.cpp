@@ -0,0 +1,70 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "function_ref.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <vector>
+
+namespace {
+
+[[nodiscard]] int call_twice(hi::function_ref<int(int)> func)
+{
+    return func(func(1));
+}
+
+} // namespace
+
+TEST(function_ref, lambda)
+{
+    auto count = 0;
+    auto func = [&](int x) {
+        ++count;
+        return x + 2;
+    };
+
+    ASSERT_EQ(call_twice(func), 5);
+    ASSERT_EQ(count, 2);
+
+    // Temporaries live until the end of the full-expression.
+    ASSERT_EQ(call_twice([](int x) {
+                  return x * 3;
+              }),
+              9);
+}
+
+TEST(function_ref, reference_argument)
+{
+    auto values = std::vector<int>{1, 2, 3};
+    auto increment = [](int& x) {
+        ++x;
+    };
+
+    auto ref = hi::function_ref<void(int&)>{increment};
+    for (auto& value : values) {
+        ref(value);
+    }
+
+    ASSERT_EQ(values, (std::vector<int>{2, 3, 4}));
+}
+
+TEST(function_ref, mutable_state)
+{
+    struct counter {
+        int count = 0;
+
+        void operator()() noexcept
+        {
+            ++count;
+        }
+    };
+
+    auto c = counter{};
+    auto ref = hi::function_ref<void()>{c};
+    ref();
+    ref();
+
+    // The function_ref refers to the original object, not a copy.
+    ASSERT_EQ(c.count, 2);
+}
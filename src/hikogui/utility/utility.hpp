@@ -23,6 +23,7 @@
 #include "fixed_string.hpp" // export
 #include "float16.hpp" // export
 #include "forward_value.hpp" // export
+#include "function_ref.hpp" // export
 #include "hash.hpp" // export
 #include "math.hpp" // export
 #include "memory.hpp" // export
@@ -96,9 +96,9 @@ public:
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
-        _on_label_constraints = _on_label_widget->update_constraints();
-        _off_label_constraints = _off_label_widget->update_constraints();
-        _other_label_constraints = _other_label_widget->update_constraints();
+        _on_label_constraints = _on_label_widget->reconstrain();
+        _off_label_constraints = _off_label_widget->reconstrain();
+        _other_label_constraints = _other_label_widget->reconstrain();
         return max(_on_label_constraints, _off_label_constraints, _other_label_constraints);
     }
 
@@ -109,9 +109,9 @@ public:
         _off_label_widget->mode = state_ == button_state::off ? widget_mode::display : widget_mode::invisible;
         _other_label_widget->mode = state_ == button_state::other ? widget_mode::display : widget_mode::invisible;
 
-        _on_label_widget->set_layout(context.transform(_on_label_shape));
-        _off_label_widget->set_layout(context.transform(_off_label_shape));
-        _other_label_widget->set_layout(context.transform(_other_label_shape));
+        _on_label_widget->relayout(context.transform(_on_label_shape));
+        _off_label_widget->relayout(context.transform(_off_label_shape));
+        _other_label_widget->relayout(context.transform(_other_label_shape));
     }
 
     [[nodiscard]] generator<widget_intf&> children(bool include_invisible) noexcept override
@@ -121,6 +121,13 @@ public:
         co_yield *_other_label_widget;
     }
 
+    void for_each_child(bool include_invisible, function_ref<void(widget_intf&)> func) noexcept override
+    {
+        func(*_on_label_widget);
+        func(*_off_label_widget);
+        func(*_other_label_widget);
+    }
+
     [[nodiscard]] color background_color() const noexcept override
     {
         hi_axiom(loop::main().on_thread());
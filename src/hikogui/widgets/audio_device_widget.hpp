@@ -52,10 +52,15 @@ public:
         co_yield *_grid_widget;
     }
 
+    void for_each_child(bool include_invisible, function_ref<void(widget_intf&)> func) noexcept override
+    {
+        func(*_grid_widget);
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
-        _grid_constraints = _grid_widget->update_constraints();
+        _grid_constraints = _grid_widget->reconstrain();
         return _grid_constraints;
     }
 
@@ -66,7 +71,7 @@ public:
             _grid_shape = {_grid_constraints, grid_rectangle, theme().baseline_adjustment()};
         }
 
-        _grid_widget->set_layout(context.transform(_grid_shape));
+        _grid_widget->relayout(context.transform(_grid_shape));
     }
 
     void draw(draw_context const& context) noexcept override
@@ -113,12 +113,19 @@ public:
         }
     }
 
+    void for_each_child(bool include_invisible, function_ref<void(widget_intf&)> func) noexcept override
+    {
+        for (hilet& cell : _grid) {
+            func(*cell.value);
+        }
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
 
         for (auto& cell : _grid) {
-            cell.set_constraints(cell.value->update_constraints());
+            cell.set_constraints(cell.value->reconstrain());
         }
 
         return _grid.constraints(os_settings::left_to_right());
@@ -130,7 +137,7 @@ public:
         }
 
         for (hilet& cell : _grid) {
-            cell.value->set_layout(context.transform(cell.shape, 0.0f));
+            cell.value->relayout(context.transform(cell.shape, 0.0f));
         }
     }
     void draw(draw_context const& context) noexcept override
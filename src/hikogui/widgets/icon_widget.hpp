@@ -136,27 +136,29 @@ public:
     }
     void draw(draw_context const& context) noexcept override
     {
-        if (*mode > widget_mode::invisible and overlaps(context, layout())) {
-            switch (_icon_type) {
-            case icon_type::no:
-                break;
-
-            case icon_type::pixmap:
-                if (not context.draw_image(layout(), _icon_rectangle, _pixmap_backing)) {
-                    // Continue redrawing until the image is loaded.
-                    request_redraw();
+        if (*mode > widget_mode::invisible) {
+            draw_retained(context, [&](draw_context const& context_) {
+                switch (_icon_type) {
+                case icon_type::no:
+                    break;
+
+                case icon_type::pixmap:
+                    if (not context_.draw_image(layout(), _icon_rectangle, _pixmap_backing)) {
+                        // Continue redrawing until the image is loaded.
+                        request_redraw();
+                    }
+                    break;
+
+                case icon_type::glyph:
+                    {
+                        context_.draw_glyph(layout(), _icon_rectangle, _glyph, theme().color(*color));
+                    }
+                    break;
+
+                default:
+                    hi_no_default();
                 }
-                break;
-
-            case icon_type::glyph:
-                {
-                    context.draw_glyph(layout(), _icon_rectangle, _glyph, theme().color(*color));
-                }
-                break;
-
-            default:
-                hi_no_default();
-            }
+            });
         }
     }
     /// @endprivatesection
@@ -167,6 +169,7 @@ private:
     glyph_ids _glyph;
     paged_image _pixmap_backing;
     decltype(icon)::callback_token _icon_cbt;
+    decltype(color)::callback_token _color_cbt;
     std::atomic<bool> _icon_has_modified = true;
 
     extent2 _icon_size;
@@ -179,6 +182,11 @@ private:
             ++global_counter<"icon_widget:icon:constrain">;
             process_event({gui_event_type::window_reconstrain});
         });
+
+        _color_cbt = color.subscribe([this](auto...) {
+            ++global_counter<"icon_widget:color:redraw">;
+            request_redraw();
+        });
     }
 };
 
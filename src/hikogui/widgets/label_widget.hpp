@@ -90,6 +90,12 @@ public:
         co_yield *_text_widget;
     }
 
+    void for_each_child(bool include_invisible, function_ref<void(widget_intf&)> func) noexcept override
+    {
+        func(*_icon_widget);
+        func(*_text_widget);
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
@@ -138,7 +144,7 @@ public:
         _icon_widget->maximum = extent2{icon_size, icon_size};
 
         for (auto& cell : _grid) {
-            cell.set_constraints(cell.value->update_constraints());
+            cell.set_constraints(cell.value->reconstrain());
         }
 
         return _grid.constraints(os_settings::left_to_right());
@@ -150,7 +156,7 @@ public:
         }
 
         for (hilet& cell : _grid) {
-            cell.value->set_layout(context.transform(cell.shape, 0.0f));
+            cell.value->relayout(context.transform(cell.shape, 0.0f));
         }
     }
     void draw(draw_context const& context) noexcept override
@@ -30,6 +30,8 @@
 #include "toolbar_button_widget.hpp"
 #include "toolbar_tab_button_widget.hpp"
 #include "toolbar_widget.hpp"
+#include "virtual_grid_delegate.hpp"
+#include "virtual_grid_widget.hpp"
 #include "widget_mode.hpp"
 #include "widget.hpp"
 #include "window_controls_macos_widget.hpp"
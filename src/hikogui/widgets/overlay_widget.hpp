@@ -90,10 +90,15 @@ public:
         co_yield *_content;
     }
 
+    void for_each_child(bool include_invisible, function_ref<void(widget_intf&)> func) noexcept override
+    {
+        func(*_content);
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
-        _content_constraints = _content->update_constraints();
+        _content_constraints = _content->reconstrain();
         return _content_constraints;
     }
     void set_layout(widget_layout const& context) noexcept override
@@ -107,7 +112,7 @@ public:
         _content_shape = box_shape{_content_constraints, content_rectangle, theme().baseline_adjustment()};
 
         // The content should not draw in the border of the overlay, so give a tight clipping rectangle.
-        _content->set_layout(_layout.transform(_content_shape, 1.0f, context.rectangle()));
+        _content->relayout(_layout.transform(_content_shape, 1.0f, context.rectangle()));
     }
     void draw(draw_context const& context) noexcept override
     {
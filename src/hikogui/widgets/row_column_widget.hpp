@@ -102,12 +102,19 @@ public:
         }
     }
 
+    void for_each_child(bool include_invisible, function_ref<void(widget_intf&)> func) noexcept override
+    {
+        for (hilet& child : _children) {
+            func(*child.value);
+        }
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
 
         for (auto& child : _children) {
-            child.set_constraints(child.value->update_constraints());
+            child.set_constraints(child.value->reconstrain());
         }
 
         return _children.constraints(os_settings::left_to_right());
@@ -119,7 +126,7 @@ public:
             _children.set_layout(context.shape, theme().baseline_adjustment());
 
             for (hilet& child : _children) {
-                child.value->set_layout(context.transform(child.shape, 0.0f));
+                child.value->relayout(context.transform(child.shape, 0.0f));
             }
         }
     }
@@ -97,10 +97,15 @@ public:
         co_yield *_content;
     }
 
+    void for_each_child(bool include_invisible, function_ref<void(widget_intf&)> func) noexcept override
+    {
+        func(*_content);
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
-        _content_constraints = _content->update_constraints();
+        _content_constraints = _content->reconstrain();
 
         // The aperture can scroll so its minimum width and height are zero.
         auto aperture_constraints = _content_constraints;
@@ -143,7 +148,7 @@ public:
 
         // The content needs to be at a higher elevation, so that hitbox check
         // will work correctly for handling scrolling with mouse wheel.
-        _content->set_layout(context.transform(_content_shape, 1.0f, context.rectangle()));
+        _content->relayout(context.transform(_content_shape, 1.0f, context.rectangle()));
     }
 
     void draw(draw_context const& context) noexcept override
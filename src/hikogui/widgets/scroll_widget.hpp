@@ -116,12 +116,19 @@ public:
         co_yield *_horizontal_scroll_bar;
     }
 
+    void for_each_child(bool include_invisible, function_ref<void(widget_intf&)> func) noexcept override
+    {
+        func(*_aperture);
+        func(*_vertical_scroll_bar);
+        func(*_horizontal_scroll_bar);
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
 
         for (auto& cell : _grid) {
-            cell.set_constraints(cell.value->update_constraints());
+            cell.set_constraints(cell.value->reconstrain());
         }
         auto grid_constraints = _grid.constraints(os_settings::left_to_right());
         return grid_constraints.constrain(*minimum, *maximum);
@@ -148,7 +155,7 @@ public:
                 }
             }
 
-            cell.value->set_layout(context.transform(shape, 0.0f));
+            cell.value->relayout(context.transform(shape, 0.0f));
         }
     }
 
@@ -209,6 +209,13 @@ public:
         co_yield *_off_label_widget;
     }
 
+    void for_each_child(bool include_invisible, function_ref<void(widget_intf&)> func) noexcept override
+    {
+        func(*_overlay_widget);
+        func(*_current_label_widget);
+        func(*_off_label_widget);
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         hi_assert_not_null(_off_label_widget);
@@ -220,9 +227,9 @@ public:
         }
 
         _layout = {};
-        _off_label_constraints = _off_label_widget->update_constraints();
-        _current_label_constraints = _current_label_widget->update_constraints();
-        _overlay_constraints = _overlay_widget->update_constraints();
+        _off_label_constraints = _off_label_widget->reconstrain();
+        _current_label_constraints = _current_label_widget->reconstrain();
+        _overlay_constraints = _overlay_widget->reconstrain();
 
         hilet extra_size = extent2{theme().size() + theme().margin<float>() * 2.0f, theme().margin<float>() * 2.0f};
 
@@ -286,10 +293,10 @@ public:
         hilet overlay_rectangle_request = aarectangle{overlay_x, overlay_y, overlay_width, overlay_height};
         hilet overlay_rectangle = make_overlay_rectangle(overlay_rectangle_request);
         _overlay_shape = box_shape{_overlay_constraints, overlay_rectangle, theme().baseline_adjustment()};
-        _overlay_widget->set_layout(context.transform(_overlay_shape, 20.0f));
+        _overlay_widget->relayout(context.transform(_overlay_shape, 20.0f));
 
-        _off_label_widget->set_layout(context.transform(_off_label_shape));
-        _current_label_widget->set_layout(context.transform(_current_label_shape));
+        _off_label_widget->relayout(context.transform(_off_label_shape));
+        _current_label_widget->relayout(context.transform(_current_label_shape));
     }
 
     void draw(draw_context const& context) noexcept override
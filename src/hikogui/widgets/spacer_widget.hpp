@@ -28,6 +28,8 @@ public:
         co_return;
     }
 
+    void for_each_child(bool include_invisible, function_ref<void(widget_intf&)> func) noexcept override {}
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
@@ -113,6 +113,13 @@ public:
         }
     }
 
+    void for_each_child(bool include_invisible, function_ref<void(widget_intf&)> func) noexcept override
+    {
+        for (hilet& child : _children) {
+            func(*child);
+        }
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
@@ -129,7 +136,7 @@ public:
             child->mode = child.get() == &selected_child_ ? widget_mode::enabled : widget_mode::invisible;
         }
 
-        return selected_child_.update_constraints();
+        return selected_child_.reconstrain();
     }
     void set_layout(widget_layout const& context) noexcept override
     {
@@ -137,7 +144,7 @@ public:
 
         for (hilet& child : _children) {
             if (*child->mode > widget_mode::invisible) {
-                child->set_layout(context);
+                child->relayout(context);
             }
         }
     }
@@ -150,6 +150,11 @@ public:
         co_yield *_scroll_widget;
     }
 
+    void for_each_child(bool include_invisible, function_ref<void(widget_intf&)> func) noexcept override
+    {
+        func(*_scroll_widget);
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         hi_assert_not_null(delegate);
@@ -166,7 +171,7 @@ public:
         }
 
         _layout = {};
-        _scroll_constraints = _scroll_widget->update_constraints();
+        _scroll_constraints = _scroll_widget->reconstrain();
 
         hilet scroll_width = 100;
         hilet box_size = extent2{
@@ -177,11 +182,11 @@ public:
         auto margins = theme().margin();
         if (_error_label->empty()) {
             _error_label_widget->mode = widget_mode::invisible;
-            _error_label_constraints = _error_label_widget->update_constraints();
+            _error_label_constraints = _error_label_widget->reconstrain();
 
         } else {
             _error_label_widget->mode = widget_mode::display;
-            _error_label_constraints = _error_label_widget->update_constraints();
+            _error_label_constraints = _error_label_widget->reconstrain();
             inplace_max(size.width(), _error_label_constraints.preferred.width());
             size.height() += _error_label_constraints.margins.top() + _error_label_constraints.preferred.height();
             inplace_max(margins.left(), _error_label_constraints.margins.left());
@@ -213,9 +218,9 @@ public:
         }
 
         if (*_error_label_widget->mode > widget_mode::invisible) {
-            _error_label_widget->set_layout(context.transform(_error_label_shape));
+            _error_label_widget->relayout(context.transform(_error_label_shape));
         }
-        _scroll_widget->set_layout(context.transform(_scroll_shape));
+        _scroll_widget->relayout(context.transform(_scroll_shape));
     }
     void draw(draw_context const& context) noexcept override
     {
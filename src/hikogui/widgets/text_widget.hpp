@@ -171,11 +171,11 @@ public:
 
         hilet actual_text_style = theme().text_style(*text_style);
 
-        // Create a new text_shaper with the new text.
+        // Update the text_shaper with the new text, only the modified paragraphs are shaped again.
         auto alignment_ = os_settings::left_to_right() ? *alignment : mirror(*alignment);
 
-        _shaped_text = text_shaper{
-            font_book::global(), _text_cache, actual_text_style, theme().scale, alignment_, os_settings::left_to_right()};
+        _shaped_text.update(
+            font_book::global(), _text_cache, actual_text_style, theme().scale, alignment_, os_settings::left_to_right());
 
         hilet shaped_text_rectangle = ceil(_shaped_text.bounding_rectangle(std::numeric_limits<float>::infinity()));
         hilet shaped_text_size = shaped_text_rectangle.size();
@@ -238,21 +238,24 @@ public:
             request_redraw();
         }
 
-        if (*mode > widget_mode::invisible and overlaps(context, layout())) {
-            context.draw_text(layout(), _shaped_text);
-
-            context.draw_text_selection(layout(), _shaped_text, _selection, theme().color(semantic_color::text_select));
-
-            if (*_cursor_state == cursor_state_type::on or *_cursor_state == cursor_state_type::busy) {
-                context.draw_text_cursors(
-                    layout(),
-                    _shaped_text,
-                    _selection.cursor(),
-                    _overwrite_mode,
-                    to_bool(_has_dead_character),
-                    theme().color(semantic_color::primary_cursor),
-                    theme().color(semantic_color::secondary_cursor));
-            }
+        if (*mode > widget_mode::invisible) {
+            draw_retained(context, [&](draw_context const& context_) {
+                context_.draw_text(layout(), _shaped_text);
+
+                context_.draw_text_selection(
+                    layout(), _shaped_text, _selection, theme().color(semantic_color::text_select));
+
+                if (*_cursor_state == cursor_state_type::on or *_cursor_state == cursor_state_type::busy) {
+                    context_.draw_text_cursors(
+                        layout(),
+                        _shaped_text,
+                        _selection.cursor(),
+                        _overwrite_mode,
+                        to_bool(_has_dead_character),
+                        theme().color(semantic_color::primary_cursor),
+                        theme().color(semantic_color::secondary_cursor));
+                }
+            });
         }
     }
 
@@ -80,12 +80,19 @@ public:
         }
     }
 
+    void for_each_child(bool include_invisible, function_ref<void(widget_intf&)> func) noexcept override
+    {
+        for (hilet& child : _children) {
+            func(*child.value);
+        }
+    }
+
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         _layout = {};
 
         for (auto& child : _children) {
-            child.set_constraints(child.value->update_constraints());
+            child.set_constraints(child.value->reconstrain());
         }
 
         auto r = _children.constraints(os_settings::left_to_right());
@@ -114,7 +121,7 @@ public:
             hilet child_clipping_rectangle =
                 aarectangle{child.shape.x() - overhang, 0, child.shape.width() + overhang * 2, context.height() + overhang * 2};
 
-            child.value->set_layout(context.transform(child.shape, 1.0f, child_clipping_rectangle));
+            child.value->relayout(context.transform(child.shape, 1.0f, child_clipping_rectangle));
         }
     }
     void draw(draw_context const& context) noexcept override
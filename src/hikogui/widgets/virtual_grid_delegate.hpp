@@ -0,0 +1,91 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file widgets/virtual_grid_delegate.hpp Defines virtual_grid_delegate.
+ * @ingroup widget_delegates
+ */
+
+#pragma once
+
+#include "widget.hpp"
+#include "../observer/module.hpp"
+#include "../macros.hpp"
+#include <memory>
+#include <cstddef>
+
+namespace hi { inline namespace v1 {
+class virtual_grid_widget;
+
+/** A delegate that supplies the rows of a virtual_grid_widget.
+ *
+ * The delegate creates the widgets for the cells, and binds a row of data
+ * to a widget when the row becomes visible. Widgets are recycled for other
+ * rows of the same column when a row is scrolled out of view.
+ *
+ * @ingroup widget_delegates
+ */
+class virtual_grid_delegate {
+public:
+    using notifier_type = notifier<>;
+    using callback_token = notifier_type::callback_token;
+    using callback_proto = notifier_type::callback_proto;
+
+    virtual ~virtual_grid_delegate() = default;
+
+    virtual void init(virtual_grid_widget& sender) noexcept {}
+    virtual void deinit(virtual_grid_widget& sender) noexcept {}
+
+    /** The number of rows.
+     */
+    [[nodiscard]] virtual std::size_t num_rows(virtual_grid_widget& sender) noexcept = 0;
+
+    /** The number of columns.
+     *
+     * A list is a grid with a single column.
+     */
+    [[nodiscard]] virtual std::size_t num_columns(virtual_grid_widget& sender) noexcept
+    {
+        return 1;
+    }
+
+    /** The estimated height of a row.
+     *
+     * The height of a row is estimated until it has been visible, this is used
+     * to calculate the size of the scroll-bar.
+     */
+    [[nodiscard]] virtual float estimated_row_height(virtual_grid_widget& sender) noexcept = 0;
+
+    /** Create a widget for the cells of a column.
+     *
+     * @param sender The grid widget, which must be used as the parent of the new widget.
+     * @param column The column of the cells.
+     * @return A new widget.
+     */
+    [[nodiscard]] virtual std::unique_ptr<widget> make_widget(virtual_grid_widget& sender, std::size_t column) noexcept = 0;
+
+    /** Show the data of a cell in a widget.
+     *
+     * @param sender The grid widget.
+     * @param cell A widget that was created by `make_widget()` for the same column.
+     * @param row The row of the cell.
+     * @param column The column of the cell.
+     */
+    virtual void bind(virtual_grid_widget& sender, widget& cell, std::size_t row, std::size_t column) noexcept = 0;
+
+    /** Subscribe a callback for notifying the widget of a data change.
+     *
+     * On a notification all the visible rows are bound again. The
+     * measured row heights are kept, unless the estimated row height changed.
+     */
+    [[nodiscard]] callback_token
+    subscribe(forward_of<callback_proto> auto&& callback, callback_flags flags = callback_flags::synchronous) noexcept
+    {
+        return _notifier.subscribe(hi_forward(callback), flags);
+    }
+
+protected:
+    notifier_type _notifier;
+};
+
+}} // namespace hi::v1
@@ -0,0 +1,396 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+/** @file widgets/virtual_grid_widget.hpp Defines virtual_grid_widget.
+ * @ingroup widgets
+ */
+
+#pragma once
+
+#include "widget.hpp"
+#include "virtual_grid_delegate.hpp"
+#include "../layout/module.hpp"
+#include "../macros.hpp"
+#include <memory>
+#include <vector>
+#include <algorithm>
+#include <utility>
+
+namespace hi { inline namespace v1 {
+
+/** A widget that shows a list or table with a very large number of rows.
+ * @ingroup widgets
+ *
+ * Unlike the `grid_widget`, which owns a widget for each cell, the virtual grid
+ * widget only owns widgets for the rows that are visible. It is designed to be
+ * the content of a `scroll_widget`, where the visible rows are the rows that
+ * overlap with the clipping rectangle of the aperture.
+ *
+ * The data is supplied by a `virtual_grid_delegate`. The delegate creates the
+ * widgets for the cells and binds the data of a row to them. When a row scrolls
+ * out of view its widgets are recycled for the rows that scroll into view.
+ *
+ * The height of a row is estimated by the delegate, until it becomes visible and
+ * its widgets are measured. The total height used by the scroll-bar is the sum
+ * of the measured and estimated heights, calculated in O(log n) by
+ * `estimated_extents`. The width of each column is the largest preferred width
+ * of the cells that were measured in that column. The measurements are kept
+ * when the delegate notifies a change of its data, so that the rows do not
+ * move when they are bound again.
+ *
+ * Rows are laid out from top to bottom, and columns from left to right.
+ */
+class virtual_grid_widget : public widget {
+public:
+    using super = widget;
+    using delegate_type = virtual_grid_delegate;
+
+    std::shared_ptr<delegate_type> delegate;
+
+    ~virtual_grid_widget()
+    {
+        hi_assert_not_null(delegate);
+        delegate->deinit(*this);
+    }
+
+    /** Constructs a virtual grid widget.
+     *
+     * @param parent The parent widget.
+     * @param delegate The delegate that supplies the rows.
+     */
+    virtual_grid_widget(widget *parent, std::shared_ptr<delegate_type> delegate) noexcept :
+        super(parent), delegate(std::move(delegate))
+    {
+        hi_axiom(loop::main().on_thread());
+        hi_assert_not_null(this->delegate);
+
+        if (parent) {
+            semantic_layer = parent->semantic_layer;
+        }
+
+        _delegate_cbt = this->delegate->subscribe([&] {
+            _reset = true;
+            ++global_counter<"virtual_grid_widget:delegate:constrain">;
+            process_event({gui_event_type::window_reconstrain});
+        });
+
+        this->delegate->init(*this);
+    }
+
+    /** The number of widgets that are bound to visible cells.
+     */
+    [[nodiscard]] std::size_t num_visible_cells() const noexcept
+    {
+        return _cells.size();
+    }
+
+    /** The number of widgets that were created by the delegate.
+     */
+    [[nodiscard]] std::size_t num_cell_widgets() const noexcept
+    {
+        auto r = _cells.size();
+        for (hilet& free_widgets : _free_widgets) {
+            r += free_widgets.size();
+        }
+        return r;
+    }
+
+    /// @privatesection
+    [[nodiscard]] generator<widget_intf&> children(bool include_invisible) noexcept override
+    {
+        for (hilet& cell : _cells) {
+            co_yield *cell.value;
+        }
+    }
+
+    void for_each_child(bool include_invisible, function_ref<void(widget_intf&)> func) noexcept override
+    {
+        for (hilet& cell : _cells) {
+            func(*cell.value);
+        }
+    }
+
+    [[nodiscard]] box_constraints update_constraints() noexcept override
+    {
+        _layout = {};
+
+        if (_reset) {
+            reset();
+        }
+
+        // The grid may be constrained before it is added to a window.
+        if (hilet w = window()) {
+            _baseline_adjustment = w->theme.baseline_adjustment();
+        }
+
+        for (auto& cell : _cells) {
+            cell.constraints = cell.value->reconstrain();
+        }
+
+        auto width = 0.0f;
+        for (hilet column_width : _column_widths) {
+            width += column_width;
+        }
+
+        hilet size = extent2{width, _row_heights.total()};
+        hilet r = box_constraints{size, size, extent2{large_number_v<float>, size.height()}}.constrain(*minimum, *maximum);
+        _constrained_height = r.preferred.height();
+        return r;
+    }
+
+    void set_layout(widget_layout const& context) noexcept override
+    {
+        _layout = context;
+
+        // Measuring the visible rows moves the rows below them, which may make
+        // other rows visible. Repeat until the visible rows are stable.
+        auto extents_changed = false;
+        for (auto i = 0; i != max_measure_passes; ++i) {
+            hilet [first_row, last_row] = visible_rows(context);
+            if (not update_cells(first_row, last_row)) {
+                break;
+            }
+            extents_changed = true;
+        }
+
+        auto column_offsets = std::vector<float>{};
+        column_offsets.reserve(_num_columns + 1);
+        column_offsets.push_back(0.0f);
+        for (auto column = 0_uz; column != _num_columns; ++column) {
+            // The last column fills the remaining width of the widget.
+            hilet width = column + 1 == _num_columns ?
+                std::max(_column_widths[column], context.width() - column_offsets.back()) :
+                _column_widths[column];
+            column_offsets.push_back(column_offsets.back() + width);
+        }
+
+        hilet rows_height = layout_height(context);
+        for (hilet& cell : _cells) {
+            hilet top = rows_height - _row_heights.offset(cell.row);
+            hilet height = _row_heights[cell.row];
+            hilet left = column_offsets[cell.column];
+            hilet width = column_offsets[cell.column + 1] - left;
+
+            hilet shape = box_shape{override_t{}, cell.constraints, aarectangle{left, top - height, width, height}, _baseline_adjustment};
+            cell.value->relayout(context.transform(shape, 0.0f));
+        }
+
+        if (extents_changed) {
+            // The measured rows have a different size than estimated, update the scroll-bars.
+            ++global_counter<"virtual_grid_widget:measure:constrain">;
+            process_event({gui_event_type::window_reconstrain});
+        }
+    }
+
+    void draw(draw_context const& context) noexcept override
+    {
+        if (*mode > widget_mode::invisible) {
+            for (hilet& cell : _cells) {
+                cell.value->draw(context);
+            }
+        }
+    }
+
+    [[nodiscard]] hitbox hitbox_test(point2 position) const noexcept override
+    {
+        hi_axiom(loop::main().on_thread());
+
+        if (*mode >= widget_mode::partial) {
+            auto r = hitbox{};
+            for (hilet& cell : _cells) {
+                r = cell.value->hitbox_test_from_parent(position, r);
+            }
+            return r;
+        } else {
+            return {};
+        }
+    }
+    /// @endprivatesection
+private:
+    struct cell_type {
+        std::size_t row;
+        std::size_t column;
+        std::unique_ptr<widget> value;
+        box_constraints constraints;
+    };
+
+    /** The cells of the visible rows, in row-major order.
+     */
+    std::vector<cell_type> _cells;
+
+    /** The cells of the previous layout, reused to reduce allocations.
+     */
+    std::vector<cell_type> _previous_cells;
+
+    /** Widgets that are not bound to a visible cell, for each column.
+     */
+    std::vector<std::vector<std::unique_ptr<widget>>> _free_widgets;
+
+    /** The maximum number of times the visible rows are measured during a single layout.
+     */
+    constexpr static int max_measure_passes = 4;
+
+    std::size_t _num_columns = 0;
+    std::vector<float> _column_widths;
+    estimated_extents _row_heights;
+
+    /** The preferred height returned by the last `update_constraints()`.
+     */
+    float _constrained_height = 0.0f;
+
+    float _baseline_adjustment = 0.0f;
+
+    /** The delegate has new data.
+     */
+    bool _reset = true;
+
+    delegate_type::callback_token _delegate_cbt;
+
+    /** Recycle all the widgets, so that the visible rows are bound to the new data.
+     *
+     * The measured heights of the rows and widths of the columns are kept, unless
+     * the number of columns or the estimated height of a row has changed.
+     */
+    void reset() noexcept
+    {
+        _reset = false;
+
+        hilet num_columns = delegate->num_columns(*this);
+        if (num_columns != _num_columns) {
+            // The widgets are only recycled within the same column.
+            _cells.clear();
+            _free_widgets.clear();
+            _num_columns = num_columns;
+            _column_widths.clear();
+        }
+
+        for (auto& cell : _cells) {
+            _free_widgets[cell.column].push_back(std::move(cell.value));
+        }
+        _cells.clear();
+
+        _free_widgets.resize(_num_columns);
+        _column_widths.resize(_num_columns, 0.0f);
+
+        hilet num_rows = delegate->num_rows(*this);
+        hilet estimated_row_height = delegate->estimated_row_height(*this);
+        if (estimated_row_height == _row_heights.estimate()) {
+            _row_heights.resize(num_rows);
+        } else {
+            _row_heights.reset(num_rows, estimated_row_height);
+        }
+    }
+
+    /** The height of the rows when laid out.
+     *
+     * The height of the layout is based on the height of the rows when the grid was
+     * last constrained, while the rows measured since then may have changed the height.
+     * The rows are laid out as they will be when the grid is constrained again; a parent
+     * like the `scroll_aperture_widget` keeps the distance to the bottom of the grid when
+     * its height changes, so the rows do not move.
+     *
+     * @param context The layout of the grid.
+     * @return The height of the rows, plus the height that the grid was stretched by.
+     */
+    [[nodiscard]] float layout_height(widget_layout const& context) const noexcept
+    {
+        return _row_heights.total() + std::max(0.0f, context.height() - _constrained_height);
+    }
+
+    /** The rows that overlap with the clipping rectangle.
+     *
+     * @param context The layout of the grid.
+     * @return The first visible row, and one beyond the last visible row.
+     */
+    [[nodiscard]] std::pair<std::size_t, std::size_t> visible_rows(widget_layout const& context) const noexcept
+    {
+        hilet height = layout_height(context);
+        hilet visible = intersect(aarectangle{0.0f, 0.0f, context.width(), height}, context.clipping_rectangle);
+        if (visible.empty()) {
+            return {0_uz, 0_uz};
+        }
+
+        // The rows are counted from the top.
+        hilet top = height - visible.top();
+        hilet bottom = height - visible.bottom();
+        hilet first_row = _row_heights.find(top);
+        auto last_row = _row_heights.find(bottom);
+        if (last_row < _row_heights.size() and _row_heights.offset(last_row) < bottom) {
+            // The last row is partially visible.
+            ++last_row;
+        }
+        return {first_row, std::max(first_row, last_row)};
+    }
+
+    /** Bind widgets to the cells of the visible rows, and measure them.
+     *
+     * @param first_row The first visible row.
+     * @param last_row One beyond the last visible row.
+     * @return True if the size of a row or column has changed.
+     */
+    bool update_cells(std::size_t first_row, std::size_t last_row) noexcept
+    {
+        std::swap(_cells, _previous_cells);
+        _cells.clear();
+
+        // Recycle the widgets of rows that are no longer visible.
+        for (auto& cell : _previous_cells) {
+            if (cell.row < first_row or cell.row >= last_row) {
+                _free_widgets[cell.column].push_back(std::move(cell.value));
+            }
+        }
+
+        auto extents_changed = false;
+        auto previous_it = _previous_cells.begin();
+        for (auto row = first_row; row != last_row; ++row) {
+            auto row_height = 0.0f;
+
+            for (auto column = 0_uz; column != _num_columns; ++column) {
+                while (previous_it != _previous_cells.end() and previous_it->value == nullptr) {
+                    ++previous_it;
+                }
+
+                if (previous_it != _previous_cells.end() and previous_it->row == row and previous_it->column == column) {
+                    // This cell was already visible.
+                    _cells.push_back(std::move(*previous_it));
+                    ++previous_it;
+
+                } else {
+                    auto& free_widgets = _free_widgets[column];
+                    auto cell_widget = std::unique_ptr<widget>{};
+                    if (free_widgets.empty()) {
+                        ++global_counter<"virtual_grid_widget:make_widget">;
+                        cell_widget = delegate->make_widget(*this, column);
+                    } else {
+                        cell_widget = std::move(free_widgets.back());
+                        free_widgets.pop_back();
+                    }
+                    hi_assert_not_null(cell_widget);
+
+                    ++global_counter<"virtual_grid_widget:bind">;
+                    delegate->bind(*this, *cell_widget, row, column);
+                    // Measure the widget with its new data. The grid is being laid out, so
+                    // the ancestors of the widget are not marked for a reconstrain.
+                    cell_widget->request_reconstrain_recursive();
+                    hilet& constraints = cell_widget->reconstrain();
+                    _cells.push_back(cell_type{row, column, std::move(cell_widget), constraints});
+                }
+
+                hilet& constraints = _cells.back().constraints;
+                row_height = std::max(row_height, constraints.preferred.height());
+                if (constraints.preferred.width() > _column_widths[column]) {
+                    _column_widths[column] = constraints.preferred.width();
+                    extents_changed = true;
+                }
+            }
+
+            extents_changed |= _row_heights.set(row, row_height);
+        }
+
+        _previous_cells.clear();
+        return extents_changed;
+    }
+};
+
+}} // namespace hi::v1
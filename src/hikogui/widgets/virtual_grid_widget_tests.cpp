@@ -0,0 +1,172 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "virtual_grid_widget.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+
+using namespace hi;
+
+namespace {
+
+class cell_widget : public widget {
+public:
+    std::size_t row = 0;
+    extent2 size = {50.0f, 20.0f};
+
+    cell_widget(widget *parent) noexcept : widget(parent) {}
+
+    [[nodiscard]] box_constraints update_constraints() noexcept override
+    {
+        _layout = {};
+        return {size, size, size};
+    }
+
+    void set_layout(widget_layout const& context) noexcept override
+    {
+        _layout = context;
+    }
+
+    /** The distance from the bottom of the grid to the top of this cell.
+     */
+    [[nodiscard]] float top() const noexcept
+    {
+        return (layout().to_parent * point2{0.0f, layout().height()}).y();
+    }
+};
+
+/** A list where the rows are estimated at 20 pixels.
+ */
+class test_delegate : public virtual_grid_delegate {
+public:
+    std::size_t row_count = 1000;
+    float estimate = 20.0f;
+    float row_height = 20.0f;
+
+    void notify() noexcept
+    {
+        _notifier();
+    }
+
+    [[nodiscard]] std::size_t num_rows(virtual_grid_widget& sender) noexcept override
+    {
+        return row_count;
+    }
+
+    [[nodiscard]] float estimated_row_height(virtual_grid_widget& sender) noexcept override
+    {
+        return estimate;
+    }
+
+    [[nodiscard]] std::unique_ptr<widget> make_widget(virtual_grid_widget& sender, std::size_t column) noexcept override
+    {
+        return std::make_unique<cell_widget>(&sender);
+    }
+
+    void bind(virtual_grid_widget& sender, widget& cell, std::size_t row, std::size_t column) noexcept override
+    {
+        auto& test_cell = dynamic_cast<cell_widget&>(cell);
+        test_cell.row = row;
+        test_cell.size = extent2{50.0f, row_height};
+    }
+};
+
+/** Layout the grid as the content of an aperture of 100 by 100 pixels.
+ *
+ * @param scroll_offset The distance between the top of the grid and the top of the aperture.
+ */
+[[nodiscard]] widget_layout make_layout(box_constraints const& constraints, float scroll_offset, int frame)
+{
+    auto r = widget_layout{};
+    r.shape.rectangle = aarectangle{100.0f, constraints.preferred.height()};
+    r.clipping_rectangle = aarectangle{0.0f, constraints.preferred.height() - scroll_offset - 100.0f, 100.0f, 100.0f};
+    r.display_time_point = utc_nanoseconds{std::chrono::milliseconds{frame + 1}};
+    return r;
+}
+
+[[nodiscard]] cell_widget *find_row(virtual_grid_widget& grid, std::size_t row)
+{
+    for (auto& child : grid.children(false)) {
+        auto& cell = dynamic_cast<cell_widget&>(child);
+        if (cell.row == row) {
+            return &cell;
+        }
+    }
+    return nullptr;
+}
+
+} // namespace
+
+TEST(virtual_grid_widget, binds_visible_rows)
+{
+    auto delegate = std::make_shared<test_delegate>();
+    auto grid = virtual_grid_widget{nullptr, delegate};
+
+    hilet constraints = grid.reconstrain();
+    ASSERT_EQ(constraints.preferred.height(), 20'000.0f);
+
+    grid.relayout(make_layout(constraints, 0.0f, 0));
+    ASSERT_EQ(grid.num_visible_cells(), 5U);
+    ASSERT_NE(find_row(grid, 0), nullptr);
+    ASSERT_NE(find_row(grid, 4), nullptr);
+    ASSERT_EQ(find_row(grid, 5), nullptr);
+
+    // Scrolling recycles the widgets of the rows that are no longer visible.
+    for (auto frame = 1; frame != 100; ++frame) {
+        grid.relayout(make_layout(grid.reconstrain(), narrow_cast<float>(frame) * 7.0f, frame));
+    }
+    ASSERT_NE(find_row(grid, 34), nullptr);
+    ASSERT_LE(grid.num_cell_widgets(), 6U);
+}
+
+TEST(virtual_grid_widget, layout_does_not_reconstrain_ancestors)
+{
+    auto delegate = std::make_shared<test_delegate>();
+    auto grid = virtual_grid_widget{nullptr, delegate};
+
+    // The first layout measures the width of the column.
+    grid.relayout(make_layout(grid.reconstrain(), 0.0f, 0));
+    grid.relayout(make_layout(grid.reconstrain(), 0.0f, 1));
+    ASSERT_FALSE(grid.needs_reconstrain());
+
+    // Binding the widgets of the rows that scroll into view does not mark the grid.
+    grid.relayout(make_layout(grid.reconstrain(), 50.0f, 2));
+    ASSERT_NE(find_row(grid, 7), nullptr);
+    ASSERT_FALSE(grid.needs_reconstrain());
+}
+
+TEST(virtual_grid_widget, measured_rows_do_not_move)
+{
+    auto delegate = std::make_shared<test_delegate>();
+    delegate->row_height = 30.0f;
+    auto grid = virtual_grid_widget{nullptr, delegate};
+
+    // The grid is laid out with the estimated height, the visible rows are measured larger.
+    hilet constraints = grid.reconstrain();
+    grid.relayout(make_layout(constraints, 0.0f, 0));
+    ASSERT_TRUE(grid.needs_reconstrain());
+
+    // The rows are laid out where they will be when the grid is constrained to its new height.
+    // The aperture keeps its distance to the bottom of the grid, so it now shows rows 1 to 4.
+    ASSERT_EQ(find_row(grid, 0), nullptr);
+    ASSERT_EQ(grid.num_visible_cells(), 4U);
+    hilet top = find_row(grid, 1)->top();
+
+    hilet new_constraints = grid.reconstrain();
+    ASSERT_EQ(new_constraints.preferred.height(), constraints.preferred.height() + 50.0f);
+    ASSERT_EQ(top, new_constraints.preferred.height() - 30.0f);
+
+    grid.relayout(make_layout(new_constraints, 50.0f, 1));
+    ASSERT_EQ(find_row(grid, 1)->top(), top);
+    ASSERT_FALSE(grid.needs_reconstrain());
+
+    // New data is bound to the visible rows, while the measurements are kept.
+    delegate->notify();
+    ASSERT_TRUE(grid.needs_reconstrain());
+    ASSERT_EQ(grid.reconstrain().preferred.height(), new_constraints.preferred.height());
+    grid.relayout(make_layout(new_constraints, 50.0f, 2));
+    ASSERT_EQ(find_row(grid, 1)->top(), top);
+    ASSERT_EQ(grid.num_visible_cells(), 4U);
+}
@@ -32,6 +32,14 @@ namespace hi { inline namespace v1 {
  *  2. Updating Layout: `widget::set_layout()`
  *  3. Drawing: `widget::draw()`
  *
+ * A container calls `reconstrain()` and `relayout()` on its children, instead
+ * of `update_constraints()` and `set_layout()`. This way only the subtrees of
+ * widgets that requested a reconstrain or relayout are visited.
+ *
+ * A container overrides `children()`. By default `for_each_child()` visits
+ * the widgets yielded by `children()`; a container should also override
+ * `for_each_child()` so that the passes over the widget tree do not allocate.
+ *
  * @ingroup widgets
  */
 class widget : public widget_intf {
@@ -108,7 +116,16 @@ public:
     using widget_intf::children;
     [[nodiscard]] generator<widget_intf &> children(bool include_invisible) noexcept override
     {
-        co_return;
+        // An empty generator, without allocating a coroutine frame.
+        return {};
+    }
+
+    using widget_intf::for_each_child;
+    void for_each_child(bool include_invisible, function_ref<void(widget_intf&)> func) noexcept override
+    {
+        for (auto& child : children(include_invisible)) {
+            func(child);
+        }
     }
 
     /** Find the widget that is under the mouse cursor.
@@ -127,10 +144,19 @@ public:
      *
      * This function will transform the position from parent coordinates to local coordinates.
      *
+     * During `indexed_hitbox_test()` the test is skipped for widgets that are not
+     * at the mouse cursor. The number of widgets tested is counted in the
+     * "widget:hitbox_test" counter.
+     *
      * @param position The coordinate of the mouse local to the parent widget.
      */
     [[nodiscard]] virtual hitbox hitbox_test_from_parent(point2 position) const noexcept
     {
+        if (hitbox_test_is_skipped()) {
+            return {};
+        }
+
+        ++global_counter<"widget:hitbox_test">;
         return hitbox_test(_layout.from_parent * position);
     }
 
@@ -143,6 +169,11 @@ public:
      */
     [[nodiscard]] virtual hitbox hitbox_test_from_parent(point2 position, hitbox sibling_hitbox) const noexcept
     {
+        if (hitbox_test_is_skipped()) {
+            return sibling_hitbox;
+        }
+
+        ++global_counter<"widget:hitbox_test">;
         return std::max(sibling_hitbox, hitbox_test(_layout.from_parent * position));
     }
 
@@ -177,7 +208,9 @@ public:
      */
     bool process_event(gui_event const& event) const noexcept override
     {
-        if (parent != nullptr) {
+        if (process_update_request(event)) {
+            return true;
+        } else if (parent != nullptr) {
             return parent->process_event(event);
         } else {
             return true;
@@ -188,6 +221,7 @@ public:
      */
     void request_redraw() const noexcept override
     {
+        invalidate_draw_list();
         process_event({gui_event_type::window_redraw, layout().clipping_rectangle_on_window()});
     }
 
@@ -272,9 +306,9 @@ public:
 
         auto handled = false;
 
-        for (auto& child : this->children(false)) {
+        this->for_each_child(false, [&](widget_intf& child) {
             handled |= child.handle_event_recursive(event, reject_list);
-        }
+        });
 
         if (!std::ranges::any_of(reject_list, [&](hilet& x) {
                 return x == id;
@@ -303,9 +337,9 @@ public:
         }
 
         auto children_ = std::vector<widget_intf const *>{};
-        for (auto& child : children(false)) {
+        for_each_child(false, [&](widget_intf const& child) {
             children_.push_back(std::addressof(child));
-        }
+        });
 
         if (direction == keyboard_focus_direction::backward) {
             std::reverse(begin(children_), end(children_));
@@ -349,12 +383,13 @@ public:
     {
         hi_axiom(loop::main().on_thread());
 
-        for (auto& child : children(false)) {
-            if (child.accepts_keyboard_focus(group)) {
-                return child.id;
+        auto found = widget_id{};
+        for_each_child(false, [&](widget_intf const& child) {
+            if (not found and child.accepts_keyboard_focus(group)) {
+                found = child.id;
             }
-        }
-        return std::nullopt;
+        });
+        return found;
     }
 
     [[nodiscard]] widget_id find_last_widget(keyboard_focus_group group) const noexcept override
@@ -362,11 +397,11 @@ public:
         hi_axiom(loop::main().on_thread());
 
         auto found = widget_id{};
-        for (auto& child : children(false)) {
+        for_each_child(false, [&](widget_intf const& child) {
             if (child.accepts_keyboard_focus(group)) {
                 found = child.id;
             }
-        }
+        });
 
         return found;
     }
@@ -0,0 +1,347 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "widget.hpp"
+#include "../macros.hpp"
+#include <gtest/gtest.h>
+#include <memory>
+#include <vector>
+
+using namespace hi;
+
+namespace {
+
+class leaf_widget : public widget {
+public:
+    extent2 size = {10.0f, 10.0f};
+    int num_update_constraints = 0;
+    int num_set_layout = 0;
+
+    leaf_widget(widget *parent) noexcept : widget(parent) {}
+
+    [[nodiscard]] box_constraints update_constraints() noexcept override
+    {
+        ++num_update_constraints;
+        _layout = {};
+        return {size, size, size};
+    }
+
+    void set_layout(widget_layout const& context) noexcept override
+    {
+        ++num_set_layout;
+        _layout = context;
+    }
+
+    [[nodiscard]] hitbox hitbox_test(point2 position) const noexcept override
+    {
+        if (layout().contains(position)) {
+            return {id, _layout.elevation, hitbox_type::button};
+        } else {
+            return {};
+        }
+    }
+};
+
+/** Stacks its children vertically, or horizontally.
+ */
+class stack_widget : public widget {
+public:
+    std::vector<std::unique_ptr<widget>> content;
+    bool horizontal = false;
+    int num_update_constraints = 0;
+    int num_set_layout = 0;
+
+    stack_widget(widget *parent) noexcept : widget(parent) {}
+
+    template<typename Widget>
+    Widget& emplace()
+    {
+        auto tmp = std::make_unique<Widget>(this);
+        auto& ref = *tmp;
+        content.push_back(std::move(tmp));
+        return ref;
+    }
+
+    [[nodiscard]] generator<widget_intf&> children(bool include_invisible) noexcept override
+    {
+        for (auto& child : content) {
+            co_yield *child;
+        }
+    }
+
+    void for_each_child(bool include_invisible, function_ref<void(widget_intf&)> func) noexcept override
+    {
+        for (auto& child : content) {
+            func(*child);
+        }
+    }
+
+    [[nodiscard]] box_constraints update_constraints() noexcept override
+    {
+        ++num_update_constraints;
+        _layout = {};
+
+        _child_sizes.clear();
+        auto size = extent2{};
+        for (auto& child : content) {
+            hilet& child_constraints = child->reconstrain();
+            if (horizontal) {
+                size.width() += child_constraints.preferred.width();
+                size.height() = std::max(size.height(), child_constraints.preferred.height());
+                _child_sizes.push_back(child_constraints.preferred.width());
+            } else {
+                size.width() = std::max(size.width(), child_constraints.preferred.width());
+                size.height() += child_constraints.preferred.height();
+                _child_sizes.push_back(child_constraints.preferred.height());
+            }
+        }
+        return {size, size, size};
+    }
+
+    void set_layout(widget_layout const& context) noexcept override
+    {
+        ++num_set_layout;
+        _layout = context;
+
+        auto offset = 0.0f;
+        for (auto i = 0_uz; i != content.size(); ++i) {
+            auto shape = box_shape{};
+            if (horizontal) {
+                shape.rectangle = aarectangle{offset, 0.0f, _child_sizes[i], context.height()};
+            } else {
+                shape.rectangle = aarectangle{0.0f, offset, context.width(), _child_sizes[i]};
+            }
+            content[i]->relayout(context.transform(shape, 0.0f));
+            offset += _child_sizes[i];
+        }
+    }
+
+    [[nodiscard]] hitbox hitbox_test(point2 position) const noexcept override
+    {
+        auto r = hitbox{};
+        for (auto& child : content) {
+            r = child->hitbox_test_from_parent(position, r);
+        }
+        return r;
+    }
+
+private:
+    std::vector<float> _child_sizes;
+};
+
+[[nodiscard]] widget_layout make_layout(box_constraints const& constraints, int frame)
+{
+    auto r = widget_layout{};
+    r.shape.rectangle = aarectangle{constraints.preferred};
+    r.clipping_rectangle = r.shape.rectangle;
+    r.display_time_point = utc_nanoseconds{std::chrono::milliseconds{frame + 1}};
+    return r;
+}
+
+} // namespace
+
+TEST(widget, reconstrain_only_dirty_subtree)
+{
+    auto root = stack_widget{nullptr};
+    auto& column1 = root.emplace<stack_widget>();
+    auto& column2 = root.emplace<stack_widget>();
+    auto& label1 = column1.emplace<leaf_widget>();
+    auto& label2 = column1.emplace<leaf_widget>();
+    auto& label3 = column2.emplace<leaf_widget>();
+
+    // The first frame visits every widget.
+    root.relayout(make_layout(root.reconstrain(), 0));
+    ASSERT_EQ(label1.num_update_constraints, 1);
+    ASSERT_EQ(label3.num_update_constraints, 1);
+    ASSERT_EQ(root.num_set_layout, 1);
+    ASSERT_EQ(label3.num_set_layout, 1);
+    ASSERT_FALSE(root.needs_reconstrain());
+    ASSERT_FALSE(root.needs_relayout());
+
+    // Nothing was requested, nothing is visited.
+    root.relayout(make_layout(root.reconstrain(), 1));
+    ASSERT_EQ(root.num_update_constraints, 1);
+    ASSERT_EQ(root.num_set_layout, 1);
+    ASSERT_EQ(label1.num_set_layout, 1);
+
+    // The constraints of label1 do not change, only label1 is updated.
+    label1.process_event({gui_event_type::window_reconstrain});
+    ASSERT_TRUE(root.needs_reconstrain());
+    root.relayout(make_layout(root.reconstrain(), 2));
+    ASSERT_EQ(label1.num_update_constraints, 2);
+    ASSERT_EQ(label1.num_set_layout, 2);
+    ASSERT_EQ(label2.num_update_constraints, 1);
+    ASSERT_EQ(label2.num_set_layout, 1);
+    ASSERT_EQ(column1.num_update_constraints, 1);
+    ASSERT_EQ(column1.num_set_layout, 1);
+    ASSERT_EQ(root.num_update_constraints, 1);
+    ASSERT_EQ(root.num_set_layout, 1);
+
+    // The constraints of label1 change, its ancestors are reconstrained and
+    // the siblings whose rectangle moved are laid out.
+    label1.size = extent2{10.0f, 20.0f};
+    label1.process_event({gui_event_type::window_reconstrain});
+    root.relayout(make_layout(root.reconstrain(), 3));
+    ASSERT_EQ(label1.num_update_constraints, 3);
+    ASSERT_EQ(label2.num_update_constraints, 1);
+    ASSERT_EQ(label3.num_update_constraints, 1);
+    ASSERT_EQ(column1.num_update_constraints, 2);
+    ASSERT_EQ(column2.num_update_constraints, 1);
+    ASSERT_EQ(root.num_update_constraints, 2);
+    ASSERT_EQ(label1.num_set_layout, 3);
+    ASSERT_EQ(label2.num_set_layout, 2);
+    ASSERT_EQ(label3.num_set_layout, 2);
+}
+
+TEST(widget, relayout_only_dirty_subtree)
+{
+    auto root = stack_widget{nullptr};
+    auto& column1 = root.emplace<stack_widget>();
+    auto& label1 = column1.emplace<leaf_widget>();
+    auto& label2 = column1.emplace<leaf_widget>();
+
+    root.relayout(make_layout(root.reconstrain(), 0));
+
+    label2.process_event({gui_event_type::window_relayout});
+    ASSERT_FALSE(root.needs_reconstrain());
+    ASSERT_TRUE(root.needs_relayout());
+
+    root.relayout(make_layout(root.reconstrain(), 1));
+    ASSERT_EQ(label2.num_update_constraints, 1);
+    ASSERT_EQ(label2.num_set_layout, 2);
+    ASSERT_EQ(label1.num_set_layout, 1);
+    ASSERT_EQ(column1.num_set_layout, 1);
+    ASSERT_EQ(root.num_set_layout, 1);
+}
+
+TEST(widget, reconstrain_recursive)
+{
+    auto root = stack_widget{nullptr};
+    auto& column1 = root.emplace<stack_widget>();
+    auto& label1 = column1.emplace<leaf_widget>();
+
+    root.relayout(make_layout(root.reconstrain(), 0));
+
+    root.request_reconstrain_recursive();
+    root.relayout(make_layout(root.reconstrain(), 1));
+    ASSERT_EQ(label1.num_update_constraints, 2);
+    ASSERT_EQ(column1.num_update_constraints, 2);
+    ASSERT_EQ(root.num_update_constraints, 2);
+    ASSERT_EQ(label1.num_set_layout, 2);
+}
+
+TEST(widget, visits_per_frame_5000_widgets)
+{
+    // A window with 50 columns of 100 labels, where the text of one label
+    // changes every frame without changing its size.
+    auto root = stack_widget{nullptr};
+    for (auto i = 0; i != 50; ++i) {
+        auto& column = root.emplace<stack_widget>();
+        for (auto j = 0; j != 100; ++j) {
+            column.emplace<leaf_widget>();
+        }
+    }
+    auto& label = *dynamic_cast<stack_widget&>(*root.content[25]).content[50];
+
+    root.relayout(make_layout(root.reconstrain(), 0));
+
+    for (auto frame = 1; frame != 10; ++frame) {
+        hilet reconstrain_count = static_cast<uint64_t>(global_counter<"widget:reconstrain">);
+        hilet relayout_count = static_cast<uint64_t>(global_counter<"widget:relayout">);
+
+        label.process_event({gui_event_type::window_reconstrain});
+        root.relayout(make_layout(root.reconstrain(), frame));
+
+        // Only the label and its two ancestors are visited.
+        ASSERT_EQ(global_counter<"widget:reconstrain"> - reconstrain_count, 3U);
+        ASSERT_EQ(global_counter<"widget:relayout"> - relayout_count, 1U);
+    }
+}
+
+TEST(widget, traversal_does_not_allocate)
+{
+    // A deep tree of 200 nested stacks, each with a label.
+    auto root = stack_widget{nullptr};
+    auto *stack = &root;
+    for (auto i = 0; i != 200; ++i) {
+        stack->emplace<leaf_widget>();
+        stack = &stack->emplace<stack_widget>();
+    }
+
+    root.relayout(make_layout(root.reconstrain(), 0));
+
+    hilet allocate_count = static_cast<uint64_t>(global_counter<"generator:allocate">);
+
+    // A frame where everything is reconstrained and laid out, followed by
+    // an event sent to every widget and a search through the whole tree.
+    root.request_reconstrain_recursive();
+    root.relayout(make_layout(root.reconstrain(), 1));
+    root.handle_event_recursive(gui_event{gui_event_type::gui_cancel});
+    ASSERT_EQ(get_if(&root, widget_id{}, true), nullptr);
+
+    ASSERT_EQ(global_counter<"generator:allocate"> - allocate_count, 0U);
+
+    // The children() generator is still available and visits the same children.
+    auto num_children = 0;
+    for ([[maybe_unused]] auto& child : root.children(true)) {
+        ++num_children;
+    }
+    ASSERT_EQ(num_children, 2);
+    ASSERT_GT(global_counter<"generator:allocate"> - allocate_count, 0U);
+}
+
+TEST(widget, indexed_hitbox_test_10000_widgets)
+{
+    // The index must outlive the widgets, which remove themselves from the index.
+    auto index = hitbox_index{};
+
+    // A window with 100 columns of 100 buttons.
+    auto root = stack_widget{nullptr};
+    root.horizontal = true;
+    for (auto i = 0; i != 100; ++i) {
+        auto& column = root.emplace<stack_widget>();
+        for (auto j = 0; j != 100; ++j) {
+            column.emplace<leaf_widget>();
+        }
+    }
+
+    root.set_hitbox_index(&index);
+    root.relayout(make_layout(root.reconstrain(), 0));
+    ASSERT_EQ(index.size(), 10101U);
+
+    hilet check_mouse_moves = [&] {
+        // Move the mouse diagonally over the window, including the edges between
+        // the buttons and the positions outside the window.
+        for (auto i = -20; i != 1020; ++i) {
+            hilet position = point2{narrow_cast<float>(i) * 0.97f, narrow_cast<float>(i) * 1.01f};
+
+            hilet expected = root.hitbox_test(position);
+
+            hilet count = static_cast<uint64_t>(global_counter<"widget:hitbox_test">);
+            hilet result = root.indexed_hitbox_test(position);
+            ASSERT_EQ(result.widget_id, expected.widget_id) << "position=" << i;
+            ASSERT_EQ(result.type, expected.type) << "position=" << i;
+
+            // Only the column and the buttons at the mouse cursor are tested.
+            ASSERT_LE(global_counter<"widget:hitbox_test"> - count, 6U);
+        }
+    };
+
+    check_mouse_moves();
+
+    // Make a button larger, which moves the buttons below it.
+    auto& column = dynamic_cast<stack_widget&>(*root.content[10]);
+    auto& button = dynamic_cast<leaf_widget&>(*column.content[10]);
+    button.size = extent2{10.0f, 25.0f};
+    button.process_event({gui_event_type::window_reconstrain});
+    root.relayout(make_layout(root.reconstrain(), 1));
+    check_mouse_moves();
+
+    // Removed widgets are removed from the index.
+    column.content.pop_back();
+    ASSERT_EQ(index.size(), 10100U);
+    column.process_event({gui_event_type::window_reconstrain});
+    root.relayout(make_layout(root.reconstrain(), 2));
+    check_mouse_moves();
+}
@@ -89,14 +89,19 @@ public:
         co_yield *_toolbar;
         co_yield *_content;
     }
+    void for_each_child(bool include_invisible, function_ref<void(widget_intf&)> func) noexcept override
+    {
+        func(*_toolbar);
+        func(*_content);
+    }
     [[nodiscard]] box_constraints update_constraints() noexcept override
     {
         hi_assert_not_null(_content);
         hi_assert_not_null(_toolbar);
 
         _layout = {};
-        _content_constraints = _content->update_constraints();
-        _toolbar_constraints = _toolbar->update_constraints();
+        _content_constraints = _content->reconstrain();
+        _toolbar_constraints = _toolbar->reconstrain();
 
         auto r = box_constraints{};
         r.minimum.width() = std::max(
@@ -165,8 +170,8 @@ public:
                 point2{context.width() - _content_constraints.margins.right(), toolbar_rectangle.bottom() - between_margin}};
             _content_shape = box_shape{_content_constraints, content_rectangle, theme().baseline_adjustment()};
         }
-        _toolbar->set_layout(context.transform(_toolbar_shape));
-        _content->set_layout(context.transform(_content_shape));
+        _toolbar->relayout(context.transform(_toolbar_shape));
+        _content->relayout(context.transform(_content_shape));
     }
     void draw(draw_context const& context) noexcept override
     {
@@ -255,7 +260,9 @@ public:
     }
     bool process_event(gui_event const& event) const noexcept override
     {
-        if (_window) {
+        if (process_update_request(event)) {
+            return true;
+        } else if (_window) {
             return _window->process_event(event);
         } else {
             // Since there is no window, pretend that the message was handled.
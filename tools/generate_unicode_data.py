@@ -38,6 +38,8 @@ def parse_options():
     parser.add_argument("--line-break", dest="line_break_class_path", action="store", required=True)
     parser.add_argument("--line-break-classes-output", dest="line_break_classes_output_path", action="store", required=True)
     parser.add_argument("--line-break-classes-template", dest="line_break_classes_template_path", action="store", required=True)
+    parser.add_argument("--properties-output", dest="properties_output_path", action="store", required=True)
+    parser.add_argument("--properties-template", dest="properties_template_path", action="store", required=True)
     parser.add_argument("--prop-list", dest="prop_list_path", action="store", required=True)
     parser.add_argument("--scripts", dest="scripts_path", action="store", required=True)
     parser.add_argument("--scripts-output", dest="scripts_output_path", action="store", required=True)
@@ -80,6 +82,7 @@ def main():
     ucd.generate_grapheme_cluster_breaks(options.grapheme_cluster_breaks_template_path, options.grapheme_cluster_breaks_output_path, descriptions)
     ucd.generate_lexical_classes(options.lexical_classes_template_path, options.lexical_classes_output_path, descriptions)
     ucd.generate_line_break_classes(options.line_break_classes_template_path, options.line_break_classes_output_path, descriptions)
+    ucd.generate_properties(options.properties_template_path, options.properties_output_path, descriptions)
     ucd.generate_scripts(options.scripts_template_path, options.scripts_output_path, descriptions)
     ucd.generate_sentence_break_properties(options.sentence_break_properties_template_path, options.sentence_break_properties_output_path, descriptions)
     ucd.generate_word_break_properties(options.word_break_properties_template_path, options.word_break_properties_output_path, descriptions)
@@ -42,6 +42,8 @@ $PYTHON3 tools/generate_unicode_data.py \
     --word-break-properties-output=src/hikogui/unicode/ucd_word_break_properties.hpp \
     --sentence-break-properties-template=tools/ucd/ucd_sentence_break_properties.hpp.psp \
     --sentence-break-properties-output=src/hikogui/unicode/ucd_sentence_break_properties.hpp \
+    --properties-template=tools/ucd/ucd_properties.hpp.psp \
+    --properties-output=src/hikogui/unicode/ucd_properties.hpp \
     --canonical-combining-classes-template=tools/ucd/ucd_canonical_combining_classes.hpp.psp \
     --canonical-combining-classes-output=src/hikogui/unicode/ucd_canonical_combining_classes.hpp \
     --index-template=tools/ucd/ucd_index.hpp.psp \
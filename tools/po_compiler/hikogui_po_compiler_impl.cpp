@@ -0,0 +1,39 @@
+// Copyright Take Vos 2023.
+// Distributed under the Boost Software License, Version 1.0.
+// (See accompanying file LICENSE_1_0.txt or copy at https://www.boost.org/LICENSE_1_0.txt)
+
+#include "hikogui/l10n/translation_catalog.hpp"
+#include <filesystem>
+#include <exception>
+#include <iostream>
+
+/** Compile a gettext .po file into a .hitc translation catalog.
+ *
+ * This tool is called by the `add_translation_catalogs()` CMake function, so that
+ * the application loads the pre-compiled catalog instead of parsing the .po file.
+ */
+
+int usage()
+{
+    std::cerr << "Usage:\n";
+    std::cerr << "    hikogui_po_compiler <po input filename> <hitc output filename>\n" << std::endl;
+    return 2;
+}
+
+int main(int argc, char *argv[])
+{
+    if (argc != 3) {
+        return usage();
+    }
+    auto po_filename = std::filesystem::path(argv[1]);
+    auto catalog_filename = std::filesystem::path(argv[2]);
+
+    try {
+        hi::compile_translation_catalog(po_filename, catalog_filename);
+    } catch (std::exception const& e) {
+        std::cerr << po_filename.string() << ": error: " << e.what() << std::endl;
+        std::filesystem::remove(catalog_filename);
+        return 1;
+    }
+    return 0;
+}
@@ -29,6 +29,7 @@ from .generate_general_categories import generate_general_categories
 from .generate_grapheme_cluster_breaks import generate_grapheme_cluster_breaks
 from .generate_lexical_classes import generate_lexical_classes
 from .generate_line_break_classes import generate_line_break_classes
+from .generate_properties import generate_properties
 from .generate_scripts import generate_scripts
 from .generate_sentence_break_properties import generate_sentence_break_properties
 from .generate_word_break_properties import generate_word_break_properties
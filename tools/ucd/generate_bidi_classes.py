@@ -4,14 +4,22 @@ from .deduplicate import deduplicate
 from .bits_as_bytes import bits_as_bytes
 import sys
 
-def generate_bidi_classes(template_path, output_path, descriptions):
-    print("Processing bidi_classes:", file=sys.stderr, flush=True)
+def make_bidi_class_enum(descriptions):
+    """Assign a value to each bidi_class.
 
+    @return The bidi_class enum, A list of values one for each code-point.
+    """
     bidi_class_enum = {"ON": 0, "L": 1, "R": 2}
     bidi_classes = []
     for x in descriptions:
         value = bidi_class_enum.setdefault(x.bidi_class, len(bidi_class_enum))
         bidi_classes.append(value)
+    return bidi_class_enum, bidi_classes
+
+def generate_bidi_classes(template_path, output_path, descriptions):
+    print("Processing bidi_classes:", file=sys.stderr, flush=True)
+
+    bidi_class_enum, bidi_classes = make_bidi_class_enum(descriptions)
 
     bidi_classes, indices, chunk_size = deduplicate(bidi_classes)
     bidi_classes_bytes, bidi_class_width = bits_as_bytes(bidi_classes)
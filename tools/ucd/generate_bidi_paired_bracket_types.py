@@ -4,15 +4,23 @@ from .deduplicate import deduplicate
 from .bits_as_bytes import bits_as_bytes
 import sys
 
-def generate_bidi_paired_bracket_types(template_path, output_path, descriptions):
-    print("Processing bidi_paired_bracket_types:", file=sys.stderr, flush=True)
+def make_bidi_paired_bracket_type_enum(descriptions):
+    """Assign a value to each bidi_paired_bracket_type.
 
+    @return The bidi_paired_bracket_type enum, A list of values one for each code-point.
+    """
     bidi_paired_bracket_type_enum = {"n": 0}
     bidi_paired_bracket_types = []
     for x in descriptions:
         value = bidi_paired_bracket_type_enum.setdefault(
             x.bidi_paired_bracket_type, len(bidi_paired_bracket_type_enum))
         bidi_paired_bracket_types.append(value)
+    return bidi_paired_bracket_type_enum, bidi_paired_bracket_types
+
+def generate_bidi_paired_bracket_types(template_path, output_path, descriptions):
+    print("Processing bidi_paired_bracket_types:", file=sys.stderr, flush=True)
+
+    bidi_paired_bracket_type_enum, bidi_paired_bracket_types = make_bidi_paired_bracket_type_enum(descriptions)
 
     bidi_paired_bracket_types, indices, chunk_size = deduplicate(bidi_paired_bracket_types)
     bidi_paired_bracket_types_bytes, bidi_paired_bracket_type_width = bits_as_bytes(bidi_paired_bracket_types)
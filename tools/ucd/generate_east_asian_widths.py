@@ -4,14 +4,22 @@ from .deduplicate import deduplicate
 from .bits_as_bytes import bits_as_bytes
 import sys
 
-def generate_east_asian_widths(template_path, output_path, descriptions):
-    print("Processing east_asian_widths:", file=sys.stderr, flush=True)
+def make_east_asian_width_enum(descriptions):
+    """Assign a value to each east_asian_width.
 
+    @return The east_asian_width enum, A list of values one for each code-point.
+    """
     east_asian_width_enum = {"N": 0}
     east_asian_widths = []
     for x in descriptions:
         value = east_asian_width_enum.setdefault(x.east_asian_width, len(east_asian_width_enum))
         east_asian_widths.append(value)
+    return east_asian_width_enum, east_asian_widths
+
+def generate_east_asian_widths(template_path, output_path, descriptions):
+    print("Processing east_asian_widths:", file=sys.stderr, flush=True)
+
+    east_asian_width_enum, east_asian_widths = make_east_asian_width_enum(descriptions)
 
     east_asian_widths, indices, chunk_size = deduplicate(east_asian_widths)
     east_asian_widths_bytes, east_asian_width_width = bits_as_bytes(east_asian_widths)
@@ -4,9 +4,11 @@ from .deduplicate import deduplicate
 from .bits_as_bytes import bits_as_bytes
 import sys
 
-def generate_general_categories(template_path, output_path, descriptions):
-    print("Processing general_categories:", file=sys.stderr, flush=True)
+def make_general_category_enum(descriptions):
+    """Assign a value to each general_category.
 
+    @return The general_category enum, A list of values one for each code-point.
+    """
     # For performance improvement of the is_* functions the enum values should be
     # sorted by grouped by their first letter. "Cn" is used most, move it to first person
     # so that the table will mostly contain zeros.
@@ -19,6 +21,12 @@ def generate_general_categories(template_path, output_path, descriptions):
         general_category_enum[name] = i
 
     general_categories = [general_category_enum[x.general_category] for x in descriptions]
+    return general_category_enum, general_categories
+
+def generate_general_categories(template_path, output_path, descriptions):
+    print("Processing general_categories:", file=sys.stderr, flush=True)
+
+    general_category_enum, general_categories = make_general_category_enum(descriptions)
 
     general_categories, indices, chunk_size = deduplicate(general_categories)
     general_categories_bytes, general_category_width = bits_as_bytes(general_categories)
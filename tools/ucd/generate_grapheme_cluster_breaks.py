@@ -5,15 +5,23 @@ from .bits_as_bytes import bits_as_bytes
 import sys
 
 
-def generate_grapheme_cluster_breaks(template_path, output_path, descriptions):
-    print("Processing grapheme_cluster_break:", file=sys.stderr, flush=True)
+def make_grapheme_cluster_break_enum(descriptions):
+    """Assign a value to each grapheme_cluster_break.
 
+    @return The grapheme_cluster_break enum, A list of values one for each code-point.
+    """
     grapheme_cluster_break_enum = {"Other": 0}
     grapheme_cluster_breaks = []
     for x in descriptions:
         name = "Extended_Pictographic" if x.extended_pictographic else x.grapheme_cluster_break
         value = grapheme_cluster_break_enum.setdefault(name, len(grapheme_cluster_break_enum))
         grapheme_cluster_breaks.append(value)
+    return grapheme_cluster_break_enum, grapheme_cluster_breaks
+
+def generate_grapheme_cluster_breaks(template_path, output_path, descriptions):
+    print("Processing grapheme_cluster_break:", file=sys.stderr, flush=True)
+
+    grapheme_cluster_break_enum, grapheme_cluster_breaks = make_grapheme_cluster_break_enum(descriptions)
 
     grapheme_cluster_breaks, indices, chunk_size = deduplicate(grapheme_cluster_breaks)
     grapheme_cluster_breaks_bytes, grapheme_cluster_break_width = bits_as_bytes(grapheme_cluster_breaks)
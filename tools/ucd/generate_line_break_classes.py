@@ -4,14 +4,22 @@ from .deduplicate import deduplicate
 from .bits_as_bytes import bits_as_bytes
 import sys
 
-def generate_line_break_classes(template_path, output_path, descriptions):
-    print("Processing line_break_class:", file=sys.stderr, flush=True)
+def make_line_break_class_enum(descriptions):
+    """Assign a value to each line_break_class.
 
+    @return The line_break_class enum, A list of values one for each code-point.
+    """
     line_break_class_enum = {"XX": 0}
     line_break_classes = []
     for x in descriptions:
         value = line_break_class_enum.setdefault(x.line_break, len(line_break_class_enum))
         line_break_classes.append(value)
+    return line_break_class_enum, line_break_classes
+
+def generate_line_break_classes(template_path, output_path, descriptions):
+    print("Processing line_break_class:", file=sys.stderr, flush=True)
+
+    line_break_class_enum, line_break_classes = make_line_break_class_enum(descriptions)
 
     line_break_classes, indices, chunk_size = deduplicate(line_break_classes)
     line_break_classes_bytes, line_break_class_width = bits_as_bytes(line_break_classes)
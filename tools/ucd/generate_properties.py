@@ -0,0 +1,130 @@
+
+from .psp import psp_execute
+from .deduplicate import deduplicate
+from .bits_as_bytes import bits_as_bytes
+from .generate_bidi_classes import make_bidi_class_enum
+from .generate_bidi_paired_bracket_types import make_bidi_paired_bracket_type_enum
+from .generate_east_asian_widths import make_east_asian_width_enum
+from .generate_general_categories import make_general_category_enum
+from .generate_grapheme_cluster_breaks import make_grapheme_cluster_break_enum
+from .generate_line_break_classes import make_line_break_class_enum
+from .generate_scripts import make_script_enum
+from .generate_sentence_break_properties import make_sentence_break_property_enum
+from .generate_word_break_properties import make_word_break_property_enum
+import sys
+
+def is_canonical_decomposition(d):
+    return d.decomposition_type is None and len(d.decomposition_mapping) != 0
+
+def make_quick_check_values(descriptions):
+    """Derive the NFC_QC and NFD_QC properties.
+
+    The properties are derived in the same way as DerivedNormalizationProps.txt
+    from the decompositions and the composition exclusions.
+
+    @return A list of NFC_QC values, A list of NFD_QC values; one for each code-point.
+            The values are: 0 = Yes, 1 = No, 2 = Maybe.
+    """
+    nfc_quick_checks = [0] * len(descriptions)
+    nfd_quick_checks = [0] * len(descriptions)
+
+    for code_point, d in enumerate(descriptions):
+        if not is_canonical_decomposition(d):
+            continue
+
+        # Decomposed characters are never in NFD.
+        nfd_quick_checks[code_point] = 1
+
+        is_singleton = len(d.decomposition_mapping) == 1
+        is_non_starter = d.canonical_combining_class != 0 or descriptions[d.decomposition_mapping[0]].canonical_combining_class != 0
+        if d.composition_exclusion or is_singleton or is_non_starter:
+            # Full_Composition_Exclusion, never in NFC.
+            nfc_quick_checks[code_point] = 1
+
+    for code_point, d in enumerate(descriptions):
+        if is_canonical_decomposition(d) and nfc_quick_checks[code_point] == 0:
+            # The second character of a primary composite may compose with the character before it.
+            second_code_point = d.decomposition_mapping[1]
+            assert nfc_quick_checks[second_code_point] != 1
+            nfc_quick_checks[second_code_point] = 2
+
+    return nfc_quick_checks, nfd_quick_checks
+
+def generate_properties(template_path, output_path, descriptions):
+    """Generate a single table with the properties used by the text algorithms.
+
+    The table has three stages:
+     1. An index of chunks of code-points.
+     2. Deduplicated chunks, with an index into the list of property records.
+     3. The unique property records, each packed in a 64-bit integer.
+
+    The values of each property are the same as in the per-property tables.
+    """
+    print("Processing properties:", file=sys.stderr, flush=True)
+
+    nfc_quick_checks, nfd_quick_checks = make_quick_check_values(descriptions)
+
+    # The order of the fields in the 64-bit record, from least-significant bit.
+    # Each field has a name, the C++ type of the accessor and its values.
+    fields = [
+        ("general_category", "unicode_general_category", make_general_category_enum(descriptions)[1]),
+        ("grapheme_cluster_break", "unicode_grapheme_cluster_break", make_grapheme_cluster_break_enum(descriptions)[1]),
+        ("line_break_class", "unicode_line_break_class", make_line_break_class_enum(descriptions)[1]),
+        ("word_break_property", "unicode_word_break_property", make_word_break_property_enum(descriptions)[1]),
+        ("sentence_break_property", "unicode_sentence_break_property", make_sentence_break_property_enum(descriptions)[1]),
+        ("east_asian_width", "unicode_east_asian_width", make_east_asian_width_enum(descriptions)[1]),
+        ("bidi_class", "unicode_bidi_class", make_bidi_class_enum(descriptions)[1]),
+        ("bidi_paired_bracket_type", "unicode_bidi_paired_bracket_type", make_bidi_paired_bracket_type_enum(descriptions)[1]),
+        ("script", "iso_15924", make_script_enum(descriptions)[1]),
+        ("canonical_combining_class", "uint8_t", [x.canonical_combining_class for x in descriptions]),
+        ("nfc_quick_check", "unicode_normalization_quick_check", nfc_quick_checks),
+        ("nfd_quick_check", "unicode_normalization_quick_check", nfd_quick_checks),
+    ]
+
+    field_layout = []
+    shift = 0
+    for name, type, values in fields:
+        width = max(max(values), 1).bit_length()
+        field_layout.append((name, shift, width, type))
+        shift += width
+    assert shift <= 64
+
+    records = [0] * len(descriptions)
+    for (name, type, values), (_, shift, width, _) in zip(fields, field_layout):
+        for i, value in enumerate(values):
+            records[i] |= value << shift
+
+    # Give each unique record an index, in order of first use, so that the
+    # records of the most common code-points (ASCII) are in the first cache-line.
+    record_enum = {}
+    record_indices = [record_enum.setdefault(x, len(record_enum)) for x in records]
+    unique_records = sorted(record_enum.keys(), key=lambda x: record_enum[x])
+
+    # Latin-1 is looked up directly by the fast-paths of the text algorithms.
+    latin1_records = records[:256]
+
+    record_indices, indices, chunk_size = deduplicate(record_indices)
+    record_indices_bytes, record_index_width = bits_as_bytes(record_indices)
+    indices_bytes, index_width = bits_as_bytes(indices)
+
+    print("    chunk-size={} #indices={}:{} #record_indices={}:{} #records={}:64 total={} bytes".format(
+        chunk_size,
+        len(indices), index_width,
+        len(record_indices), record_index_width,
+        len(unique_records),
+        len(indices_bytes) + len(record_indices_bytes) + len(unique_records) * 8),
+        file=sys.stderr)
+
+    psp_execute(
+        template_path,
+        output_path,
+        chunk_size=chunk_size,
+        indices_size=len(indices),
+        index_width=index_width,
+        indices_bytes=indices_bytes,
+        record_index_width=record_index_width,
+        record_indices_bytes=record_indices_bytes,
+        records=unique_records,
+        latin1_records=latin1_records,
+        field_layout=field_layout
+    )
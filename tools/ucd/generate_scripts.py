@@ -4,9 +4,11 @@ from .deduplicate import deduplicate
 from .bits_as_bytes import bits_as_bytes
 import sys
 
-def generate_scripts(template_path, output_path, descriptions):
-    print("Processing scripts:", file=sys.stderr, flush=True)
+def make_script_enum(descriptions):
+    """Assign the ISO-15924 number to each script.
 
+    @return The script enum, A list of values one for each code-point.
+    """
     script_enum = {
         "Adlam": 166,
         "Ahom": 338,
@@ -181,6 +183,12 @@ def generate_scripts(template_path, output_path, descriptions):
         print("    unused script:", unused_script, file=sys.stderr)
 
     scripts = [script_enum[x.script] for x in descriptions]
+    return script_enum, scripts
+
+def generate_scripts(template_path, output_path, descriptions):
+    print("Processing scripts:", file=sys.stderr, flush=True)
+
+    script_enum, scripts = make_script_enum(descriptions)
 
     scripts, indices, chunk_size = deduplicate(scripts)
     scripts_bytes, script_width = bits_as_bytes(scripts)
@@ -5,14 +5,22 @@ from .bits_as_bytes import bits_as_bytes
 import sys
 
 
-def generate_sentence_break_properties(template_path, output_path, descriptions):
-    print("Processing sentence_break_property:", file=sys.stderr, flush=True)
+def make_sentence_break_property_enum(descriptions):
+    """Assign a value to each sentence_break_property.
 
+    @return The sentence_break_property enum, A list of values one for each code-point.
+    """
     sentence_break_property_enum = {"Other": 0}
     sentence_break_properties = []
     for x in descriptions:
         value = sentence_break_property_enum.setdefault(x.sentence_break, len(sentence_break_property_enum))
         sentence_break_properties.append(value)
+    return sentence_break_property_enum, sentence_break_properties
+
+def generate_sentence_break_properties(template_path, output_path, descriptions):
+    print("Processing sentence_break_property:", file=sys.stderr, flush=True)
+
+    sentence_break_property_enum, sentence_break_properties = make_sentence_break_property_enum(descriptions)
 
     sentence_break_properties, indices, chunk_size = deduplicate(sentence_break_properties)
     sentence_break_properties_bytes, sentence_break_property_width = bits_as_bytes(sentence_break_properties)
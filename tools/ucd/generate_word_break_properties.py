@@ -4,14 +4,22 @@ from .deduplicate import deduplicate
 from .bits_as_bytes import bits_as_bytes
 import sys
 
-def generate_word_break_properties(template_path, output_path, descriptions):
-    print("Processing word_break_property:", file=sys.stderr, flush=True)
+def make_word_break_property_enum(descriptions):
+    """Assign a value to each word_break_property.
 
+    @return The word_break_property enum, A list of values one for each code-point.
+    """
     word_break_property_enum = {"Other": 0}
     word_break_properties = []
     for x in descriptions:
         value = word_break_property_enum.setdefault(x.word_break, len(word_break_property_enum))
         word_break_properties.append(value)
+    return word_break_property_enum, word_break_properties
+
+def generate_word_break_properties(template_path, output_path, descriptions):
+    print("Processing word_break_property:", file=sys.stderr, flush=True)
+
+    word_break_property_enum, word_break_properties = make_word_break_property_enum(descriptions)
 
     word_break_properties, indices, chunk_size = deduplicate(word_break_properties)
     word_break_properties_bytes, word_break_property_width = bits_as_bytes(word_break_properties)